@@ -0,0 +1,220 @@
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include "hal.h"
+#include "command_executor.h"
+#include "pin_sampler.h"
+#include "pins.h"
+#include "logger.h"
+
+// one step of a button sequence: set pin to level, then hold for holdMs
+struct CommandStep {
+  int pin;
+  int level;
+  uint16_t holdMs;
+};
+
+const int maxCommandSteps = 24;
+const uint16_t buttonPressMs = 150;
+const uint16_t unlockPauseMs = 100;
+const int unlockPresses = 4;
+
+struct CommandSequence {
+  CommandStep steps[maxCommandSteps];
+  int count;
+};
+
+static std::mutex commandLock;
+static std::condition_variable commandAvailable;
+static CommandInfo commandHistory[commandHistorySize];
+static uint32_t pendingCommands[commandQueueSize];
+static int pendingHead = 0;
+static int pendingCount = 0;
+static uint32_t lastCommandId = 0;
+static std::atomic<void (*)(uint32_t)> commandFinishedListener(nullptr);
+
+static CommandInfo *findCommand(uint32_t id) {
+  if(id == 0) {
+    return NULL;
+  }
+  CommandInfo &entry = commandHistory[id % commandHistorySize];
+  return entry.id == id ? &entry : NULL;
+}
+
+static void setCommandStatus(uint32_t id, CommandStatus status) {
+  std::lock_guard<std::mutex> guard(commandLock);
+  CommandInfo *command = findCommand(id);
+  if(command) {
+    command->status = status;
+  }
+}
+
+static void addStep(CommandSequence &sequence, int pin, int level, uint16_t holdMs) {
+  if(sequence.count < maxCommandSteps) {
+    sequence.steps[sequence.count++] = { pin, level, holdMs };
+  }
+}
+
+// stop is active high, all other buttons are active low
+static void addButtonPress(CommandSequence &sequence, int pin, bool holdStopButtonPressed = false) {
+  if(holdStopButtonPressed) {
+    addStep(sequence, pinButtonStop, HIGH, buttonPressMs);
+  }
+  addStep(sequence, pin, LOW, buttonPressMs);
+  addStep(sequence, pin, HIGH, 0);
+  if(holdStopButtonPressed) {
+    addStep(sequence, pinButtonStop, LOW, 0);
+  }
+}
+
+static void addUnlock(CommandSequence &sequence) {
+  // press 4 times on lock button
+  for(int i = 0; i < unlockPresses; i++) {
+    addStep(sequence, pinButtonLock, LOW, buttonPressMs);
+    addStep(sequence, pinButtonLock, HIGH, unlockPauseMs);
+  }
+}
+
+static void playSequence(const CommandSequence &sequence) {
+  unsigned long stepStartedAt = halMillis();
+  for(int i = 0; i < sequence.count; i++) {
+    const CommandStep &step = sequence.steps[i];
+    halDigitalWrite(step.pin, step.level);
+    if(step.holdMs > 0) {
+      halDelayUntil(stepStartedAt, step.holdMs);
+    } else {
+      stepStartedAt = halMillis();
+    }
+  }
+}
+
+// the locked led needs one blink window to show the new state
+static bool waitForLockedState(bool expectedLocked) {
+  halDelay(2 * ledBlinkWindowMs);
+  return getMowerSnapshot().isLocked == expectedLocked;
+}
+
+static CommandStatus runCommand(CommandType type) {
+  CommandSequence sequence;
+  sequence.count = 0;
+  bool locked = getMowerSnapshot().isLocked;
+
+  switch(type) {
+    case COMMAND_START:
+    case COMMAND_HOME:
+      if(locked) {
+        addUnlock(sequence);
+      }
+      addButtonPress(sequence, type == COMMAND_START ? pinButtonStart : pinButtonHome, true);
+      playSequence(sequence);
+      return COMMAND_DONE;
+
+    case COMMAND_STOP:
+      addStep(sequence, pinButtonStop, HIGH, buttonPressMs);
+      addStep(sequence, pinButtonStop, LOW, 0);
+      playSequence(sequence);
+      return COMMAND_DONE;
+
+    case COMMAND_LOCK:
+      if(locked) {
+        return COMMAND_SKIPPED;
+      }
+      addButtonPress(sequence, pinButtonLock);
+      playSequence(sequence);
+      return waitForLockedState(true) ? COMMAND_DONE : COMMAND_FAILED;
+
+    case COMMAND_UNLOCK:
+      if(!locked) {
+        return COMMAND_SKIPPED;
+      }
+      addUnlock(sequence);
+      playSequence(sequence);
+      return waitForLockedState(false) ? COMMAND_DONE : COMMAND_FAILED;
+  }
+  return COMMAND_FAILED;
+}
+
+static void commandExecutorTask(void *parameter) {
+  for(;;) {
+    uint32_t id;
+    CommandType type;
+    {
+      std::unique_lock<std::mutex> lock(commandLock);
+      commandAvailable.wait(lock, [] { return pendingCount > 0; });
+      id = pendingCommands[pendingHead];
+      pendingHead = (pendingHead + 1) % commandQueueSize;
+      pendingCount--;
+
+      CommandInfo *command = findCommand(id);
+      if(!command) {
+        continue;
+      }
+      command->status = COMMAND_RUNNING;
+      type = command->type;
+    }
+
+    LOG_DEBUG("Running command %u: %s", id, commandTypeName(type));
+    CommandStatus result = runCommand(type);
+    setCommandStatus(id, result);
+    LOG_DEBUG("Command %u %s", id, commandStatusName(result));
+    void (*listener)(uint32_t) = commandFinishedListener.load(std::memory_order_acquire);
+    if(listener) {
+      listener(id);
+    }
+  }
+}
+
+void setCommandFinishedListener(void (*listener)(uint32_t id)) {
+  commandFinishedListener.store(listener, std::memory_order_release);
+}
+
+void startCommandExecutor() {
+  halStartTask(commandExecutorTask, "commands", 4096, 2);
+}
+
+uint32_t queueCommand(CommandType type) {
+  std::lock_guard<std::mutex> guard(commandLock);
+  if(pendingCount >= commandQueueSize) {
+    return 0;
+  }
+
+  uint32_t id = ++lastCommandId;
+  commandHistory[id % commandHistorySize] = { id, type, COMMAND_QUEUED };
+  pendingCommands[(pendingHead + pendingCount) % commandQueueSize] = id;
+  pendingCount++;
+  commandAvailable.notify_one();
+
+  return id;
+}
+
+bool getCommandInfo(uint32_t id, CommandInfo &info) {
+  std::lock_guard<std::mutex> guard(commandLock);
+  CommandInfo *command = findCommand(id);
+  if(!command) {
+    return false;
+  }
+  info = *command;
+  return true;
+}
+
+const char *commandTypeName(CommandType type) {
+  switch(type) {
+    case COMMAND_START: return "start";
+    case COMMAND_HOME: return "home";
+    case COMMAND_STOP: return "stop";
+    case COMMAND_LOCK: return "lock";
+    case COMMAND_UNLOCK: return "unlock";
+  }
+  return "unknown";
+}
+
+const char *commandStatusName(CommandStatus status) {
+  switch(status) {
+    case COMMAND_QUEUED: return "queued";
+    case COMMAND_RUNNING: return "running";
+    case COMMAND_DONE: return "done";
+    case COMMAND_SKIPPED: return "skipped";
+    case COMMAND_FAILED: return "failed";
+    default: return "unknown";
+  }
+}
@@ -0,0 +1,45 @@
+#ifndef COMMAND_EXECUTOR_H
+#define COMMAND_EXECUTOR_H
+
+#include <stdint.h>
+
+// Button presses take up to a few seconds, so they are queued and
+// played by their own task instead of blocking the caller.
+
+enum CommandType {
+  COMMAND_START,
+  COMMAND_HOME,
+  COMMAND_STOP,
+  COMMAND_LOCK,
+  COMMAND_UNLOCK
+};
+
+enum CommandStatus {
+  COMMAND_UNKNOWN,
+  COMMAND_QUEUED,
+  COMMAND_RUNNING,
+  COMMAND_DONE,
+  COMMAND_SKIPPED,
+  COMMAND_FAILED
+};
+
+struct CommandInfo {
+  uint32_t id;
+  CommandType type;
+  CommandStatus status;
+};
+
+const int commandQueueSize = 8;
+// finished commands stay pollable until they are pushed out of this history
+const int commandHistorySize = 16;
+
+void startCommandExecutor();
+// returns the command id, or 0 if the queue is full
+uint32_t queueCommand(CommandType type);
+bool getCommandInfo(uint32_t id, CommandInfo &info);
+// called on the executor task when a command is done, skipped or failed, must not block
+void setCommandFinishedListener(void (*listener)(uint32_t id));
+const char *commandTypeName(CommandType type);
+const char *commandStatusName(CommandStatus status);
+
+#endif
@@ -0,0 +1,196 @@
+#include <ArduinoJson.h>
+#include "config_store.h"
+#include "hal.h"
+#include "logger.h"
+
+static const char *mowingPlanPath = "/mowing_plan.json";
+static const char *apNamePath = "/ap.txt";
+
+static MowingPlan storedMowingPlan;
+static bool mowingPlanStored = false;
+static String mowingPlanJson;
+static String storedApName;
+
+// the boot id keeps ETags of an earlier boot from matching, the generation restarts at 1
+static uint32_t configBootId = 0;
+static uint32_t configGeneration = 1;
+
+// tells whether the content of a settings file was written completely
+typedef bool (*ConfigFileCheck)(const String &content);
+
+static String getTempPath(const char *path) {
+  return String(path) + ".tmp";
+}
+
+static String readFileContent(const String &path) {
+  File file = halFileSystem().open(path, "r");
+  if(!file) {
+    return String();
+  }
+  String content = file.readString();
+  file.close();
+  return content;
+}
+
+// finishes or drops a store that was cut by a reset
+static void recoverConfigFile(const char *path, ConfigFileCheck isComplete) {
+  String tempPath = getTempPath(path);
+  if(!halFileSystem().exists(tempPath)) {
+    return;
+  }
+
+  if(halFileSystem().exists(path)) {
+    // cut before the rename, the old file is still complete
+    halFileSystem().remove(tempPath);
+  } else if(isComplete(readFileContent(tempPath))) {
+    // cut after the old file was removed
+    LOG_INFO("Recovering %s from an interrupted write", path);
+    halFileSystem().rename(tempPath, path);
+  } else {
+    // cut while the first version was written
+    LOG_ERROR("Dropping %s, its write was interrupted", tempPath.c_str());
+    halFileSystem().remove(tempPath);
+  }
+}
+
+static bool readConfigFile(const char *path, ConfigFileCheck isComplete, String &content) {
+  recoverConfigFile(path, isComplete);
+  // littlefs logs an error for opening a missing file
+  if(!halFileSystem().exists(path)) {
+    return false;
+  }
+  File file = halFileSystem().open(path, "r");
+  if(!file) {
+    return false;
+  }
+  content = file.readString();
+  file.close();
+  return true;
+}
+
+static bool writeConfigFile(const char *path, const String &content) {
+  String tempPath = getTempPath(path);
+  File file = halFileSystem().open(tempPath, "w");
+  if(!file) {
+    LOG_ERROR("Failed to open file for writing: %s", tempPath.c_str());
+    return false;
+  }
+  size_t written = file.print(content);
+  file.close();
+
+  if(written != content.length()) {
+    LOG_ERROR("Failed to write to file: %s", tempPath.c_str());
+    halFileSystem().remove(tempPath);
+    return false;
+  }
+
+  // spiffs does not rename onto an existing file, recoverConfigFile() covers the gap
+  if(!halFileSystem().rename(tempPath, path)) {
+    halFileSystem().remove(path);
+    if(!halFileSystem().rename(tempPath, path)) {
+      LOG_ERROR("Failed to replace file: %s", path);
+      return false;
+    }
+  }
+
+  configGeneration++;
+  return true;
+}
+
+// a cut JSON document doesn't parse
+static bool isCompleteMowingPlan(const String &content) {
+  MowingPlan plan;
+  DynamicJsonDocument doc(mowingPlanJsonCapacity);
+  return !deserializeJson(doc, content) && readMowingPlanJson(doc.as<JsonObjectConst>(), plan);
+}
+
+// storeApName() ends the name with a newline
+static bool isCompleteApName(const String &content) {
+  return content.length() > 1 && content.endsWith("\n");
+}
+
+static String formatMowingPlanJson(const MowingPlan &plan) {
+  DynamicJsonDocument doc(mowingPlanJsonCapacity);
+  writeMowingPlanJson(plan, doc.to<JsonObject>());
+  String json;
+  serializeJson(doc, json);
+  return json;
+}
+
+static void loadMowingPlanConfig() {
+  mowingPlanStored = false;
+  String content;
+  if(!readConfigFile(mowingPlanPath, isCompleteMowingPlan, content)) {
+    LOG_INFO("No mowing plan saved, using default settings");
+    return;
+  }
+  LOG_DEBUG("Mowing Plan: %s", content.c_str());
+
+  MowingPlan plan;
+  DynamicJsonDocument doc(mowingPlanJsonCapacity);
+  DeserializationError error = deserializeJson(doc, content);
+  if(error || !readMowingPlanJson(doc.as<JsonObjectConst>(), plan)) {
+    LOG_ERROR("Failed to read file %s, using default settings", mowingPlanPath);
+    return;
+  }
+
+  storedMowingPlan = plan;
+  // served in the current format, also if the file is from an older version
+  mowingPlanJson = formatMowingPlanJson(plan);
+  mowingPlanStored = true;
+}
+
+static void loadApNameConfig() {
+  String content;
+  if(readConfigFile(apNamePath, isCompleteApName, content)) {
+    content.trim();
+  }
+  storedApName = content;
+}
+
+void initializeConfigStore() {
+  configBootId = (uint32_t)random(0x7fffffff);
+  loadMowingPlanConfig();
+  loadApNameConfig();
+}
+
+bool hasStoredMowingPlan() {
+  return mowingPlanStored;
+}
+
+const MowingPlan &getStoredMowingPlan() {
+  return storedMowingPlan;
+}
+
+const String &getMowingPlanJson() {
+  return mowingPlanJson;
+}
+
+bool storeMowingPlan(const MowingPlan &plan) {
+  String json = formatMowingPlanJson(plan);
+  if(!writeConfigFile(mowingPlanPath, json)) {
+    return false;
+  }
+  storedMowingPlan = plan;
+  mowingPlanJson = json;
+  mowingPlanStored = true;
+  return true;
+}
+
+const String &getStoredApName() {
+  return storedApName;
+}
+
+bool storeApName(const String &name) {
+  if(!writeConfigFile(apNamePath, name + "\n")) {
+    return false;
+  }
+  storedApName = name;
+  return true;
+}
+
+String getConfigETag() {
+  char etag[24];
+  snprintf(etag, sizeof(etag), "\"%08x-%u\"", (unsigned int)configBootId, (unsigned int)configGeneration);
+  return String(etag);
+}
@@ -0,0 +1,29 @@
+#ifndef CONFIG_STORE_H
+#define CONFIG_STORE_H
+
+#include <Arduino.h>
+#include "mower.h"
+
+// Settings files, loaded once at boot and kept in RAM, so reads cost no flash access.
+// A store writes a temp file and renames it over the old one, a power cut leaves
+// either the old or the new file.
+// Stores happen on the web server task, reads on the web server and the loop task.
+// The Wifi credentials have their own store, see wifi_credentials.h.
+
+void initializeConfigStore();
+
+// false until a plan was saved, the default plan is used then
+bool hasStoredMowingPlan();
+const MowingPlan &getStoredMowingPlan();
+// the stored plan as served by GET /mowing-plan
+const String &getMowingPlanJson();
+bool storeMowingPlan(const MowingPlan &plan);
+
+// empty if none was generated yet
+const String &getStoredApName();
+bool storeApName(const String &name);
+
+// quoted ETag, changes with every store and every boot
+String getConfigETag();
+
+#endif
@@ -1,7 +1,8 @@
-#include <Arduino.h>
+#include "hal.h"
 #include "logger.h"
+#include "datetime_utils.h"
 
 void syncNTPTime() {
-  logMessage("Syncing NTP time", 2);
-  configTime(0, 0, "pool.ntp.org", "time.nist.gov");
+  LOG_DEBUG("Syncing NTP time");
+  halStartTimeSync("pool.ntp.org", "time.nist.gov");
 }
\ No newline at end of file
@@ -1,24 +1,24 @@
 #include "file_utils.h"
 
-bool initializeSPIFFS() {
-  if (!SPIFFS.begin(true)) {
+bool initializeFileSystem() {
+  if (!halBeginFileSystem()) {
     Serial.println("Failed to mount file system");
     return false;
   }
   return true;
 }
 
-void showUsageOfSPIFFSFileSystem() {
-  size_t totalBytes = SPIFFS.totalBytes();
-  size_t usedBytes = SPIFFS.usedBytes();
+void showFileSystemUsage() {
+  size_t totalBytes = halFileSystemTotalBytes();
+  size_t usedBytes = halFileSystemUsedBytes();
 
-  logMessage("SPIFFS total: " + String(totalBytes) + " Bytes", 2);
-  logMessage("SPIFFS used: " + String(usedBytes) + " Bytes", 2);
-  logMessage("SPIFFS free: " + String(totalBytes - usedBytes) + " Bytes", 2);
+  LOG_DEBUG("%s total: %u Bytes", halFileSystemName(), (unsigned int)totalBytes);
+  LOG_DEBUG("%s used: %u Bytes", halFileSystemName(), (unsigned int)usedBytes);
+  LOG_DEBUG("%s free: %u Bytes", halFileSystemName(), (unsigned int)(totalBytes - usedBytes));
 }
 
-void listSPIFFSFiles() {
-  File root = SPIFFS.open("/");
+void listFiles() {
+  File root = halFileSystem().open("/");
   if (!root) {
     Serial.println("Failed to open root directory");
     return;
@@ -1,9 +1,9 @@
 #ifndef FILE_UTILS_H
 #define FILE_UTILS_H
-#include <SPIFFS.h>
+#include "hal.h"
 #include "logger.h"
 
-bool initializeSPIFFS();
-void showUsageOfSPIFFSFileSystem();
-void listSPIFFSFiles();
+bool initializeFileSystem();
+void showFileSystemUsage();
+void listFiles();
 #endif
\ No newline at end of file
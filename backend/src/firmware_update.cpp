@@ -0,0 +1,171 @@
+#include <atomic>
+#include <mutex>
+#include <Update.h>
+#include <mbedtls/sha256.h>
+#include "firmware_update.h"
+#include "logger.h"
+
+static std::mutex progressLock;
+static UpdateProgress progress = {"firmware", UPDATE_IDLE, UPDATE_ENCODING_RAW, 0, 0, 0, NULL, 0};
+static std::atomic<void (*)()> progressListener(nullptr);
+
+// the upload callbacks run one after the other on the async_tcp task
+static UpdateDecoder decoder;
+static mbedtls_sha256_context digestContext;
+static uint8_t expectedDigest[32];
+static bool checkDigest = false;
+static bool updateActive = false;
+static bool requestFailed = false;
+static uint32_t reportedAt = 0;
+
+static void notifyProgress() {
+  void (*listener)() = progressListener.load(std::memory_order_acquire);
+  if(listener) {
+    listener();
+  }
+}
+
+static void setProgress(UpdateStatus status, uint32_t received, const char *error) {
+  {
+    std::lock_guard<std::mutex> lock(progressLock);
+    progress.status = status;
+    progress.received = received;
+    progress.written = decoder.outputLength;
+    progress.error = error;
+    progress.version++;
+  }
+  notifyProgress();
+}
+
+static bool parseDigest(const String &hex, uint8_t *digest) {
+  if(hex.length() != 64) {
+    return false;
+  }
+  for(int i = 0; i < 32; i++) {
+    char byteHex[3] = {hex[2 * i], hex[2 * i + 1], 0};
+    char *end;
+    digest[i] = strtoul(byteHex, &end, 16);
+    if(*end != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// decoded data on its way to the flash
+static bool writeDecoded(const uint8_t *data, size_t length, void *context) {
+  mbedtls_sha256_update(&digestContext, data, length);
+  return Update.write((uint8_t *)data, length) == length;
+}
+
+static bool failUpdate(const char *error) {
+  LOG_ERROR("%s-Update failed: %s", progress.target, error);
+  if(updateActive) {
+    Update.abort();
+    endUpdateDecoder(decoder);
+    mbedtls_sha256_free(&digestContext);
+    updateActive = false;
+  }
+  requestFailed = true;
+  setProgress(UPDATE_FAILED, progress.received, error);
+  return false;
+}
+
+bool beginFirmwareUpdate(const String &filename, const String &sha256, size_t total) {
+  if(updateActive) {
+    // the previous upload never finished
+    failUpdate("upload interrupted");
+  }
+
+  bool firmware = filename.startsWith("firmware.bin");
+  UpdateEncoding encoding = getUpdateEncoding(filename.c_str());
+  {
+    std::lock_guard<std::mutex> lock(progressLock);
+    progress.target = firmware ? "firmware" : "filesystem";
+    progress.encoding = encoding;
+    progress.total = total;
+  }
+  reportedAt = 0;
+  LOG_INFO("%s-Update Start: %s (%s)", progress.target, filename.c_str(), updateEncodingName(encoding));
+
+  checkDigest = sha256.length() > 0;
+  if(checkDigest && !parseDigest(sha256, expectedDigest)) {
+    return failUpdate("invalid sha256");
+  }
+  if(!beginUpdateDecoder(decoder, encoding, writeDecoded, NULL)) {
+    return failUpdate(decoder.error);
+  }
+  if(!Update.begin(UPDATE_SIZE_UNKNOWN, firmware ? U_FLASH : U_SPIFFS)) {
+    endUpdateDecoder(decoder);
+    return failUpdate(Update.errorString());
+  }
+  mbedtls_sha256_init(&digestContext);
+  mbedtls_sha256_starts(&digestContext, 0);
+  updateActive = true;
+  setProgress(UPDATE_WRITING, 0, NULL);
+  return true;
+}
+
+bool writeFirmwareUpdate(const uint8_t *data, size_t length) {
+  if(!updateActive) {
+    return false;
+  }
+  if(!writeUpdateDecoder(decoder, data, length)) {
+    return failUpdate(Update.hasError() ? Update.errorString() : decoder.error);
+  }
+
+  uint32_t received = progress.received + length;
+  if(received - reportedAt >= updateProgressStep) {
+    reportedAt = received;
+    setProgress(UPDATE_WRITING, received, NULL);
+  } else {
+    std::lock_guard<std::mutex> lock(progressLock);
+    progress.received = received;
+  }
+  return true;
+}
+
+bool endFirmwareUpdate() {
+  if(!updateActive) {
+    return false;
+  }
+  if(!finishUpdateDecoder(decoder)) {
+    return failUpdate(Update.hasError() ? Update.errorString() : decoder.error);
+  }
+
+  // before Update.end(), which makes the new image the one that boots
+  uint8_t digest[32];
+  mbedtls_sha256_finish(&digestContext, digest);
+  if(checkDigest && memcmp(digest, expectedDigest, sizeof(digest)) != 0) {
+    return failUpdate("sha256 mismatch");
+  }
+  if(!Update.end(true)) {
+    return failUpdate(Update.errorString());
+  }
+
+  endUpdateDecoder(decoder);
+  mbedtls_sha256_free(&digestContext);
+  updateActive = false;
+  LOG_INFO("%s-Update Success: %u bytes received, %u bytes written%s", progress.target,
+    progress.received, decoder.outputLength, checkDigest ? ", sha256 verified" : "");
+  setProgress(UPDATE_SUCCEEDED, progress.received, NULL);
+  return true;
+}
+
+bool takeFirmwareUpdateResult() {
+  if(updateActive) {
+    failUpdate("upload incomplete");
+  }
+  bool succeeded = !requestFailed;
+  requestFailed = false;
+  return succeeded;
+}
+
+UpdateProgress getUpdateProgress() {
+  std::lock_guard<std::mutex> lock(progressLock);
+  return progress;
+}
+
+void setUpdateProgressListener(void (*listener)()) {
+  progressListener.store(listener, std::memory_order_release);
+}
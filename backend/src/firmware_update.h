@@ -0,0 +1,48 @@
+#ifndef FIRMWARE_UPDATE_H
+#define FIRMWARE_UPDATE_H
+
+#include <Arduino.h>
+#include "update_decoder.h"
+
+// Writes an image uploaded to /update into the OTA or the data partition while it streams in.
+// firmware.bin and filesystem.bin may come compressed as .gz or .hs, see update_decoder.h.
+// With a SHA-256 of the uncompressed image the update is only used if the digest matches.
+
+enum UpdateStatus : uint8_t {
+  UPDATE_IDLE,
+  UPDATE_WRITING,
+  UPDATE_SUCCEEDED,
+  UPDATE_FAILED
+};
+
+struct UpdateProgress {
+  // "firmware" or "filesystem"
+  const char *target;
+  UpdateStatus status;
+  UpdateEncoding encoding;
+  // uploaded bytes of this file, of the whole request and decoded bytes written to flash
+  uint32_t received;
+  uint32_t total;
+  uint32_t written;
+  // why it failed, NULL otherwise
+  const char *error;
+  // incremented on every change
+  uint32_t version;
+};
+
+// the progress is reported every time this many bytes more are received
+const uint32_t updateProgressStep = 32768;
+
+// sha256 is the hex digest of the uncompressed image or empty, total the size of the request
+bool beginFirmwareUpdate(const String &filename, const String &sha256, size_t total);
+bool writeFirmwareUpdate(const uint8_t *data, size_t length);
+// checks the digest and activates the update, aborts it if anything is wrong
+bool endFirmwareUpdate();
+// true if no file of the request failed, starts the next request over
+bool takeFirmwareUpdateResult();
+
+UpdateProgress getUpdateProgress();
+// called on the web server task after every change of the progress, must not block
+void setUpdateProgressListener(void (*listener)());
+
+#endif
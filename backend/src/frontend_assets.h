@@ -0,0 +1,28 @@
+#ifndef FRONTEND_ASSETS_H
+#define FRONTEND_ASSETS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The files of data/frontend, embedded into the firmware by tools/embed_frontend.py,
+// which generates frontend_assets.cpp before each build.
+// The data stays in the memory mapped flash and is sent from there.
+
+struct FrontendAsset {
+  // url without .gz, e.g. "/js/bundle.js"
+  const char *path;
+  const char *contentType;
+  const uint8_t *data;
+  size_t length;
+  // data is gzip compressed, sent with Content-Encoding: gzip
+  bool gzipped;
+  // content hash, index.html refers to the other files with ?v=<hash>
+  const char *hash;
+  // the quoted hash
+  const char *etag;
+};
+
+extern const FrontendAsset frontendAssets[];
+extern const size_t frontendAssetCount;
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef HAL_H
+#define HAL_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <time.h>
+
+// Hardware abstraction layer.
+// hal_esp32.cpp implements it for the mower board, native/hal_native.cpp
+// for the Linux build with a simulated mower. Application code should
+// only talk to pins, clock, filesystem and network through these functions.
+
+// gpio
+void halPinMode(int pin, int mode);
+int halDigitalRead(int pin);
+void halDigitalWrite(int pin, int value);
+
+// clock
+unsigned long halMillis();
+unsigned long halMicros();
+void halDelay(unsigned long ms);
+// sleeps until lastWakeTime + intervalMs and moves lastWakeTime forward
+void halDelayUntil(unsigned long &lastWakeTime, unsigned long intervalMs);
+// never blocks, returns false while the time is not set
+bool halGetLocalTime(struct tm *timeinfo);
+void halStartTimeSync(const char *server1, const char *server2);
+
+// tasks
+void halStartTask(void (*task)(void *), const char *name, uint32_t stackSize, unsigned int priority, void *parameter = NULL);
+
+// filesystem, see storage.h
+bool halBeginFileSystem();
+const char *halFileSystemName();
+fs::FS &halFileSystem();
+size_t halFileSystemTotalBytes();
+size_t halFileSystemUsedBytes();
+
+// network, the names are copied into buffer and cut to its size, without allocating
+bool halNetworkConnected();
+void halNetworkHostname(char *buffer, size_t size);
+void halNetworkSSID(char *buffer, size_t size);
+void halNetworkIP(bool accessPoint, char *buffer, size_t size);
+
+#endif
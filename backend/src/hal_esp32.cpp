@@ -0,0 +1,124 @@
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include <LittleFS.h>
+#include <WiFi.h>
+#include <esp_wifi.h>
+#include "hal.h"
+#include "storage.h"
+
+void halPinMode(int pin, int mode) {
+  pinMode(pin, mode);
+}
+
+int halDigitalRead(int pin) {
+  return digitalRead(pin);
+}
+
+void halDigitalWrite(int pin, int value) {
+  digitalWrite(pin, value);
+}
+
+unsigned long halMillis() {
+  return millis();
+}
+
+unsigned long halMicros() {
+  return micros();
+}
+
+void halDelay(unsigned long ms) {
+  delay(ms);
+}
+
+void halDelayUntil(unsigned long &lastWakeTime, unsigned long intervalMs) {
+  lastWakeTime += intervalMs;
+  long remaining = (long)(lastWakeTime - millis());
+  if(remaining > 0) {
+    delay(remaining);
+  }
+}
+
+bool halGetLocalTime(struct tm *timeinfo) {
+  // getLocalTime() waits up to 5 seconds for a valid time by default
+  return getLocalTime(timeinfo, 0);
+}
+
+void halStartTimeSync(const char *server1, const char *server2) {
+  configTime(0, 0, server1, server2);
+}
+
+void halStartTask(void (*task)(void *), const char *name, uint32_t stackSize, unsigned int priority, void *parameter) {
+  // core 1, next to the arduino loop, core 0 belongs to wifi and AsyncTCP
+  xTaskCreatePinnedToCore(task, name, stackSize, parameter, priority, NULL, 1);
+}
+
+// both use the "spiffs" partition, the other one is migrated on the first boot
+static const StorageBackend spiffsStorage = {
+  "SPIFFS",
+  [](bool format) { return SPIFFS.begin(format); },
+  []() { SPIFFS.end(); },
+  []() -> fs::FS & { return SPIFFS; },
+  []() { return SPIFFS.totalBytes(); },
+  []() { return SPIFFS.usedBytes(); }
+};
+
+static const StorageBackend littleFsStorage = {
+  "LittleFS",
+  [](bool format) { return LittleFS.begin(format); },
+  []() { LittleFS.end(); },
+  []() -> fs::FS & { return LittleFS; },
+  []() { return LittleFS.totalBytes(); },
+  []() { return LittleFS.usedBytes(); }
+};
+
+#ifdef STORAGE_SPIFFS
+static const StorageBackend &storage = spiffsStorage;
+static const StorageBackend &previousStorage = littleFsStorage;
+#else
+static const StorageBackend &storage = littleFsStorage;
+static const StorageBackend &previousStorage = spiffsStorage;
+#endif
+
+bool halBeginFileSystem() {
+  return mountStorage(storage, &previousStorage);
+}
+
+const char *halFileSystemName() {
+  return storage.name;
+}
+
+fs::FS &halFileSystem() {
+  return storage.fileSystem();
+}
+
+size_t halFileSystemTotalBytes() {
+  return storage.totalBytes();
+}
+
+size_t halFileSystemUsedBytes() {
+  return storage.usedBytes();
+}
+
+bool halNetworkConnected() {
+  return WiFi.status() == WL_CONNECTED;
+}
+
+void halNetworkHostname(char *buffer, size_t size) {
+  const char *hostname = WiFi.getHostname();
+  snprintf(buffer, size, "%s", hostname ? hostname : "");
+}
+
+void halNetworkSSID(char *buffer, size_t size) {
+  // like WiFi.SSID(), which returns a String
+  wifi_ap_record_t info;
+  if(WiFi.getMode() == WIFI_OFF || esp_wifi_sta_get_ap_info(&info) != ESP_OK) {
+    snprintf(buffer, size, "%s", "");
+    return;
+  }
+  snprintf(buffer, size, "%.*s", (int)strnlen((const char *)info.ssid, sizeof(info.ssid)), (const char *)info.ssid);
+}
+
+void halNetworkIP(bool accessPoint, char *buffer, size_t size) {
+  IPAddress ip = accessPoint ? WiFi.softAPIP() : WiFi.localIP();
+  snprintf(buffer, size, "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+}
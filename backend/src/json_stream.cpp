@@ -0,0 +1,190 @@
+#include <stdio.h>
+#include "json_stream.h"
+
+static void writeByte(JsonStream &stream, char c) {
+  if(stream.skip > 0) {
+    stream.skip--;
+  } else if(stream.length < stream.size) {
+    stream.window[stream.length++] = c;
+  } else {
+    stream.full = true;
+  }
+}
+
+static void writeText(JsonStream &stream, const char *text) {
+  while(*text && !stream.full) {
+    writeByte(stream, *text++);
+  }
+}
+
+// the comma before every member but the first, nothing between a key and its value
+static void beginValue(JsonStream &stream) {
+  if(stream.afterKey) {
+    stream.afterKey = false;
+    return;
+  }
+  if(stream.depth == 0) {
+    return;
+  }
+  uint32_t bit = 1u << (stream.depth - 1);
+  if(stream.members & bit) {
+    writeByte(stream, ',');
+  }
+  stream.members |= bit;
+}
+
+static void beginContainer(JsonStream &stream, char open) {
+  beginValue(stream);
+  writeByte(stream, open);
+  stream.depth++;
+  stream.members &= ~(1u << (stream.depth - 1));
+}
+
+static void endContainer(JsonStream &stream, char close) {
+  stream.depth--;
+  writeByte(stream, close);
+}
+
+size_t fillJsonWindow(uint8_t *window, size_t size, JsonStreamCursor &cursor, JsonPartWriter writePart, void *context) {
+  JsonStream stream;
+  stream.window = (char *)window;
+  stream.size = size;
+  stream.length = 0;
+  stream.full = false;
+  while(!stream.full) {
+    stream.skip = cursor.offset;
+    stream.members = 0;
+    stream.depth = 0;
+    stream.afterKey = false;
+    size_t partStart = stream.length;
+    if(!writePart(stream, cursor.part, context)) {
+      break;
+    }
+    if(stream.full) {
+      cursor.offset += stream.length - partStart;
+      break;
+    }
+    cursor.part++;
+    cursor.offset = 0;
+  }
+  return stream.length;
+}
+
+void jsonBeginObject(JsonStream &stream) {
+  beginContainer(stream, '{');
+}
+
+void jsonEndObject(JsonStream &stream) {
+  endContainer(stream, '}');
+}
+
+void jsonBeginArray(JsonStream &stream) {
+  beginContainer(stream, '[');
+}
+
+void jsonEndArray(JsonStream &stream) {
+  endContainer(stream, ']');
+}
+
+void jsonKey(JsonStream &stream, const char *name) {
+  jsonString(stream, name);
+  writeByte(stream, ':');
+  stream.afterKey = true;
+}
+
+void jsonString(JsonStream &stream, const char *value) {
+  static const char hexDigits[] = "0123456789abcdef";
+  beginValue(stream);
+  writeByte(stream, '"');
+  for(; *value && !stream.full; value++) {
+    uint8_t c = *value;
+    if(c == '"' || c == '\\') {
+      writeByte(stream, '\\');
+      writeByte(stream, c);
+    } else if(c < 0x20) {
+      writeText(stream, "\\u00");
+      writeByte(stream, hexDigits[c >> 4]);
+      writeByte(stream, hexDigits[c & 0xf]);
+    } else {
+      writeByte(stream, c);
+    }
+  }
+  writeByte(stream, '"');
+}
+
+void jsonInt(JsonStream &stream, int32_t value) {
+  char text[12];
+  snprintf(text, sizeof(text), "%ld", (long)value);
+  beginValue(stream);
+  writeText(stream, text);
+}
+
+void jsonUnsigned(JsonStream &stream, uint32_t value) {
+  char text[11];
+  snprintf(text, sizeof(text), "%lu", (unsigned long)value);
+  beginValue(stream);
+  writeText(stream, text);
+}
+
+void jsonBool(JsonStream &stream, bool value) {
+  beginValue(stream);
+  writeText(stream, value ? "true" : "false");
+}
+
+void jsonNull(JsonStream &stream) {
+  beginValue(stream);
+  writeText(stream, "null");
+}
+
+void jsonRaw(JsonStream &stream, const char *text) {
+  writeText(stream, text);
+}
+
+JsonResponseSlot *reserveJsonResponseSlot(JsonResponsePool &pool) {
+  int index = -1;
+  for(int i = 0; i < pool.count && index < 0; i++) {
+    if(!pool.slots[i].used) {
+      index = i;
+    }
+  }
+  if(index < 0) {
+    return NULL;
+  }
+
+  JsonResponseSlot &slot = pool.slots[index];
+  // tells the handlers of the response that had the slot before from the new ones
+  slot.generation++;
+  slot.used = true;
+  slot.cursor = {0, 0};
+  slot.writePart = pool.writePart;
+  slot.context = (uint8_t *)pool.contexts + index * pool.contextSize;
+  return &slot;
+}
+
+std::function<size_t(uint8_t *, size_t, size_t)> startJsonResponse(JsonResponseSlot &slot) {
+  JsonResponseSlot *slotPointer = &slot;
+  uint32_t generation = slot.generation;
+  return [slotPointer, generation](uint8_t *window, size_t size, size_t index) -> size_t {
+    if(slotPointer->generation != generation || !slotPointer->used) {
+      return 0;
+    }
+    if(size == 0) {
+      return jsonResponseTryAgain;
+    }
+    size_t length = fillJsonWindow(window, size, slotPointer->cursor, slotPointer->writePart, slotPointer->context);
+    if(length == 0) {
+      slotPointer->used = false;
+    }
+    return length;
+  };
+}
+
+std::function<void()> releaseJsonResponse(JsonResponseSlot &slot) {
+  JsonResponseSlot *slotPointer = &slot;
+  uint32_t generation = slot.generation;
+  return [slotPointer, generation]() {
+    if(slotPointer->generation == generation) {
+      slotPointer->used = false;
+    }
+  };
+}
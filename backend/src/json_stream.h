@@ -0,0 +1,93 @@
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+
+// Writes json straight into the fixed window a chunked response hands over on every call,
+// without building the document first. A response is a sequence of parts, e.g. the opening
+// bracket, one part per array element and the closing bracket. A part cut at the end of a
+// window is written again into the next one, its bytes already sent are skipped. So a part
+// has to come out the same again, a response keeps the data of its cut part and its cursor,
+// the RAM per response does not grow with the payload.
+
+struct JsonStream {
+  char *window;
+  size_t size;
+  size_t length;
+  // bytes of the current part sent with an earlier window
+  size_t skip;
+  // a byte did not fit, the part is cut
+  bool full;
+  // one bit per open object or array, set once it has a member
+  uint32_t members;
+  uint8_t depth;
+  bool afterKey;
+};
+
+struct JsonStreamCursor {
+  int part;
+  // bytes of the part already sent
+  size_t offset;
+};
+
+// writes part number part, returns false without writing if there is no such part
+typedef bool (*JsonPartWriter)(JsonStream &stream, int part, void *context);
+
+// fills the window with the parts behind the cursor and moves it, returns the bytes written,
+// 0 once all parts were sent
+size_t fillJsonWindow(uint8_t *window, size_t size, JsonStreamCursor &cursor, JsonPartWriter writePart, void *context);
+
+// at most 32 levels of objects and arrays within a part
+void jsonBeginObject(JsonStream &stream);
+void jsonEndObject(JsonStream &stream);
+void jsonBeginArray(JsonStream &stream);
+void jsonEndArray(JsonStream &stream);
+void jsonKey(JsonStream &stream, const char *name);
+void jsonString(JsonStream &stream, const char *value);
+void jsonInt(JsonStream &stream, int32_t value);
+void jsonUnsigned(JsonStream &stream, uint32_t value);
+void jsonBool(JsonStream &stream, bool value);
+void jsonNull(JsonStream &stream);
+// as it is, e.g. the separator between two parts
+void jsonRaw(JsonStream &stream, const char *text);
+
+// The data and cursor of a streamed response are kept in a fixed pool of slots, the filler
+// of the chunked response only captures its slot and the slot's generation. A capture of two
+// words is kept inside the std::function, so the filler allocates nothing. A slot is free
+// again once its body was sent or its request was dropped, a request finding all slots used
+// gets a 503. Use a pool on the web server task only.
+
+struct JsonResponseSlot {
+  JsonStreamCursor cursor;
+  JsonPartWriter writePart;
+  // the data the parts are written from, one per slot
+  void *context;
+  uint32_t generation;
+  bool used;
+};
+
+struct JsonResponsePool {
+  JsonResponseSlot *slots;
+  int count;
+  JsonPartWriter writePart;
+  // count contexts of contextSize bytes
+  void *contexts;
+  size_t contextSize;
+};
+
+// RESPONSE_TRY_AGAIN of ESPAsyncWebServer, returned while the send buffer is full
+const size_t jsonResponseTryAgain = 0xFFFFFFFF;
+
+// a slot with its cursor at the start, write the data into its context, NULL if all slots are
+// used. Only reserve one for a request that gets the body, a 304 is decided before from the
+// version of the data.
+JsonResponseSlot *reserveJsonResponseSlot(JsonResponsePool &pool);
+// the filler for beginChunkedResponse(), frees the slot after the body
+std::function<size_t(uint8_t *, size_t, size_t)> startJsonResponse(JsonResponseSlot &slot);
+// the handler for request->onDisconnect(), frees the slot of a response that did not get to
+// its end, a slot reserved again in the meantime is left alone
+std::function<void()> releaseJsonResponse(JsonResponseSlot &slot);
+
+#endif
@@ -0,0 +1,416 @@
+#include <stdio.h>
+#include <string.h>
+#include "log_codec.h"
+
+struct FormatConversion {
+  size_t length;
+  char type;
+  // 0 none, 'h', 'H' (hh), 'l', 'q' (ll), 'z', 'j', 't', 'L'
+  char size;
+  bool widthArgument;
+  bool precisionArgument;
+};
+
+// parses the conversion starting with the '%' at text, false for "%%" and unknown ones
+static bool parseConversion(const char *text, FormatConversion &conversion) {
+  size_t i = 1;
+  conversion.size = 0;
+  conversion.widthArgument = false;
+  conversion.precisionArgument = false;
+
+  while(text[i] && strchr("-+ #0", text[i])) {
+    i++;
+  }
+  if(text[i] == '*') {
+    conversion.widthArgument = true;
+    i++;
+  }
+  while(text[i] >= '0' && text[i] <= '9') {
+    i++;
+  }
+  if(text[i] == '.') {
+    i++;
+    if(text[i] == '*') {
+      conversion.precisionArgument = true;
+      i++;
+    }
+    while(text[i] >= '0' && text[i] <= '9') {
+      i++;
+    }
+  }
+
+  if(text[i] == 'h') {
+    conversion.size = text[i + 1] == 'h' ? 'H' : 'h';
+    i += conversion.size == 'H' ? 2 : 1;
+  } else if(text[i] == 'l') {
+    conversion.size = text[i + 1] == 'l' ? 'q' : 'l';
+    i += conversion.size == 'q' ? 2 : 1;
+  } else if(text[i] == 'z' || text[i] == 'j' || text[i] == 't') {
+    conversion.size = text[i];
+    i++;
+  } else if(text[i] == 'L') {
+    conversion.size = 'L';
+    i++;
+  }
+
+  if(!text[i] || !strchr("diouxXcsfFeEgGaAp", text[i])) {
+    return false;
+  }
+  conversion.type = text[i];
+  conversion.length = i + 1;
+  return true;
+}
+
+static bool isSignedConversion(char type) {
+  return type == 'd' || type == 'i';
+}
+
+static bool isFloatConversion(char type) {
+  return strchr("fFeEgGaA", type) != NULL;
+}
+
+size_t writeVarint(uint8_t *buffer, uint64_t value) {
+  size_t length = 0;
+  while(value >= 0x80) {
+    buffer[length++] = (uint8_t)(value | 0x80);
+    value >>= 7;
+  }
+  buffer[length++] = (uint8_t)value;
+  return length;
+}
+
+bool readVarint(const uint8_t *&position, const uint8_t *end, uint64_t &value) {
+  value = 0;
+  for(int shift = 0; shift < 64; shift += 7) {
+    if(position >= end) {
+      return false;
+    }
+    uint8_t byte = *position++;
+    value |= (uint64_t)(byte & 0x7f) << shift;
+    if(!(byte & 0x80)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static uint64_t zigzag(int64_t value) {
+  return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static int64_t unzigzag(uint64_t value) {
+  return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+static bool packVarint(uint8_t *buffer, size_t size, size_t &used, uint64_t value) {
+  uint8_t encoded[10];
+  size_t length = writeVarint(encoded, value);
+  if(used + length > size) {
+    return false;
+  }
+  memcpy(buffer + used, encoded, length);
+  used += length;
+  return true;
+}
+
+size_t packLogArguments(const char *format, va_list arguments, uint8_t *buffer, size_t size) {
+  size_t used = 0;
+  for(const char *position = format; *position; position++) {
+    if(*position != '%') {
+      continue;
+    }
+    if(position[1] == '%') {
+      position++;
+      continue;
+    }
+    FormatConversion conversion;
+    if(!parseConversion(position, conversion)) {
+      break;
+    }
+    position += conversion.length - 1;
+
+    if(conversion.widthArgument && !packVarint(buffer, size, used, zigzag(va_arg(arguments, int)))) {
+      break;
+    }
+    if(conversion.precisionArgument && !packVarint(buffer, size, used, zigzag(va_arg(arguments, int)))) {
+      break;
+    }
+
+    bool packed = true;
+    if(conversion.type == 's') {
+      const char *text = va_arg(arguments, const char *);
+      if(!text) {
+        text = "(null)";
+      }
+      uint8_t encodedLength[10];
+      size_t length = strlen(text);
+      // cut long strings to what is left
+      while(length > 0 && used + writeVarint(encodedLength, length) + length > size) {
+        length--;
+      }
+      packed = packVarint(buffer, size, used, length);
+      if(packed) {
+        memcpy(buffer + used, text, length);
+        used += length;
+      }
+    } else if(isFloatConversion(conversion.type)) {
+      double value = conversion.size == 'L' ? (double)va_arg(arguments, long double) : va_arg(arguments, double);
+      packed = used + sizeof(value) <= size;
+      if(packed) {
+        memcpy(buffer + used, &value, sizeof(value));
+        used += sizeof(value);
+      }
+    } else if(conversion.type == 'p') {
+      packed = packVarint(buffer, size, used, (uintptr_t)va_arg(arguments, void *));
+    } else if(isSignedConversion(conversion.type)) {
+      // intmax_t is 64 bits also where size_t is 32, hh and h print the converted value
+      int64_t value;
+      if(conversion.size == 'q') {
+        value = va_arg(arguments, long long);
+      } else if(conversion.size == 'l') {
+        value = va_arg(arguments, long);
+      } else if(conversion.size == 'z' || conversion.size == 't') {
+        value = va_arg(arguments, ptrdiff_t);
+      } else if(conversion.size == 'j') {
+        value = va_arg(arguments, intmax_t);
+      } else if(conversion.size == 'H') {
+        value = (signed char)va_arg(arguments, int);
+      } else if(conversion.size == 'h') {
+        value = (short)va_arg(arguments, int);
+      } else {
+        value = va_arg(arguments, int);
+      }
+      packed = packVarint(buffer, size, used, zigzag(value));
+    } else {
+      uint64_t value;
+      if(conversion.size == 'q') {
+        value = va_arg(arguments, unsigned long long);
+      } else if(conversion.size == 'l') {
+        value = va_arg(arguments, unsigned long);
+      } else if(conversion.size == 'z' || conversion.size == 't') {
+        value = va_arg(arguments, size_t);
+      } else if(conversion.size == 'j') {
+        value = va_arg(arguments, uintmax_t);
+      } else if(conversion.size == 'H') {
+        value = (unsigned char)va_arg(arguments, unsigned int);
+      } else if(conversion.size == 'h') {
+        value = (unsigned short)va_arg(arguments, unsigned int);
+      } else {
+        value = va_arg(arguments, unsigned int);
+      }
+      packed = packVarint(buffer, size, used, value);
+    }
+    if(!packed) {
+      break;
+    }
+  }
+  return used;
+}
+
+static void appendText(char *buffer, size_t size, size_t &length, const char *text, size_t textLength) {
+  if(length + 1 >= size) {
+    return;
+  }
+  if(textLength > size - 1 - length) {
+    textLength = size - 1 - length;
+  }
+  memcpy(buffer + length, text, textLength);
+  length += textLength;
+  buffer[length] = '\0';
+}
+
+size_t formatLogArguments(const char *format, const uint8_t *arguments, size_t argumentsLength, char *buffer, size_t size) {
+  const uint8_t *position = arguments;
+  const uint8_t *end = arguments + argumentsLength;
+  size_t length = 0;
+  if(size == 0) {
+    return 0;
+  }
+  buffer[0] = '\0';
+
+  const char *text = format;
+  while(*text) {
+    const char *percent = strchr(text, '%');
+    if(!percent) {
+      appendText(buffer, size, length, text, strlen(text));
+      break;
+    }
+    appendText(buffer, size, length, text, percent - text);
+
+    if(percent[1] == '%') {
+      appendText(buffer, size, length, "%", 1);
+      text = percent + 2;
+      continue;
+    }
+    FormatConversion conversion;
+    if(!parseConversion(percent, conversion)) {
+      appendText(buffer, size, length, percent, strlen(percent));
+      break;
+    }
+    text = percent + conversion.length;
+
+    // rebuild the conversion with the size we unpack to, '*' replaced by its value
+    char spec[40];
+    size_t specLength = 0;
+    bool complete = true;
+    for(size_t i = 0; i + 1 < conversion.length && specLength < sizeof(spec) - 16; i++) {
+      char c = percent[i];
+      if(c == '*') {
+        uint64_t value;
+        complete = complete && readVarint(position, end, value);
+        specLength += snprintf(spec + specLength, sizeof(spec) - specLength, "%d", complete ? (int)unzigzag(value) : 0);
+      } else if(!strchr("hlzjtL", c)) {
+        spec[specLength++] = c;
+      }
+    }
+
+    char value[200];
+    int valueLength = -1;
+    if(conversion.type == 's') {
+      uint64_t stringLength;
+      if(complete && readVarint(position, end, stringLength) && stringLength <= (uint64_t)(end - position)) {
+        size_t copied = stringLength < sizeof(value) ? stringLength : sizeof(value) - 1;
+        char string[200];
+        memcpy(string, position, copied);
+        string[copied] = '\0';
+        position += stringLength;
+        memcpy(spec + specLength, "s", 2);
+        valueLength = snprintf(value, sizeof(value), spec, string);
+      }
+    } else if(isFloatConversion(conversion.type)) {
+      double number;
+      if(complete && end - position >= (long)sizeof(number)) {
+        memcpy(&number, position, sizeof(number));
+        position += sizeof(number);
+        spec[specLength++] = conversion.type;
+        spec[specLength] = '\0';
+        valueLength = snprintf(value, sizeof(value), spec, number);
+      }
+    } else {
+      uint64_t number;
+      if(complete && readVarint(position, end, number)) {
+        if(conversion.type == 'p') {
+          // like printf, the width applies to the whole "0x..."
+          char pointer[24];
+          snprintf(pointer, sizeof(pointer), "0x%llx", (unsigned long long)number);
+          memcpy(spec + specLength, "s", 2);
+          valueLength = snprintf(value, sizeof(value), spec, pointer);
+        } else if(conversion.type == 'c') {
+          spec[specLength++] = 'c';
+          spec[specLength] = '\0';
+          valueLength = snprintf(value, sizeof(value), spec, (int)number);
+        } else {
+          spec[specLength++] = 'l';
+          spec[specLength++] = 'l';
+          spec[specLength++] = conversion.type;
+          spec[specLength] = '\0';
+          if(isSignedConversion(conversion.type)) {
+            valueLength = snprintf(value, sizeof(value), spec, (long long)unzigzag(number));
+          } else {
+            valueLength = snprintf(value, sizeof(value), spec, (unsigned long long)number);
+          }
+        }
+      }
+    }
+
+    if(valueLength < 0) {
+      // the arguments were cut when the record was written
+      appendText(buffer, size, length, "?", 1);
+    } else {
+      appendText(buffer, size, length, value, (size_t)valueLength < sizeof(value) ? valueLength : sizeof(value) - 1);
+    }
+  }
+  return length;
+}
+
+size_t encodeLogSync(uint8_t *buffer, uint32_t epochSeconds, uint32_t millis) {
+  uint8_t payload[10];
+  size_t payloadLength = writeVarint(payload, epochSeconds);
+  payloadLength += writeVarint(payload + payloadLength, millis);
+  return encodeLogRecord(buffer, 0, logSyncFormatId, 0, payload, payloadLength);
+}
+
+size_t encodeLogRecord(uint8_t *buffer, uint32_t deltaMillis, uint32_t formatId, uint8_t level, const uint8_t *arguments, size_t argumentsLength) {
+  size_t length = writeVarint(buffer, deltaMillis);
+  length += writeVarint(buffer + length, ((uint64_t)formatId << 2) | (level & 3));
+  length += writeVarint(buffer + length, argumentsLength);
+  memcpy(buffer + length, arguments, argumentsLength);
+  return length + argumentsLength;
+}
+
+uint32_t toLogEpochSeconds(const struct tm &timeinfo) {
+  // days since 1970-01-01 of a proleptic gregorian date
+  int year = timeinfo.tm_year + 1900;
+  int month = timeinfo.tm_mon + 1;
+  year -= month <= 2;
+  int era = (year >= 0 ? year : year - 399) / 400;
+  int yearOfEra = year - era * 400;
+  int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + timeinfo.tm_mday - 1;
+  int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  int64_t days = (int64_t)era * 146097 + dayOfEra - 719468;
+  return (uint32_t)(days * 86400 + timeinfo.tm_hour * 3600 + timeinfo.tm_min * 60 + timeinfo.tm_sec);
+}
+
+size_t formatLogTimePrefix(uint32_t epochSeconds, char *buffer, size_t size) {
+  if(epochSeconds == 0) {
+    return snprintf(buffer, size, "[Time unavailable] ");
+  }
+
+  time_t seconds = epochSeconds;
+  struct tm timeinfo;
+  gmtime_r(&seconds, &timeinfo);
+  size_t length = strftime(buffer, size, "[%a, %y/%m/%d %H:%M:%S] ", &timeinfo);
+  return length;
+}
+
+size_t formatLogRecordLine(const LogRecord &record, const char *format, char *buffer, size_t size) {
+  size_t length = formatLogTimePrefix(record.epochSeconds, buffer, size);
+  if(length >= size) {
+    return size - 1;
+  }
+  if(!format) {
+    int written = snprintf(buffer + length, size - length, "<unknown log format %u>", (unsigned int)record.formatId);
+    return (size_t)written < size - length ? length + written : size - 1;
+  }
+  return length + formatLogArguments(format, record.arguments, record.argumentsLength, buffer + length, size - length);
+}
+
+void resetLogDecoder(LogDecoder &decoder) {
+  decoder.millis = 0;
+  decoder.syncEpochSeconds = 0;
+  decoder.syncMillis = 0;
+}
+
+bool decodeLogRecord(LogDecoder &decoder, const uint8_t *&position, const uint8_t *end, LogRecord &record) {
+  const uint8_t *current = position;
+  uint64_t deltaMillis;
+  uint64_t header;
+  uint64_t argumentsLength;
+  if(!readVarint(current, end, deltaMillis) || !readVarint(current, end, header) || !readVarint(current, end, argumentsLength)
+      || argumentsLength > (uint64_t)(end - current)) {
+    return false;
+  }
+
+  record.formatId = (uint32_t)(header >> 2);
+  record.level = header & 3;
+  record.arguments = current;
+  record.argumentsLength = argumentsLength;
+  position = current + argumentsLength;
+
+  if(record.formatId == logSyncFormatId) {
+    uint64_t epochSeconds = 0;
+    uint64_t millis = 0;
+    const uint8_t *payload = record.arguments;
+    readVarint(payload, position, epochSeconds);
+    readVarint(payload, position, millis);
+    decoder.syncEpochSeconds = (uint32_t)epochSeconds;
+    decoder.syncMillis = (uint32_t)millis;
+    decoder.millis = (uint32_t)millis;
+  } else {
+    decoder.millis += (uint32_t)deltaMillis;
+  }
+
+  record.millis = decoder.millis;
+  record.epochSeconds = decoder.syncEpochSeconds ? decoder.syncEpochSeconds + (decoder.millis - decoder.syncMillis) / 1000 : 0;
+  return true;
+}
@@ -0,0 +1,63 @@
+#ifndef LOG_CODEC_H
+#define LOG_CODEC_H
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+// Binary log records, used by the logger with LOG_BINARY and by tools/logdecode.cpp.
+// Plain C++, so it builds on the host too.
+//
+// record: varint delta ms to the previous record | varint (format id << 2 | level)
+//         | varint length of the arguments | packed printf arguments
+// format id 0 is a time sync record, its arguments are varint epoch seconds (0 if the time
+// is not set) and varint millis, every segment starts with one so it can be decoded alone.
+// format ids index the format dictionary, one printf format per line, id 1 is the first line.
+//
+// packed arguments, in the order of the format: integers as varint (signed zigzag),
+// doubles as 8 raw bytes, strings as varint length and bytes
+
+const uint32_t logSyncFormatId = 0;
+const size_t maxLogRecordHeaderSize = 15;
+
+struct LogRecord {
+  uint32_t millis;
+  // local wall clock time in seconds since 1970, 0 while the time was not set
+  uint32_t epochSeconds;
+  uint8_t level;
+  uint32_t formatId;
+  const uint8_t *arguments;
+  size_t argumentsLength;
+};
+
+struct LogDecoder {
+  uint32_t millis;
+  uint32_t syncEpochSeconds;
+  uint32_t syncMillis;
+};
+
+size_t writeVarint(uint8_t *buffer, uint64_t value);
+bool readVarint(const uint8_t *&position, const uint8_t *end, uint64_t &value);
+
+// packs the arguments of format, returns the used bytes, strings are cut to fit into size
+size_t packLogArguments(const char *format, va_list arguments, uint8_t *buffer, size_t size);
+// renders format with packed arguments like snprintf, returns the length of the text
+size_t formatLogArguments(const char *format, const uint8_t *arguments, size_t argumentsLength, char *buffer, size_t size);
+
+// both return the bytes written to buffer, which needs maxLogRecordHeaderSize + argumentsLength
+size_t encodeLogSync(uint8_t *buffer, uint32_t epochSeconds, uint32_t millis);
+size_t encodeLogRecord(uint8_t *buffer, uint32_t deltaMillis, uint32_t formatId, uint8_t level, const uint8_t *arguments, size_t argumentsLength);
+
+// local time as seconds since 1970, without time zone, so the host shows the time of the mower
+uint32_t toLogEpochSeconds(const struct tm &timeinfo);
+// "[Sat, 24/10/17 12:00:00] " like the text log, "[Time unavailable] " for 0
+size_t formatLogTimePrefix(uint32_t epochSeconds, char *buffer, size_t size);
+// the record as a text log line, without newline
+size_t formatLogRecordLine(const LogRecord &record, const char *format, char *buffer, size_t size);
+
+void resetLogDecoder(LogDecoder &decoder);
+// decodes the record at position and moves position behind it, false if the record is incomplete
+bool decodeLogRecord(LogDecoder &decoder, const uint8_t *&position, const uint8_t *end, LogRecord &record);
+
+#endif
@@ -0,0 +1,119 @@
+#include <atomic>
+#include "hal.h"
+#include "log_formats.h"
+
+// formats are stored one after another, zero terminated, newlines replaced by spaces
+static char logFormats[maxLogFormatBytes];
+static uint16_t logFormatOffsets[maxLogFormats + 1];
+static uint16_t logFormatBytes = 0;
+// published after the format is in place, so readers need no lock
+static std::atomic<uint16_t> logFormatCount(0);
+
+// format pointers are string literals, so the pointer identifies the format on the hot path
+struct LogFormatCacheEntry {
+  const char *format;
+  uint16_t id;
+};
+
+static const int logFormatCacheSize = 128;
+static LogFormatCacheEntry logFormatCache[logFormatCacheSize];
+
+static int logFormatCacheSlot(const char *format) {
+  return ((uintptr_t)format >> 2) % logFormatCacheSize;
+}
+
+static bool sameLogFormat(const char *stored, const char *format) {
+  for(; *format; stored++, format++) {
+    char c = *format == '\n' ? ' ' : *format;
+    if(*stored != c) {
+      return false;
+    }
+  }
+  return *stored == '\0';
+}
+
+static bool addLogFormat(const char *format, size_t length) {
+  uint16_t count = logFormatCount.load(std::memory_order_relaxed);
+  if(count >= maxLogFormats || logFormatBytes + length + 1 > maxLogFormatBytes) {
+    return false;
+  }
+
+  logFormatOffsets[count] = logFormatBytes;
+  for(size_t i = 0; i < length; i++) {
+    logFormats[logFormatBytes++] = format[i] == '\n' ? ' ' : format[i];
+  }
+  logFormats[logFormatBytes++] = '\0';
+  logFormatCount.store(count + 1, std::memory_order_release);
+  return true;
+}
+
+void loadLogFormats() {
+  File file = halFileSystem().open(logFormatsPath, "r");
+  if(!file) {
+    return;
+  }
+
+  char line[maxLogFormatBytes / 4];
+  size_t length = 0;
+  while(file.available()) {
+    int c = file.read();
+    if(c == '\n') {
+      addLogFormat(line, length);
+      length = 0;
+    } else if(length < sizeof(line)) {
+      line[length++] = c;
+    }
+  }
+}
+
+void clearLogFormats() {
+  logFormatCount.store(0, std::memory_order_release);
+  logFormatBytes = 0;
+  memset(logFormatCache, 0, sizeof(logFormatCache));
+  halFileSystem().remove(logFormatsPath);
+}
+
+bool isLogFormatDictionaryCrowded() {
+  return logFormatCount.load(std::memory_order_relaxed) > maxLogFormats * 3 / 4 || logFormatBytes > maxLogFormatBytes * 3 / 4;
+}
+
+uint16_t findLogFormatId(const char *format) {
+  LogFormatCacheEntry &cached = logFormatCache[logFormatCacheSlot(format)];
+  if(cached.format == format) {
+    return cached.id;
+  }
+
+  uint16_t id = 0;
+  uint16_t count = logFormatCount.load(std::memory_order_relaxed);
+  for(uint16_t i = 0; i < count; i++) {
+    if(sameLogFormat(logFormats + logFormatOffsets[i], format)) {
+      id = i + 1;
+      break;
+    }
+  }
+
+  if(id == 0) {
+    size_t length = strlen(format);
+    if(!addLogFormat(format, length)) {
+      return 0;
+    }
+    id = count + 1;
+
+    File file = halFileSystem().open(logFormatsPath, "a");
+    if(file) {
+      file.write((const uint8_t *)(logFormats + logFormatOffsets[count]), length);
+      file.write((uint8_t)'\n');
+    }
+  }
+
+  cached.format = format;
+  cached.id = id;
+  return id;
+}
+
+const char *getLogFormat(uint16_t id) {
+  if(id == 0 || id > logFormatCount.load(std::memory_order_acquire)) {
+    return NULL;
+  }
+  return logFormats + logFormatOffsets[id - 1];
+}
@@ -0,0 +1,25 @@
+#ifndef LOG_FORMATS_H
+#define LOG_FORMATS_H
+
+#include <stdint.h>
+
+// Format dictionary of the binary log (LOG_BINARY).
+// Every printf format ever logged gets an id, persisted as one line per format
+// in /log-formats.txt, so records only store the id. Kept in RAM for decoding.
+
+const char logFormatsPath[] = "/log-formats.txt";
+const uint16_t maxLogFormats = 255;
+const uint16_t maxLogFormatBytes = 4096;
+
+void loadLogFormats();
+// drops the dictionary, only together with the binary log segments
+void clearLogFormats();
+// true if the dictionary got so full, that old formats should be dropped before it overflows
+bool isLogFormatDictionaryCrowded();
+// id of the format, added to the dictionary if it is new, 0 if the dictionary is full
+// only called by the log writer task
+uint16_t findLogFormatId(const char *format);
+// NULL for unknown ids, the pointer stays valid until clearLogFormats()
+const char *getLogFormat(uint16_t id);
+
+#endif
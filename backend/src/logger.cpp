@@ -1,78 +1,650 @@
-#include <Arduino.h>
-#include <FS.h>
-#include <SPIFFS.h>
+#include <atomic>
+#include <mutex>
+#include <stdarg.h>
+#include "hal.h"
 #include "logger.h"
+#include "metrics.h"
+#ifdef LOG_BINARY
+#include "log_codec.h"
+#include "log_formats.h"
+#endif
+
+// Log lines go into a lock free ring of fixed size slots (bounded multi producer queue,
+// every slot carries a sequence number telling whether it is free or filled).
+// Appending is a few atomic operations and a copy, the writer task drains the ring,
+// prints to Serial and writes to the log file in batches.
+//
+// The log file is split into segments /log-<n>.txt, only the last logSegmentCount are kept.
+// A segment is rolled before it would pass logSegmentSize, so a cursor
+// n * logSegmentSize + offset is a byte position that only ever grows.
+//
+// With LOG_BINARY the slots hold the packed printf arguments instead of the text,
+// and the segments /log-<n>.bin hold records as described in log_codec.h.
+// Serial and /log-messages still get text lines, decoded on the fly.
+
+#ifdef LOG_BINARY
+static const char logSegmentExtension[] = ".bin";
+#else
+static const char logSegmentExtension[] = ".txt";
+#endif
+
+struct LogEntry {
+  const char *format;
+  uint32_t millis;
+  uint8_t level;
+  uint8_t length;
+  // the text line, or the packed arguments with LOG_BINARY
+  char text[logSlotSize];
+};
+
+struct LogSlot {
+  std::atomic<uint32_t> sequence;
+  LogEntry entry;
+};
 
-// 0 = no debug (but errors), 1 = normal debug, 2 = more debug (verbose)
 File logFile;
-bool logResetInProgress = false;
-int debugLevel = 2;
 
-bool initializeLogger() {
-  /*
-  if (SPIFFS.exists("/log-messages.txt")) {
-    SPIFFS.remove("/log-messages.txt");
+static LogSlot logRing[logRingSlots];
+static std::atomic<uint32_t> logEnqueuePosition(0);
+static uint32_t logDequeuePosition = 0;
+static std::atomic<uint32_t> droppedLogMessages(0);
+static std::atomic<uint32_t> droppedLogMessagesTotal(0);
+static std::atomic<bool> logFlushRequested(false);
+static bool logWriterStarted = false;
+
+static std::mutex logSegmentLock;
+static uint32_t oldestLogSegment = 0;
+static uint32_t currentLogSegment = 0;
+// bytes of the current segment, written and still batched
+static uint32_t logSegmentBytes = 0;
+
+// room for one more line or record after logFlushBytes
+static const size_t logRecordOverhead = 32;
+static char logBatch[logFlushBytes + logSlotSize + logRecordOverhead];
+static size_t logBatchLength = 0;
+static unsigned long logBatchStartedAt = 0;
+
+#ifdef LOG_BINARY
+// time base of the current segment, a segment starts with a sync record
+static bool logSegmentSynced = false;
+static uint32_t logSyncEpochSeconds = 0;
+static uint32_t logSyncMillis = 0;
+static uint32_t logLastMillis = 0;
+#endif
+
+static void countDroppedLogMessage() {
+  // saturate instead of wrapping around
+  uint32_t dropped = droppedLogMessages.load(std::memory_order_relaxed);
+  while(dropped < UINT32_MAX && !droppedLogMessages.compare_exchange_weak(dropped, dropped + 1, std::memory_order_relaxed)) {
   }
-  */
+  droppedLogMessagesTotal.fetch_add(1, std::memory_order_relaxed);
+}
 
-  logFile = SPIFFS.open("/log-messages.txt", "a");
-  if (logFile) {
-    logMessage("Initialized Log.", 2);
-    return true;
-  } else {
-    Serial.println("Failed to create log file");
-    return false;
+#ifndef LOG_BINARY
+static size_t formatLogTime(char *buffer, size_t size) {
+  struct tm timeinfo;
+  if (!halGetLocalTime(&timeinfo)) {
+    return snprintf(buffer, size, "[Time unavailable] ");
   }
+  size_t length = strftime(buffer + 1, size - 1, "%a, %y/%m/%d %H:%M:%S", &timeinfo);
+  buffer[0] = '[';
+  length = length + 1;
+  length += snprintf(buffer + length, size - length, "] ");
+  return length;
 }
+#endif
 
-void logMessage(String text, int debugLevelOfMessage) {
-  if(debugLevelOfMessage > debugLevel) {
-    return;
+static void fillLogEntry(LogEntry &entry, int level, const char *format, va_list arguments) {
+  entry.format = format;
+  entry.millis = halMillis();
+  entry.level = level;
+#ifdef LOG_BINARY
+  entry.length = packLogArguments(format, arguments, (uint8_t *)entry.text, sizeof(entry.text));
+#else
+  size_t length = formatLogTime(entry.text, sizeof(entry.text));
+  // longer lines are cut at the slot size
+  vsnprintf(entry.text + length, sizeof(entry.text) - length, format, arguments);
+#endif
+}
+
+// constant time, never blocks, drops the line if the ring is full
+static void appendLogLine(int level, const char *format, va_list arguments) {
+  uint32_t position = logEnqueuePosition.load(std::memory_order_relaxed);
+  LogSlot *slot;
+  for(;;) {
+    slot = &logRing[position % logRingSlots];
+    uint32_t sequence = slot->sequence.load(std::memory_order_acquire);
+    int32_t difference = (int32_t)(sequence - position);
+    if(difference == 0) {
+      if(logEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if(difference < 0) {
+      countDroppedLogMessage();
+      return;
+    } else {
+      position = logEnqueuePosition.load(std::memory_order_relaxed);
+    }
   }
 
-  String timeString = "";
-  struct tm timeinfo;
-  if (!getLocalTime(&timeinfo)) {
-    timeString = "[Time unavailable] ";
-  } else {
-    char timeStr[30];
-    strftime(timeStr, sizeof(timeStr), "%a, %y/%m/%d %H:%M:%S", &timeinfo);
-    timeString = "[" + String(timeStr) + "] ";
+  fillLogEntry(slot->entry, level, format, arguments);
+  slot->sequence.store(position + 1, std::memory_order_release);
+}
+
+// single consumer, only called by the writer task
+static bool takeLogEntry(LogEntry &entry) {
+  LogSlot &slot = logRing[logDequeuePosition % logRingSlots];
+  if(slot.sequence.load(std::memory_order_acquire) != logDequeuePosition + 1) {
+    return false;
   }
 
-  Serial.println(timeString + text);
+  entry = slot.entry;
+  slot.sequence.store(logDequeuePosition + logRingSlots, std::memory_order_release);
+  logDequeuePosition++;
+  return true;
+}
+
+static void formatLogSegmentPath(uint32_t segment, char *path, size_t size) {
+  snprintf(path, size, "/log-%u%s", (unsigned int)segment, logSegmentExtension);
+}
+
+bool parseLogSegmentName(const char *name, uint32_t &segment) {
+  const char *slash = strrchr(name, '/');
+  if(slash) {
+    name = slash + 1;
+  }
+  if(strncmp(name, "log-", 4) != 0) {
+    return false;
+  }
 
-  if (logFile && !logResetInProgress) {
-    if (logFile.size() > 50000) {
-      Serial.println(timeString + "Logfile is too big, resetting it");
+  char *end;
+  segment = strtoul(name + 4, &end, 10);
+  return end != name + 4 && strcmp(end, logSegmentExtension) == 0;
+}
 
-      logResetInProgress = true;
-      resetLogFile();
-      logResetInProgress = false;
+static void openLogSegment(const char *mode) {
+  char path[24];
+  formatLogSegmentPath(currentLogSegment, path, sizeof(path));
+  logFile = halFileSystem().open(path, mode);
+  if (!logFile) {
+    Serial.println("Failed to open log file");
+  }
+  logSegmentBytes = logFile ? logFile.size() : 0;
+}
 
-      if(!logFile) {
-        return;
+// false if there is no segment yet
+static bool findLogSegments() {
+  bool found = false;
+  File root = halFileSystem().open("/");
+  File file = root.openNextFile();
+  while (file) {
+    uint32_t segment;
+    if(parseLogSegmentName(file.name(), segment)) {
+      if(!found || segment < oldestLogSegment) {
+        oldestLogSegment = segment;
+      }
+      if(!found || segment > currentLogSegment) {
+        currentLogSegment = segment;
       }
+      found = true;
+    }
+    file = root.openNextFile();
+  }
+  return found;
+}
+
+static void removeLogSegments(uint32_t from, uint32_t to) {
+  for(uint32_t segment = from; segment <= to; segment++) {
+    char path[24];
+    formatLogSegmentPath(segment, path, sizeof(path));
+    halFileSystem().remove(path);
+  }
+}
+
+#ifndef LOG_BINARY
+// the last lines of the single log file of older versions become segment 0,
+// copied to a temp file first so a reset in between doesn't leave half a line
+static void migrateLegacyLog(const char *legacyPath) {
+  char path[24];
+  formatLogSegmentPath(0, path, sizeof(path));
+  String tempPath = String(path) + ".tmp";
+  File legacy = halFileSystem().open(legacyPath, "r");
+  File segment = halFileSystem().open(tempPath, "w");
+  if(!legacy || !segment) {
+    return;
+  }
+
+  // from the first whole line of the last logSegmentSize bytes
+  size_t size = legacy.size();
+  size_t start = size > logSegmentSize ? size - logSegmentSize : 0;
+  if(start > 0) {
+    legacy.seek(start - 1);
+    while(start < size && legacy.read() != '\n') {
+      start++;
     }
-    logFile.println(timeString + text);
+  }
+  legacy.seek(start);
+  uint8_t chunk[512];
+  size_t read;
+  while((read = legacy.read(chunk, sizeof(chunk))) > 0) {
+    segment.write(chunk, read);
+  }
+  segment.close();
+  legacy.close();
+  halFileSystem().rename(tempPath, path);
+}
+#endif
+
+static void flushLogBatch() {
+  if(logBatchLength == 0) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> guard(logSegmentLock);
+  if (logFile) {
+    unsigned long startedAt = halMicros();
+    logFile.write((const uint8_t *)logBatch, logBatchLength);
     logFile.flush();
+    recordMetric(METRIC_FILE_WRITE, halMicros() - startedAt);
   }
+  logBatchLength = 0;
 }
 
-void resetLogFile() {
-  Serial.println("Resetting log file");
+// only called by the writer task, lines and records never span two segments
+static void rollLogSegment() {
+  flushLogBatch();
+
+  std::lock_guard<std::mutex> guard(logSegmentLock);
   if (logFile) {
     logFile.close();
   }
+  currentLogSegment++;
+  openLogSegment("w");
 
-  if (SPIFFS.exists("/log-messages.txt")) {
-    SPIFFS.remove("/log-messages.txt");
+  if(currentLogSegment - oldestLogSegment >= logSegmentCount) {
+    removeLogSegments(oldestLogSegment, currentLogSegment - logSegmentCount);
+    oldestLogSegment = currentLogSegment - logSegmentCount + 1;
   }
+#ifdef LOG_BINARY
+  logSegmentSynced = false;
+#endif
+}
 
-  logFile = SPIFFS.open("/log-messages.txt", "w");
-  if (logFile) {
-    Serial.println("Logfile has been resetted");
+static bool logSegmentHasRoom(size_t length) {
+  return logFile && logSegmentBytes + length <= logSegmentSize;
+}
+
+static void addToLogBatch(const char *data, size_t length) {
+  if(logBatchLength == 0) {
+    logBatchStartedAt = halMillis();
+  }
+  memcpy(logBatch + logBatchLength, data, length);
+  logBatchLength += length;
+  logSegmentBytes += length;
+
+  if(logBatchLength >= logFlushBytes) {
+    flushLogBatch();
+  }
+}
+
+#ifdef LOG_BINARY
+static uint32_t getLogEpochSeconds(uint32_t millis) {
+  struct tm timeinfo;
+  if (!halGetLocalTime(&timeinfo)) {
+    return 0;
+  }
+  // the time at millis, which can be a few ms ago
+  return toLogEpochSeconds(timeinfo) - (halMillis() - millis) / 1000;
+}
+
+// a new segment, the time got set or was changed by more than 2 seconds
+static bool needsLogSync(uint32_t millis, uint32_t epochSeconds) {
+  if(!logSegmentSynced || (logSyncEpochSeconds == 0) != (epochSeconds == 0)) {
+    return true;
+  }
+  int32_t drift = (int32_t)(epochSeconds - (logSyncEpochSeconds + (millis - logSyncMillis) / 1000));
+  return drift > 2 || drift < -2;
+}
+
+static size_t encodeLogEntry(const LogEntry &entry, uint16_t formatId, uint32_t epochSeconds, uint8_t *record) {
+  if(needsLogSync(entry.millis, epochSeconds)) {
+    size_t length = encodeLogSync(record, epochSeconds, entry.millis);
+    return length + encodeLogRecord(record + length, 0, formatId, entry.level, (const uint8_t *)entry.text, entry.length);
+  }
+  return encodeLogRecord(record, entry.millis - logLastMillis, formatId, entry.level, (const uint8_t *)entry.text, entry.length);
+}
+
+static void writeLogEntry(LogEntry &entry) {
+  LogRecord decoded = { entry.millis, getLogEpochSeconds(entry.millis), entry.level, 0, (const uint8_t *)entry.text, entry.length };
+  char line[logSlotSize + 32];
+  formatLogRecordLine(decoded, entry.format, line, sizeof(line));
+  Serial.println(line);
+
+  uint16_t formatId = findLogFormatId(entry.format);
+  if(formatId == 0) {
+    countDroppedLogMessage();
+    return;
+  }
+  // producers read the clock right after claiming their slot, keep the deltas positive
+  if(logSegmentSynced && (int32_t)(entry.millis - logLastMillis) < 0) {
+    entry.millis = logLastMillis;
+  }
+
+  uint8_t record[2 * maxLogRecordHeaderSize + 10 + logSlotSize];
+  size_t length = encodeLogEntry(entry, formatId, decoded.epochSeconds, record);
+  if(!logSegmentHasRoom(length)) {
+    rollLogSegment();
+    length = encodeLogEntry(entry, formatId, decoded.epochSeconds, record);
+  }
+  if(needsLogSync(entry.millis, decoded.epochSeconds)) {
+    logSegmentSynced = true;
+    logSyncEpochSeconds = decoded.epochSeconds;
+    logSyncMillis = entry.millis;
+  }
+  logLastMillis = entry.millis;
+  addToLogBatch((const char *)record, length);
+}
+#else
+static void writeLogEntry(LogEntry &entry) {
+  Serial.println(entry.text);
+
+  size_t length = strlen(entry.text);
+  if(!logSegmentHasRoom(length + 1)) {
+    rollLogSegment();
+  }
+  entry.text[length] = '\n';
+  addToLogBatch(entry.text, length + 1);
+}
+#endif
+
+static void makeLogEntry(LogEntry &entry, int level, const char *format, ...) {
+  va_list arguments;
+  va_start(arguments, format);
+  fillLogEntry(entry, level, format, arguments);
+  va_end(arguments);
+}
+
+static void reportDroppedLogMessages() {
+  uint32_t dropped = droppedLogMessages.exchange(0, std::memory_order_relaxed);
+  if(dropped == 0) {
+    return;
+  }
+
+  LogEntry entry;
+  makeLogEntry(entry, 0, "%u log messages dropped", (unsigned int)dropped);
+  writeLogEntry(entry);
+}
+
+static void logWriterTask(void *parameter) {
+  LogEntry entry;
+  for(;;) {
+    bool flushRequested = logFlushRequested.load(std::memory_order_acquire);
+
+    while(takeLogEntry(entry)) {
+      writeLogEntry(entry);
+    }
+    reportDroppedLogMessages();
+
+    if(logBatchLength > 0 && (flushRequested || halMillis() - logBatchStartedAt >= logFlushIntervalMs)) {
+      flushLogBatch();
+    }
+    if(flushRequested) {
+      logFlushRequested.store(false, std::memory_order_release);
+    }
+
+    halDelay(logWriterPollMs);
+  }
+}
+
+bool initializeLogger() {
+  for(uint32_t i = 0; i < logRingSlots; i++) {
+    logRing[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  // the single log file of older versions, the binary log can't take its text lines
+  if (halFileSystem().exists("/log-messages.txt")) {
+#ifndef LOG_BINARY
+    if(!findLogSegments()) {
+      migrateLegacyLog("/log-messages.txt");
+    }
+#endif
+    halFileSystem().remove("/log-messages.txt");
+  }
+
+  findLogSegments();
+#ifdef LOG_BINARY
+  loadLogFormats();
+  // formats of older firmware versions pile up, start over before the dictionary overflows
+  if(isLogFormatDictionaryCrowded()) {
+    removeLogSegments(oldestLogSegment, currentLogSegment);
+    clearLogFormats();
+    oldestLogSegment = currentLogSegment;
+  }
+#endif
+  openLogSegment("a");
+  halStartTask(logWriterTask, "logWriter", 4096, 1);
+  logWriterStarted = true;
+
+  LOG_DEBUG("Initialized Log.");
+  return (bool)logFile;
+}
+
+void logFormatted(int level, const char *format, ...) {
+  unsigned long startedAt = halMicros();
+  va_list arguments;
+  va_start(arguments, format);
+  if(!logWriterStarted) {
+    char line[logSlotSize];
+    vsnprintf(line, sizeof(line), format, arguments);
+    Serial.println(line);
   } else {
-    Serial.println("Failed to reset log file");
+    appendLogLine(level, format, arguments);
   }
-}
\ No newline at end of file
+  va_end(arguments);
+  recordMetric(METRIC_LOG_MESSAGE, halMicros() - startedAt);
+}
+
+void flushLog() {
+  if(!logWriterStarted) {
+    return;
+  }
+
+  logFlushRequested.store(true, std::memory_order_release);
+  unsigned long startedAt = halMillis();
+  while(logFlushRequested.load(std::memory_order_acquire) && halMillis() - startedAt < 1000) {
+    halDelay(10);
+  }
+}
+
+uint32_t getDroppedLogMessages() {
+  return droppedLogMessagesTotal.load(std::memory_order_relaxed);
+}
+
+uint32_t getLogEndCursor() {
+  std::lock_guard<std::mutex> guard(logSegmentLock);
+  return currentLogSegment * logSegmentSize + (logFile ? logFile.size() : 0);
+}
+
+uint32_t getLogTailCursor(size_t size) {
+  std::lock_guard<std::mutex> guard(logSegmentLock);
+  uint32_t endCursor = currentLogSegment * logSegmentSize + (logFile ? logFile.size() : 0);
+  uint32_t oldestCursor = oldestLogSegment * logSegmentSize;
+  if(endCursor - oldestCursor <= size) {
+    return oldestCursor;
+  }
+
+  uint32_t tail = endCursor - size;
+  uint32_t segment = tail / logSegmentSize;
+  uint32_t offset = tail % logSegmentSize;
+  if(offset == 0) {
+    return tail;
+  }
+  char path[24];
+  formatLogSegmentPath(segment, path, sizeof(path));
+  File file = halFileSystem().open(path, "r");
+  if(!file || offset >= file.size()) {
+    // behind the end of a full segment
+    return (segment + 1) * logSegmentSize;
+  }
+#ifdef LOG_BINARY
+  // the reader skips the records starting before the cursor
+  return tail;
+#else
+  // the next line starts behind a newline, lines are shorter than a slot
+  char line[logSlotSize + 32];
+  file.seek(offset - 1);
+  size_t read = file.read((uint8_t *)line, sizeof(line));
+  for(size_t i = 0; i < read; i++) {
+    if(line[i] == '\n') {
+      return tail + i;
+    }
+  }
+  return segment < currentLogSegment ? (segment + 1) * logSegmentSize : endCursor;
+#endif
+}
+
+// with logSegmentLock held, false if the cursor fell behind the oldest segment
+// or belongs to a deleted log, then reading starts over at the oldest segment.
+// The start of the next segment is valid too, a reader waits there behind a broken record.
+static bool startLogRead(uint32_t since, uint32_t &segment, uint32_t &offset) {
+  uint32_t endCursor = currentLogSegment * logSegmentSize + (logFile ? logFile.size() : 0);
+  segment = since / logSegmentSize;
+  offset = since % logSegmentSize;
+  if(segment >= oldestLogSegment && (since <= endCursor || since == (currentLogSegment + 1) * logSegmentSize)) {
+    return true;
+  }
+
+  segment = oldestLogSegment;
+  offset = 0;
+  return false;
+}
+
+#ifdef LOG_BINARY
+// decoder state at the cursor handed out last, so a client polling for
+// new lines doesn't make us decode the whole segment again
+static uint32_t logReadCursor = UINT32_MAX;
+static LogDecoder logReadDecoder;
+
+size_t readLogMessages(uint32_t since, char *buffer, size_t size, uint32_t &cursor, bool &continued) {
+  std::lock_guard<std::mutex> guard(logSegmentLock);
+  uint32_t segment;
+  uint32_t offset;
+  continued = startLogRead(since, segment, offset);
+
+  // without a known decoder state, decode from the segment start and skip what the client has
+  LogDecoder decoder;
+  uint32_t position = 0;
+  if(continued && since == logReadCursor) {
+    decoder = logReadDecoder;
+    position = offset;
+  } else {
+    resetLogDecoder(decoder);
+  }
+
+  size_t length = 0;
+  bool full = false;
+  for(;;) {
+    char path[24];
+    formatLogSegmentPath(segment, path, sizeof(path));
+    File file = halFileSystem().open(path, "r");
+    uint32_t fileSize = file ? file.size() : 0;
+
+    // records are much smaller than a chunk, so every chunk holds at least one
+    uint8_t chunk[512];
+    bool broken = false;
+    while(!full && !broken && position < fileSize) {
+      file.seek(position);
+      size_t read = file.read(chunk, sizeof(chunk));
+      const uint8_t *current = chunk;
+      LogRecord record;
+      for(;;) {
+        const uint8_t *recordStart = current;
+        LogDecoder decoderBefore = decoder;
+        if(!decodeLogRecord(decoder, current, chunk + read, record)) {
+          break;
+        }
+        if(record.formatId == logSyncFormatId || position + (recordStart - chunk) < offset) {
+          continue;
+        }
+
+        char line[logSlotSize + 32];
+        size_t lineLength = formatLogRecordLine(record, getLogFormat(record.formatId), line, sizeof(line));
+        if(length + lineLength + 1 > size) {
+          full = true;
+          decoder = decoderBefore;
+          current = recordStart;
+          break;
+        }
+        memcpy(buffer + length, line, lineLength);
+        buffer[length + lineLength] = '\n';
+        length += lineLength + 1;
+      }
+
+      // a broken record, nothing behind it can be decoded
+      broken = current == chunk && !full;
+      position += current - chunk;
+    }
+
+    // behind a broken record go on at the next segment, the current one included,
+    // so the cursor never points into the rest of the segment
+    if(full || (segment >= currentLogSegment && !broken)) {
+      break;
+    }
+    segment++;
+    position = 0;
+    offset = 0;
+    resetLogDecoder(decoder);
+  }
+
+  cursor = segment * logSegmentSize + position;
+  logReadCursor = cursor;
+  logReadDecoder = decoder;
+  return length;
+}
+#else
+size_t readLogMessages(uint32_t since, char *buffer, size_t size, uint32_t &cursor, bool &continued) {
+  std::lock_guard<std::mutex> guard(logSegmentLock);
+  uint32_t segment;
+  uint32_t offset;
+  continued = startLogRead(since, segment, offset);
+
+  size_t length = 0;
+  size_t segmentStartLength = 0;
+  while(length < size && segment <= currentLogSegment) {
+    char path[24];
+    formatLogSegmentPath(segment, path, sizeof(path));
+    File file = halFileSystem().open(path, "r");
+    if(file && offset < file.size()) {
+      segmentStartLength = length;
+      file.seek(offset);
+      size_t read = file.read((uint8_t *)buffer + length, size - length);
+      length += read;
+      offset += read;
+    }
+    if(length < size && segment < currentLogSegment) {
+      segment++;
+      offset = 0;
+    } else {
+      break;
+    }
+  }
+
+  // only hand out whole lines when the buffer was too small, a segment always starts with one
+  if(length == size) {
+    size_t lineEnd = length;
+    while(lineEnd > segmentStartLength && buffer[lineEnd - 1] != '\n') {
+      lineEnd--;
+    }
+    if(lineEnd > segmentStartLength) {
+      offset -= length - lineEnd;
+      length = lineEnd;
+    } else if(segmentStartLength > 0) {
+      offset = 0;
+      length = segmentStartLength;
+    }
+  }
+
+  cursor = segment * logSegmentSize + offset;
+  return length;
+}
+#endif
@@ -1,8 +1,54 @@
 #ifndef LOGGER_H
 #define LOGGER_H
 
+#include <Arduino.h>
+
+// 0 = only errors, 1 = normal, 2 = verbose
+// calls above LOG_LEVEL compile to nothing, their arguments are not evaluated
+#ifndef LOG_LEVEL
+#define LOG_LEVEL 2
+#endif
+
+#define LOG_ERROR(...) logFormatted(0, __VA_ARGS__)
+#if LOG_LEVEL >= 1
+#define LOG_INFO(...) logFormatted(1, __VA_ARGS__)
+#else
+#define LOG_INFO(...) do {} while(0)
+#endif
+#if LOG_LEVEL >= 2
+#define LOG_DEBUG(...) logFormatted(2, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) do {} while(0)
+#endif
+
+// build with -D LOG_BINARY to store compact binary records instead of text lines,
+// see log_codec.h and tools/logdecode.cpp
+
+// lines are queued in RAM and written to Serial and the log file by a writer task
+const uint32_t logRingSlots = 64;
+const size_t logSlotSize = 192;
+// the writer flushes to flash once this much is buffered or the oldest line waited logFlushIntervalMs
+const size_t logFlushBytes = 1024;
+const unsigned long logFlushIntervalMs = 2000;
+const unsigned long logWriterPollMs = 50;
+// the log is kept in logSegmentCount rotating files of at most logSegmentSize bytes
+const uint32_t logSegmentSize = 16384;
+const uint32_t logSegmentCount = 4;
+
 bool initializeLogger();
-void logMessage(String text, int debugLevel = 1);
-void resetLogFile();
+// printf style, formatted straight into the log ring, use the LOG_ macros above
+void logFormatted(int level, const char *format, ...) __attribute__((format(printf, 2, 3)));
+// waits (max 1s) until everything queued is on flash, e.g. before a restart
+void flushLog();
+uint32_t getDroppedLogMessages();
+// copies the log written after the cursor since (as far as it still exists) into buffer,
+// cursor is set to continue from, continued is false if the log was read from its oldest line instead
+size_t readLogMessages(uint32_t since, char *buffer, size_t size, uint32_t &cursor, bool &continued);
+// cursor behind the last line on flash
+uint32_t getLogEndCursor();
+// cursor of the first whole line within the last size bytes on flash, where a client without a cursor starts
+uint32_t getLogTailCursor(size_t size);
+// true for the file names of log segments, "log-<n>.txt", or "log-<n>.bin" with LOG_BINARY
+bool parseLogSegmentName(const char *name, uint32_t &segment);
 
-#endif
\ No newline at end of file
+#endif
@@ -1,4 +1,3 @@
-#include <SPIFFS.h>
 #include <WiFi.h>
 #include "esp_task_wdt.h"
 #include "wifi_utils.h"
@@ -6,10 +5,17 @@
 #include "file_utils.h"
 #include "datetime_utils.h"
 #include "pins.h"
+#include "pin_sampler.h"
+#include "command_executor.h"
 #include "mower.h"
 #include "webserver.h"
+#include "scheduler.h"
+#include "config_store.h"
+#include "wifi_credentials.h"
+#include "state_history.h"
+#include "mowing_sessions.h"
 
-int loopCounter = 0;
+const unsigned long dockingStateCheckIntervalMs = 60000;
 
 void setup() {
   // for now a higher timeout, for some possible longer requests on webserver resources.
@@ -18,16 +24,22 @@ void setup() {
 
   Serial.begin(115200);
 
-  if (!initializeSPIFFS()) {
+  if (!initializeFileSystem()) {
       return;
   }
 
   initializeLogger();
-  listSPIFFSFiles();
-  showUsageOfSPIFFSFileSystem();
+  initializeConfigStore();
+  initializeWifiCredentials();
+  initializeMowingSessions();
+  listFiles();
+  showFileSystemUsage();
 
-  logMessage("Starting Robot Mower Interface", 1);
+  LOG_INFO("Starting Robot Mower Interface");
   setupPins();
+  startPinSampler();
+  startCommandExecutor();
+  initializeStateHistory();
 
   setDefaultHostname();
   if (loadWifiCredentials() && connectToWifi()) {
@@ -38,30 +50,14 @@ void setup() {
 
   initializeWebServer();
 
-  asyncScanNetworks();
+  scheduleWifiJobs();
 
   loadMowingPlan();
+  scheduleMowingPlanChecks();
+  addScheduledJob("dockingState", checkStateChangeInDockingOrOutside, dockingStateCheckIntervalMs);
 }
 
 void loop() {
-  // do every 10 seconds
-  checkAsyncScanNetworksUpdate();
-
-  // do every 30 seconds
-  if(loopCounter == 3 || loopCounter == 0) {
-    reconnectToWifiIfNeeded();
-  }
-
-  // do every 60 seconds
-  if(loopCounter == 0)  {
-    checkAutomaticStartOrSendingHomeRequired();
-    checkStateChangeInDockingOrOutside();
-  }
-
-  loopCounter++;
-  if(loopCounter >= 6) {
-    loopCounter = 0;
-  }
-
-  delay(10000);
+  // runs the due jobs and sleeps until the next one, see scheduler.h
+  runScheduler();
 }
\ No newline at end of file
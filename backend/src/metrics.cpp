@@ -0,0 +1,100 @@
+#include <atomic>
+#include "metrics.h"
+
+struct MetricHistogram {
+  // per bucket, summed up when written
+  std::atomic<uint32_t> buckets[metricBucketCount + 1];
+  // 64 bit, a 32 bit sum wraps after 71 minutes of measured time while the count goes on
+  std::atomic<uint64_t> sumMicros;
+};
+
+struct RouteMetric {
+  const char *method;
+  const char *route;
+  MetricHistogram histogram;
+};
+
+static const uint32_t metricBucketBounds[metricBucketCount] = {
+  50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 1000000
+};
+
+static const char *metricNames[metricCount] = {
+  "mower_log_message_seconds",
+  "mower_file_write_seconds",
+  "mower_pin_sample_seconds",
+  "mower_loop_seconds"
+};
+
+static const char *metricHelps[metricCount] = {
+  "Time to queue a log line",
+  "Time to write and flush a batch of log lines",
+  "Time of one pin sampler round",
+  "Time of one scheduler round on the loop task"
+};
+
+static MetricHistogram histograms[metricCount];
+static RouteMetric routes[maxRouteMetrics];
+// routes are added at startup only, before anyone records or reads them
+static int routeCount = 0;
+
+static void recordHistogram(MetricHistogram &histogram, uint32_t micros) {
+  int bucket = 0;
+  while(bucket < metricBucketCount && micros > metricBucketBounds[bucket]) {
+    bucket++;
+  }
+  histogram.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  histogram.sumMicros.fetch_add(micros, std::memory_order_relaxed);
+}
+
+void recordMetric(MetricId id, uint32_t micros) {
+  recordHistogram(histograms[id], micros);
+}
+
+int addRouteMetric(const char *method, const char *route) {
+  if(routeCount == maxRouteMetrics) {
+    return -1;
+  }
+  routes[routeCount].method = method;
+  routes[routeCount].route = route;
+  return routeCount++;
+}
+
+void recordRouteMetric(int route, uint32_t micros) {
+  if(route >= 0 && route < routeCount) {
+    recordHistogram(routes[route].histogram, micros);
+  }
+}
+
+// labels without the braces, e.g. method="GET",route="/status"
+static void writeHistogram(Print &output, const char *name, const char *labels, const MetricHistogram &histogram) {
+  const char *separator = labels[0] ? "," : "";
+  uint32_t cumulative = 0;
+  for(int i = 0; i <= metricBucketCount; i++) {
+    cumulative += histogram.buckets[i].load(std::memory_order_relaxed);
+    if(i < metricBucketCount) {
+      output.printf("%s_bucket{%s%sle=\"%g\"} %u\n", name, labels, separator, metricBucketBounds[i] / 1e6, (unsigned int)cumulative);
+    } else {
+      output.printf("%s_bucket{%s%sle=\"+Inf\"} %u\n", name, labels, separator, (unsigned int)cumulative);
+    }
+  }
+  // the count is the +Inf bucket, so both match also while others record
+  const char *open = labels[0] ? "{" : "";
+  const char *close = labels[0] ? "}" : "";
+  output.printf("%s_sum%s%s%s %.6f\n", name, open, labels, close, (double)histogram.sumMicros.load(std::memory_order_relaxed) / 1e6);
+  output.printf("%s_count%s%s%s %u\n", name, open, labels, close, (unsigned int)cumulative);
+}
+
+void writeMetrics(Print &output) {
+  for(int i = 0; i < metricCount; i++) {
+    output.printf("# HELP %s %s\n# TYPE %s histogram\n", metricNames[i], metricHelps[i], metricNames[i]);
+    writeHistogram(output, metricNames[i], "", histograms[i]);
+  }
+
+  output.print("# HELP mower_http_request_seconds Time in the request handler, without streaming the response\n");
+  output.print("# TYPE mower_http_request_seconds histogram\n");
+  for(int i = 0; i < routeCount; i++) {
+    char labels[64];
+    snprintf(labels, sizeof(labels), "method=\"%s\",route=\"%s\"", routes[i].method, routes[i].route);
+    writeHistogram(output, "mower_http_request_seconds", labels, routes[i].histogram);
+  }
+}
@@ -0,0 +1,35 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+
+// Latency histograms for /metrics, written in the Prometheus text format.
+// Recording is a few relaxed atomic adds, cheap enough for every log line and pin sample.
+// The bucket counters are 32 bit, the sums in microseconds 64 bit, so a sum never wraps
+// before its count.
+
+enum MetricId : uint8_t {
+  // logFormatted(), until the line is in the log ring
+  METRIC_LOG_MESSAGE,
+  // the log writer's batched writes and flushes to the filesystem
+  METRIC_FILE_WRITE,
+  // one round of the pin sampler, reading and debouncing the four inputs
+  METRIC_PIN_SAMPLE,
+  // the jobs of one scheduler round on the loop task, without the sleep
+  METRIC_LOOP,
+  metricCount
+};
+
+// upper bounds of the buckets in microseconds, +Inf follows
+const int metricBucketCount = 12;
+// routes timed with addRouteMetric()
+const int maxRouteMetrics = 24;
+
+void recordMetric(MetricId id, uint32_t micros);
+// at startup, before the web server runs, returns the id for recordRouteMetric(), -1 if full
+int addRouteMetric(const char *method, const char *route);
+void recordRouteMetric(int route, uint32_t micros);
+// all histograms as Prometheus text
+void writeMetrics(Print &output);
+
+#endif
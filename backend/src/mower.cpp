@@ -1,14 +1,29 @@
-#include <Arduino.h>
-#include <SPIFFS.h>
+#include <mutex>
 #include <ArduinoJson.h>
+#include "hal.h"
 #include "mower.h"
 #include "logger.h"
 #include "pins.h"
+#include "pin_sampler.h"
+#include "command_executor.h"
+#include "mowing_schedule.h"
+#include "scheduler.h"
+#include "config_store.h"
+#include "mowing_sessions.h"
 
 MowingPlan currentMowingPlan;
+// currentMowingPlan compiled to a minute of week bitmap, see mowing_schedule.h
+MowingSchedule currentMowingSchedule;
+// both are replaced on the web server task when a plan is saved, and read on the loop task
+static std::mutex mowingPlanLock;
 bool mowerWasStartedManually = false;
-String lastManualStop = "";
+// day of the last manual stop as tm_year * 1000 + tm_yday, -1 if none
+int lastManualStopDay = -1;
 String stateInDockingOrOutside = "";
+// a session that begins this soon after a start command counts as started by it, see mowing_sessions.h
+const unsigned long sessionTriggerWindowMs = 10UL * 60 * 1000;
+bool startRequested = false;
+unsigned long startRequestedAt = 0;
 
 struct LastAutomaticCommand {
   String command;
@@ -18,53 +33,96 @@ struct LastAutomaticCommand {
 
 LastAutomaticCommand lastAutomaticCommand;
 
+// the plan check runs at the exact minute of the next transition,
+// and at least every few minutes for retries and mowers coming home early
+const unsigned long mowingPlanRecheckMs = 5UL * 60 * 1000;
+// run shortly after the minute started, so the new minute is seen
+const unsigned long mowingPlanTransitionMarginMs = 200;
+int mowingPlanJob = -1;
+
 bool isCurrentMovingPlanActive() {
+  std::lock_guard<std::mutex> guard(mowingPlanLock);
   return currentMowingPlan.customMowingPlanActive;
 }
 
 void checkAutomaticStartOrSendingHomeRequired() {
-  logMessage("Checking automatic start or sending home required", 2);
+  LOG_DEBUG("Checking automatic start or sending home required");
 
   // no mowing, if custom mowing plan is not active
-  if(!currentMowingPlan.customMowingPlanActive) {
-    logMessage("No custom mowing plan active", 2);
+  if(!isCurrentMovingPlanActive()) {
+    LOG_DEBUG("No custom mowing plan active");
     return;
   }
 
+  MowerSnapshot snapshot = getMowerSnapshot();
+
   // if mower is outside and time is later than end time, stop mower
   // get isMowingTime
   if(!isMowingTime()) {
-    if(!isIdle() && !isAttachedToCharger()) {
+    if(!snapshot.isIdle && !snapshot.isCharging) {
       // only do this, if its not a manual start
       if(!mowerWasStartedManually) {
         if(checkCommandIsNotRepeatedTooEarly("stop")) {
-          logMessage("Stopping mower, because its not mowing time", 2);
+          LOG_DEBUG("Stopping mower, because its not mowing time");
           sendMowerHome();
         }
       }
     }
   }else{
-    if(isIdle() || isAttachedToCharger()) {
+    if(snapshot.isIdle || snapshot.isCharging) {
       if(checkCommandIsNotRepeatedTooEarly("start")) {
-        logMessage("Starting mower, because its mowing time", 2);
+        LOG_DEBUG("Starting mower, because its mowing time");
         startMower();
       }
     }
   }
 }
 
+static unsigned long getMillisUntilNextMowingPlanCheck() {
+  struct tm timeinfo;
+  if (!isCurrentMovingPlanActive() || !halGetLocalTime(&timeinfo)) {
+    return mowingPlanRecheckMs;
+  }
+
+  int minuteOfWeek = getMinuteOfWeek(timeinfo);
+  int nextTransition;
+  {
+    std::lock_guard<std::mutex> guard(mowingPlanLock);
+    nextTransition = getNextMowingTransition(currentMowingSchedule, minuteOfWeek);
+  }
+  if (nextTransition < 0) {
+    return mowingPlanRecheckMs;
+  }
+
+  unsigned long untilTransition = ((unsigned long)(nextTransition - minuteOfWeek) * 60 - timeinfo.tm_sec) * 1000 + mowingPlanTransitionMarginMs;
+  return untilTransition < mowingPlanRecheckMs ? untilTransition : mowingPlanRecheckMs;
+}
+
+static void runMowingPlanJob() {
+  checkAutomaticStartOrSendingHomeRequired();
+  rescheduleJob(mowingPlanJob, getMillisUntilNextMowingPlanCheck());
+}
+
+void scheduleMowingPlanChecks() {
+  mowingPlanJob = addScheduledJob("mowingPlan", runMowingPlanJob, 0);
+}
+
+void requestMowingPlanCheck() {
+  rescheduleJob(mowingPlanJob, 0);
+}
+
 bool checkCommandIsNotRepeatedTooEarly(String command) {
   // check if last command was the same, and it was only like < 5 minutes ago, then ignore the command
   if(lastAutomaticCommand.command == command) {
     if((time(0) - lastAutomaticCommand.timestamp) < 300) {
-      logMessage("Command was already sent less than 5 minutes ago, so ignore the command: " + command, 2);
+      LOG_DEBUG("Command was already sent less than 5 minutes ago, so ignore the command: %s", command.c_str());
       // ignore retries for 5 minutes
       return false;
     }
 
     if(lastAutomaticCommand.amountRetries >= 5) {
       // if last command was the same, and it was less than 5 minutes ago, and it was already tried 3 times, then ignore the command
-      logMessage("Command was retried 5 times, so ignore the command: "+ command, 2);
+      LOG_DEBUG("Command was retried 5 times, so ignore the command: %s", command.c_str());
       return false;
     }
 
@@ -80,233 +138,236 @@ bool checkCommandIsNotRepeatedTooEarly(String command) {
   return true;
 }
 
+static SessionTrigger getSessionTrigger() {
+  if(startRequested && halMillis() - startRequestedAt < sessionTriggerWindowMs) {
+    return mowerWasStartedManually ? SESSION_MANUAL : SESSION_PLAN;
+  }
+  return SESSION_NATIVE;
+}
+
 void checkStateChangeInDockingOrOutside() {
-  if(isIdle()) {
+  MowerSnapshot snapshot = getMowerSnapshot();
+  if(isMowingSessionActive()) {
+    if(snapshot.isEmergency) {
+      endMowingSession(SESSION_EMERGENCY);
+    } else if(getMowingSessionSeconds() > maxSessionSeconds) {
+      endMowingSession(SESSION_TIMEOUT);
+    }
+  }
+  if(snapshot.isIdle) {
     return;
   }
-  if(isAttachedToCharger()) {
+  if(snapshot.isCharging) {
     if(stateInDockingOrOutside == "IN DOCKING") {
       return;
     }
     stateInDockingOrOutside = "IN DOCKING";
+    endMowingSession(SESSION_DOCKED);
     if(mowerWasStartedManually) {
       // reset, so next planned start will not be treated as manual start any more
       mowerWasStartedManually = false;
     }
-    if(currentMowingPlan.customMowingPlanActive) {
+    if(isCurrentMovingPlanActive()) {
       // after coming home:
       // press stop button, if mower is in docking station and custom mowing plan is active
       // this will avoid, that the mower starts according to the own logic ~24hours later
-      pressStopButton(150);
+      stopMower();
     }
   }else{
     if(stateInDockingOrOutside == "OUTSIDE") {
       return;
     }
+    // only if it was seen leaving, not if it was already outside at boot
+    if(stateInDockingOrOutside == "IN DOCKING") {
+      beginMowingSession(getSessionTrigger());
+    }
+    startRequested = false;
     stateInDockingOrOutside = "OUTSIDE";
   }
 }
 
-bool isMowingTime() {
-  logMessage("Checking if its mowing time", 2);
+static int getDayNumber(const struct tm &timeinfo) {
+  return timeinfo.tm_year * 1000 + timeinfo.tm_yday;
+}
 
-  // check if its mowing time
+bool isMowingTime() {
   struct tm timeinfo;
-  if (!getLocalTime(&timeinfo)) {
-    logMessage("Failed to obtain time", 0);
+  if (!halGetLocalTime(&timeinfo)) {
+    LOG_ERROR("Failed to obtain time");
     return false;
   }
 
-  int currentHour = timeinfo.tm_hour;
-  int currentMinute = timeinfo.tm_min;
-
-  String dateString = String(timeinfo.tm_year) + "-" +
-                      String(timeinfo.tm_mon + 1) + "-" +
-                      String(timeinfo.tm_mday);
-
-  if(lastManualStop == dateString) {
-    logMessage("Mower was stopped manually today, so no mowing time today anymore", 2);
+  // no mowing time today anymore, after the mower was stopped manually
+  if(lastManualStopDay == getDayNumber(timeinfo)) {
     return false;
   }
 
-  int weekdayIndex = (timeinfo.tm_wday + 6) % 7; // change sunday 0 to monday 0
-  if(currentMowingPlan.days[weekdayIndex]) {
-    if(currentHour >= currentMowingPlan.startTime.substring(0, 2).toInt() && currentMinute >= currentMowingPlan.startTime.substring(3, 5).toInt()) {
-      if(currentHour < currentMowingPlan.endTime.substring(0, 2).toInt() ||
-        currentHour == currentMowingPlan.endTime.substring(0, 2).toInt() && currentMinute <= currentMowingPlan.endTime.substring(3, 5).toInt()) {
-        logMessage("Mowing time", 2);
-        return true;
-      }
-    }
-  }
-
-  logMessage("Not mowing time", 2);
-  return false;
+  int minuteOfWeek = getMinuteOfWeek(timeinfo);
+  std::lock_guard<std::mutex> guard(mowingPlanLock);
+  return isScheduledMinute(currentMowingSchedule, minuteOfWeek);
 }
 
+// with mowingPlanLock held
+static void compileMowingPlan(const MowingPlan &plan) {
+  clearMowingSchedule(currentMowingSchedule);
 
-void pressButton(int pin, int duration, bool holdStopButtonPressed) {
-  // log message, which button is pressed, make string from pin
-  logMessage("Pressing button: " + String(pin), 2);
-
-  if(holdStopButtonPressed) {
-    pressStopButton(0);
-    delay(150);
+  for(int day = 0; day < 7; day++) {
+    if(!plan.days[day]) {
+      continue;
+    }
+    for(int i = 0; i < plan.windowCount[day]; i++) {
+      addMowingWindow(currentMowingSchedule, day, plan.windows[day][i].startMinute, plan.windows[day][i].endMinute);
+    }
   }
 
-  digitalWrite(pin, LOW);
-  delay(duration);
-  digitalWrite(pin, HIGH);
-
-  if(holdStopButtonPressed) {
-    digitalWrite(pinButtonStop, LOW);
-  }
+  finalizeMowingSchedule(currentMowingSchedule);
 }
 
-void pressStopButton(int releaseAfter) {
-  digitalWrite(pinButtonStop, HIGH);
-  if(releaseAfter > 0) {
-    delay(releaseAfter);
-    digitalWrite(pinButtonStop, LOW);
+static bool addMowingPlanWindow(MowingPlan &plan, int day, const char *start, const char *end) {
+  int startMinute = parseTimeOfDay(start);
+  int endMinute = parseTimeOfDay(end);
+  if(startMinute < 0 || endMinute < 0 || plan.windowCount[day] >= maxMowingWindowsPerDay) {
+    return false;
   }
+
+  MowingWindow &window = plan.windows[day][plan.windowCount[day]++];
+  window.startMinute = startMinute;
+  window.endMinute = endMinute;
+  return true;
 }
 
-void saveMowingPlan(MowingPlan plan) {
-  File file = SPIFFS.open("/mowing_plan.json", "w");
-  if (!file) {
-    logMessage("Failed to open file for writing: /mowing_plan.json", 0);
-    return;
+bool readMowingPlanJson(JsonObjectConst json, MowingPlan &plan) {
+  if(!json.containsKey("customMowingPlanActive") || !json.containsKey("days")) {
+    return false;
   }
 
-  StaticJsonDocument<256> doc;
-  doc["customMowingPlanActive"] = plan.customMowingPlanActive;
-
-  JsonArray days = doc.createNestedArray("days");
-  for (int i = 0; i < 7; i++) {
-    days.add(plan.days[i]);
+  plan.customMowingPlanActive = json["customMowingPlanActive"].as<bool>();
+  JsonArrayConst days = json["days"].as<JsonArrayConst>();
+  for(int day = 0; day < 7; day++) {
+    plan.days[day] = days[day].as<bool>();
+    plan.windowCount[day] = 0;
   }
 
-  doc["startTime"] = plan.startTime;
-  doc["endTime"] = plan.endTime;
-
-  if (serializeJson(doc, file) == 0) {
-    logMessage("Failed to write to file: /mowing_plan.json", 0);
+  // windows per weekday: [[{"start": "09:00", "end": "11:00"}, ...], ...]
+  JsonArrayConst windows = json["windows"].as<JsonArrayConst>();
+  if(!windows.isNull()) {
+    for(int day = 0; day < 7; day++) {
+      for(JsonObjectConst window : windows[day].as<JsonArrayConst>()) {
+        if(!addMowingPlanWindow(plan, day, window["start"].as<const char*>(), window["end"].as<const char*>())) {
+          return false;
+        }
+      }
+    }
+    return true;
   }
 
-  file.close();
-
-  loadMowingPlan();
-}
-
-MowingPlan loadMowingPlan() {
-  MowingPlan plan;
-
-  File file = SPIFFS.open("/mowing_plan.json", "r");
-  if (!file) {
-    logMessage("Failed to open file for reading", 0);
-    return plan;
+  // one window for all days, as posted and stored up to 0.3.x
+  const char *start = json.containsKey("planTimeStart") ? json["planTimeStart"].as<const char*>() : json["startTime"].as<const char*>();
+  const char *end = json.containsKey("planTimeEnd") ? json["planTimeEnd"].as<const char*>() : json["endTime"].as<const char*>();
+  if(parseTimeOfDay(start) < 0 || parseTimeOfDay(end) < 0) {
+    // a plan for manual starts only, without times
+    return true;
   }
+  for(int day = 0; day < 7; day++) {
+    addMowingPlanWindow(plan, day, start, end);
+  }
+  return true;
+}
 
-  // log file content
-  String fileContent = file.readString();
-  logMessage("Mowing Plan: " + fileContent, 2);
+void writeMowingPlanJson(const MowingPlan &plan, JsonObject json) {
+  json["customMowingPlanActive"] = plan.customMowingPlanActive;
 
-  // set file position to start
-  file.seek(0);
+  JsonArray days = json.createNestedArray("days");
+  JsonArray windows = json.createNestedArray("windows");
+  for(int day = 0; day < 7; day++) {
+    days.add(plan.days[day]);
 
-  StaticJsonDocument<256> doc;
-  DeserializationError error = deserializeJson(doc, file);
-  if (error) {
-    logMessage("Failed to read file /mowing_plan.json, using default settings", 0);
-  } else {
-    plan.customMowingPlanActive = doc["customMowingPlanActive"];
+    JsonArray dayWindows = windows.createNestedArray();
+    for(int i = 0; i < plan.windowCount[day]; i++) {
+      char start[6];
+      char end[6];
+      formatTimeOfDay(plan.windows[day][i].startMinute, start);
+      formatTimeOfDay(plan.windows[day][i].endMinute, end);
 
-    for (int i = 0; i < 7; i++) {
-      plan.days[i] = doc["days"][i];
+      JsonObject window = dayWindows.createNestedObject();
+      window["start"] = start;
+      window["end"] = end;
     }
+  }
+}
 
-    plan.startTime = doc["startTime"].as<String>();
-    plan.endTime = doc["endTime"].as<String>();
+bool saveMowingPlan(const MowingPlan &plan) {
+  if (!storeMowingPlan(plan)) {
+    return false;
   }
+  loadMowingPlan();
+  return true;
+}
 
-  file.close();
+MowingPlan loadMowingPlan() {
+  // the default plan if none was saved, see config_store.h
+  MowingPlan plan = getStoredMowingPlan();
 
+  // compiling is short, the loop task rather waits than reads half a plan
+  std::lock_guard<std::mutex> guard(mowingPlanLock);
   currentMowingPlan = plan;
+  compileMowingPlan(plan);
 
   return plan;
 }
 
-void startMower(bool isManual) {
-  logMessage("Starting mower", 2);
-  lastManualStop = "";
+uint32_t startMower(bool isManual) {
+  LOG_DEBUG("Starting mower");
+  lastManualStopDay = -1;
   mowerWasStartedManually = isManual;
-  if(isLocked()) {
-    unlock();
-  }
+  startRequested = true;
+  startRequestedAt = halMillis();
 
-  pressButton(pinButtonStart, 150, true);
+  // unlocks first, if the mower is locked
+  return queueCommand(COMMAND_START);
 }
 
-void sendMowerHome(bool isManual) {
-  logMessage("Sending mower home", 2);
+uint32_t sendMowerHome(bool isManual) {
+  LOG_DEBUG("Sending mower home");
   if(isManual) {
-    // set current day as string to lastManualStop, format YYYY-MM-DD
+    // remember the current day, so the plan does not start the mower again today
     struct tm timeinfo;
-    if (getLocalTime(&timeinfo)) {
-      char dateStr[11];
-      strftime(dateStr, sizeof(dateStr), "%Y-%m-%d", &timeinfo);
-      lastManualStop = String(dateStr);
+    if (halGetLocalTime(&timeinfo)) {
+      lastManualStopDay = getDayNumber(timeinfo);
     }
   }
-  if(isLocked()) {
-    unlock();
-  }
 
-  pressButton(pinButtonHome, 150, true);
+  // unlocks first, if the mower is locked
+  return queueCommand(COMMAND_HOME);
 }
 
-void unlock() {
-  logMessage("Unlocking mower", 2);
-  // press 4 times on unlock button
-  for(int i = 0; i < 4; i++) {
-    pressButton(pinButtonLock);
-    delay(100);
-  }
+uint32_t stopMower() {
+  LOG_DEBUG("Stopping mower");
+  return queueCommand(COMMAND_STOP);
 }
 
-void lock() {
-  logMessage("Locking mower", 2);
-  pressButton(pinButtonLock);
+uint32_t unlock() {
+  LOG_DEBUG("Unlocking mower");
+  return queueCommand(COMMAND_UNLOCK);
 }
 
-bool isAttachedToCharger() {
-  // check every 50ms if pin is high, until 750ms
-  for(int i = 0; i < 15; i++) {
-    if(digitalRead(pinLedCharging) == HIGH) {
-      return true;
-    }
-    delay(50);
-  }
+uint32_t lock() {
+  LOG_DEBUG("Locking mower");
+  return queueCommand(COMMAND_LOCK);
+}
 
-  return false;
+bool isAttachedToCharger() {
+  return getMowerSnapshot().isCharging;
 }
 
 bool isLocked() {
-  // check every 50ms if pin is high, until 750ms
-  for(int i = 0; i < 15; i++) {
-    if(digitalRead(pinLedLocked) == HIGH) {
-      return true;
-    }
-    delay(50);
-  }
-
-  return false;
+  return getMowerSnapshot().isLocked;
 }
 
 bool isEmergency() {
-  return digitalRead(pinLedEmergency) == HIGH;
+  return getMowerSnapshot().isEmergency;
 }
 
 bool isIdle() {
-  return digitalRead(pinIdle) != HIGH;
+  return getMowerSnapshot().isIdle;
 }
\ No newline at end of file
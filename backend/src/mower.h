@@ -2,27 +2,45 @@
 #define MOWER_H
 
 #include <Arduino.h>
+#include <ArduinoJson.h>
+
+const int maxMowingWindowsPerDay = 4;
+const size_t mowingPlanJsonCapacity = 3072;
+
+// minutes since midnight, mowing stops at endMinute, an end before the start means over midnight
+struct MowingWindow {
+  uint16_t startMinute;
+  uint16_t endMinute;
+};
 
 struct MowingPlan {
-  bool customMowingPlanActive;
-  bool days[7];  // Days (Mo=0, Di=1, ..., So=6)
-  String startTime;
-  String endTime;
+  bool customMowingPlanActive = false;
+  bool days[7] = {};  // Days (Mo=0, Di=1, ..., So=6)
+  MowingWindow windows[7][maxMowingWindowsPerDay];
+  uint8_t windowCount[7] = {};
 };
 
 bool isCurrentMovingPlanActive();
-void pressButton(int pin, int duration = 150, bool holdStopButtonPressed = false);
-void pressStopButton(int releaseAfter = 0);
-void saveMowingPlan(MowingPlan plan);
+// stores the plan and applies it, false if it could not be written
+bool saveMowingPlan(const MowingPlan &plan);
+// applies the plan of the config store
 MowingPlan loadMowingPlan();
+bool readMowingPlanJson(JsonObjectConst json, MowingPlan &plan);
+void writeMowingPlanJson(const MowingPlan &plan, JsonObject json);
 void checkAutomaticStartOrSendingHomeRequired();
+// checks the plan now and then again at each start and end of a mowing window
+void scheduleMowingPlanChecks();
+// runs the plan check on the loop task as soon as possible, e.g. after the plan or the time changed
+void requestMowingPlanCheck();
 bool isMowingTime();
 void checkStateChangeInDockingOrOutside();
-void startMower(bool isManual = false);
-void sendMowerHome(bool isManual = false);
+// the following queue a command and return its id, see command_executor.h
+uint32_t startMower(bool isManual = false);
+uint32_t sendMowerHome(bool isManual = false);
+uint32_t stopMower();
+uint32_t unlock();
+uint32_t lock();
 bool checkCommandIsNotRepeatedTooEarly(String command);
-void unlock();
-void lock();
 bool isAttachedToCharger();
 bool isLocked();
 bool isEmergency();
@@ -0,0 +1,171 @@
+#include <string.h>
+#include "mowing_schedule.h"
+
+static void setMinuteRange(MowingSchedule &schedule, int from, int to) {
+  for(int minute = from; minute < to; minute++) {
+    schedule.bits[minute >> 5] |= (uint32_t)1 << (minute & 31);
+  }
+}
+
+static void appendInterval(MowingSchedule &schedule, int from, int to) {
+  if(schedule.intervalCount < maxMowingIntervals) {
+    schedule.intervals[schedule.intervalCount++] = { (uint16_t)from, (uint16_t)to };
+  }
+}
+
+// index of the last interval starting at or before minuteOfWeek, -1 if none
+static int findLastIntervalStartingBefore(const MowingSchedule &schedule, int minuteOfWeek) {
+  int low = 0;
+  int high = schedule.intervalCount - 1;
+  int found = -1;
+  while(low <= high) {
+    int middle = (low + high) / 2;
+    if(schedule.intervals[middle].start <= minuteOfWeek) {
+      found = middle;
+      low = middle + 1;
+    } else {
+      high = middle - 1;
+    }
+  }
+  return found;
+}
+
+void clearMowingSchedule(MowingSchedule &schedule) {
+  schedule.intervalCount = 0;
+  memset(schedule.bits, 0, sizeof(schedule.bits));
+}
+
+void addMowingWindow(MowingSchedule &schedule, int weekday, int startMinute, int endMinute) {
+  if(weekday < 0 || weekday > 6 || startMinute < 0 || endMinute < 0 || startMinute == endMinute) {
+    return;
+  }
+
+  int from = weekday * minutesPerDay + startMinute;
+  int length = endMinute - startMinute;
+  if(length < 0) {
+    length += minutesPerDay;
+  }
+  int to = from + length;
+
+  // sunday night windows wrap into monday morning
+  if(to > minutesPerWeek) {
+    appendInterval(schedule, from, minutesPerWeek);
+    appendInterval(schedule, 0, to - minutesPerWeek);
+  } else {
+    appendInterval(schedule, from, to);
+  }
+}
+
+void finalizeMowingSchedule(MowingSchedule &schedule) {
+  MowingInterval *intervals = schedule.intervals;
+
+  // insertion sort by start, there are only a few intervals
+  for(int i = 1; i < schedule.intervalCount; i++) {
+    MowingInterval current = intervals[i];
+    int j = i - 1;
+    while(j >= 0 && intervals[j].start > current.start) {
+      intervals[j + 1] = intervals[j];
+      j--;
+    }
+    intervals[j + 1] = current;
+  }
+
+  // merge overlapping and touching intervals
+  int merged = 0;
+  for(int i = 0; i < schedule.intervalCount; i++) {
+    if(merged > 0 && intervals[i].start <= intervals[merged - 1].end) {
+      if(intervals[i].end > intervals[merged - 1].end) {
+        intervals[merged - 1].end = intervals[i].end;
+      }
+    } else {
+      intervals[merged++] = intervals[i];
+    }
+  }
+  schedule.intervalCount = merged;
+
+  memset(schedule.bits, 0, sizeof(schedule.bits));
+  for(int i = 0; i < schedule.intervalCount; i++) {
+    setMinuteRange(schedule, intervals[i].start, intervals[i].end);
+  }
+}
+
+bool isScheduledMinute(const MowingSchedule &schedule, int minuteOfWeek) {
+  if(minuteOfWeek < 0 || minuteOfWeek >= minutesPerWeek) {
+    return false;
+  }
+  return (schedule.bits[minuteOfWeek >> 5] >> (minuteOfWeek & 31)) & 1;
+}
+
+int findMowingInterval(const MowingSchedule &schedule, int minuteOfWeek) {
+  int index = findLastIntervalStartingBefore(schedule, minuteOfWeek);
+  if(index >= 0 && minuteOfWeek < schedule.intervals[index].end) {
+    return index;
+  }
+  return -1;
+}
+
+int getNextMowingTransition(const MowingSchedule &schedule, int minuteOfWeek) {
+  int count = schedule.intervalCount;
+  if(count == 0) {
+    return -1;
+  }
+
+  const MowingInterval &first = schedule.intervals[0];
+  const MowingInterval &last = schedule.intervals[count - 1];
+  bool wrapsIntoNextWeek = last.end == minutesPerWeek && first.start == 0;
+
+  int index = findLastIntervalStartingBefore(schedule, minuteOfWeek);
+  if(index >= 0 && minuteOfWeek < schedule.intervals[index].end) {
+    // inside, next transition is the end of this interval
+    if(index == count - 1 && wrapsIntoNextWeek) {
+      // mowing the whole week
+      if(count == 1) {
+        return -1;
+      }
+      return minutesPerWeek + first.end;
+    }
+    return schedule.intervals[index].end;
+  }
+
+  // outside, next transition is the start of the next interval
+  if(index + 1 < count) {
+    return schedule.intervals[index + 1].start;
+  }
+  return minutesPerWeek + first.start;
+}
+
+int parseTimeOfDay(const char *text) {
+  if(!text || strlen(text) < 5 || text[2] != ':') {
+    return -1;
+  }
+  const int digitPositions[] = { 0, 1, 3, 4 };
+  for(int i = 0; i < 4; i++) {
+    char c = text[digitPositions[i]];
+    if(c < '0' || c > '9') {
+      return -1;
+    }
+  }
+
+  int hour = (text[0] - '0') * 10 + (text[1] - '0');
+  int minute = (text[3] - '0') * 10 + (text[4] - '0');
+  if(hour > 23 || minute > 59) {
+    return -1;
+  }
+  return hour * 60 + minute;
+}
+
+void formatTimeOfDay(int minutes, char *buffer) {
+  int hour = (minutes / 60) % 24;
+  int minute = minutes % 60;
+  buffer[0] = '0' + hour / 10;
+  buffer[1] = '0' + hour % 10;
+  buffer[2] = ':';
+  buffer[3] = '0' + minute / 10;
+  buffer[4] = '0' + minute % 10;
+  buffer[5] = '\0';
+}
+
+int getMinuteOfWeek(const struct tm &timeinfo) {
+  int weekdayIndex = (timeinfo.tm_wday + 6) % 7; // change sunday 0 to monday 0
+  return weekdayIndex * minutesPerDay + timeinfo.tm_hour * 60 + timeinfo.tm_min;
+}
@@ -0,0 +1,48 @@
+#ifndef MOWING_SCHEDULE_H
+#define MOWING_SCHEDULE_H
+
+#include <stdint.h>
+#include <time.h>
+
+// The mowing plan compiled into
+// - a sorted table of merged [start, end) intervals in minutes of the week (Mo 00:00 = 0),
+//   searched binary for the interval around a minute and the next transition
+// - one bit per minute of the week, so checking the current minute is a single bit test
+
+const int minutesPerDay = 24 * 60;
+const int minutesPerWeek = 7 * minutesPerDay;
+const int scheduleWords = (minutesPerWeek + 31) / 32;
+const int maxMowingIntervals = 40;
+
+struct MowingInterval {
+  uint16_t start;
+  uint16_t end;
+};
+
+struct MowingSchedule {
+  MowingInterval intervals[maxMowingIntervals];
+  uint8_t intervalCount;
+  uint32_t bits[scheduleWords];
+};
+
+void clearMowingSchedule(MowingSchedule &schedule);
+// adds [startMinute, endMinute) on the given weekday (Mo=0),
+// an end before the start runs over midnight into the next day
+void addMowingWindow(MowingSchedule &schedule, int weekday, int startMinute, int endMinute);
+// sorts and merges the added windows and builds the bitmap, call after the last addMowingWindow()
+void finalizeMowingSchedule(MowingSchedule &schedule);
+
+bool isScheduledMinute(const MowingSchedule &schedule, int minuteOfWeek);
+// index of the interval containing minuteOfWeek, -1 if none
+int findMowingInterval(const MowingSchedule &schedule, int minuteOfWeek);
+// minute of the next start or end after minuteOfWeek, values >= minutesPerWeek are in the next week,
+// -1 if the schedule never changes
+int getNextMowingTransition(const MowingSchedule &schedule, int minuteOfWeek);
+
+// "HH:MM" to minutes since midnight, -1 if invalid
+int parseTimeOfDay(const char *text);
+// minutes since midnight to "HH:MM", buffer needs 6 chars
+void formatTimeOfDay(int minutes, char *buffer);
+int getMinuteOfWeek(const struct tm &timeinfo);
+
+#endif
@@ -0,0 +1,254 @@
+#include <mutex>
+#include <stddef.h>
+#include <string.h>
+#include "mowing_sessions.h"
+#include "hal.h"
+#include "logger.h"
+#include "log_codec.h"
+
+static const char *sessionsPath = "/sessions.bin";
+static const char *sessionsTempPath = "/sessions.bin.tmp";
+static const uint32_t sessionsMagic = 0x53455353; // "SSES"
+static const uint8_t sessionsVersion = 1;
+
+// the file is this struct as it is in RAM, little endian like the ESP32
+struct SessionsFile {
+  uint32_t magic;
+  uint8_t version;
+  uint8_t sessionCount;
+  uint16_t reserved;
+  MowingSession sessions[sessionHistorySize];
+  // indexed by period modulo their count
+  SessionAggregate days[sessionDayCount];
+  SessionAggregate weeks[sessionWeekCount];
+  uint32_t crc;
+};
+
+// sessions begin and end on the loop task, the summary is read on the async_tcp task
+static std::mutex sessionsLock;
+static SessionsFile sessionsData;
+static bool sessionActive = false;
+static MowingSession currentSession;
+static unsigned long sessionStartedAt = 0;
+
+static uint32_t crc32(const void *data, size_t length) {
+  const uint8_t *bytes = (const uint8_t *)data;
+  uint32_t crc = 0xffffffff;
+  for(size_t i = 0; i < length; i++) {
+    crc ^= bytes[i];
+    for(int bit = 0; bit < 8; bit++) {
+      crc = crc & 1 ? (crc >> 1) ^ 0xedb88320u : crc >> 1;
+    }
+  }
+  return ~crc;
+}
+
+static bool getSessionTime(uint32_t &time) {
+  struct tm timeinfo;
+  if(!halGetLocalTime(&timeinfo)) {
+    return false;
+  }
+  time = toLogEpochSeconds(timeinfo);
+  return true;
+}
+
+static uint32_t getDayPeriod(uint32_t time) {
+  return time / 86400;
+}
+
+// 1970-01-01 was a thursday, weeks start on monday
+static uint32_t getWeekPeriod(uint32_t time) {
+  return (getDayPeriod(time) + 3) / 7;
+}
+
+static void addToAggregate(SessionAggregate *aggregates, int count, uint32_t period, const MowingSession &session) {
+  SessionAggregate &aggregate = aggregates[period % count];
+  if(aggregate.period > period) {
+    // the clock was set back past this session
+    return;
+  }
+  if(aggregate.period != period) {
+    memset(&aggregate, 0, sizeof(aggregate));
+    aggregate.period = period;
+  }
+  aggregate.sessions++;
+  aggregate.triggers[session.trigger]++;
+  aggregate.endReasons[session.endReason]++;
+  aggregate.mowingSeconds += session.end - session.start;
+}
+
+static void copyAggregate(const SessionAggregate &aggregate, uint32_t period, SessionAggregate &copy) {
+  if(aggregate.period == period) {
+    copy = aggregate;
+  } else {
+    memset(&copy, 0, sizeof(copy));
+    copy.period = period;
+  }
+}
+
+static bool saveSessions() {
+  sessionsData.magic = sessionsMagic;
+  sessionsData.version = sessionsVersion;
+  sessionsData.crc = crc32(&sessionsData, offsetof(SessionsFile, crc));
+
+  File file = halFileSystem().open(sessionsTempPath, "w");
+  if(!file) {
+    LOG_ERROR("Failed to open file for writing: %s", sessionsTempPath);
+    return false;
+  }
+  bool written = file.write((const uint8_t *)&sessionsData, sizeof(sessionsData)) == sizeof(sessionsData);
+  file.close();
+  if(!written) {
+    LOG_ERROR("Failed to write to file: %s", sessionsTempPath);
+    halFileSystem().remove(sessionsTempPath);
+    return false;
+  }
+
+  halFileSystem().remove(sessionsPath);
+  if(!halFileSystem().rename(sessionsTempPath, sessionsPath)) {
+    LOG_ERROR("Failed to replace file: %s", sessionsPath);
+    return false;
+  }
+  return true;
+}
+
+static void loadSessions() {
+  if(halFileSystem().exists(sessionsTempPath) && !halFileSystem().exists(sessionsPath)) {
+    // cut after the old file was removed, the temp file is complete
+    halFileSystem().rename(sessionsTempPath, sessionsPath);
+  }
+  if(!halFileSystem().exists(sessionsPath)) {
+    return;
+  }
+  File file = halFileSystem().open(sessionsPath, "r");
+  if(!file) {
+    return;
+  }
+  SessionsFile loaded;
+  bool valid = file.read((uint8_t *)&loaded, sizeof(loaded)) == sizeof(loaded)
+    && loaded.magic == sessionsMagic && loaded.version == sessionsVersion
+    && loaded.sessionCount <= sessionHistorySize && loaded.crc == crc32(&loaded, offsetof(SessionsFile, crc));
+  file.close();
+  if(!valid) {
+    LOG_ERROR("Unknown format of %s, starting without mowing sessions", sessionsPath);
+    return;
+  }
+  sessionsData = loaded;
+}
+
+void initializeMowingSessions() {
+  std::lock_guard<std::mutex> guard(sessionsLock);
+  // padding included, so the crc of the file does not depend on it
+  memset(&sessionsData, 0, sizeof(sessionsData));
+  sessionActive = false;
+  loadSessions();
+}
+
+void beginMowingSession(SessionTrigger trigger) {
+  uint32_t now = 0;
+  getSessionTime(now);
+  std::lock_guard<std::mutex> guard(sessionsLock);
+  if(sessionActive) {
+    return;
+  }
+  sessionActive = true;
+  sessionStartedAt = halMillis();
+  memset(&currentSession, 0, sizeof(currentSession));
+  // 0 while the time is not set, dated back when the session ends
+  currentSession.start = now;
+  currentSession.trigger = trigger;
+  LOG_INFO("Mowing session started (%s)", sessionTriggerName(trigger));
+}
+
+void endMowingSession(SessionEndReason reason) {
+  uint32_t now;
+  bool timeSet = getSessionTime(now);
+  std::lock_guard<std::mutex> guard(sessionsLock);
+  if(!sessionActive) {
+    return;
+  }
+  sessionActive = false;
+  uint32_t seconds = (halMillis() - sessionStartedAt) / 1000;
+  if(!timeSet) {
+    LOG_ERROR("Mowing session ended while the time is not set, not recorded");
+    return;
+  }
+
+  MowingSession session = currentSession;
+  if(session.start == 0) {
+    session.start = now > seconds ? now - seconds : 0;
+  }
+  session.end = now > session.start ? now : session.start;
+  session.endReason = reason;
+
+  if(sessionsData.sessionCount == sessionHistorySize) {
+    memmove(sessionsData.sessions, sessionsData.sessions + 1, (sessionHistorySize - 1) * sizeof(MowingSession));
+    sessionsData.sessionCount--;
+  }
+  sessionsData.sessions[sessionsData.sessionCount++] = session;
+  addToAggregate(sessionsData.days, sessionDayCount, getDayPeriod(session.start), session);
+  addToAggregate(sessionsData.weeks, sessionWeekCount, getWeekPeriod(session.start), session);
+  LOG_INFO("Mowing session ended (%s), %u minutes", sessionEndReasonName(reason), (unsigned int)((session.end - session.start) / 60));
+  saveSessions();
+}
+
+bool isMowingSessionActive() {
+  std::lock_guard<std::mutex> guard(sessionsLock);
+  return sessionActive;
+}
+
+uint32_t getMowingSessionSeconds() {
+  std::lock_guard<std::mutex> guard(sessionsLock);
+  return sessionActive ? (halMillis() - sessionStartedAt) / 1000 : 0;
+}
+
+void getSessionSummary(SessionSummary &summary) {
+  uint32_t now = 0;
+  bool timeSet = getSessionTime(now);
+  std::lock_guard<std::mutex> guard(sessionsLock);
+  summary.active = sessionActive;
+  summary.current = currentSession;
+  summary.sessionCount = sessionsData.sessionCount;
+  memcpy(summary.sessions, sessionsData.sessions, sessionsData.sessionCount * sizeof(MowingSession));
+
+  if(!timeSet && sessionsData.sessionCount > 0) {
+    // the periods of the last session
+    now = sessionsData.sessions[sessionsData.sessionCount - 1].end;
+  }
+  uint32_t today = getDayPeriod(now);
+  for(int i = 0; i < sessionDayCount; i++) {
+    uint32_t period = today >= (uint32_t)i ? today - i : 0;
+    copyAggregate(sessionsData.days[period % sessionDayCount], period, summary.days[i]);
+  }
+  uint32_t week = getWeekPeriod(now);
+  for(int i = 0; i < sessionWeekCount; i++) {
+    uint32_t period = week >= (uint32_t)i ? week - i : 0;
+    copyAggregate(sessionsData.weeks[period % sessionWeekCount], period, summary.weeks[i]);
+  }
+}
+
+uint32_t getSessionDayStart(uint32_t day) {
+  return day * 86400;
+}
+
+uint32_t getSessionWeekStart(uint32_t week) {
+  return week > 0 ? getSessionDayStart(week * 7 - 3) : 0;
+}
+
+const char *sessionTriggerName(SessionTrigger trigger) {
+  switch(trigger) {
+    case SESSION_MANUAL: return "manual";
+    case SESSION_PLAN: return "plan";
+    case SESSION_NATIVE: return "native";
+  }
+  return "unknown";
+}
+
+const char *sessionEndReasonName(SessionEndReason reason) {
+  switch(reason) {
+    case SESSION_DOCKED: return "docked";
+    case SESSION_EMERGENCY: return "emergency";
+    case SESSION_TIMEOUT: return "timeout";
+  }
+  return "unknown";
+}
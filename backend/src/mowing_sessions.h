@@ -0,0 +1,72 @@
+#ifndef MOWING_SESSIONS_H
+#define MOWING_SESSIONS_H
+
+#include <stdint.h>
+
+// Mowing sessions, from leaving the docking station to coming back, as seen by
+// checkStateChangeInDockingOrOutside(). Every finished session is added to the aggregate of
+// its start day and week, so the summary never scans the sessions. The last sessions and the
+// aggregates of the last days and weeks are kept in RAM and saved to /sessions.bin after
+// every session. Times are local wall clock seconds since 1970 like the log.
+
+const int sessionHistorySize = 16;
+const int sessionDayCount = 7;
+const int sessionWeekCount = 4;
+// a session outside for longer ends as timeout
+const uint32_t maxSessionSeconds = 8UL * 60 * 60;
+
+enum SessionTrigger : uint8_t {
+  SESSION_MANUAL,
+  SESSION_PLAN,
+  // the mower left on its own schedule
+  SESSION_NATIVE
+};
+
+enum SessionEndReason : uint8_t {
+  SESSION_DOCKED,
+  SESSION_EMERGENCY,
+  SESSION_TIMEOUT
+};
+
+struct MowingSession {
+  uint32_t start;
+  uint32_t end;
+  SessionTrigger trigger;
+  SessionEndReason endReason;
+};
+
+struct SessionAggregate {
+  // day or week number since 1970, weeks start on monday
+  uint32_t period;
+  uint16_t sessions;
+  uint16_t triggers[3];
+  uint16_t endReasons[3];
+  uint32_t mowingSeconds;
+};
+
+struct SessionSummary {
+  bool active;
+  // the running session, end is 0
+  MowingSession current;
+  int sessionCount;
+  // oldest first
+  MowingSession sessions[sessionHistorySize];
+  // today and the days and weeks before, the current one first, zero for periods without sessions
+  SessionAggregate days[sessionDayCount];
+  SessionAggregate weeks[sessionWeekCount];
+};
+
+void initializeMowingSessions();
+void beginMowingSession(SessionTrigger trigger);
+void endMowingSession(SessionEndReason reason);
+bool isMowingSessionActive();
+// seconds the running session is outside, 0 without one
+uint32_t getMowingSessionSeconds();
+void getSessionSummary(SessionSummary &summary);
+// start of the period of an aggregate in seconds since 1970
+uint32_t getSessionDayStart(uint32_t day);
+uint32_t getSessionWeekStart(uint32_t week);
+const char *sessionTriggerName(SessionTrigger trigger);
+const char *sessionEndReasonName(SessionEndReason reason);
+
+#endif
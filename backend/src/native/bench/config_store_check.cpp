@@ -0,0 +1,138 @@
+// Checks the atomic writes of the settings files, config_store.h and wifi_credentials.h, on the RAM filesystem.
+// pio run -e native_config_store_check && .pio/build/native_config_store_check/program
+//
+// A store cut by a reset is replayed by leaving the files the way the cut would: the temp
+// file next to the old file, the temp file alone, complete or cut while the first version was
+// written, or a slot of /wifi.bin half written. Booting again has to give either the old or the
+// new content, or no file if there was none before. The access point name goes
+// through the same temp file and rename as the mowing plan. The exit code tells if all
+// checks passed.
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include "../../hal.h"
+#include "../../file_utils.h"
+#include "../../config_store.h"
+#include "../../wifi_credentials.h"
+
+static int failedChecks = 0;
+
+static void check(bool condition, const char *name, const std::string &detail) {
+  if(!condition) {
+    printf("FAILED %s %s\n", name, detail.c_str());
+    failedChecks++;
+  }
+}
+
+static void writeFile(const char *path, const char *content) {
+  File file = halFileSystem().open(path, "w");
+  file.print(content);
+  file.close();
+}
+
+static void checkApName(const char *name, const char *expected) {
+  check(getStoredApName() == expected, name, std::string("access point name is \"") + getStoredApName().c_str() + "\"");
+  check(!halFileSystem().exists("/ap.txt.tmp"), name, "the temp file is left");
+}
+
+static void checkConfigStore() {
+  initializeConfigStore();
+  check(getStoredApName().length() == 0 && !hasStoredMowingPlan(), "empty", "settings without files");
+
+  String etag = getConfigETag();
+  check(storeApName("RobotMower 1a2b"), "store", "access point name not written");
+  checkApName("store", "RobotMower 1a2b");
+  check(getConfigETag() != etag, "etag", "the ETag did not change with a store");
+
+  initializeConfigStore();
+  checkApName("reload", "RobotMower 1a2b");
+
+  // cut before the rename, the old file is still complete
+  writeFile("/ap.txt.tmp", "RobotMower 9999\n");
+  initializeConfigStore();
+  checkApName("cut before rename", "RobotMower 1a2b");
+
+  // cut after the old file was removed, the temp file is complete
+  halFileSystem().remove("/ap.txt");
+  writeFile("/ap.txt.tmp", "RobotMower 3c4d\n");
+  initializeConfigStore();
+  checkApName("cut after remove", "RobotMower 3c4d");
+  check(halFileSystem().exists("/ap.txt"), "cut after remove", "the temp file was not renamed");
+
+  // cut while the first version was written, there is no old file and the temp file is incomplete
+  halFileSystem().remove("/ap.txt");
+  writeFile("/ap.txt.tmp", "RobotMow");
+  initializeConfigStore();
+  checkApName("cut first write", "");
+  check(!halFileSystem().exists("/ap.txt"), "cut first write", "the incomplete temp file was renamed");
+  writeFile("/ap.txt.tmp", "");
+  initializeConfigStore();
+  checkApName("empty first write", "");
+
+  writeFile("/mowing_plan.json.tmp", "{\"customMowingPlanActive\":true,\"days\":[true,fal");
+  initializeConfigStore();
+  check(!hasStoredMowingPlan(), "cut first write", "a plan was read from the incomplete temp file");
+  check(!halFileSystem().exists("/mowing_plan.json") && !halFileSystem().exists("/mowing_plan.json.tmp"), "cut first write",
+    "the incomplete mowing plan was kept");
+}
+
+static void checkCredential(const char *name, const char *ssid, const char *password) {
+  WifiCredential credential;
+  bool found = findWifiCredential(ssid, credential);
+  check(found && strcmp(credential.password, password) == 0, name,
+    std::string(ssid) + (found ? std::string(" has password ") + credential.password : " is missing"));
+}
+
+static void checkWifiCredentials() {
+  initializeWifiCredentials();
+  WifiCredential credentials[maxWifiCredentials];
+  check(getWifiCredentials(credentials) == 0, "no networks", "credentials without /wifi.bin");
+
+  char ssid[maxWifiSsidLength + 1];
+  for(int i = 0; i < maxWifiCredentials; i++) {
+    snprintf(ssid, sizeof(ssid), "network-%d", i);
+    check(storeWifiCredential(ssid, "password") == WIFI_CREDENTIAL_STORED, "store", ssid);
+  }
+  check(storeWifiCredential("network-3", "password") == WIFI_CREDENTIAL_UNCHANGED, "unchanged", "a known network was written again");
+
+  // a new password replaces the one of the known network
+  check(storeWifiCredential("network-3", "new-password") == WIFI_CREDENTIAL_STORED, "new password", "not stored");
+  int count = getWifiCredentials(credentials);
+  check(count == maxWifiCredentials, "new password", std::to_string(count) + " networks instead of " + std::to_string(maxWifiCredentials));
+  check(strcmp(credentials[count - 1].ssid, "network-3") == 0, "new password", "the changed network is not the newest");
+
+  // a new network takes the slot of the oldest
+  check(storeWifiCredential("network-new", "password") == WIFI_CREDENTIAL_STORED, "full", "not stored");
+  check(!findWifiCredential("network-0", credentials[0]), "full", "the oldest network is still there");
+  check(getWifiCredentials(credentials) == maxWifiCredentials, "full", "the count changed");
+
+  initializeWifiCredentials();
+  check(getWifiCredentials(credentials) == maxWifiCredentials, "reload", "networks lost");
+  checkCredential("reload", "network-3", "new-password");
+  checkCredential("reload", "network-new", "password");
+
+  // a slot cut by a reset fails its crc and counts as empty, the others are kept
+  File file = halFileSystem().open("/wifi.bin", "r+");
+  file.seek(12 + 2 * 108 + 20);
+  file.write((const uint8_t *)"cut", 3);
+  file.close();
+  initializeWifiCredentials();
+  check(getWifiCredentials(credentials) == maxWifiCredentials - 1, "cut slot", "the damaged slot was not dropped");
+  checkCredential("cut slot", "network-new", "password");
+
+  // cut after the old file was removed, the temp file is complete
+  halFileSystem().rename("/wifi.bin", "/wifi.bin.tmp");
+  initializeWifiCredentials();
+  check(getWifiCredentials(credentials) == maxWifiCredentials - 1, "cut after remove", "networks lost");
+  check(halFileSystem().exists("/wifi.bin") && !halFileSystem().exists("/wifi.bin.tmp"), "cut after remove", "the temp file was not renamed");
+}
+
+int main() {
+  initializeFileSystem();
+  checkConfigStore();
+  checkWifiCredentials();
+
+  printf("%s\n", failedChecks == 0 ? "all checks passed" : "checks failed");
+  return failedChecks == 0 ? 0 : 1;
+}
@@ -0,0 +1,46 @@
+#include <string.h>
+#include "flash_image.h"
+
+FlashImage::FlashImage(size_t size, size_t sectorSize) : data(size, 0xff), sector(sectorSize) {
+  resetCounters();
+}
+
+bool FlashImage::read(size_t address, void *buffer, size_t length) {
+  if(address + length > data.size()) {
+    return false;
+  }
+  memcpy(buffer, data.data() + address, length);
+  count.reads++;
+  count.bytesRead += length;
+  return true;
+}
+
+bool FlashImage::program(size_t address, const void *buffer, size_t length) {
+  if(address + length > data.size()) {
+    return false;
+  }
+  const uint8_t *bytes = (const uint8_t *)buffer;
+  for(size_t i = 0; i < length; i++) {
+    data[address + i] &= bytes[i];
+  }
+  count.programs++;
+  count.bytesProgrammed += length;
+  return true;
+}
+
+bool FlashImage::erase(size_t address, size_t length) {
+  if(address % sector != 0 || length % sector != 0 || address + length > data.size()) {
+    return false;
+  }
+  memset(data.data() + address, 0xff, length);
+  count.erases += length / sector;
+  return true;
+}
+
+void FlashImage::wipe() {
+  memset(data.data(), 0xff, data.size());
+}
+
+void FlashImage::resetCounters() {
+  memset(&count, 0, sizeof(count));
+}
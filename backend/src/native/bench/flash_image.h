@@ -0,0 +1,43 @@
+#ifndef FLASH_IMAGE_H
+#define FLASH_IMAGE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// NOR flash in RAM, sized like the data partition: erasing sets a sector to 0xff,
+// programming can only clear bits. Counts the operations, as on the mower the flash
+// time dominates and the CPU time measured here does not show it.
+
+struct FlashCounters {
+  uint32_t reads;
+  uint32_t programs;
+  uint32_t erases;
+  uint64_t bytesRead;
+  uint64_t bytesProgrammed;
+};
+
+class FlashImage {
+  public:
+    FlashImage(size_t size = 0x100000, size_t sectorSize = 4096);
+
+    size_t size() const { return data.size(); }
+    size_t sectorSize() const { return sector; }
+
+    bool read(size_t address, void *buffer, size_t length);
+    bool program(size_t address, const void *buffer, size_t length);
+    // address and length are multiples of the sector size
+    bool erase(size_t address, size_t length);
+    // erases everything, like a new partition
+    void wipe();
+
+    const FlashCounters &counters() const { return count; }
+    void resetCounters();
+
+  private:
+    std::vector<uint8_t> data;
+    size_t sector;
+    FlashCounters count;
+};
+
+#endif
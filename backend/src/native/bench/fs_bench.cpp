@@ -0,0 +1,194 @@
+// Filesystem benchmark, SPIFFS against LittleFS on a RAM image of the data partition.
+// pio run -e native_fs_bench && .pio/build/native_fs_bench/program
+//
+// Runs the access patterns of the firmware through the Arduino fs::File API:
+// - append: the log writer, 1 KB batches with a flush into 16 KB segments, 4 segments kept
+// - open: the config store and the log reader opening files next to the log
+// - read: /log-messages reading the segments in 512 byte chunks
+// The times are CPU time on the build box, on the mower the flash operations dominate,
+// so each run also prints what it did to the flash.
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "flash_image.h"
+#include "littlefs_image.h"
+#include "spiffs_image.h"
+
+static const size_t partitionSize = 0x100000;
+static const size_t segmentSize = 16384;
+static const int segmentCount = 4;
+static const size_t batchSize = 1024;
+static const size_t appendedBytes = 2 * partitionSize;
+static const int openRepeats = 1000;
+static const int readRepeats = 50;
+static const size_t readChunkSize = 512;
+
+typedef std::chrono::steady_clock Clock;
+
+struct Timings {
+  std::vector<double> micros;
+
+  void add(Clock::time_point start) {
+    micros.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+  }
+
+  double percentile(double fraction) {
+    std::sort(micros.begin(), micros.end());
+    return micros.empty() ? 0 : micros[std::min(micros.size() - 1, (size_t)(fraction * micros.size()))];
+  }
+
+  double mean() {
+    double total = 0;
+    for(double value : micros) {
+      total += value;
+    }
+    return micros.empty() ? 0 : total / micros.size();
+  }
+};
+
+static void printTimings(const char *backend, const char *name, Timings &timings) {
+  printf("%-9s %-24s n=%-6u mean %8.1f us  p50 %8.1f us  p99 %8.1f us  max %9.1f us\n",
+    backend, name, (unsigned int)timings.micros.size(), timings.mean(), timings.percentile(0.5), timings.percentile(0.99), timings.percentile(1.0));
+}
+
+static void printFlash(const FlashImage &flash, unsigned int operations) {
+  const FlashCounters &counters = flash.counters();
+  printf("%-9s %-24s per op: %.1f reads (%.0f B), %.1f programs (%.0f B), %.3f erases\n", "", "  flash",
+    (double)counters.reads / operations, (double)counters.bytesRead / operations,
+    (double)counters.programs / operations, (double)counters.bytesProgrammed / operations,
+    (double)counters.erases / operations);
+}
+
+static void writeFile(fs::FS &fileSystem, const char *path, size_t size) {
+  std::vector<uint8_t> data(size, 'x');
+  File file = fileSystem.open(path, "w");
+  file.write(data.data(), data.size());
+  file.close();
+}
+
+// the files next to the log on the mower
+static void writeSettings(fs::FS &fileSystem) {
+  writeFile(fileSystem, "/mowing_plan.json", 600);
+  writeFile(fileSystem, "/wifi.bin", 1092);
+  writeFile(fileSystem, "/ap.txt", 20);
+  writeFile(fileSystem, "/log-formats.txt", 2048);
+}
+
+static String segmentPath(unsigned int segment) {
+  return "/log-" + String(segment) + ".txt";
+}
+
+// segment is the newest segment, the run continues after it
+static void benchmarkAppend(const char *backend, const char *name, fs::FS &fileSystem, FlashImage &flash, unsigned int &segment) {
+  std::vector<uint8_t> batch(batchSize, 'l');
+  batch[batchSize - 1] = '\n';
+  Timings timings;
+  size_t segmentBytes = segmentSize;
+
+  flash.resetCounters();
+  File file;
+  for(size_t written = 0; written < appendedBytes; written += batchSize) {
+    Clock::time_point start = Clock::now();
+    if(segmentBytes + batchSize > segmentSize) {
+      file.close();
+      segment++;
+      if(segment > segmentCount) {
+        fileSystem.remove(segmentPath(segment - segmentCount));
+      }
+      file = fileSystem.open(segmentPath(segment), "a");
+      segmentBytes = 0;
+    }
+    if(file.write(batch.data(), batch.size()) != batch.size()) {
+      printf("%-9s %-24s write failed after %u bytes\n", backend, name, (unsigned int)written);
+      break;
+    }
+    file.flush();
+    segmentBytes += batchSize;
+    timings.add(start);
+  }
+  file.close();
+
+  printTimings(backend, name, timings);
+  printFlash(flash, timings.micros.size());
+}
+
+static void benchmarkOpen(const char *backend, const char *name, fs::FS &fileSystem, FlashImage &flash, const char *path, const char *mode) {
+  Timings timings;
+  flash.resetCounters();
+  for(int i = 0; i < openRepeats; i++) {
+    Clock::time_point start = Clock::now();
+    File file = fileSystem.open(path, mode);
+    file.close();
+    timings.add(start);
+  }
+  printTimings(backend, name, timings);
+  printFlash(flash, openRepeats);
+}
+
+static void benchmarkRead(const char *backend, fs::FS &fileSystem, FlashImage &flash) {
+  std::vector<uint8_t> chunk(readChunkSize);
+  size_t totalBytes = 0;
+
+  // the newest segments, left by the append run
+  File root = fileSystem.open("/");
+  std::vector<String> segments;
+  for(File file = root.openNextFile(); file; file = root.openNextFile()) {
+    if(strncmp(file.name(), "log-", 4) == 0 && strcmp(file.name(), "log-formats.txt") != 0) {
+      segments.push_back(file.path());
+    }
+  }
+  root.close();
+
+  flash.resetCounters();
+  Clock::time_point start = Clock::now();
+  for(int i = 0; i < readRepeats; i++) {
+    for(const String &path : segments) {
+      File file = fileSystem.open(path, "r");
+      size_t count;
+      while((count = file.read(chunk.data(), chunk.size())) > 0) {
+        totalBytes += count;
+      }
+      file.close();
+    }
+  }
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  const FlashCounters &counters = flash.counters();
+  printf("%-9s %-24s %u KB in %u files: %8.1f MB/s, flash reads %.2f per KB (%.2f B read per B)\n",
+    backend, "read 512 B chunks", (unsigned int)(totalBytes / 1024), (unsigned int)segments.size(),
+    totalBytes / seconds / 1e6, counters.reads * 1024.0 / totalBytes, (double)counters.bytesRead / totalBytes);
+}
+
+template<class Image>
+static void runBenchmarks(const char *backend) {
+  FlashImage flash(partitionSize);
+  Image image(flash);
+  if(!image.mount(true)) {
+    printf("%-9s mount failed\n", backend);
+    return;
+  }
+  writeSettings(image);
+  unsigned int segment = 0;
+  benchmarkAppend(backend, "append 1 KB (empty)", image, flash, segment);
+
+  // the full partition makes the garbage collection work harder
+  writeFile(image, "/filler.bin", partitionSize / 2);
+  benchmarkAppend(backend, "append 1 KB (half full)", image, flash, segment);
+
+  benchmarkOpen(backend, "open settings", image, flash, "/mowing_plan.json", "r");
+  benchmarkOpen(backend, "open missing", image, flash, "/missing.json", "r");
+  benchmarkOpen(backend, "open log for append", image, flash, segmentPath(segment).c_str(), "a");
+  benchmarkRead(backend, image, flash);
+
+  printf("%-9s %-24s %u of %u KB used\n", backend, "usage", (unsigned int)(image.usedBytes() / 1024), (unsigned int)(image.totalBytes() / 1024));
+  image.unmount();
+}
+
+int main(int argc, char **argv) {
+  runBenchmarks<SpiffsImage>("SPIFFS");
+  runBenchmarks<LittleFSImage>("LittleFS");
+  return 0;
+}
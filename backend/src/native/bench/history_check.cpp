@@ -0,0 +1,248 @@
+// Checks the state history, state_history.h, against a model of the events recorded.
+// pio run -e native_history_check && .pio/build/native_history_check/program
+//
+// Records more events than the buffer holds with a set clock, including events from before
+// the time was set, and reads them back in pages of any size, with the state at from and
+// without events in range. Saving and loading is checked across processes: a child records
+// and saves, a fresh child loads /history.bin and has to read the same events, another one
+// gets a damaged file and has to start a new history. The exit code tells if all checks passed.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+#include "../../hal.h"
+#include "../../file_utils.h"
+#include "../../state_history.h"
+#include "../hal_native.h"
+
+typedef std::vector<HistoryEvent> Events;
+
+// 2024-06-01 00:00 in UTC
+static const uint32_t startTime = 1717200000;
+static const uint32_t eventSpacing = 600;
+// about 3 bytes each, more than historyBufferSize holds
+static const int recordedEvents = 3000;
+static const uint32_t endTime = startTime + recordedEvents * eventSpacing;
+
+static int failedChecks = 0;
+
+static void check(bool condition, const char *name, const std::string &detail) {
+  if(!condition) {
+    printf("FAILED %s %s\n", name, detail.c_str());
+    failedChecks++;
+  }
+}
+
+static std::string describeEvent(const HistoryEvent &event) {
+  return std::string(historyEventTypeName(event.type)) + " " + std::to_string(event.value) + " at " + std::to_string(event.time);
+}
+
+static bool sameEvent(const HistoryEvent &a, const HistoryEvent &b) {
+  return a.time == b.time && a.type == b.type && a.value == b.value;
+}
+
+static void checkEvents(const char *name, const Events &events, const Events &expected) {
+  check(events.size() == expected.size(), name, std::to_string(events.size()) + " events instead of " + std::to_string(expected.size()));
+  for(size_t i = 0; i < events.size() && i < expected.size(); i++) {
+    if(!sameEvent(events[i], expected[i])) {
+      check(false, name, "event " + std::to_string(i) + " is " + describeEvent(events[i]) + " instead of " + describeEvent(expected[i]));
+      return;
+    }
+  }
+}
+
+// all events from from to to, read in pages of pageSize like /history does
+static Events readHistory(uint32_t from, uint32_t to, int pageSize) {
+  Events events;
+  HistoryEvent page[64];
+  uint32_t cursor = 0;
+  int count;
+  while((count = readStateHistory(from, to, cursor, page, pageSize)) > 0) {
+    events.insert(events.end(), page, page + count);
+  }
+  return events;
+}
+
+static uint8_t getStateBits(const MowerSnapshot &snapshot) {
+  return (snapshot.isCharging ? historyCharging : 0) | (snapshot.isLocked ? historyLocked : 0)
+    | (snapshot.isEmergency ? historyEmergency : 0) | (snapshot.isIdle ? historyIdle : 0);
+}
+
+static HistoryEvent makeEvent(uint32_t time, HistoryEventType type, uint8_t value) {
+  HistoryEvent event;
+  event.time = time;
+  event.type = type;
+  event.value = value;
+  return event;
+}
+
+static void recordState(uint32_t time, bool charging, Events &recorded) {
+  MowerSnapshot snapshot;
+  memset(&snapshot, 0, sizeof(snapshot));
+  snapshot.isCharging = charging;
+  snapshot.isIdle = !charging;
+  recordStateHistory(snapshot);
+  recorded.push_back(makeEvent(time, HISTORY_STATE, getStateBits(snapshot)));
+}
+
+// what the history should give from from to to, the state at from first
+static Events getExpectedEvents(const Events &recorded, size_t firstKept, uint8_t baseState, uint32_t from, uint32_t to) {
+  Events expected;
+  uint8_t state = baseState;
+  bool stateAdded = false;
+  for(size_t i = firstKept; i < recorded.size() && recorded[i].time <= to; i++) {
+    if(recorded[i].time >= from) {
+      if(!stateAdded) {
+        expected.push_back(makeEvent(from, HISTORY_STATE, state));
+        stateAdded = true;
+      }
+      expected.push_back(recorded[i]);
+    }
+    if(recorded[i].type == HISTORY_STATE) {
+      state = recorded[i].value;
+    }
+  }
+  if(!stateAdded && from <= to) {
+    expected.push_back(makeEvent(from, HISTORY_STATE, state));
+  }
+  return expected;
+}
+
+// records and reads, then saves and hands the file and the events over to the parent
+static void recordHistory(FILE *handover) {
+  Events recorded;
+  setNativeLocalTime(0);
+  initializeStateHistory();
+  // dated back once the time is set
+  recorded.push_back(makeEvent(startTime, HISTORY_BOOT, 0));
+  recorded.push_back(makeEvent(startTime, HISTORY_STATE, getStateBits(getMowerSnapshot())));
+  setNativeLocalTime(startTime);
+  recordState(startTime, true, recorded);
+
+  bool charging = true;
+  for(int i = 1; i <= recordedEvents; i++) {
+    uint32_t time = startTime + i * eventSpacing;
+    setNativeLocalTime(time);
+    if(i % 5 == 0) {
+      recordCommandHistory(COMMAND_START);
+      recorded.push_back(makeEvent(time, HISTORY_COMMAND, COMMAND_START));
+    } else {
+      charging = !charging;
+      recordState(time, charging, recorded);
+    }
+  }
+
+  // the oldest events were dropped, their last state is the one before the first event kept
+  Events all = readHistory(0, UINT32_MAX, 64);
+  check(all.size() > 1 && all.size() - 1 < recorded.size(), "dropped", std::to_string(all.size()) + " events kept");
+  size_t firstKept = recorded.size() - (all.size() - 1);
+  uint8_t baseState = 0;
+  for(size_t i = 0; i < firstKept; i++) {
+    if(recorded[i].type == HISTORY_STATE) {
+      baseState = recorded[i].value;
+    }
+  }
+  checkEvents("all", all, getExpectedEvents(recorded, firstKept, baseState, 0, UINT32_MAX));
+
+  const int pageSizes[] = {1, 2, 3, 7};
+  for(int pageSize : pageSizes) {
+    checkEvents(("pages of " + std::to_string(pageSize)).c_str(), readHistory(0, UINT32_MAX, pageSize), all);
+  }
+
+  // between two events, the state at from is the one of the event before
+  uint32_t from = startTime + (recordedEvents - 40) * eventSpacing + eventSpacing / 2;
+  uint32_t to = from + 10 * eventSpacing;
+  checkEvents("range", readHistory(from, to, 3), getExpectedEvents(recorded, firstKept, baseState, from, to));
+  checkEvents("no events in range", readHistory(endTime + 60, endTime + 120, 3),
+    getExpectedEvents(recorded, firstKept, baseState, endTime + 60, endTime + 120));
+  check(readHistory(to, from, 3).empty(), "reversed range", "events from after to");
+
+  flushStateHistory();
+  File file = halFileSystem().open("/history.bin", "r");
+  std::vector<uint8_t> content(file.size());
+  check(!content.empty() && file.read(content.data(), content.size()) == content.size(), "save", "/history.bin not written");
+  file.close();
+
+  uint32_t sizes[2] = {(uint32_t)content.size(), (uint32_t)all.size()};
+  fwrite(sizes, sizeof(sizes), 1, handover);
+  fwrite(content.data(), 1, content.size(), handover);
+  fwrite(all.data(), sizeof(HistoryEvent), all.size(), handover);
+  fflush(handover);
+}
+
+// a fresh process boots with content as /history.bin
+static void loadHistory(const std::vector<uint8_t> &content, const Events &expected) {
+  File file = halFileSystem().open("/history.bin", "w");
+  file.write(content.data(), content.size());
+  file.close();
+
+  uint32_t bootTime = endTime + eventSpacing;
+  setNativeLocalTime(bootTime);
+  initializeStateHistory();
+  checkEvents("reload", readHistory(0, endTime, 64), expected);
+
+  bool booted = false;
+  for(const HistoryEvent &event : readHistory(bootTime, bootTime, 64)) {
+    booted = booted || event.type == HISTORY_BOOT;
+  }
+  check(booted, "reload", "the boot was not recorded");
+}
+
+// runs part in a child process with fresh statics, returns its failed checks
+template<typename Part>
+static int runChild(Part part) {
+  fflush(stdout);
+  pid_t child = fork();
+  if(child == 0) {
+    initializeFileSystem();
+    part();
+    fflush(stdout);
+    _exit(failedChecks > 0 ? 1 : 0);
+  }
+  int status;
+  if(child < 0 || waitpid(child, &status, 0) != child || !WIFEXITED(status)) {
+    return 1;
+  }
+  return WEXITSTATUS(status);
+}
+
+int main() {
+  // local time is the time of the events
+  setenv("TZ", "UTC", 1);
+  tzset();
+
+  FILE *handover = tmpfile();
+  failedChecks += runChild([handover]() { recordHistory(handover); });
+
+  uint32_t sizes[2] = {0, 0};
+  rewind(handover);
+  std::vector<uint8_t> content;
+  Events expected;
+  if(fread(sizes, sizeof(sizes), 1, handover) == 1) {
+    content.resize(sizes[0]);
+    expected.resize(sizes[1]);
+    if(fread(content.data(), 1, content.size(), handover) != content.size()
+      || fread(expected.data(), sizeof(HistoryEvent), expected.size(), handover) != expected.size()) {
+      content.clear();
+    }
+  }
+  fclose(handover);
+  check(!content.empty(), "handover", "no history from the recording process");
+
+  if(!content.empty()) {
+    failedChecks += runChild([&content, &expected]() { loadHistory(content, expected); });
+
+    // a damaged file fails its crc, the history starts over
+    std::vector<uint8_t> damaged = content;
+    damaged[damaged.size() / 2] ^= 0x55;
+    failedChecks += runChild([&damaged]() { loadHistory(damaged, Events()); });
+  }
+
+  printf("%s\n", failedChecks == 0 ? "all checks passed" : "checks failed");
+  return failedChecks == 0 ? 0 : 1;
+}
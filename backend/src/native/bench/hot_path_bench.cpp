@@ -0,0 +1,329 @@
+// Measures the hot paths of the backend on the build box, see the README.
+// pio run -e native_hot_path_bench && .pio/build/native_hot_path_bench/program [--save file] [--compare file] [--threshold percent]
+//
+// Every case runs in rounds of a calibrated number of calls, the result is the median time
+// per call of the rounds. --save writes the results as a json baseline, --compare reads one
+// and marks every case that got slower than the threshold (default 15%), the exit code tells
+// if there was a regression. Compare baselines of the same machine and build only.
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include "../../hal.h"
+#include "../../logger.h"
+#include "../../file_utils.h"
+#include "../../config_store.h"
+#include "../../mower.h"
+#include "../../status_json.h"
+#include "../../wifi_credentials.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static const double minRoundNs = 20e6;
+static const int roundCount = 7;
+// the logger's ring, flushed between the timed calls so they never hit a full ring
+static const int logBatchSize = 32;
+// a flush waits for the writer's next poll, so the log cases are not calibrated
+static const int logCallsPerRound = 8 * logBatchSize;
+
+struct BenchCase {
+  const char *name;
+  // runs the case count times, returns the time of the measured part in ns
+  double (*run)(int count);
+  // calls per round, 0 to calibrate them
+  int calls;
+};
+
+struct BenchResult {
+  std::string name;
+  double nsPerCall;
+};
+
+// the bench results, stdout gets the Serial output of the log writer
+static FILE *output = stdout;
+static volatile int sink = 0;
+
+template<typename Body>
+static double timeCalls(int count, Body body) {
+  Clock::time_point start = Clock::now();
+  for(int i = 0; i < count; i++) {
+    body(i);
+  }
+  return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+static double benchIsMowingTime(int count) {
+  return timeCalls(count, [](int i) { sink += isMowingTime(); });
+}
+
+template<int level>
+static double benchLog(int count) {
+  double elapsed = 0;
+  for(int done = 0; done < count; done += logBatchSize) {
+    int batch = std::min(logBatchSize, count - done);
+    elapsed += timeCalls(batch, [](int i) {
+      switch(level) {
+        case 0: LOG_ERROR("Bench message %d of %s", i, "hot_path_bench"); break;
+        case 1: LOG_INFO("Bench message %d of %s", i, "hot_path_bench"); break;
+        default: LOG_DEBUG("Bench message %d of %s", i, "hot_path_bench"); break;
+      }
+    });
+    flushLog();
+  }
+  return elapsed;
+}
+
+// hot_path_bench_quiet_log.cpp, LOG_DEBUG built with LOG_LEVEL 1
+void logQuietDebugMessage(int i);
+
+// a debug message compiled out, what it costs a firmware with a lower LOG_LEVEL
+static double benchLogDebugCompiledOut(int count) {
+  return timeCalls(count, [](int i) { logQuietDebugMessage(i); });
+}
+
+// the whole body in one window of about a TCP segment
+static double benchStatusJson(int count) {
+  StatusInputs inputs;
+  readStatusInputs(inputs, false, "");
+  uint8_t window[1436];
+  return timeCalls(count, [&inputs, &window](int i) {
+    JsonStreamCursor cursor = {0, 0};
+    sink += fillJsonWindow(window, sizeof(window), cursor, writeStatusJsonPart, &inputs);
+  });
+}
+
+// a poll of /status while nothing changed, answered with 304
+static double benchStatusVersion(int count) {
+  return timeCalls(count, [](int i) {
+    StatusInputs inputs;
+    readStatusInputs(inputs, false, "");
+    sink += updateStatusVersion(inputs);
+  });
+}
+
+static MowingPlan getBenchMowingPlan() {
+  MowingPlan plan;
+  plan.customMowingPlanActive = true;
+  for(int day = 0; day < 7; day++) {
+    plan.days[day] = true;
+    plan.windowCount[day] = 2;
+    plan.windows[day][0].startMinute = 9 * 60;
+    plan.windows[day][0].endMinute = 12 * 60;
+    plan.windows[day][1].startMinute = 14 * 60;
+    plan.windows[day][1].endMinute = 18 * 60 + 30;
+  }
+  return plan;
+}
+
+static double benchSaveMowingPlan(int count) {
+  MowingPlan plan = getBenchMowingPlan();
+  return timeCalls(count, [&plan](int i) {
+    // alternating, a plan equal to the stored one might be skipped some day
+    plan.windows[0][1].endMinute = 18 * 60 + 30 + (i & 1);
+    sink += saveMowingPlan(plan);
+  });
+}
+
+// reads and parses the settings files like at boot
+static double benchInitializeConfigStore(int count) {
+  return timeCalls(count, [](int i) {
+    initializeConfigStore();
+    sink += hasStoredMowingPlan();
+  });
+}
+
+// the plan kept in RAM, compiled into the schedule
+static double benchLoadMowingPlan(int count) {
+  return timeCalls(count, [](int i) { sink += loadMowingPlan().windowCount[0]; });
+}
+
+static void storeBenchWifiCredentials() {
+  char ssid[maxWifiSsidLength + 1];
+  for(int i = 0; i < maxWifiCredentials; i++) {
+    snprintf(ssid, sizeof(ssid), "bench-network-%d", i);
+    storeWifiCredential(ssid, "bench-password");
+  }
+}
+
+static double benchLoadWifiCredentials(int count) {
+  WifiCredential credentials[maxWifiCredentials];
+  return timeCalls(count, [&credentials](int i) {
+    initializeWifiCredentials();
+    sink += getWifiCredentials(credentials);
+  });
+}
+
+// a new network in the slot of the oldest
+static double benchStoreNewWifiCredential(int count) {
+  char ssid[maxWifiSsidLength + 1];
+  return timeCalls(count, [&ssid](int i) {
+    snprintf(ssid, sizeof(ssid), "new-network-%d", i);
+    sink += storeWifiCredential(ssid, "bench-password");
+  });
+}
+
+// a known network with a new password, rewrites its slot
+static double benchStoreChangedWifiCredential(int count) {
+  return timeCalls(count, [](int i) { sink += storeWifiCredential("bench-network-3", i & 1 ? "password-a" : "password-b"); });
+}
+
+// a known network with the same password, found and not written
+static double benchStoreKnownWifiCredential(int count) {
+  storeWifiCredential("bench-network-5", "bench-password");
+  return timeCalls(count, [](int i) { sink += storeWifiCredential("bench-network-5", "bench-password"); });
+}
+
+static const BenchCase benchCases[] = {
+  {"isMowingTime", benchIsMowingTime, 0},
+  {"logError", benchLog<0>, logCallsPerRound},
+  {"logInfo", benchLog<1>, logCallsPerRound},
+  {"logDebug", benchLog<2>, logCallsPerRound},
+  {"logDebugCompiledOut", benchLogDebugCompiledOut, 0},
+  {"statusJson", benchStatusJson, 0},
+  {"statusVersion", benchStatusVersion, 0},
+  {"saveMowingPlan", benchSaveMowingPlan, 0},
+  {"initializeConfigStore", benchInitializeConfigStore, 0},
+  {"loadMowingPlan", benchLoadMowingPlan, 0},
+  {"loadWifiCredentials", benchLoadWifiCredentials, 0},
+  {"storeNewWifiCredential", benchStoreNewWifiCredential, 0},
+  {"storeChangedWifiCredential", benchStoreChangedWifiCredential, 0},
+  {"storeKnownWifiCredential", benchStoreKnownWifiCredential, 0}
+};
+
+static double runCase(const BenchCase &benchCase) {
+  // doubles the calls until a round takes long enough to time, this is also the warm up
+  int count = benchCase.calls > 0 ? benchCase.calls : 1;
+  while(benchCase.run(count) < minRoundNs && benchCase.calls == 0 && count < (1 << 24)) {
+    count *= 2;
+  }
+  std::vector<double> rounds;
+  for(int i = 0; i < roundCount; i++) {
+    rounds.push_back(benchCase.run(count) / count);
+  }
+  std::sort(rounds.begin(), rounds.end());
+  return rounds[roundCount / 2];
+}
+
+static bool saveBaseline(const char *path, const std::vector<BenchResult> &results) {
+  FILE *file = fopen(path, "w");
+  if(!file) {
+    return false;
+  }
+  fprintf(file, "{\n  \"benchmarks\": [\n");
+  for(size_t i = 0; i < results.size(); i++) {
+    fprintf(file, "    {\"name\": \"%s\", \"nsPerCall\": %.1f}%s\n", results[i].name.c_str(), results[i].nsPerCall,
+      i + 1 < results.size() ? "," : "");
+  }
+  fprintf(file, "  ]\n}\n");
+  return fclose(file) == 0;
+}
+
+// reads what saveBaseline() writes, not any json
+static bool loadBaseline(const char *path, std::vector<BenchResult> &results) {
+  FILE *file = fopen(path, "r");
+  if(!file) {
+    return false;
+  }
+  char line[256];
+  while(fgets(line, sizeof(line), file)) {
+    char name[128];
+    double nsPerCall;
+    const char *entry = strstr(line, "{\"name\":");
+    if(entry && sscanf(entry, "{\"name\": \"%127[^\"]\", \"nsPerCall\": %lf", name, &nsPerCall) == 2) {
+      results.push_back({name, nsPerCall});
+    }
+  }
+  fclose(file);
+  return !results.empty();
+}
+
+static const BenchResult *findResult(const std::vector<BenchResult> &results, const std::string &name) {
+  for(const BenchResult &result : results) {
+    if(result.name == name) {
+      return &result;
+    }
+  }
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  const char *savePath = NULL;
+  const char *comparePath = NULL;
+  double threshold = 15;
+  for(int i = 1; i < argc; i++) {
+    if(strcmp(argv[i], "--save") == 0 && i + 1 < argc) {
+      savePath = argv[++i];
+    } else if(strcmp(argv[i], "--compare") == 0 && i + 1 < argc) {
+      comparePath = argv[++i];
+    } else if(strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+      threshold = atof(argv[++i]);
+    } else {
+      fprintf(stderr, "usage: %s [--save file] [--compare file] [--threshold percent]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  std::vector<BenchResult> baseline;
+  if(comparePath && !loadBaseline(comparePath, baseline)) {
+    fprintf(stderr, "Failed to read baseline %s\n", comparePath);
+    return 2;
+  }
+
+  // the log writer prints every line, keep that out of the results
+  fflush(stdout);
+  output = fdopen(dup(fileno(stdout)), "w");
+  if(!output || !freopen("/dev/null", "w", stdout)) {
+    fprintf(stderr, "Failed to redirect stdout\n");
+    return 2;
+  }
+
+  initializeFileSystem();
+  initializeLogger();
+  initializeConfigStore();
+  initializeWifiCredentials();
+  storeMowingPlan(getBenchMowingPlan());
+  loadMowingPlan();
+  storeBenchWifiCredentials();
+
+  std::vector<BenchResult> results;
+  int regressions = 0;
+  fprintf(output, "%-28s %12s", "case", "ns/call");
+  if(comparePath) {
+    fprintf(output, " %12s %9s", "baseline", "change");
+  }
+  fprintf(output, "\n");
+  for(const BenchCase &benchCase : benchCases) {
+    BenchResult result = {benchCase.name, runCase(benchCase)};
+    results.push_back(result);
+    fprintf(output, "%-28s %12.1f", result.name.c_str(), result.nsPerCall);
+    const BenchResult *previous = comparePath ? findResult(baseline, result.name) : NULL;
+    if(previous && previous->nsPerCall > 0) {
+      double change = (result.nsPerCall / previous->nsPerCall - 1) * 100;
+      bool regression = change > threshold;
+      regressions += regression;
+      fprintf(output, " %12.1f %+8.1f%%%s", previous->nsPerCall, change, regression ? "  REGRESSION" : "");
+    } else if(comparePath) {
+      fprintf(output, " %12s", "new");
+    }
+    fprintf(output, "\n");
+    fflush(output);
+  }
+  flushLog();
+
+  if(savePath) {
+    if(!saveBaseline(savePath, results)) {
+      fprintf(stderr, "Failed to write baseline %s\n", savePath);
+      return 2;
+    }
+    fprintf(output, "baseline saved to %s\n", savePath);
+  }
+  if(comparePath) {
+    fprintf(output, "%d regression(s) over %.0f%%\n", regressions, threshold);
+  }
+  return regressions > 0 ? 1 : 0;
+}
@@ -0,0 +1,12 @@
+// The debug log of hot_path_bench.cpp in a firmware built with -D LOG_LEVEL=1.
+// The bench itself is built with the default LOG_LEVEL 2, where all levels are formatted into
+// the log ring. Here LOG_DEBUG compiles to nothing, like in such a firmware.
+
+#undef LOG_LEVEL
+#define LOG_LEVEL 1
+#include "../../logger.h"
+
+// called from the other translation unit, so the call is timed and not folded away
+void logQuietDebugMessage(int i) {
+  LOG_DEBUG("Bench message %d of %s", i, "hot_path_bench");
+}
@@ -0,0 +1,268 @@
+#include <string.h>
+#include <string>
+#include <lfs.h>
+#include "littlefs_image.h"
+
+// as in esp_littlefs, which arduino-esp32 uses
+static const lfs_size_t littleFsReadSize = 128;
+static const lfs_size_t littleFsProgramSize = 128;
+static const lfs_size_t littleFsCacheSize = 512;
+static const lfs_size_t littleFsLookaheadSize = 128;
+static const int32_t littleFsBlockCycles = 512;
+
+struct LittleFSState {
+  FlashImage *flash;
+  lfs_config config;
+  lfs_t lfs;
+  bool mounted;
+};
+
+static int readBlock(const struct lfs_config *config, lfs_block_t block, lfs_off_t offset, void *buffer, lfs_size_t size) {
+  FlashImage *flash = (FlashImage *)config->context;
+  return flash->read(block * config->block_size + offset, buffer, size) ? 0 : LFS_ERR_IO;
+}
+
+static int programBlock(const struct lfs_config *config, lfs_block_t block, lfs_off_t offset, const void *buffer, lfs_size_t size) {
+  FlashImage *flash = (FlashImage *)config->context;
+  return flash->program(block * config->block_size + offset, buffer, size) ? 0 : LFS_ERR_IO;
+}
+
+static int eraseBlock(const struct lfs_config *config, lfs_block_t block) {
+  FlashImage *flash = (FlashImage *)config->context;
+  return flash->erase(block * config->block_size, config->block_size) ? 0 : LFS_ERR_IO;
+}
+
+static int syncFlash(const struct lfs_config *config) {
+  return 0;
+}
+
+static int getOpenFlags(const char *mode) {
+  bool plus = strchr(mode, '+') != NULL;
+  switch(mode[0]) {
+    case 'w':
+      return (plus ? LFS_O_RDWR : LFS_O_WRONLY) | LFS_O_CREAT | LFS_O_TRUNC;
+    case 'a':
+      return (plus ? LFS_O_RDWR : LFS_O_WRONLY) | LFS_O_CREAT | LFS_O_APPEND;
+    default:
+      return plus ? LFS_O_RDWR : LFS_O_RDONLY;
+  }
+}
+
+class LittleFSFileImpl : public fs::FileImpl {
+  public:
+    LittleFSFileImpl(std::shared_ptr<LittleFSState> state, const std::string &path, int flags)
+      : state(state), filePath(path), directory(false) {
+      open = lfs_file_open(&state->lfs, &file, path.c_str(), flags) >= 0;
+      setName();
+    }
+
+    // directory handle
+    LittleFSFileImpl(std::shared_ptr<LittleFSState> state, const std::string &path)
+      : state(state), filePath(path), directory(true) {
+      open = lfs_dir_open(&state->lfs, &dir, path.c_str()) >= 0;
+      setName();
+    }
+
+    ~LittleFSFileImpl() {
+      close();
+    }
+
+    size_t write(const uint8_t *buffer, size_t size) override {
+      if(!open || directory) {
+        return 0;
+      }
+      lfs_ssize_t written = lfs_file_write(&state->lfs, &file, buffer, size);
+      return written < 0 ? 0 : written;
+    }
+
+    size_t read(uint8_t *buffer, size_t size) override {
+      if(!open || directory) {
+        return 0;
+      }
+      lfs_ssize_t count = lfs_file_read(&state->lfs, &file, buffer, size);
+      return count < 0 ? 0 : count;
+    }
+
+    void flush() override {
+      if(open && !directory) {
+        lfs_file_sync(&state->lfs, &file);
+      }
+    }
+
+    bool seek(uint32_t position, fs::SeekMode mode) override {
+      if(!open || directory) {
+        return false;
+      }
+      int whence = mode == fs::SeekSet ? LFS_SEEK_SET : mode == fs::SeekCur ? LFS_SEEK_CUR : LFS_SEEK_END;
+      return lfs_file_seek(&state->lfs, &file, position, whence) >= 0;
+    }
+
+    size_t position() const override {
+      if(!open || directory) {
+        return 0;
+      }
+      lfs_soff_t position = lfs_file_tell(&state->lfs, &file);
+      return position < 0 ? 0 : position;
+    }
+
+    size_t size() const override {
+      if(!open || directory) {
+        return 0;
+      }
+      lfs_soff_t size = lfs_file_size(&state->lfs, &file);
+      return size < 0 ? 0 : size;
+    }
+
+    void close() override {
+      if(!open) {
+        return;
+      }
+      if(directory) {
+        lfs_dir_close(&state->lfs, &dir);
+      } else {
+        lfs_file_close(&state->lfs, &file);
+      }
+      open = false;
+    }
+
+    const char *path() const override { return filePath.c_str(); }
+    const char *name() const override { return fileName.c_str(); }
+    bool isDirectory() override { return directory; }
+    operator bool() override { return open; }
+
+    fs::FileImplPtr openNextFile(const char *mode) override {
+      if(!open || !directory) {
+        return fs::FileImplPtr();
+      }
+      struct lfs_info info;
+      while(lfs_dir_read(&state->lfs, &dir, &info) > 0) {
+        if(strcmp(info.name, ".") == 0 || strcmp(info.name, "..") == 0) {
+          continue;
+        }
+        std::string path = filePath == "/" ? "/" + std::string(info.name) : filePath + "/" + info.name;
+        if(info.type == LFS_TYPE_DIR) {
+          return std::make_shared<LittleFSFileImpl>(state, path);
+        }
+        return std::make_shared<LittleFSFileImpl>(state, path, getOpenFlags(mode));
+      }
+      return fs::FileImplPtr();
+    }
+
+  private:
+    void setName() {
+      size_t slash = filePath.find_last_of('/');
+      fileName = slash == std::string::npos ? filePath : filePath.substr(slash + 1);
+    }
+
+    std::shared_ptr<LittleFSState> state;
+    std::string filePath;
+    std::string fileName;
+    bool directory;
+    bool open;
+    // lfs takes non-const pointers also for tell and size
+    mutable lfs_file_t file;
+    lfs_dir_t dir;
+};
+
+class LittleFSImpl : public fs::FSImpl {
+  public:
+    LittleFSImpl(std::shared_ptr<LittleFSState> state) : state(state) {}
+
+    fs::FileImplPtr open(const char *path, const char *mode, bool create) override {
+      if(!state->mounted) {
+        return fs::FileImplPtr();
+      }
+      struct lfs_info info;
+      if(lfs_stat(&state->lfs, path, &info) >= 0 && info.type == LFS_TYPE_DIR) {
+        return std::make_shared<LittleFSFileImpl>(state, path);
+      }
+      std::shared_ptr<LittleFSFileImpl> file = std::make_shared<LittleFSFileImpl>(state, path, getOpenFlags(mode));
+      return *file ? file : fs::FileImplPtr();
+    }
+
+    bool exists(const char *path) override {
+      struct lfs_info info;
+      return state->mounted && lfs_stat(&state->lfs, path, &info) >= 0;
+    }
+
+    bool rename(const char *pathFrom, const char *pathTo) override {
+      return state->mounted && lfs_rename(&state->lfs, pathFrom, pathTo) >= 0;
+    }
+
+    bool remove(const char *path) override {
+      return state->mounted && lfs_remove(&state->lfs, path) >= 0;
+    }
+
+    bool mkdir(const char *path) override {
+      return state->mounted && lfs_mkdir(&state->lfs, path) >= 0;
+    }
+
+    bool rmdir(const char *path) override {
+      return remove(path);
+    }
+
+    std::shared_ptr<LittleFSState> fileSystemState() { return state; }
+
+  private:
+    std::shared_ptr<LittleFSState> state;
+};
+
+static std::shared_ptr<LittleFSState> createState(FlashImage &flash) {
+  std::shared_ptr<LittleFSState> state = std::make_shared<LittleFSState>();
+  memset(&state->config, 0, sizeof(state->config));
+  state->flash = &flash;
+  state->mounted = false;
+
+  lfs_config &config = state->config;
+  config.context = &flash;
+  config.read = readBlock;
+  config.prog = programBlock;
+  config.erase = eraseBlock;
+  config.sync = syncFlash;
+  config.read_size = littleFsReadSize;
+  config.prog_size = littleFsProgramSize;
+  config.block_size = flash.sectorSize();
+  config.block_count = flash.size() / flash.sectorSize();
+  config.block_cycles = littleFsBlockCycles;
+  config.cache_size = littleFsCacheSize;
+  config.lookahead_size = littleFsLookaheadSize;
+  return state;
+}
+
+LittleFSImage::LittleFSImage(FlashImage &flash) : fs::FS(std::make_shared<LittleFSImpl>(createState(flash))) {}
+
+bool LittleFSImage::mount(bool format) {
+  std::shared_ptr<LittleFSState> state = std::static_pointer_cast<LittleFSImpl>(impl)->fileSystemState();
+  if(state->mounted) {
+    return true;
+  }
+  if(lfs_mount(&state->lfs, &state->config) < 0) {
+    if(!format || lfs_format(&state->lfs, &state->config) < 0 || lfs_mount(&state->lfs, &state->config) < 0) {
+      return false;
+    }
+  }
+  state->mounted = true;
+  return true;
+}
+
+void LittleFSImage::unmount() {
+  std::shared_ptr<LittleFSState> state = std::static_pointer_cast<LittleFSImpl>(impl)->fileSystemState();
+  if(state->mounted) {
+    lfs_unmount(&state->lfs);
+    state->mounted = false;
+  }
+}
+
+size_t LittleFSImage::totalBytes() {
+  std::shared_ptr<LittleFSState> state = std::static_pointer_cast<LittleFSImpl>(impl)->fileSystemState();
+  return state->config.block_size * state->config.block_count;
+}
+
+size_t LittleFSImage::usedBytes() {
+  std::shared_ptr<LittleFSState> state = std::static_pointer_cast<LittleFSImpl>(impl)->fileSystemState();
+  if(!state->mounted) {
+    return 0;
+  }
+  lfs_ssize_t blocks = lfs_fs_size(&state->lfs);
+  return blocks < 0 ? 0 : blocks * state->config.block_size;
+}
@@ -0,0 +1,17 @@
+#ifndef LITTLEFS_IMAGE_H
+#define LITTLEFS_IMAGE_H
+
+#include <FS.h>
+#include "flash_image.h"
+
+// LittleFS on a FlashImage, configured like the arduino-esp32 LittleFS.
+class LittleFSImage : public fs::FS {
+  public:
+    LittleFSImage(FlashImage &flash);
+    bool mount(bool format);
+    void unmount();
+    size_t totalBytes();
+    size_t usedBytes();
+};
+
+#endif
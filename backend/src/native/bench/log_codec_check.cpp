@@ -0,0 +1,262 @@
+// Checks the binary log, log_codec.h, and reading it back through the logger built with LOG_BINARY.
+// pio run -e native_log_codec_check && .pio/build/native_log_codec_check/program
+//
+// Packs the arguments of every conversion with every length modifier, flags, width and precision,
+// and the line rendered from the packed arguments has to be what snprintf prints. Strings cut to
+// fit the slot, a record with an unknown format id and the time of decoded records are checked
+// too. Then a segment gets a broken record, readLogMessages() has to hand out the lines before it
+// and a cursor at the next segment, which reads on once the log rolled. The exit code tells if
+// all checks passed.
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include "../../hal.h"
+#include "../../file_utils.h"
+#include "../../logger.h"
+#include "../../log_codec.h"
+
+// the check results, stdout gets the Serial output of the log writer
+static FILE *output = stdout;
+static int failedChecks = 0;
+
+static void check(bool condition, const char *name, const std::string &detail) {
+  if(!condition) {
+    fprintf(output, "FAILED %s %s\n", name, detail.c_str());
+    failedChecks++;
+  }
+}
+
+// packed into a slot like the logger does, then rendered like a decoded record
+static std::string packAndFormat(size_t slotSize, size_t textSize, const char *format, va_list arguments) {
+  uint8_t packed[logSlotSize];
+  size_t length = packLogArguments(format, arguments, packed, slotSize);
+  char text[512];
+  size_t textLength = formatLogArguments(format, packed, length, text, textSize);
+  check(textLength == strlen(text), format, "returns " + std::to_string(textLength) + " for \"" + text + "\"");
+  return text;
+}
+
+static void checkFormat(const char *format, ...) __attribute__((format(printf, 1, 2)));
+static void checkFormat(const char *format, ...) {
+  va_list arguments;
+  va_list copy;
+  va_start(arguments, format);
+  va_copy(copy, arguments);
+  char expected[512];
+  vsnprintf(expected, sizeof(expected), format, copy);
+  std::string text = packAndFormat(logSlotSize, sizeof(expected), format, arguments);
+  va_end(copy);
+  va_end(arguments);
+  check(text == expected, format, "\"" + text + "\" instead of \"" + expected + "\"");
+}
+
+static std::string packCut(size_t slotSize, size_t textSize, const char *format, ...) {
+  va_list arguments;
+  va_start(arguments, format);
+  std::string text = packAndFormat(slotSize, textSize, format, arguments);
+  va_end(arguments);
+  return text;
+}
+
+static void checkConversions() {
+  checkFormat("%d %i %d %i", 0, -1, INT_MIN, INT_MAX);
+  checkFormat("%u %o %x %X", UINT_MAX, 8u, 0xbeefu, 0xbeefu);
+  checkFormat("%hhd %hhi %hhu %hho %hhx %hhX", 300, -129, 511, 255, 0x1ab, 0x1cd);
+  checkFormat("%hd %hi %hu %ho %hx %hX", 70000, -40000, 70000, 65535, 0x12345, 0x12345);
+  checkFormat("%ld %li %lu %lo %lx %lX", LONG_MIN, LONG_MAX, ULONG_MAX, 8ul, 0xfeedul, 0xfeedul);
+  checkFormat("%lld %lli %llu %llo %llx %llX", LLONG_MIN, LLONG_MAX, ULLONG_MAX, 8ull, 0xfeedfacecafeull, 0xfeedfacecafeull);
+  checkFormat("%zd %zi %zu %zo %zx %zX", (ptrdiff_t)-5, PTRDIFF_MAX, SIZE_MAX, (size_t)8, (size_t)0xabc, (size_t)0xabc);
+  checkFormat("%jd %ji %ju %jo %jx %jX", INTMAX_MIN, INTMAX_MAX, UINTMAX_MAX, (uintmax_t)8, (uintmax_t)0xabc, (uintmax_t)0xabc);
+  checkFormat("%td %ti %tu %tx", (ptrdiff_t)-123456789012LL, PTRDIFF_MIN, (size_t)42, (size_t)0xabc);
+  checkFormat("%c%c%c", 'a', ' ', '~');
+  checkFormat("%s|%s|", "text", "");
+  check(packCut(logSlotSize, 512, "%s", (const char *)NULL) == "(null)", "%s", "NULL string");
+  checkFormat("%f %F %e %E %g %G %a %A", 3.25, -0.5, 12345.678, -1e-10, 0.0001, 1e20, 1.0, -2.5);
+  checkFormat("%Lf %Le %Lg", (long double)2.5, (long double)-1e5, (long double)0.125);
+  checkFormat("%p %p", (void *)&output, (void *)0x1234);
+  checkFormat("100%% done, %d%% left %%", 7);
+}
+
+static void checkFlagsAndWidths() {
+  checkFormat("[%5d] [%-5d] [%05d] [%+d] [% d] [%+5d]", 42, 42, 42, 42, 42, -42);
+  checkFormat("[%#x] [%#o] [%#X] [%08.3f] [%-10.2e] [%+.0f]", 255u, 8u, 255u, 3.14159, 2.5, 2.5);
+  checkFormat("[%10s] [%-10s] [%.3s] [%8.2s]", "right", "left", "precision", "cut");
+  checkFormat("[%*d] [%-*d] [%.*f] [%*.*s] [%*d]", 6, 7, 6, 7, 2, 3.14159, 8, 3, "abcdef", -4, 9);
+  checkFormat("[%5c] [%-3c] [%20p]", 'x', 'y', (void *)0xbeef);
+  checkFormat("%s=%d (%.1f%%) %c %llu %hhu", "speed", -3, 99.44, 'k', 1ull << 40, 256 + 7);
+}
+
+static void checkCutStrings() {
+  std::string longText(300, 'x');
+  // two bytes of length are left of the slot
+  std::string text = packCut(logSlotSize, 512, "%s", longText.c_str());
+  check(text == longText.substr(0, logSlotSize - 2), "cut string", std::to_string(text.size()) + " characters");
+
+  // the string takes the slot, the integer behind it shows as "?"
+  text = packCut(logSlotSize, 512, "%s %d", longText.c_str(), 5);
+  check(text == longText.substr(0, logSlotSize - 2) + " ?", "cut arguments", "\"" + text.substr(logSlotSize - 6) + "\"");
+
+  // an integer that doesn't fit before the string
+  text = packCut(3, 512, "%d %s", 1 << 20, "abc");
+  check(text == "? ?", "cut integer", "\"" + text + "\"");
+
+  // rendered into a small buffer like snprintf
+  text = packCut(logSlotSize, 12, "%s and %d", "a longer text", 12345);
+  check(text == "a longer te", "small buffer", "\"" + text + "\"");
+}
+
+static void checkRecords() {
+  uint8_t stream[256];
+  size_t length = encodeLogSync(stream, 1717372800, 5000);
+  uint8_t arguments[16];
+  // 9 in zigzag
+  size_t argumentsLength = writeVarint(arguments, 18);
+  length += encodeLogRecord(stream + length, 0, 3, 1, arguments, argumentsLength);
+  length += encodeLogRecord(stream + length, 2500, 77, 2, arguments, argumentsLength);
+  size_t complete = length;
+  // a record cut by the end of the data
+  length += encodeLogRecord(stream + length, 10, 3, 1, arguments, argumentsLength) - 1;
+
+  LogDecoder decoder;
+  resetLogDecoder(decoder);
+  const uint8_t *position = stream;
+  std::vector<LogRecord> records;
+  LogRecord record;
+  while(decodeLogRecord(decoder, position, stream + length, record)) {
+    records.push_back(record);
+  }
+  check(records.size() == 3, "records", std::to_string(records.size()) + " records decoded");
+  check(position == stream + complete, "records", "stops " + std::to_string(position - stream) + " bytes in instead of " + std::to_string(complete));
+  if(records.size() != 3) {
+    return;
+  }
+  check(records[0].formatId == logSyncFormatId, "records", "no sync record first");
+  check(records[1].formatId == 3 && records[1].level == 1 && records[1].millis == 5000 && records[1].epochSeconds == 1717372800,
+    "records", "record at " + std::to_string(records[1].millis) + " ms, " + std::to_string(records[1].epochSeconds) + " s");
+  check(records[2].millis == 7500 && records[2].epochSeconds == 1717372802, "records",
+    "record at " + std::to_string(records[2].millis) + " ms, " + std::to_string(records[2].epochSeconds) + " s");
+
+  char line[128];
+  formatLogRecordLine(records[1], "value %d", line, sizeof(line));
+  check(std::string(line) == "[Mon, 24/06/03 00:00:00] value 9", "record line", line);
+  // a format id missing from the dictionary
+  formatLogRecordLine(records[2], NULL, line, sizeof(line));
+  check(std::string(line) == "[Mon, 24/06/03 00:00:02] <unknown log format 77>", "unknown format", line);
+  records[2].epochSeconds = 0;
+  size_t lineLength = formatLogRecordLine(records[2], NULL, line, 24);
+  check(lineLength == 23 && std::string(line) == "[Time unavailable] <unk", "unknown format", line);
+}
+
+// lines are only dropped when the ring is full, let the writer catch up now and then
+static void logLines(int from, int to, const std::string &payload) {
+  for(int i = from; i < to; i++) {
+    LOG_INFO("Codec line %d %s", i, payload.c_str());
+    if(i % 16 == 15) {
+      flushLog();
+    }
+  }
+  flushLog();
+}
+
+// the numbers of the lines read from since on, and the cursor and reset of the first read
+static std::vector<int> readLineNumbers(uint32_t since, uint32_t &cursor, bool &continued) {
+  std::vector<int> numbers;
+  char buffer[4096];
+  cursor = since;
+  for(bool first = true;; first = false) {
+    bool readContinued;
+    size_t length = readLogMessages(cursor, buffer, sizeof(buffer), cursor, readContinued);
+    if(first) {
+      continued = readContinued;
+    }
+    if(length == 0) {
+      break;
+    }
+    std::string text(buffer, length);
+    for(size_t start = 0, end; (end = text.find('\n', start)) != std::string::npos; start = end + 1) {
+      std::string line = text.substr(start, end - start);
+      size_t found = line.find("Codec line ");
+      if(found != std::string::npos) {
+        numbers.push_back(atoi(line.c_str() + found + 11));
+      }
+    }
+  }
+  return numbers;
+}
+
+static bool consecutive(const std::vector<int> &numbers, int first, int last) {
+  if(numbers.size() != (size_t)(last - first + 1)) {
+    return false;
+  }
+  for(size_t i = 0; i < numbers.size(); i++) {
+    if(numbers[i] != first + (int)i) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void checkBrokenRecord() {
+  initializeFileSystem();
+  initializeLogger();
+  std::string payload(120, 'p');
+  logLines(0, 40, payload);
+
+  // everything from the middle of the segment on can't be decoded
+  uint32_t endCursor = getLogEndCursor();
+  char path[24];
+  snprintf(path, sizeof(path), "/log-%u.bin", (unsigned int)(endCursor / logSegmentSize));
+  File file = halFileSystem().open(path, "r+");
+  size_t brokenAt = file.size() / 2;
+  file.seek(brokenAt);
+  std::vector<uint8_t> garbage(file.size() - brokenAt, 0xff);
+  file.write(garbage.data(), garbage.size());
+  file.close();
+
+  uint32_t cursor;
+  bool continued;
+  std::vector<int> numbers = readLineNumbers(0, cursor, continued);
+  check(continued, "broken record", "cursor 0 is gone");
+  check(!numbers.empty() && numbers.size() < 40 && consecutive(numbers, 0, numbers.back()), "broken record",
+    std::to_string(numbers.size()) + " lines before it");
+  uint32_t nextSegment = (endCursor / logSegmentSize + 1) * logSegmentSize;
+  check(cursor == nextSegment, "broken record", "cursor " + std::to_string(cursor) + " instead of " + std::to_string(nextSegment));
+
+  uint32_t waitingCursor;
+  numbers = readLineNumbers(cursor, waitingCursor, continued);
+  check(continued && numbers.empty() && waitingCursor == cursor, "broken record", "cursor " + std::to_string(cursor) + " doesn't wait");
+
+  // the lines still going to the broken segment are lost, the next segment reads on from the cursor
+  logLines(40, 200, payload);
+  check(getLogEndCursor() > nextSegment, "broken record", "the log didn't roll");
+  numbers = readLineNumbers(cursor, waitingCursor, continued);
+  check(continued, "broken record", "cursor " + std::to_string(cursor) + " starts over");
+  check(!numbers.empty() && numbers.front() > 40 && consecutive(numbers, numbers.front(), 199), "broken record",
+    "lines " + (numbers.empty() ? std::string("none") : std::to_string(numbers.front()) + " to " + std::to_string(numbers.back())) + " after it");
+  check(getDroppedLogMessages() == 0, "log", std::to_string(getDroppedLogMessages()) + " lines dropped");
+}
+
+int main() {
+  // the log writer prints every line, keep that out of the results
+  fflush(stdout);
+  output = fdopen(dup(fileno(stdout)), "w");
+  if(!output || !freopen("/dev/null", "w", stdout)) {
+    fprintf(stderr, "Failed to redirect stdout\n");
+    return 2;
+  }
+
+  checkConversions();
+  checkFlagsAndWidths();
+  checkCutStrings();
+  checkRecords();
+  checkBrokenRecord();
+
+  fprintf(output, "%s\n", failedChecks == 0 ? "all checks passed" : "checks failed");
+  return failedChecks == 0 ? 0 : 1;
+}
@@ -0,0 +1,136 @@
+// Checks the log ring of logger.cpp with several tasks logging at once.
+// pio run -e native_log_ring_check && .pio/build/native_log_ring_check/program
+//
+// Producer threads log numbered lines in bursts larger than the ring, so lines are dropped.
+// The log read back through readLogMessages() has to hold the lines of every thread in order,
+// each line intact, and every line logged has to be either in the log or counted as dropped,
+// with the "log messages dropped" lines adding up to the count. The exit code tells if all
+// checks passed.
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include "../../hal.h"
+#include "../../file_utils.h"
+#include "../../logger.h"
+
+static const int producerCount = 4;
+static const int linesPerProducer = 300;
+// a burst of all producers is more than logRingSlots, the writer drains the ring in the pauses
+static const int burstLines = 50;
+static const unsigned long burstPauseMs = logWriterPollMs + 10;
+static const size_t payloadLength = 24;
+
+// the check results, stdout gets the Serial output of the log writer
+static FILE *output = stdout;
+static int failedChecks = 0;
+
+static void check(bool condition, const char *name, const std::string &detail) {
+  if(!condition) {
+    fprintf(output, "FAILED %s %s\n", name, detail.c_str());
+    failedChecks++;
+  }
+}
+
+// a torn slot would mix the payloads of two producers
+static std::string producerPayload(int producer) {
+  return std::string(payloadLength, 'a' + producer);
+}
+
+static void runProducer(int producer) {
+  std::string payload = producerPayload(producer);
+  for(int line = 0; line < linesPerProducer; line++) {
+    LOG_INFO("ring %d line %d %s", producer, line, payload.c_str());
+    if((line + 1) % burstLines == 0) {
+      halDelay(burstPauseMs);
+    }
+  }
+}
+
+// all lines on flash, read in chunks like /log-messages does
+static std::vector<std::string> readLog() {
+  std::vector<std::string> lines;
+  char buffer[4096];
+  uint32_t since = 0;
+  for(;;) {
+    uint32_t cursor;
+    bool continued;
+    size_t length = readLogMessages(since, buffer, sizeof(buffer), cursor, continued);
+    check(continued, "read", "cursor " + std::to_string(since) + " is gone");
+    if(length == 0) {
+      break;
+    }
+
+    size_t start = 0;
+    for(size_t i = 0; i < length; i++) {
+      if(buffer[i] == '\n') {
+        lines.push_back(std::string(buffer + start, i - start));
+        start = i + 1;
+      }
+    }
+    check(start == length, "read", "chunk ends within a line at cursor " + std::to_string(cursor));
+    since = cursor;
+  }
+  return lines;
+}
+
+int main() {
+  // the log writer prints every line, keep that out of the results
+  fflush(stdout);
+  output = fdopen(dup(fileno(stdout)), "w");
+  if(!output || !freopen("/dev/null", "w", stdout)) {
+    fprintf(stderr, "Failed to redirect stdout\n");
+    return 2;
+  }
+
+  initializeFileSystem();
+  initializeLogger();
+
+  std::vector<std::thread> producers;
+  for(int producer = 0; producer < producerCount; producer++) {
+    producers.push_back(std::thread(runProducer, producer));
+  }
+  for(std::thread &producer : producers) {
+    producer.join();
+  }
+  flushLog();
+
+  int nextLine[producerCount] = {};
+  int written = 0;
+  unsigned long reportedDrops = 0;
+  for(const std::string &line : readLog()) {
+    // behind the time stamp
+    size_t textStart = line.find("] ");
+    std::string text = textStart == std::string::npos ? line : line.substr(textStart + 2);
+    int producer;
+    int number;
+    char payload[64];
+    unsigned int dropped;
+    if(sscanf(text.c_str(), "ring %d line %d %63s", &producer, &number, payload) == 3 && producer >= 0 && producer < producerCount) {
+      check(number >= nextLine[producer], "order",
+        "producer " + std::to_string(producer) + " line " + std::to_string(number) + " after line " + std::to_string(nextLine[producer] - 1));
+      check(payload == producerPayload(producer), "payload", line);
+      nextLine[producer] = number + 1;
+      written++;
+    } else if(sscanf(text.c_str(), "%u log messages dropped", &dropped) == 1) {
+      reportedDrops += dropped;
+    } else {
+      check(text == "Initialized Log.", "line", line);
+    }
+  }
+
+  int logged = producerCount * linesPerProducer;
+  uint32_t dropped = getDroppedLogMessages();
+  check(written + dropped == (uint32_t)logged, "complete",
+    std::to_string(written) + " lines written and " + std::to_string(dropped) + " dropped of " + std::to_string(logged));
+  check(reportedDrops == dropped, "drop count", std::to_string(reportedDrops) + " reported instead of " + std::to_string(dropped));
+  check(dropped > 0, "drop count", "no line was dropped, the bursts fit in the ring");
+  check(written >= (int)logRingSlots, "complete", "only " + std::to_string(written) + " lines written");
+
+  fprintf(output, "%d lines written, %u dropped\n", written, (unsigned int)dropped);
+  fprintf(output, "%s\n", failedChecks == 0 ? "all checks passed" : "checks failed");
+  return failedChecks == 0 ? 0 : 1;
+}
@@ -0,0 +1,220 @@
+// Checks the rotating log segments of logger.cpp and the cursors into them.
+// pio run -e native_log_segments_check && .pio/build/native_log_segments_check/program
+//
+// Starts with the single /log-messages.txt of older versions, whose last lines have to become
+// segment 0. Then logs until the log wrapped around all segments. Read back in chunks through
+// readLogMessages() the lines have to follow each other without a gap, also from the cursors taken
+// every 50 lines, while a cursor into a removed segment has to start over at the oldest line.
+// A read without a cursor has to start at a whole line near the end. The exit code tells if
+// all checks passed.
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include "../../hal.h"
+#include "../../file_utils.h"
+#include "../../logger.h"
+
+// more than one segment, so only its tail is kept
+static const int legacyLines = 600;
+// about five segments, the first ones are removed again
+static const int loggedLines = 2000;
+static const int cursorSpacing = 50;
+static const size_t readChunkSize = 4096;
+
+// the check results, stdout gets the Serial output of the log writer
+static FILE *output = stdout;
+static int failedChecks = 0;
+
+static void check(bool condition, const char *name, const std::string &detail) {
+  if(!condition) {
+    fprintf(output, "FAILED %s %s\n", name, detail.c_str());
+    failedChecks++;
+  }
+}
+
+struct LogRead {
+  std::vector<std::string> lines;
+  bool continued;
+  uint32_t cursor;
+};
+
+// everything from since on, read in chunks like /log-messages does
+static LogRead readLog(uint32_t since) {
+  LogRead result = {{}, true, since};
+  char buffer[readChunkSize];
+  for(bool first = true;; first = false) {
+    bool continued;
+    size_t length = readLogMessages(result.cursor, buffer, sizeof(buffer), result.cursor, continued);
+    if(first) {
+      result.continued = continued;
+    }
+    if(length == 0) {
+      break;
+    }
+
+    size_t start = 0;
+    for(size_t i = 0; i < length; i++) {
+      if(buffer[i] == '\n') {
+        result.lines.push_back(std::string(buffer + start, i - start));
+        start = i + 1;
+      }
+    }
+    check(start == length, "read", "chunk ends within a line at cursor " + std::to_string(result.cursor));
+  }
+  return result;
+}
+
+// the number of a logged line behind its time stamp, -1 for other lines
+static int lineNumber(const std::string &line, const char *prefix) {
+  size_t textStart = line.find("] ");
+  std::string text = textStart == std::string::npos ? line : line.substr(textStart + 2);
+  int number;
+  char end;
+  std::string format = std::string(prefix) + " %d%c";
+  if(sscanf(text.c_str(), format.c_str(), &number, &end) != 2 || end != '.') {
+    return -1;
+  }
+  return number;
+}
+
+// the logged lines from first on, without gaps and without other lines in between
+static void checkLines(const char *name, const std::vector<std::string> &lines, const char *prefix, int first, int last) {
+  int expected = first;
+  for(const std::string &line : lines) {
+    int number = lineNumber(line, prefix);
+    if(number < 0) {
+      continue;
+    }
+    if(number != expected) {
+      check(false, name, "line " + std::to_string(number) + " instead of " + std::to_string(expected) + ": " + line);
+      return;
+    }
+    expected++;
+  }
+  check(expected == last + 1, name, "last line " + std::to_string(expected - 1) + " instead of " + std::to_string(last));
+}
+
+static int countLogSegments() {
+  int count = 0;
+  File root = halFileSystem().open("/");
+  for(File file = root.openNextFile(); file; file = root.openNextFile()) {
+    uint32_t segment;
+    count += parseLogSegmentName(file.name(), segment);
+  }
+  return count;
+}
+
+static void writeLegacyLog() {
+  File file = halFileSystem().open("/log-messages.txt", "w");
+  for(int i = 0; i < legacyLines; i++) {
+    char line[96];
+    int length = snprintf(line, sizeof(line), "[Mon, 24/06/03 08:00:00] Legacy line %d.\n", i);
+    file.write((const uint8_t *)line, length);
+  }
+  file.close();
+}
+
+static void checkLegacyLog() {
+  check(!halFileSystem().exists("/log-messages.txt"), "legacy log", "/log-messages.txt still exists");
+  File segment = halFileSystem().open("/log-0.txt", "r");
+  check(segment && segment.size() <= logSegmentSize, "legacy log", "segment 0 holds " + std::to_string(segment ? segment.size() : 0) + " bytes");
+
+  LogRead read = readLog(0);
+  check(read.continued, "legacy log", "cursor 0 is gone");
+  int first = read.lines.empty() ? -1 : lineNumber(read.lines[0], "Legacy line");
+  check(first > 0, "legacy log", "starts with " + (read.lines.empty() ? std::string("nothing") : read.lines[0]));
+  checkLines("legacy log", read.lines, "Legacy line", first, legacyLines - 1);
+}
+
+// lines are only dropped when the ring is full, let the writer catch up now and then
+static void logLines(int from, int to) {
+  for(int i = from; i < to; i++) {
+    LOG_INFO("Segment line %d.", i);
+    if(i % 32 == 31) {
+      flushLog();
+    }
+  }
+  flushLog();
+}
+
+static void checkTail(const char *name, int last) {
+  LogRead read = readLog(getLogTailCursor(readChunkSize));
+  size_t bytes = 0;
+  for(const std::string &line : read.lines) {
+    bytes += line.size() + 1;
+  }
+  check(!read.lines.empty() && lineNumber(read.lines.back(), "Segment line") == last, name,
+    "ends with " + (read.lines.empty() ? std::string("nothing") : read.lines.back()));
+  check(bytes <= readChunkSize && bytes + 2 * logSlotSize > readChunkSize, name, std::to_string(bytes) + " bytes");
+  int first = read.lines.empty() ? -1 : lineNumber(read.lines[0], "Segment line");
+  check(first >= 0, name, "starts within a line: " + (read.lines.empty() ? std::string("nothing") : read.lines[0]));
+  checkLines(name, read.lines, "Segment line", first, last);
+}
+
+int main() {
+  // the log writer prints every line, keep that out of the results
+  fflush(stdout);
+  output = fdopen(dup(fileno(stdout)), "w");
+  if(!output || !freopen("/dev/null", "w", stdout)) {
+    fprintf(stderr, "Failed to redirect stdout\n");
+    return 2;
+  }
+
+  initializeFileSystem();
+  writeLegacyLog();
+  initializeLogger();
+  flushLog();
+  checkLegacyLog();
+
+  // cursors into every segment, the first ones are removed by the end
+  std::vector<uint32_t> cursors;
+  for(int from = 0; from < loggedLines; from += cursorSpacing) {
+    cursors.push_back(getLogEndCursor());
+    logLines(from, from + cursorSpacing);
+    if(from + cursorSpacing == loggedLines / 2) {
+      checkTail("tail", loggedLines / 2 - 1);
+    }
+  }
+  check(getDroppedLogMessages() == 0, "log", std::to_string(getDroppedLogMessages()) + " lines dropped");
+
+  uint32_t endCursor = getLogEndCursor();
+  check(endCursor / logSegmentSize >= logSegmentCount, "wrap", "the log ends in segment " + std::to_string(endCursor / logSegmentSize));
+  check(countLogSegments() == (int)logSegmentCount, "wrap", std::to_string(countLogSegments()) + " segments");
+  uint32_t oldestSegment = endCursor / logSegmentSize - logSegmentCount + 1;
+
+  // from the oldest segment kept to the end, without a gap at the segment starts
+  LogRead all = readLog(0);
+  check(!all.continued, "oldest", "cursor 0 still reads on");
+  check(all.cursor == endCursor, "oldest", "stops at " + std::to_string(all.cursor) + " instead of " + std::to_string(endCursor));
+  int oldest = all.lines.empty() ? -1 : lineNumber(all.lines[0], "Segment line");
+  check(oldest > 100, "oldest", "starts with " + (all.lines.empty() ? std::string("nothing") : all.lines[0]));
+  checkLines("oldest", all.lines, "Segment line", oldest, loggedLines - 1);
+
+  // a cursor into a removed segment starts over at the oldest line, the others read on from their line
+  int removedCursors = 0;
+  for(size_t i = 0; i < cursors.size(); i++) {
+    std::string name = "cursor " + std::to_string(cursors[i]);
+    LogRead read = readLog(cursors[i]);
+    if(cursors[i] / logSegmentSize < oldestSegment) {
+      removedCursors++;
+      check(!read.continued, name.c_str(), "reads on in removed segment " + std::to_string(cursors[i] / logSegmentSize));
+      checkLines(name.c_str(), read.lines, "Segment line", oldest, loggedLines - 1);
+    } else {
+      check(read.continued, name.c_str(), "starts over in segment " + std::to_string(cursors[i] / logSegmentSize));
+      checkLines(name.c_str(), read.lines, "Segment line", i * cursorSpacing, loggedLines - 1);
+    }
+  }
+  check(removedCursors > 0 && removedCursors < (int)cursors.size(), "cursors", std::to_string(removedCursors) + " of "
+    + std::to_string(cursors.size()) + " point into removed segments");
+
+  LogRead end = readLog(endCursor);
+  check(end.continued && end.lines.empty(), "end cursor", std::to_string(end.lines.size()) + " lines");
+
+  checkTail("tail after wrap", loggedLines - 1);
+
+  fprintf(output, "%s\n", failedChecks == 0 ? "all checks passed" : "checks failed");
+  return failedChecks == 0 ? 0 : 1;
+}
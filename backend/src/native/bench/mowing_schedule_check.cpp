@@ -0,0 +1,173 @@
+// Checks the compiled mowing schedule, mowing_schedule.cpp, against a naive evaluator.
+// pio run -e native_mowing_schedule_check && .pio/build/native_mowing_schedule_check/program
+//
+// The evaluator walks the windows of the plan for every minute of the week, with no
+// interval table and no bitmap. isScheduledMinute(), findMowingInterval() and
+// getNextMowingTransition() have to agree with it on all 10080 minutes, for hand written
+// plans with windows over midnight and from sunday into monday, and for random plans of up
+// to 4 windows a day like the mowing plan holds. The exit code tells if all checks passed.
+
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include "mowing_schedule.h"
+
+struct Window {
+  int weekday;
+  int startMinute;
+  int endMinute;
+};
+
+typedef std::vector<Window> Plan;
+
+static int failedChecks = 0;
+
+static void check(bool condition, const char *name, const std::string &detail) {
+  if(!condition) {
+    printf("FAILED %s %s\n", name, detail.c_str());
+    failedChecks++;
+  }
+}
+
+static bool isInWindow(const Window &window, int minuteOfWeek) {
+  if(window.startMinute == window.endMinute) {
+    return false;
+  }
+  int length = (window.endMinute - window.startMinute + minutesPerDay) % minutesPerDay;
+  int sinceStart = (minuteOfWeek - (window.weekday * minutesPerDay + window.startMinute) + minutesPerWeek) % minutesPerWeek;
+  return sinceStart < length;
+}
+
+static bool isNaiveScheduled(const Plan &plan, int minuteOfWeek) {
+  for(const Window &window : plan) {
+    if(isInWindow(window, minuteOfWeek)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static std::string describeMinute(const char *planName, int minuteOfWeek) {
+  char text[80];
+  char time[6];
+  formatTimeOfDay(minuteOfWeek % minutesPerDay, time);
+  snprintf(text, sizeof(text), "%s, minute %d (day %d %s)", planName, minuteOfWeek, minuteOfWeek / minutesPerDay, time);
+  return text;
+}
+
+static void checkPlan(const char *planName, const Plan &plan) {
+  MowingSchedule schedule;
+  clearMowingSchedule(schedule);
+  for(const Window &window : plan) {
+    addMowingWindow(schedule, window.weekday, window.startMinute, window.endMinute);
+  }
+  finalizeMowingSchedule(schedule);
+
+  std::vector<bool> scheduled(minutesPerWeek);
+  for(int minute = 0; minute < minutesPerWeek; minute++) {
+    scheduled[minute] = isNaiveScheduled(plan, minute);
+  }
+  // the minutes whose state differs from the minute before, around the week
+  std::vector<int> transitions;
+  for(int minute = 0; minute < minutesPerWeek; minute++) {
+    if(scheduled[minute] != scheduled[(minute + minutesPerWeek - 1) % minutesPerWeek]) {
+      transitions.push_back(minute);
+    }
+  }
+
+  for(int i = 0; i < schedule.intervalCount; i++) {
+    const MowingInterval &interval = schedule.intervals[i];
+    bool valid = interval.start < interval.end && interval.end <= minutesPerWeek;
+    // merged intervals neither overlap nor touch
+    valid = valid && (i == 0 || schedule.intervals[i - 1].end < interval.start);
+    check(valid, "intervals", std::string(planName) + ", interval " + std::to_string(i) + " is " +
+      std::to_string(interval.start) + "-" + std::to_string(interval.end));
+  }
+
+  for(int minute = 0; minute < minutesPerWeek; minute++) {
+    bool expected = scheduled[minute];
+    if(isScheduledMinute(schedule, minute) != expected) {
+      check(false, "isScheduledMinute", describeMinute(planName, minute));
+    }
+
+    int index = findMowingInterval(schedule, minute);
+    bool found = index >= 0 && index < schedule.intervalCount &&
+      schedule.intervals[index].start <= minute && minute < schedule.intervals[index].end;
+    if(expected ? !found : index != -1) {
+      check(false, "findMowingInterval", describeMinute(planName, minute) + " gave " + std::to_string(index));
+    }
+
+    int expectedTransition = -1;
+    if(!transitions.empty()) {
+      std::vector<int>::const_iterator next = std::upper_bound(transitions.begin(), transitions.end(), minute);
+      expectedTransition = next != transitions.end() ? *next : transitions.front() + minutesPerWeek;
+    }
+    int transition = getNextMowingTransition(schedule, minute);
+    if(transition != expectedTransition) {
+      check(false, "getNextMowingTransition", describeMinute(planName, minute) + " gave " +
+        std::to_string(transition) + " instead of " + std::to_string(expectedTransition));
+    }
+  }
+
+  check(!isScheduledMinute(schedule, -1) && !isScheduledMinute(schedule, minutesPerWeek), "out of week", planName);
+}
+
+static Plan getEveryDayPlan(int startMinute, int endMinute) {
+  Plan plan;
+  for(int day = 0; day < 7; day++) {
+    plan.push_back({day, startMinute, endMinute});
+  }
+  return plan;
+}
+
+// random days with up to 4 windows each, a fifth of them over midnight
+static Plan getRandomPlan() {
+  Plan plan;
+  for(int day = 0; day < 7; day++) {
+    int windowCount = rand() % 5;
+    for(int i = 0; i < windowCount; i++) {
+      int startMinute = rand() % minutesPerDay;
+      int endMinute = rand() % 5 == 0 ? rand() % minutesPerDay : startMinute + 1 + rand() % (minutesPerDay - startMinute);
+      plan.push_back({day, startMinute, endMinute % minutesPerDay});
+    }
+  }
+  return plan;
+}
+
+int main() {
+  checkPlan("empty", {});
+  checkPlan("one window", {{2, 9 * 60, 12 * 60}});
+  checkPlan("one minute", {{0, 0, 1}});
+  checkPlan("last minute", {{6, minutesPerDay - 1, 0}});
+  checkPlan("every day", getEveryDayPlan(9 * 60, 18 * 60 + 30));
+  checkPlan("wednesday night", {{2, 22 * 60, 2 * 60}});
+  checkPlan("sunday night", {{6, 23 * 60, 3 * 60}});
+  checkPlan("sunday night into monday", {{6, 22 * 60, 0}, {0, 0, 60}});
+  checkPlan("one minute into monday", {{6, 23 * 60, 1}});
+  checkPlan("sunday night over monday", {{6, 20 * 60, 6 * 60}, {0, 5 * 60, 8 * 60}, {0, 12 * 60, 13 * 60}});
+  checkPlan("every night", getEveryDayPlan(22 * 60, 5 * 60));
+  checkPlan("whole week in halves", {
+    {0, 0, 12 * 60}, {0, 12 * 60, 0}, {1, 0, 12 * 60}, {1, 12 * 60, 0}, {2, 0, 12 * 60}, {2, 12 * 60, 0},
+    {3, 0, 12 * 60}, {3, 12 * 60, 0}, {4, 0, 12 * 60}, {4, 12 * 60, 0}, {5, 0, 12 * 60}, {5, 12 * 60, 0},
+    {6, 0, 12 * 60}, {6, 12 * 60, 0}});
+  // 23 hours from every noon, the gaps closed by the windows of the next noon
+  Plan overMidnight = getEveryDayPlan(13 * 60, 12 * 60);
+  for(const Window &window : getEveryDayPlan(12 * 60, 13 * 60)) {
+    overMidnight.push_back(window);
+  }
+  checkPlan("whole week over midnight", overMidnight);
+  checkPlan("touching and overlapping", {{3, 8 * 60, 10 * 60}, {3, 10 * 60, 11 * 60}, {3, 9 * 60, 9 * 60 + 30}, {3, 23 * 60, 8 * 60}});
+
+  // same plans on every run, a failure can be reproduced
+  srand(4711);
+  char name[32];
+  for(int i = 0; i < 500; i++) {
+    snprintf(name, sizeof(name), "random plan %d", i);
+    checkPlan(name, getRandomPlan());
+  }
+
+  printf("%s\n", failedChecks == 0 ? "all checks passed" : "checks failed");
+  return failedChecks == 0 ? 0 : 1;
+}
@@ -0,0 +1,97 @@
+// Checks when the deadline scheduler, scheduler.h, wakes the loop.
+// pio run -e native_scheduler_check && .pio/build/native_scheduler_check/program
+//
+// runScheduler() runs on the main thread like loop() does. A job rescheduling itself must not
+// wake the loop an extra time, so every pass has to run a job. A job moved to an earlier
+// deadline by another thread has to wake the sleeping loop at once, one moved past the deadline
+// the loop sleeps toward must not wake it. The exit code tells if all checks passed.
+
+#include <atomic>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include "../../hal.h"
+#include "../../scheduler.h"
+
+static int failedChecks = 0;
+
+static void check(bool condition, const char *name, const std::string &detail) {
+  if(!condition) {
+    printf("FAILED %s %s\n", name, detail.c_str());
+    failedChecks++;
+  }
+}
+
+static std::atomic<int> jobRuns(0);
+static int selfJob = -1;
+
+static void countRun() {
+  jobRuns++;
+}
+
+// keeps the loop from sleeping for minutes if a wake up goes wrong
+static void runWatchdog() {
+}
+
+static void runSelfJob() {
+  jobRuns++;
+  rescheduleJob(selfJob, 20);
+}
+
+// one pass of the loop, returns the jobs it ran
+static int runPass() {
+  int before = jobRuns;
+  runScheduler();
+  return jobRuns - before;
+}
+
+static void checkSelfRescheduling() {
+  selfJob = addScheduledJob("self", runSelfJob, 0);
+  int idlePasses = 0;
+  for(int pass = 0; pass < 10; pass++) {
+    idlePasses += runPass() == 0;
+  }
+  cancelJob(selfJob);
+  check(idlePasses == 0, "self rescheduling", std::to_string(idlePasses) + " of 10 passes woke up without a job due");
+}
+
+static void checkWakeups() {
+  int watchdogJob = addScheduledJob("watchdog", runWatchdog, 3000, 3000);
+  int farJob = addScheduledJob("far", countRun, 0, 5000);
+  int nearJob = addScheduledJob("near", countRun, 0, 300);
+
+  // moved before the deadline the loop sleeps toward, from another task
+  std::thread earlier([farJob] {
+    halDelay(30);
+    rescheduleJob(farJob, 0);
+  });
+  unsigned long startedAt = halMillis();
+  runPass();
+  unsigned long elapsed = halMillis() - startedAt;
+  earlier.join();
+  check(elapsed < 150, "earlier deadline", "woke up after " + std::to_string(elapsed) + " ms");
+
+  // the loop runs it, then sleeps toward the near job. Moved past that, it must not wake the loop
+  std::thread later([farJob] {
+    halDelay(30);
+    rescheduleJob(farJob, 2000);
+  });
+  startedAt = halMillis();
+  int ran = runPass();
+  elapsed = halMillis() - startedAt;
+  later.join();
+  check(ran == 1, "earlier deadline", std::to_string(ran) + " jobs ran");
+  check(elapsed >= 150, "later deadline", "woke up after " + std::to_string(elapsed) + " ms");
+
+  cancelJob(farJob);
+  cancelJob(nearJob);
+  cancelJob(watchdogJob);
+}
+
+int main() {
+  checkSelfRescheduling();
+  checkWakeups();
+
+  printf("%s\n", failedChecks == 0 ? "all checks passed" : "checks failed");
+  return failedChecks == 0 ? 0 : 1;
+}
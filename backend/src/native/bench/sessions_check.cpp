@@ -0,0 +1,162 @@
+// Checks the mowing sessions, mowing_sessions.h, against totals summed up from all sessions recorded.
+// pio run -e native_sessions_check && .pio/build/native_sessions_check/program
+//
+// Records sessions over twelve weeks with a set clock, with days and weeks without sessions in
+// between, so the day and week aggregates are reused. After every session the summary has to
+// show the last sessions and the totals of the last days and weeks, also after loading
+// /sessions.bin again, a damaged file has to start empty. The exit code tells if all checks passed.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "../../hal.h"
+#include "../../file_utils.h"
+#include "../../mowing_sessions.h"
+#include "../hal_native.h"
+
+typedef std::vector<MowingSession> Sessions;
+
+// monday 2024-06-03 00:00 in UTC
+static const uint32_t startTime = 1717372800;
+static const uint32_t secondsPerDay = 86400;
+
+static int failedChecks = 0;
+
+static void check(bool condition, const char *name, const std::string &detail) {
+  if(!condition) {
+    printf("FAILED %s %s\n", name, detail.c_str());
+    failedChecks++;
+  }
+}
+
+// the aggregate of period from all sessions, not from the buckets
+static SessionAggregate sumSessions(const Sessions &sessions, bool weeks, uint32_t period) {
+  SessionAggregate aggregate;
+  memset(&aggregate, 0, sizeof(aggregate));
+  aggregate.period = period;
+  for(const MowingSession &session : sessions) {
+    uint32_t day = session.start / secondsPerDay;
+    if((weeks ? (day + 3) / 7 : day) != period) {
+      continue;
+    }
+    aggregate.sessions++;
+    aggregate.triggers[session.trigger]++;
+    aggregate.endReasons[session.endReason]++;
+    aggregate.mowingSeconds += session.end - session.start;
+  }
+  return aggregate;
+}
+
+static bool sameAggregate(const SessionAggregate &a, const SessionAggregate &b) {
+  return a.period == b.period && a.sessions == b.sessions && a.mowingSeconds == b.mowingSeconds
+    && memcmp(a.triggers, b.triggers, sizeof(a.triggers)) == 0 && memcmp(a.endReasons, b.endReasons, sizeof(a.endReasons)) == 0;
+}
+
+static std::string describeAggregate(const SessionAggregate &aggregate) {
+  return "period " + std::to_string(aggregate.period) + ", " + std::to_string(aggregate.sessions) + " sessions, "
+    + std::to_string(aggregate.mowingSeconds) + " s";
+}
+
+static void checkSummary(const char *name, const Sessions &recorded, uint32_t now) {
+  SessionSummary summary;
+  getSessionSummary(summary);
+  check(!summary.active, name, "a session is still active");
+
+  size_t expectedCount = recorded.size() < (size_t)sessionHistorySize ? recorded.size() : sessionHistorySize;
+  check(summary.sessionCount == (int)expectedCount, name, std::to_string(summary.sessionCount) + " sessions instead of " + std::to_string(expectedCount));
+  for(int i = 0; i < summary.sessionCount && i < (int)expectedCount; i++) {
+    const MowingSession &expected = recorded[recorded.size() - expectedCount + i];
+    const MowingSession &session = summary.sessions[i];
+    if(session.start != expected.start || session.end != expected.end || session.trigger != expected.trigger || session.endReason != expected.endReason) {
+      check(false, name, "session " + std::to_string(i) + " from " + std::to_string(session.start) + " instead of " + std::to_string(expected.start));
+      break;
+    }
+  }
+
+  uint32_t today = now / secondsPerDay;
+  for(int i = 0; i < sessionDayCount; i++) {
+    SessionAggregate expected = sumSessions(recorded, false, today - i);
+    check(sameAggregate(summary.days[i], expected), name, "day " + std::to_string(i) + ": " + describeAggregate(summary.days[i])
+      + " instead of " + describeAggregate(expected));
+  }
+  uint32_t week = (today + 3) / 7;
+  for(int i = 0; i < sessionWeekCount; i++) {
+    SessionAggregate expected = sumSessions(recorded, true, week - i);
+    check(sameAggregate(summary.weeks[i], expected), name, "week " + std::to_string(i) + ": " + describeAggregate(summary.weeks[i])
+      + " instead of " + describeAggregate(expected));
+  }
+}
+
+static void recordSession(uint32_t start, uint32_t end, SessionTrigger trigger, SessionEndReason reason, Sessions &recorded) {
+  setNativeLocalTime(start);
+  beginMowingSession(trigger);
+  check(isMowingSessionActive(), "begin", "no active session at " + std::to_string(start));
+  setNativeLocalTime(end);
+  endMowingSession(reason);
+  MowingSession session = {start, end, trigger, reason};
+  recorded.push_back(session);
+}
+
+int main() {
+  // local time is the time of the sessions
+  setenv("TZ", "UTC", 1);
+  tzset();
+  initializeFileSystem();
+  initializeMowingSessions();
+
+  Sessions recorded;
+  srand(4711);
+  for(int day = 0; day < 84; day++) {
+    // a week off in the third week, and five weeks off later, longer than the weeks kept
+    if((day >= 14 && day < 21) || (day >= 35 && day < 70) || rand() % 4 == 0) {
+      continue;
+    }
+    int sessions = 1 + rand() % 3;
+    uint32_t time = startTime + day * secondsPerDay + 8 * 3600;
+    for(int i = 0; i < sessions; i++) {
+      uint32_t start = time + rand() % 3600;
+      uint32_t end = start + 600 + rand() % 7200;
+      recordSession(start, end, (SessionTrigger)(rand() % 3), (SessionEndReason)(rand() % 3), recorded);
+      time = end;
+    }
+    checkSummary(("day " + std::to_string(day)).c_str(), recorded, time + 60);
+  }
+
+  // the summary of a later day, the days without sessions are empty
+  uint32_t now = recorded.back().end + 3 * secondsPerDay;
+  setNativeLocalTime(now);
+  checkSummary("days later", recorded, now);
+
+  initializeMowingSessions();
+  checkSummary("reload", recorded, now);
+
+  // begun before the time was set, dated back when it ends
+  setNativeLocalTime(0);
+  beginMowingSession(SESSION_NATIVE);
+  setNativeLocalTime(now);
+  endMowingSession(SESSION_DOCKED);
+  MowingSession session = {now, now, SESSION_NATIVE, SESSION_DOCKED};
+  recorded.push_back(session);
+  checkSummary("time set later", recorded, now);
+
+  // ended before the time was set, not recorded
+  beginMowingSession(SESSION_MANUAL);
+  setNativeLocalTime(0);
+  endMowingSession(SESSION_EMERGENCY);
+  setNativeLocalTime(now);
+  checkSummary("time not set", recorded, now);
+
+  // a damaged file fails its crc, the sessions start over
+  File file = halFileSystem().open("/sessions.bin", "r+");
+  file.seek(20);
+  file.write((const uint8_t *)"cut", 3);
+  file.close();
+  initializeMowingSessions();
+  checkSummary("damaged file", Sessions(), now);
+
+  printf("%s\n", failedChecks == 0 ? "all checks passed" : "checks failed");
+  return failedChecks == 0 ? 0 : 1;
+}
@@ -0,0 +1,270 @@
+#include <string.h>
+#include <string>
+#include <vector>
+extern "C" {
+#include <spiffs.h>
+#include <spiffs_nucleus.h>
+}
+#include "spiffs_image.h"
+
+// as in the ESP-IDF spiffs component, with the arduino-esp32 default of 10 open files
+static const u32_t spiffsPageSize = 256;
+static const int spiffsMaxOpenFiles = 10;
+
+struct SpiffsState {
+  FlashImage *flash;
+  spiffs fs;
+  spiffs_config config;
+  std::vector<u8_t> work;
+  std::vector<u8_t> fileDescriptors;
+  std::vector<u8_t> cache;
+  bool mounted;
+};
+
+static s32_t readFlash(struct spiffs_t *fs, u32_t address, u32_t size, u8_t *buffer) {
+  FlashImage *flash = (FlashImage *)fs->user_data;
+  return flash->read(address, buffer, size) ? SPIFFS_OK : SPIFFS_ERR_INTERNAL;
+}
+
+static s32_t programFlash(struct spiffs_t *fs, u32_t address, u32_t size, u8_t *buffer) {
+  FlashImage *flash = (FlashImage *)fs->user_data;
+  return flash->program(address, buffer, size) ? SPIFFS_OK : SPIFFS_ERR_INTERNAL;
+}
+
+static s32_t eraseFlash(struct spiffs_t *fs, u32_t address, u32_t size) {
+  FlashImage *flash = (FlashImage *)fs->user_data;
+  return flash->erase(address, size) ? SPIFFS_OK : SPIFFS_ERR_INTERNAL;
+}
+
+static spiffs_flags getOpenFlags(const char *mode) {
+  bool plus = strchr(mode, '+') != NULL;
+  switch(mode[0]) {
+    case 'w':
+      return (plus ? SPIFFS_O_RDWR : SPIFFS_O_WRONLY) | SPIFFS_O_CREAT | SPIFFS_O_TRUNC;
+    case 'a':
+      return (plus ? SPIFFS_O_RDWR : SPIFFS_O_WRONLY) | SPIFFS_O_CREAT | SPIFFS_O_APPEND;
+    default:
+      return plus ? SPIFFS_O_RDWR : SPIFFS_O_RDONLY;
+  }
+}
+
+class SpiffsFileImpl : public fs::FileImpl {
+  public:
+    SpiffsFileImpl(std::shared_ptr<SpiffsState> state, const std::string &path, spiffs_flags flags)
+      : state(state), filePath(path), directory(false) {
+      handle = SPIFFS_open(&state->fs, path.c_str(), flags, 0);
+      open = handle >= 0;
+      setName();
+    }
+
+    // directory handle, spiffs is flat, so only the root
+    SpiffsFileImpl(std::shared_ptr<SpiffsState> state, const std::string &path)
+      : state(state), filePath(path), directory(true), handle(-1) {
+      open = SPIFFS_opendir(&state->fs, path.c_str(), &dir) != NULL;
+      setName();
+    }
+
+    ~SpiffsFileImpl() {
+      close();
+    }
+
+    size_t write(const uint8_t *buffer, size_t size) override {
+      if(!open || directory) {
+        return 0;
+      }
+      s32_t written = SPIFFS_write(&state->fs, handle, (void *)buffer, size);
+      return written < 0 ? 0 : written;
+    }
+
+    size_t read(uint8_t *buffer, size_t size) override {
+      if(!open || directory) {
+        return 0;
+      }
+      s32_t count = SPIFFS_read(&state->fs, handle, buffer, size);
+      return count < 0 ? 0 : count;
+    }
+
+    void flush() override {
+      if(open && !directory) {
+        SPIFFS_fflush(&state->fs, handle);
+      }
+    }
+
+    bool seek(uint32_t position, fs::SeekMode mode) override {
+      if(!open || directory) {
+        return false;
+      }
+      int whence = mode == fs::SeekSet ? SPIFFS_SEEK_SET : mode == fs::SeekCur ? SPIFFS_SEEK_CUR : SPIFFS_SEEK_END;
+      return SPIFFS_lseek(&state->fs, handle, position, whence) >= 0;
+    }
+
+    size_t position() const override {
+      if(!open || directory) {
+        return 0;
+      }
+      s32_t position = SPIFFS_tell(&state->fs, handle);
+      return position < 0 ? 0 : position;
+    }
+
+    size_t size() const override {
+      if(!open || directory) {
+        return 0;
+      }
+      spiffs_stat stat;
+      return SPIFFS_fstat(&state->fs, handle, &stat) < 0 ? 0 : stat.size;
+    }
+
+    void close() override {
+      if(!open) {
+        return;
+      }
+      if(directory) {
+        SPIFFS_closedir(&dir);
+      } else {
+        SPIFFS_close(&state->fs, handle);
+      }
+      open = false;
+    }
+
+    const char *path() const override { return filePath.c_str(); }
+    const char *name() const override { return fileName.c_str(); }
+    bool isDirectory() override { return directory; }
+    operator bool() override { return open; }
+
+    fs::FileImplPtr openNextFile(const char *mode) override {
+      if(!open || !directory) {
+        return fs::FileImplPtr();
+      }
+      struct spiffs_dirent entry;
+      if(SPIFFS_readdir(&dir, &entry) == NULL) {
+        return fs::FileImplPtr();
+      }
+      return std::make_shared<SpiffsFileImpl>(state, std::string((const char *)entry.name), getOpenFlags(mode));
+    }
+
+  private:
+    void setName() {
+      size_t slash = filePath.find_last_of('/');
+      fileName = slash == std::string::npos ? filePath : filePath.substr(slash + 1);
+    }
+
+    std::shared_ptr<SpiffsState> state;
+    std::string filePath;
+    std::string fileName;
+    bool directory;
+    bool open;
+    spiffs_file handle;
+    spiffs_DIR dir;
+};
+
+class SpiffsImpl : public fs::FSImpl {
+  public:
+    SpiffsImpl(std::shared_ptr<SpiffsState> state) : state(state) {}
+
+    fs::FileImplPtr open(const char *path, const char *mode, bool create) override {
+      if(!state->mounted) {
+        return fs::FileImplPtr();
+      }
+      if(strcmp(path, "/") == 0) {
+        return std::make_shared<SpiffsFileImpl>(state, path);
+      }
+      std::shared_ptr<SpiffsFileImpl> file = std::make_shared<SpiffsFileImpl>(state, path, getOpenFlags(mode));
+      return *file ? file : fs::FileImplPtr();
+    }
+
+    bool exists(const char *path) override {
+      spiffs_stat stat;
+      return state->mounted && SPIFFS_stat(&state->fs, path, &stat) >= 0;
+    }
+
+    bool rename(const char *pathFrom, const char *pathTo) override {
+      return state->mounted && SPIFFS_rename(&state->fs, pathFrom, pathTo) >= 0;
+    }
+
+    bool remove(const char *path) override {
+      return state->mounted && SPIFFS_remove(&state->fs, path) >= 0;
+    }
+
+    // flat namespace
+    bool mkdir(const char *path) override { return true; }
+    bool rmdir(const char *path) override { return true; }
+
+    std::shared_ptr<SpiffsState> fileSystemState() { return state; }
+
+  private:
+    std::shared_ptr<SpiffsState> state;
+};
+
+static std::shared_ptr<SpiffsState> createState(FlashImage &flash) {
+  std::shared_ptr<SpiffsState> state = std::make_shared<SpiffsState>();
+  memset(&state->fs, 0, sizeof(state->fs));
+  memset(&state->config, 0, sizeof(state->config));
+  state->flash = &flash;
+  state->mounted = false;
+  state->fs.user_data = &flash;
+
+  spiffs_config &config = state->config;
+  config.hal_read_f = readFlash;
+  config.hal_write_f = programFlash;
+  config.hal_erase_f = eraseFlash;
+  config.phys_size = flash.size();
+  config.phys_addr = 0;
+  config.phys_erase_block = flash.sectorSize();
+  config.log_block_size = flash.sectorSize();
+  config.log_page_size = spiffsPageSize;
+
+  state->work.resize(2 * spiffsPageSize);
+  state->fileDescriptors.resize(spiffsMaxOpenFiles * sizeof(spiffs_fd));
+  state->cache.resize(sizeof(spiffs_cache) + spiffsMaxOpenFiles * (sizeof(spiffs_cache_page) + spiffsPageSize));
+  return state;
+}
+
+static s32_t mountState(SpiffsState &state) {
+  return SPIFFS_mount(&state.fs, &state.config, state.work.data(),
+    state.fileDescriptors.data(), state.fileDescriptors.size(), state.cache.data(), state.cache.size(), NULL);
+}
+
+SpiffsImage::SpiffsImage(FlashImage &flash) : fs::FS(std::make_shared<SpiffsImpl>(createState(flash))) {}
+
+bool SpiffsImage::mount(bool format) {
+  std::shared_ptr<SpiffsState> state = std::static_pointer_cast<SpiffsImpl>(impl)->fileSystemState();
+  if(state->mounted) {
+    return true;
+  }
+  if(mountState(*state) < 0) {
+    // like esp_spiffs: format the configured, unmounted filesystem and mount again
+    if(!format || SPIFFS_format(&state->fs) < 0 || mountState(*state) < 0) {
+      return false;
+    }
+  }
+  state->mounted = true;
+  return true;
+}
+
+void SpiffsImage::unmount() {
+  std::shared_ptr<SpiffsState> state = std::static_pointer_cast<SpiffsImpl>(impl)->fileSystemState();
+  if(state->mounted) {
+    SPIFFS_unmount(&state->fs);
+    state->mounted = false;
+  }
+}
+
+size_t SpiffsImage::totalBytes() {
+  std::shared_ptr<SpiffsState> state = std::static_pointer_cast<SpiffsImpl>(impl)->fileSystemState();
+  u32_t total = 0;
+  u32_t used = 0;
+  if(!state->mounted || SPIFFS_info(&state->fs, &total, &used) < 0) {
+    return 0;
+  }
+  return total;
+}
+
+size_t SpiffsImage::usedBytes() {
+  std::shared_ptr<SpiffsState> state = std::static_pointer_cast<SpiffsImpl>(impl)->fileSystemState();
+  u32_t total = 0;
+  u32_t used = 0;
+  if(!state->mounted || SPIFFS_info(&state->fs, &total, &used) < 0) {
+    return 0;
+  }
+  return used;
+}
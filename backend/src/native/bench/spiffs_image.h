@@ -0,0 +1,17 @@
+#ifndef SPIFFS_IMAGE_H
+#define SPIFFS_IMAGE_H
+
+#include <FS.h>
+#include "flash_image.h"
+
+// SPIFFS on a FlashImage, configured like the arduino-esp32 SPIFFS.
+class SpiffsImage : public fs::FS {
+  public:
+    SpiffsImage(FlashImage &flash);
+    bool mount(bool format);
+    void unmount();
+    size_t totalBytes();
+    size_t usedBytes();
+};
+
+#endif
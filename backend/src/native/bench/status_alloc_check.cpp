@@ -0,0 +1,298 @@
+// Checks that serving /status allocates nothing on the heap, see status_json.h, that the
+// version of its ETag changes with the body, and that json_stream.h gives the same json in
+// windows of any size.
+// pio run -e native_status_alloc_check && .pio/build/native_status_alloc_check/program
+//
+// malloc and new are replaced by counting versions. Only the main thread counts, while it
+// reads the inputs, copies them into a response slot and drives the filler and the disconnect
+// handler like handleGetStatus() and the web server do, the other threads of the native build allocate on their own. The response
+// object the web server creates per request is not part of the native build, nor counted.
+// The exit code tells if all checks passed.
+
+#include <functional>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include "../../json_stream.h"
+#include "../../status_json.h"
+
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *pointer, size_t size);
+extern "C" void __libc_free(void *pointer);
+
+static thread_local bool countAllocations = false;
+static size_t allocationCount = 0;
+
+extern "C" void *malloc(size_t size) {
+  allocationCount += countAllocations;
+  return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size) {
+  allocationCount += countAllocations;
+  return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *pointer, size_t size) {
+  allocationCount += countAllocations;
+  return __libc_realloc(pointer, size);
+}
+
+extern "C" void free(void *pointer) {
+  __libc_free(pointer);
+}
+
+// also counted if the standard library would not take them from malloc
+void *operator new(size_t size) {
+  void *pointer = malloc(size);
+  if(!pointer) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+void *operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void *pointer) noexcept {
+  free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept {
+  free(pointer);
+}
+
+void operator delete(void *pointer, size_t size) noexcept {
+  free(pointer);
+}
+
+void operator delete[](void *pointer, size_t size) noexcept {
+  free(pointer);
+}
+
+static int failedChecks = 0;
+
+static void check(bool condition, const char *name, const std::string &detail) {
+  if(!condition) {
+    printf("FAILED %s %s\n", name, detail.c_str());
+    failedChecks++;
+  }
+}
+
+// all windows of a response, each of windowSize bytes
+static std::string streamJson(JsonPartWriter writePart, void *context, size_t windowSize) {
+  std::string json;
+  uint8_t window[1024];
+  JsonStreamCursor cursor = {0, 0};
+  size_t length;
+  while((length = fillJsonWindow(window, windowSize, cursor, writePart, context)) > 0) {
+    json.append((const char *)window, length);
+  }
+  return json;
+}
+
+typedef std::function<size_t(uint8_t *, size_t, size_t)> ResponseFiller;
+
+// calls the filler like the web server does, with the send buffer full first and then in
+// windows like the TCP buffer of the ESP32 hands over, returns the bytes of the body
+static size_t drainFiller(ResponseFiller &filler, size_t windowSize) {
+  uint8_t window[1024];
+  if(filler(window, 0, 0) != jsonResponseTryAgain) {
+    return 0;
+  }
+  size_t length = 0;
+  size_t written;
+  while((written = filler(window, windowSize, length)) > 0) {
+    length += written;
+  }
+  return length;
+}
+
+// the version of the ETag like handleGetStatus() gets it, all a request answered with 304 does
+static uint32_t pollStatusVersion(bool apMode) {
+  StatusInputs inputs;
+  readStatusInputs(inputs, apMode, "RobotMower 1a2b");
+  return updateStatusVersion(inputs);
+}
+
+// a request like handleGetStatus() serves it, with the web server's part of draining the
+// filler, the ETag is formatted by webserver.cpp and left out
+static size_t serveStatus(bool apMode) {
+  StatusInputs inputs;
+  readStatusInputs(inputs, apMode, "RobotMower 1a2b");
+  updateStatusVersion(inputs);
+  JsonResponseSlot *slot = reserveStatusResponse(inputs);
+  if(!slot) {
+    return 0;
+  }
+  // the request keeps a copy of the disconnect handler, the response one of the filler
+  std::function<void()> release = releaseJsonResponse(*slot);
+  std::function<void()> keptRelease(release);
+  ResponseFiller filler = startJsonResponse(*slot);
+  ResponseFiller kept(filler);
+  size_t length = drainFiller(kept, 100);
+  keptRelease();
+  return length;
+}
+
+static size_t countStatusAllocations(int requests, bool changing) {
+  allocationCount = 0;
+  countAllocations = true;
+  size_t length = 0;
+  for(int i = 0; i < requests; i++) {
+    length += serveStatus(changing && (i & 1));
+  }
+  countAllocations = false;
+  check(length > 0, "serve", "empty bodies");
+  return allocationCount;
+}
+
+static void checkCounting() {
+  allocationCount = 0;
+  countAllocations = true;
+  String text("longer than the buffer of a short string");
+  int *number = new int(1);
+  countAllocations = false;
+  delete number;
+  check(allocationCount >= 2, "counting", "malloc or new is not counted, " + std::to_string(allocationCount) + " allocations");
+}
+
+static StatusInputs getExampleInputs() {
+  StatusInputs inputs;
+  memset(&inputs, 0, sizeof(inputs));
+  inputs.timeAvailable = true;
+  inputs.timeinfo.tm_year = 124;
+  inputs.timeinfo.tm_mon = 5;
+  inputs.timeinfo.tm_mday = 7;
+  inputs.timeinfo.tm_hour = 9;
+  inputs.timeinfo.tm_min = 5;
+  inputs.snapshot.isCharging = true;
+  inputs.snapshot.isIdle = true;
+  strcpy(inputs.hostname, "robotmower");
+  strcpy(inputs.ssid, "Garden \"5G\"\\\t");
+  strcpy(inputs.ip, "192.168.1.20");
+  inputs.mowingPlanActive = true;
+  return inputs;
+}
+
+// the version of the ETag has to change with every input shown in the body, and only then
+static void checkVersions() {
+  StatusInputs inputs = getExampleInputs();
+  uint32_t version = updateStatusVersion(inputs);
+  inputs.timeinfo.tm_sec = 30;
+  check(updateStatusVersion(inputs) == version, "version", "changed without a change of the body");
+
+  const char *changes[] = {"snapshot", "minute", "access point", "mowing plan", "hostname", "ssid", "ip", "no time"};
+  for(int i = 0; i < 8; i++) {
+    switch(i) {
+      case 0: inputs.snapshot.version++; break;
+      case 1: inputs.timeinfo.tm_min++; break;
+      case 2: inputs.apMode = !inputs.apMode; break;
+      case 3: inputs.mowingPlanActive = !inputs.mowingPlanActive; break;
+      case 4: strcpy(inputs.hostname, "robotmower-2"); break;
+      case 5: strcpy(inputs.ssid, "Garden"); break;
+      case 6: strcpy(inputs.ip, "192.168.1.21"); break;
+      default: inputs.timeAvailable = false; break;
+    }
+    uint32_t changed = updateStatusVersion(inputs);
+    check(changed == version + 1, "version", std::string("no new version for a change of ") + changes[i]);
+    check(updateStatusVersion(inputs) == changed, "version", std::string("a new version without a change after ") + changes[i]);
+    version = changed;
+  }
+}
+
+static void checkBody() {
+  StatusInputs inputs = getExampleInputs();
+  std::string json = streamJson(writeStatusJsonPart, &inputs, 1024);
+  const char *expected = "{\"date\":\"2024-06-07\",\"time\":\"09:05\",\"isCharging\":true,\"isLocked\":false,"
+    "\"isEmergency\":false,\"isIdle\":true,\"isAccessPoint\":false,\"hostname\":\"robotmower\","
+    "\"ssid\":\"Garden \\\"5G\\\"\\\\\\u0009\",\"ip\":\"192.168.1.20\",\"mowingPlanActive\":true}";
+  check(json == expected, "body", json);
+
+  // a cut part is written again and its sent bytes skipped, also within an escape sequence
+  for(size_t windowSize = 1; windowSize < json.length(); windowSize++) {
+    std::string windowed = streamJson(writeStatusJsonPart, &inputs, windowSize);
+    check(windowed == json, "window", std::to_string(windowSize) + " bytes: " + windowed);
+  }
+
+  inputs.timeAvailable = false;
+  json = streamJson(writeStatusJsonPart, &inputs, 1024);
+  check(json.compare(0, 25, "{\"date\":null,\"time\":null,") == 0, "body without time", json);
+}
+
+static JsonResponseSlot *startStatusSlot(ResponseFiller &filler, std::function<void()> &release) {
+  StatusInputs inputs;
+  readStatusInputs(inputs, false, "");
+  JsonResponseSlot *slot = reserveStatusResponse(inputs);
+  if(slot) {
+    filler = startJsonResponse(*slot);
+    release = releaseJsonResponse(*slot);
+  }
+  return slot;
+}
+
+// a slot is free again after its body or once its request was dropped, with all slots used a
+// request gets none and the responses in flight go on, as they do with polls answered with 304
+static void checkSlots() {
+  uint8_t window[1024];
+  JsonResponseSlot *slots[4];
+  ResponseFiller fillers[4];
+  std::function<void()> releases[4];
+  for(int i = 0; i < 4; i++) {
+    slots[i] = startStatusSlot(fillers[i], releases[i]);
+    check(slots[i] != NULL, "slots", "no slot for response " + std::to_string(i));
+  }
+  if(failedChecks > 0) {
+    return;
+  }
+  for(int i = 0; i < 8; i++) {
+    pollStatusVersion(false);
+  }
+  ResponseFiller filler;
+  std::function<void()> release;
+  check(startStatusSlot(filler, release) == NULL, "slots", "a slot was taken from a response in flight");
+  check(fillers[0](window, 0, 0) == jsonResponseTryAgain, "slots", "a full pool ended a response in flight");
+
+  // the disconnect handler comes after the body too, it must not free the slot of the next response
+  check(drainFiller(fillers[2], sizeof(window)) > 0, "slots", "response 2 is empty");
+  check(startStatusSlot(fillers[2], release) == slots[2], "slots", "the finished slot was not reused");
+  releases[2]();
+  check(startStatusSlot(filler, release) == NULL, "slots", "a late disconnect freed the slot of the next response");
+  check(drainFiller(fillers[2], sizeof(window)) > 0, "slots", "the response in the reused slot is empty");
+  releases[2] = release;
+
+  // a dropped request frees its slot without sending the body
+  releases[0]();
+  check(startStatusSlot(filler, release) == slots[0], "slots", "the slot of the dropped request was not freed");
+  check(fillers[0](window, sizeof(window), 0) == 0, "slots", "the filler of the dropped request did not end");
+  releases[0] = release;
+  fillers[0] = filler;
+  for(int i = 0; i < 4; i++) {
+    check(i == 2 || drainFiller(fillers[i], sizeof(window)) > 0, "slots", "response " + std::to_string(i) + " is empty");
+    releases[i]();
+  }
+}
+
+int main(int argc, char **argv) {
+  checkCounting();
+  checkBody();
+  checkVersions();
+  checkSlots();
+
+  // the first request loads the time zone and formats the first body
+  serveStatus(false);
+  size_t unchanged = countStatusAllocations(1000, false);
+  check(unchanged == 0, "unchanged", std::to_string(unchanged) + " allocations in 1000 requests");
+  // switching between station and access point changes the version every time
+  uint32_t version = pollStatusVersion(false);
+  size_t changing = countStatusAllocations(1000, true);
+  check(changing == 0, "changing", std::to_string(changing) + " allocations in 1000 requests");
+  check(pollStatusVersion(false) >= version + 1000, "versions", "the version did not change with the inputs");
+
+  printf("%s\n", failedChecks == 0 ? "all checks passed" : "checks failed");
+  return failedChecks == 0 ? 0 : 1;
+}
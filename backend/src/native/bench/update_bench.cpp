@@ -0,0 +1,329 @@
+// Checks and measures the update decoder, update_decoder.cpp.
+// pio run -e native_update_bench && .pio/build/native_update_bench/program [image]
+//
+// The image defaults to this program, a binary like the firmware. It is compressed here
+// with zlib, the heatshrink encoder of tools/compress_update.py and the heatshrink library,
+// then decoded in the chunk sizes the web server hands over. Every round trip has to give
+// back the image, the heatshrink library has to decode what compress_update.py writes,
+// corrupt and cut off gzip streams have to be refused, the exit code tells if all checks passed.
+// miniz and heatshrink come from tools/update_bench_sources.py.
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <zlib.h>
+#include "miniz.h"
+#include "update_decoder.h"
+extern "C" {
+#include "heatshrink_decoder.h"
+#include "heatshrink_encoder.h"
+}
+
+typedef std::vector<uint8_t> Bytes;
+typedef std::chrono::steady_clock Clock;
+
+static int failedChecks = 0;
+
+static void check(bool condition, const char *name, const std::string &detail) {
+  if(!condition) {
+    printf("FAILED %s %s\n", name, detail.c_str());
+    failedChecks++;
+  }
+}
+
+static Bytes readFile(const char *path) {
+  Bytes data;
+  FILE *file = fopen(path, "rb");
+  if(!file) {
+    return data;
+  }
+  uint8_t buffer[4096];
+  size_t count;
+  while((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    data.insert(data.end(), buffer, buffer + count);
+  }
+  fclose(file);
+  return data;
+}
+
+// level 0 gives stored blocks, Z_FIXED fixed huffman blocks
+static Bytes compressGzip(const Bytes &input, int level, int strategy) {
+  z_stream stream;
+  memset(&stream, 0, sizeof(stream));
+  deflateInit2(&stream, level, Z_DEFLATED, 15 + 16, 9, strategy);
+  Bytes output(deflateBound(&stream, input.size()) + 64);
+  stream.next_in = (Bytes::value_type *)input.data();
+  stream.avail_in = input.size();
+  stream.next_out = output.data();
+  stream.avail_out = output.size();
+  deflate(&stream, Z_FINISH);
+  output.resize(stream.total_out);
+  deflateEnd(&stream);
+  return output;
+}
+
+struct BitWriter {
+  Bytes bytes;
+  uint32_t bits = 0;
+  uint8_t count = 0;
+
+  void write(uint32_t value, uint8_t length) {
+    while(length-- > 0) {
+      bits = bits << 1 | ((value >> length) & 1);
+      if(++count == 8) {
+        bytes.push_back(bits);
+        bits = 0;
+        count = 0;
+      }
+    }
+  }
+
+  Bytes finish() {
+    if(count > 0) {
+      bytes.push_back(bits << (8 - count));
+    }
+    return bytes;
+  }
+};
+
+// greedy, like tools/compress_update.py, a back reference pays off from 2 bytes on
+static Bytes compressHeatshrink(const Bytes &input) {
+  const size_t windowSize = 1 << heatshrinkWindowBits;
+  const size_t maxCount = 1 << heatshrinkLookaheadBits;
+  const int maxCandidates = 64;
+  std::vector<int32_t> head(1 << 16, -1);
+  std::vector<int32_t> previous(input.size(), -1);
+  BitWriter writer;
+
+  auto insert = [&](size_t position) {
+    if(position + 1 < input.size()) {
+      uint16_t hash = input[position] << 8 | input[position + 1];
+      previous[position] = head[hash];
+      head[hash] = position;
+    }
+  };
+
+  size_t position = 0;
+  while(position < input.size()) {
+    size_t bestCount = 0;
+    size_t bestDistance = 0;
+    if(position + 1 < input.size()) {
+      int32_t candidate = head[input[position] << 8 | input[position + 1]];
+      for(int i = 0; i < maxCandidates && candidate >= 0 && position - candidate <= windowSize; i++) {
+        size_t count = 0;
+        while(count < maxCount && position + count < input.size() && input[candidate + count] == input[position + count]) {
+          count++;
+        }
+        if(count > bestCount) {
+          bestCount = count;
+          bestDistance = position - candidate;
+        }
+        candidate = previous[candidate];
+      }
+    }
+
+    if(bestCount >= 2) {
+      writer.write(0, 1);
+      writer.write(bestDistance - 1, heatshrinkWindowBits);
+      writer.write(bestCount - 1, heatshrinkLookaheadBits);
+    } else {
+      bestCount = 1;
+      writer.write(1, 1);
+      writer.write(input[position], 8);
+    }
+    for(size_t i = 0; i < bestCount; i++) {
+      insert(position++);
+    }
+  }
+  return writer.finish();
+}
+
+// the heatshrink library, the way the heatshrink command line tool writes a file
+static Bytes compressHeatshrinkLibrary(const Bytes &input) {
+  heatshrink_encoder *encoder = heatshrink_encoder_alloc(heatshrinkWindowBits, heatshrinkLookaheadBits);
+  Bytes output;
+  uint8_t buffer[4096];
+  auto poll = [&]() {
+    HSE_poll_res result;
+    do {
+      size_t length = 0;
+      result = heatshrink_encoder_poll(encoder, buffer, sizeof(buffer), &length);
+      output.insert(output.end(), buffer, buffer + length);
+    } while(result == HSER_POLL_MORE);
+  };
+  for(size_t offset = 0; offset < input.size();) {
+    size_t length = 0;
+    heatshrink_encoder_sink(encoder, (uint8_t *)input.data() + offset, input.size() - offset, &length);
+    offset += length;
+    poll();
+  }
+  while(heatshrink_encoder_finish(encoder) == HSER_FINISH_MORE) {
+    poll();
+  }
+  heatshrink_encoder_free(encoder);
+  return output;
+}
+
+static Bytes decompressHeatshrinkLibrary(const Bytes &input) {
+  heatshrink_decoder *decoder = heatshrink_decoder_alloc(256, heatshrinkWindowBits, heatshrinkLookaheadBits);
+  Bytes output;
+  uint8_t buffer[4096];
+  auto poll = [&]() {
+    HSD_poll_res result;
+    do {
+      size_t length = 0;
+      result = heatshrink_decoder_poll(decoder, buffer, sizeof(buffer), &length);
+      output.insert(output.end(), buffer, buffer + length);
+    } while(result == HSDR_POLL_MORE);
+  };
+  for(size_t offset = 0; offset < input.size();) {
+    size_t length = 0;
+    heatshrink_decoder_sink(decoder, (uint8_t *)input.data() + offset, input.size() - offset, &length);
+    offset += length;
+    poll();
+  }
+  while(heatshrink_decoder_finish(decoder) == HSDR_FINISH_MORE) {
+    poll();
+  }
+  heatshrink_decoder_free(decoder);
+  return output;
+}
+
+static bool collectOutput(const uint8_t *data, size_t length, void *context) {
+  Bytes *output = (Bytes *)context;
+  output->insert(output->end(), data, data + length);
+  return true;
+}
+
+static bool countOutput([[maybe_unused]] const uint8_t *data, size_t length, void *context) {
+  *(size_t *)context += length;
+  return true;
+}
+
+// decodes input in chunks of chunkSize, false if the decoder refused it
+static bool decode(UpdateEncoding encoding, const Bytes &input, size_t chunkSize, Bytes &output, const char *&error) {
+  UpdateDecoder decoder;
+  output.clear();
+  bool ok = beginUpdateDecoder(decoder, encoding, collectOutput, &output);
+  for(size_t offset = 0; ok && offset < input.size(); offset += chunkSize) {
+    ok = writeUpdateDecoder(decoder, input.data() + offset, std::min(chunkSize, input.size() - offset));
+  }
+  ok = ok && finishUpdateDecoder(decoder);
+  error = decoder.error;
+  endUpdateDecoder(decoder);
+  return ok;
+}
+
+static void checkRoundTrip(const char *name, UpdateEncoding encoding, const Bytes &image, const Bytes &compressed) {
+  const size_t chunkSizes[] = {1, 7, 1436, 65536};
+  for(size_t chunkSize : chunkSizes) {
+    Bytes output;
+    const char *error;
+    bool ok = decode(encoding, compressed, chunkSize, output, error);
+    std::string detail = "chunks of " + std::to_string(chunkSize) + (error ? std::string(": ") + error : "");
+    check(ok && output == image, name, detail);
+  }
+}
+
+static void checkRefused(const char *name, UpdateEncoding encoding, const Bytes &compressed) {
+  Bytes output;
+  const char *error;
+  check(!decode(encoding, compressed, 1436, output, error), name, "was accepted");
+}
+
+static void benchmark(const char *name, UpdateEncoding encoding, const Bytes &image, const Bytes &compressed) {
+  // the payload of a TCP segment, what the web server hands over per call
+  const size_t chunkSize = 1436;
+  const int repeats = 20;
+  size_t decoded = 0;
+  Clock::time_point start = Clock::now();
+  for(int i = 0; i < repeats; i++) {
+    UpdateDecoder decoder;
+    beginUpdateDecoder(decoder, encoding, countOutput, &decoded);
+    for(size_t offset = 0; offset < compressed.size(); offset += chunkSize) {
+      writeUpdateDecoder(decoder, compressed.data() + offset, std::min(chunkSize, compressed.size() - offset));
+    }
+    finishUpdateDecoder(decoder);
+    endUpdateDecoder(decoder);
+  }
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  printf("%-24s %8u -> %8u bytes (%5.1f %%)  %7.1f MB/s decoded\n", name,
+    (unsigned int)image.size(), (unsigned int)compressed.size(), 100.0 * compressed.size() / image.size(),
+    decoded / seconds / 1e6);
+}
+
+int main(int argc, char **argv) {
+  Bytes image = readFile(argc > 1 ? argv[1] : "/proc/self/exe");
+  if(image.empty()) {
+    printf("cannot read the image\n");
+    return 1;
+  }
+
+  Bytes gzip = compressGzip(image, 9, Z_DEFAULT_STRATEGY);
+  Bytes heatshrink = compressHeatshrink(image);
+
+  checkRoundTrip("gzip", UPDATE_ENCODING_GZIP, image, gzip);
+  checkRoundTrip("gzip fixed blocks", UPDATE_ENCODING_GZIP, image, compressGzip(image, 9, Z_FIXED));
+  checkRoundTrip("gzip stored blocks", UPDATE_ENCODING_GZIP, image, compressGzip(image, 0, Z_DEFAULT_STRATEGY));
+  checkRoundTrip("gzip empty", UPDATE_ENCODING_GZIP, Bytes(), compressGzip(Bytes(), 9, Z_DEFAULT_STRATEGY));
+  checkRoundTrip("heatshrink", UPDATE_ENCODING_HEATSHRINK, image, heatshrink);
+  checkRoundTrip("heatshrink empty", UPDATE_ENCODING_HEATSHRINK, Bytes(), compressHeatshrink(Bytes()));
+  // the encoder of compress_update.py and the decoder have to agree with the heatshrink library
+  checkRoundTrip("heatshrink library", UPDATE_ENCODING_HEATSHRINK, image, compressHeatshrinkLibrary(image));
+  check(decompressHeatshrinkLibrary(heatshrink) == image, "heatshrink library", "decodes the heatshrink encoder differently");
+  checkRoundTrip("raw", UPDATE_ENCODING_RAW, image, image);
+
+  // a long run, back references that overlap what they copy
+  Bytes run(100000, 0xff);
+  run[50000] = 0;
+  checkRoundTrip("gzip run", UPDATE_ENCODING_GZIP, run, compressGzip(run, 9, Z_DEFAULT_STRATEGY));
+  checkRoundTrip("heatshrink run", UPDATE_ENCODING_HEATSHRINK, run, compressHeatshrink(run));
+  checkRoundTrip("heatshrink library run", UPDATE_ENCODING_HEATSHRINK, run, compressHeatshrinkLibrary(run));
+
+  // a gzip header with extra field, file name and header crc, as written by gzip -N
+  Bytes named = {0x1f, 0x8b, 8, 0x0e, 0, 0, 0, 0, 0, 3, 2, 0, 'x', 'y'};
+  for(const char *name = "firmware.bin"; *name; name++) {
+    named.push_back(*name);
+  }
+  named.push_back(0);
+  named.push_back(0);
+  named.push_back(0);
+  named.insert(named.end(), gzip.begin() + 10, gzip.end());
+  checkRoundTrip("gzip named", UPDATE_ENCODING_GZIP, image, named);
+
+  Bytes corrupt = gzip;
+  corrupt[corrupt.size() / 2] ^= 0x10;
+  checkRefused("gzip corrupt", UPDATE_ENCODING_GZIP, corrupt);
+  Bytes wrongCrc = gzip;
+  wrongCrc[wrongCrc.size() - 8] ^= 1;
+  checkRefused("gzip wrong crc", UPDATE_ENCODING_GZIP, wrongCrc);
+  checkRefused("gzip cut off", UPDATE_ENCODING_GZIP, Bytes(gzip.begin(), gzip.begin() + gzip.size() - 3));
+  Bytes trailing = gzip;
+  trailing.push_back(0);
+  checkRefused("gzip trailing data", UPDATE_ENCODING_GZIP, trailing);
+  checkRefused("gzip of raw image", UPDATE_ENCODING_GZIP, image);
+  // heatshrink has no length or checksum, a stream cut at a record boundary is only caught by the digest
+  Bytes cutOutput;
+  const char *cutError;
+  decode(UPDATE_ENCODING_HEATSHRINK, Bytes(heatshrink.begin(), heatshrink.end() - 2), 1436, cutOutput, cutError);
+  check(cutOutput != image, "heatshrink cut off", "decoded to the image");
+
+  check(getUpdateEncoding("firmware.bin.gz") == UPDATE_ENCODING_GZIP, "encoding", "of firmware.bin.gz");
+  check(getUpdateEncoding("filesystem.bin.hs") == UPDATE_ENCODING_HEATSHRINK, "encoding", "of filesystem.bin.hs");
+  check(getUpdateEncoding("firmware.bin") == UPDATE_ENCODING_RAW, "encoding", "of firmware.bin");
+
+  benchmark("raw", UPDATE_ENCODING_RAW, image, image);
+  benchmark("gzip -9", UPDATE_ENCODING_GZIP, image, gzip);
+  benchmark("heatshrink w10 l5", UPDATE_ENCODING_HEATSHRINK, image, heatshrink);
+  printf("%-24s gzip %u bytes, heatshrink %u bytes\n", "decoder buffers",
+    (unsigned int)(TINFL_LZ_DICT_SIZE + sizeof(tinfl_decompressor)), (unsigned int)(1 << heatshrinkWindowBits));
+
+  if(failedChecks > 0) {
+    printf("%d checks FAILED\n", failedChecks);
+    return 1;
+  }
+  printf("all checks passed\n");
+  return 0;
+}
@@ -0,0 +1,133 @@
+#include <Arduino.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <random>
+#include "../hal.h"
+#include "hal_native.h"
+#include "ram_fs.h"
+#include "../storage.h"
+#include "mower_simulator.h"
+
+HardwareSerial Serial;
+
+static RamFS ramFileSystem;
+static const std::chrono::steady_clock::time_point bootTime = std::chrono::steady_clock::now();
+// set by the checks, read by every task
+static std::atomic<bool> nativeTimeSet(false);
+static std::atomic<time_t> nativeTime(0);
+
+unsigned long millis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - bootTime).count();
+}
+
+unsigned long micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - bootTime).count();
+}
+
+void delay(unsigned long ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+long random(long max) {
+  static std::mt19937 generator(std::random_device{}());
+  return max > 0 ? std::uniform_int_distribution<long>(0, max - 1)(generator) : 0;
+}
+
+void halPinMode(int pin, int mode) {
+}
+
+int halDigitalRead(int pin) {
+  return simulatorReadPin(pin, millis());
+}
+
+void halDigitalWrite(int pin, int value) {
+  simulatorWritePin(pin, value, millis());
+}
+
+unsigned long halMillis() {
+  return millis();
+}
+
+unsigned long halMicros() {
+  return micros();
+}
+
+void halDelay(unsigned long ms) {
+  delay(ms);
+}
+
+void halDelayUntil(unsigned long &lastWakeTime, unsigned long intervalMs) {
+  lastWakeTime += intervalMs;
+  long remaining = (long)(lastWakeTime - millis());
+  if(remaining > 0) {
+    delay(remaining);
+  }
+}
+
+bool halGetLocalTime(struct tm *timeinfo) {
+  // the build box has a synced clock, use it like the ntp time on the mower
+  time_t now = nativeTimeSet ? nativeTime.load() : time(NULL);
+  if(now == 0) {
+    return false;
+  }
+  localtime_r(&now, timeinfo);
+  return true;
+}
+
+void halStartTimeSync(const char *server1, const char *server2) {
+}
+
+void setNativeLocalTime(time_t time) {
+  nativeTime = time;
+  nativeTimeSet = true;
+}
+
+void halStartTask(void (*task)(void *), const char *name, uint32_t stackSize, unsigned int priority, void *parameter) {
+  std::thread(task, parameter).detach();
+}
+
+static const StorageBackend ramStorage = {
+  "RamFS",
+  [](bool format) { return true; },
+  []() {},
+  []() -> fs::FS & { return ramFileSystem; },
+  []() { return ramFileSystem.totalBytes(); },
+  []() { return ramFileSystem.usedBytes(); }
+};
+
+bool halBeginFileSystem() {
+  return mountStorage(ramStorage, NULL);
+}
+
+const char *halFileSystemName() {
+  return ramStorage.name;
+}
+
+fs::FS &halFileSystem() {
+  return ramStorage.fileSystem();
+}
+
+size_t halFileSystemTotalBytes() {
+  return ramStorage.totalBytes();
+}
+
+size_t halFileSystemUsedBytes() {
+  return ramStorage.usedBytes();
+}
+
+bool halNetworkConnected() {
+  return true;
+}
+
+void halNetworkHostname(char *buffer, size_t size) {
+  snprintf(buffer, size, "%s", "robotmower-native");
+}
+
+void halNetworkSSID(char *buffer, size_t size) {
+  snprintf(buffer, size, "%s", "native");
+}
+
+void halNetworkIP(bool accessPoint, char *buffer, size_t size) {
+  snprintf(buffer, size, "%s", "127.0.0.1");
+}
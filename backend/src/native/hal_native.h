@@ -0,0 +1,12 @@
+#ifndef HAL_NATIVE_H
+#define HAL_NATIVE_H
+
+#include <time.h>
+
+// Native only parts of the HAL, for the checks in bench/.
+
+// halGetLocalTime() returns time from now on instead of the build box's clock,
+// 0 makes it fail like before the first ntp sync
+void setNativeLocalTime(time_t time);
+
+#endif
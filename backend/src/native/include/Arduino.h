@@ -0,0 +1,216 @@
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+// Minimal Arduino compatibility for the native (Linux) build.
+// Only covers what the backend uses; hardware access goes through hal.h.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <string>
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define OUTPUT_OPEN_DRAIN 0x13
+
+#define DEC 10
+#define HEX 16
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+long random(long max);
+
+class String {
+  public:
+    String() {}
+    String(const char *text) : value(text ? text : "") {}
+    String(const std::string &text) : value(text) {}
+    explicit String(char c) : value(1, c) {}
+    explicit String(int number, unsigned char base = DEC) { setNumber(number, base); }
+    explicit String(unsigned int number, unsigned char base = DEC) { setUnsigned(number, base); }
+    explicit String(long number, unsigned char base = DEC) { setNumber(number, base); }
+    explicit String(unsigned long number, unsigned char base = DEC) { setUnsigned(number, base); }
+    explicit String(long long number, unsigned char base = DEC) { setNumber(number, base); }
+    explicit String(unsigned long long number, unsigned char base = DEC) { setUnsigned(number, base); }
+    explicit String(double number, unsigned int decimals = 2) {
+      char buffer[32];
+      snprintf(buffer, sizeof(buffer), "%.*f", decimals, number);
+      value = buffer;
+    }
+
+    String &operator=(const char *text) { value = text ? text : ""; return *this; }
+
+    const char *c_str() const { return value.c_str(); }
+    unsigned int length() const { return value.length(); }
+    bool isEmpty() const { return value.empty(); }
+    bool reserve(unsigned int size) { value.reserve(size); return true; }
+
+    bool concat(const String &text) { value += text.value; return true; }
+    bool concat(const char *text) { if(text) value += text; return true; }
+    bool concat(const char *text, unsigned int length) { value.append(text, length); return true; }
+    bool concat(char c) { value += c; return true; }
+    String &operator+=(const String &text) { concat(text); return *this; }
+    String &operator+=(const char *text) { concat(text); return *this; }
+    String &operator+=(char c) { concat(c); return *this; }
+
+    bool operator==(const String &other) const { return value == other.value; }
+    bool operator==(const char *other) const { return value == (other ? other : ""); }
+    bool operator!=(const String &other) const { return !(*this == other); }
+    bool operator!=(const char *other) const { return !(*this == other); }
+    bool operator<(const String &other) const { return value < other.value; }
+
+    char operator[](unsigned int index) const { return index < value.length() ? value[index] : 0; }
+    char charAt(unsigned int index) const { return (*this)[index]; }
+
+    int indexOf(char c, unsigned int from = 0) const {
+      size_t position = value.find(c, from);
+      return position == std::string::npos ? -1 : (int)position;
+    }
+    int indexOf(const char *text, unsigned int from = 0) const {
+      size_t position = value.find(text, from);
+      return position == std::string::npos ? -1 : (int)position;
+    }
+    bool startsWith(const char *prefix) const { return value.compare(0, strlen(prefix), prefix) == 0; }
+    bool startsWith(const String &prefix) const { return startsWith(prefix.c_str()); }
+    bool endsWith(const char *suffix) const {
+      size_t length = strlen(suffix);
+      return value.length() >= length && value.compare(value.length() - length, length, suffix) == 0;
+    }
+
+    String substring(unsigned int from) const { return from < value.length() ? String(value.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const {
+      if(from >= value.length() || to <= from) {
+        return String();
+      }
+      return String(value.substr(from, to - from));
+    }
+    long toInt() const { return atol(value.c_str()); }
+    float toFloat() const { return atof(value.c_str()); }
+
+    void trim() {
+      size_t begin = value.find_first_not_of(" \t\r\n");
+      size_t end = value.find_last_not_of(" \t\r\n");
+      value = begin == std::string::npos ? "" : value.substr(begin, end - begin + 1);
+    }
+    void toLowerCase() { for(char &c : value) c = tolower(c); }
+    void toUpperCase() { for(char &c : value) c = toupper(c); }
+
+  private:
+    std::string value;
+
+    void setNumber(long long number, unsigned char base) {
+      if(number < 0 && base == DEC) {
+        setUnsigned((unsigned long long)(-number), base);
+        value.insert(value.begin(), '-');
+      } else {
+        setUnsigned((unsigned long long)number, base);
+      }
+    }
+    void setUnsigned(unsigned long long number, unsigned char base) {
+      char buffer[24];
+      snprintf(buffer, sizeof(buffer), base == HEX ? "%llx" : "%llu", number);
+      value = buffer;
+    }
+};
+
+inline String operator+(const String &left, const String &right) { String result(left); result += right; return result; }
+inline String operator+(const String &left, const char *right) { String result(left); result += right; return result; }
+inline String operator+(const char *left, const String &right) { String result(left); result += right; return result; }
+inline String operator+(const String &left, char right) { String result(left); result += right; return result; }
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size) {
+      size_t written = 0;
+      while(size--) {
+        written += write(*buffer++);
+      }
+      return written;
+    }
+    size_t write(const char *text) { return text ? write((const uint8_t *)text, strlen(text)) : 0; }
+
+    size_t print(const char *text) { return write(text); }
+    size_t print(const String &text) { return write((const uint8_t *)text.c_str(), text.length()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int number) { return print(String(number)); }
+    size_t print(unsigned int number) { return print(String(number)); }
+    size_t print(long number) { return print(String(number)); }
+    size_t print(unsigned long number) { return print(String(number)); }
+    size_t println() { return write("\n"); }
+    template <typename T> size_t println(const T &value) { return print(value) + println(); }
+
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3))) {
+      char buffer[256];
+      va_list arguments;
+      va_start(arguments, format);
+      int length = vsnprintf(buffer, sizeof(buffer), format, arguments);
+      va_end(arguments);
+      if(length < 0) {
+        return 0;
+      }
+      return write((const uint8_t *)buffer, (size_t)length < sizeof(buffer) ? length : sizeof(buffer) - 1);
+    }
+    virtual void flush() {}
+};
+
+class Stream : public Print {
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    virtual size_t readBytes(char *buffer, size_t length) {
+      size_t count = 0;
+      while(count < length) {
+        int c = read();
+        if(c < 0) {
+          break;
+        }
+        buffer[count++] = (char)c;
+      }
+      return count;
+    }
+    size_t readBytes(uint8_t *buffer, size_t length) { return readBytes((char *)buffer, length); }
+
+    String readString() {
+      String result;
+      int c;
+      while((c = read()) >= 0) {
+        result += (char)c;
+      }
+      return result;
+    }
+    String readStringUntil(char terminator) {
+      String result;
+      int c;
+      while((c = read()) >= 0 && c != terminator) {
+        result += (char)c;
+      }
+      return result;
+    }
+};
+
+class HardwareSerial : public Stream {
+  public:
+    void begin(unsigned long baud) {}
+    size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+    size_t write(const uint8_t *buffer, size_t size) override { return fwrite(buffer, 1, size, stdout); }
+    using Print::write;
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    void flush() override { fflush(stdout); }
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef NATIVE_FS_H
+#define NATIVE_FS_H
+
+// Arduino fs::FS / fs::File subset for the native build.
+// Same shape as the arduino-esp32 classes: a thin File/FS wrapper around
+// an implementation, so different backends can sit behind halFileSystem().
+
+#include <memory>
+#include "Arduino.h"
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+enum SeekMode {
+  SeekSet = 0,
+  SeekCur = 1,
+  SeekEnd = 2
+};
+
+class File;
+
+class FileImpl {
+  public:
+    virtual ~FileImpl() {}
+    virtual size_t write(const uint8_t *buffer, size_t size) = 0;
+    virtual size_t read(uint8_t *buffer, size_t size) = 0;
+    virtual void flush() = 0;
+    virtual bool seek(uint32_t position, SeekMode mode) = 0;
+    virtual size_t position() const = 0;
+    virtual size_t size() const = 0;
+    virtual void close() = 0;
+    virtual const char *path() const = 0;
+    virtual const char *name() const = 0;
+    virtual bool isDirectory() = 0;
+    virtual std::shared_ptr<FileImpl> openNextFile(const char *mode) = 0;
+    virtual operator bool() = 0;
+};
+
+typedef std::shared_ptr<FileImpl> FileImplPtr;
+
+class File : public Stream {
+  public:
+    File(FileImplPtr p = FileImplPtr()) : impl(p) {}
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override { return impl ? impl->write(buffer, size) : 0; }
+    using Print::write;
+
+    int available() override { return impl ? (int)(impl->size() - impl->position()) : 0; }
+    int read() override {
+      uint8_t c;
+      return read(&c, 1) == 1 ? c : -1;
+    }
+    size_t read(uint8_t *buffer, size_t size) { return impl ? impl->read(buffer, size) : 0; }
+    size_t readBytes(char *buffer, size_t length) override { return read((uint8_t *)buffer, length); }
+    int peek() override {
+      if(!impl) {
+        return -1;
+      }
+      size_t position = impl->position();
+      int c = read();
+      impl->seek(position, SeekSet);
+      return c;
+    }
+    void flush() override { if(impl) impl->flush(); }
+
+    bool seek(uint32_t position, SeekMode mode = SeekSet) { return impl && impl->seek(position, mode); }
+    size_t position() const { return impl ? impl->position() : 0; }
+    size_t size() const { return impl ? impl->size() : 0; }
+    void close() { if(impl) { impl->close(); impl.reset(); } }
+    operator bool() const { return impl && *impl; }
+    const char *path() const { return impl ? impl->path() : ""; }
+    const char *name() const { return impl ? impl->name() : ""; }
+    bool isDirectory() { return impl && impl->isDirectory(); }
+    File openNextFile(const char *mode = FILE_READ) { return impl ? File(impl->openNextFile(mode)) : File(); }
+
+  private:
+    FileImplPtr impl;
+};
+
+class FSImpl {
+  public:
+    virtual ~FSImpl() {}
+    virtual FileImplPtr open(const char *path, const char *mode, bool create) = 0;
+    virtual bool exists(const char *path) = 0;
+    virtual bool rename(const char *pathFrom, const char *pathTo) = 0;
+    virtual bool remove(const char *path) = 0;
+    virtual bool mkdir(const char *path) = 0;
+    virtual bool rmdir(const char *path) = 0;
+};
+
+typedef std::shared_ptr<FSImpl> FSImplPtr;
+
+class FS {
+  public:
+    FS(FSImplPtr p) : impl(p) {}
+    virtual ~FS() {}
+
+    File open(const char *path, const char *mode = FILE_READ, bool create = false) { return File(impl->open(path, mode, create)); }
+    File open(const String &path, const char *mode = FILE_READ, bool create = false) { return open(path.c_str(), mode, create); }
+    bool exists(const char *path) { return impl->exists(path); }
+    bool exists(const String &path) { return exists(path.c_str()); }
+    bool remove(const char *path) { return impl->remove(path); }
+    bool remove(const String &path) { return remove(path.c_str()); }
+    bool rename(const char *pathFrom, const char *pathTo) { return impl->rename(pathFrom, pathTo); }
+    bool rename(const String &pathFrom, const String &pathTo) { return rename(pathFrom.c_str(), pathTo.c_str()); }
+    bool mkdir(const char *path) { return impl->mkdir(path); }
+    bool rmdir(const char *path) { return impl->rmdir(path); }
+
+  protected:
+    FSImplPtr impl;
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
+
+#endif
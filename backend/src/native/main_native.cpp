@@ -0,0 +1,94 @@
+// Entry point of the native (Linux) build.
+// Runs the mower logic against the simulated mower, so timing and load
+// can be measured on a normal build box. Buttons can be pressed via stdin.
+
+#include <Arduino.h>
+#include <iostream>
+#include <string>
+#include "../hal.h"
+#include "../logger.h"
+#include "../file_utils.h"
+#include "../pins.h"
+#include "../pin_sampler.h"
+#include "../mower.h"
+#include "../command_executor.h"
+#include "../scheduler.h"
+#include "../config_store.h"
+#include "../mowing_sessions.h"
+#include "mower_simulator.h"
+
+static void printStatus() {
+  MowerSnapshot snapshot = getMowerSnapshot();
+  Serial.printf("charging=%d locked=%d emergency=%d idle=%d version=%u\n",
+    snapshot.isCharging, snapshot.isLocked, snapshot.isEmergency, snapshot.isIdle, snapshot.version);
+}
+
+static void printSessions() {
+  SessionSummary summary;
+  getSessionSummary(summary);
+  for(int i = 0; i < summary.sessionCount; i++) {
+    const MowingSession &session = summary.sessions[i];
+    Serial.printf("session %u-%u %s %s\n", session.start, session.end,
+      sessionTriggerName(session.trigger), sessionEndReasonName(session.endReason));
+  }
+  Serial.printf("today: %u sessions, %u s, this week: %u sessions, %u s%s\n",
+    summary.days[0].sessions, summary.days[0].mowingSeconds, summary.weeks[0].sessions, summary.weeks[0].mowingSeconds,
+    summary.active ? ", mowing" : "");
+}
+
+static void consoleTask(void *parameter) {
+  std::string command;
+  while(std::getline(std::cin, command)) {
+    if(command == "start") {
+      startMower(true);
+    } else if(command == "home") {
+      sendMowerHome(true);
+    } else if(command == "stop") {
+      stopMower();
+    } else if(command == "lock") {
+      lock();
+    } else if(command == "unlock") {
+      unlock();
+    } else if(command == "emergency") {
+      simulatorSetEmergency(true);
+    } else if(command == "clear") {
+      simulatorSetEmergency(false);
+    } else if(command.rfind("command ", 0) == 0) {
+      CommandInfo info;
+      if(getCommandInfo(strtoul(command.c_str() + 8, NULL, 10), info)) {
+        Serial.printf("command %u %s: %s\n", info.id, commandTypeName(info.type), commandStatusName(info.status));
+      }
+    } else if(command == "status") {
+      printStatus();
+    } else if(command == "sessions") {
+      printSessions();
+    } else if(command == "quit") {
+      flushLog();
+      exit(0);
+    } else if(!command.empty()) {
+      Serial.println("commands: start, home, stop, lock, unlock, command <id>, emergency, clear, status, sessions, quit");
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  initializeFileSystem();
+  initializeLogger();
+  initializeConfigStore();
+  initializeMowingSessions();
+  showFileSystemUsage();
+
+  LOG_INFO("Starting Robot Mower Interface (native)");
+  setupPins();
+  startPinSampler();
+  startCommandExecutor();
+  loadMowingPlan();
+  scheduleMowingPlanChecks();
+  addScheduledJob("dockingState", checkStateChangeInDockingOrOutside, 60000);
+
+  halStartTask(consoleTask, "console", 4096, 1);
+
+  for(;;) {
+    runScheduler();
+  }
+}
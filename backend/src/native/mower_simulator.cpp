@@ -0,0 +1,153 @@
+#include <Arduino.h>
+#include <mutex>
+#include "mower_simulator.h"
+#include "../pins.h"
+
+static std::mutex simulatorLock;
+static SimulatedMowerState state = SIMULATED_DOCKED;
+static unsigned long returnStartedAt = 0;
+static bool locked = false;
+static int unlockPresses = 0;
+static unsigned long firstUnlockPressAt = 0;
+static bool emergency = false;
+static bool idle = false;
+
+// open drain outputs are released (high) after setupPins(), except stop
+static int buttonStart = HIGH;
+static int buttonHome = HIGH;
+static int buttonStop = LOW;
+static int buttonLock = HIGH;
+
+static const char *stateName(SimulatedMowerState mowerState) {
+  switch(mowerState) {
+    case SIMULATED_DOCKED: return "docked";
+    case SIMULATED_MOWING: return "mowing";
+    case SIMULATED_PAUSED: return "paused";
+    case SIMULATED_RETURNING: return "returning";
+  }
+  return "unknown";
+}
+
+static void changeState(SimulatedMowerState newState) {
+  if(state != newState) {
+    Serial.printf("[simulator] %s -> %s\n", stateName(state), stateName(newState));
+    state = newState;
+  }
+}
+
+static void advance(unsigned long now) {
+  if(state == SIMULATED_RETURNING && now - returnStartedAt >= simulatedReturnDurationMs) {
+    changeState(SIMULATED_DOCKED);
+  }
+  if(unlockPresses > 0 && now - firstUnlockPressAt > simulatedUnlockWindowMs) {
+    unlockPresses = 0;
+  }
+}
+
+static void onStartPressed() {
+  if(locked || emergency || buttonStop != HIGH) {
+    return;
+  }
+  if(state == SIMULATED_DOCKED || state == SIMULATED_PAUSED) {
+    changeState(SIMULATED_MOWING);
+  }
+}
+
+static void onHomePressed(unsigned long now) {
+  if(locked || emergency || buttonStop != HIGH) {
+    return;
+  }
+  if(state == SIMULATED_MOWING || state == SIMULATED_PAUSED) {
+    returnStartedAt = now;
+    changeState(SIMULATED_RETURNING);
+  }
+}
+
+static void onStopPressed() {
+  if(state == SIMULATED_MOWING || state == SIMULATED_RETURNING) {
+    changeState(SIMULATED_PAUSED);
+  }
+}
+
+static void onLockPressed(unsigned long now) {
+  if(!locked) {
+    locked = true;
+    Serial.println("[simulator] locked");
+    return;
+  }
+
+  if(unlockPresses == 0) {
+    firstUnlockPressAt = now;
+  }
+  if(++unlockPresses >= simulatedUnlockPresses) {
+    locked = false;
+    unlockPresses = 0;
+    Serial.println("[simulator] unlocked");
+  }
+}
+
+void simulatorWritePin(int pin, int value, unsigned long now) {
+  std::lock_guard<std::mutex> guard(simulatorLock);
+  advance(now);
+
+  // buttons act on release, like the real keypad
+  if(pin == pinButtonStart) {
+    if(buttonStart == LOW && value == HIGH) {
+      onStartPressed();
+    }
+    buttonStart = value;
+  } else if(pin == pinButtonHome) {
+    if(buttonHome == LOW && value == HIGH) {
+      onHomePressed(now);
+    }
+    buttonHome = value;
+  } else if(pin == pinButtonLock) {
+    if(buttonLock == LOW && value == HIGH) {
+      onLockPressed(now);
+    }
+    buttonLock = value;
+  } else if(pin == pinButtonStop) {
+    if(buttonStop == LOW && value == HIGH) {
+      onStopPressed();
+    }
+    buttonStop = value;
+  }
+}
+
+int simulatorReadPin(int pin, unsigned long now) {
+  std::lock_guard<std::mutex> guard(simulatorLock);
+  advance(now);
+
+  bool blinkOn = (now / simulatedLedBlinkPeriodMs) % 2 == 0;
+  if(pin == pinLedCharging) {
+    return state == SIMULATED_DOCKED && blinkOn ? HIGH : LOW;
+  }
+  if(pin == pinLedLocked) {
+    return locked && blinkOn ? HIGH : LOW;
+  }
+  if(pin == pinLedEmergency) {
+    return emergency ? HIGH : LOW;
+  }
+  if(pin == pinIdle) {
+    return idle ? LOW : HIGH;
+  }
+  return LOW;
+}
+
+SimulatedMowerState simulatorState() {
+  std::lock_guard<std::mutex> guard(simulatorLock);
+  return state;
+}
+
+void simulatorSetEmergency(bool emergencyActive) {
+  std::lock_guard<std::mutex> guard(simulatorLock);
+  emergency = emergencyActive;
+  if(emergency && state == SIMULATED_MOWING) {
+    changeState(SIMULATED_PAUSED);
+  }
+}
+
+void simulatorSetIdle(bool idleActive) {
+  std::lock_guard<std::mutex> guard(simulatorLock);
+  idle = idleActive;
+}
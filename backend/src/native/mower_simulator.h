@@ -0,0 +1,26 @@
+#ifndef MOWER_SIMULATOR_H
+#define MOWER_SIMULATOR_H
+
+// Simulated mower for the native build.
+// Reacts to the button pins like the CoverUI does and drives the led pins:
+// start/home/lock are active low, stop is pressed while high.
+
+enum SimulatedMowerState {
+  SIMULATED_DOCKED,
+  SIMULATED_MOWING,
+  SIMULATED_PAUSED,
+  SIMULATED_RETURNING
+};
+
+const unsigned long simulatedLedBlinkPeriodMs = 500;
+const unsigned long simulatedReturnDurationMs = 10000;
+const unsigned long simulatedUnlockWindowMs = 3000;
+const int simulatedUnlockPresses = 4;
+
+void simulatorWritePin(int pin, int value, unsigned long now);
+int simulatorReadPin(int pin, unsigned long now);
+SimulatedMowerState simulatorState();
+void simulatorSetEmergency(bool emergency);
+void simulatorSetIdle(bool idle);
+
+#endif
@@ -0,0 +1,202 @@
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <vector>
+#include <string>
+#include "ram_fs.h"
+
+typedef std::vector<uint8_t> RamFileData;
+typedef std::shared_ptr<RamFileData> RamFileDataPtr;
+
+struct RamFSState {
+  size_t capacity;
+  std::mutex lock;
+  std::map<std::string, RamFileDataPtr> files;
+
+  size_t used() {
+    size_t total = 0;
+    for(auto &entry : files) {
+      total += entry.second->size();
+    }
+    return total;
+  }
+};
+
+class RamFileImpl : public fs::FileImpl {
+  public:
+    RamFileImpl(std::shared_ptr<RamFSState> fsState, const std::string &path, RamFileDataPtr fileData, bool openWritable, bool openAppend)
+      : state(fsState), filePath(path), data(fileData), writable(openWritable), append(openAppend), offset(0), open(true) {
+      size_t slash = filePath.find_last_of('/');
+      fileName = slash == std::string::npos ? filePath : filePath.substr(slash + 1);
+    }
+
+    // directory handle
+    RamFileImpl(std::shared_ptr<RamFSState> fsState, const std::string &path)
+      : state(fsState), filePath(path), fileName(path), writable(false), append(false), offset(0), open(true) {}
+
+    size_t write(const uint8_t *buffer, size_t size) override {
+      if(!open || !data || !writable) {
+        return 0;
+      }
+      std::lock_guard<std::mutex> guard(state->lock);
+      if(state->used() + size > state->capacity) {
+        size = state->capacity > state->used() ? state->capacity - state->used() : 0;
+      }
+      if(append) {
+        offset = data->size();
+      }
+      if(offset + size > data->size()) {
+        data->resize(offset + size);
+      }
+      memcpy(data->data() + offset, buffer, size);
+      offset += size;
+      return size;
+    }
+
+    size_t read(uint8_t *buffer, size_t size) override {
+      if(!open || !data) {
+        return 0;
+      }
+      std::lock_guard<std::mutex> guard(state->lock);
+      if(offset >= data->size()) {
+        return 0;
+      }
+      size_t count = std::min(size, data->size() - offset);
+      memcpy(buffer, data->data() + offset, count);
+      offset += count;
+      return count;
+    }
+
+    void flush() override {}
+
+    bool seek(uint32_t position, fs::SeekMode mode) override {
+      if(!data) {
+        return false;
+      }
+      size_t base = mode == fs::SeekSet ? 0 : mode == fs::SeekCur ? offset : data->size();
+      if(base + position > data->size()) {
+        return false;
+      }
+      offset = base + position;
+      return true;
+    }
+
+    size_t position() const override { return offset; }
+    size_t size() const override { return data ? data->size() : 0; }
+    void close() override { open = false; }
+    const char *path() const override { return filePath.c_str(); }
+    const char *name() const override { return fileName.c_str(); }
+    bool isDirectory() override { return !data; }
+    operator bool() override { return open; }
+
+    fs::FileImplPtr openNextFile(const char *mode) override {
+      if(data) {
+        return fs::FileImplPtr();
+      }
+      std::lock_guard<std::mutex> guard(state->lock);
+      auto entry = state->files.upper_bound(lastListed);
+      if(entry == state->files.end()) {
+        return fs::FileImplPtr();
+      }
+      lastListed = entry->first;
+      return std::make_shared<RamFileImpl>(state, entry->first, entry->second, false, false);
+    }
+
+  private:
+    std::shared_ptr<RamFSState> state;
+    std::string filePath;
+    std::string fileName;
+    RamFileDataPtr data;
+    bool writable;
+    bool append;
+    size_t offset;
+    bool open;
+    std::string lastListed;
+};
+
+class RamFSImpl : public fs::FSImpl {
+  public:
+    RamFSImpl(std::shared_ptr<RamFSState> fsState) : state(fsState) {}
+
+    fs::FileImplPtr open(const char *path, const char *mode, bool create) override {
+      std::string filePath(path);
+      if(filePath == "/") {
+        return std::make_shared<RamFileImpl>(state, filePath);
+      }
+
+      std::lock_guard<std::mutex> guard(state->lock);
+      auto entry = state->files.find(filePath);
+      bool plus = strchr(mode, '+') != NULL;
+
+      if(mode[0] == 'r') {
+        if(entry == state->files.end()) {
+          return fs::FileImplPtr();
+        }
+        return std::make_shared<RamFileImpl>(state, filePath, entry->second, plus, false);
+      }
+
+      if(mode[0] == 'w' || entry == state->files.end()) {
+        RamFileDataPtr data = std::make_shared<RamFileData>();
+        state->files[filePath] = data;
+        return std::make_shared<RamFileImpl>(state, filePath, data, true, mode[0] == 'a');
+      }
+
+      // append
+      return std::make_shared<RamFileImpl>(state, filePath, entry->second, true, true);
+    }
+
+    bool exists(const char *path) override {
+      std::lock_guard<std::mutex> guard(state->lock);
+      return state->files.count(path) > 0;
+    }
+
+    bool rename(const char *pathFrom, const char *pathTo) override {
+      std::lock_guard<std::mutex> guard(state->lock);
+      auto entry = state->files.find(pathFrom);
+      if(entry == state->files.end()) {
+        return false;
+      }
+      RamFileDataPtr data = entry->second;
+      state->files.erase(entry);
+      state->files[pathTo] = data;
+      return true;
+    }
+
+    bool remove(const char *path) override {
+      std::lock_guard<std::mutex> guard(state->lock);
+      return state->files.erase(path) > 0;
+    }
+
+    // flat namespace, like spiffs
+    bool mkdir(const char *path) override { return true; }
+    bool rmdir(const char *path) override { return true; }
+
+    std::shared_ptr<RamFSState> fileSystemState() { return state; }
+
+  private:
+    std::shared_ptr<RamFSState> state;
+};
+
+static std::shared_ptr<RamFSState> createState(size_t capacity) {
+  std::shared_ptr<RamFSState> state = std::make_shared<RamFSState>();
+  state->capacity = capacity;
+  return state;
+}
+
+RamFS::RamFS(size_t capacity) : fs::FS(std::make_shared<RamFSImpl>(createState(capacity))) {}
+
+size_t RamFS::totalBytes() {
+  return std::static_pointer_cast<RamFSImpl>(impl)->fileSystemState()->capacity;
+}
+
+size_t RamFS::usedBytes() {
+  std::shared_ptr<RamFSState> state = std::static_pointer_cast<RamFSImpl>(impl)->fileSystemState();
+  std::lock_guard<std::mutex> guard(state->lock);
+  return state->used();
+}
+
+void RamFS::clear() {
+  std::shared_ptr<RamFSState> state = std::static_pointer_cast<RamFSImpl>(impl)->fileSystemState();
+  std::lock_guard<std::mutex> guard(state->lock);
+  state->files.clear();
+}
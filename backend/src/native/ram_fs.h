@@ -0,0 +1,15 @@
+#ifndef RAM_FS_H
+#define RAM_FS_H
+
+#include <FS.h>
+
+// In-memory filesystem for the native build, sized like the spiffs partition.
+class RamFS : public fs::FS {
+  public:
+    RamFS(size_t capacity = 0x100000);
+    size_t totalBytes();
+    size_t usedBytes();
+    void clear();
+};
+
+#endif
@@ -0,0 +1,136 @@
+#include <atomic>
+#include "hal.h"
+#include "pin_sampler.h"
+#include "pins.h"
+#include "logger.h"
+#include "metrics.h"
+
+// packed snapshot: bit 0-3 states, bit 4 valid, bit 8-31 version
+// one 32 bit word, so readers never see a half updated snapshot
+static std::atomic<uint32_t> packedSnapshot(0);
+
+static const uint32_t snapshotBitCharging = 1 << 0;
+static const uint32_t snapshotBitLocked = 1 << 1;
+static const uint32_t snapshotBitEmergency = 1 << 2;
+static const uint32_t snapshotBitIdle = 1 << 3;
+static const uint32_t snapshotBitValid = 1 << 4;
+static const uint32_t snapshotStateMask = 0xff;
+static const int snapshotVersionShift = 8;
+static std::atomic<void (*)()> snapshotListener(nullptr);
+
+struct BlinkingLed {
+  int pin;
+  unsigned long lastSeenHigh;
+  bool seenHigh;
+};
+
+struct DebouncedPin {
+  int pin;
+  int stableLevel;
+  int candidateLevel;
+  uint8_t candidateCount;
+};
+
+static bool sampleBlinkingLed(BlinkingLed &led, unsigned long now) {
+  if(halDigitalRead(led.pin) == HIGH) {
+    led.lastSeenHigh = now;
+    led.seenHigh = true;
+  }
+  return led.seenHigh && (now - led.lastSeenHigh) < ledBlinkWindowMs;
+}
+
+static int sampleDebouncedPin(DebouncedPin &input) {
+  int level = halDigitalRead(input.pin);
+  if(level == input.stableLevel) {
+    input.candidateCount = 0;
+    return input.stableLevel;
+  }
+
+  if(level != input.candidateLevel) {
+    input.candidateLevel = level;
+    input.candidateCount = 0;
+  }
+  if(++input.candidateCount >= pinDebounceSamples) {
+    input.stableLevel = level;
+    input.candidateCount = 0;
+  }
+  return input.stableLevel;
+}
+
+static void publishSnapshot(uint32_t states) {
+  uint32_t current = packedSnapshot.load(std::memory_order_relaxed);
+  if((current & snapshotStateMask) == states) {
+    return;
+  }
+
+  uint32_t version = (current >> snapshotVersionShift) + 1;
+  packedSnapshot.store((version << snapshotVersionShift) | states, std::memory_order_release);
+
+  void (*listener)() = snapshotListener.load(std::memory_order_acquire);
+  if(listener && (states & snapshotBitValid)) {
+    listener();
+  }
+}
+
+static void pinSamplerTask(void *parameter) {
+  BlinkingLed ledCharging = { pinLedCharging, 0, false };
+  BlinkingLed ledLocked = { pinLedLocked, 0, false };
+  DebouncedPin ledEmergency = { pinLedEmergency, halDigitalRead(pinLedEmergency), LOW, 0 };
+  DebouncedPin idle = { pinIdle, halDigitalRead(pinIdle), LOW, 0 };
+  unsigned long startedAt = halMillis();
+
+  unsigned long lastWakeTime = startedAt;
+  for(;;) {
+    unsigned long roundStartedMicros = halMicros();
+    unsigned long now = halMillis();
+    uint32_t states = 0;
+
+    if(sampleBlinkingLed(ledCharging, now)) {
+      states |= snapshotBitCharging;
+    }
+    if(sampleBlinkingLed(ledLocked, now)) {
+      states |= snapshotBitLocked;
+    }
+    if(sampleDebouncedPin(ledEmergency) == HIGH) {
+      states |= snapshotBitEmergency;
+    }
+    if(sampleDebouncedPin(idle) != HIGH) {
+      states |= snapshotBitIdle;
+    }
+    // blinking leds are only known after one full blink window
+    if(now - startedAt >= ledBlinkWindowMs) {
+      states |= snapshotBitValid;
+    }
+
+    publishSnapshot(states);
+    recordMetric(METRIC_PIN_SAMPLE, halMicros() - roundStartedMicros);
+    halDelayUntil(lastWakeTime, pinSampleIntervalMs);
+  }
+}
+
+void startPinSampler() {
+  halStartTask(pinSamplerTask, "pinSampler", 2048, 2);
+
+  // wait once on boot for the first complete blink window,
+  // so nobody reads an unknown charging or locked state
+  while(!(packedSnapshot.load(std::memory_order_acquire) & snapshotBitValid)) {
+    halDelay(pinSampleIntervalMs);
+  }
+  LOG_DEBUG("Pin sampler started");
+}
+
+MowerSnapshot getMowerSnapshot() {
+  uint32_t packed = packedSnapshot.load(std::memory_order_acquire);
+
+  MowerSnapshot snapshot;
+  snapshot.isCharging = packed & snapshotBitCharging;
+  snapshot.isLocked = packed & snapshotBitLocked;
+  snapshot.isEmergency = packed & snapshotBitEmergency;
+  snapshot.isIdle = packed & snapshotBitIdle;
+  snapshot.version = packed >> snapshotVersionShift;
+  return snapshot;
+}
+
+void setSnapshotListener(void (*listener)()) {
+  snapshotListener.store(listener, std::memory_order_release);
+}
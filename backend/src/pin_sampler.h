@@ -0,0 +1,27 @@
+#ifndef PIN_SAMPLER_H
+#define PIN_SAMPLER_H
+
+#include <stdint.h>
+
+// the charging and locked leds are blinking, so they count as "on",
+// if they were seen high at least once within this window
+const unsigned long ledBlinkWindowMs = 750;
+const unsigned long pinSampleIntervalMs = 25;
+// emergency and idle have to be stable for this amount of samples
+const uint8_t pinDebounceSamples = 3;
+
+struct MowerSnapshot {
+  bool isCharging;
+  bool isLocked;
+  bool isEmergency;
+  bool isIdle;
+  // incremented on every change of the states above
+  uint32_t version;
+};
+
+void startPinSampler();
+MowerSnapshot getMowerSnapshot();
+// called on the sampler task after every change, must not block
+void setSnapshotListener(void (*listener)());
+
+#endif
@@ -1,28 +1,28 @@
-#include <Arduino.h>
+#include "hal.h"
 #include "pins.h"
 
 void setupPins() {
   // Start
-  pinMode(pinButtonStart, OUTPUT_OPEN_DRAIN);
-  digitalWrite(pinButtonStart, HIGH);
+  halPinMode(pinButtonStart, OUTPUT_OPEN_DRAIN);
+  halDigitalWrite(pinButtonStart, HIGH);
 
   // Home
-  pinMode(pinButtonHome, OUTPUT_OPEN_DRAIN);
-  digitalWrite(pinButtonHome, HIGH);
+  halPinMode(pinButtonHome, OUTPUT_OPEN_DRAIN);
+  halDigitalWrite(pinButtonHome, HIGH);
 
   // Stop
-  pinMode(pinButtonStop, OUTPUT_OPEN_DRAIN);
-  digitalWrite(pinButtonStop, LOW);
+  halPinMode(pinButtonStop, OUTPUT_OPEN_DRAIN);
+  halDigitalWrite(pinButtonStop, LOW);
 
   // Locked
-  pinMode(pinButtonLock, OUTPUT_OPEN_DRAIN);
-  digitalWrite(pinButtonLock, HIGH);
+  halPinMode(pinButtonLock, OUTPUT_OPEN_DRAIN);
+  halDigitalWrite(pinButtonLock, HIGH);
 
   // Check LEDs
-  pinMode(pinLedCharging, INPUT);
-  pinMode(pinLedLocked, INPUT);
-  pinMode(pinLedEmergency, INPUT);
+  halPinMode(pinLedCharging, INPUT);
+  halPinMode(pinLedLocked, INPUT);
+  halPinMode(pinLedEmergency, INPUT);
 
   // Check Power on Pin5 (Idle)
-  pinMode(pinIdle, INPUT);
+  halPinMode(pinIdle, INPUT);
 }
\ No newline at end of file
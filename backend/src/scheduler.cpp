@@ -0,0 +1,127 @@
+#include <mutex>
+#include <chrono>
+#include <condition_variable>
+#include "hal.h"
+#include "scheduler.h"
+#include "metrics.h"
+
+struct ScheduledJob {
+  const char *name;
+  ScheduledJobCallback callback;
+  unsigned long intervalMs;
+  unsigned long dueAt;
+  bool active;
+};
+
+static ScheduledJob jobs[maxScheduledJobs];
+static int jobCount = 0;
+static std::mutex schedulerLock;
+static std::condition_variable schedulerWakeup;
+static bool wakeupPending = false;
+static unsigned long wakeups = 0;
+// set while runScheduler() waits, with the deadline it waits for
+static bool schedulerSleeping = false;
+static unsigned long sleepingUntil = 0;
+
+static bool isDue(const ScheduledJob &job, unsigned long now) {
+  return (long)(now - job.dueAt) >= 0;
+}
+
+// under schedulerLock, wakes the loop only if it would sleep past dueAt. A job calling
+// this runs on the loop task, which picks up the new deadline before it sleeps again.
+static void wakeSchedulerBefore(unsigned long dueAt) {
+  if(schedulerSleeping && (long)(dueAt - sleepingUntil) < 0) {
+    wakeupPending = true;
+    schedulerWakeup.notify_one();
+  }
+}
+
+int addScheduledJob(const char *name, ScheduledJobCallback callback, unsigned long intervalMs, unsigned long firstDelayMs) {
+  std::lock_guard<std::mutex> guard(schedulerLock);
+  if(jobCount >= maxScheduledJobs) {
+    return -1;
+  }
+
+  int jobId = jobCount++;
+  jobs[jobId] = { name, callback, intervalMs, halMillis() + firstDelayMs, true };
+  wakeSchedulerBefore(jobs[jobId].dueAt);
+  return jobId;
+}
+
+void rescheduleJob(int jobId, unsigned long delayMs) {
+  std::lock_guard<std::mutex> guard(schedulerLock);
+  if(jobId < 0 || jobId >= jobCount) {
+    return;
+  }
+
+  jobs[jobId].dueAt = halMillis() + delayMs;
+  jobs[jobId].active = true;
+  wakeSchedulerBefore(jobs[jobId].dueAt);
+}
+
+void cancelJob(int jobId) {
+  std::lock_guard<std::mutex> guard(schedulerLock);
+  if(jobId >= 0 && jobId < jobCount) {
+    jobs[jobId].active = false;
+  }
+}
+
+void runScheduler() {
+  unsigned long startedAt = halMicros();
+  for(int i = 0; i < maxScheduledJobs; i++) {
+    ScheduledJobCallback callback = NULL;
+    {
+      std::lock_guard<std::mutex> guard(schedulerLock);
+      if(i >= jobCount) {
+        break;
+      }
+
+      ScheduledJob &job = jobs[i];
+      if(job.active && isDue(job, halMillis())) {
+        callback = job.callback;
+        if(job.intervalMs > 0) {
+          // keep the period stable, but don't catch up on missed runs
+          job.dueAt += job.intervalMs;
+          if(isDue(job, halMillis())) {
+            job.dueAt = halMillis() + job.intervalMs;
+          }
+        } else {
+          job.active = false;
+        }
+      }
+    }
+
+    // run without the lock, jobs may reschedule themselves
+    if(callback) {
+      callback();
+    }
+  }
+  recordMetric(METRIC_LOOP, halMicros() - startedAt);
+
+  std::unique_lock<std::mutex> lock(schedulerLock);
+  unsigned long now = halMillis();
+  unsigned long sleepMs = maxSchedulerSleepMs;
+  for(int i = 0; i < jobCount; i++) {
+    if(!jobs[i].active) {
+      continue;
+    }
+    if(isDue(jobs[i], now)) {
+      return;
+    }
+    if(jobs[i].dueAt - now < sleepMs) {
+      sleepMs = jobs[i].dueAt - now;
+    }
+  }
+
+  sleepingUntil = now + sleepMs;
+  schedulerSleeping = true;
+  schedulerWakeup.wait_for(lock, std::chrono::milliseconds(sleepMs), [] { return wakeupPending; });
+  schedulerSleeping = false;
+  wakeupPending = false;
+  wakeups++;
+}
+
+unsigned long getSchedulerWakeups() {
+  std::lock_guard<std::mutex> guard(schedulerLock);
+  return wakeups;
+}
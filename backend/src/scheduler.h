@@ -0,0 +1,23 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+// Deadline scheduler for the arduino loop.
+// Subsystems register periodic or one-shot jobs, loop() runs the due ones
+// and sleeps until the next deadline, or until another task (re)schedules a job before it.
+
+typedef void (*ScheduledJobCallback)();
+
+const int maxScheduledJobs = 16;
+// upper bound for one sleep, so a lost wake up can't stall the loop forever
+const unsigned long maxSchedulerSleepMs = 10UL * 60 * 1000;
+
+// intervalMs 0 means one-shot, returns the job id or -1 if no slot is free
+int addScheduledJob(const char *name, ScheduledJobCallback callback, unsigned long intervalMs, unsigned long firstDelayMs = 0);
+// (re)arms a job to run after delayMs, also one-shot jobs that already ran
+void rescheduleJob(int jobId, unsigned long delayMs);
+void cancelJob(int jobId);
+// runs all due jobs, then sleeps until the next deadline or a wake up
+void runScheduler();
+unsigned long getSchedulerWakeups();
+
+#endif
@@ -0,0 +1,352 @@
+#include <mutex>
+#include <stddef.h>
+#include <string.h>
+#include "state_history.h"
+#include "hal.h"
+#include "logger.h"
+#include "log_codec.h"
+#include "scheduler.h"
+
+static const char *historyPath = "/history.bin";
+static const char *historyTempPath = "/history.bin.tmp";
+static const uint32_t historyMagic = 0x54534948; // "HIST"
+static const uint8_t historyVersion = 1;
+
+static const int historyCodeBits = 5;
+static const uint8_t historyCodeMask = (1 << historyCodeBits) - 1;
+static const uint8_t historyCommandCode = 16;
+static const uint8_t historyBootCode = 31;
+static const uint8_t historyUnknownState = 0xff;
+
+struct HistoryFileHeader {
+  uint32_t magic;
+  uint8_t version;
+  uint8_t baseState;
+  uint16_t reserved;
+  uint32_t baseTime;
+  uint32_t lastTime;
+  uint32_t firstIndex;
+  uint32_t length;
+  // of the header up to here and the events
+  uint32_t crc;
+};
+
+struct PendingHistoryEvent {
+  unsigned long millis;
+  uint8_t code;
+};
+
+// recorded on the loop task, read on the async_tcp task for /history
+static std::mutex historyLock;
+static uint8_t historyBuffer[historyBufferSize];
+static size_t historyLength = 0;
+// time and state before the first event in the buffer, they change when events are dropped
+static uint32_t historyBaseTime = 0;
+static uint8_t historyBaseState = historyUnknownState;
+// counts the events ever dropped, the index of the first one in the buffer
+static uint32_t historyFirstIndex = 0;
+static uint32_t historyLastTime = 0;
+static uint8_t historyLastState = historyUnknownState;
+static bool historyChanged = false;
+static PendingHistoryEvent pendingEvents[historyPendingEvents];
+static int pendingCount = 0;
+// a save writes a copy of the buffer, so /history is not held up by the flash write.
+// Saves come from the loop task and a restart on the async_tcp task, one at a time.
+static std::mutex historySaveLock;
+static uint8_t historySaveBuffer[historyBufferSize];
+
+static uint32_t crc32(uint32_t crc, const void *data, size_t length) {
+  const uint8_t *bytes = (const uint8_t *)data;
+  crc = ~crc;
+  for(size_t i = 0; i < length; i++) {
+    crc ^= bytes[i];
+    for(int bit = 0; bit < 8; bit++) {
+      crc = crc & 1 ? (crc >> 1) ^ 0xedb88320u : crc >> 1;
+    }
+  }
+  return ~crc;
+}
+
+static uint32_t historyCrc(const HistoryFileHeader &header, const uint8_t *events) {
+  return crc32(crc32(0, &header, offsetof(HistoryFileHeader, crc)), events, header.length);
+}
+
+static bool decodeEvent(const uint8_t *&position, const uint8_t *end, uint32_t &time, uint8_t &code) {
+  uint64_t value;
+  if(!readVarint(position, end, value)) {
+    return false;
+  }
+  time += value >> historyCodeBits;
+  code = value & historyCodeMask;
+  return true;
+}
+
+static HistoryEvent toHistoryEvent(uint32_t time, uint8_t code) {
+  HistoryEvent event;
+  event.time = time;
+  if(code < historyCommandCode) {
+    event.type = HISTORY_STATE;
+    event.value = code;
+  } else if(code == historyBootCode) {
+    event.type = HISTORY_BOOT;
+    event.value = 0;
+  } else {
+    event.type = HISTORY_COMMAND;
+    event.value = code - historyCommandCode;
+  }
+  return event;
+}
+
+// drops the oldest events until at least size bytes are free
+static void dropOldestEvents(size_t size) {
+  const uint8_t *position = historyBuffer;
+  const uint8_t *end = historyBuffer + historyLength;
+  while(position < end && (size_t)(historyBufferSize - (end - position)) < size) {
+    uint8_t code;
+    if(!decodeEvent(position, end, historyBaseTime, code)) {
+      position = end;
+      break;
+    }
+    if(code < historyCommandCode) {
+      historyBaseState = code;
+    }
+    historyFirstIndex++;
+  }
+  historyLength = end - position;
+  memmove(historyBuffer, position, historyLength);
+}
+
+static void appendEvent(uint32_t time, uint8_t code) {
+  if(historyLength == 0) {
+    historyBaseTime = time;
+    historyLastTime = time;
+  }
+  // the clock was set back, keep the order
+  if(time < historyLastTime) {
+    time = historyLastTime;
+  }
+
+  uint8_t record[10];
+  size_t length = writeVarint(record, ((uint64_t)(time - historyLastTime) << historyCodeBits) | code);
+  if(historyLength + length > historyBufferSize) {
+    // in blocks, so it does not move the buffer for every event
+    dropOldestEvents(historyBufferSize / 8 + length);
+  }
+  memcpy(historyBuffer + historyLength, record, length);
+  historyLength += length;
+  historyLastTime = time;
+  historyChanged = true;
+}
+
+// dates back the events recorded before the time was set
+static void appendPendingEvents(uint32_t now) {
+  unsigned long millis = halMillis();
+  for(int i = 0; i < pendingCount; i++) {
+    uint32_t age = (millis - pendingEvents[i].millis) / 1000;
+    appendEvent(age < now ? now - age : 0, pendingEvents[i].code);
+  }
+  pendingCount = 0;
+}
+
+bool getHistoryTime(uint32_t &time) {
+  struct tm timeinfo;
+  if(!halGetLocalTime(&timeinfo)) {
+    return false;
+  }
+  time = toLogEpochSeconds(timeinfo);
+  return true;
+}
+
+static void recordEvent(uint8_t code) {
+  uint32_t now;
+  bool timeSet = getHistoryTime(now);
+  std::lock_guard<std::mutex> guard(historyLock);
+  if(code < historyCommandCode) {
+    historyLastState = code;
+  }
+  if(timeSet) {
+    appendPendingEvents(now);
+    appendEvent(now, code);
+    return;
+  }
+
+  if(pendingCount == historyPendingEvents) {
+    memmove(pendingEvents, pendingEvents + 1, (historyPendingEvents - 1) * sizeof(PendingHistoryEvent));
+    pendingCount--;
+  }
+  pendingEvents[pendingCount].millis = halMillis();
+  pendingEvents[pendingCount].code = code;
+  pendingCount++;
+}
+
+void recordStateHistory(const MowerSnapshot &snapshot) {
+  uint8_t state = (snapshot.isCharging ? historyCharging : 0) | (snapshot.isLocked ? historyLocked : 0)
+    | (snapshot.isEmergency ? historyEmergency : 0) | (snapshot.isIdle ? historyIdle : 0);
+  {
+    std::lock_guard<std::mutex> guard(historyLock);
+    if(state == historyLastState) {
+      return;
+    }
+  }
+  recordEvent(state);
+}
+
+void recordCommandHistory(CommandType type) {
+  recordEvent(historyCommandCode + type);
+}
+
+// written whole through a temp file, like the config store, with historySaveLock held
+static bool saveHistory(const HistoryFileHeader &header) {
+  File file = halFileSystem().open(historyTempPath, "w");
+  if(!file) {
+    LOG_ERROR("Failed to open file for writing: %s", historyTempPath);
+    return false;
+  }
+  bool written = file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header)
+    && file.write(historySaveBuffer, header.length) == header.length;
+  file.close();
+  if(!written) {
+    LOG_ERROR("Failed to write to file: %s", historyTempPath);
+    halFileSystem().remove(historyTempPath);
+    return false;
+  }
+
+  halFileSystem().remove(historyPath);
+  if(!halFileSystem().rename(historyTempPath, historyPath)) {
+    LOG_ERROR("Failed to replace file: %s", historyPath);
+    return false;
+  }
+  return true;
+}
+
+static void loadHistory() {
+  if(halFileSystem().exists(historyTempPath) && !halFileSystem().exists(historyPath)) {
+    // cut after the old file was removed, the temp file is complete
+    halFileSystem().rename(historyTempPath, historyPath);
+  }
+  if(!halFileSystem().exists(historyPath)) {
+    return;
+  }
+  File file = halFileSystem().open(historyPath, "r");
+  if(!file) {
+    return;
+  }
+  HistoryFileHeader header;
+  bool valid = file.read((uint8_t *)&header, sizeof(header)) == sizeof(header)
+    && header.magic == historyMagic && header.version == historyVersion && header.length <= historyBufferSize
+    && file.read(historyBuffer, header.length) == header.length && header.crc == historyCrc(header, historyBuffer);
+  file.close();
+  if(!valid) {
+    LOG_ERROR("Unknown format of %s, starting a new history", historyPath);
+    return;
+  }
+
+  historyLength = header.length;
+  historyBaseTime = header.baseTime;
+  historyBaseState = header.baseState;
+  historyFirstIndex = header.firstIndex;
+  historyLastTime = header.lastTime;
+  LOG_INFO("Loaded %u bytes of state history", (unsigned int)historyLength);
+}
+
+static void runHistoryJob() {
+  uint32_t now;
+  bool timeSet = getHistoryTime(now);
+  std::lock_guard<std::mutex> saveGuard(historySaveLock);
+  HistoryFileHeader header;
+  memset(&header, 0, sizeof(header));
+  {
+    std::lock_guard<std::mutex> guard(historyLock);
+    if(timeSet && pendingCount > 0) {
+      appendPendingEvents(now);
+    }
+    if(!historyChanged) {
+      return;
+    }
+    header.magic = historyMagic;
+    header.version = historyVersion;
+    header.baseState = historyBaseState;
+    header.baseTime = historyBaseTime;
+    header.lastTime = historyLastTime;
+    header.firstIndex = historyFirstIndex;
+    header.length = historyLength;
+    memcpy(historySaveBuffer, historyBuffer, historyLength);
+    historyChanged = false;
+  }
+
+  header.crc = historyCrc(header, historySaveBuffer);
+  if(!saveHistory(header)) {
+    // tried again with the next save
+    std::lock_guard<std::mutex> guard(historyLock);
+    historyChanged = true;
+  }
+}
+
+void initializeStateHistory() {
+  {
+    std::lock_guard<std::mutex> guard(historyLock);
+    loadHistory();
+  }
+  recordEvent(historyBootCode);
+  recordStateHistory(getMowerSnapshot());
+  addScheduledJob("stateHistory", runHistoryJob, historySaveIntervalMs, historySaveIntervalMs);
+}
+
+void flushStateHistory() {
+  runHistoryJob();
+}
+
+int readStateHistory(uint32_t from, uint32_t to, uint32_t &cursor, HistoryEvent *events, int maxEvents) {
+  std::lock_guard<std::mutex> guard(historyLock);
+  const uint8_t *position = historyBuffer;
+  const uint8_t *end = historyBuffer + historyLength;
+  uint32_t time = historyBaseTime;
+  uint8_t state = historyBaseState;
+  uint32_t index = historyFirstIndex;
+  int count = 0;
+
+  // cursor is the index of the next event + 1, 0 before the state at from was returned
+  while(position < end && count < maxEvents) {
+    uint8_t code;
+    if(!decodeEvent(position, end, time, code) || time > to) {
+      break;
+    }
+    if(time >= from) {
+      if(cursor == 0) {
+        cursor = index + 1;
+        if(state != historyUnknownState) {
+          events[count++] = toHistoryEvent(from, state);
+          if(count == maxEvents) {
+            break;
+          }
+        }
+      }
+      if(index + 1 >= cursor) {
+        events[count++] = toHistoryEvent(time, code);
+        cursor = index + 2;
+      }
+    }
+    if(code < historyCommandCode) {
+      state = code;
+    }
+    index++;
+  }
+
+  // nothing happened between from and to, the state at from held all along
+  if(cursor == 0 && maxEvents > 0) {
+    cursor = index + 1;
+    if(state != historyUnknownState && from <= to) {
+      events[count++] = toHistoryEvent(from, state);
+    }
+  }
+  return count;
+}
+
+const char *historyEventTypeName(HistoryEventType type) {
+  switch(type) {
+    case HISTORY_STATE: return "state";
+    case HISTORY_COMMAND: return "command";
+    case HISTORY_BOOT: return "boot";
+  }
+  return "unknown";
+}
@@ -0,0 +1,55 @@
+#ifndef STATE_HISTORY_H
+#define STATE_HISTORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "pin_sampler.h"
+#include "command_executor.h"
+
+// History of the mower states and the commands played, for /history.
+// Kept in a RAM buffer of historyBufferSize bytes, the oldest events are dropped when it is full,
+// saved to /history.bin every historySaveIntervalMs if something changed and by flushStateHistory().
+//
+// event: varint (seconds since the previous event << 5 | code)
+// code 0-15: the new state, bits below, 16 + CommandType: a command was played, 31: the device booted
+// A state change takes 2 bytes if it comes within 8 minutes, 3 bytes within 18 hours.
+// Times are local wall clock seconds since 1970 like the log. Events before the time is set
+// wait in RAM, at most historyPendingEvents, and are dated back once it is.
+
+const size_t historyBufferSize = 8192;
+const unsigned long historySaveIntervalMs = 300000;
+const int historyPendingEvents = 16;
+
+const uint8_t historyCharging = 1 << 0;
+const uint8_t historyLocked = 1 << 1;
+const uint8_t historyEmergency = 1 << 2;
+const uint8_t historyIdle = 1 << 3;
+
+enum HistoryEventType : uint8_t {
+  HISTORY_STATE,
+  HISTORY_COMMAND,
+  HISTORY_BOOT
+};
+
+struct HistoryEvent {
+  uint32_t time;
+  HistoryEventType type;
+  // the state bits above or the CommandType
+  uint8_t value;
+};
+
+// loads /history.bin, records the boot and schedules the saving, see scheduler.h
+void initializeStateHistory();
+// both only record changes, called on the loop task
+void recordStateHistory(const MowerSnapshot &snapshot);
+void recordCommandHistory(CommandType type);
+// saves now if anything changed, e.g. before a restart
+void flushStateHistory();
+// copies up to maxEvents events with from <= time <= to into events, returns their count, 0 at the end.
+// Start with cursor 0, it is moved behind the events returned. The first event is the state at from.
+int readStateHistory(uint32_t from, uint32_t to, uint32_t &cursor, HistoryEvent *events, int maxEvents);
+// local wall clock seconds since 1970, false while the time is not set
+bool getHistoryTime(uint32_t &time);
+const char *historyEventTypeName(HistoryEventType type);
+
+#endif
@@ -0,0 +1,117 @@
+#include <string.h>
+#include "status_json.h"
+#include "hal.h"
+#include "mower.h"
+
+static uint32_t statusVersion = 0;
+static uint32_t statusInputsHash = 0;
+
+// the body fits into the first window, a slot is mostly free again right away
+static const int statusResponseSlotCount = 4;
+static JsonResponseSlot statusResponseSlots[statusResponseSlotCount];
+static StatusInputs statusResponseInputs[statusResponseSlotCount];
+static JsonResponsePool statusResponsePool = {
+  statusResponseSlots, statusResponseSlotCount, writeStatusJsonPart, statusResponseInputs, sizeof(StatusInputs)
+};
+
+void readStatusInputs(StatusInputs &inputs, bool apMode, const char *apName) {
+  inputs.timeAvailable = halGetLocalTime(&inputs.timeinfo);
+  // read from the pin sampler, never blocks
+  inputs.snapshot = getMowerSnapshot();
+  inputs.apMode = apMode;
+  halNetworkHostname(inputs.hostname, sizeof(inputs.hostname));
+  if(apMode) {
+    snprintf(inputs.ssid, sizeof(inputs.ssid), "%s", apName);
+  } else {
+    halNetworkSSID(inputs.ssid, sizeof(inputs.ssid));
+  }
+  halNetworkIP(apMode, inputs.ip, sizeof(inputs.ip));
+  inputs.mowingPlanActive = isCurrentMovingPlanActive();
+}
+
+bool writeStatusJsonPart(JsonStream &stream, int part, void *context) {
+  if(part > 0) {
+    return false;
+  }
+  const StatusInputs &inputs = *(const StatusInputs *)context;
+  jsonBeginObject(stream);
+
+  // time and date on mower
+  jsonKey(stream, "date");
+  if(inputs.timeAvailable) {
+    char date[11];
+    strftime(date, sizeof(date), "%Y-%m-%d", &inputs.timeinfo);
+    jsonString(stream, date);
+  } else {
+    jsonNull(stream);
+  }
+  jsonKey(stream, "time");
+  if(inputs.timeAvailable) {
+    char time[6];
+    strftime(time, sizeof(time), "%H:%M", &inputs.timeinfo);
+    jsonString(stream, time);
+  } else {
+    jsonNull(stream);
+  }
+
+  jsonKey(stream, "isCharging");
+  jsonBool(stream, inputs.snapshot.isCharging);
+  jsonKey(stream, "isLocked");
+  jsonBool(stream, inputs.snapshot.isLocked);
+  jsonKey(stream, "isEmergency");
+  jsonBool(stream, inputs.snapshot.isEmergency);
+  jsonKey(stream, "isIdle");
+  jsonBool(stream, inputs.snapshot.isIdle);
+  jsonKey(stream, "isAccessPoint");
+  jsonBool(stream, inputs.apMode);
+  jsonKey(stream, "hostname");
+  jsonString(stream, inputs.hostname);
+  jsonKey(stream, "ssid");
+  jsonString(stream, inputs.ssid);
+  jsonKey(stream, "ip");
+  jsonString(stream, inputs.ip);
+  jsonKey(stream, "mowingPlanActive");
+  jsonBool(stream, inputs.mowingPlanActive);
+
+  jsonEndObject(stream);
+  return true;
+}
+
+static uint32_t hashStatusInput(uint32_t hash, const void *data, size_t length) {
+  // FNV-1a
+  const uint8_t *bytes = (const uint8_t *)data;
+  for(size_t i = 0; i < length; i++) {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+static uint32_t hashStatusInput(uint32_t hash, const char *text) {
+  return hashStatusInput(hash, text, strlen(text) + 1);
+}
+
+uint32_t updateStatusVersion(const StatusInputs &inputs) {
+  // the body shows the time in minutes, so it changes at least once a minute
+  const struct tm &timeinfo = inputs.timeinfo;
+  int32_t minute = inputs.timeAvailable ? ((timeinfo.tm_year * 366 + timeinfo.tm_yday) * 24 + timeinfo.tm_hour) * 60 + timeinfo.tm_min : -1;
+  uint8_t flags = inputs.apMode | inputs.mowingPlanActive << 1;
+  uint32_t hash = hashStatusInput(2166136261u, &inputs.snapshot.version, sizeof(inputs.snapshot.version));
+  hash = hashStatusInput(hash, &minute, sizeof(minute));
+  hash = hashStatusInput(hash, &flags, sizeof(flags));
+  hash = hashStatusInput(hash, inputs.hostname);
+  hash = hashStatusInput(hash, inputs.ssid);
+  hash = hashStatusInput(hash, inputs.ip);
+  if(statusVersion == 0 || hash != statusInputsHash) {
+    statusInputsHash = hash;
+    statusVersion++;
+  }
+  return statusVersion;
+}
+
+JsonResponseSlot *reserveStatusResponse(const StatusInputs &inputs) {
+  JsonResponseSlot *slot = reserveJsonResponseSlot(statusResponsePool);
+  if(slot) {
+    *(StatusInputs *)slot->context = inputs;
+  }
+  return slot;
+}
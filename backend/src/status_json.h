@@ -0,0 +1,36 @@
+#ifndef STATUS_JSON_H
+#define STATUS_JSON_H
+
+#include <Arduino.h>
+#include <time.h>
+#include "pin_sampler.h"
+#include "json_stream.h"
+
+// The body of /status, which every open browser polls every few seconds. It is built without
+// heap allocations, a response keeps its inputs in a slot of a fixed pool and streams the json
+// from them, so polling does not fragment the heap, see src/native/bench/status_alloc_check.cpp.
+
+struct StatusInputs {
+  bool timeAvailable;
+  struct tm timeinfo;
+  MowerSnapshot snapshot;
+  bool apMode;
+  char hostname[33];
+  char ssid[33];
+  char ip[16];
+  bool mowingPlanActive;
+};
+
+// the ssid is apName in the access point mode
+void readStatusInputs(StatusInputs &inputs, bool apMode, const char *apName);
+// the version of the body for its ETag, changes with the inputs, counted from 1 since boot,
+// call it on one task only
+uint32_t updateStatusVersion(const StatusInputs &inputs);
+// the body is part 0, context the StatusInputs, see json_stream.h
+bool writeStatusJsonPart(JsonStream &stream, int part, void *context);
+// a /status request on the web server task that sends the body: a response slot holding a copy
+// of inputs, streamed with startJsonResponse(), NULL if all are used. A 304 is decided before
+// from the version alone.
+JsonResponseSlot *reserveStatusResponse(const StatusInputs &inputs);
+
+#endif
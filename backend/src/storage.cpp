@@ -0,0 +1,77 @@
+#include <Arduino.h>
+#include "storage.h"
+
+// settings are a few hundred bytes, logs and the frontend stay behind
+static const size_t maxMigratedFileSize = 4096;
+static const size_t maxMigratedBytes = 32768;
+static const int maxMigratedFiles = 16;
+
+struct MigratedFile {
+  String path;
+  uint8_t *data;
+  size_t size;
+};
+
+static bool isMigratedFile(File &file) {
+  String path = file.path();
+  return !file.isDirectory() && file.size() <= maxMigratedFileSize && !path.startsWith("/log-");
+}
+
+static int readMigratedFiles(fs::FS &fileSystem, MigratedFile *files) {
+  int count = 0;
+  size_t totalBytes = 0;
+
+  File root = fileSystem.open("/");
+  File file = root.openNextFile();
+  while(file && count < maxMigratedFiles) {
+    if(isMigratedFile(file) && totalBytes + file.size() <= maxMigratedBytes) {
+      MigratedFile &migrated = files[count];
+      migrated.path = file.path();
+      migrated.size = file.size();
+      migrated.data = (uint8_t *)malloc(migrated.size + 1);
+      if(migrated.data && file.read(migrated.data, migrated.size) == migrated.size) {
+        totalBytes += migrated.size;
+        count++;
+      } else {
+        free(migrated.data);
+      }
+    }
+    file = root.openNextFile();
+  }
+  return count;
+}
+
+static void writeMigratedFiles(fs::FS &fileSystem, MigratedFile *files, int count) {
+  for(int i = 0; i < count; i++) {
+    File file = fileSystem.open(files[i].path, "w");
+    if(!file || file.write(files[i].data, files[i].size) != files[i].size) {
+      Serial.printf("Failed to migrate %s\n", files[i].path.c_str());
+    }
+    file.close();
+    free(files[i].data);
+  }
+}
+
+bool mountStorage(const StorageBackend &backend, const StorageBackend *previous) {
+  if(backend.mount(false)) {
+    return true;
+  }
+
+  // runs before the logger, which needs the filesystem
+  MigratedFile files[maxMigratedFiles];
+  int count = 0;
+  if(previous && previous->mount(false)) {
+    count = readMigratedFiles(previous->fileSystem(), files);
+    previous->unmount();
+    Serial.printf("Migrating %d files from %s to %s\n", count, previous->name, backend.name);
+  }
+
+  if(!backend.mount(true)) {
+    for(int i = 0; i < count; i++) {
+      free(files[i].data);
+    }
+    return false;
+  }
+  writeMigratedFiles(backend.fileSystem(), files, count);
+  return true;
+}
@@ -0,0 +1,25 @@
+#ifndef STORAGE_H
+#define STORAGE_H
+
+#include <FS.h>
+
+// A filesystem on the data partition, behind halFileSystem().
+// The ESP32 has SPIFFS and LittleFS, both use the "spiffs" partition of custom_partition.csv,
+// the native build has RamFS. native/bench/fs_bench.cpp compares SPIFFS and LittleFS.
+
+struct StorageBackend {
+  const char *name;
+  // formats the partition first if it holds no filesystem of this kind and format is set
+  bool (*mount)(bool format);
+  void (*unmount)();
+  fs::FS &(*fileSystem)();
+  size_t (*totalBytes)();
+  size_t (*usedBytes)();
+};
+
+// mounts backend, a partition still formatted for previous is migrated once:
+// the small files are kept in RAM while the partition is formatted and written back,
+// the log starts over
+bool mountStorage(const StorageBackend &backend, const StorageBackend *previous);
+
+#endif
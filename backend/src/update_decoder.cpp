@@ -0,0 +1,388 @@
+#include <stdlib.h>
+#include <string.h>
+#include "update_decoder.h"
+#ifdef NATIVE_BUILD
+#include "miniz.h"
+#else
+// the inflater of the ESP32 ROM, it needs no flash
+#include "rom/miniz.h"
+#endif
+
+static const size_t inflateWindowSize = TINFL_LZ_DICT_SIZE;
+
+static const uint8_t gzipHeaderCrc = 0x02;
+static const uint8_t gzipExtra = 0x04;
+static const uint8_t gzipName = 0x08;
+static const uint8_t gzipComment = 0x10;
+static const uint8_t gzipReserved = 0xe0;
+// magic, method, flags, modification time, extra flags and operating system
+static const uint8_t gzipHeaderLength = 10;
+// crc32 and size of the decoded data
+static const uint8_t gzipTrailerLength = 8;
+
+struct InflateState {
+  tinfl_decompressor decompressor;
+};
+
+enum DecoderState : uint8_t {
+  STATE_GZIP_HEADER,
+  STATE_GZIP_SKIP,
+  STATE_GZIP_EXTRA_LENGTH,
+  STATE_GZIP_STRING,
+  STATE_INFLATE,
+  STATE_GZIP_TRAILER,
+  STATE_HEATSHRINK,
+  STATE_DONE,
+  STATE_ERROR
+};
+
+static uint32_t crcTable[256];
+
+static void initializeCrcTable() {
+  if(crcTable[1] != 0) {
+    return;
+  }
+  for(uint32_t i = 0; i < 256; i++) {
+    uint32_t crc = i;
+    for(int bit = 0; bit < 8; bit++) {
+      crc = crc & 1 ? (crc >> 1) ^ 0xedb88320u : crc >> 1;
+    }
+    crcTable[i] = crc;
+  }
+}
+
+static uint32_t updateCrc32(uint32_t crc, const uint8_t *data, size_t length) {
+  crc = ~crc;
+  for(size_t i = 0; i < length; i++) {
+    crc = crcTable[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+static uint32_t readLittleEndian(const uint8_t *data, uint8_t length) {
+  uint32_t value = 0;
+  for(uint8_t i = length; i > 0; i--) {
+    value = value << 8 | data[i - 1];
+  }
+  return value;
+}
+
+static bool fail(UpdateDecoder &decoder, const char *error) {
+  if(!decoder.error) {
+    decoder.error = error;
+  }
+  decoder.state = STATE_ERROR;
+  return false;
+}
+
+UpdateEncoding getUpdateEncoding(const char *filename) {
+  size_t length = strlen(filename);
+  if(length > 3 && strcmp(filename + length - 3, ".gz") == 0) {
+    return UPDATE_ENCODING_GZIP;
+  }
+  if(length > 3 && strcmp(filename + length - 3, ".hs") == 0) {
+    return UPDATE_ENCODING_HEATSHRINK;
+  }
+  return UPDATE_ENCODING_RAW;
+}
+
+const char *updateEncodingName(UpdateEncoding encoding) {
+  switch(encoding) {
+    case UPDATE_ENCODING_GZIP:
+      return "gzip";
+    case UPDATE_ENCODING_HEATSHRINK:
+      return "heatshrink";
+    default:
+      return "raw";
+  }
+}
+
+// gives the window from flushedPosition on to output, starts over at the end of the window
+static bool flushWindow(UpdateDecoder &decoder) {
+  size_t length = decoder.windowPosition - decoder.flushedPosition;
+  if(length > 0) {
+    const uint8_t *data = decoder.window + decoder.flushedPosition;
+    if(decoder.encoding == UPDATE_ENCODING_GZIP) {
+      decoder.crc = updateCrc32(decoder.crc, data, length);
+    }
+    if(!decoder.output(data, length, decoder.context)) {
+      return fail(decoder, "writing the decoded data failed");
+    }
+    decoder.outputLength += length;
+  }
+  if(decoder.windowPosition == decoder.windowSize) {
+    decoder.windowPosition = 0;
+  }
+  decoder.flushedPosition = decoder.windowPosition;
+  return true;
+}
+
+static inline bool putByte(UpdateDecoder &decoder, uint8_t value) {
+  decoder.window[decoder.windowPosition++] = value;
+  return decoder.windowPosition < decoder.windowSize || flushWindow(decoder);
+}
+
+static bool copyMatch(UpdateDecoder &decoder, size_t distance, size_t length) {
+  size_t mask = decoder.windowSize - 1;
+  size_t from = (decoder.windowPosition - distance) & mask;
+  while(length-- > 0) {
+    decoder.window[decoder.windowPosition++] = decoder.window[from];
+    from = (from + 1) & mask;
+    if(decoder.windowPosition == decoder.windowSize && !flushWindow(decoder)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// collects a fixed size gzip header field in decoder.field, true once it is complete
+static bool readField(UpdateDecoder &decoder, uint8_t length, const uint8_t *&position, const uint8_t *end) {
+  while(decoder.fieldLength < length && position < end) {
+    decoder.field[decoder.fieldLength++] = *position++;
+  }
+  if(decoder.fieldLength < length) {
+    return false;
+  }
+  decoder.fieldLength = 0;
+  return true;
+}
+
+static void nextGzipHeaderField(UpdateDecoder &decoder) {
+  if(decoder.gzipFlags & gzipExtra) {
+    decoder.gzipFlags &= ~gzipExtra;
+    decoder.state = STATE_GZIP_EXTRA_LENGTH;
+  } else if(decoder.gzipFlags & gzipName) {
+    decoder.gzipFlags &= ~gzipName;
+    decoder.state = STATE_GZIP_STRING;
+  } else if(decoder.gzipFlags & gzipComment) {
+    decoder.gzipFlags &= ~gzipComment;
+    decoder.state = STATE_GZIP_STRING;
+  } else if(decoder.gzipFlags & gzipHeaderCrc) {
+    decoder.gzipFlags &= ~gzipHeaderCrc;
+    decoder.remaining = 2;
+    decoder.state = STATE_GZIP_SKIP;
+  } else {
+    tinfl_init(&decoder.inflate->decompressor);
+    decoder.state = STATE_INFLATE;
+  }
+}
+
+// runs tinfl on the input, its output goes straight into the window
+static bool stepInflate(UpdateDecoder &decoder, const uint8_t *&position, const uint8_t *end) {
+  tinfl_decompressor &decompressor = decoder.inflate->decompressor;
+  size_t inputLength = end - position;
+  size_t outputLength = decoder.windowSize - decoder.windowPosition;
+  tinfl_status status = tinfl_decompress(&decompressor, position, &inputLength,
+    decoder.window, decoder.window + decoder.windowPosition, &outputLength, TINFL_FLAG_HAS_MORE_INPUT);
+  position += inputLength;
+  decoder.windowPosition += outputLength;
+  if(decoder.windowPosition == decoder.windowSize && !flushWindow(decoder)) {
+    return false;
+  }
+  if(status < TINFL_STATUS_DONE) {
+    return fail(decoder, "invalid deflate data");
+  }
+  if(status == TINFL_STATUS_NEEDS_MORE_INPUT) {
+    return false;
+  }
+  if(status == TINFL_STATUS_DONE) {
+    // tinfl may have read the first bytes of the trailer into its bit buffer
+    while(decompressor.m_num_bits >= 8 && decoder.fieldLength < gzipTrailerLength) {
+      decoder.field[decoder.fieldLength++] = decompressor.m_bit_buf & 0xff;
+      decompressor.m_bit_buf >>= 8;
+      decompressor.m_num_bits -= 8;
+    }
+    if(decompressor.m_num_bits >= 8) {
+      return fail(decoder, "data after the end of the stream");
+    }
+    decoder.state = STATE_GZIP_TRAILER;
+  }
+  return true;
+}
+
+// one step of the gzip stream, false if it needs more input or failed
+static bool stepGzip(UpdateDecoder &decoder, const uint8_t *&position, const uint8_t *end) {
+  switch(decoder.state) {
+    case STATE_GZIP_HEADER: {
+      if(!readField(decoder, gzipHeaderLength, position, end)) {
+        return false;
+      }
+      if(decoder.field[0] != 0x1f || decoder.field[1] != 0x8b || decoder.field[2] != 8) {
+        return fail(decoder, "not a gzip file");
+      }
+      decoder.gzipFlags = decoder.field[3];
+      if(decoder.gzipFlags & gzipReserved) {
+        return fail(decoder, "unknown gzip flags");
+      }
+      nextGzipHeaderField(decoder);
+      return true;
+    }
+
+    case STATE_GZIP_SKIP:
+      while(decoder.remaining > 0 && position < end) {
+        position++;
+        decoder.remaining--;
+      }
+      if(decoder.remaining > 0) {
+        return false;
+      }
+      nextGzipHeaderField(decoder);
+      return true;
+
+    case STATE_GZIP_EXTRA_LENGTH:
+      if(!readField(decoder, 2, position, end)) {
+        return false;
+      }
+      decoder.remaining = readLittleEndian(decoder.field, 2);
+      decoder.state = STATE_GZIP_SKIP;
+      return true;
+
+    case STATE_GZIP_STRING:
+      // file name or comment, zero terminated
+      while(position < end) {
+        if(*position++ == 0) {
+          nextGzipHeaderField(decoder);
+          return true;
+        }
+      }
+      return false;
+
+    case STATE_INFLATE:
+      return stepInflate(decoder, position, end);
+
+    case STATE_GZIP_TRAILER:
+      if(!readField(decoder, gzipTrailerLength, position, end)) {
+        return false;
+      }
+      if(!flushWindow(decoder)) {
+        return false;
+      }
+      if(readLittleEndian(decoder.field, 4) != decoder.crc) {
+        return fail(decoder, "crc32 mismatch");
+      }
+      if(readLittleEndian(decoder.field + 4, 4) != decoder.outputLength) {
+        return fail(decoder, "size mismatch");
+      }
+      decoder.state = STATE_DONE;
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+// heatshrink bits are read from the top, the tag bit tells a literal from a back reference
+static bool stepHeatshrink(UpdateDecoder &decoder) {
+  if(decoder.bitCount < 1) {
+    return false;
+  }
+  if((decoder.bitBuffer >> (decoder.bitCount - 1)) & 1) {
+    if(decoder.bitCount < 9) {
+      return false;
+    }
+    uint8_t value = decoder.bitBuffer >> (decoder.bitCount - 9);
+    decoder.bitCount -= 9;
+    return putByte(decoder, value);
+  }
+
+  const uint8_t referenceBits = 1 + heatshrinkWindowBits + heatshrinkLookaheadBits;
+  if(decoder.bitCount < referenceBits) {
+    return false;
+  }
+  uint32_t reference = (uint32_t)(decoder.bitBuffer >> (decoder.bitCount - referenceBits));
+  decoder.bitCount -= referenceBits;
+  uint32_t count = (reference & ((1u << heatshrinkLookaheadBits) - 1)) + 1;
+  uint32_t index = ((reference >> heatshrinkLookaheadBits) & ((1u << heatshrinkWindowBits) - 1)) + 1;
+  // like the heatshrink decoder, the window starts out zeroed
+  return copyMatch(decoder, index, count);
+}
+
+bool beginUpdateDecoder(UpdateDecoder &decoder, UpdateEncoding encoding, UpdateOutput output, void *context) {
+  memset(&decoder, 0, sizeof(decoder));
+  decoder.encoding = encoding;
+  decoder.output = output;
+  decoder.context = context;
+
+  if(encoding == UPDATE_ENCODING_GZIP) {
+    initializeCrcTable();
+    decoder.windowSize = inflateWindowSize;
+    decoder.window = (uint8_t *)malloc(decoder.windowSize);
+    decoder.inflate = (InflateState *)malloc(sizeof(InflateState));
+    decoder.state = STATE_GZIP_HEADER;
+  } else if(encoding == UPDATE_ENCODING_HEATSHRINK) {
+    decoder.windowSize = 1 << heatshrinkWindowBits;
+    decoder.window = (uint8_t *)calloc(decoder.windowSize, 1);
+    decoder.state = STATE_HEATSHRINK;
+  }
+
+  if((encoding != UPDATE_ENCODING_RAW && !decoder.window) || (encoding == UPDATE_ENCODING_GZIP && !decoder.inflate)) {
+    endUpdateDecoder(decoder);
+    return fail(decoder, "not enough memory");
+  }
+  return true;
+}
+
+bool writeUpdateDecoder(UpdateDecoder &decoder, const uint8_t *data, size_t length) {
+  if(decoder.state == STATE_ERROR) {
+    return false;
+  }
+  if(decoder.encoding == UPDATE_ENCODING_RAW) {
+    if(length > 0 && !decoder.output(data, length, decoder.context)) {
+      return fail(decoder, "writing the decoded data failed");
+    }
+    decoder.outputLength += length;
+    return true;
+  }
+
+  const uint8_t *position = data;
+  const uint8_t *end = data + length;
+  while(true) {
+    if(decoder.encoding == UPDATE_ENCODING_HEATSHRINK) {
+      while(decoder.bitCount <= 56 && position < end) {
+        decoder.bitBuffer = decoder.bitBuffer << 8 | *position++;
+        decoder.bitCount += 8;
+      }
+    }
+    if(decoder.state == STATE_DONE) {
+      if(position < end) {
+        return fail(decoder, "data after the end of the stream");
+      }
+      break;
+    }
+    bool progressed = decoder.encoding == UPDATE_ENCODING_GZIP ? stepGzip(decoder, position, end) : stepHeatshrink(decoder);
+    if(!progressed) {
+      if(decoder.state == STATE_ERROR) {
+        return false;
+      }
+      if(position == end) {
+        break;
+      }
+    }
+  }
+  return flushWindow(decoder);
+}
+
+bool finishUpdateDecoder(UpdateDecoder &decoder) {
+  if(decoder.state == STATE_ERROR) {
+    return false;
+  }
+  switch(decoder.encoding) {
+    case UPDATE_ENCODING_GZIP:
+      return decoder.state == STATE_DONE || fail(decoder, "the stream ended early");
+    case UPDATE_ENCODING_HEATSHRINK:
+      // the encoder pads the last byte with zero bits
+      if(!flushWindow(decoder)) {
+        return false;
+      }
+      return decoder.bitCount < 8 || fail(decoder, "the stream ended early");
+    default:
+      return true;
+  }
+}
+
+void endUpdateDecoder(UpdateDecoder &decoder) {
+  free(decoder.window);
+  free(decoder.inflate);
+  decoder.window = NULL;
+  decoder.inflate = NULL;
+}
@@ -0,0 +1,75 @@
+#ifndef UPDATE_DECODER_H
+#define UPDATE_DECODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Decompresses an uploaded update image while it streams in, used by firmware_update.cpp.
+// Plain C++, so it builds on the host too, see native/bench/update_bench.cpp.
+//
+// gzip: the gzip header and trailer are read here, the deflate stream in between goes to
+//       tinfl_decompress() of miniz, from the ESP32 ROM, the crc32 and size of the trailer
+//       are checked, the 32 KB window and the tinfl state are the only large buffers
+// heatshrink: raw heatshrink with heatshrinkWindowBits and heatshrinkLookaheadBits,
+//       as written by tools/compress_update.py, the window is 1 KB
+// raw: passed through unchanged
+//
+// The decoded data goes to the output callback in chunks of at most the window size,
+// at the latest when writeUpdateDecoder() returns.
+
+enum UpdateEncoding : uint8_t {
+  UPDATE_ENCODING_RAW,
+  UPDATE_ENCODING_GZIP,
+  UPDATE_ENCODING_HEATSHRINK
+};
+
+const uint8_t heatshrinkWindowBits = 10;
+const uint8_t heatshrinkLookaheadBits = 5;
+
+// false stops the decoder
+typedef bool (*UpdateOutput)(const uint8_t *data, size_t length, void *context);
+
+struct InflateState;
+
+struct UpdateDecoder {
+  UpdateEncoding encoding;
+  UpdateOutput output;
+  void *context;
+  // why the decoder stopped, NULL while it is fine
+  const char *error;
+  uint8_t state;
+
+  // decoded bytes, flushedPosition is the first one not yet given to output
+  uint8_t *window;
+  size_t windowSize;
+  size_t windowPosition;
+  size_t flushedPosition;
+  uint32_t outputLength;
+  uint32_t crc;
+
+  // unread heatshrink input, read from the high bits
+  uint64_t bitBuffer;
+  uint8_t bitCount;
+
+  // gzip header and trailer between calls, the deflate state is in inflate
+  InflateState *inflate;
+  uint8_t gzipFlags;
+  uint32_t remaining;
+  uint8_t field[10];
+  uint8_t fieldLength;
+};
+
+// by the name of the uploaded file: .gz is gzip, .hs heatshrink, anything else raw
+UpdateEncoding getUpdateEncoding(const char *filename);
+const char *updateEncodingName(UpdateEncoding encoding);
+
+// allocates the window, false if there is not enough memory
+bool beginUpdateDecoder(UpdateDecoder &decoder, UpdateEncoding encoding, UpdateOutput output, void *context);
+// false on corrupt input or if output failed, see decoder.error
+bool writeUpdateDecoder(UpdateDecoder &decoder, const uint8_t *data, size_t length);
+// true if the input ended where the stream ends, all data was given to output by then
+bool finishUpdateDecoder(UpdateDecoder &decoder);
+// frees the buffers, also after an error
+void endUpdateDecoder(UpdateDecoder &decoder);
+
+#endif
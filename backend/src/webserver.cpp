@@ -1,243 +1,628 @@
+#include <atomic>
 #include <Arduino.h>
 #include <ESPAsyncWebServer.h>
-#include <SPIFFS.h>
 #include <ArduinoJson.h>
 #include <AsyncJson.h>
-#include <Update.h>
 #include "webserver.h"
+#include "hal.h"
 #include "wifi_utils.h"
 #include "logger.h"
 #include "mower.h"
+#include "pin_sampler.h"
+#include "command_executor.h"
+#include "scheduler.h"
+#include "log_formats.h"
+#include "config_store.h"
+#include "frontend_assets.h"
+#include "firmware_update.h"
+#include "state_history.h"
+#include "mowing_sessions.h"
+#include "metrics.h"
+#include "status_json.h"
 
 // Create Webserver on port 80
 AsyncWebServer server(80);
+// pushes state changes, finished commands and a heartbeat to the browser
+AsyncEventSource events("/events");
+
+static const unsigned long eventHeartbeatMs = 15000;
+static int stateEventsJob = -1;
+static MowerSnapshot lastSentSnapshot;
+static uint32_t lastSentCommandId = 0;
+static std::atomic<uint32_t> lastFinishedCommandId(0);
+static unsigned long lastEventSentAt = 0;
+static uint32_t lastSentUpdateVersion = 0;
+
+// the ETags of /status and /wifis are content versions, the boot id keeps tags of an earlier boot from matching
+static uint32_t etagBootId = 0;
 
 void initializeWebServer() {
-  logMessage("Starting HTTP-Server");
+  LOG_INFO("Starting HTTP-Server");
+  etagBootId = (uint32_t)random(0x7fffffff);
   initializeWebserverRoutes();
+  initializeStateEvents();
 
   server.begin();
-  logMessage("HTTP-Server started");
+  LOG_INFO("HTTP-Server started");
+}
+
+// the handler time goes to /metrics, see metrics.h
+static ArRequestHandlerFunction timedRoute(const char *method, const char *route, ArRequestHandlerFunction handler) {
+  int metric = addRouteMetric(method, route);
+  return [metric, handler](AsyncWebServerRequest *request) {
+    unsigned long startedAt = halMicros();
+    handler(request);
+    recordRouteMetric(metric, halMicros() - startedAt);
+  };
+}
+
+static ArJsonRequestHandlerFunction timedJsonRoute(const char *route, ArJsonRequestHandlerFunction handler) {
+  int metric = addRouteMetric("POST", route);
+  return [metric, handler](AsyncWebServerRequest *request, JsonVariant &json) {
+    unsigned long startedAt = halMicros();
+    handler(request, json);
+    recordRouteMetric(metric, halMicros() - startedAt);
+  };
+}
+
+static void onTimedRoute(const char *route, WebRequestMethod method, ArRequestHandlerFunction handler) {
+  server.on(route, method, timedRoute(method == HTTP_GET ? "GET" : "POST", route, handler));
 }
 
 void initializeWebserverRoutes() {
 // Webserver routes
-  server.serveStatic("/", SPIFFS, "/frontend/").setDefaultFile("index.html").setCacheControl("max-age=86400");
-  server.serveStatic("/log-messages", SPIFFS, "/log-messages.txt").setCacheControl("no-cache, no-store, must-revalidate");
+  // the frontend is embedded into the firmware, files on the filesystem are served only if not embedded
+  for (size_t i = 0; i < frontendAssetCount; i++) {
+    const FrontendAsset *asset = &frontendAssets[i];
+    server.on(asset->path, HTTP_GET, [asset](AsyncWebServerRequest *request) {
+      sendFrontendAsset(request, asset);
+    });
+    if (strcmp(asset->path, "/index.html") == 0) {
+      server.on("/", HTTP_GET, [asset](AsyncWebServerRequest *request) {
+        sendFrontendAsset(request, asset);
+      });
+    }
+  }
+  server.serveStatic("/", halFileSystem(), "/frontend/").setDefaultFile("index.html").setCacheControl("max-age=86400");
 
-  server.on("/start", HTTP_POST, [](AsyncWebServerRequest *request) {
-    startMower(true);
-    request->send(200);
+  // button presses are queued, the response only contains the command id
+  onTimedRoute("/start", HTTP_POST, [](AsyncWebServerRequest *request) {
+    sendCommandAccepted(request, startMower(true));
   });
 
-  server.on("/home", HTTP_POST, [](AsyncWebServerRequest *request) {
-    sendMowerHome(true);
-    request->send(200);
+  onTimedRoute("/home", HTTP_POST, [](AsyncWebServerRequest *request) {
+    sendCommandAccepted(request, sendMowerHome(true));
   });
 
-  server.on("/stop", HTTP_POST, [](AsyncWebServerRequest *request) {
-    logMessage("Stopping mower", 2);
-
-    pressStopButton(150);
-
-    request->send(200);
+  onTimedRoute("/stop", HTTP_POST, [](AsyncWebServerRequest *request) {
+    sendCommandAccepted(request, stopMower());
   });
 
-  server.on("/lock", HTTP_POST, [](AsyncWebServerRequest *request) {
-    if(!isLocked()) {
-      lock();
-    }
-    request->send(200);
+  onTimedRoute("/lock", HTTP_POST, [](AsyncWebServerRequest *request) {
+    sendCommandAccepted(request, lock());
   });
 
-  server.on("/unlock", HTTP_POST, [](AsyncWebServerRequest *request) {
-    if(isLocked()) {
-      unlock();
-    }
-    request->send(200);
+  onTimedRoute("/unlock", HTTP_POST, [](AsyncWebServerRequest *request) {
+    sendCommandAccepted(request, unlock());
   });
 
-  server.on("/status", HTTP_GET, handleGetStatus);
-  server.on("/mowing-plan", HTTP_GET, handleGetMowingPlan);
+  // matches /commands/{id}
+  onTimedRoute("/commands", HTTP_GET, handleGetCommand);
+
+  onTimedRoute("/status", HTTP_GET, handleGetStatus);
+  onTimedRoute("/log-messages", HTTP_GET, handleGetLogMessages);
+  onTimedRoute("/log-files", HTTP_GET, handleGetLogFiles);
+  onTimedRoute("/history", HTTP_GET, handleGetHistory);
+  onTimedRoute("/sessions/summary", HTTP_GET, handleGetSessionSummary);
+  onTimedRoute("/metrics", HTTP_GET, handleGetMetrics);
+  onTimedRoute("/mowing-plan", HTTP_GET, handleGetMowingPlan);
   server.addHandler(createSetMowingPlanHandler());
-  server.on("/wifis", HTTP_GET, handleGetWifis);
+  onTimedRoute("/wifis", HTTP_GET, handleGetWifis);
   server.addHandler(createSetWifiHandler());
   server.addHandler(createSetDateAndTimeHandler());
 
-  // Update route for both firmware and filesystem
+  events.onConnect([](AsyncEventSourceClient *client) {
+    // a (re)connected client gets the full state, deltas follow
+    char body[96];
+    MowerSnapshot snapshot = getMowerSnapshot();
+    formatStateEvent(snapshot, NULL, body, sizeof(body));
+    client->send(body, "state", snapshot.version);
+  });
+  server.addHandler(&events);
+
+  // Update route for both firmware and filesystem, the files may come compressed, see firmware_update.h
   server.on(
       "/update", HTTP_POST,
       [](AsyncWebServerRequest *request) {
-          if (!Update.hasError()) {
+          if (takeFirmwareUpdateResult()) {
               request->send(200, "text/plain", "Update Success!");
+              flushStateHistory();
+              flushLog();
               ESP.restart();
           } else {
               request->send(500, "text/plain", "Update Failed!");
           }
       },
       [](AsyncWebServerRequest *request, String filename, size_t index, uint8_t *data, size_t len, bool final) {
-          if (filename.startsWith("firmware.bin")) {
-              // Firmware-Update
-              if (!index) {
-                  Serial.printf("Firmware-Update Start: %s\n", filename.c_str());
-                  if (!Update.begin(UPDATE_SIZE_UNKNOWN, U_FLASH)) {  // U_FLASH für Firmware
-                      Update.printError(Serial);
-                  }
-              }
-              if (len) {
-                  if (Update.write(data, len) != len) {
-                      Update.printError(Serial);
-                  }
-              }
-              if (final) {
-                  if (Update.end(true)) {
-                      Serial.printf("Firmware-Update Success: %u bytes\n", index + len);
-                  } else {
-                      Update.printError(Serial);
-                  }
-              }
-          } else if (filename.startsWith("filesystem.bin")) {
-              // Filesystem-Update
-              if (!index) {
-                  Serial.printf("Filesystem-Update Start: %s\n", filename.c_str());
-                  if (!Update.begin(UPDATE_SIZE_UNKNOWN, U_SPIFFS)) {  // U_SPIFFS für Filesystem
-                      Update.printError(Serial);
-                  }
-              }
-              if (len) {
-                  if (Update.write(data, len) != len) {
-                      Update.printError(Serial);
-                  }
-              }
-              if (final) {
-                  if (Update.end(true)) {
-                      Serial.printf("Filesystem-Update Success: %u bytes\n", index + len);
-                  } else {
-                      Update.printError(Serial);
-                  }
-              }
+          bool firmware = filename.startsWith("firmware.bin");
+          if (!firmware && !filename.startsWith("filesystem.bin")) {
+              return;
+          }
+          if (!index) {
+              // the digests of the uncompressed images are optional query parameters
+              const char *digestParameter = firmware ? "firmwareSha256" : "filesystemSha256";
+              String sha256 = request->hasParam(digestParameter) ? request->getParam(digestParameter)->value() : String();
+              beginFirmwareUpdate(filename, sha256, request->contentLength());
+          }
+          if (len) {
+              writeFirmwareUpdate(data, len);
+          }
+          if (final) {
+              endFirmwareUpdate();
           }
       }
   );
 }
 
 // handlers
-void handleGetStatus(AsyncWebServerRequest *request) {
-  DynamicJsonDocument doc(2048);
-
-  // time and date on mower
-  struct tm timeinfo;
-  if (!getLocalTime(&timeinfo)) {
-    doc["date"] = nullptr;
-    doc["time"] = nullptr;
-  }else{
-    char dateStr[11];
-    strftime(dateStr, sizeof(dateStr), "%Y-%m-%d", &timeinfo);
-    char timeStr[6];
-      strftime(timeStr, sizeof(timeStr), "%H:%M", &timeinfo);
-
-      doc["date"] = dateStr;
-      doc["time"] = timeStr;
-  }
-
-  doc["isCharging"] = isAttachedToCharger();
-  doc["isLocked"] = isLocked();
-  doc["isEmergency"] = isEmergency();
-  doc["isIdle"] = isIdle();
-  doc["isAccessPoint"] = getApMode();
-  doc["hostname"] = WiFi.getHostname();
-
-  if(getApMode()) {
-    doc["ssid"] = getApName();
-    doc["ip"] = WiFi.softAPIP().toString();
-  }else{
-    doc["ssid"] = WiFi.SSID();
-    doc["ip"] = WiFi.localIP().toString();
-  }
-
-  doc["mowingPlanActive"] = isCurrentMovingPlanActive();
-
-  // send as response
-  String responseString;
-  serializeJson(doc, responseString);
-
-  // send response with no cache
-  AsyncWebServerResponse *response = request->beginResponse(200, "application/json", responseString);
-  response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+void sendFrontendAsset(AsyncWebServerRequest *request, const FrontendAsset *asset) {
+  if (sendNotModified(request, asset->etag)) {
+    return;
+  }
+
+  // sent straight from the flash, see frontend_assets.h
+  AsyncWebServerResponse *response = request->beginResponse_P(200, asset->contentType, asset->data, asset->length);
+  if (asset->gzipped) {
+    response->addHeader("Content-Encoding", "gzip");
+  }
+  response->addHeader("ETag", asset->etag);
+  // the content behind ?v=<hash> never changes, everything else is revalidated
+  if (request->hasParam("v") && request->getParam("v")->value() == asset->hash) {
+    response->addHeader("Cache-Control", "public, max-age=31536000, immutable");
+  } else {
+    response->addHeader("Cache-Control", "no-cache");
+  }
   request->send(response);
 }
 
-void handleGetMowingPlan(AsyncWebServerRequest *request) {
-  // check if file exists
-  if (!SPIFFS.exists("/mowing_plan.json")) {
-    logMessage("Mowing Plan file does not exist", 0);
-    request->send(204);
+void sendCommandAccepted(AsyncWebServerRequest *request, uint32_t commandId) {
+  if(commandId == 0) {
+    request->send(503, "text/plain", "Command queue is full");
     return;
   }
-  // serve static json
-  AsyncWebServerResponse *response = request->beginResponse(SPIFFS, "/mowing_plan.json", "application/json");
+
+  char body[48];
+  snprintf(body, sizeof(body), "{\"id\":%u,\"status\":\"queued\"}", commandId);
+
+  AsyncWebServerResponse *response = request->beginResponse(202, "application/json", body);
+  response->addHeader("Location", "/commands/" + String(commandId));
+  request->send(response);
+}
+
+void handleGetCommand(AsyncWebServerRequest *request) {
+  String url = request->url();
+  int separator = url.lastIndexOf('/');
+  uint32_t commandId = strtoul(url.c_str() + separator + 1, NULL, 10);
+
+  CommandInfo command;
+  if(!getCommandInfo(commandId, command)) {
+    request->send(404, "text/plain", "Unknown command");
+    return;
+  }
+
+  char body[80];
+  snprintf(body, sizeof(body), "{\"id\":%u,\"command\":\"%s\",\"status\":\"%s\"}",
+    command.id, commandTypeName(command.type), commandStatusName(command.status));
+
+  AsyncWebServerResponse *response = request->beginResponse(200, "application/json", body);
   response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
   request->send(response);
 }
 
-AsyncCallbackJsonWebHandler* createSetMowingPlanHandler() {
-  return new AsyncCallbackJsonWebHandler("/mowing-plan", [](AsyncWebServerRequest *request, JsonVariant &json) {
-    JsonObject jsonObj = json.as<JsonObject>();
+// only the fields that differ from previous, all if previous is NULL
+void formatStateEvent(const MowerSnapshot &snapshot, const MowerSnapshot *previous, char *buffer, size_t size) {
+  int length = snprintf(buffer, size, "{\"version\":%u", snapshot.version);
+  if(!previous || previous->isCharging != snapshot.isCharging) {
+    length += snprintf(buffer + length, size - length, ",\"isCharging\":%s", snapshot.isCharging ? "true" : "false");
+  }
+  if(!previous || previous->isLocked != snapshot.isLocked) {
+    length += snprintf(buffer + length, size - length, ",\"isLocked\":%s", snapshot.isLocked ? "true" : "false");
+  }
+  if(!previous || previous->isEmergency != snapshot.isEmergency) {
+    length += snprintf(buffer + length, size - length, ",\"isEmergency\":%s", snapshot.isEmergency ? "true" : "false");
+  }
+  if(!previous || previous->isIdle != snapshot.isIdle) {
+    length += snprintf(buffer + length, size - length, ",\"isIdle\":%s", snapshot.isIdle ? "true" : "false");
+  }
+  snprintf(buffer + length, size - length, "}");
+}
+
+void formatUpdateEvent(const UpdateProgress &update, char *buffer, size_t size) {
+  static const char *statusNames[] = {"idle", "writing", "succeeded", "failed"};
+  int length = snprintf(buffer, size, "{\"target\":\"%s\",\"status\":\"%s\",\"encoding\":\"%s\",\"received\":%u,\"total\":%u,\"written\":%u",
+    update.target, statusNames[update.status], updateEncodingName(update.encoding),
+    (unsigned int)update.received, (unsigned int)update.total, (unsigned int)update.written);
+  if(update.error) {
+    length += snprintf(buffer + length, size - length, ",\"error\":\"%s\"", update.error);
+  }
+  snprintf(buffer + length, size - length, "}");
+}
+
+// runs on the loop task, woken by the listeners below or for the heartbeat
+static void sendStateEvents() {
+  unsigned long now = halMillis();
+
+  MowerSnapshot snapshot = getMowerSnapshot();
+  if(snapshot.version != lastSentSnapshot.version) {
+    char body[96];
+    formatStateEvent(snapshot, &lastSentSnapshot, body, sizeof(body));
+    events.send(body, "state", snapshot.version);
+    recordStateHistory(snapshot);
+    lastSentSnapshot = snapshot;
+    lastEventSentAt = now;
+  }
+
+  // commands finish in the order they were queued
+  uint32_t finishedCommandId = lastFinishedCommandId.load(std::memory_order_acquire);
+  while(lastSentCommandId < finishedCommandId) {
+    CommandInfo command;
+    if(getCommandInfo(++lastSentCommandId, command)) {
+      char body[80];
+      snprintf(body, sizeof(body), "{\"id\":%u,\"command\":\"%s\",\"status\":\"%s\"}",
+        command.id, commandTypeName(command.type), commandStatusName(command.status));
+      events.send(body, "command");
+      lastEventSentAt = now;
+      if(command.status == COMMAND_DONE) {
+        recordCommandHistory(command.type);
+      }
+    }
+  }
+
+  UpdateProgress update = getUpdateProgress();
+  if(update.version != lastSentUpdateVersion) {
+    char body[192];
+    formatUpdateEvent(update, body, sizeof(body));
+    events.send(body, "update");
+    lastSentUpdateVersion = update.version;
+    lastEventSentAt = now;
+  }
+
+  // keeps proxies from closing the connection and lets the browser notice a dead device
+  if(now - lastEventSentAt >= eventHeartbeatMs / 2) {
+    events.send(String(now).c_str(), "heartbeat");
+    lastEventSentAt = now;
+  }
+}
+
+static void onSnapshotChanged() {
+  rescheduleJob(stateEventsJob, 0);
+}
 
-    if (jsonObj.containsKey("customMowingPlanActive") && jsonObj.containsKey("days") &&
-        jsonObj.containsKey("planTimeStart") && jsonObj.containsKey("planTimeEnd")) {
+static void onUpdateProgress() {
+  rescheduleJob(stateEventsJob, 0);
+}
+
+static void onCommandFinished(uint32_t id) {
+  lastFinishedCommandId.store(id, std::memory_order_release);
+  rescheduleJob(stateEventsJob, 0);
+}
+
+void initializeStateEvents() {
+  lastSentSnapshot = getMowerSnapshot();
+  stateEventsJob = addScheduledJob("stateEvents", sendStateEvents, eventHeartbeatMs, eventHeartbeatMs);
+  setSnapshotListener(onSnapshotChanged);
+  setCommandFinishedListener(onCommandFinished);
+  setUpdateProgressListener(onUpdateProgress);
+}
+
+// only used on the async_tcp task, the response stream copies it
+static const size_t logChunkSize = 4096;
+static char logChunk[logChunkSize];
 
-        MowingPlan plan;
+void handleGetLogMessages(AsyncWebServerRequest *request) {
+  // without a cursor the client starts with the last lines
+  bool hasCursor = request->hasParam("since");
+  uint32_t since = hasCursor ? strtoul(request->getParam("since")->value().c_str(), NULL, 10) : getLogTailCursor(logChunkSize);
 
-        // Parse the custom mowing plan status
-        plan.customMowingPlanActive = jsonObj["customMowingPlanActive"].as<bool>();
+  uint32_t cursor;
+  bool continued;
+  size_t length = readLogMessages(since, logChunk, sizeof(logChunk), cursor, continued);
+  continued = continued && hasCursor;
+
+  AsyncResponseStream *response = request->beginResponseStream("text/plain");
+  response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+  response->addHeader("X-Log-Cursor", String(cursor));
+  if(!continued) {
+    response->addHeader("X-Log-Reset", "1");
+  }
+  if(cursor < getLogEndCursor()) {
+    response->addHeader("X-Log-More", "1");
+  }
+  response->write((const uint8_t *)logChunk, length);
+  request->send(response);
+}
+
+// the raw log segments and the format dictionary of the binary log, for tools/logdecode.cpp
+void handleGetLogFiles(AsyncWebServerRequest *request) {
+  String url = request->url();
+  if(url == "/log-files" || url == "/log-files/") {
+    AsyncResponseStream *response = request->beginResponseStream("text/plain");
+    File root = halFileSystem().open("/");
+    File file = root.openNextFile();
+    while (file) {
+      const char *name = strrchr(file.name(), '/') ? strrchr(file.name(), '/') + 1 : file.name();
+      uint32_t segment;
+      if(parseLogSegmentName(name, segment) || strcmp(name, logFormatsPath + 1) == 0) {
+        response->println(name);
+      }
+      file = root.openNextFile();
+    }
+    request->send(response);
+    return;
+  }
+
+  String name = url.substring(url.lastIndexOf('/') + 1);
+  uint32_t segment;
+  if(!parseLogSegmentName(name.c_str(), segment) && name != logFormatsPath + 1) {
+    request->send(404, "text/plain", "Unknown log file");
+    return;
+  }
+  request->send(halFileSystem(), "/" + name, "application/octet-stream", true);
+}
 
-        // Parse the days (array of booleans)
-        JsonArray daysArray = jsonObj["days"].as<JsonArray>();
-        for (int i = 0; i < 7; i++) {
-            plan.days[i] = daysArray[i].as<bool>();
+void formatContentETag(char kind, uint32_t version, char *etag, size_t size) {
+  snprintf(etag, size, "\"%c%08x-%u\"", kind, (unsigned int)etagBootId, (unsigned int)version);
+}
+
+// the fillers of json_stream.h wait for room in the send buffer like the other chunked responses
+static_assert(jsonResponseTryAgain == RESPONSE_TRY_AGAIN, "RESPONSE_TRY_AGAIN changed");
+
+// streams the body from a reserved slot, 503 while all slots are sending
+static void sendJsonResponse(AsyncWebServerRequest *request, JsonResponseSlot *slot, const char *etag) {
+  if (!slot) {
+    AsyncWebServerResponse *response = request->beginResponse(503, "text/plain", "Too many requests");
+    response->addHeader("Retry-After", "1");
+    request->send(response);
+    return;
+  }
+  // also called after the body, the slot may be reserved again by then
+  request->onDisconnect(releaseJsonResponse(*slot));
+  AsyncWebServerResponse *response = request->beginChunkedResponse("application/json", startJsonResponse(*slot));
+  // the browser may keep it, but has to revalidate
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
+
+void handleGetStatus(AsyncWebServerRequest *request) {
+  // the json is only written if the browser's version is outdated, see status_json.h
+  StatusInputs inputs;
+  readStatusInputs(inputs, getApMode(), getApName().c_str());
+  char etag[24];
+  formatContentETag('s', updateStatusVersion(inputs), etag, sizeof(etag));
+  if (sendNotModified(request, etag)) {
+    return;
+  }
+
+  // streamed from the inputs kept in the slot
+  sendJsonResponse(request, reserveStatusResponse(inputs), etag);
+}
+
+// answers 304 if the browser already has this version
+bool sendNotModified(AsyncWebServerRequest *request, const char *etag) {
+  if (!request->hasHeader("If-None-Match") || request->getHeader("If-None-Match")->value() != etag) {
+    return false;
+  }
+  AsyncWebServerResponse *response = request->beginResponse(304);
+  response->addHeader("ETag", etag);
+  request->send(response);
+  return true;
+}
+
+// one event as json, at most maxHistoryEventJsonLength characters
+static size_t formatHistoryEvent(const HistoryEvent &event, char *buffer, size_t size) {
+  switch(event.type) {
+    case HISTORY_STATE:
+      return snprintf(buffer, size, "{\"time\":%u,\"state\":%u}", (unsigned int)event.time, event.value);
+    case HISTORY_COMMAND:
+      return snprintf(buffer, size, "{\"time\":%u,\"command\":\"%s\"}", (unsigned int)event.time, commandTypeName((CommandType)event.value));
+    default:
+      return snprintf(buffer, size, "{\"time\":%u,\"boot\":true}", (unsigned int)event.time);
+  }
+}
+
+static const size_t maxHistoryEventJsonLength = 48;
+static const int historyEventsPerChunk = 32;
+
+// streams the events as chunks, the filler reads the next events behind its cursor on every call
+void handleGetHistory(AsyncWebServerRequest *request) {
+  uint32_t now;
+  uint32_t from = 0;
+  uint32_t to = getHistoryTime(now) ? now : UINT32_MAX;
+  if(request->hasParam("from")) {
+    from = strtoul(request->getParam("from")->value().c_str(), NULL, 10);
+  }
+  if(request->hasParam("to")) {
+    to = strtoul(request->getParam("to")->value().c_str(), NULL, 10);
+  }
+  if(from > to) {
+    request->send(400, "text/plain", "from after to");
+    return;
+  }
+
+  uint32_t cursor = 0;
+  bool started = false;
+  bool finished = false;
+  AsyncWebServerResponse *response = request->beginChunkedResponse("application/json",
+    [from, to, cursor, started, finished](uint8_t *buffer, size_t maxLength, size_t index) mutable -> size_t {
+      if(finished) {
+        return 0;
+      }
+      // room for the events, a separator each and the closing bracket
+      int maxEvents = (int)(maxLength / (maxHistoryEventJsonLength + 1)) - 1;
+      if(maxEvents <= 0) {
+        return RESPONSE_TRY_AGAIN;
+      }
+      if(maxEvents > historyEventsPerChunk) {
+        maxEvents = historyEventsPerChunk;
+      }
+
+      char *text = (char *)buffer;
+      size_t length = 0;
+      HistoryEvent historyEvents[historyEventsPerChunk];
+      int count = readStateHistory(from, to, cursor, historyEvents, maxEvents);
+      for(int i = 0; i < count; i++) {
+        text[length++] = started ? ',' : '[';
+        started = true;
+        length += formatHistoryEvent(historyEvents[i], text + length, maxLength - length);
+      }
+      if(count == 0) {
+        if(!started) {
+          text[length++] = '[';
         }
+        text[length++] = ']';
+        finished = true;
+      }
+      return length;
+    });
+  response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+  request->send(response);
+}
 
-        // Parse start and end time
-        plan.startTime = jsonObj["planTimeStart"].as<String>();
-        plan.endTime = jsonObj["planTimeEnd"].as<String>();
+static void printSessionAggregate(AsyncResponseStream *response, const SessionAggregate &aggregate, uint32_t start) {
+  response->printf("{\"start\":%u,\"sessions\":%u,\"mowingSeconds\":%u,\"manual\":%u,\"plan\":%u,\"native\":%u,\"docked\":%u,\"emergency\":%u,\"timeout\":%u}",
+    (unsigned int)start, aggregate.sessions, (unsigned int)aggregate.mowingSeconds,
+    aggregate.triggers[SESSION_MANUAL], aggregate.triggers[SESSION_PLAN], aggregate.triggers[SESSION_NATIVE],
+    aggregate.endReasons[SESSION_DOCKED], aggregate.endReasons[SESSION_EMERGENCY], aggregate.endReasons[SESSION_TIMEOUT]);
+}
 
-        // Save the mowing plan
-        saveMowingPlan(plan);
+// the aggregates are kept up to date as sessions end, see mowing_sessions.h
+void handleGetSessionSummary(AsyncWebServerRequest *request) {
+  SessionSummary summary;
+  getSessionSummary(summary);
+
+  AsyncResponseStream *response = request->beginResponseStream("application/json");
+  response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+  if(summary.active) {
+    response->printf("{\"current\":{\"start\":%u,\"trigger\":\"%s\",\"seconds\":%u}",
+      (unsigned int)summary.current.start, sessionTriggerName(summary.current.trigger), (unsigned int)getMowingSessionSeconds());
+  } else {
+    response->print("{\"current\":null");
+  }
+
+  response->print(",\"days\":[");
+  for(int i = 0; i < sessionDayCount; i++) {
+    if(i > 0) {
+      response->print(",");
+    }
+    printSessionAggregate(response, summary.days[i], getSessionDayStart(summary.days[i].period));
+  }
+  response->print("],\"weeks\":[");
+  for(int i = 0; i < sessionWeekCount; i++) {
+    if(i > 0) {
+      response->print(",");
+    }
+    printSessionAggregate(response, summary.weeks[i], getSessionWeekStart(summary.weeks[i].period));
+  }
+  response->print("],\"sessions\":[");
+  for(int i = 0; i < summary.sessionCount; i++) {
+    const MowingSession &session = summary.sessions[i];
+    response->printf("%s{\"start\":%u,\"end\":%u,\"trigger\":\"%s\",\"endReason\":\"%s\"}", i > 0 ? "," : "",
+      (unsigned int)session.start, (unsigned int)session.end, sessionTriggerName(session.trigger), sessionEndReasonName(session.endReason));
+  }
+  response->print("]}");
+  request->send(response);
+}
+
+static void printMetric(AsyncResponseStream *response, const char *name, const char *type, const char *help, uint32_t value) {
+  response->printf("# HELP %s %s\n# TYPE %s %s\n%s %u\n", name, help, name, type, name, (unsigned int)value);
+}
+
+// Prometheus text format, the histograms are recorded without locks, see metrics.h
+void handleGetMetrics(AsyncWebServerRequest *request) {
+  AsyncResponseStream *response = request->beginResponseStream("text/plain; version=0.0.4");
+  response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+  writeMetrics(*response);
+
+  printMetric(response, "mower_heap_free_bytes", "gauge", "Free heap", ESP.getFreeHeap());
+  printMetric(response, "mower_heap_min_free_bytes", "gauge", "Lowest free heap since boot", ESP.getMinFreeHeap());
+  printMetric(response, "mower_heap_largest_free_block_bytes", "gauge", "Largest block that can be allocated", ESP.getMaxAllocHeap());
+  printMetric(response, "mower_uptime_seconds", "gauge", "Time since boot", halMillis() / 1000);
+  printMetric(response, "mower_log_dropped_messages_total", "counter", "Log lines dropped because the log ring was full", getDroppedLogMessages());
+
+  WifiConnectStats wifi = getWifiConnectStats();
+  printMetric(response, "mower_wifi_reconnects_total", "counter", "Lost Wifi connections", wifi.reconnects);
+  printMetric(response, "mower_wifi_cached_misses_total", "counter", "Connects where the cached access point did not answer", wifi.cachedMisses);
+  response->print("# HELP mower_wifi_connects_total Wifi connects by the way they went\n# TYPE mower_wifi_connects_total counter\n");
+  response->printf("mower_wifi_connects_total{path=\"cached\"} %u\n", (unsigned int)wifi.cachedConnects);
+  response->printf("mower_wifi_connects_total{path=\"scan\"} %u\n", (unsigned int)wifi.scanConnects);
+  response->printf("mower_wifi_connects_total{path=\"failed\"} %u\n", (unsigned int)wifi.failures);
+  response->print("# HELP mower_wifi_connect_seconds_total Time spent connecting to Wifi\n# TYPE mower_wifi_connect_seconds_total counter\n");
+  response->printf("mower_wifi_connect_seconds_total{path=\"cached\"} %g\n", wifi.cachedDurationMs / 1000.0);
+  response->printf("mower_wifi_connect_seconds_total{path=\"scan\"} %g\n", wifi.scanDurationMs / 1000.0);
+  response->printf("# HELP mower_wifi_last_connect_seconds Duration of the last connect\n# TYPE mower_wifi_last_connect_seconds gauge\nmower_wifi_last_connect_seconds %g\n",
+    wifi.lastDurationMs / 1000.0);
+  request->send(response);
+}
+
+void handleGetMowingPlan(AsyncWebServerRequest *request) {
+  // served from RAM, see config_store.h
+  if (!hasStoredMowingPlan()) {
+    request->send(204);
+    return;
+  }
+
+  String etag = getConfigETag();
+  if (sendNotModified(request, etag.c_str())) {
+    return;
+  }
+  AsyncWebServerResponse *response = request->beginResponse(200, "application/json", getMowingPlanJson());
+  response->addHeader("ETag", etag);
+  // the browser may keep it, but has to revalidate
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
+
+AsyncCallbackJsonWebHandler* createSetMowingPlanHandler() {
+  return new AsyncCallbackJsonWebHandler("/mowing-plan", timedJsonRoute("/mowing-plan", [](AsyncWebServerRequest *request, JsonVariant &json) {
+    JsonObject jsonObj = json.as<JsonObject>();
+
+    // accepts windows per weekday, or the single planTimeStart/planTimeEnd for all days
+    MowingPlan plan;
+    if (readMowingPlanJson(jsonObj, plan)) {
+        if (!saveMowingPlan(plan)) {
+            request->send(500);
+            return;
+        }
 
         // Send success response
         request->send(200);
 
-        // Optional: Check for automatic start or sending the mower home
-        checkAutomaticStartOrSendingHomeRequired();
+        // Check for automatic start or sending the mower home, and reschedule the next check
+        requestMowingPlanCheck();
     } else {
-        // Send error response if parameters are missing
+        // Send error response if parameters are missing or invalid
         request->send(400);
     }
-  });
+  }), mowingPlanJsonCapacity);
 }
 
 void handleGetWifis(AsyncWebServerRequest *request) {
-  DynamicJsonDocument doc(2048);
-  JsonArray array = doc.to<JsonArray>();
-
-  for (int i = 0; i < getNetworks(); ++i) {
-    String wifiSSID = WiFi.SSID(i);
-    array.add(wifiSSID);
+  // the scan result is kept in RAM, see wifi_utils.h
+  uint32_t version = getNetworksVersion();
+  char etag[24];
+  formatContentETag('w', version, etag, sizeof(etag));
+  if (!sendNotModified(request, etag)) {
+    // streamed network by network, see wifi_utils.h
+    sendJsonResponse(request, reserveNetworksResponse(version), etag);
   }
 
-  String responseString;
-  serializeJson(doc, responseString);
-
-  AsyncWebServerResponse *response = request->beginResponse(200, "application/json", responseString);
-  response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-  request->send(response);
-
-  asyncScanNetworks();
+  // every poll keeps the scan going, also if nothing changed
+  requestNetworkScan();
 }
 
 AsyncCallbackJsonWebHandler* createSetWifiHandler() {
-    return new AsyncCallbackJsonWebHandler("/wifi", [](AsyncWebServerRequest *request, JsonVariant &json) {
+    return new AsyncCallbackJsonWebHandler("/wifi", timedJsonRoute("/wifi", [](AsyncWebServerRequest *request, JsonVariant &json) {
         JsonObject jsonObj = json.as<JsonObject>();
 
         if (jsonObj.containsKey("ssid") && jsonObj.containsKey("password")) {
@@ -252,20 +637,30 @@ AsyncCallbackJsonWebHandler* createSetWifiHandler() {
 
             Serial.println("Saving WiFi SSID: " + newSsid);
 
-            saveWifiCredentials(newSsid, newPassword);
+            WifiCredentialResult result = saveWifiCredentials(newSsid, newPassword);
+            if (result == WIFI_CREDENTIAL_INVALID) {
+                request->send(400, "text/plain", "SSID or password too long");
+                return;
+            }
+            if (result == WIFI_CREDENTIAL_WRITE_FAILED) {
+                request->send(500);
+                return;
+            }
 
             request->send(200);
 
             delay(2000);
+            flushStateHistory();
+            flushLog();
             ESP.restart();
         } else {
             request->send(400, "text/plain", "Missing ssid or password parameter");
         }
-    });
+    }));
 }
 
 AsyncCallbackJsonWebHandler* createSetDateAndTimeHandler() {
-    return new AsyncCallbackJsonWebHandler("/date-time", [](AsyncWebServerRequest *request, JsonVariant &json) {
+    return new AsyncCallbackJsonWebHandler("/date-time", timedJsonRoute("/date-time", [](AsyncWebServerRequest *request, JsonVariant &json) {
         JsonObject jsonObj = json.as<JsonObject>();
 
         if (jsonObj.containsKey("date") && jsonObj.containsKey("time")) {
@@ -293,9 +688,12 @@ AsyncCallbackJsonWebHandler* createSetDateAndTimeHandler() {
             struct timeval now = { .tv_sec = t };
             settimeofday(&now, NULL);
 
+            // next plan transition moved with the clock
+            requestMowingPlanCheck();
+
             request->send(200, "text/plain", "Time set successfully");
         } else {
             request->send(400, "text/plain", "Missing date or time parameter");
         }
-    });
+    }));
 }
\ No newline at end of file
@@ -5,10 +5,27 @@
 #include <ESPAsyncWebserver.h>
 #include <ArduinoJson.h>
 #include <AsyncJson.h>
+#include "pin_sampler.h"
+#include "frontend_assets.h"
+#include "firmware_update.h"
 
 void initializeWebServer();
 void initializeWebserverRoutes();
+void initializeStateEvents();
+void formatStateEvent(const MowerSnapshot &snapshot, const MowerSnapshot *previous, char *buffer, size_t size);
+void formatUpdateEvent(const UpdateProgress &update, char *buffer, size_t size);
 
+// quoted ETag for the version of a response, kind tells the responses apart
+void formatContentETag(char kind, uint32_t version, char *etag, size_t size);
+bool sendNotModified(AsyncWebServerRequest *request, const char *etag);
+void sendFrontendAsset(AsyncWebServerRequest *request, const FrontendAsset *asset);
+void sendCommandAccepted(AsyncWebServerRequest *request, uint32_t commandId);
+void handleGetCommand(AsyncWebServerRequest *request);
+void handleGetLogMessages(AsyncWebServerRequest *request);
+void handleGetLogFiles(AsyncWebServerRequest *request);
+void handleGetHistory(AsyncWebServerRequest *request);
+void handleGetSessionSummary(AsyncWebServerRequest *request);
+void handleGetMetrics(AsyncWebServerRequest *request);
 void handleGetStatus(AsyncWebServerRequest *request);
 void handleGetMowingPlan(AsyncWebServerRequest *request);
 AsyncCallbackJsonWebHandler* createSetMowingPlanHandler();
@@ -0,0 +1,311 @@
+#include <mutex>
+#include <stddef.h>
+#include <string.h>
+#include <ArduinoJson.h>
+#include "wifi_credentials.h"
+#include "hal.h"
+#include "logger.h"
+
+static const char *wifiCredentialsPath = "/wifi.bin";
+static const char *wifiCredentialsTempPath = "/wifi.bin.tmp";
+// json lines, one object per network, written by earlier versions
+static const char *legacyWifiCredentialsPath = "/wifi.txt";
+static const size_t legacyWifiCredentialJsonCapacity = 200;
+
+static const uint32_t wifiCredentialsMagic = 0x46495752; // "RWIF"
+static const uint8_t wifiCredentialsVersion = 1;
+
+// the file layout, little endian like the ESP32
+struct WifiCredentialsHeader {
+  uint32_t magic;
+  uint8_t version;
+  uint8_t slotCount;
+  uint16_t slotSize;
+  uint32_t crc;
+};
+
+struct WifiCredentialSlot {
+  uint32_t sequence;
+  uint8_t ssidLength;
+  uint8_t passwordLength;
+  char ssid[maxWifiSsidLength];
+  char password[maxWifiPasswordLength];
+  uint16_t reserved;
+  uint32_t crc;
+};
+
+static_assert(sizeof(WifiCredentialsHeader) == 12, "the header is part of the file format");
+static_assert(sizeof(WifiCredentialSlot) == 108, "the slot is part of the file format");
+
+// stores happen on the web server task, reads on the loop task
+static std::mutex credentialsLock;
+static WifiCredential credentialSlots[maxWifiCredentials];
+static uint32_t lastSequence = 0;
+// false if /wifi.bin is missing or damaged, the next store writes it whole
+static bool fileValid = false;
+
+static uint32_t crc32(const void *data, size_t length) {
+  const uint8_t *bytes = (const uint8_t *)data;
+  uint32_t crc = 0xffffffff;
+  for(size_t i = 0; i < length; i++) {
+    crc ^= bytes[i];
+    for(int bit = 0; bit < 8; bit++) {
+      crc = crc & 1 ? (crc >> 1) ^ 0xedb88320u : crc >> 1;
+    }
+  }
+  return ~crc;
+}
+
+static void encodeHeader(WifiCredentialsHeader &header) {
+  memset(&header, 0, sizeof(header));
+  header.magic = wifiCredentialsMagic;
+  header.version = wifiCredentialsVersion;
+  header.slotCount = maxWifiCredentials;
+  header.slotSize = sizeof(WifiCredentialSlot);
+  header.crc = crc32(&header, offsetof(WifiCredentialsHeader, crc));
+}
+
+static bool isHeaderValid(const WifiCredentialsHeader &header) {
+  return header.magic == wifiCredentialsMagic && header.version == wifiCredentialsVersion
+    && header.slotCount == maxWifiCredentials && header.slotSize == sizeof(WifiCredentialSlot)
+    && header.crc == crc32(&header, offsetof(WifiCredentialsHeader, crc));
+}
+
+static void encodeSlot(const WifiCredential &credential, WifiCredentialSlot &slot) {
+  memset(&slot, 0, sizeof(slot));
+  if(credential.sequence != 0) {
+    slot.sequence = credential.sequence;
+    slot.ssidLength = strlen(credential.ssid);
+    slot.passwordLength = strlen(credential.password);
+    memcpy(slot.ssid, credential.ssid, slot.ssidLength);
+    memcpy(slot.password, credential.password, slot.passwordLength);
+  }
+  slot.crc = crc32(&slot, offsetof(WifiCredentialSlot, crc));
+}
+
+// false for empty and damaged slots
+static bool decodeSlot(const WifiCredentialSlot &slot, WifiCredential &credential) {
+  memset(&credential, 0, sizeof(credential));
+  if(slot.sequence == 0 || slot.ssidLength == 0 || slot.ssidLength > maxWifiSsidLength
+      || slot.passwordLength > maxWifiPasswordLength || slot.crc != crc32(&slot, offsetof(WifiCredentialSlot, crc))) {
+    return false;
+  }
+  credential.sequence = slot.sequence;
+  memcpy(credential.ssid, slot.ssid, slot.ssidLength);
+  memcpy(credential.password, slot.password, slot.passwordLength);
+  return true;
+}
+
+// the slot of ssid, else an empty one, else the one of the oldest network
+static int chooseSlot(const char *ssid) {
+  int chosen = 0;
+  for(int i = 0; i < maxWifiCredentials; i++) {
+    const WifiCredential &credential = credentialSlots[i];
+    if(credential.sequence != 0 && strcmp(credential.ssid, ssid) == 0) {
+      return i;
+    }
+    if(credentialSlots[chosen].sequence != 0 && credential.sequence < credentialSlots[chosen].sequence) {
+      chosen = i;
+    }
+  }
+  return chosen;
+}
+
+// the whole file, through a temp file like the config store
+static bool writeAllSlots() {
+  File file = halFileSystem().open(wifiCredentialsTempPath, "w");
+  if(!file) {
+    LOG_ERROR("Failed to open file for writing: %s", wifiCredentialsTempPath);
+    return false;
+  }
+  WifiCredentialsHeader header;
+  encodeHeader(header);
+  bool written = file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header);
+  for(int i = 0; i < maxWifiCredentials && written; i++) {
+    WifiCredentialSlot slot;
+    encodeSlot(credentialSlots[i], slot);
+    written = file.write((const uint8_t *)&slot, sizeof(slot)) == sizeof(slot);
+  }
+  file.close();
+  if(!written) {
+    LOG_ERROR("Failed to write to file: %s", wifiCredentialsTempPath);
+    halFileSystem().remove(wifiCredentialsTempPath);
+    return false;
+  }
+
+  // loadSlots() finishes the rename if a reset comes in between
+  halFileSystem().remove(wifiCredentialsPath);
+  if(!halFileSystem().rename(wifiCredentialsTempPath, wifiCredentialsPath)) {
+    LOG_ERROR("Failed to replace file: %s", wifiCredentialsPath);
+    return false;
+  }
+  fileValid = true;
+  return true;
+}
+
+static bool writeSlot(int index) {
+  if(!fileValid) {
+    return writeAllSlots();
+  }
+  File file = halFileSystem().open(wifiCredentialsPath, "r+");
+  if(!file) {
+    return writeAllSlots();
+  }
+  WifiCredentialSlot slot;
+  encodeSlot(credentialSlots[index], slot);
+  bool written = file.seek(sizeof(WifiCredentialsHeader) + index * sizeof(WifiCredentialSlot))
+    && file.write((const uint8_t *)&slot, sizeof(slot)) == sizeof(slot);
+  file.close();
+  if(!written) {
+    LOG_ERROR("Failed to write slot %d of %s", index, wifiCredentialsPath);
+  }
+  return written;
+}
+
+static void loadSlots() {
+  if(halFileSystem().exists(wifiCredentialsTempPath) && !halFileSystem().exists(wifiCredentialsPath)) {
+    // cut after the old file was removed, the temp file is complete
+    halFileSystem().rename(wifiCredentialsTempPath, wifiCredentialsPath);
+  }
+  if(!halFileSystem().exists(wifiCredentialsPath)) {
+    return;
+  }
+  File file = halFileSystem().open(wifiCredentialsPath, "r");
+  if(!file) {
+    return;
+  }
+
+  WifiCredentialsHeader header;
+  if(file.read((uint8_t *)&header, sizeof(header)) != sizeof(header) || !isHeaderValid(header)) {
+    LOG_ERROR("Unknown format of %s, starting without Wifi credentials", wifiCredentialsPath);
+    file.close();
+    return;
+  }
+  for(int i = 0; i < maxWifiCredentials; i++) {
+    WifiCredentialSlot slot;
+    if(file.read((uint8_t *)&slot, sizeof(slot)) != sizeof(slot)) {
+      memset(&slot, 0, sizeof(slot));
+    }
+    if(decodeSlot(slot, credentialSlots[i])) {
+      if(credentialSlots[i].sequence > lastSequence) {
+        lastSequence = credentialSlots[i].sequence;
+      }
+    } else if(slot.sequence != 0) {
+      LOG_ERROR("Dropping damaged Wifi credential slot %d", i);
+    }
+  }
+  file.close();
+  fileValid = true;
+}
+
+static bool setSlot(const char *ssid, const char *password, int &index) {
+  index = chooseSlot(ssid);
+  WifiCredential &credential = credentialSlots[index];
+  if(credential.sequence != 0 && strcmp(credential.ssid, ssid) == 0 && strcmp(credential.password, password) == 0) {
+    return false;
+  }
+  memset(&credential, 0, sizeof(credential));
+  strcpy(credential.ssid, ssid);
+  strcpy(credential.password, password);
+  credential.sequence = ++lastSequence;
+  return true;
+}
+
+static bool isValidCredential(const char *ssid, const char *password) {
+  size_t ssidLength = strlen(ssid);
+  return ssidLength > 0 && ssidLength <= maxWifiSsidLength && strlen(password) <= maxWifiPasswordLength;
+}
+
+// takes over the json lines of /wifi.txt, oldest first, and removes the file
+static void migrateLegacyCredentials() {
+  if(!halFileSystem().exists(legacyWifiCredentialsPath)) {
+    return;
+  }
+  File file = halFileSystem().open(legacyWifiCredentialsPath, "r");
+  if(!file) {
+    return;
+  }
+  int migrated = 0;
+  while(file.available()) {
+    String line = file.readStringUntil('\n');
+    line.trim();
+    if(line.length() == 0) {
+      continue;
+    }
+    DynamicJsonDocument doc(legacyWifiCredentialJsonCapacity);
+    DeserializationError error = deserializeJson(doc, line);
+    const char *ssid = doc["ssid"] | "";
+    const char *password = doc["password"] | "";
+    if(error || !isValidCredential(ssid, password)) {
+      LOG_ERROR("Skipping invalid line of %s", legacyWifiCredentialsPath);
+      continue;
+    }
+    int index;
+    setSlot(ssid, password, index);
+    migrated++;
+  }
+  file.close();
+
+  if(writeAllSlots()) {
+    halFileSystem().remove(legacyWifiCredentialsPath);
+    LOG_INFO("Migrated %d Wifi credentials from %s", migrated, legacyWifiCredentialsPath);
+  }
+}
+
+void initializeWifiCredentials() {
+  std::lock_guard<std::mutex> lock(credentialsLock);
+  memset(credentialSlots, 0, sizeof(credentialSlots));
+  lastSequence = 0;
+  fileValid = false;
+  loadSlots();
+  if(!fileValid) {
+    migrateLegacyCredentials();
+  }
+}
+
+int getWifiCredentials(WifiCredential *credentials) {
+  std::lock_guard<std::mutex> lock(credentialsLock);
+  int count = 0;
+  for(int i = 0; i < maxWifiCredentials; i++) {
+    if(credentialSlots[i].sequence == 0) {
+      continue;
+    }
+    // insertion sort by age
+    int position = count++;
+    while(position > 0 && credentials[position - 1].sequence > credentialSlots[i].sequence) {
+      credentials[position] = credentials[position - 1];
+      position--;
+    }
+    credentials[position] = credentialSlots[i];
+  }
+  return count;
+}
+
+bool findWifiCredential(const char *ssid, WifiCredential &credential) {
+  std::lock_guard<std::mutex> lock(credentialsLock);
+  for(int i = 0; i < maxWifiCredentials; i++) {
+    if(credentialSlots[i].sequence != 0 && strcmp(credentialSlots[i].ssid, ssid) == 0) {
+      credential = credentialSlots[i];
+      return true;
+    }
+  }
+  return false;
+}
+
+WifiCredentialResult storeWifiCredential(const char *ssid, const char *password) {
+  if(!isValidCredential(ssid, password)) {
+    return WIFI_CREDENTIAL_INVALID;
+  }
+
+  std::lock_guard<std::mutex> lock(credentialsLock);
+  int index = chooseSlot(ssid);
+  WifiCredential previous = credentialSlots[index];
+  if(!setSlot(ssid, password, index)) {
+    return WIFI_CREDENTIAL_UNCHANGED;
+  }
+  if(!writeSlot(index)) {
+    credentialSlots[index] = previous;
+    return WIFI_CREDENTIAL_WRITE_FAILED;
+  }
+  return WIFI_CREDENTIAL_STORED;
+}
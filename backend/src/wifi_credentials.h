@@ -0,0 +1,38 @@
+#ifndef WIFI_CREDENTIALS_H
+#define WIFI_CREDENTIALS_H
+
+#include <stdint.h>
+
+// Saved Wifi networks in /wifi.bin, a header and maxWifiCredentials fixed size slots.
+// Each slot holds one network with a crc, a store rewrites only its own slot, a slot cut
+// by a reset fails its crc and counts as empty. A new network takes an empty slot or the
+// one of the oldest network, the sequence number tells the age.
+// Kept in RAM, loaded at boot, the json lines of the old /wifi.txt are taken over once.
+
+const int maxWifiCredentials = 10;
+const uint8_t maxWifiSsidLength = 32;
+// WPA passphrases have up to 63 characters, a raw key 64 hex digits
+const uint8_t maxWifiPasswordLength = 64;
+
+struct WifiCredential {
+  char ssid[maxWifiSsidLength + 1];
+  char password[maxWifiPasswordLength + 1];
+  // 0 for an empty slot, higher is newer
+  uint32_t sequence;
+};
+
+enum WifiCredentialResult : uint8_t {
+  WIFI_CREDENTIAL_STORED,
+  WIFI_CREDENTIAL_UNCHANGED,
+  WIFI_CREDENTIAL_INVALID,
+  WIFI_CREDENTIAL_WRITE_FAILED
+};
+
+void initializeWifiCredentials();
+// copies the saved networks to credentials, oldest first, returns their count
+int getWifiCredentials(WifiCredential *credentials);
+bool findWifiCredential(const char *ssid, WifiCredential &credential);
+// a known ssid gets the new password in its slot
+WifiCredentialResult storeWifiCredential(const char *ssid, const char *password);
+
+#endif
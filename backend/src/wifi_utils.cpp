@@ -1,9 +1,15 @@
+#include <atomic>
+#include <mutex>
+#include <stddef.h>
+#include <esp_attr.h>
 #include <WiFi.h>
-#include <SPIFFS.h>
 #include "wifi_utils.h"
 #include "logger.h"
+#include "hal.h"
+#include "scheduler.h"
+#include "config_store.h"
+#include "wifi_credentials.h"
 #include <WiFiMulti.h>
-#include <ArduinoJson.h>
 
 // Default Wifi-Config
 String hostname_default = "robotmower";
@@ -12,259 +18,458 @@ String password_default = "MowerInterface";
 bool onceConnectedToWifi = false;
 bool apMode = false;
 String apName;
-int networks = 0;
 
-int scanInterval = 25000;
-unsigned long lastScanTime = 0;
-// json doc with networks as array
-DynamicJsonDocument networksDoc(2048);
+// a scan takes the radio off the channel for a few seconds, in STA mode the connection
+// to the browser stalls meanwhile, so scans only run while the setup page asks for them
+const unsigned long scanMinIntervalMs = 30000;
+const unsigned long scanDemandWindowMs = 15000;
+// a scan takes a few seconds, poll for the result only while one is running
+const unsigned long scanResultFirstCheckMs = 2500;
+const unsigned long scanResultRecheckMs = 1000;
+const unsigned long wifiReconnectCheckMs = 30000;
+int scanJob = -1;
+unsigned long lastScanStartedAt = 0;
+bool scanStarted = false;
+// set by /wifis on the web server task
+std::atomic<unsigned long> lastScanRequestAt(0);
+std::atomic<bool> scanRequested(false);
+// the last scan, one entry per ssid, strongest first
+ScannedNetwork scannedNetworks[maxScannedNetworks];
+int scannedNetworkCount = 0;
+uint32_t networksVersion = 0;
+std::mutex networksLock;
 
 WiFiMulti wifiMulti;
 
+// the access point of the last connection, kept in RTC memory over ESP.restart() and
+// watchdog resets, so the next connect can skip the scan. Garbage after power on, the crc tells.
+struct WifiConnectCache {
+  uint32_t magic;
+  char ssid[maxWifiSsidLength + 1];
+  uint8_t bssid[6];
+  uint8_t channel;
+  uint32_t crc;
+};
+
+const uint32_t wifiConnectCacheMagic = 0x43464957; // "WIFC"
+// a directed connect takes well below a second, a scan over all channels several
+const unsigned long fastConnectTimeoutMs = 4000;
+RTC_NOINIT_ATTR WifiConnectCache connectCache;
+std::mutex connectStatsLock;
+WifiConnectStats connectStats = {};
+
+static uint32_t connectCacheCrc() {
+  const uint8_t *bytes = (const uint8_t *)&connectCache;
+  uint32_t crc = 0xffffffff;
+  for (size_t i = 0; i < offsetof(WifiConnectCache, crc); i++) {
+    crc ^= bytes[i];
+    for (int bit = 0; bit < 8; bit++) {
+      crc = crc & 1 ? (crc >> 1) ^ 0xedb88320u : crc >> 1;
+    }
+  }
+  return ~crc;
+}
+
+static bool isConnectCacheValid() {
+  return connectCache.magic == wifiConnectCacheMagic && connectCache.crc == connectCacheCrc()
+    && connectCache.ssid[maxWifiSsidLength] == 0 && connectCache.channel > 0;
+}
+
+static void clearConnectCache() {
+  memset(&connectCache, 0, sizeof(connectCache));
+}
+
+static void rememberConnection() {
+  String ssid = WiFi.SSID();
+  uint8_t *bssid = WiFi.BSSID();
+  if (ssid.length() == 0 || ssid.length() > maxWifiSsidLength || bssid == NULL) {
+    clearConnectCache();
+    return;
+  }
+  memset(&connectCache, 0, sizeof(connectCache));
+  connectCache.magic = wifiConnectCacheMagic;
+  strcpy(connectCache.ssid, ssid.c_str());
+  memcpy(connectCache.bssid, bssid, sizeof(connectCache.bssid));
+  connectCache.channel = WiFi.channel();
+  connectCache.crc = connectCacheCrc();
+}
+
+static void recordConnect(WifiConnectPath path, unsigned long durationMs) {
+  std::lock_guard<std::mutex> guard(connectStatsLock);
+  connectStats.attempts++;
+  connectStats.lastPath = path;
+  connectStats.lastDurationMs = durationMs;
+  switch (path) {
+    case WIFI_CONNECT_CACHED:
+      connectStats.cachedConnects++;
+      connectStats.cachedDurationMs += durationMs;
+      break;
+    case WIFI_CONNECT_SCAN:
+      connectStats.scanConnects++;
+      connectStats.scanDurationMs += durationMs;
+      break;
+    default:
+      connectStats.failures++;
+      break;
+  }
+}
+
+// connects straight to the cached access point, without a scan
+static bool connectToCachedAccessPoint() {
+  if (!isConnectCacheValid()) {
+    return false;
+  }
+  // the network may have been forgotten or got a new password meanwhile
+  WifiCredential credential;
+  if (!findWifiCredential(connectCache.ssid, credential)) {
+    clearConnectCache();
+    return false;
+  }
+
+  LOG_INFO("Connecting to %s on channel %u without a scan...", connectCache.ssid, connectCache.channel);
+  WiFi.mode(WIFI_STA);
+  WiFi.begin(credential.ssid, credential.password, connectCache.channel, connectCache.bssid, true);
+  unsigned long startedAt = millis();
+  while (WiFi.status() != WL_CONNECTED) {
+    if (millis() - startedAt > fastConnectTimeoutMs) {
+      LOG_ERROR("Access point %s not found on channel %u, scanning", connectCache.ssid, connectCache.channel);
+      WiFi.disconnect();
+      {
+        std::lock_guard<std::mutex> guard(connectStatsLock);
+        connectStats.cachedMisses++;
+      }
+      clearConnectCache();
+      return false;
+    }
+    delay(20);
+  }
+  return true;
+}
+
 bool getApMode() {
     return apMode;
 }
 
-String getApName() {
+const String &getApName() {
     return apName;
 }
 
-int getNetworks() {
-    return networks;
-}
-
 void setDefaultHostname() {
   WiFi.setHostname(hostname_default.c_str());
 }
 
-// Scan for available networks
-void scanNetworks() {
-    logMessage("Wifi scan started");
-    networks = WiFi.scanNetworks();
-    logMessage("Async WiFi scan completed: " + String(networks) + " networks found.");
-    if (networks > 0) {
-      for (int i = 0; i < networks; ++i) {
-          logMessage("Network " + String(i + 1) + ": " + WiFi.SSID(i), 1);
+const char *wifiAuthModeName(uint8_t authMode) {
+  switch (authMode) {
+    case WIFI_AUTH_OPEN: return "open";
+    case WIFI_AUTH_WEP: return "wep";
+    case WIFI_AUTH_WPA_PSK: return "wpa";
+    case WIFI_AUTH_WPA2_PSK: return "wpa2";
+    case WIFI_AUTH_WPA_WPA2_PSK: return "wpa/wpa2";
+    case WIFI_AUTH_WPA2_ENTERPRISE: return "wpa2-enterprise";
+    case WIFI_AUTH_WPA3_PSK: return "wpa3";
+    case WIFI_AUTH_WPA2_WPA3_PSK: return "wpa2/wpa3";
+    default: return "unknown";
+  }
+}
+
+// one entry per ssid with its strongest access point, sorted by rssi, hidden networks are left out
+static int collectScannedNetworks(int count, ScannedNetwork *networks) {
+  int collected = 0;
+  for (int i = 0; i < count; i++) {
+    String ssid = WiFi.SSID(i);
+    if (ssid.length() == 0 || ssid.length() > maxWifiSsidLength) {
+      continue;
+    }
+    // zeroed, the scans are compared with memcmp
+    ScannedNetwork network;
+    memset(&network, 0, sizeof(network));
+    strcpy(network.ssid, ssid.c_str());
+    network.rssi = WiFi.RSSI(i);
+    network.channel = WiFi.channel(i);
+    network.authMode = WiFi.encryptionType(i);
+
+    int position = 0;
+    while (position < collected && strcmp(networks[position].ssid, network.ssid) != 0) {
+      position++;
+    }
+    if (position < collected) {
+      if (networks[position].rssi >= network.rssi) {
+        continue;
+      }
+      // the stronger access point takes the place of the weaker one
+      for (int j = position + 1; j < collected; j++) {
+        networks[j - 1] = networks[j];
       }
+      collected--;
+    } else if (collected == maxScannedNetworks) {
+      if (networks[collected - 1].rssi >= network.rssi) {
+        continue;
+      }
+      collected--;
+    }
+
+    position = collected++;
+    while (position > 0 && networks[position - 1].rssi < network.rssi) {
+      networks[position] = networks[position - 1];
+      position--;
     }
+    networks[position] = network;
+  }
+  return collected;
 }
 
-// Asynchronous Scan for available networks
-void asyncScanNetworks() {
-  unsigned long currentMillis = millis();
-  if (currentMillis - lastScanTime >= scanInterval) {
-    logMessage("Async Wifi scan started..");
-    lastScanTime = currentMillis;
-    WiFi.scanNetworks(true);
-  }else{
-    logMessage("Async Wifi scan already in progress..");
+// keeps the scan result, the version counts changes for the ETag of /wifis
+static void updateNetworksList(int count) {
+  ScannedNetwork networks[maxScannedNetworks];
+  int collected = collectScannedNetworks(count, networks);
+  LOG_INFO("Async WiFi scan completed: %d access points, %d networks.", count, collected);
+  for (int i = 0; i < collected; i++) {
+    LOG_DEBUG("Network %d: %s, %d dBm, channel %u", i + 1, networks[i].ssid, networks[i].rssi, networks[i].channel);
   }
+
+  std::lock_guard<std::mutex> guard(networksLock);
+  if (collected != scannedNetworkCount || memcmp(networks, scannedNetworks, collected * sizeof(ScannedNetwork)) != 0) {
+    networksVersion++;
+  }
+  memcpy(scannedNetworks, networks, collected * sizeof(ScannedNetwork));
+  scannedNetworkCount = collected;
 }
 
-void checkAsyncScanNetworksUpdate() {
-  int n = WiFi.scanComplete();
-  if(n > 0 && n != networks) {
-    networks = n;
+static void startScan() {
+  LOG_INFO("Async Wifi scan started..");
+  lastScanStartedAt = millis();
+  scanStarted = true;
+  WiFi.scanNetworks(true);
+  rescheduleJob(scanJob, scanResultFirstCheckMs);
+}
 
-    // create new doc here, and set networksDoc when this doc is ready
-    DynamicJsonDocument doc(2048);
-    JsonArray array = doc.to<JsonArray>();
+// runs on the loop task, woken by requestNetworkScan() and while a scan is running
+static void runScanJob() {
+  int result = WiFi.scanComplete();
+  if (result == WIFI_SCAN_RUNNING) {
+    rescheduleJob(scanJob, scanResultRecheckMs);
+    return;
+  }
+  if (result >= 0) {
+    updateNetworksList(result);
+    // frees the driver's result list
+    WiFi.scanDelete();
+  }
 
-    logMessage("Async WiFi scan completed: " + String(networks) + " networks found.");
-    for (int i = 0; i < networks; i++) {
-      String wifiSSID = WiFi.SSID(i);
-      logMessage("Network " + String(i + 1) + ": " + wifiSSID, 1);
-      array.add(wifiSSID);
-    }
-    networksDoc.clear();
-    networksDoc = doc;
+  // nobody asked since the last scan, or the page was closed meanwhile
+  unsigned long now = millis();
+  if (!scanRequested.load() || now - lastScanRequestAt.load() > scanDemandWindowMs) {
+    scanRequested = false;
+    return;
   }
+  if (scanStarted && now - lastScanStartedAt < scanMinIntervalMs) {
+    rescheduleJob(scanJob, scanMinIntervalMs - (now - lastScanStartedAt));
+    return;
+  }
+  scanRequested = false;
+  startScan();
 }
 
-String getNetworksJsonArray() {
-  // if no data, then return empty array, otherwise return the networks
-  if(networksDoc.size() == 0) {
-    return "[]";
+// Asynchronous Scan for available networks, at most every scanMinIntervalMs
+void requestNetworkScan() {
+  lastScanRequestAt = millis();
+  if (!scanRequested.exchange(true)) {
+    rescheduleJob(scanJob, 0);
   }
+}
 
-  String responseString;
-  serializeJson(networksDoc, responseString);
+void scheduleWifiJobs() {
+  scanJob = addScheduledJob("wifiScan", runScanJob, 0, scanResultFirstCheckMs);
+  if(!apMode) {
+    addScheduledJob("wifiReconnect", reconnectToWifiIfNeeded, wifiReconnectCheckMs, wifiReconnectCheckMs);
+  } else {
+    // the setup page is what the access point is there for, have the list ready
+    requestNetworkScan();
+  }
+}
 
-  return responseString;
+int getScannedNetworks(ScannedNetwork *networks) {
+  std::lock_guard<std::mutex> guard(networksLock);
+  memcpy(networks, scannedNetworks, scannedNetworkCount * sizeof(ScannedNetwork));
+  return scannedNetworkCount;
 }
 
-// Check for duplicate SSID and Password
-bool checkDuplicates(String ssid, String password) {
-    if (SPIFFS.exists("/wifi.txt")) {
-        File file = SPIFFS.open("/wifi.txt", "r");
-        if (file) {
-            while (file.available()) {
-                String line = file.readStringUntil('\n');
-                line.trim();
-                if (line.length() > 0) {
-                    DynamicJsonDocument doc(200); // Anpassung der Größe nach Bedarf
-                    DeserializationError error = deserializeJson(doc, line);
-                    if (!error) {
-                        String existingSsid = doc["ssid"];
-                        String existingPassword = doc["password"];
-                        // Check for duplicates
-                        if (existingSsid == ssid) {
-                            if (existingPassword == password) {
-                                logMessage("Duplicate entry found: " + ssid + " with the same password.", 0);
-                                return true; // duplicate in SSID+Pass
-                            } else {
-                                logMessage("SSID already exists with a different password: " + ssid, 1);
-                                return false; // SSID exists, different password
-                            }
-                        }
-                    }
-                }
-            }
-            file.close();
-        }
-    }
+// false past the last network or once a newer scan replaced the one of version
+static bool getScannedNetwork(int index, uint32_t version, ScannedNetwork &network) {
+  std::lock_guard<std::mutex> guard(networksLock);
+  if (version != networksVersion || index >= scannedNetworkCount) {
     return false;
+  }
+  network = scannedNetworks[index];
+  return true;
 }
 
-// Connect to Wifi
+struct NetworksJsonContext {
+  // the scan the response started with, the one of its ETag
+  uint32_t version;
+  // the part of network, a cut part is written again from it
+  int networkPart;
+  ScannedNetwork network;
+  // the part of the closing bracket, -1 until the last network was written
+  int endPart;
+};
+
+// part 0 is the opening bracket, then one part per network and the closing bracket
+static bool writeNetworksJsonPart(JsonStream &stream, int part, void *context) {
+  NetworksJsonContext &networks = *(NetworksJsonContext *)context;
+  if (part == 0) {
+    jsonRaw(stream, "[");
+    return true;
+  }
+  if (networks.endPart >= 0) {
+    if (part > networks.endPart) {
+      return false;
+    }
+    jsonRaw(stream, "]");
+    return true;
+  }
+  // read once per part, a new scan may come in between two windows, then the array ends
+  // early rather than mixing both scans
+  if (networks.networkPart != part) {
+    if (!getScannedNetwork(part - 1, networks.version, networks.network)) {
+      networks.endPart = part;
+      jsonRaw(stream, "]");
+      return true;
+    }
+    networks.networkPart = part;
+  }
+
+  if (part > 1) {
+    jsonRaw(stream, ",");
+  }
+  jsonBeginObject(stream);
+  jsonKey(stream, "ssid");
+  jsonString(stream, networks.network.ssid);
+  jsonKey(stream, "rssi");
+  jsonInt(stream, networks.network.rssi);
+  jsonKey(stream, "channel");
+  jsonUnsigned(stream, networks.network.channel);
+  jsonKey(stream, "auth");
+  jsonString(stream, wifiAuthModeName(networks.network.authMode));
+  jsonEndObject(stream);
+  return true;
+}
+
+static const int networksResponseSlotCount = 4;
+static JsonResponseSlot networksResponseSlots[networksResponseSlotCount];
+static NetworksJsonContext networksResponseContexts[networksResponseSlotCount];
+static JsonResponsePool networksResponsePool = {
+  networksResponseSlots, networksResponseSlotCount, writeNetworksJsonPart, networksResponseContexts, sizeof(NetworksJsonContext)
+};
+
+JsonResponseSlot *reserveNetworksResponse(uint32_t version) {
+  JsonResponseSlot *slot = reserveJsonResponseSlot(networksResponsePool);
+  if(!slot) {
+    return NULL;
+  }
+  NetworksJsonContext &networks = *(NetworksJsonContext *)slot->context;
+  networks.version = version;
+  networks.networkPart = -1;
+  networks.endPart = -1;
+  return slot;
+}
+
+uint32_t getNetworksVersion() {
+  std::lock_guard<std::mutex> guard(networksLock);
+  return networksVersion;
+}
+
+// Connect to Wifi, to the access point of the last connection if it is still there
 bool connectToWifi() {
-    logMessage("Trying to connect to the best available Wifi...", 1);
-    if (wifiMulti.run() == WL_CONNECTED) {
-        logMessage("Connected to WiFi!", 1);
-        logMessage("Webinterface available at: http://" + WiFi.localIP().toString());
+    unsigned long startedAt = millis();
+    WifiConnectPath path = WIFI_CONNECT_CACHED;
+    if (!connectToCachedAccessPoint()) {
+        LOG_INFO("Trying to connect to the best available Wifi...");
+        path = wifiMulti.run() == WL_CONNECTED ? WIFI_CONNECT_SCAN : WIFI_CONNECT_FAILED;
+    }
+    unsigned long durationMs = millis() - startedAt;
+    recordConnect(path, durationMs);
+
+    if (path != WIFI_CONNECT_FAILED) {
+        rememberConnection();
+        LOG_INFO("Connected to WiFi %s in %lu ms (%s)", WiFi.SSID().c_str(), durationMs,
+            path == WIFI_CONNECT_CACHED ? "cached access point" : "scan");
+        LOG_INFO("Webinterface available at: http://%s", WiFi.localIP().toString().c_str());
         onceConnectedToWifi = true;
         return true;
     } else {
-        logMessage("Wifi connection failed.", 0);
+        LOG_ERROR("Wifi connection failed after %lu ms.", durationMs);
         return false;
     }
 }
 
+WifiConnectStats getWifiConnectStats() {
+    std::lock_guard<std::mutex> guard(connectStatsLock);
+    return connectStats;
+}
+
 void reconnectToWifiIfNeeded() {
-  if(WiFi.status() != WL_CONNECTED && apMode == false && onceConnectedToWifi == true) {
-    logMessage("Wifi connection lost, trying to reconnect..", 0);
+  if(!halNetworkConnected() && apMode == false && onceConnectedToWifi == true) {
+    LOG_ERROR("Wifi connection lost, trying to reconnect..");
+    {
+      std::lock_guard<std::mutex> guard(connectStatsLock);
+      connectStats.reconnects++;
+    }
     connectToWifi();
   }
 }
 
 // Start Access Point
 void startAccessPoint() {
-    logMessage("Starting Access Point", 1);
+    LOG_INFO("Starting Access Point");
     getAccessPointNameForDevice();
     WiFi.mode(WIFI_AP);
     WiFi.softAP(apName, password_default);
     apMode = true;
-    logMessage("Access Point started: ", 1);
-    logMessage(apName, 1);
-    logMessage(password_default, 1);
-    logMessage("Webinterface available at: http://" + WiFi.softAPIP().toString(), 1);
+    LOG_INFO("Access Point started: %s, password: %s", apName.c_str(), password_default.c_str());
+    LOG_INFO("Webinterface available at: http://%s", WiFi.softAPIP().toString().c_str());
 }
 
 // Generate Access Point Name for Device
 void getAccessPointNameForDevice() {
-    if (SPIFFS.exists("/ap.txt")) {
-        File file = SPIFFS.open("/ap.txt", "r");
-        if (file) {
-            apName = file.readStringUntil('\n');
-            file.close();
-            if (apName.length() > 0) {
-                return;
-            }
-        }
+    apName = getStoredApName();
+    if (apName.length() > 0) {
+        return;
     }
 
     apName = ssid_default + " " + String(random(0xffff), HEX);
-    File file = SPIFFS.open("/ap.txt", "w");
-    if (file) {
-        file.println(apName);
-        file.close();
-    }
+    storeApName(apName);
 }
 
-// Load Wifi Credentials from SPIFFS
+// Load Wifi Credentials, see wifi_credentials.h
 bool loadWifiCredentials() {
-  Serial.println("Loading Wifi Credentials from SPIFFS");
-    if (SPIFFS.exists("/wifi.txt")) {
-        File file = SPIFFS.open("/wifi.txt", "r");
-        if (file) {
-            while (file.available()) {
-                String line = file.readStringUntil('\n');
-                Serial.println("Line: " + line);
-                line.trim();
-                if (line.length() > 0) {
-                    DynamicJsonDocument doc(200); // Anpassung der Größe nach Bedarf
-                    DeserializationError error = deserializeJson(doc, line);
-                    if (!error) {
-                        String readSsid = doc["ssid"];
-                        String readPassword = doc["password"];
-                        wifiMulti.addAP(readSsid.c_str(), readPassword.c_str());
-                    } else {
-                        logMessage("Failed to parse JSON: " + String(error.c_str()), 0);
-                    }
-                }
-            }
-            file.close();
-            return true;
-        }
+    WifiCredential credentials[maxWifiCredentials];
+    int count = getWifiCredentials(credentials);
+    LOG_INFO("Loading %d saved Wifi credentials", count);
+    for (int i = 0; i < count; i++) {
+        wifiMulti.addAP(credentials[i].ssid, credentials[i].password);
     }
-    return false;
+    return count > 0;
 }
 
-// Save Wifi Credentials to SPIFFS
-// ToDo: return bool for success
-void saveWifiCredentials(String newSsid, String newPassword) {
-    if (checkDuplicates(newSsid, newPassword)) {
-        logMessage("Entry already exists, not saving: " + newSsid, 0);
-        return;
-    }
-
-    File file = SPIFFS.open("/wifi.txt", "a"); // Append Mode
-    if (file) {
-        DynamicJsonDocument doc(200);
-        doc["ssid"] = newSsid;
-        doc["password"] = newPassword;
-
-        String output;
-        serializeJson(doc, output);
-        file.println(output);
-        file.close();
-        logMessage("Saved new WiFi credentials: " + newSsid, 1);
-
-        removeOldestEntry();
-    } else {
-        logMessage("Failed to open file for writing: /wifi.txt", 0);
+// Save Wifi Credentials, a new network replaces the oldest one once maxWifiCredentials are saved
+WifiCredentialResult saveWifiCredentials(const String &newSsid, const String &newPassword) {
+    WifiCredentialResult result = storeWifiCredential(newSsid.c_str(), newPassword.c_str());
+    switch (result) {
+        case WIFI_CREDENTIAL_STORED:
+            LOG_INFO("Saved new WiFi credentials: %s", newSsid.c_str());
+            // after the restart the best network should be chosen again, the new one included
+            clearConnectCache();
+            break;
+        case WIFI_CREDENTIAL_UNCHANGED:
+            LOG_ERROR("Entry already exists, not saving: %s", newSsid.c_str());
+            break;
+        case WIFI_CREDENTIAL_INVALID:
+            LOG_ERROR("SSID or password too long, not saving: %s", newSsid.c_str());
+            break;
+        default:
+            LOG_ERROR("Failed to save WiFi credentials: %s", newSsid.c_str());
+            break;
     }
+    return result;
 }
-
-// Remove the oldest entry if there are more than 10 entries
-void removeOldestEntry() {
-    File file = SPIFFS.open("/wifi.txt", "r+"); // Read and Write Mode
-    if (file) {
-        String lines[11];
-        int count = 0;
-
-        while (file.available() && count < 11) {
-            lines[count] = file.readStringUntil('\n');
-            lines[count].trim();
-            if (lines[count].length() > 0) {
-                count++;
-            }
-        }
-
-        // Delete oldest, if more than 10 wifis saved
-        if (count > 10) {
-            file.close();
-
-            file = SPIFFS.open("/wifi.txt", "w"); // Clear the file for rewriting
-            if (file) {
-                for (int i = 1; i < count; i++) {
-                    file.println(lines[i]);
-                }
-                logMessage("Oldest entry removed, total entries: " + String(count - 1), 1);
-            }
-            file.close();
-        } else {
-            file.close();
-        }
-    }
-}
\ No newline at end of file
@@ -2,23 +2,71 @@
 #define WIFI_UTILS_H
 
 #include <Arduino.h>
+#include "wifi_credentials.h"
+#include "json_stream.h"
 
 // may change these to struct
 bool getApMode();
-String getApName();
-int getNetworks();
+const String &getApName();
+
+// a network of the last scan, the strongest access point of its ssid
+struct ScannedNetwork {
+  char ssid[maxWifiSsidLength + 1];
+  int8_t rssi;
+  uint8_t channel;
+  // wifi_auth_mode_t
+  uint8_t authMode;
+};
+
+const int maxScannedNetworks = 24;
+
+enum WifiConnectPath : uint8_t {
+  WIFI_CONNECT_CACHED,
+  WIFI_CONNECT_SCAN,
+  WIFI_CONNECT_FAILED
+};
+
+// counts of connectToWifi() since boot, durations in ms
+struct WifiConnectStats {
+  uint32_t attempts;
+  // connection lost, reconnectToWifiIfNeeded() took over
+  uint32_t reconnects;
+  // straight to the access point of the last connection, kept over restarts
+  uint32_t cachedConnects;
+  // the cached access point did not answer, counted as scan or failure as well
+  uint32_t cachedMisses;
+  uint32_t scanConnects;
+  uint32_t failures;
+  uint32_t cachedDurationMs;
+  uint32_t scanDurationMs;
+  WifiConnectPath lastPath;
+  uint32_t lastDurationMs;
+};
 
 void setDefaultHostname();
-void scanNetworks();
-void asyncScanNetworks();
-void checkAsyncScanNetworksUpdate();
-String getNetworksJsonArray();
+// asks for a fresh scan, called on every poll of /wifis. Scans run only while they are
+// asked for and at most every 30 seconds, the result is kept until the next one.
+void requestNetworkScan();
+// registers the scan and reconnect jobs, see scheduler.h
+void scheduleWifiJobs();
+// copies the last scan to networks, strongest first, returns the count
+int getScannedNetworks(ScannedNetwork *networks);
+// "open", "wpa2", ...
+const char *wifiAuthModeName(uint8_t authMode);
+// a response slot that streams the last scan as json array of {ssid, rssi, channel, auth},
+// on the web server task only, see json_stream.h. version is the one of the scan for the ETag,
+// from getNetworksVersion(), the array ends early if a newer scan comes in while it is sent.
+// NULL if all slots are used.
+JsonResponseSlot *reserveNetworksResponse(uint32_t version);
+// counts changes of the scan result, a 304 is decided from it without a response slot
+uint32_t getNetworksVersion();
 bool loadWifiCredentials();
-void saveWifiCredentials(String newSsid, String newPassword);
+WifiCredentialResult saveWifiCredentials(const String &newSsid, const String &newPassword);
+// tries the access point of the last connection first, scans with WiFiMulti if it fails
 bool connectToWifi();
+WifiConnectStats getWifiConnectStats();
 void reconnectToWifiIfNeeded();
 void startAccessPoint();
 void getAccessPointNameForDevice();
-void removeOldestEntry();
 
 #endif
\ No newline at end of file
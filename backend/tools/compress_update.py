@@ -0,0 +1,108 @@
+# Compresses an update image for /update and prints its SHA-256.
+# python3 tools/compress_update.py .pio/build/az-delivery-devkit-v4/firmware.bin [--heatshrink]
+#
+# Writes firmware.bin.gz (or firmware.bin.hs) next to the image. The device decompresses
+# it while it streams in, see src/update_decoder.h. The SHA-256 is the one of the
+# uncompressed image, pass it along to have the device check it before the update is used.
+#
+# heatshrink is written with a 1 KB window and 32 byte back references (-w 10 -l 5),
+# greedy like src/native/bench/update_bench.cpp, so it needs no heatshrink install.
+
+import gzip
+import hashlib
+import sys
+
+WINDOW_BITS = 10
+LOOKAHEAD_BITS = 5
+MAX_CANDIDATES = 64
+
+
+class BitWriter:
+    def __init__(self):
+        self.data = bytearray()
+        self.bits = 0
+        self.count = 0
+
+    def write(self, value, length):
+        self.bits = (self.bits << length) | (value & ((1 << length) - 1))
+        self.count += length
+        while self.count >= 8:
+            self.count -= 8
+            self.data.append((self.bits >> self.count) & 0xff)
+        self.bits &= (1 << self.count) - 1
+
+    def finish(self):
+        if self.count > 0:
+            self.data.append((self.bits << (8 - self.count)) & 0xff)
+        return bytes(self.data)
+
+
+def compress_heatshrink(data):
+    window_size = 1 << WINDOW_BITS
+    max_count = 1 << LOOKAHEAD_BITS
+    head = {}
+    previous = [-1] * len(data)
+    writer = BitWriter()
+
+    def insert(position):
+        if position + 1 < len(data):
+            key = data[position:position + 2]
+            previous[position] = head.get(key, -1)
+            head[key] = position
+
+    position = 0
+    while position < len(data):
+        best_count = 0
+        best_distance = 0
+        candidate = head.get(data[position:position + 2], -1) if position + 1 < len(data) else -1
+        candidates = 0
+        while candidate >= 0 and position - candidate <= window_size and candidates < MAX_CANDIDATES:
+            count = 0
+            while count < max_count and position + count < len(data) and data[candidate + count] == data[position + count]:
+                count += 1
+            if count > best_count:
+                best_count = count
+                best_distance = position - candidate
+            candidate = previous[candidate]
+            candidates += 1
+
+        if best_count >= 2:
+            writer.write(0, 1)
+            writer.write(best_distance - 1, WINDOW_BITS)
+            writer.write(best_count - 1, LOOKAHEAD_BITS)
+        else:
+            best_count = 1
+            writer.write(1, 1)
+            writer.write(data[position], 8)
+        for _ in range(best_count):
+            insert(position)
+            position += 1
+    return writer.finish()
+
+
+def main():
+    arguments = [argument for argument in sys.argv[1:] if not argument.startswith("--")]
+    if len(arguments) != 1:
+        print("usage: compress_update.py <firmware.bin|filesystem.bin> [--heatshrink]")
+        sys.exit(1)
+
+    path = arguments[0]
+    with open(path, "rb") as file:
+        data = file.read()
+
+    if "--heatshrink" in sys.argv:
+        output_path = path + ".hs"
+        compressed = compress_heatshrink(data)
+    else:
+        output_path = path + ".gz"
+        compressed = gzip.compress(data, compresslevel=9, mtime=0)
+
+    with open(output_path, "wb") as file:
+        file.write(compressed)
+
+    print("%s: %d -> %d bytes (%.1f %%)" % (output_path, len(data), len(compressed), 100.0 * len(compressed) / max(len(data), 1)))
+    print("sha256 %s" % hashlib.sha256(data).hexdigest())
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,111 @@
+# Embeds the files of data/frontend into the firmware, see src/frontend_assets.h.
+# Runs as a PlatformIO pre script, or by hand: python3 tools/embed_frontend.py
+#
+# Writes src/frontend_assets.cpp with one const byte array per file, the arrays stay
+# in the memory mapped flash and are sent from there without touching the filesystem.
+# Every file gets a content hash for its ETag. index.html refers to the other files
+# with ?v=<hash>, so the browser may cache those forever.
+
+import gzip
+import hashlib
+import os
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".js": "application/javascript",
+    ".css": "text/css",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".png": "image/png",
+    ".ico": "image/x-icon",
+}
+
+
+def content_hash(data):
+    return hashlib.sha256(data).hexdigest()[:16]
+
+
+def read_assets(frontend_dir):
+    assets = []
+    for root, _, files in os.walk(frontend_dir):
+        for name in sorted(files):
+            file_path = os.path.join(root, name)
+            url = "/" + os.path.relpath(file_path, frontend_dir).replace(os.sep, "/")
+            with open(file_path, "rb") as file:
+                data = file.read()
+            gzipped = url.endswith(".gz")
+            if gzipped:
+                url = url[:-3]
+            assets.append({"url": url, "data": data, "gzipped": gzipped})
+    return sorted(assets, key=lambda asset: asset["url"])
+
+
+def version_index_html(assets):
+    index = next((asset for asset in assets if asset["url"] == "/index.html"), None)
+    if index is None:
+        return
+    html = gzip.decompress(index["data"]) if index["gzipped"] else index["data"]
+    for asset in assets:
+        if asset is not index:
+            reference = asset["url"][1:].encode()
+            versioned = reference + b"?v=" + asset["hash"].encode()
+            html = html.replace(b'"' + reference + b'"', b'"' + versioned + b'"')
+    # mtime 0 keeps the output the same for the same input
+    index["data"] = gzip.compress(html, 9, mtime=0) if index["gzipped"] else html
+    index["hash"] = content_hash(index["data"])
+
+
+def format_bytes(data):
+    lines = []
+    for offset in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02x" % byte for byte in data[offset:offset + 16]) + ",")
+    return "\n".join(lines)
+
+
+def generate(frontend_dir, output_path):
+    assets = read_assets(frontend_dir)
+    for asset in assets:
+        asset["hash"] = content_hash(asset["data"])
+    version_index_html(assets)
+
+    parts = [
+        "// generated by tools/embed_frontend.py from data/frontend, do not edit",
+        "#include \"frontend_assets.h\"",
+        "",
+    ]
+    for number, asset in enumerate(assets):
+        parts.append("// %s" % asset["url"])
+        parts.append("alignas(4) static const uint8_t frontendAsset%d[] = {" % number)
+        parts.append(format_bytes(asset["data"]))
+        parts.append("};")
+        parts.append("")
+
+    parts.append("const FrontendAsset frontendAssets[] = {")
+    for number, asset in enumerate(assets):
+        extension = os.path.splitext(asset["url"])[1]
+        content_type = CONTENT_TYPES.get(extension, "application/octet-stream")
+        parts.append("  { \"%s\", \"%s\", frontendAsset%d, %d, %s, \"%s\", \"\\\"%s\\\"\" }," % (
+            asset["url"], content_type, number, len(asset["data"]),
+            "true" if asset["gzipped"] else "false", asset["hash"], asset["hash"]))
+    parts.append("};")
+    parts.append("const size_t frontendAssetCount = %d;" % len(assets))
+    parts.append("")
+    source = "\n".join(parts)
+
+    # an unchanged file is not compiled again
+    if os.path.exists(output_path):
+        with open(output_path) as file:
+            if file.read() == source:
+                return
+    with open(output_path, "w") as file:
+        file.write(source)
+    print("Embedded %d frontend files into %s" % (len(assets), output_path))
+
+
+try:
+    Import("env")
+    project_dir = env.subst("$PROJECT_DIR")
+except NameError:
+    project_dir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+generate(os.path.join(project_dir, "data", "frontend"), os.path.join(project_dir, "src", "frontend_assets.cpp"))
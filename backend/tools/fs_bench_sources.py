@@ -0,0 +1,36 @@
+# Adds littlefs and spiffs to the native_fs_bench build, see src/native/bench/fs_bench.cpp.
+# Downloads the pinned releases once into .pio/fs_bench and compiles only the
+# filesystem sources, the repositories also carry test runners with their own main().
+
+import os
+import tarfile
+import urllib.request
+
+Import("env")
+
+SOURCES = [
+    # name, archive, directory with the sources, sources
+    ("littlefs-2.9.3", "https://github.com/littlefs-project/littlefs/archive/refs/tags/v2.9.3.tar.gz",
+     "", ["lfs.c", "lfs_util.c"]),
+    ("spiffs-0.3.7", "https://github.com/pellepl/spiffs/archive/refs/tags/0.3.7.tar.gz",
+     "src", ["spiffs_cache.c", "spiffs_check.c", "spiffs_gc.c", "spiffs_hydrogen.c", "spiffs_nucleus.c"]),
+]
+
+download_dir = os.path.join(env.subst("$PROJECT_WORKSPACE_DIR"), "fs_bench")
+os.makedirs(download_dir, exist_ok=True)
+
+for name, url, source_dir, sources in SOURCES:
+    library_dir = os.path.join(download_dir, name)
+    if not os.path.isdir(library_dir):
+        print("Downloading %s" % url)
+        archive_path = library_dir + ".tar.gz"
+        urllib.request.urlretrieve(url, archive_path)
+        with tarfile.open(archive_path) as archive:
+            archive.extractall(download_dir)
+        os.remove(archive_path)
+
+    source_path = os.path.join(library_dir, source_dir)
+    # spiffs_config.h of the benchmark comes first, the one of the spiffs repository is for its tests
+    env.Append(CPPPATH=[source_path])
+    env.BuildSources(os.path.join("$BUILD_DIR", name), source_path,
+                     ["-<*>"] + ["+<%s>" % source for source in sources])
@@ -0,0 +1,80 @@
+// Decodes the binary log (firmware built with -D LOG_BINARY) on the host.
+//
+//   g++ -std=gnu++17 -I ../src -o logdecode logdecode.cpp ../src/log_codec.cpp
+//   curl http://<mower>/log-files                  (lists the files)
+//   curl -O http://<mower>/log-files/log-formats.txt
+//   curl -O http://<mower>/log-files/log-7.bin ...
+//   ./logdecode log-formats.txt log-7.bin log-8.bin
+//
+// Segments are printed in the given order, pass them oldest first.
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "log_codec.h"
+
+static bool readFile(const char *path, std::vector<uint8_t> &data) {
+  FILE *file = fopen(path, "rb");
+  if(!file) {
+    fprintf(stderr, "Failed to open %s\n", path);
+    return false;
+  }
+  uint8_t buffer[4096];
+  size_t read;
+  while((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    data.insert(data.end(), buffer, buffer + read);
+  }
+  fclose(file);
+  return true;
+}
+
+int main(int argc, char **argv) {
+  if(argc < 3) {
+    fprintf(stderr, "usage: %s log-formats.txt log-<n>.bin...\n", argv[0]);
+    return 2;
+  }
+
+  std::vector<uint8_t> dictionary;
+  if(!readFile(argv[1], dictionary)) {
+    return 1;
+  }
+  std::vector<std::string> formats;
+  std::string line;
+  for(uint8_t c : dictionary) {
+    if(c == '\n') {
+      formats.push_back(line);
+      line.clear();
+    } else {
+      line += (char)c;
+    }
+  }
+
+  int result = 0;
+  for(int i = 2; i < argc; i++) {
+    std::vector<uint8_t> segment;
+    if(!readFile(argv[i], segment)) {
+      result = 1;
+      continue;
+    }
+
+    LogDecoder decoder;
+    resetLogDecoder(decoder);
+    const uint8_t *position = segment.data();
+    const uint8_t *end = position + segment.size();
+    LogRecord record;
+    while(decodeLogRecord(decoder, position, end, record)) {
+      if(record.formatId == logSyncFormatId) {
+        continue;
+      }
+      const char *format = record.formatId <= formats.size() ? formats[record.formatId - 1].c_str() : NULL;
+      char text[1024];
+      formatLogRecordLine(record, format, text, sizeof(text));
+      printf("%s\n", text);
+    }
+    if(position != end) {
+      fprintf(stderr, "%s: %u bytes at the end could not be decoded\n", argv[i], (unsigned int)(end - position));
+      result = 1;
+    }
+  }
+  return result;
+}
@@ -0,0 +1,43 @@
+# Adds miniz and heatshrink to the native_update_bench build, see src/native/bench/update_bench.cpp.
+# Downloads the pinned releases once into .pio/update_bench. miniz stands in for the inflater
+# of the ESP32 ROM, heatshrink checks the encoder of tools/compress_update.py and the decoder
+# against the library, without its command line tool and tests, those have their own main().
+
+import os
+import tarfile
+import urllib.request
+import zipfile
+
+Import("env")
+
+SOURCES = [
+    # name, archive, sources
+    ("miniz-3.0.2", "https://github.com/richgel999/miniz/releases/download/3.0.2/miniz-3.0.2.zip",
+     ["miniz.c"]),
+    ("heatshrink-0.4.1", "https://github.com/atomicobject/heatshrink/archive/refs/tags/v0.4.1.tar.gz",
+     ["heatshrink_decoder.c", "heatshrink_encoder.c"]),
+]
+
+download_dir = os.path.join(env.subst("$PROJECT_WORKSPACE_DIR"), "update_bench")
+os.makedirs(download_dir, exist_ok=True)
+
+for name, url, sources in SOURCES:
+    library_dir = os.path.join(download_dir, name)
+    if not os.path.isdir(library_dir):
+        print("Downloading %s" % url)
+        if url.endswith(".zip"):
+            # the miniz release has its files at the top, not in a directory of its own
+            archive_path = library_dir + ".zip"
+            urllib.request.urlretrieve(url, archive_path)
+            with zipfile.ZipFile(archive_path) as archive:
+                archive.extractall(library_dir)
+        else:
+            archive_path = library_dir + ".tar.gz"
+            urllib.request.urlretrieve(url, archive_path)
+            with tarfile.open(archive_path) as archive:
+                archive.extractall(download_dir)
+        os.remove(archive_path)
+
+    env.Append(CPPPATH=[library_dir])
+    env.BuildSources(os.path.join("$BUILD_DIR", name), library_dir,
+                     ["-<*>"] + ["+<%s>" % source for source in sources])
@@ -1,2 +1,2 @@
 /*! For license information please see bundle.js.LICENSE.txt */
-(()=>{var t={261:(t,e,r)=>{"use strict";r.r(e),r.d(e,{default:()=>K});var o=r(601),n=r.n(o),i=r(314),a=r.n(i),s=r(417),l=r.n(s),d=new URL(r(531),r.b),c=new URL(r(115),r.b),p=new URL(r(419),r.b),b=new URL(r(385),r.b),m=new URL(r(274),r.b),g=new URL(r(154),r.b),f=new URL(r(782),r.b),u=new URL(r(718),r.b),h=new URL(r(734),r.b),v=new URL(r(487),r.b),x=new URL(r(372),r.b),w=new URL(r(247),r.b),y=new URL(r(366),r.b),_=new URL(r(326),r.b),k=new URL(r(210),r.b),E=new URL(r(690),r.b),A=new URL(r(249),r.b),S=new URL(r(932),r.b),T=new URL(r(144),r.b),O=a()(n()),C=l()(d),j=l()(c),z=l()(p),L=l()(b),R=l()(m),P=l()(g),D=l()(f),M=l()(u),N=l()(h),I=l()(v),B=l()(x),F=l()(w),$=l()(y),U=l()(_),V=l()(k),W=l()(E),H=l()(A),q=l()(S),G=l()(T);O.push([t.id,`@charset "UTF-8";/*!\n * Bootstrap  v5.3.3 (https://getbootstrap.com/)\n * Copyright 2011-2024 The Bootstrap Authors\n * Licensed under MIT (https://github.com/twbs/bootstrap/blob/main/LICENSE)\n */:root,[data-bs-theme=light]{--bs-blue:#0d6efd;--bs-indigo:#6610f2;--bs-purple:#6f42c1;--bs-pink:#d63384;--bs-red:#dc3545;--bs-orange:#fd7e14;--bs-yellow:#ffc107;--bs-green:#198754;--bs-teal:#20c997;--bs-cyan:#0dcaf0;--bs-black:#000;--bs-white:#fff;--bs-gray:#6c757d;--bs-gray-dark:#343a40;--bs-gray-100:#f8f9fa;--bs-gray-200:#e9ecef;--bs-gray-300:#dee2e6;--bs-gray-400:#ced4da;--bs-gray-500:#adb5bd;--bs-gray-600:#6c757d;--bs-gray-700:#495057;--bs-gray-800:#343a40;--bs-gray-900:#212529;--bs-primary:#0d6efd;--bs-secondary:#6c757d;--bs-success:#198754;--bs-info:#0dcaf0;--bs-warning:#ffc107;--bs-danger:#dc3545;--bs-light:#f8f9fa;--bs-dark:#212529;--bs-primary-rgb:13,110,253;--bs-secondary-rgb:108,117,125;--bs-success-rgb:25,135,84;--bs-info-rgb:13,202,240;--bs-warning-rgb:255,193,7;--bs-danger-rgb:220,53,69;--bs-light-rgb:248,249,250;--bs-dark-rgb:33,37,41;--bs-primary-text-emphasis:#052c65;--bs-secondary-text-emphasis:#2b2f32;--bs-success-text-emphasis:#0a3622;--bs-info-text-emphasis:#055160;--bs-warning-text-emphasis:#664d03;--bs-danger-text-emphasis:#58151c;--bs-light-text-emphasis:#495057;--bs-dark-text-emphasis:#495057;--bs-primary-bg-subtle:#cfe2ff;--bs-secondary-bg-subtle:#e2e3e5;--bs-success-bg-subtle:#d1e7dd;--bs-info-bg-subtle:#cff4fc;--bs-warning-bg-subtle:#fff3cd;--bs-danger-bg-subtle:#f8d7da;--bs-light-bg-subtle:#fcfcfd;--bs-dark-bg-subtle:#ced4da;--bs-primary-border-subtle:#9ec5fe;--bs-secondary-border-subtle:#c4c8cb;--bs-success-border-subtle:#a3cfbb;--bs-info-border-subtle:#9eeaf9;--bs-warning-border-subtle:#ffe69c;--bs-danger-border-subtle:#f1aeb5;--bs-light-border-subtle:#e9ecef;--bs-dark-border-subtle:#adb5bd;--bs-white-rgb:255,255,255;--bs-black-rgb:0,0,0;--bs-font-sans-serif:system-ui,-apple-system,"Segoe UI",Roboto,"Helvetica Neue","Noto Sans","Liberation Sans",Arial,sans-serif,"Apple Color Emoji","Segoe UI Emoji","Segoe UI Symbol","Noto Color Emoji";--bs-font-monospace:SFMono-Regular,Menlo,Monaco,Consolas,"Liberation Mono","Courier New",monospace;--bs-gradient:linear-gradient(180deg, rgba(255, 255, 255, 0.15), rgba(255, 255, 255, 0));--bs-body-font-family:var(--bs-font-sans-serif);--bs-body-font-size:1rem;--bs-body-font-weight:400;--bs-body-line-height:1.5;--bs-body-color:#212529;--bs-body-color-rgb:33,37,41;--bs-body-bg:#fff;--bs-body-bg-rgb:255,255,255;--bs-emphasis-color:#000;--bs-emphasis-color-rgb:0,0,0;--bs-secondary-color:rgba(33, 37, 41, 0.75);--bs-secondary-color-rgb:33,37,41;--bs-secondary-bg:#e9ecef;--bs-secondary-bg-rgb:233,236,239;--bs-tertiary-color:rgba(33, 37, 41, 0.5);--bs-tertiary-color-rgb:33,37,41;--bs-tertiary-bg:#f8f9fa;--bs-tertiary-bg-rgb:248,249,250;--bs-heading-color:inherit;--bs-link-color:#0d6efd;--bs-link-color-rgb:13,110,253;--bs-link-decoration:underline;--bs-link-hover-color:#0a58ca;--bs-link-hover-color-rgb:10,88,202;--bs-code-color:#d63384;--bs-highlight-color:#212529;--bs-highlight-bg:#fff3cd;--bs-border-width:1px;--bs-border-style:solid;--bs-border-color:#dee2e6;--bs-border-color-translucent:rgba(0, 0, 0, 0.175);--bs-border-radius:0.375rem;--bs-border-radius-sm:0.25rem;--bs-border-radius-lg:0.5rem;--bs-border-radius-xl:1rem;--bs-border-radius-xxl:2rem;--bs-border-radius-2xl:var(--bs-border-radius-xxl);--bs-border-radius-pill:50rem;--bs-box-shadow:0 0.5rem 1rem rgba(0, 0, 0, 0.15);--bs-box-shadow-sm:0 0.125rem 0.25rem rgba(0, 0, 0, 0.075);--bs-box-shadow-lg:0 1rem 3rem rgba(0, 0, 0, 0.175);--bs-box-shadow-inset:inset 0 1px 2px rgba(0, 0, 0, 0.075);--bs-focus-ring-width:0.25rem;--bs-focus-ring-opacity:0.25;--bs-focus-ring-color:rgba(13, 110, 253, 0.25);--bs-form-valid-color:#198754;--bs-form-valid-border-color:#198754;--bs-form-invalid-color:#dc3545;--bs-form-invalid-border-color:#dc3545}[data-bs-theme=dark]{color-scheme:dark;--bs-body-color:#dee2e6;--bs-body-color-rgb:222,226,230;--bs-body-bg:#212529;--bs-body-bg-rgb:33,37,41;--bs-emphasis-color:#fff;--bs-emphasis-color-rgb:255,255,255;--bs-secondary-color:rgba(222, 226, 230, 0.75);--bs-secondary-color-rgb:222,226,230;--bs-secondary-bg:#343a40;--bs-secondary-bg-rgb:52,58,64;--bs-tertiary-color:rgba(222, 226, 230, 0.5);--bs-tertiary-color-rgb:222,226,230;--bs-tertiary-bg:#2b3035;--bs-tertiary-bg-rgb:43,48,53;--bs-primary-text-emphasis:#6ea8fe;--bs-secondary-text-emphasis:#a7acb1;--bs-success-text-emphasis:#75b798;--bs-info-text-emphasis:#6edff6;--bs-warning-text-emphasis:#ffda6a;--bs-danger-text-emphasis:#ea868f;--bs-light-text-emphasis:#f8f9fa;--bs-dark-text-emphasis:#dee2e6;--bs-primary-bg-subtle:#031633;--bs-secondary-bg-subtle:#161719;--bs-success-bg-subtle:#051b11;--bs-info-bg-subtle:#032830;--bs-warning-bg-subtle:#332701;--bs-danger-bg-subtle:#2c0b0e;--bs-light-bg-subtle:#343a40;--bs-dark-bg-subtle:#1a1d20;--bs-primary-border-subtle:#084298;--bs-secondary-border-subtle:#41464b;--bs-success-border-subtle:#0f5132;--bs-info-border-subtle:#087990;--bs-warning-border-subtle:#997404;--bs-danger-border-subtle:#842029;--bs-light-border-subtle:#495057;--bs-dark-border-subtle:#343a40;--bs-heading-color:inherit;--bs-link-color:#6ea8fe;--bs-link-hover-color:#8bb9fe;--bs-link-color-rgb:110,168,254;--bs-link-hover-color-rgb:139,185,254;--bs-code-color:#e685b5;--bs-highlight-color:#dee2e6;--bs-highlight-bg:#664d03;--bs-border-color:#495057;--bs-border-color-translucent:rgba(255, 255, 255, 0.15);--bs-form-valid-color:#75b798;--bs-form-valid-border-color:#75b798;--bs-form-invalid-color:#ea868f;--bs-form-invalid-border-color:#ea868f}*,::after,::before{box-sizing:border-box}@media (prefers-reduced-motion:no-preference){:root{scroll-behavior:smooth}}body{margin:0;font-family:var(--bs-body-font-family);font-size:var(--bs-body-font-size);font-weight:var(--bs-body-font-weight);line-height:var(--bs-body-line-height);color:var(--bs-body-color);text-align:var(--bs-body-text-align);background-color:var(--bs-body-bg);-webkit-text-size-adjust:100%;-webkit-tap-highlight-color:transparent}hr{margin:1rem 0;color:inherit;border:0;border-top:var(--bs-border-width) solid;opacity:.25}.h1,.h2,.h3,.h4,.h5,.h6,h1,h2,h3,h4,h5,h6{margin-top:0;margin-bottom:.5rem;font-weight:500;line-height:1.2;color:var(--bs-heading-color)}.h1,h1{font-size:calc(1.375rem + 1.5vw)}@media (min-width:1200px){.h1,h1{font-size:2.5rem}}.h2,h2{font-size:calc(1.325rem + .9vw)}@media (min-width:1200px){.h2,h2{font-size:2rem}}.h3,h3{font-size:calc(1.3rem + .6vw)}@media (min-width:1200px){.h3,h3{font-size:1.75rem}}.h4,h4{font-size:calc(1.275rem + .3vw)}@media (min-width:1200px){.h4,h4{font-size:1.5rem}}.h5,h5{font-size:1.25rem}.h6,h6{font-size:1rem}p{margin-top:0;margin-bottom:1rem}abbr[title]{-webkit-text-decoration:underline dotted;text-decoration:underline dotted;cursor:help;-webkit-text-decoration-skip-ink:none;text-decoration-skip-ink:none}address{margin-bottom:1rem;font-style:normal;line-height:inherit}ol,ul{padding-left:2rem}dl,ol,ul{margin-top:0;margin-bottom:1rem}ol ol,ol ul,ul ol,ul ul{margin-bottom:0}dt{font-weight:700}dd{margin-bottom:.5rem;margin-left:0}blockquote{margin:0 0 1rem}b,strong{font-weight:bolder}.small,small{font-size:.875em}.mark,mark{padding:.1875em;color:var(--bs-highlight-color);background-color:var(--bs-highlight-bg)}sub,sup{position:relative;font-size:.75em;line-height:0;vertical-align:baseline}sub{bottom:-.25em}sup{top:-.5em}a{color:rgba(var(--bs-link-color-rgb),var(--bs-link-opacity,1));text-decoration:underline}a:hover{--bs-link-color-rgb:var(--bs-link-hover-color-rgb)}a:not([href]):not([class]),a:not([href]):not([class]):hover{color:inherit;text-decoration:none}code,kbd,pre,samp{font-family:var(--bs-font-monospace);font-size:1em}pre{display:block;margin-top:0;margin-bottom:1rem;overflow:auto;font-size:.875em}pre code{font-size:inherit;color:inherit;word-break:normal}code{font-size:.875em;color:var(--bs-code-color);word-wrap:break-word}a>code{color:inherit}kbd{padding:.1875rem .375rem;font-size:.875em;color:var(--bs-body-bg);background-color:var(--bs-body-color);border-radius:.25rem}kbd kbd{padding:0;font-size:1em}figure{margin:0 0 1rem}img,svg{vertical-align:middle}table{caption-side:bottom;border-collapse:collapse}caption{padding-top:.5rem;padding-bottom:.5rem;color:var(--bs-secondary-color);text-align:left}th{text-align:inherit;text-align:-webkit-match-parent}tbody,td,tfoot,th,thead,tr{border-color:inherit;border-style:solid;border-width:0}label{display:inline-block}button{border-radius:0}button:focus:not(:focus-visible){outline:0}button,input,optgroup,select,textarea{margin:0;font-family:inherit;font-size:inherit;line-height:inherit}button,select{text-transform:none}[role=button]{cursor:pointer}select{word-wrap:normal}select:disabled{opacity:1}[list]:not([type=date]):not([type=datetime-local]):not([type=month]):not([type=week]):not([type=time])::-webkit-calendar-picker-indicator{display:none!important}[type=button],[type=reset],[type=submit],button{-webkit-appearance:button}[type=button]:not(:disabled),[type=reset]:not(:disabled),[type=submit]:not(:disabled),button:not(:disabled){cursor:pointer}::-moz-focus-inner{padding:0;border-style:none}textarea{resize:vertical}fieldset{min-width:0;padding:0;margin:0;border:0}legend{float:left;width:100%;padding:0;margin-bottom:.5rem;font-size:calc(1.275rem + .3vw);line-height:inherit}@media (min-width:1200px){legend{font-size:1.5rem}}legend+*{clear:left}::-webkit-datetime-edit-day-field,::-webkit-datetime-edit-fields-wrapper,::-webkit-datetime-edit-hour-field,::-webkit-datetime-edit-minute,::-webkit-datetime-edit-month-field,::-webkit-datetime-edit-text,::-webkit-datetime-edit-year-field{padding:0}::-webkit-inner-spin-button{height:auto}[type=search]{-webkit-appearance:textfield;outline-offset:-2px}::-webkit-search-decoration{-webkit-appearance:none}::-webkit-color-swatch-wrapper{padding:0}::-webkit-file-upload-button{font:inherit;-webkit-appearance:button}::file-selector-button{font:inherit;-webkit-appearance:button}output{display:inline-block}iframe{border:0}summary{display:list-item;cursor:pointer}progress{vertical-align:baseline}[hidden]{display:none!important}.lead{font-size:1.25rem;font-weight:300}.display-1{font-size:calc(1.625rem + 4.5vw);font-weight:300;line-height:1.2}@media (min-width:1200px){.display-1{font-size:5rem}}.display-2{font-size:calc(1.575rem + 3.9vw);font-weight:300;line-height:1.2}@media (min-width:1200px){.display-2{font-size:4.5rem}}.display-3{font-size:calc(1.525rem + 3.3vw);font-weight:300;line-height:1.2}@media (min-width:1200px){.display-3{font-size:4rem}}.display-4{font-size:calc(1.475rem + 2.7vw);font-weight:300;line-height:1.2}@media (min-width:1200px){.display-4{font-size:3.5rem}}.display-5{font-size:calc(1.425rem + 2.1vw);font-weight:300;line-height:1.2}@media (min-width:1200px){.display-5{font-size:3rem}}.display-6{font-size:calc(1.375rem + 1.5vw);font-weight:300;line-height:1.2}@media (min-width:1200px){.display-6{font-size:2.5rem}}.list-unstyled{padding-left:0;list-style:none}.list-inline{padding-left:0;list-style:none}.list-inline-item{display:inline-block}.list-inline-item:not(:last-child){margin-right:.5rem}.initialism{font-size:.875em;text-transform:uppercase}.blockquote{margin-bottom:1rem;font-size:1.25rem}.blockquote>:last-child{margin-bottom:0}.blockquote-footer{margin-top:-1rem;margin-bottom:1rem;font-size:.875em;color:#6c757d}.blockquote-footer::before{content:"— "}.img-fluid{max-width:100%;height:auto}.img-thumbnail{padding:.25rem;background-color:var(--bs-body-bg);border:var(--bs-border-width) solid var(--bs-border-color);border-radius:var(--bs-border-radius);max-width:100%;height:auto}.figure{display:inline-block}.figure-img{margin-bottom:.5rem;line-height:1}.figure-caption{font-size:.875em;color:var(--bs-secondary-color)}.container,.container-fluid,.container-lg,.container-md,.container-sm,.container-xl,.container-xxl{--bs-gutter-x:1.5rem;--bs-gutter-y:0;width:100%;padding-right:calc(var(--bs-gutter-x) * .5);padding-left:calc(var(--bs-gutter-x) * .5);margin-right:auto;margin-left:auto}@media (min-width:576px){.container,.container-sm{max-width:540px}}@media (min-width:768px){.container,.container-md,.container-sm{max-width:720px}}@media (min-width:992px){.container,.container-lg,.container-md,.container-sm{max-width:960px}}@media (min-width:1200px){.container,.container-lg,.container-md,.container-sm,.container-xl{max-width:1140px}}@media (min-width:1400px){.container,.container-lg,.container-md,.container-sm,.container-xl,.container-xxl{max-width:1320px}}:root{--bs-breakpoint-xs:0;--bs-breakpoint-sm:576px;--bs-breakpoint-md:768px;--bs-breakpoint-lg:992px;--bs-breakpoint-xl:1200px;--bs-breakpoint-xxl:1400px}.row{--bs-gutter-x:1.5rem;--bs-gutter-y:0;display:flex;flex-wrap:wrap;margin-top:calc(-1 * var(--bs-gutter-y));margin-right:calc(-.5 * var(--bs-gutter-x));margin-left:calc(-.5 * var(--bs-gutter-x))}.row>*{flex-shrink:0;width:100%;max-width:100%;padding-right:calc(var(--bs-gutter-x) * .5);padding-left:calc(var(--bs-gutter-x) * .5);margin-top:var(--bs-gutter-y)}.col{flex:1 0 0%}.row-cols-auto>*{flex:0 0 auto;width:auto}.row-cols-1>*{flex:0 0 auto;width:100%}.row-cols-2>*{flex:0 0 auto;width:50%}.row-cols-3>*{flex:0 0 auto;width:33.33333333%}.row-cols-4>*{flex:0 0 auto;width:25%}.row-cols-5>*{flex:0 0 auto;width:20%}.row-cols-6>*{flex:0 0 auto;width:16.66666667%}.col-auto{flex:0 0 auto;width:auto}.col-1{flex:0 0 auto;width:8.33333333%}.col-2{flex:0 0 auto;width:16.66666667%}.col-3{flex:0 0 auto;width:25%}.col-4{flex:0 0 auto;width:33.33333333%}.col-5{flex:0 0 auto;width:41.66666667%}.col-6{flex:0 0 auto;width:50%}.col-7{flex:0 0 auto;width:58.33333333%}.col-8{flex:0 0 auto;width:66.66666667%}.col-9{flex:0 0 auto;width:75%}.col-10{flex:0 0 auto;width:83.33333333%}.col-11{flex:0 0 auto;width:91.66666667%}.col-12{flex:0 0 auto;width:100%}.offset-1{margin-left:8.33333333%}.offset-2{margin-left:16.66666667%}.offset-3{margin-left:25%}.offset-4{margin-left:33.33333333%}.offset-5{margin-left:41.66666667%}.offset-6{margin-left:50%}.offset-7{margin-left:58.33333333%}.offset-8{margin-left:66.66666667%}.offset-9{margin-left:75%}.offset-10{margin-left:83.33333333%}.offset-11{margin-left:91.66666667%}.g-0,.gx-0{--bs-gutter-x:0}.g-0,.gy-0{--bs-gutter-y:0}.g-1,.gx-1{--bs-gutter-x:0.25rem}.g-1,.gy-1{--bs-gutter-y:0.25rem}.g-2,.gx-2{--bs-gutter-x:0.5rem}.g-2,.gy-2{--bs-gutter-y:0.5rem}.g-3,.gx-3{--bs-gutter-x:1rem}.g-3,.gy-3{--bs-gutter-y:1rem}.g-4,.gx-4{--bs-gutter-x:1.5rem}.g-4,.gy-4{--bs-gutter-y:1.5rem}.g-5,.gx-5{--bs-gutter-x:3rem}.g-5,.gy-5{--bs-gutter-y:3rem}@media (min-width:576px){.col-sm{flex:1 0 0%}.row-cols-sm-auto>*{flex:0 0 auto;width:auto}.row-cols-sm-1>*{flex:0 0 auto;width:100%}.row-cols-sm-2>*{flex:0 0 auto;width:50%}.row-cols-sm-3>*{flex:0 0 auto;width:33.33333333%}.row-cols-sm-4>*{flex:0 0 auto;width:25%}.row-cols-sm-5>*{flex:0 0 auto;width:20%}.row-cols-sm-6>*{flex:0 0 auto;width:16.66666667%}.col-sm-auto{flex:0 0 auto;width:auto}.col-sm-1{flex:0 0 auto;width:8.33333333%}.col-sm-2{flex:0 0 auto;width:16.66666667%}.col-sm-3{flex:0 0 auto;width:25%}.col-sm-4{flex:0 0 auto;width:33.33333333%}.col-sm-5{flex:0 0 auto;width:41.66666667%}.col-sm-6{flex:0 0 auto;width:50%}.col-sm-7{flex:0 0 auto;width:58.33333333%}.col-sm-8{flex:0 0 auto;width:66.66666667%}.col-sm-9{flex:0 0 auto;width:75%}.col-sm-10{flex:0 0 auto;width:83.33333333%}.col-sm-11{flex:0 0 auto;width:91.66666667%}.col-sm-12{flex:0 0 auto;width:100%}.offset-sm-0{margin-left:0}.offset-sm-1{margin-left:8.33333333%}.offset-sm-2{margin-left:16.66666667%}.offset-sm-3{margin-left:25%}.offset-sm-4{margin-left:33.33333333%}.offset-sm-5{margin-left:41.66666667%}.offset-sm-6{margin-left:50%}.offset-sm-7{margin-left:58.33333333%}.offset-sm-8{margin-left:66.66666667%}.offset-sm-9{margin-left:75%}.offset-sm-10{margin-left:83.33333333%}.offset-sm-11{margin-left:91.66666667%}.g-sm-0,.gx-sm-0{--bs-gutter-x:0}.g-sm-0,.gy-sm-0{--bs-gutter-y:0}.g-sm-1,.gx-sm-1{--bs-gutter-x:0.25rem}.g-sm-1,.gy-sm-1{--bs-gutter-y:0.25rem}.g-sm-2,.gx-sm-2{--bs-gutter-x:0.5rem}.g-sm-2,.gy-sm-2{--bs-gutter-y:0.5rem}.g-sm-3,.gx-sm-3{--bs-gutter-x:1rem}.g-sm-3,.gy-sm-3{--bs-gutter-y:1rem}.g-sm-4,.gx-sm-4{--bs-gutter-x:1.5rem}.g-sm-4,.gy-sm-4{--bs-gutter-y:1.5rem}.g-sm-5,.gx-sm-5{--bs-gutter-x:3rem}.g-sm-5,.gy-sm-5{--bs-gutter-y:3rem}}@media (min-width:768px){.col-md{flex:1 0 0%}.row-cols-md-auto>*{flex:0 0 auto;width:auto}.row-cols-md-1>*{flex:0 0 auto;width:100%}.row-cols-md-2>*{flex:0 0 auto;width:50%}.row-cols-md-3>*{flex:0 0 auto;width:33.33333333%}.row-cols-md-4>*{flex:0 0 auto;width:25%}.row-cols-md-5>*{flex:0 0 auto;width:20%}.row-cols-md-6>*{flex:0 0 auto;width:16.66666667%}.col-md-auto{flex:0 0 auto;width:auto}.col-md-1{flex:0 0 auto;width:8.33333333%}.col-md-2{flex:0 0 auto;width:16.66666667%}.col-md-3{flex:0 0 auto;width:25%}.col-md-4{flex:0 0 auto;width:33.33333333%}.col-md-5{flex:0 0 auto;width:41.66666667%}.col-md-6{flex:0 0 auto;width:50%}.col-md-7{flex:0 0 auto;width:58.33333333%}.col-md-8{flex:0 0 auto;width:66.66666667%}.col-md-9{flex:0 0 auto;width:75%}.col-md-10{flex:0 0 auto;width:83.33333333%}.col-md-11{flex:0 0 auto;width:91.66666667%}.col-md-12{flex:0 0 auto;width:100%}.offset-md-0{margin-left:0}.offset-md-1{margin-left:8.33333333%}.offset-md-2{margin-left:16.66666667%}.offset-md-3{margin-left:25%}.offset-md-4{margin-left:33.33333333%}.offset-md-5{margin-left:41.66666667%}.offset-md-6{margin-left:50%}.offset-md-7{margin-left:58.33333333%}.offset-md-8{margin-left:66.66666667%}.offset-md-9{margin-left:75%}.offset-md-10{margin-left:83.33333333%}.offset-md-11{margin-left:91.66666667%}.g-md-0,.gx-md-0{--bs-gutter-x:0}.g-md-0,.gy-md-0{--bs-gutter-y:0}.g-md-1,.gx-md-1{--bs-gutter-x:0.25rem}.g-md-1,.gy-md-1{--bs-gutter-y:0.25rem}.g-md-2,.gx-md-2{--bs-gutter-x:0.5rem}.g-md-2,.gy-md-2{--bs-gutter-y:0.5rem}.g-md-3,.gx-md-3{--bs-gutter-x:1rem}.g-md-3,.gy-md-3{--bs-gutter-y:1rem}.g-md-4,.gx-md-4{--bs-gutter-x:1.5rem}.g-md-4,.gy-md-4{--bs-gutter-y:1.5rem}.g-md-5,.gx-md-5{--bs-gutter-x:3rem}.g-md-5,.gy-md-5{--bs-gutter-y:3rem}}@media (min-width:992px){.col-lg{flex:1 0 0%}.row-cols-lg-auto>*{flex:0 0 auto;width:auto}.row-cols-lg-1>*{flex:0 0 auto;width:100%}.row-cols-lg-2>*{flex:0 0 auto;width:50%}.row-cols-lg-3>*{flex:0 0 auto;width:33.33333333%}.row-cols-lg-4>*{flex:0 0 auto;width:25%}.row-cols-lg-5>*{flex:0 0 auto;width:20%}.row-cols-lg-6>*{flex:0 0 auto;width:16.66666667%}.col-lg-auto{flex:0 0 auto;width:auto}.col-lg-1{flex:0 0 auto;width:8.33333333%}.col-lg-2{flex:0 0 auto;width:16.66666667%}.col-lg-3{flex:0 0 auto;width:25%}.col-lg-4{flex:0 0 auto;width:33.33333333%}.col-lg-5{flex:0 0 auto;width:41.66666667%}.col-lg-6{flex:0 0 auto;width:50%}.col-lg-7{flex:0 0 auto;width:58.33333333%}.col-lg-8{flex:0 0 auto;width:66.66666667%}.col-lg-9{flex:0 0 auto;width:75%}.col-lg-10{flex:0 0 auto;width:83.33333333%}.col-lg-11{flex:0 0 auto;width:91.66666667%}.col-lg-12{flex:0 0 auto;width:100%}.offset-lg-0{margin-left:0}.offset-lg-1{margin-left:8.33333333%}.offset-lg-2{margin-left:16.66666667%}.offset-lg-3{margin-left:25%}.offset-lg-4{margin-left:33.33333333%}.offset-lg-5{margin-left:41.66666667%}.offset-lg-6{margin-left:50%}.offset-lg-7{margin-left:58.33333333%}.offset-lg-8{margin-left:66.66666667%}.offset-lg-9{margin-left:75%}.offset-lg-10{margin-left:83.33333333%}.offset-lg-11{margin-left:91.66666667%}.g-lg-0,.gx-lg-0{--bs-gutter-x:0}.g-lg-0,.gy-lg-0{--bs-gutter-y:0}.g-lg-1,.gx-lg-1{--bs-gutter-x:0.25rem}.g-lg-1,.gy-lg-1{--bs-gutter-y:0.25rem}.g-lg-2,.gx-lg-2{--bs-gutter-x:0.5rem}.g-lg-2,.gy-lg-2{--bs-gutter-y:0.5rem}.g-lg-3,.gx-lg-3{--bs-gutter-x:1rem}.g-lg-3,.gy-lg-3{--bs-gutter-y:1rem}.g-lg-4,.gx-lg-4{--bs-gutter-x:1.5rem}.g-lg-4,.gy-lg-4{--bs-gutter-y:1.5rem}.g-lg-5,.gx-lg-5{--bs-gutter-x:3rem}.g-lg-5,.gy-lg-5{--bs-gutter-y:3rem}}@media (min-width:1200px){.col-xl{flex:1 0 0%}.row-cols-xl-auto>*{flex:0 0 auto;width:auto}.row-cols-xl-1>*{flex:0 0 auto;width:100%}.row-cols-xl-2>*{flex:0 0 auto;width:50%}.row-cols-xl-3>*{flex:0 0 auto;width:33.33333333%}.row-cols-xl-4>*{flex:0 0 auto;width:25%}.row-cols-xl-5>*{flex:0 0 auto;width:20%}.row-cols-xl-6>*{flex:0 0 auto;width:16.66666667%}.col-xl-auto{flex:0 0 auto;width:auto}.col-xl-1{flex:0 0 auto;width:8.33333333%}.col-xl-2{flex:0 0 auto;width:16.66666667%}.col-xl-3{flex:0 0 auto;width:25%}.col-xl-4{flex:0 0 auto;width:33.33333333%}.col-xl-5{flex:0 0 auto;width:41.66666667%}.col-xl-6{flex:0 0 auto;width:50%}.col-xl-7{flex:0 0 auto;width:58.33333333%}.col-xl-8{flex:0 0 auto;width:66.66666667%}.col-xl-9{flex:0 0 auto;width:75%}.col-xl-10{flex:0 0 auto;width:83.33333333%}.col-xl-11{flex:0 0 auto;width:91.66666667%}.col-xl-12{flex:0 0 auto;width:100%}.offset-xl-0{margin-left:0}.offset-xl-1{margin-left:8.33333333%}.offset-xl-2{margin-left:16.66666667%}.offset-xl-3{margin-left:25%}.offset-xl-4{margin-left:33.33333333%}.offset-xl-5{margin-left:41.66666667%}.offset-xl-6{margin-left:50%}.offset-xl-7{margin-left:58.33333333%}.offset-xl-8{margin-left:66.66666667%}.offset-xl-9{margin-left:75%}.offset-xl-10{margin-left:83.33333333%}.offset-xl-11{margin-left:91.66666667%}.g-xl-0,.gx-xl-0{--bs-gutter-x:0}.g-xl-0,.gy-xl-0{--bs-gutter-y:0}.g-xl-1,.gx-xl-1{--bs-gutter-x:0.25rem}.g-xl-1,.gy-xl-1{--bs-gutter-y:0.25rem}.g-xl-2,.gx-xl-2{--bs-gutter-x:0.5rem}.g-xl-2,.gy-xl-2{--bs-gutter-y:0.5rem}.g-xl-3,.gx-xl-3{--bs-gutter-x:1rem}.g-xl-3,.gy-xl-3{--bs-gutter-y:1rem}.g-xl-4,.gx-xl-4{--bs-gutter-x:1.5rem}.g-xl-4,.gy-xl-4{--bs-gutter-y:1.5rem}.g-xl-5,.gx-xl-5{--bs-gutter-x:3rem}.g-xl-5,.gy-xl-5{--bs-gutter-y:3rem}}@media (min-width:1400px){.col-xxl{flex:1 0 0%}.row-cols-xxl-auto>*{flex:0 0 auto;width:auto}.row-cols-xxl-1>*{flex:0 0 auto;width:100%}.row-cols-xxl-2>*{flex:0 0 auto;width:50%}.row-cols-xxl-3>*{flex:0 0 auto;width:33.33333333%}.row-cols-xxl-4>*{flex:0 0 auto;width:25%}.row-cols-xxl-5>*{flex:0 0 auto;width:20%}.row-cols-xxl-6>*{flex:0 0 auto;width:16.66666667%}.col-xxl-auto{flex:0 0 auto;width:auto}.col-xxl-1{flex:0 0 auto;width:8.33333333%}.col-xxl-2{flex:0 0 auto;width:16.66666667%}.col-xxl-3{flex:0 0 auto;width:25%}.col-xxl-4{flex:0 0 auto;width:33.33333333%}.col-xxl-5{flex:0 0 auto;width:41.66666667%}.col-xxl-6{flex:0 0 auto;width:50%}.col-xxl-7{flex:0 0 auto;width:58.33333333%}.col-xxl-8{flex:0 0 auto;width:66.66666667%}.col-xxl-9{flex:0 0 auto;width:75%}.col-xxl-10{flex:0 0 auto;width:83.33333333%}.col-xxl-11{flex:0 0 auto;width:91.66666667%}.col-xxl-12{flex:0 0 auto;width:100%}.offset-xxl-0{margin-left:0}.offset-xxl-1{margin-left:8.33333333%}.offset-xxl-2{margin-left:16.66666667%}.offset-xxl-3{margin-left:25%}.offset-xxl-4{margin-left:33.33333333%}.offset-xxl-5{margin-left:41.66666667%}.offset-xxl-6{margin-left:50%}.offset-xxl-7{margin-left:58.33333333%}.offset-xxl-8{margin-left:66.66666667%}.offset-xxl-9{margin-left:75%}.offset-xxl-10{margin-left:83.33333333%}.offset-xxl-11{margin-left:91.66666667%}.g-xxl-0,.gx-xxl-0{--bs-gutter-x:0}.g-xxl-0,.gy-xxl-0{--bs-gutter-y:0}.g-xxl-1,.gx-xxl-1{--bs-gutter-x:0.25rem}.g-xxl-1,.gy-xxl-1{--bs-gutter-y:0.25rem}.g-xxl-2,.gx-xxl-2{--bs-gutter-x:0.5rem}.g-xxl-2,.gy-xxl-2{--bs-gutter-y:0.5rem}.g-xxl-3,.gx-xxl-3{--bs-gutter-x:1rem}.g-xxl-3,.gy-xxl-3{--bs-gutter-y:1rem}.g-xxl-4,.gx-xxl-4{--bs-gutter-x:1.5rem}.g-xxl-4,.gy-xxl-4{--bs-gutter-y:1.5rem}.g-xxl-5,.gx-xxl-5{--bs-gutter-x:3rem}.g-xxl-5,.gy-xxl-5{--bs-gutter-y:3rem}}.table{--bs-table-color-type:initial;--bs-table-bg-type:initial;--bs-table-color-state:initial;--bs-table-bg-state:initial;--bs-table-color:var(--bs-emphasis-color);--bs-table-bg:var(--bs-body-bg);--bs-table-border-color:var(--bs-border-color);--bs-table-accent-bg:transparent;--bs-table-striped-color:var(--bs-emphasis-color);--bs-table-striped-bg:rgba(var(--bs-emphasis-color-rgb), 0.05);--bs-table-active-color:var(--bs-emphasis-color);--bs-table-active-bg:rgba(var(--bs-emphasis-color-rgb), 0.1);--bs-table-hover-color:var(--bs-emphasis-color);--bs-table-hover-bg:rgba(var(--bs-emphasis-color-rgb), 0.075);width:100%;margin-bottom:1rem;vertical-align:top;border-color:var(--bs-table-border-color)}.table>:not(caption)>*>*{padding:.5rem .5rem;color:var(--bs-table-color-state,var(--bs-table-color-type,var(--bs-table-color)));background-color:var(--bs-table-bg);border-bottom-width:var(--bs-border-width);box-shadow:inset 0 0 0 9999px var(--bs-table-bg-state,var(--bs-table-bg-type,var(--bs-table-accent-bg)))}.table>tbody{vertical-align:inherit}.table>thead{vertical-align:bottom}.table-group-divider{border-top:calc(var(--bs-border-width) * 2) solid currentcolor}.caption-top{caption-side:top}.table-sm>:not(caption)>*>*{padding:.25rem .25rem}.table-bordered>:not(caption)>*{border-width:var(--bs-border-width) 0}.table-bordered>:not(caption)>*>*{border-width:0 var(--bs-border-width)}.table-borderless>:not(caption)>*>*{border-bottom-width:0}.table-borderless>:not(:first-child){border-top-width:0}.table-striped>tbody>tr:nth-of-type(odd)>*{--bs-table-color-type:var(--bs-table-striped-color);--bs-table-bg-type:var(--bs-table-striped-bg)}.table-striped-columns>:not(caption)>tr>:nth-child(2n){--bs-table-color-type:var(--bs-table-striped-color);--bs-table-bg-type:var(--bs-table-striped-bg)}.table-active{--bs-table-color-state:var(--bs-table-active-color);--bs-table-bg-state:var(--bs-table-active-bg)}.table-hover>tbody>tr:hover>*{--bs-table-color-state:var(--bs-table-hover-color);--bs-table-bg-state:var(--bs-table-hover-bg)}.table-primary{--bs-table-color:#000;--bs-table-bg:#cfe2ff;--bs-table-border-color:#a6b5cc;--bs-table-striped-bg:#c5d7f2;--bs-table-striped-color:#000;--bs-table-active-bg:#bacbe6;--bs-table-active-color:#000;--bs-table-hover-bg:#bfd1ec;--bs-table-hover-color:#000;color:var(--bs-table-color);border-color:var(--bs-table-border-color)}.table-secondary{--bs-table-color:#000;--bs-table-bg:#e2e3e5;--bs-table-border-color:#b5b6b7;--bs-table-striped-bg:#d7d8da;--bs-table-striped-color:#000;--bs-table-active-bg:#cbccce;--bs-table-active-color:#000;--bs-table-hover-bg:#d1d2d4;--bs-table-hover-color:#000;color:var(--bs-table-color);border-color:var(--bs-table-border-color)}.table-success{--bs-table-color:#000;--bs-table-bg:#d1e7dd;--bs-table-border-color:#a7b9b1;--bs-table-striped-bg:#c7dbd2;--bs-table-striped-color:#000;--bs-table-active-bg:#bcd0c7;--bs-table-active-color:#000;--bs-table-hover-bg:#c1d6cc;--bs-table-hover-color:#000;color:var(--bs-table-color);border-color:var(--bs-table-border-color)}.table-info{--bs-table-color:#000;--bs-table-bg:#cff4fc;--bs-table-border-color:#a6c3ca;--bs-table-striped-bg:#c5e8ef;--bs-table-striped-color:#000;--bs-table-active-bg:#badce3;--bs-table-active-color:#000;--bs-table-hover-bg:#bfe2e9;--bs-table-hover-color:#000;color:var(--bs-table-color);border-color:var(--bs-table-border-color)}.table-warning{--bs-table-color:#000;--bs-table-bg:#fff3cd;--bs-table-border-color:#ccc2a4;--bs-table-striped-bg:#f2e7c3;--bs-table-striped-color:#000;--bs-table-active-bg:#e6dbb9;--bs-table-active-color:#000;--bs-table-hover-bg:#ece1be;--bs-table-hover-color:#000;color:var(--bs-table-color);border-color:var(--bs-table-border-color)}.table-danger{--bs-table-color:#000;--bs-table-bg:#f8d7da;--bs-table-border-color:#c6acae;--bs-table-striped-bg:#eccccf;--bs-table-striped-color:#000;--bs-table-active-bg:#dfc2c4;--bs-table-active-color:#000;--bs-table-hover-bg:#e5c7ca;--bs-table-hover-color:#000;color:var(--bs-table-color);border-color:var(--bs-table-border-color)}.table-light{--bs-table-color:#000;--bs-table-bg:#f8f9fa;--bs-table-border-color:#c6c7c8;--bs-table-striped-bg:#ecedee;--bs-table-striped-color:#000;--bs-table-active-bg:#dfe0e1;--bs-table-active-color:#000;--bs-table-hover-bg:#e5e6e7;--bs-table-hover-color:#000;color:var(--bs-table-color);border-color:var(--bs-table-border-color)}.table-dark{--bs-table-color:#fff;--bs-table-bg:#212529;--bs-table-border-color:#4d5154;--bs-table-striped-bg:#2c3034;--bs-table-striped-color:#fff;--bs-table-active-bg:#373b3e;--bs-table-active-color:#fff;--bs-table-hover-bg:#323539;--bs-table-hover-color:#fff;color:var(--bs-table-color);border-color:var(--bs-table-border-color)}.table-responsive{overflow-x:auto;-webkit-overflow-scrolling:touch}@media (max-width:575.98px){.table-responsive-sm{overflow-x:auto;-webkit-overflow-scrolling:touch}}@media (max-width:767.98px){.table-responsive-md{overflow-x:auto;-webkit-overflow-scrolling:touch}}@media (max-width:991.98px){.table-responsive-lg{overflow-x:auto;-webkit-overflow-scrolling:touch}}@media (max-width:1199.98px){.table-responsive-xl{overflow-x:auto;-webkit-overflow-scrolling:touch}}@media (max-width:1399.98px){.table-responsive-xxl{overflow-x:auto;-webkit-overflow-scrolling:touch}}.form-label{margin-bottom:.5rem}.col-form-label{padding-top:calc(.375rem + var(--bs-border-width));padding-bottom:calc(.375rem + var(--bs-border-width));margin-bottom:0;font-size:inherit;line-height:1.5}.col-form-label-lg{padding-top:calc(.5rem + var(--bs-border-width));padding-bottom:calc(.5rem + var(--bs-border-width));font-size:1.25rem}.col-form-label-sm{padding-top:calc(.25rem + var(--bs-border-width));padding-bottom:calc(.25rem + var(--bs-border-width));font-size:.875rem}.form-text{margin-top:.25rem;font-size:.875em;color:var(--bs-secondary-color)}.form-control{display:block;width:100%;padding:.375rem .75rem;font-size:1rem;font-weight:400;line-height:1.5;color:var(--bs-body-color);-webkit-appearance:none;-moz-appearance:none;appearance:none;background-color:var(--bs-body-bg);background-clip:padding-box;border:var(--bs-border-width) solid var(--bs-border-color);border-radius:var(--bs-border-radius);transition:border-color .15s ease-in-out,box-shadow .15s ease-in-out}@media (prefers-reduced-motion:reduce){.form-control{transition:none}}.form-control[type=file]{overflow:hidden}.form-control[type=file]:not(:disabled):not([readonly]){cursor:pointer}.form-control:focus{color:var(--bs-body-color);background-color:var(--bs-body-bg);border-color:#86b7fe;outline:0;box-shadow:0 0 0 .25rem rgba(13,110,253,.25)}.form-control::-webkit-date-and-time-value{min-width:85px;height:1.5em;margin:0}.form-control::-webkit-datetime-edit{display:block;padding:0}.form-control::-moz-placeholder{color:var(--bs-secondary-color);opacity:1}.form-control::placeholder{color:var(--bs-secondary-color);opacity:1}.form-control:disabled{background-color:var(--bs-secondary-bg);opacity:1}.form-control::-webkit-file-upload-button{padding:.375rem .75rem;margin:-.375rem -.75rem;-webkit-margin-end:.75rem;margin-inline-end:.75rem;color:var(--bs-body-color);background-color:var(--bs-tertiary-bg);pointer-events:none;border-color:inherit;border-style:solid;border-width:0;border-inline-end-width:var(--bs-border-width);border-radius:0;-webkit-transition:color .15s ease-in-out,background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out;transition:color .15s ease-in-out,background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out}.form-control::file-selector-button{padding:.375rem .75rem;margin:-.375rem -.75rem;-webkit-margin-end:.75rem;margin-inline-end:.75rem;color:var(--bs-body-color);background-color:var(--bs-tertiary-bg);pointer-events:none;border-color:inherit;border-style:solid;border-width:0;border-inline-end-width:var(--bs-border-width);border-radius:0;transition:color .15s ease-in-out,background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out}@media (prefers-reduced-motion:reduce){.form-control::-webkit-file-upload-button{-webkit-transition:none;transition:none}.form-control::file-selector-button{transition:none}}.form-control:hover:not(:disabled):not([readonly])::-webkit-file-upload-button{background-color:var(--bs-secondary-bg)}.form-control:hover:not(:disabled):not([readonly])::file-selector-button{background-color:var(--bs-secondary-bg)}.form-control-plaintext{display:block;width:100%;padding:.375rem 0;margin-bottom:0;line-height:1.5;color:var(--bs-body-color);background-color:transparent;border:solid transparent;border-width:var(--bs-border-width) 0}.form-control-plaintext:focus{outline:0}.form-control-plaintext.form-control-lg,.form-control-plaintext.form-control-sm{padding-right:0;padding-left:0}.form-control-sm{min-height:calc(1.5em + .5rem + calc(var(--bs-border-width) * 2));padding:.25rem .5rem;font-size:.875rem;border-radius:var(--bs-border-radius-sm)}.form-control-sm::-webkit-file-upload-button{padding:.25rem .5rem;margin:-.25rem -.5rem;-webkit-margin-end:.5rem;margin-inline-end:.5rem}.form-control-sm::file-selector-button{padding:.25rem .5rem;margin:-.25rem -.5rem;-webkit-margin-end:.5rem;margin-inline-end:.5rem}.form-control-lg{min-height:calc(1.5em + 1rem + calc(var(--bs-border-width) * 2));padding:.5rem 1rem;font-size:1.25rem;border-radius:var(--bs-border-radius-lg)}.form-control-lg::-webkit-file-upload-button{padding:.5rem 1rem;margin:-.5rem -1rem;-webkit-margin-end:1rem;margin-inline-end:1rem}.form-control-lg::file-selector-button{padding:.5rem 1rem;margin:-.5rem -1rem;-webkit-margin-end:1rem;margin-inline-end:1rem}textarea.form-control{min-height:calc(1.5em + .75rem + calc(var(--bs-border-width) * 2))}textarea.form-control-sm{min-height:calc(1.5em + .5rem + calc(var(--bs-border-width) * 2))}textarea.form-control-lg{min-height:calc(1.5em + 1rem + calc(var(--bs-border-width) * 2))}.form-control-color{width:3rem;height:calc(1.5em + .75rem + calc(var(--bs-border-width) * 2));padding:.375rem}.form-control-color:not(:disabled):not([readonly]){cursor:pointer}.form-control-color::-moz-color-swatch{border:0!important;border-radius:var(--bs-border-radius)}.form-control-color::-webkit-color-swatch{border:0!important;border-radius:var(--bs-border-radius)}.form-control-color.form-control-sm{height:calc(1.5em + .5rem + calc(var(--bs-border-width) * 2))}.form-control-color.form-control-lg{height:calc(1.5em + 1rem + calc(var(--bs-border-width) * 2))}.form-select{--bs-form-select-bg-img:url(${C});display:block;width:100%;padding:.375rem 2.25rem .375rem .75rem;font-size:1rem;font-weight:400;line-height:1.5;color:var(--bs-body-color);-webkit-appearance:none;-moz-appearance:none;appearance:none;background-color:var(--bs-body-bg);background-image:var(--bs-form-select-bg-img),var(--bs-form-select-bg-icon,none);background-repeat:no-repeat;background-position:right .75rem center;background-size:16px 12px;border:var(--bs-border-width) solid var(--bs-border-color);border-radius:var(--bs-border-radius);transition:border-color .15s ease-in-out,box-shadow .15s ease-in-out}@media (prefers-reduced-motion:reduce){.form-select{transition:none}}.form-select:focus{border-color:#86b7fe;outline:0;box-shadow:0 0 0 .25rem rgba(13,110,253,.25)}.form-select[multiple],.form-select[size]:not([size="1"]){padding-right:.75rem;background-image:none}.form-select:disabled{background-color:var(--bs-secondary-bg)}.form-select:-moz-focusring{color:transparent;text-shadow:0 0 0 var(--bs-body-color)}.form-select-sm{padding-top:.25rem;padding-bottom:.25rem;padding-left:.5rem;font-size:.875rem;border-radius:var(--bs-border-radius-sm)}.form-select-lg{padding-top:.5rem;padding-bottom:.5rem;padding-left:1rem;font-size:1.25rem;border-radius:var(--bs-border-radius-lg)}[data-bs-theme=dark] .form-select{--bs-form-select-bg-img:url(${j})}.form-check{display:block;min-height:1.5rem;padding-left:1.5em;margin-bottom:.125rem}.form-check .form-check-input{float:left;margin-left:-1.5em}.form-check-reverse{padding-right:1.5em;padding-left:0;text-align:right}.form-check-reverse .form-check-input{float:right;margin-right:-1.5em;margin-left:0}.form-check-input{--bs-form-check-bg:var(--bs-body-bg);flex-shrink:0;width:1em;height:1em;margin-top:.25em;vertical-align:top;-webkit-appearance:none;-moz-appearance:none;appearance:none;background-color:var(--bs-form-check-bg);background-image:var(--bs-form-check-bg-image);background-repeat:no-repeat;background-position:center;background-size:contain;border:var(--bs-border-width) solid var(--bs-border-color);-webkit-print-color-adjust:exact;color-adjust:exact;print-color-adjust:exact}.form-check-input[type=checkbox]{border-radius:.25em}.form-check-input[type=radio]{border-radius:50%}.form-check-input:active{filter:brightness(90%)}.form-check-input:focus{border-color:#86b7fe;outline:0;box-shadow:0 0 0 .25rem rgba(13,110,253,.25)}.form-check-input:checked{background-color:#0d6efd;border-color:#0d6efd}.form-check-input:checked[type=checkbox]{--bs-form-check-bg-image:url(${z})}.form-check-input:checked[type=radio]{--bs-form-check-bg-image:url(${L})}.form-check-input[type=checkbox]:indeterminate{background-color:#0d6efd;border-color:#0d6efd;--bs-form-check-bg-image:url(${R})}.form-check-input:disabled{pointer-events:none;filter:none;opacity:.5}.form-check-input:disabled~.form-check-label,.form-check-input[disabled]~.form-check-label{cursor:default;opacity:.5}.form-switch{padding-left:2.5em}.form-switch .form-check-input{--bs-form-switch-bg:url(${P});width:2em;margin-left:-2.5em;background-image:var(--bs-form-switch-bg);background-position:left center;border-radius:2em;transition:background-position .15s ease-in-out}@media (prefers-reduced-motion:reduce){.form-switch .form-check-input{transition:none}}.form-switch .form-check-input:focus{--bs-form-switch-bg:url(${D})}.form-switch .form-check-input:checked{background-position:right center;--bs-form-switch-bg:url(${M})}.form-switch.form-check-reverse{padding-right:2.5em;padding-left:0}.form-switch.form-check-reverse .form-check-input{margin-right:-2.5em;margin-left:0}.form-check-inline{display:inline-block;margin-right:1rem}.btn-check{position:absolute;clip:rect(0,0,0,0);pointer-events:none}.btn-check:disabled+.btn,.btn-check[disabled]+.btn{pointer-events:none;filter:none;opacity:.65}[data-bs-theme=dark] .form-switch .form-check-input:not(:checked):not(:focus){--bs-form-switch-bg:url(${N})}.form-range{width:100%;height:1.5rem;padding:0;-webkit-appearance:none;-moz-appearance:none;appearance:none;background-color:transparent}.form-range:focus{outline:0}.form-range:focus::-webkit-slider-thumb{box-shadow:0 0 0 1px #fff,0 0 0 .25rem rgba(13,110,253,.25)}.form-range:focus::-moz-range-thumb{box-shadow:0 0 0 1px #fff,0 0 0 .25rem rgba(13,110,253,.25)}.form-range::-moz-focus-outer{border:0}.form-range::-webkit-slider-thumb{width:1rem;height:1rem;margin-top:-.25rem;-webkit-appearance:none;appearance:none;background-color:#0d6efd;border:0;border-radius:1rem;-webkit-transition:background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out;transition:background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out}@media (prefers-reduced-motion:reduce){.form-range::-webkit-slider-thumb{-webkit-transition:none;transition:none}}.form-range::-webkit-slider-thumb:active{background-color:#b6d4fe}.form-range::-webkit-slider-runnable-track{width:100%;height:.5rem;color:transparent;cursor:pointer;background-color:var(--bs-secondary-bg);border-color:transparent;border-radius:1rem}.form-range::-moz-range-thumb{width:1rem;height:1rem;-moz-appearance:none;appearance:none;background-color:#0d6efd;border:0;border-radius:1rem;-moz-transition:background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out;transition:background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out}@media (prefers-reduced-motion:reduce){.form-range::-moz-range-thumb{-moz-transition:none;transition:none}}.form-range::-moz-range-thumb:active{background-color:#b6d4fe}.form-range::-moz-range-track{width:100%;height:.5rem;color:transparent;cursor:pointer;background-color:var(--bs-secondary-bg);border-color:transparent;border-radius:1rem}.form-range:disabled{pointer-events:none}.form-range:disabled::-webkit-slider-thumb{background-color:var(--bs-secondary-color)}.form-range:disabled::-moz-range-thumb{background-color:var(--bs-secondary-color)}.form-floating{position:relative}.form-floating>.form-control,.form-floating>.form-control-plaintext,.form-floating>.form-select{height:calc(3.5rem + calc(var(--bs-border-width) * 2));min-height:calc(3.5rem + calc(var(--bs-border-width) * 2));line-height:1.25}.form-floating>label{position:absolute;top:0;left:0;z-index:2;height:100%;padding:1rem .75rem;overflow:hidden;text-align:start;text-overflow:ellipsis;white-space:nowrap;pointer-events:none;border:var(--bs-border-width) solid transparent;transform-origin:0 0;transition:opacity .1s ease-in-out,transform .1s ease-in-out}@media (prefers-reduced-motion:reduce){.form-floating>label{transition:none}}.form-floating>.form-control,.form-floating>.form-control-plaintext{padding:1rem .75rem}.form-floating>.form-control-plaintext::-moz-placeholder,.form-floating>.form-control::-moz-placeholder{color:transparent}.form-floating>.form-control-plaintext::placeholder,.form-floating>.form-control::placeholder{color:transparent}.form-floating>.form-control-plaintext:not(:-moz-placeholder-shown),.form-floating>.form-control:not(:-moz-placeholder-shown){padding-top:1.625rem;padding-bottom:.625rem}.form-floating>.form-control-plaintext:focus,.form-floating>.form-control-plaintext:not(:placeholder-shown),.form-floating>.form-control:focus,.form-floating>.form-control:not(:placeholder-shown){padding-top:1.625rem;padding-bottom:.625rem}.form-floating>.form-control-plaintext:-webkit-autofill,.form-floating>.form-control:-webkit-autofill{padding-top:1.625rem;padding-bottom:.625rem}.form-floating>.form-select{padding-top:1.625rem;padding-bottom:.625rem}.form-floating>.form-control:not(:-moz-placeholder-shown)~label{color:rgba(var(--bs-body-color-rgb),.65);transform:scale(.85) translateY(-.5rem) translateX(.15rem)}.form-floating>.form-control-plaintext~label,.form-floating>.form-control:focus~label,.form-floating>.form-control:not(:placeholder-shown)~label,.form-floating>.form-select~label{color:rgba(var(--bs-body-color-rgb),.65);transform:scale(.85) translateY(-.5rem) translateX(.15rem)}.form-floating>.form-control:not(:-moz-placeholder-shown)~label::after{position:absolute;inset:1rem 0.375rem;z-index:-1;height:1.5em;content:"";background-color:var(--bs-body-bg);border-radius:var(--bs-border-radius)}.form-floating>.form-control-plaintext~label::after,.form-floating>.form-control:focus~label::after,.form-floating>.form-control:not(:placeholder-shown)~label::after,.form-floating>.form-select~label::after{position:absolute;inset:1rem 0.375rem;z-index:-1;height:1.5em;content:"";background-color:var(--bs-body-bg);border-radius:var(--bs-border-radius)}.form-floating>.form-control:-webkit-autofill~label{color:rgba(var(--bs-body-color-rgb),.65);transform:scale(.85) translateY(-.5rem) translateX(.15rem)}.form-floating>.form-control-plaintext~label{border-width:var(--bs-border-width) 0}.form-floating>.form-control:disabled~label,.form-floating>:disabled~label{color:#6c757d}.form-floating>.form-control:disabled~label::after,.form-floating>:disabled~label::after{background-color:var(--bs-secondary-bg)}.input-group{position:relative;display:flex;flex-wrap:wrap;align-items:stretch;width:100%}.input-group>.form-control,.input-group>.form-floating,.input-group>.form-select{position:relative;flex:1 1 auto;width:1%;min-width:0}.input-group>.form-control:focus,.input-group>.form-floating:focus-within,.input-group>.form-select:focus{z-index:5}.input-group .btn{position:relative;z-index:2}.input-group .btn:focus{z-index:5}.input-group-text{display:flex;align-items:center;padding:.375rem .75rem;font-size:1rem;font-weight:400;line-height:1.5;color:var(--bs-body-color);text-align:center;white-space:nowrap;background-color:var(--bs-tertiary-bg);border:var(--bs-border-width) solid var(--bs-border-color);border-radius:var(--bs-border-radius)}.input-group-lg>.btn,.input-group-lg>.form-control,.input-group-lg>.form-select,.input-group-lg>.input-group-text{padding:.5rem 1rem;font-size:1.25rem;border-radius:var(--bs-border-radius-lg)}.input-group-sm>.btn,.input-group-sm>.form-control,.input-group-sm>.form-select,.input-group-sm>.input-group-text{padding:.25rem .5rem;font-size:.875rem;border-radius:var(--bs-border-radius-sm)}.input-group-lg>.form-select,.input-group-sm>.form-select{padding-right:3rem}.input-group:not(.has-validation)>.dropdown-toggle:nth-last-child(n+3),.input-group:not(.has-validation)>.form-floating:not(:last-child)>.form-control,.input-group:not(.has-validation)>.form-floating:not(:last-child)>.form-select,.input-group:not(.has-validation)>:not(:last-child):not(.dropdown-toggle):not(.dropdown-menu):not(.form-floating){border-top-right-radius:0;border-bottom-right-radius:0}.input-group.has-validation>.dropdown-toggle:nth-last-child(n+4),.input-group.has-validation>.form-floating:nth-last-child(n+3)>.form-control,.input-group.has-validation>.form-floating:nth-last-child(n+3)>.form-select,.input-group.has-validation>:nth-last-child(n+3):not(.dropdown-toggle):not(.dropdown-menu):not(.form-floating){border-top-right-radius:0;border-bottom-right-radius:0}.input-group>:not(:first-child):not(.dropdown-menu):not(.valid-tooltip):not(.valid-feedback):not(.invalid-tooltip):not(.invalid-feedback){margin-left:calc(var(--bs-border-width) * -1);border-top-left-radius:0;border-bottom-left-radius:0}.input-group>.form-floating:not(:first-child)>.form-control,.input-group>.form-floating:not(:first-child)>.form-select{border-top-left-radius:0;border-bottom-left-radius:0}.valid-feedback{display:none;width:100%;margin-top:.25rem;font-size:.875em;color:var(--bs-form-valid-color)}.valid-tooltip{position:absolute;top:100%;z-index:5;display:none;max-width:100%;padding:.25rem .5rem;margin-top:.1rem;font-size:.875rem;color:#fff;background-color:var(--bs-success);border-radius:var(--bs-border-radius)}.is-valid~.valid-feedback,.is-valid~.valid-tooltip,.was-validated :valid~.valid-feedback,.was-validated :valid~.valid-tooltip{display:block}.form-control.is-valid,.was-validated .form-control:valid{border-color:var(--bs-form-valid-border-color);padding-right:calc(1.5em + .75rem);background-image:url(${I});background-repeat:no-repeat;background-position:right calc(.375em + .1875rem) center;background-size:calc(.75em + .375rem) calc(.75em + .375rem)}.form-control.is-valid:focus,.was-validated .form-control:valid:focus{border-color:var(--bs-form-valid-border-color);box-shadow:0 0 0 .25rem rgba(var(--bs-success-rgb),.25)}.was-validated textarea.form-control:valid,textarea.form-control.is-valid{padding-right:calc(1.5em + .75rem);background-position:top calc(.375em + .1875rem) right calc(.375em + .1875rem)}.form-select.is-valid,.was-validated .form-select:valid{border-color:var(--bs-form-valid-border-color)}.form-select.is-valid:not([multiple]):not([size]),.form-select.is-valid:not([multiple])[size="1"],.was-validated .form-select:valid:not([multiple]):not([size]),.was-validated .form-select:valid:not([multiple])[size="1"]{--bs-form-select-bg-icon:url(${I});padding-right:4.125rem;background-position:right .75rem center,center right 2.25rem;background-size:16px 12px,calc(.75em + .375rem) calc(.75em + .375rem)}.form-select.is-valid:focus,.was-validated .form-select:valid:focus{border-color:var(--bs-form-valid-border-color);box-shadow:0 0 0 .25rem rgba(var(--bs-success-rgb),.25)}.form-control-color.is-valid,.was-validated .form-control-color:valid{width:calc(3rem + calc(1.5em + .75rem))}.form-check-input.is-valid,.was-validated .form-check-input:valid{border-color:var(--bs-form-valid-border-color)}.form-check-input.is-valid:checked,.was-validated .form-check-input:valid:checked{background-color:var(--bs-form-valid-color)}.form-check-input.is-valid:focus,.was-validated .form-check-input:valid:focus{box-shadow:0 0 0 .25rem rgba(var(--bs-success-rgb),.25)}.form-check-input.is-valid~.form-check-label,.was-validated .form-check-input:valid~.form-check-label{color:var(--bs-form-valid-color)}.form-check-inline .form-check-input~.valid-feedback{margin-left:.5em}.input-group>.form-control:not(:focus).is-valid,.input-group>.form-floating:not(:focus-within).is-valid,.input-group>.form-select:not(:focus).is-valid,.was-validated .input-group>.form-control:not(:focus):valid,.was-validated .input-group>.form-floating:not(:focus-within):valid,.was-validated .input-group>.form-select:not(:focus):valid{z-index:3}.invalid-feedback{display:none;width:100%;margin-top:.25rem;font-size:.875em;color:var(--bs-form-invalid-color)}.invalid-tooltip{position:absolute;top:100%;z-index:5;display:none;max-width:100%;padding:.25rem .5rem;margin-top:.1rem;font-size:.875rem;color:#fff;background-color:var(--bs-danger);border-radius:var(--bs-border-radius)}.is-invalid~.invalid-feedback,.is-invalid~.invalid-tooltip,.was-validated :invalid~.invalid-feedback,.was-validated :invalid~.invalid-tooltip{display:block}.form-control.is-invalid,.was-validated .form-control:invalid{border-color:var(--bs-form-invalid-border-color);padding-right:calc(1.5em + .75rem);background-image:url(${B});background-repeat:no-repeat;background-position:right calc(.375em + .1875rem) center;background-size:calc(.75em + .375rem) calc(.75em + .375rem)}.form-control.is-invalid:focus,.was-validated .form-control:invalid:focus{border-color:var(--bs-form-invalid-border-color);box-shadow:0 0 0 .25rem rgba(var(--bs-danger-rgb),.25)}.was-validated textarea.form-control:invalid,textarea.form-control.is-invalid{padding-right:calc(1.5em + .75rem);background-position:top calc(.375em + .1875rem) right calc(.375em + .1875rem)}.form-select.is-invalid,.was-validated .form-select:invalid{border-color:var(--bs-form-invalid-border-color)}.form-select.is-invalid:not([multiple]):not([size]),.form-select.is-invalid:not([multiple])[size="1"],.was-validated .form-select:invalid:not([multiple]):not([size]),.was-validated .form-select:invalid:not([multiple])[size="1"]{--bs-form-select-bg-icon:url(${B});padding-right:4.125rem;background-position:right .75rem center,center right 2.25rem;background-size:16px 12px,calc(.75em + .375rem) calc(.75em + .375rem)}.form-select.is-invalid:focus,.was-validated .form-select:invalid:focus{border-color:var(--bs-form-invalid-border-color);box-shadow:0 0 0 .25rem rgba(var(--bs-danger-rgb),.25)}.form-control-color.is-invalid,.was-validated .form-control-color:invalid{width:calc(3rem + calc(1.5em + .75rem))}.form-check-input.is-invalid,.was-validated .form-check-input:invalid{border-color:var(--bs-form-invalid-border-color)}.form-check-input.is-invalid:checked,.was-validated .form-check-input:invalid:checked{background-color:var(--bs-form-invalid-color)}.form-check-input.is-invalid:focus,.was-validated .form-check-input:invalid:focus{box-shadow:0 0 0 .25rem rgba(var(--bs-danger-rgb),.25)}.form-check-input.is-invalid~.form-check-label,.was-validated .form-check-input:invalid~.form-check-label{color:var(--bs-form-invalid-color)}.form-check-inline .form-check-input~.invalid-feedback{margin-left:.5em}.input-group>.form-control:not(:focus).is-invalid,.input-group>.form-floating:not(:focus-within).is-invalid,.input-group>.form-select:not(:focus).is-invalid,.was-validated .input-group>.form-control:not(:focus):invalid,.was-validated .input-group>.form-floating:not(:focus-within):invalid,.was-validated .input-group>.form-select:not(:focus):invalid{z-index:4}.btn{--bs-btn-padding-x:0.75rem;--bs-btn-padding-y:0.375rem;--bs-btn-font-family: ;--bs-btn-font-size:1rem;--bs-btn-font-weight:400;--bs-btn-line-height:1.5;--bs-btn-color:var(--bs-body-color);--bs-btn-bg:transparent;--bs-btn-border-width:var(--bs-border-width);--bs-btn-border-color:transparent;--bs-btn-border-radius:var(--bs-border-radius);--bs-btn-hover-border-color:transparent;--bs-btn-box-shadow:inset 0 1px 0 rgba(255, 255, 255, 0.15),0 1px 1px rgba(0, 0, 0, 0.075);--bs-btn-disabled-opacity:0.65;--bs-btn-focus-box-shadow:0 0 0 0.25rem rgba(var(--bs-btn-focus-shadow-rgb), .5);display:inline-block;padding:var(--bs-btn-padding-y) var(--bs-btn-padding-x);font-family:var(--bs-btn-font-family);font-size:var(--bs-btn-font-size);font-weight:var(--bs-btn-font-weight);line-height:var(--bs-btn-line-height);color:var(--bs-btn-color);text-align:center;text-decoration:none;vertical-align:middle;cursor:pointer;-webkit-user-select:none;-moz-user-select:none;user-select:none;border:var(--bs-btn-border-width) solid var(--bs-btn-border-color);border-radius:var(--bs-btn-border-radius);background-color:var(--bs-btn-bg);transition:color .15s ease-in-out,background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out}@media (prefers-reduced-motion:reduce){.btn{transition:none}}.btn:hover{color:var(--bs-btn-hover-color);background-color:var(--bs-btn-hover-bg);border-color:var(--bs-btn-hover-border-color)}.btn-check+.btn:hover{color:var(--bs-btn-color);background-color:var(--bs-btn-bg);border-color:var(--bs-btn-border-color)}.btn:focus-visible{color:var(--bs-btn-hover-color);background-color:var(--bs-btn-hover-bg);border-color:var(--bs-btn-hover-border-color);outline:0;box-shadow:var(--bs-btn-focus-box-shadow)}.btn-check:focus-visible+.btn{border-color:var(--bs-btn-hover-border-color);outline:0;box-shadow:var(--bs-btn-focus-box-shadow)}.btn-check:checked+.btn,.btn.active,.btn.show,.btn:first-child:active,:not(.btn-check)+.btn:active{color:var(--bs-btn-active-color);background-color:var(--bs-btn-active-bg);border-color:var(--bs-btn-active-border-color)}.btn-check:checked+.btn:focus-visible,.btn.active:focus-visible,.btn.show:focus-visible,.btn:first-child:active:focus-visible,:not(.btn-check)+.btn:active:focus-visible{box-shadow:var(--bs-btn-focus-box-shadow)}.btn-check:checked:focus-visible+.btn{box-shadow:var(--bs-btn-focus-box-shadow)}.btn.disabled,.btn:disabled,fieldset:disabled .btn{color:var(--bs-btn-disabled-color);pointer-events:none;background-color:var(--bs-btn-disabled-bg);border-color:var(--bs-btn-disabled-border-color);opacity:var(--bs-btn-disabled-opacity)}.btn-primary{--bs-btn-color:#fff;--bs-btn-bg:#0d6efd;--bs-btn-border-color:#0d6efd;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#0b5ed7;--bs-btn-hover-border-color:#0a58ca;--bs-btn-focus-shadow-rgb:49,132,253;--bs-btn-active-color:#fff;--bs-btn-active-bg:#0a58ca;--bs-btn-active-border-color:#0a53be;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#fff;--bs-btn-disabled-bg:#0d6efd;--bs-btn-disabled-border-color:#0d6efd}.btn-secondary{--bs-btn-color:#fff;--bs-btn-bg:#6c757d;--bs-btn-border-color:#6c757d;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#5c636a;--bs-btn-hover-border-color:#565e64;--bs-btn-focus-shadow-rgb:130,138,145;--bs-btn-active-color:#fff;--bs-btn-active-bg:#565e64;--bs-btn-active-border-color:#51585e;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#fff;--bs-btn-disabled-bg:#6c757d;--bs-btn-disabled-border-color:#6c757d}.btn-success{--bs-btn-color:#fff;--bs-btn-bg:#198754;--bs-btn-border-color:#198754;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#157347;--bs-btn-hover-border-color:#146c43;--bs-btn-focus-shadow-rgb:60,153,110;--bs-btn-active-color:#fff;--bs-btn-active-bg:#146c43;--bs-btn-active-border-color:#13653f;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#fff;--bs-btn-disabled-bg:#198754;--bs-btn-disabled-border-color:#198754}.btn-info{--bs-btn-color:#000;--bs-btn-bg:#0dcaf0;--bs-btn-border-color:#0dcaf0;--bs-btn-hover-color:#000;--bs-btn-hover-bg:#31d2f2;--bs-btn-hover-border-color:#25cff2;--bs-btn-focus-shadow-rgb:11,172,204;--bs-btn-active-color:#000;--bs-btn-active-bg:#3dd5f3;--bs-btn-active-border-color:#25cff2;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#000;--bs-btn-disabled-bg:#0dcaf0;--bs-btn-disabled-border-color:#0dcaf0}.btn-warning{--bs-btn-color:#000;--bs-btn-bg:#ffc107;--bs-btn-border-color:#ffc107;--bs-btn-hover-color:#000;--bs-btn-hover-bg:#ffca2c;--bs-btn-hover-border-color:#ffc720;--bs-btn-focus-shadow-rgb:217,164,6;--bs-btn-active-color:#000;--bs-btn-active-bg:#ffcd39;--bs-btn-active-border-color:#ffc720;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#000;--bs-btn-disabled-bg:#ffc107;--bs-btn-disabled-border-color:#ffc107}.btn-danger{--bs-btn-color:#fff;--bs-btn-bg:#dc3545;--bs-btn-border-color:#dc3545;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#bb2d3b;--bs-btn-hover-border-color:#b02a37;--bs-btn-focus-shadow-rgb:225,83,97;--bs-btn-active-color:#fff;--bs-btn-active-bg:#b02a37;--bs-btn-active-border-color:#a52834;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#fff;--bs-btn-disabled-bg:#dc3545;--bs-btn-disabled-border-color:#dc3545}.btn-light{--bs-btn-color:#000;--bs-btn-bg:#f8f9fa;--bs-btn-border-color:#f8f9fa;--bs-btn-hover-color:#000;--bs-btn-hover-bg:#d3d4d5;--bs-btn-hover-border-color:#c6c7c8;--bs-btn-focus-shadow-rgb:211,212,213;--bs-btn-active-color:#000;--bs-btn-active-bg:#c6c7c8;--bs-btn-active-border-color:#babbbc;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#000;--bs-btn-disabled-bg:#f8f9fa;--bs-btn-disabled-border-color:#f8f9fa}.btn-dark{--bs-btn-color:#fff;--bs-btn-bg:#212529;--bs-btn-border-color:#212529;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#424649;--bs-btn-hover-border-color:#373b3e;--bs-btn-focus-shadow-rgb:66,70,73;--bs-btn-active-color:#fff;--bs-btn-active-bg:#4d5154;--bs-btn-active-border-color:#373b3e;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#fff;--bs-btn-disabled-bg:#212529;--bs-btn-disabled-border-color:#212529}.btn-outline-primary{--bs-btn-color:#0d6efd;--bs-btn-border-color:#0d6efd;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#0d6efd;--bs-btn-hover-border-color:#0d6efd;--bs-btn-focus-shadow-rgb:13,110,253;--bs-btn-active-color:#fff;--bs-btn-active-bg:#0d6efd;--bs-btn-active-border-color:#0d6efd;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#0d6efd;--bs-btn-disabled-bg:transparent;--bs-btn-disabled-border-color:#0d6efd;--bs-gradient:none}.btn-outline-secondary{--bs-btn-color:#6c757d;--bs-btn-border-color:#6c757d;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#6c757d;--bs-btn-hover-border-color:#6c757d;--bs-btn-focus-shadow-rgb:108,117,125;--bs-btn-active-color:#fff;--bs-btn-active-bg:#6c757d;--bs-btn-active-border-color:#6c757d;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#6c757d;--bs-btn-disabled-bg:transparent;--bs-btn-disabled-border-color:#6c757d;--bs-gradient:none}.btn-outline-success{--bs-btn-color:#198754;--bs-btn-border-color:#198754;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#198754;--bs-btn-hover-border-color:#198754;--bs-btn-focus-shadow-rgb:25,135,84;--bs-btn-active-color:#fff;--bs-btn-active-bg:#198754;--bs-btn-active-border-color:#198754;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#198754;--bs-btn-disabled-bg:transparent;--bs-btn-disabled-border-color:#198754;--bs-gradient:none}.btn-outline-info{--bs-btn-color:#0dcaf0;--bs-btn-border-color:#0dcaf0;--bs-btn-hover-color:#000;--bs-btn-hover-bg:#0dcaf0;--bs-btn-hover-border-color:#0dcaf0;--bs-btn-focus-shadow-rgb:13,202,240;--bs-btn-active-color:#000;--bs-btn-active-bg:#0dcaf0;--bs-btn-active-border-color:#0dcaf0;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#0dcaf0;--bs-btn-disabled-bg:transparent;--bs-btn-disabled-border-color:#0dcaf0;--bs-gradient:none}.btn-outline-warning{--bs-btn-color:#ffc107;--bs-btn-border-color:#ffc107;--bs-btn-hover-color:#000;--bs-btn-hover-bg:#ffc107;--bs-btn-hover-border-color:#ffc107;--bs-btn-focus-shadow-rgb:255,193,7;--bs-btn-active-color:#000;--bs-btn-active-bg:#ffc107;--bs-btn-active-border-color:#ffc107;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#ffc107;--bs-btn-disabled-bg:transparent;--bs-btn-disabled-border-color:#ffc107;--bs-gradient:none}.btn-outline-danger{--bs-btn-color:#dc3545;--bs-btn-border-color:#dc3545;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#dc3545;--bs-btn-hover-border-color:#dc3545;--bs-btn-focus-shadow-rgb:220,53,69;--bs-btn-active-color:#fff;--bs-btn-active-bg:#dc3545;--bs-btn-active-border-color:#dc3545;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#dc3545;--bs-btn-disabled-bg:transparent;--bs-btn-disabled-border-color:#dc3545;--bs-gradient:none}.btn-outline-light{--bs-btn-color:#f8f9fa;--bs-btn-border-color:#f8f9fa;--bs-btn-hover-color:#000;--bs-btn-hover-bg:#f8f9fa;--bs-btn-hover-border-color:#f8f9fa;--bs-btn-focus-shadow-rgb:248,249,250;--bs-btn-active-color:#000;--bs-btn-active-bg:#f8f9fa;--bs-btn-active-border-color:#f8f9fa;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#f8f9fa;--bs-btn-disabled-bg:transparent;--bs-btn-disabled-border-color:#f8f9fa;--bs-gradient:none}.btn-outline-dark{--bs-btn-color:#212529;--bs-btn-border-color:#212529;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#212529;--bs-btn-hover-border-color:#212529;--bs-btn-focus-shadow-rgb:33,37,41;--bs-btn-active-color:#fff;--bs-btn-active-bg:#212529;--bs-btn-active-border-color:#212529;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#212529;--bs-btn-disabled-bg:transparent;--bs-btn-disabled-border-color:#212529;--bs-gradient:none}.btn-link{--bs-btn-font-weight:400;--bs-btn-color:var(--bs-link-color);--bs-btn-bg:transparent;--bs-btn-border-color:transparent;--bs-btn-hover-color:var(--bs-link-hover-color);--bs-btn-hover-border-color:transparent;--bs-btn-active-color:var(--bs-link-hover-color);--bs-btn-active-border-color:transparent;--bs-btn-disabled-color:#6c757d;--bs-btn-disabled-border-color:transparent;--bs-btn-box-shadow:0 0 0 #000;--bs-btn-focus-shadow-rgb:49,132,253;text-decoration:underline}.btn-link:focus-visible{color:var(--bs-btn-color)}.btn-link:hover{color:var(--bs-btn-hover-color)}.btn-group-lg>.btn,.btn-lg{--bs-btn-padding-y:0.5rem;--bs-btn-padding-x:1rem;--bs-btn-font-size:1.25rem;--bs-btn-border-radius:var(--bs-border-radius-lg)}.btn-group-sm>.btn,.btn-sm{--bs-btn-padding-y:0.25rem;--bs-btn-padding-x:0.5rem;--bs-btn-font-size:0.875rem;--bs-btn-border-radius:var(--bs-border-radius-sm)}.fade{transition:opacity .15s linear}@media (prefers-reduced-motion:reduce){.fade{transition:none}}.fade:not(.show){opacity:0}.collapse:not(.show){display:none}.collapsing{height:0;overflow:hidden;transition:height .35s ease}@media (prefers-reduced-motion:reduce){.collapsing{transition:none}}.collapsing.collapse-horizontal{width:0;height:auto;transition:width .35s ease}@media (prefers-reduced-motion:reduce){.collapsing.collapse-horizontal{transition:none}}.dropdown,.dropdown-center,.dropend,.dropstart,.dropup,.dropup-center{position:relative}.dropdown-toggle{white-space:nowrap}.dropdown-toggle::after{display:inline-block;margin-left:.255em;vertical-align:.255em;content:"";border-top:.3em solid;border-right:.3em solid transparent;border-bottom:0;border-left:.3em solid transparent}.dropdown-toggle:empty::after{margin-left:0}.dropdown-menu{--bs-dropdown-zindex:1000;--bs-dropdown-min-width:10rem;--bs-dropdown-padding-x:0;--bs-dropdown-padding-y:0.5rem;--bs-dropdown-spacer:0.125rem;--bs-dropdown-font-size:1rem;--bs-dropdown-color:var(--bs-body-color);--bs-dropdown-bg:var(--bs-body-bg);--bs-dropdown-border-color:var(--bs-border-color-translucent);--bs-dropdown-border-radius:var(--bs-border-radius);--bs-dropdown-border-width:var(--bs-border-width);--bs-dropdown-inner-border-radius:calc(var(--bs-border-radius) - var(--bs-border-width));--bs-dropdown-divider-bg:var(--bs-border-color-translucent);--bs-dropdown-divider-margin-y:0.5rem;--bs-dropdown-box-shadow:var(--bs-box-shadow);--bs-dropdown-link-color:var(--bs-body-color);--bs-dropdown-link-hover-color:var(--bs-body-color);--bs-dropdown-link-hover-bg:var(--bs-tertiary-bg);--bs-dropdown-link-active-color:#fff;--bs-dropdown-link-active-bg:#0d6efd;--bs-dropdown-link-disabled-color:var(--bs-tertiary-color);--bs-dropdown-item-padding-x:1rem;--bs-dropdown-item-padding-y:0.25rem;--bs-dropdown-header-color:#6c757d;--bs-dropdown-header-padding-x:1rem;--bs-dropdown-header-padding-y:0.5rem;position:absolute;z-index:var(--bs-dropdown-zindex);display:none;min-width:var(--bs-dropdown-min-width);padding:var(--bs-dropdown-padding-y) var(--bs-dropdown-padding-x);margin:0;font-size:var(--bs-dropdown-font-size);color:var(--bs-dropdown-color);text-align:left;list-style:none;background-color:var(--bs-dropdown-bg);background-clip:padding-box;border:var(--bs-dropdown-border-width) solid var(--bs-dropdown-border-color);border-radius:var(--bs-dropdown-border-radius)}.dropdown-menu[data-bs-popper]{top:100%;left:0;margin-top:var(--bs-dropdown-spacer)}.dropdown-menu-start{--bs-position:start}.dropdown-menu-start[data-bs-popper]{right:auto;left:0}.dropdown-menu-end{--bs-position:end}.dropdown-menu-end[data-bs-popper]{right:0;left:auto}@media (min-width:576px){.dropdown-menu-sm-start{--bs-position:start}.dropdown-menu-sm-start[data-bs-popper]{right:auto;left:0}.dropdown-menu-sm-end{--bs-position:end}.dropdown-menu-sm-end[data-bs-popper]{right:0;left:auto}}@media (min-width:768px){.dropdown-menu-md-start{--bs-position:start}.dropdown-menu-md-start[data-bs-popper]{right:auto;left:0}.dropdown-menu-md-end{--bs-position:end}.dropdown-menu-md-end[data-bs-popper]{right:0;left:auto}}@media (min-width:992px){.dropdown-menu-lg-start{--bs-position:start}.dropdown-menu-lg-start[data-bs-popper]{right:auto;left:0}.dropdown-menu-lg-end{--bs-position:end}.dropdown-menu-lg-end[data-bs-popper]{right:0;left:auto}}@media (min-width:1200px){.dropdown-menu-xl-start{--bs-position:start}.dropdown-menu-xl-start[data-bs-popper]{right:auto;left:0}.dropdown-menu-xl-end{--bs-position:end}.dropdown-menu-xl-end[data-bs-popper]{right:0;left:auto}}@media (min-width:1400px){.dropdown-menu-xxl-start{--bs-position:start}.dropdown-menu-xxl-start[data-bs-popper]{right:auto;left:0}.dropdown-menu-xxl-end{--bs-position:end}.dropdown-menu-xxl-end[data-bs-popper]{right:0;left:auto}}.dropup .dropdown-menu[data-bs-popper]{top:auto;bottom:100%;margin-top:0;margin-bottom:var(--bs-dropdown-spacer)}.dropup .dropdown-toggle::after{display:inline-block;margin-left:.255em;vertical-align:.255em;content:"";border-top:0;border-right:.3em solid transparent;border-bottom:.3em solid;border-left:.3em solid transparent}.dropup .dropdown-toggle:empty::after{margin-left:0}.dropend .dropdown-menu[data-bs-popper]{top:0;right:auto;left:100%;margin-top:0;margin-left:var(--bs-dropdown-spacer)}.dropend .dropdown-toggle::after{display:inline-block;margin-left:.255em;vertical-align:.255em;content:"";border-top:.3em solid transparent;border-right:0;border-bottom:.3em solid transparent;border-left:.3em solid}.dropend .dropdown-toggle:empty::after{margin-left:0}.dropend .dropdown-toggle::after{vertical-align:0}.dropstart .dropdown-menu[data-bs-popper]{top:0;right:100%;left:auto;margin-top:0;margin-right:var(--bs-dropdown-spacer)}.dropstart .dropdown-toggle::after{display:inline-block;margin-left:.255em;vertical-align:.255em;content:""}.dropstart .dropdown-toggle::after{display:none}.dropstart .dropdown-toggle::before{display:inline-block;margin-right:.255em;vertical-align:.255em;content:"";border-top:.3em solid transparent;border-right:.3em solid;border-bottom:.3em solid transparent}.dropstart .dropdown-toggle:empty::after{margin-left:0}.dropstart .dropdown-toggle::before{vertical-align:0}.dropdown-divider{height:0;margin:var(--bs-dropdown-divider-margin-y) 0;overflow:hidden;border-top:1px solid var(--bs-dropdown-divider-bg);opacity:1}.dropdown-item{display:block;width:100%;padding:var(--bs-dropdown-item-padding-y) var(--bs-dropdown-item-padding-x);clear:both;font-weight:400;color:var(--bs-dropdown-link-color);text-align:inherit;text-decoration:none;white-space:nowrap;background-color:transparent;border:0;border-radius:var(--bs-dropdown-item-border-radius,0)}.dropdown-item:focus,.dropdown-item:hover{color:var(--bs-dropdown-link-hover-color);background-color:var(--bs-dropdown-link-hover-bg)}.dropdown-item.active,.dropdown-item:active{color:var(--bs-dropdown-link-active-color);text-decoration:none;background-color:var(--bs-dropdown-link-active-bg)}.dropdown-item.disabled,.dropdown-item:disabled{color:var(--bs-dropdown-link-disabled-color);pointer-events:none;background-color:transparent}.dropdown-menu.show{display:block}.dropdown-header{display:block;padding:var(--bs-dropdown-header-padding-y) var(--bs-dropdown-header-padding-x);margin-bottom:0;font-size:.875rem;color:var(--bs-dropdown-header-color);white-space:nowrap}.dropdown-item-text{display:block;padding:var(--bs-dropdown-item-padding-y) var(--bs-dropdown-item-padding-x);color:var(--bs-dropdown-link-color)}.dropdown-menu-dark{--bs-dropdown-color:#dee2e6;--bs-dropdown-bg:#343a40;--bs-dropdown-border-color:var(--bs-border-color-translucent);--bs-dropdown-box-shadow: ;--bs-dropdown-link-color:#dee2e6;--bs-dropdown-link-hover-color:#fff;--bs-dropdown-divider-bg:var(--bs-border-color-translucent);--bs-dropdown-link-hover-bg:rgba(255, 255, 255, 0.15);--bs-dropdown-link-active-color:#fff;--bs-dropdown-link-active-bg:#0d6efd;--bs-dropdown-link-disabled-color:#adb5bd;--bs-dropdown-header-color:#adb5bd}.btn-group,.btn-group-vertical{position:relative;display:inline-flex;vertical-align:middle}.btn-group-vertical>.btn,.btn-group>.btn{position:relative;flex:1 1 auto}.btn-group-vertical>.btn-check:checked+.btn,.btn-group-vertical>.btn-check:focus+.btn,.btn-group-vertical>.btn.active,.btn-group-vertical>.btn:active,.btn-group-vertical>.btn:focus,.btn-group-vertical>.btn:hover,.btn-group>.btn-check:checked+.btn,.btn-group>.btn-check:focus+.btn,.btn-group>.btn.active,.btn-group>.btn:active,.btn-group>.btn:focus,.btn-group>.btn:hover{z-index:1}.btn-toolbar{display:flex;flex-wrap:wrap;justify-content:flex-start}.btn-toolbar .input-group{width:auto}.btn-group{border-radius:var(--bs-border-radius)}.btn-group>.btn-group:not(:first-child),.btn-group>:not(.btn-check:first-child)+.btn{margin-left:calc(var(--bs-border-width) * -1)}.btn-group>.btn-group:not(:last-child)>.btn,.btn-group>.btn.dropdown-toggle-split:first-child,.btn-group>.btn:not(:last-child):not(.dropdown-toggle){border-top-right-radius:0;border-bottom-right-radius:0}.btn-group>.btn-group:not(:first-child)>.btn,.btn-group>.btn:nth-child(n+3),.btn-group>:not(.btn-check)+.btn{border-top-left-radius:0;border-bottom-left-radius:0}.dropdown-toggle-split{padding-right:.5625rem;padding-left:.5625rem}.dropdown-toggle-split::after,.dropend .dropdown-toggle-split::after,.dropup .dropdown-toggle-split::after{margin-left:0}.dropstart .dropdown-toggle-split::before{margin-right:0}.btn-group-sm>.btn+.dropdown-toggle-split,.btn-sm+.dropdown-toggle-split{padding-right:.375rem;padding-left:.375rem}.btn-group-lg>.btn+.dropdown-toggle-split,.btn-lg+.dropdown-toggle-split{padding-right:.75rem;padding-left:.75rem}.btn-group-vertical{flex-direction:column;align-items:flex-start;justify-content:center}.btn-group-vertical>.btn,.btn-group-vertical>.btn-group{width:100%}.btn-group-vertical>.btn-group:not(:first-child),.btn-group-vertical>.btn:not(:first-child){margin-top:calc(var(--bs-border-width) * -1)}.btn-group-vertical>.btn-group:not(:last-child)>.btn,.btn-group-vertical>.btn:not(:last-child):not(.dropdown-toggle){border-bottom-right-radius:0;border-bottom-left-radius:0}.btn-group-vertical>.btn-group:not(:first-child)>.btn,.btn-group-vertical>.btn~.btn{border-top-left-radius:0;border-top-right-radius:0}.nav{--bs-nav-link-padding-x:1rem;--bs-nav-link-padding-y:0.5rem;--bs-nav-link-font-weight: ;--bs-nav-link-color:var(--bs-link-color);--bs-nav-link-hover-color:var(--bs-link-hover-color);--bs-nav-link-disabled-color:var(--bs-secondary-color);display:flex;flex-wrap:wrap;padding-left:0;margin-bottom:0;list-style:none}.nav-link{display:block;padding:var(--bs-nav-link-padding-y) var(--bs-nav-link-padding-x);font-size:var(--bs-nav-link-font-size);font-weight:var(--bs-nav-link-font-weight);color:var(--bs-nav-link-color);text-decoration:none;background:0 0;border:0;transition:color .15s ease-in-out,background-color .15s ease-in-out,border-color .15s ease-in-out}@media (prefers-reduced-motion:reduce){.nav-link{transition:none}}.nav-link:focus,.nav-link:hover{color:var(--bs-nav-link-hover-color)}.nav-link:focus-visible{outline:0;box-shadow:0 0 0 .25rem rgba(13,110,253,.25)}.nav-link.disabled,.nav-link:disabled{color:var(--bs-nav-link-disabled-color);pointer-events:none;cursor:default}.nav-tabs{--bs-nav-tabs-border-width:var(--bs-border-width);--bs-nav-tabs-border-color:var(--bs-border-color);--bs-nav-tabs-border-radius:var(--bs-border-radius);--bs-nav-tabs-link-hover-border-color:var(--bs-secondary-bg) var(--bs-secondary-bg) var(--bs-border-color);--bs-nav-tabs-link-active-color:var(--bs-emphasis-color);--bs-nav-tabs-link-active-bg:var(--bs-body-bg);--bs-nav-tabs-link-active-border-color:var(--bs-border-color) var(--bs-border-color) var(--bs-body-bg);border-bottom:var(--bs-nav-tabs-border-width) solid var(--bs-nav-tabs-border-color)}.nav-tabs .nav-link{margin-bottom:calc(-1 * var(--bs-nav-tabs-border-width));border:var(--bs-nav-tabs-border-width) solid transparent;border-top-left-radius:var(--bs-nav-tabs-border-radius);border-top-right-radius:var(--bs-nav-tabs-border-radius)}.nav-tabs .nav-link:focus,.nav-tabs .nav-link:hover{isolation:isolate;border-color:var(--bs-nav-tabs-link-hover-border-color)}.nav-tabs .nav-item.show .nav-link,.nav-tabs .nav-link.active{color:var(--bs-nav-tabs-link-active-color);background-color:var(--bs-nav-tabs-link-active-bg);border-color:var(--bs-nav-tabs-link-active-border-color)}.nav-tabs .dropdown-menu{margin-top:calc(-1 * var(--bs-nav-tabs-border-width));border-top-left-radius:0;border-top-right-radius:0}.nav-pills{--bs-nav-pills-border-radius:var(--bs-border-radius);--bs-nav-pills-link-active-color:#fff;--bs-nav-pills-link-active-bg:#0d6efd}.nav-pills .nav-link{border-radius:var(--bs-nav-pills-border-radius)}.nav-pills .nav-link.active,.nav-pills .show>.nav-link{color:var(--bs-nav-pills-link-active-color);background-color:var(--bs-nav-pills-link-active-bg)}.nav-underline{--bs-nav-underline-gap:1rem;--bs-nav-underline-border-width:0.125rem;--bs-nav-underline-link-active-color:var(--bs-emphasis-color);gap:var(--bs-nav-underline-gap)}.nav-underline .nav-link{padding-right:0;padding-left:0;border-bottom:var(--bs-nav-underline-border-width) solid transparent}.nav-underline .nav-link:focus,.nav-underline .nav-link:hover{border-bottom-color:currentcolor}.nav-underline .nav-link.active,.nav-underline .show>.nav-link{font-weight:700;color:var(--bs-nav-underline-link-active-color);border-bottom-color:currentcolor}.nav-fill .nav-item,.nav-fill>.nav-link{flex:1 1 auto;text-align:center}.nav-justified .nav-item,.nav-justified>.nav-link{flex-basis:0;flex-grow:1;text-align:center}.nav-fill .nav-item .nav-link,.nav-justified .nav-item .nav-link{width:100%}.tab-content>.tab-pane{display:none}.tab-content>.active{display:block}.navbar{--bs-navbar-padding-x:0;--bs-navbar-padding-y:0.5rem;--bs-navbar-color:rgba(var(--bs-emphasis-color-rgb), 0.65);--bs-navbar-hover-color:rgba(var(--bs-emphasis-color-rgb), 0.8);--bs-navbar-disabled-color:rgba(var(--bs-emphasis-color-rgb), 0.3);--bs-navbar-active-color:rgba(var(--bs-emphasis-color-rgb), 1);--bs-navbar-brand-padding-y:0.3125rem;--bs-navbar-brand-margin-end:1rem;--bs-navbar-brand-font-size:1.25rem;--bs-navbar-brand-color:rgba(var(--bs-emphasis-color-rgb), 1);--bs-navbar-brand-hover-color:rgba(var(--bs-emphasis-color-rgb), 1);--bs-navbar-nav-link-padding-x:0.5rem;--bs-navbar-toggler-padding-y:0.25rem;--bs-navbar-toggler-padding-x:0.75rem;--bs-navbar-toggler-font-size:1.25rem;--bs-navbar-toggler-icon-bg:url(${F});--bs-navbar-toggler-border-color:rgba(var(--bs-emphasis-color-rgb), 0.15);--bs-navbar-toggler-border-radius:var(--bs-border-radius);--bs-navbar-toggler-focus-width:0.25rem;--bs-navbar-toggler-transition:box-shadow 0.15s ease-in-out;position:relative;display:flex;flex-wrap:wrap;align-items:center;justify-content:space-between;padding:var(--bs-navbar-padding-y) var(--bs-navbar-padding-x)}.navbar>.container,.navbar>.container-fluid,.navbar>.container-lg,.navbar>.container-md,.navbar>.container-sm,.navbar>.container-xl,.navbar>.container-xxl{display:flex;flex-wrap:inherit;align-items:center;justify-content:space-between}.navbar-brand{padding-top:var(--bs-navbar-brand-padding-y);padding-bottom:var(--bs-navbar-brand-padding-y);margin-right:var(--bs-navbar-brand-margin-end);font-size:var(--bs-navbar-brand-font-size);color:var(--bs-navbar-brand-color);text-decoration:none;white-space:nowrap}.navbar-brand:focus,.navbar-brand:hover{color:var(--bs-navbar-brand-hover-color)}.navbar-nav{--bs-nav-link-padding-x:0;--bs-nav-link-padding-y:0.5rem;--bs-nav-link-font-weight: ;--bs-nav-link-color:var(--bs-navbar-color);--bs-nav-link-hover-color:var(--bs-navbar-hover-color);--bs-nav-link-disabled-color:var(--bs-navbar-disabled-color);display:flex;flex-direction:column;padding-left:0;margin-bottom:0;list-style:none}.navbar-nav .nav-link.active,.navbar-nav .nav-link.show{color:var(--bs-navbar-active-color)}.navbar-nav .dropdown-menu{position:static}.navbar-text{padding-top:.5rem;padding-bottom:.5rem;color:var(--bs-navbar-color)}.navbar-text a,.navbar-text a:focus,.navbar-text a:hover{color:var(--bs-navbar-active-color)}.navbar-collapse{flex-basis:100%;flex-grow:1;align-items:center}.navbar-toggler{padding:var(--bs-navbar-toggler-padding-y) var(--bs-navbar-toggler-padding-x);font-size:var(--bs-navbar-toggler-font-size);line-height:1;color:var(--bs-navbar-color);background-color:transparent;border:var(--bs-border-width) solid var(--bs-navbar-toggler-border-color);border-radius:var(--bs-navbar-toggler-border-radius);transition:var(--bs-navbar-toggler-transition)}@media (prefers-reduced-motion:reduce){.navbar-toggler{transition:none}}.navbar-toggler:hover{text-decoration:none}.navbar-toggler:focus{text-decoration:none;outline:0;box-shadow:0 0 0 var(--bs-navbar-toggler-focus-width)}.navbar-toggler-icon{display:inline-block;width:1.5em;height:1.5em;vertical-align:middle;background-image:var(--bs-navbar-toggler-icon-bg);background-repeat:no-repeat;background-position:center;background-size:100%}.navbar-nav-scroll{max-height:var(--bs-scroll-height,75vh);overflow-y:auto}@media (min-width:576px){.navbar-expand-sm{flex-wrap:nowrap;justify-content:flex-start}.navbar-expand-sm .navbar-nav{flex-direction:row}.navbar-expand-sm .navbar-nav .dropdown-menu{position:absolute}.navbar-expand-sm .navbar-nav .nav-link{padding-right:var(--bs-navbar-nav-link-padding-x);padding-left:var(--bs-navbar-nav-link-padding-x)}.navbar-expand-sm .navbar-nav-scroll{overflow:visible}.navbar-expand-sm .navbar-collapse{display:flex!important;flex-basis:auto}.navbar-expand-sm .navbar-toggler{display:none}.navbar-expand-sm .offcanvas{position:static;z-index:auto;flex-grow:1;width:auto!important;height:auto!important;visibility:visible!important;background-color:transparent!important;border:0!important;transform:none!important;transition:none}.navbar-expand-sm .offcanvas .offcanvas-header{display:none}.navbar-expand-sm .offcanvas .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible}}@media (min-width:768px){.navbar-expand-md{flex-wrap:nowrap;justify-content:flex-start}.navbar-expand-md .navbar-nav{flex-direction:row}.navbar-expand-md .navbar-nav .dropdown-menu{position:absolute}.navbar-expand-md .navbar-nav .nav-link{padding-right:var(--bs-navbar-nav-link-padding-x);padding-left:var(--bs-navbar-nav-link-padding-x)}.navbar-expand-md .navbar-nav-scroll{overflow:visible}.navbar-expand-md .navbar-collapse{display:flex!important;flex-basis:auto}.navbar-expand-md .navbar-toggler{display:none}.navbar-expand-md .offcanvas{position:static;z-index:auto;flex-grow:1;width:auto!important;height:auto!important;visibility:visible!important;background-color:transparent!important;border:0!important;transform:none!important;transition:none}.navbar-expand-md .offcanvas .offcanvas-header{display:none}.navbar-expand-md .offcanvas .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible}}@media (min-width:992px){.navbar-expand-lg{flex-wrap:nowrap;justify-content:flex-start}.navbar-expand-lg .navbar-nav{flex-direction:row}.navbar-expand-lg .navbar-nav .dropdown-menu{position:absolute}.navbar-expand-lg .navbar-nav .nav-link{padding-right:var(--bs-navbar-nav-link-padding-x);padding-left:var(--bs-navbar-nav-link-padding-x)}.navbar-expand-lg .navbar-nav-scroll{overflow:visible}.navbar-expand-lg .navbar-collapse{display:flex!important;flex-basis:auto}.navbar-expand-lg .navbar-toggler{display:none}.navbar-expand-lg .offcanvas{position:static;z-index:auto;flex-grow:1;width:auto!important;height:auto!important;visibility:visible!important;background-color:transparent!important;border:0!important;transform:none!important;transition:none}.navbar-expand-lg .offcanvas .offcanvas-header{display:none}.navbar-expand-lg .offcanvas .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible}}@media (min-width:1200px){.navbar-expand-xl{flex-wrap:nowrap;justify-content:flex-start}.navbar-expand-xl .navbar-nav{flex-direction:row}.navbar-expand-xl .navbar-nav .dropdown-menu{position:absolute}.navbar-expand-xl .navbar-nav .nav-link{padding-right:var(--bs-navbar-nav-link-padding-x);padding-left:var(--bs-navbar-nav-link-padding-x)}.navbar-expand-xl .navbar-nav-scroll{overflow:visible}.navbar-expand-xl .navbar-collapse{display:flex!important;flex-basis:auto}.navbar-expand-xl .navbar-toggler{display:none}.navbar-expand-xl .offcanvas{position:static;z-index:auto;flex-grow:1;width:auto!important;height:auto!important;visibility:visible!important;background-color:transparent!important;border:0!important;transform:none!important;transition:none}.navbar-expand-xl .offcanvas .offcanvas-header{display:none}.navbar-expand-xl .offcanvas .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible}}@media (min-width:1400px){.navbar-expand-xxl{flex-wrap:nowrap;justify-content:flex-start}.navbar-expand-xxl .navbar-nav{flex-direction:row}.navbar-expand-xxl .navbar-nav .dropdown-menu{position:absolute}.navbar-expand-xxl .navbar-nav .nav-link{padding-right:var(--bs-navbar-nav-link-padding-x);padding-left:var(--bs-navbar-nav-link-padding-x)}.navbar-expand-xxl .navbar-nav-scroll{overflow:visible}.navbar-expand-xxl .navbar-collapse{display:flex!important;flex-basis:auto}.navbar-expand-xxl .navbar-toggler{display:none}.navbar-expand-xxl .offcanvas{position:static;z-index:auto;flex-grow:1;width:auto!important;height:auto!important;visibility:visible!important;background-color:transparent!important;border:0!important;transform:none!important;transition:none}.navbar-expand-xxl .offcanvas .offcanvas-header{display:none}.navbar-expand-xxl .offcanvas .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible}}.navbar-expand{flex-wrap:nowrap;justify-content:flex-start}.navbar-expand .navbar-nav{flex-direction:row}.navbar-expand .navbar-nav .dropdown-menu{position:absolute}.navbar-expand .navbar-nav .nav-link{padding-right:var(--bs-navbar-nav-link-padding-x);padding-left:var(--bs-navbar-nav-link-padding-x)}.navbar-expand .navbar-nav-scroll{overflow:visible}.navbar-expand .navbar-collapse{display:flex!important;flex-basis:auto}.navbar-expand .navbar-toggler{display:none}.navbar-expand .offcanvas{position:static;z-index:auto;flex-grow:1;width:auto!important;height:auto!important;visibility:visible!important;background-color:transparent!important;border:0!important;transform:none!important;transition:none}.navbar-expand .offcanvas .offcanvas-header{display:none}.navbar-expand .offcanvas .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible}.navbar-dark,.navbar[data-bs-theme=dark]{--bs-navbar-color:rgba(255, 255, 255, 0.55);--bs-navbar-hover-color:rgba(255, 255, 255, 0.75);--bs-navbar-disabled-color:rgba(255, 255, 255, 0.25);--bs-navbar-active-color:#fff;--bs-navbar-brand-color:#fff;--bs-navbar-brand-hover-color:#fff;--bs-navbar-toggler-border-color:rgba(255, 255, 255, 0.1);--bs-navbar-toggler-icon-bg:url(${$})}[data-bs-theme=dark] .navbar-toggler-icon{--bs-navbar-toggler-icon-bg:url(${$})}.card{--bs-card-spacer-y:1rem;--bs-card-spacer-x:1rem;--bs-card-title-spacer-y:0.5rem;--bs-card-title-color: ;--bs-card-subtitle-color: ;--bs-card-border-width:var(--bs-border-width);--bs-card-border-color:var(--bs-border-color-translucent);--bs-card-border-radius:var(--bs-border-radius);--bs-card-box-shadow: ;--bs-card-inner-border-radius:calc(var(--bs-border-radius) - (var(--bs-border-width)));--bs-card-cap-padding-y:0.5rem;--bs-card-cap-padding-x:1rem;--bs-card-cap-bg:rgba(var(--bs-body-color-rgb), 0.03);--bs-card-cap-color: ;--bs-card-height: ;--bs-card-color: ;--bs-card-bg:var(--bs-body-bg);--bs-card-img-overlay-padding:1rem;--bs-card-group-margin:0.75rem;position:relative;display:flex;flex-direction:column;min-width:0;height:var(--bs-card-height);color:var(--bs-body-color);word-wrap:break-word;background-color:var(--bs-card-bg);background-clip:border-box;border:var(--bs-card-border-width) solid var(--bs-card-border-color);border-radius:var(--bs-card-border-radius)}.card>hr{margin-right:0;margin-left:0}.card>.list-group{border-top:inherit;border-bottom:inherit}.card>.list-group:first-child{border-top-width:0;border-top-left-radius:var(--bs-card-inner-border-radius);border-top-right-radius:var(--bs-card-inner-border-radius)}.card>.list-group:last-child{border-bottom-width:0;border-bottom-right-radius:var(--bs-card-inner-border-radius);border-bottom-left-radius:var(--bs-card-inner-border-radius)}.card>.card-header+.list-group,.card>.list-group+.card-footer{border-top:0}.card-body{flex:1 1 auto;padding:var(--bs-card-spacer-y) var(--bs-card-spacer-x);color:var(--bs-card-color)}.card-title{margin-bottom:var(--bs-card-title-spacer-y);color:var(--bs-card-title-color)}.card-subtitle{margin-top:calc(-.5 * var(--bs-card-title-spacer-y));margin-bottom:0;color:var(--bs-card-subtitle-color)}.card-text:last-child{margin-bottom:0}.card-link+.card-link{margin-left:var(--bs-card-spacer-x)}.card-header{padding:var(--bs-card-cap-padding-y) var(--bs-card-cap-padding-x);margin-bottom:0;color:var(--bs-card-cap-color);background-color:var(--bs-card-cap-bg);border-bottom:var(--bs-card-border-width) solid var(--bs-card-border-color)}.card-header:first-child{border-radius:var(--bs-card-inner-border-radius) var(--bs-card-inner-border-radius) 0 0}.card-footer{padding:var(--bs-card-cap-padding-y) var(--bs-card-cap-padding-x);color:var(--bs-card-cap-color);background-color:var(--bs-card-cap-bg);border-top:var(--bs-card-border-width) solid var(--bs-card-border-color)}.card-footer:last-child{border-radius:0 0 var(--bs-card-inner-border-radius) var(--bs-card-inner-border-radius)}.card-header-tabs{margin-right:calc(-.5 * var(--bs-card-cap-padding-x));margin-bottom:calc(-1 * var(--bs-card-cap-padding-y));margin-left:calc(-.5 * var(--bs-card-cap-padding-x));border-bottom:0}.card-header-tabs .nav-link.active{background-color:var(--bs-card-bg);border-bottom-color:var(--bs-card-bg)}.card-header-pills{margin-right:calc(-.5 * var(--bs-card-cap-padding-x));margin-left:calc(-.5 * var(--bs-card-cap-padding-x))}.card-img-overlay{position:absolute;top:0;right:0;bottom:0;left:0;padding:var(--bs-card-img-overlay-padding);border-radius:var(--bs-card-inner-border-radius)}.card-img,.card-img-bottom,.card-img-top{width:100%}.card-img,.card-img-top{border-top-left-radius:var(--bs-card-inner-border-radius);border-top-right-radius:var(--bs-card-inner-border-radius)}.card-img,.card-img-bottom{border-bottom-right-radius:var(--bs-card-inner-border-radius);border-bottom-left-radius:var(--bs-card-inner-border-radius)}.card-group>.card{margin-bottom:var(--bs-card-group-margin)}@media (min-width:576px){.card-group{display:flex;flex-flow:row wrap}.card-group>.card{flex:1 0 0%;margin-bottom:0}.card-group>.card+.card{margin-left:0;border-left:0}.card-group>.card:not(:last-child){border-top-right-radius:0;border-bottom-right-radius:0}.card-group>.card:not(:last-child) .card-header,.card-group>.card:not(:last-child) .card-img-top{border-top-right-radius:0}.card-group>.card:not(:last-child) .card-footer,.card-group>.card:not(:last-child) .card-img-bottom{border-bottom-right-radius:0}.card-group>.card:not(:first-child){border-top-left-radius:0;border-bottom-left-radius:0}.card-group>.card:not(:first-child) .card-header,.card-group>.card:not(:first-child) .card-img-top{border-top-left-radius:0}.card-group>.card:not(:first-child) .card-footer,.card-group>.card:not(:first-child) .card-img-bottom{border-bottom-left-radius:0}}.accordion{--bs-accordion-color:var(--bs-body-color);--bs-accordion-bg:var(--bs-body-bg);--bs-accordion-transition:color 0.15s ease-in-out,background-color 0.15s ease-in-out,border-color 0.15s ease-in-out,box-shadow 0.15s ease-in-out,border-radius 0.15s ease;--bs-accordion-border-color:var(--bs-border-color);--bs-accordion-border-width:var(--bs-border-width);--bs-accordion-border-radius:var(--bs-border-radius);--bs-accordion-inner-border-radius:calc(var(--bs-border-radius) - (var(--bs-border-width)));--bs-accordion-btn-padding-x:1.25rem;--bs-accordion-btn-padding-y:1rem;--bs-accordion-btn-color:var(--bs-body-color);--bs-accordion-btn-bg:var(--bs-accordion-bg);--bs-accordion-btn-icon:url(${U});--bs-accordion-btn-icon-width:1.25rem;--bs-accordion-btn-icon-transform:rotate(-180deg);--bs-accordion-btn-icon-transition:transform 0.2s ease-in-out;--bs-accordion-btn-active-icon:url(${V});--bs-accordion-btn-focus-box-shadow:0 0 0 0.25rem rgba(13, 110, 253, 0.25);--bs-accordion-body-padding-x:1.25rem;--bs-accordion-body-padding-y:1rem;--bs-accordion-active-color:var(--bs-primary-text-emphasis);--bs-accordion-active-bg:var(--bs-primary-bg-subtle)}.accordion-button{position:relative;display:flex;align-items:center;width:100%;padding:var(--bs-accordion-btn-padding-y) var(--bs-accordion-btn-padding-x);font-size:1rem;color:var(--bs-accordion-btn-color);text-align:left;background-color:var(--bs-accordion-btn-bg);border:0;border-radius:0;overflow-anchor:none;transition:var(--bs-accordion-transition)}@media (prefers-reduced-motion:reduce){.accordion-button{transition:none}}.accordion-button:not(.collapsed){color:var(--bs-accordion-active-color);background-color:var(--bs-accordion-active-bg);box-shadow:inset 0 calc(-1 * var(--bs-accordion-border-width)) 0 var(--bs-accordion-border-color)}.accordion-button:not(.collapsed)::after{background-image:var(--bs-accordion-btn-active-icon);transform:var(--bs-accordion-btn-icon-transform)}.accordion-button::after{flex-shrink:0;width:var(--bs-accordion-btn-icon-width);height:var(--bs-accordion-btn-icon-width);margin-left:auto;content:"";background-image:var(--bs-accordion-btn-icon);background-repeat:no-repeat;background-size:var(--bs-accordion-btn-icon-width);transition:var(--bs-accordion-btn-icon-transition)}@media (prefers-reduced-motion:reduce){.accordion-button::after{transition:none}}.accordion-button:hover{z-index:2}.accordion-button:focus{z-index:3;outline:0;box-shadow:var(--bs-accordion-btn-focus-box-shadow)}.accordion-header{margin-bottom:0}.accordion-item{color:var(--bs-accordion-color);background-color:var(--bs-accordion-bg);border:var(--bs-accordion-border-width) solid var(--bs-accordion-border-color)}.accordion-item:first-of-type{border-top-left-radius:var(--bs-accordion-border-radius);border-top-right-radius:var(--bs-accordion-border-radius)}.accordion-item:first-of-type>.accordion-header .accordion-button{border-top-left-radius:var(--bs-accordion-inner-border-radius);border-top-right-radius:var(--bs-accordion-inner-border-radius)}.accordion-item:not(:first-of-type){border-top:0}.accordion-item:last-of-type{border-bottom-right-radius:var(--bs-accordion-border-radius);border-bottom-left-radius:var(--bs-accordion-border-radius)}.accordion-item:last-of-type>.accordion-header .accordion-button.collapsed{border-bottom-right-radius:var(--bs-accordion-inner-border-radius);border-bottom-left-radius:var(--bs-accordion-inner-border-radius)}.accordion-item:last-of-type>.accordion-collapse{border-bottom-right-radius:var(--bs-accordion-border-radius);border-bottom-left-radius:var(--bs-accordion-border-radius)}.accordion-body{padding:var(--bs-accordion-body-padding-y) var(--bs-accordion-body-padding-x)}.accordion-flush>.accordion-item{border-right:0;border-left:0;border-radius:0}.accordion-flush>.accordion-item:first-child{border-top:0}.accordion-flush>.accordion-item:last-child{border-bottom:0}.accordion-flush>.accordion-item>.accordion-header .accordion-button,.accordion-flush>.accordion-item>.accordion-header .accordion-button.collapsed{border-radius:0}.accordion-flush>.accordion-item>.accordion-collapse{border-radius:0}[data-bs-theme=dark] .accordion-button::after{--bs-accordion-btn-icon:url(${W});--bs-accordion-btn-active-icon:url(${W})}.breadcrumb{--bs-breadcrumb-padding-x:0;--bs-breadcrumb-padding-y:0;--bs-breadcrumb-margin-bottom:1rem;--bs-breadcrumb-bg: ;--bs-breadcrumb-border-radius: ;--bs-breadcrumb-divider-color:var(--bs-secondary-color);--bs-breadcrumb-item-padding-x:0.5rem;--bs-breadcrumb-item-active-color:var(--bs-secondary-color);display:flex;flex-wrap:wrap;padding:var(--bs-breadcrumb-padding-y) var(--bs-breadcrumb-padding-x);margin-bottom:var(--bs-breadcrumb-margin-bottom);font-size:var(--bs-breadcrumb-font-size);list-style:none;background-color:var(--bs-breadcrumb-bg);border-radius:var(--bs-breadcrumb-border-radius)}.breadcrumb-item+.breadcrumb-item{padding-left:var(--bs-breadcrumb-item-padding-x)}.breadcrumb-item+.breadcrumb-item::before{float:left;padding-right:var(--bs-breadcrumb-item-padding-x);color:var(--bs-breadcrumb-divider-color);content:var(--bs-breadcrumb-divider, "/")}.breadcrumb-item.active{color:var(--bs-breadcrumb-item-active-color)}.pagination{--bs-pagination-padding-x:0.75rem;--bs-pagination-padding-y:0.375rem;--bs-pagination-font-size:1rem;--bs-pagination-color:var(--bs-link-color);--bs-pagination-bg:var(--bs-body-bg);--bs-pagination-border-width:var(--bs-border-width);--bs-pagination-border-color:var(--bs-border-color);--bs-pagination-border-radius:var(--bs-border-radius);--bs-pagination-hover-color:var(--bs-link-hover-color);--bs-pagination-hover-bg:var(--bs-tertiary-bg);--bs-pagination-hover-border-color:var(--bs-border-color);--bs-pagination-focus-color:var(--bs-link-hover-color);--bs-pagination-focus-bg:var(--bs-secondary-bg);--bs-pagination-focus-box-shadow:0 0 0 0.25rem rgba(13, 110, 253, 0.25);--bs-pagination-active-color:#fff;--bs-pagination-active-bg:#0d6efd;--bs-pagination-active-border-color:#0d6efd;--bs-pagination-disabled-color:var(--bs-secondary-color);--bs-pagination-disabled-bg:var(--bs-secondary-bg);--bs-pagination-disabled-border-color:var(--bs-border-color);display:flex;padding-left:0;list-style:none}.page-link{position:relative;display:block;padding:var(--bs-pagination-padding-y) var(--bs-pagination-padding-x);font-size:var(--bs-pagination-font-size);color:var(--bs-pagination-color);text-decoration:none;background-color:var(--bs-pagination-bg);border:var(--bs-pagination-border-width) solid var(--bs-pagination-border-color);transition:color .15s ease-in-out,background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out}@media (prefers-reduced-motion:reduce){.page-link{transition:none}}.page-link:hover{z-index:2;color:var(--bs-pagination-hover-color);background-color:var(--bs-pagination-hover-bg);border-color:var(--bs-pagination-hover-border-color)}.page-link:focus{z-index:3;color:var(--bs-pagination-focus-color);background-color:var(--bs-pagination-focus-bg);outline:0;box-shadow:var(--bs-pagination-focus-box-shadow)}.active>.page-link,.page-link.active{z-index:3;color:var(--bs-pagination-active-color);background-color:var(--bs-pagination-active-bg);border-color:var(--bs-pagination-active-border-color)}.disabled>.page-link,.page-link.disabled{color:var(--bs-pagination-disabled-color);pointer-events:none;background-color:var(--bs-pagination-disabled-bg);border-color:var(--bs-pagination-disabled-border-color)}.page-item:not(:first-child) .page-link{margin-left:calc(var(--bs-border-width) * -1)}.page-item:first-child .page-link{border-top-left-radius:var(--bs-pagination-border-radius);border-bottom-left-radius:var(--bs-pagination-border-radius)}.page-item:last-child .page-link{border-top-right-radius:var(--bs-pagination-border-radius);border-bottom-right-radius:var(--bs-pagination-border-radius)}.pagination-lg{--bs-pagination-padding-x:1.5rem;--bs-pagination-padding-y:0.75rem;--bs-pagination-font-size:1.25rem;--bs-pagination-border-radius:var(--bs-border-radius-lg)}.pagination-sm{--bs-pagination-padding-x:0.5rem;--bs-pagination-padding-y:0.25rem;--bs-pagination-font-size:0.875rem;--bs-pagination-border-radius:var(--bs-border-radius-sm)}.badge{--bs-badge-padding-x:0.65em;--bs-badge-padding-y:0.35em;--bs-badge-font-size:0.75em;--bs-badge-font-weight:700;--bs-badge-color:#fff;--bs-badge-border-radius:var(--bs-border-radius);display:inline-block;padding:var(--bs-badge-padding-y) var(--bs-badge-padding-x);font-size:var(--bs-badge-font-size);font-weight:var(--bs-badge-font-weight);line-height:1;color:var(--bs-badge-color);text-align:center;white-space:nowrap;vertical-align:baseline;border-radius:var(--bs-badge-border-radius)}.badge:empty{display:none}.btn .badge{position:relative;top:-1px}.alert{--bs-alert-bg:transparent;--bs-alert-padding-x:1rem;--bs-alert-padding-y:1rem;--bs-alert-margin-bottom:1rem;--bs-alert-color:inherit;--bs-alert-border-color:transparent;--bs-alert-border:var(--bs-border-width) solid var(--bs-alert-border-color);--bs-alert-border-radius:var(--bs-border-radius);--bs-alert-link-color:inherit;position:relative;padding:var(--bs-alert-padding-y) var(--bs-alert-padding-x);margin-bottom:var(--bs-alert-margin-bottom);color:var(--bs-alert-color);background-color:var(--bs-alert-bg);border:var(--bs-alert-border);border-radius:var(--bs-alert-border-radius)}.alert-heading{color:inherit}.alert-link{font-weight:700;color:var(--bs-alert-link-color)}.alert-dismissible{padding-right:3rem}.alert-dismissible .btn-close{position:absolute;top:0;right:0;z-index:2;padding:1.25rem 1rem}.alert-primary{--bs-alert-color:var(--bs-primary-text-emphasis);--bs-alert-bg:var(--bs-primary-bg-subtle);--bs-alert-border-color:var(--bs-primary-border-subtle);--bs-alert-link-color:var(--bs-primary-text-emphasis)}.alert-secondary{--bs-alert-color:var(--bs-secondary-text-emphasis);--bs-alert-bg:var(--bs-secondary-bg-subtle);--bs-alert-border-color:var(--bs-secondary-border-subtle);--bs-alert-link-color:var(--bs-secondary-text-emphasis)}.alert-success{--bs-alert-color:var(--bs-success-text-emphasis);--bs-alert-bg:var(--bs-success-bg-subtle);--bs-alert-border-color:var(--bs-success-border-subtle);--bs-alert-link-color:var(--bs-success-text-emphasis)}.alert-info{--bs-alert-color:var(--bs-info-text-emphasis);--bs-alert-bg:var(--bs-info-bg-subtle);--bs-alert-border-color:var(--bs-info-border-subtle);--bs-alert-link-color:var(--bs-info-text-emphasis)}.alert-warning{--bs-alert-color:var(--bs-warning-text-emphasis);--bs-alert-bg:var(--bs-warning-bg-subtle);--bs-alert-border-color:var(--bs-warning-border-subtle);--bs-alert-link-color:var(--bs-warning-text-emphasis)}.alert-danger{--bs-alert-color:var(--bs-danger-text-emphasis);--bs-alert-bg:var(--bs-danger-bg-subtle);--bs-alert-border-color:var(--bs-danger-border-subtle);--bs-alert-link-color:var(--bs-danger-text-emphasis)}.alert-light{--bs-alert-color:var(--bs-light-text-emphasis);--bs-alert-bg:var(--bs-light-bg-subtle);--bs-alert-border-color:var(--bs-light-border-subtle);--bs-alert-link-color:var(--bs-light-text-emphasis)}.alert-dark{--bs-alert-color:var(--bs-dark-text-emphasis);--bs-alert-bg:var(--bs-dark-bg-subtle);--bs-alert-border-color:var(--bs-dark-border-subtle);--bs-alert-link-color:var(--bs-dark-text-emphasis)}@keyframes progress-bar-stripes{0%{background-position-x:1rem}}.progress,.progress-stacked{--bs-progress-height:1rem;--bs-progress-font-size:0.75rem;--bs-progress-bg:var(--bs-secondary-bg);--bs-progress-border-radius:var(--bs-border-radius);--bs-progress-box-shadow:var(--bs-box-shadow-inset);--bs-progress-bar-color:#fff;--bs-progress-bar-bg:#0d6efd;--bs-progress-bar-transition:width 0.6s ease;display:flex;height:var(--bs-progress-height);overflow:hidden;font-size:var(--bs-progress-font-size);background-color:var(--bs-progress-bg);border-radius:var(--bs-progress-border-radius)}.progress-bar{display:flex;flex-direction:column;justify-content:center;overflow:hidden;color:var(--bs-progress-bar-color);text-align:center;white-space:nowrap;background-color:var(--bs-progress-bar-bg);transition:var(--bs-progress-bar-transition)}@media (prefers-reduced-motion:reduce){.progress-bar{transition:none}}.progress-bar-striped{background-image:linear-gradient(45deg,rgba(255,255,255,.15) 25%,transparent 25%,transparent 50%,rgba(255,255,255,.15) 50%,rgba(255,255,255,.15) 75%,transparent 75%,transparent);background-size:var(--bs-progress-height) var(--bs-progress-height)}.progress-stacked>.progress{overflow:visible}.progress-stacked>.progress>.progress-bar{width:100%}.progress-bar-animated{animation:1s linear infinite progress-bar-stripes}@media (prefers-reduced-motion:reduce){.progress-bar-animated{animation:none}}.list-group{--bs-list-group-color:var(--bs-body-color);--bs-list-group-bg:var(--bs-body-bg);--bs-list-group-border-color:var(--bs-border-color);--bs-list-group-border-width:var(--bs-border-width);--bs-list-group-border-radius:var(--bs-border-radius);--bs-list-group-item-padding-x:1rem;--bs-list-group-item-padding-y:0.5rem;--bs-list-group-action-color:var(--bs-secondary-color);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-tertiary-bg);--bs-list-group-action-active-color:var(--bs-body-color);--bs-list-group-action-active-bg:var(--bs-secondary-bg);--bs-list-group-disabled-color:var(--bs-secondary-color);--bs-list-group-disabled-bg:var(--bs-body-bg);--bs-list-group-active-color:#fff;--bs-list-group-active-bg:#0d6efd;--bs-list-group-active-border-color:#0d6efd;display:flex;flex-direction:column;padding-left:0;margin-bottom:0;border-radius:var(--bs-list-group-border-radius)}.list-group-numbered{list-style-type:none;counter-reset:section}.list-group-numbered>.list-group-item::before{content:counters(section, ".") ". ";counter-increment:section}.list-group-item-action{width:100%;color:var(--bs-list-group-action-color);text-align:inherit}.list-group-item-action:focus,.list-group-item-action:hover{z-index:1;color:var(--bs-list-group-action-hover-color);text-decoration:none;background-color:var(--bs-list-group-action-hover-bg)}.list-group-item-action:active{color:var(--bs-list-group-action-active-color);background-color:var(--bs-list-group-action-active-bg)}.list-group-item{position:relative;display:block;padding:var(--bs-list-group-item-padding-y) var(--bs-list-group-item-padding-x);color:var(--bs-list-group-color);text-decoration:none;background-color:var(--bs-list-group-bg);border:var(--bs-list-group-border-width) solid var(--bs-list-group-border-color)}.list-group-item:first-child{border-top-left-radius:inherit;border-top-right-radius:inherit}.list-group-item:last-child{border-bottom-right-radius:inherit;border-bottom-left-radius:inherit}.list-group-item.disabled,.list-group-item:disabled{color:var(--bs-list-group-disabled-color);pointer-events:none;background-color:var(--bs-list-group-disabled-bg)}.list-group-item.active{z-index:2;color:var(--bs-list-group-active-color);background-color:var(--bs-list-group-active-bg);border-color:var(--bs-list-group-active-border-color)}.list-group-item+.list-group-item{border-top-width:0}.list-group-item+.list-group-item.active{margin-top:calc(-1 * var(--bs-list-group-border-width));border-top-width:var(--bs-list-group-border-width)}.list-group-horizontal{flex-direction:row}.list-group-horizontal>.list-group-item:first-child:not(:last-child){border-bottom-left-radius:var(--bs-list-group-border-radius);border-top-right-radius:0}.list-group-horizontal>.list-group-item:last-child:not(:first-child){border-top-right-radius:var(--bs-list-group-border-radius);border-bottom-left-radius:0}.list-group-horizontal>.list-group-item.active{margin-top:0}.list-group-horizontal>.list-group-item+.list-group-item{border-top-width:var(--bs-list-group-border-width);border-left-width:0}.list-group-horizontal>.list-group-item+.list-group-item.active{margin-left:calc(-1 * var(--bs-list-group-border-width));border-left-width:var(--bs-list-group-border-width)}@media (min-width:576px){.list-group-horizontal-sm{flex-direction:row}.list-group-horizontal-sm>.list-group-item:first-child:not(:last-child){border-bottom-left-radius:var(--bs-list-group-border-radius);border-top-right-radius:0}.list-group-horizontal-sm>.list-group-item:last-child:not(:first-child){border-top-right-radius:var(--bs-list-group-border-radius);border-bottom-left-radius:0}.list-group-horizontal-sm>.list-group-item.active{margin-top:0}.list-group-horizontal-sm>.list-group-item+.list-group-item{border-top-width:var(--bs-list-group-border-width);border-left-width:0}.list-group-horizontal-sm>.list-group-item+.list-group-item.active{margin-left:calc(-1 * var(--bs-list-group-border-width));border-left-width:var(--bs-list-group-border-width)}}@media (min-width:768px){.list-group-horizontal-md{flex-direction:row}.list-group-horizontal-md>.list-group-item:first-child:not(:last-child){border-bottom-left-radius:var(--bs-list-group-border-radius);border-top-right-radius:0}.list-group-horizontal-md>.list-group-item:last-child:not(:first-child){border-top-right-radius:var(--bs-list-group-border-radius);border-bottom-left-radius:0}.list-group-horizontal-md>.list-group-item.active{margin-top:0}.list-group-horizontal-md>.list-group-item+.list-group-item{border-top-width:var(--bs-list-group-border-width);border-left-width:0}.list-group-horizontal-md>.list-group-item+.list-group-item.active{margin-left:calc(-1 * var(--bs-list-group-border-width));border-left-width:var(--bs-list-group-border-width)}}@media (min-width:992px){.list-group-horizontal-lg{flex-direction:row}.list-group-horizontal-lg>.list-group-item:first-child:not(:last-child){border-bottom-left-radius:var(--bs-list-group-border-radius);border-top-right-radius:0}.list-group-horizontal-lg>.list-group-item:last-child:not(:first-child){border-top-right-radius:var(--bs-list-group-border-radius);border-bottom-left-radius:0}.list-group-horizontal-lg>.list-group-item.active{margin-top:0}.list-group-horizontal-lg>.list-group-item+.list-group-item{border-top-width:var(--bs-list-group-border-width);border-left-width:0}.list-group-horizontal-lg>.list-group-item+.list-group-item.active{margin-left:calc(-1 * var(--bs-list-group-border-width));border-left-width:var(--bs-list-group-border-width)}}@media (min-width:1200px){.list-group-horizontal-xl{flex-direction:row}.list-group-horizontal-xl>.list-group-item:first-child:not(:last-child){border-bottom-left-radius:var(--bs-list-group-border-radius);border-top-right-radius:0}.list-group-horizontal-xl>.list-group-item:last-child:not(:first-child){border-top-right-radius:var(--bs-list-group-border-radius);border-bottom-left-radius:0}.list-group-horizontal-xl>.list-group-item.active{margin-top:0}.list-group-horizontal-xl>.list-group-item+.list-group-item{border-top-width:var(--bs-list-group-border-width);border-left-width:0}.list-group-horizontal-xl>.list-group-item+.list-group-item.active{margin-left:calc(-1 * var(--bs-list-group-border-width));border-left-width:var(--bs-list-group-border-width)}}@media (min-width:1400px){.list-group-horizontal-xxl{flex-direction:row}.list-group-horizontal-xxl>.list-group-item:first-child:not(:last-child){border-bottom-left-radius:var(--bs-list-group-border-radius);border-top-right-radius:0}.list-group-horizontal-xxl>.list-group-item:last-child:not(:first-child){border-top-right-radius:var(--bs-list-group-border-radius);border-bottom-left-radius:0}.list-group-horizontal-xxl>.list-group-item.active{margin-top:0}.list-group-horizontal-xxl>.list-group-item+.list-group-item{border-top-width:var(--bs-list-group-border-width);border-left-width:0}.list-group-horizontal-xxl>.list-group-item+.list-group-item.active{margin-left:calc(-1 * var(--bs-list-group-border-width));border-left-width:var(--bs-list-group-border-width)}}.list-group-flush{border-radius:0}.list-group-flush>.list-group-item{border-width:0 0 var(--bs-list-group-border-width)}.list-group-flush>.list-group-item:last-child{border-bottom-width:0}.list-group-item-primary{--bs-list-group-color:var(--bs-primary-text-emphasis);--bs-list-group-bg:var(--bs-primary-bg-subtle);--bs-list-group-border-color:var(--bs-primary-border-subtle);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-primary-border-subtle);--bs-list-group-action-active-color:var(--bs-emphasis-color);--bs-list-group-action-active-bg:var(--bs-primary-border-subtle);--bs-list-group-active-color:var(--bs-primary-bg-subtle);--bs-list-group-active-bg:var(--bs-primary-text-emphasis);--bs-list-group-active-border-color:var(--bs-primary-text-emphasis)}.list-group-item-secondary{--bs-list-group-color:var(--bs-secondary-text-emphasis);--bs-list-group-bg:var(--bs-secondary-bg-subtle);--bs-list-group-border-color:var(--bs-secondary-border-subtle);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-secondary-border-subtle);--bs-list-group-action-active-color:var(--bs-emphasis-color);--bs-list-group-action-active-bg:var(--bs-secondary-border-subtle);--bs-list-group-active-color:var(--bs-secondary-bg-subtle);--bs-list-group-active-bg:var(--bs-secondary-text-emphasis);--bs-list-group-active-border-color:var(--bs-secondary-text-emphasis)}.list-group-item-success{--bs-list-group-color:var(--bs-success-text-emphasis);--bs-list-group-bg:var(--bs-success-bg-subtle);--bs-list-group-border-color:var(--bs-success-border-subtle);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-success-border-subtle);--bs-list-group-action-active-color:var(--bs-emphasis-color);--bs-list-group-action-active-bg:var(--bs-success-border-subtle);--bs-list-group-active-color:var(--bs-success-bg-subtle);--bs-list-group-active-bg:var(--bs-success-text-emphasis);--bs-list-group-active-border-color:var(--bs-success-text-emphasis)}.list-group-item-info{--bs-list-group-color:var(--bs-info-text-emphasis);--bs-list-group-bg:var(--bs-info-bg-subtle);--bs-list-group-border-color:var(--bs-info-border-subtle);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-info-border-subtle);--bs-list-group-action-active-color:var(--bs-emphasis-color);--bs-list-group-action-active-bg:var(--bs-info-border-subtle);--bs-list-group-active-color:var(--bs-info-bg-subtle);--bs-list-group-active-bg:var(--bs-info-text-emphasis);--bs-list-group-active-border-color:var(--bs-info-text-emphasis)}.list-group-item-warning{--bs-list-group-color:var(--bs-warning-text-emphasis);--bs-list-group-bg:var(--bs-warning-bg-subtle);--bs-list-group-border-color:var(--bs-warning-border-subtle);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-warning-border-subtle);--bs-list-group-action-active-color:var(--bs-emphasis-color);--bs-list-group-action-active-bg:var(--bs-warning-border-subtle);--bs-list-group-active-color:var(--bs-warning-bg-subtle);--bs-list-group-active-bg:var(--bs-warning-text-emphasis);--bs-list-group-active-border-color:var(--bs-warning-text-emphasis)}.list-group-item-danger{--bs-list-group-color:var(--bs-danger-text-emphasis);--bs-list-group-bg:var(--bs-danger-bg-subtle);--bs-list-group-border-color:var(--bs-danger-border-subtle);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-danger-border-subtle);--bs-list-group-action-active-color:var(--bs-emphasis-color);--bs-list-group-action-active-bg:var(--bs-danger-border-subtle);--bs-list-group-active-color:var(--bs-danger-bg-subtle);--bs-list-group-active-bg:var(--bs-danger-text-emphasis);--bs-list-group-active-border-color:var(--bs-danger-text-emphasis)}.list-group-item-light{--bs-list-group-color:var(--bs-light-text-emphasis);--bs-list-group-bg:var(--bs-light-bg-subtle);--bs-list-group-border-color:var(--bs-light-border-subtle);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-light-border-subtle);--bs-list-group-action-active-color:var(--bs-emphasis-color);--bs-list-group-action-active-bg:var(--bs-light-border-subtle);--bs-list-group-active-color:var(--bs-light-bg-subtle);--bs-list-group-active-bg:var(--bs-light-text-emphasis);--bs-list-group-active-border-color:var(--bs-light-text-emphasis)}.list-group-item-dark{--bs-list-group-color:var(--bs-dark-text-emphasis);--bs-list-group-bg:var(--bs-dark-bg-subtle);--bs-list-group-border-color:var(--bs-dark-border-subtle);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-dark-border-subtle);--bs-list-group-action-active-color:var(--bs-emphasis-color);--bs-list-group-action-active-bg:var(--bs-dark-border-subtle);--bs-list-group-active-color:var(--bs-dark-bg-subtle);--bs-list-group-active-bg:var(--bs-dark-text-emphasis);--bs-list-group-active-border-color:var(--bs-dark-text-emphasis)}.btn-close{--bs-btn-close-color:#000;--bs-btn-close-bg:url(${H});--bs-btn-close-opacity:0.5;--bs-btn-close-hover-opacity:0.75;--bs-btn-close-focus-shadow:0 0 0 0.25rem rgba(13, 110, 253, 0.25);--bs-btn-close-focus-opacity:1;--bs-btn-close-disabled-opacity:0.25;--bs-btn-close-white-filter:invert(1) grayscale(100%) brightness(200%);box-sizing:content-box;width:1em;height:1em;padding:.25em .25em;color:var(--bs-btn-close-color);background:transparent var(--bs-btn-close-bg) center/1em auto no-repeat;border:0;border-radius:.375rem;opacity:var(--bs-btn-close-opacity)}.btn-close:hover{color:var(--bs-btn-close-color);text-decoration:none;opacity:var(--bs-btn-close-hover-opacity)}.btn-close:focus{outline:0;box-shadow:var(--bs-btn-close-focus-shadow);opacity:var(--bs-btn-close-focus-opacity)}.btn-close.disabled,.btn-close:disabled{pointer-events:none;-webkit-user-select:none;-moz-user-select:none;user-select:none;opacity:var(--bs-btn-close-disabled-opacity)}.btn-close-white{filter:var(--bs-btn-close-white-filter)}[data-bs-theme=dark] .btn-close{filter:var(--bs-btn-close-white-filter)}.toast{--bs-toast-zindex:1090;--bs-toast-padding-x:0.75rem;--bs-toast-padding-y:0.5rem;--bs-toast-spacing:1.5rem;--bs-toast-max-width:350px;--bs-toast-font-size:0.875rem;--bs-toast-color: ;--bs-toast-bg:rgba(var(--bs-body-bg-rgb), 0.85);--bs-toast-border-width:var(--bs-border-width);--bs-toast-border-color:var(--bs-border-color-translucent);--bs-toast-border-radius:var(--bs-border-radius);--bs-toast-box-shadow:var(--bs-box-shadow);--bs-toast-header-color:var(--bs-secondary-color);--bs-toast-header-bg:rgba(var(--bs-body-bg-rgb), 0.85);--bs-toast-header-border-color:var(--bs-border-color-translucent);width:var(--bs-toast-max-width);max-width:100%;font-size:var(--bs-toast-font-size);color:var(--bs-toast-color);pointer-events:auto;background-color:var(--bs-toast-bg);background-clip:padding-box;border:var(--bs-toast-border-width) solid var(--bs-toast-border-color);box-shadow:var(--bs-toast-box-shadow);border-radius:var(--bs-toast-border-radius)}.toast.showing{opacity:0}.toast:not(.show){display:none}.toast-container{--bs-toast-zindex:1090;position:absolute;z-index:var(--bs-toast-zindex);width:-webkit-max-content;width:-moz-max-content;width:max-content;max-width:100%;pointer-events:none}.toast-container>:not(:last-child){margin-bottom:var(--bs-toast-spacing)}.toast-header{display:flex;align-items:center;padding:var(--bs-toast-padding-y) var(--bs-toast-padding-x);color:var(--bs-toast-header-color);background-color:var(--bs-toast-header-bg);background-clip:padding-box;border-bottom:var(--bs-toast-border-width) solid var(--bs-toast-header-border-color);border-top-left-radius:calc(var(--bs-toast-border-radius) - var(--bs-toast-border-width));border-top-right-radius:calc(var(--bs-toast-border-radius) - var(--bs-toast-border-width))}.toast-header .btn-close{margin-right:calc(-.5 * var(--bs-toast-padding-x));margin-left:var(--bs-toast-padding-x)}.toast-body{padding:var(--bs-toast-padding-x);word-wrap:break-word}.modal{--bs-modal-zindex:1055;--bs-modal-width:500px;--bs-modal-padding:1rem;--bs-modal-margin:0.5rem;--bs-modal-color: ;--bs-modal-bg:var(--bs-body-bg);--bs-modal-border-color:var(--bs-border-color-translucent);--bs-modal-border-width:var(--bs-border-width);--bs-modal-border-radius:var(--bs-border-radius-lg);--bs-modal-box-shadow:var(--bs-box-shadow-sm);--bs-modal-inner-border-radius:calc(var(--bs-border-radius-lg) - (var(--bs-border-width)));--bs-modal-header-padding-x:1rem;--bs-modal-header-padding-y:1rem;--bs-modal-header-padding:1rem 1rem;--bs-modal-header-border-color:var(--bs-border-color);--bs-modal-header-border-width:var(--bs-border-width);--bs-modal-title-line-height:1.5;--bs-modal-footer-gap:0.5rem;--bs-modal-footer-bg: ;--bs-modal-footer-border-color:var(--bs-border-color);--bs-modal-footer-border-width:var(--bs-border-width);position:fixed;top:0;left:0;z-index:var(--bs-modal-zindex);display:none;width:100%;height:100%;overflow-x:hidden;overflow-y:auto;outline:0}.modal-dialog{position:relative;width:auto;margin:var(--bs-modal-margin);pointer-events:none}.modal.fade .modal-dialog{transition:transform .3s ease-out;transform:translate(0,-50px)}@media (prefers-reduced-motion:reduce){.modal.fade .modal-dialog{transition:none}}.modal.show .modal-dialog{transform:none}.modal.modal-static .modal-dialog{transform:scale(1.02)}.modal-dialog-scrollable{height:calc(100% - var(--bs-modal-margin) * 2)}.modal-dialog-scrollable .modal-content{max-height:100%;overflow:hidden}.modal-dialog-scrollable .modal-body{overflow-y:auto}.modal-dialog-centered{display:flex;align-items:center;min-height:calc(100% - var(--bs-modal-margin) * 2)}.modal-content{position:relative;display:flex;flex-direction:column;width:100%;color:var(--bs-modal-color);pointer-events:auto;background-color:var(--bs-modal-bg);background-clip:padding-box;border:var(--bs-modal-border-width) solid var(--bs-modal-border-color);border-radius:var(--bs-modal-border-radius);outline:0}.modal-backdrop{--bs-backdrop-zindex:1050;--bs-backdrop-bg:#000;--bs-backdrop-opacity:0.5;position:fixed;top:0;left:0;z-index:var(--bs-backdrop-zindex);width:100vw;height:100vh;background-color:var(--bs-backdrop-bg)}.modal-backdrop.fade{opacity:0}.modal-backdrop.show{opacity:var(--bs-backdrop-opacity)}.modal-header{display:flex;flex-shrink:0;align-items:center;padding:var(--bs-modal-header-padding);border-bottom:var(--bs-modal-header-border-width) solid var(--bs-modal-header-border-color);border-top-left-radius:var(--bs-modal-inner-border-radius);border-top-right-radius:var(--bs-modal-inner-border-radius)}.modal-header .btn-close{padding:calc(var(--bs-modal-header-padding-y) * .5) calc(var(--bs-modal-header-padding-x) * .5);margin:calc(-.5 * var(--bs-modal-header-padding-y)) calc(-.5 * var(--bs-modal-header-padding-x)) calc(-.5 * var(--bs-modal-header-padding-y)) auto}.modal-title{margin-bottom:0;line-height:var(--bs-modal-title-line-height)}.modal-body{position:relative;flex:1 1 auto;padding:var(--bs-modal-padding)}.modal-footer{display:flex;flex-shrink:0;flex-wrap:wrap;align-items:center;justify-content:flex-end;padding:calc(var(--bs-modal-padding) - var(--bs-modal-footer-gap) * .5);background-color:var(--bs-modal-footer-bg);border-top:var(--bs-modal-footer-border-width) solid var(--bs-modal-footer-border-color);border-bottom-right-radius:var(--bs-modal-inner-border-radius);border-bottom-left-radius:var(--bs-modal-inner-border-radius)}.modal-footer>*{margin:calc(var(--bs-modal-footer-gap) * .5)}@media (min-width:576px){.modal{--bs-modal-margin:1.75rem;--bs-modal-box-shadow:var(--bs-box-shadow)}.modal-dialog{max-width:var(--bs-modal-width);margin-right:auto;margin-left:auto}.modal-sm{--bs-modal-width:300px}}@media (min-width:992px){.modal-lg,.modal-xl{--bs-modal-width:800px}}@media (min-width:1200px){.modal-xl{--bs-modal-width:1140px}}.modal-fullscreen{width:100vw;max-width:none;height:100%;margin:0}.modal-fullscreen .modal-content{height:100%;border:0;border-radius:0}.modal-fullscreen .modal-footer,.modal-fullscreen .modal-header{border-radius:0}.modal-fullscreen .modal-body{overflow-y:auto}@media (max-width:575.98px){.modal-fullscreen-sm-down{width:100vw;max-width:none;height:100%;margin:0}.modal-fullscreen-sm-down .modal-content{height:100%;border:0;border-radius:0}.modal-fullscreen-sm-down .modal-footer,.modal-fullscreen-sm-down .modal-header{border-radius:0}.modal-fullscreen-sm-down .modal-body{overflow-y:auto}}@media (max-width:767.98px){.modal-fullscreen-md-down{width:100vw;max-width:none;height:100%;margin:0}.modal-fullscreen-md-down .modal-content{height:100%;border:0;border-radius:0}.modal-fullscreen-md-down .modal-footer,.modal-fullscreen-md-down .modal-header{border-radius:0}.modal-fullscreen-md-down .modal-body{overflow-y:auto}}@media (max-width:991.98px){.modal-fullscreen-lg-down{width:100vw;max-width:none;height:100%;margin:0}.modal-fullscreen-lg-down .modal-content{height:100%;border:0;border-radius:0}.modal-fullscreen-lg-down .modal-footer,.modal-fullscreen-lg-down .modal-header{border-radius:0}.modal-fullscreen-lg-down .modal-body{overflow-y:auto}}@media (max-width:1199.98px){.modal-fullscreen-xl-down{width:100vw;max-width:none;height:100%;margin:0}.modal-fullscreen-xl-down .modal-content{height:100%;border:0;border-radius:0}.modal-fullscreen-xl-down .modal-footer,.modal-fullscreen-xl-down .modal-header{border-radius:0}.modal-fullscreen-xl-down .modal-body{overflow-y:auto}}@media (max-width:1399.98px){.modal-fullscreen-xxl-down{width:100vw;max-width:none;height:100%;margin:0}.modal-fullscreen-xxl-down .modal-content{height:100%;border:0;border-radius:0}.modal-fullscreen-xxl-down .modal-footer,.modal-fullscreen-xxl-down .modal-header{border-radius:0}.modal-fullscreen-xxl-down .modal-body{overflow-y:auto}}.tooltip{--bs-tooltip-zindex:1080;--bs-tooltip-max-width:200px;--bs-tooltip-padding-x:0.5rem;--bs-tooltip-padding-y:0.25rem;--bs-tooltip-margin: ;--bs-tooltip-font-size:0.875rem;--bs-tooltip-color:var(--bs-body-bg);--bs-tooltip-bg:var(--bs-emphasis-color);--bs-tooltip-border-radius:var(--bs-border-radius);--bs-tooltip-opacity:0.9;--bs-tooltip-arrow-width:0.8rem;--bs-tooltip-arrow-height:0.4rem;z-index:var(--bs-tooltip-zindex);display:block;margin:var(--bs-tooltip-margin);font-family:var(--bs-font-sans-serif);font-style:normal;font-weight:400;line-height:1.5;text-align:left;text-align:start;text-decoration:none;text-shadow:none;text-transform:none;letter-spacing:normal;word-break:normal;white-space:normal;word-spacing:normal;line-break:auto;font-size:var(--bs-tooltip-font-size);word-wrap:break-word;opacity:0}.tooltip.show{opacity:var(--bs-tooltip-opacity)}.tooltip .tooltip-arrow{display:block;width:var(--bs-tooltip-arrow-width);height:var(--bs-tooltip-arrow-height)}.tooltip .tooltip-arrow::before{position:absolute;content:"";border-color:transparent;border-style:solid}.bs-tooltip-auto[data-popper-placement^=top] .tooltip-arrow,.bs-tooltip-top .tooltip-arrow{bottom:calc(-1 * var(--bs-tooltip-arrow-height))}.bs-tooltip-auto[data-popper-placement^=top] .tooltip-arrow::before,.bs-tooltip-top .tooltip-arrow::before{top:-1px;border-width:var(--bs-tooltip-arrow-height) calc(var(--bs-tooltip-arrow-width) * .5) 0;border-top-color:var(--bs-tooltip-bg)}.bs-tooltip-auto[data-popper-placement^=right] .tooltip-arrow,.bs-tooltip-end .tooltip-arrow{left:calc(-1 * var(--bs-tooltip-arrow-height));width:var(--bs-tooltip-arrow-height);height:var(--bs-tooltip-arrow-width)}.bs-tooltip-auto[data-popper-placement^=right] .tooltip-arrow::before,.bs-tooltip-end .tooltip-arrow::before{right:-1px;border-width:calc(var(--bs-tooltip-arrow-width) * .5) var(--bs-tooltip-arrow-height) calc(var(--bs-tooltip-arrow-width) * .5) 0;border-right-color:var(--bs-tooltip-bg)}.bs-tooltip-auto[data-popper-placement^=bottom] .tooltip-arrow,.bs-tooltip-bottom .tooltip-arrow{top:calc(-1 * var(--bs-tooltip-arrow-height))}.bs-tooltip-auto[data-popper-placement^=bottom] .tooltip-arrow::before,.bs-tooltip-bottom .tooltip-arrow::before{bottom:-1px;border-width:0 calc(var(--bs-tooltip-arrow-width) * .5) var(--bs-tooltip-arrow-height);border-bottom-color:var(--bs-tooltip-bg)}.bs-tooltip-auto[data-popper-placement^=left] .tooltip-arrow,.bs-tooltip-start .tooltip-arrow{right:calc(-1 * var(--bs-tooltip-arrow-height));width:var(--bs-tooltip-arrow-height);height:var(--bs-tooltip-arrow-width)}.bs-tooltip-auto[data-popper-placement^=left] .tooltip-arrow::before,.bs-tooltip-start .tooltip-arrow::before{left:-1px;border-width:calc(var(--bs-tooltip-arrow-width) * .5) 0 calc(var(--bs-tooltip-arrow-width) * .5) var(--bs-tooltip-arrow-height);border-left-color:var(--bs-tooltip-bg)}.tooltip-inner{max-width:var(--bs-tooltip-max-width);padding:var(--bs-tooltip-padding-y) var(--bs-tooltip-padding-x);color:var(--bs-tooltip-color);text-align:center;background-color:var(--bs-tooltip-bg);border-radius:var(--bs-tooltip-border-radius)}.popover{--bs-popover-zindex:1070;--bs-popover-max-width:276px;--bs-popover-font-size:0.875rem;--bs-popover-bg:var(--bs-body-bg);--bs-popover-border-width:var(--bs-border-width);--bs-popover-border-color:var(--bs-border-color-translucent);--bs-popover-border-radius:var(--bs-border-radius-lg);--bs-popover-inner-border-radius:calc(var(--bs-border-radius-lg) - var(--bs-border-width));--bs-popover-box-shadow:var(--bs-box-shadow);--bs-popover-header-padding-x:1rem;--bs-popover-header-padding-y:0.5rem;--bs-popover-header-font-size:1rem;--bs-popover-header-color:inherit;--bs-popover-header-bg:var(--bs-secondary-bg);--bs-popover-body-padding-x:1rem;--bs-popover-body-padding-y:1rem;--bs-popover-body-color:var(--bs-body-color);--bs-popover-arrow-width:1rem;--bs-popover-arrow-height:0.5rem;--bs-popover-arrow-border:var(--bs-popover-border-color);z-index:var(--bs-popover-zindex);display:block;max-width:var(--bs-popover-max-width);font-family:var(--bs-font-sans-serif);font-style:normal;font-weight:400;line-height:1.5;text-align:left;text-align:start;text-decoration:none;text-shadow:none;text-transform:none;letter-spacing:normal;word-break:normal;white-space:normal;word-spacing:normal;line-break:auto;font-size:var(--bs-popover-font-size);word-wrap:break-word;background-color:var(--bs-popover-bg);background-clip:padding-box;border:var(--bs-popover-border-width) solid var(--bs-popover-border-color);border-radius:var(--bs-popover-border-radius)}.popover .popover-arrow{display:block;width:var(--bs-popover-arrow-width);height:var(--bs-popover-arrow-height)}.popover .popover-arrow::after,.popover .popover-arrow::before{position:absolute;display:block;content:"";border-color:transparent;border-style:solid;border-width:0}.bs-popover-auto[data-popper-placement^=top]>.popover-arrow,.bs-popover-top>.popover-arrow{bottom:calc(-1 * (var(--bs-popover-arrow-height)) - var(--bs-popover-border-width))}.bs-popover-auto[data-popper-placement^=top]>.popover-arrow::after,.bs-popover-auto[data-popper-placement^=top]>.popover-arrow::before,.bs-popover-top>.popover-arrow::after,.bs-popover-top>.popover-arrow::before{border-width:var(--bs-popover-arrow-height) calc(var(--bs-popover-arrow-width) * .5) 0}.bs-popover-auto[data-popper-placement^=top]>.popover-arrow::before,.bs-popover-top>.popover-arrow::before{bottom:0;border-top-color:var(--bs-popover-arrow-border)}.bs-popover-auto[data-popper-placement^=top]>.popover-arrow::after,.bs-popover-top>.popover-arrow::after{bottom:var(--bs-popover-border-width);border-top-color:var(--bs-popover-bg)}.bs-popover-auto[data-popper-placement^=right]>.popover-arrow,.bs-popover-end>.popover-arrow{left:calc(-1 * (var(--bs-popover-arrow-height)) - var(--bs-popover-border-width));width:var(--bs-popover-arrow-height);height:var(--bs-popover-arrow-width)}.bs-popover-auto[data-popper-placement^=right]>.popover-arrow::after,.bs-popover-auto[data-popper-placement^=right]>.popover-arrow::before,.bs-popover-end>.popover-arrow::after,.bs-popover-end>.popover-arrow::before{border-width:calc(var(--bs-popover-arrow-width) * .5) var(--bs-popover-arrow-height) calc(var(--bs-popover-arrow-width) * .5) 0}.bs-popover-auto[data-popper-placement^=right]>.popover-arrow::before,.bs-popover-end>.popover-arrow::before{left:0;border-right-color:var(--bs-popover-arrow-border)}.bs-popover-auto[data-popper-placement^=right]>.popover-arrow::after,.bs-popover-end>.popover-arrow::after{left:var(--bs-popover-border-width);border-right-color:var(--bs-popover-bg)}.bs-popover-auto[data-popper-placement^=bottom]>.popover-arrow,.bs-popover-bottom>.popover-arrow{top:calc(-1 * (var(--bs-popover-arrow-height)) - var(--bs-popover-border-width))}.bs-popover-auto[data-popper-placement^=bottom]>.popover-arrow::after,.bs-popover-auto[data-popper-placement^=bottom]>.popover-arrow::before,.bs-popover-bottom>.popover-arrow::after,.bs-popover-bottom>.popover-arrow::before{border-width:0 calc(var(--bs-popover-arrow-width) * .5) var(--bs-popover-arrow-height)}.bs-popover-auto[data-popper-placement^=bottom]>.popover-arrow::before,.bs-popover-bottom>.popover-arrow::before{top:0;border-bottom-color:var(--bs-popover-arrow-border)}.bs-popover-auto[data-popper-placement^=bottom]>.popover-arrow::after,.bs-popover-bottom>.popover-arrow::after{top:var(--bs-popover-border-width);border-bottom-color:var(--bs-popover-bg)}.bs-popover-auto[data-popper-placement^=bottom] .popover-header::before,.bs-popover-bottom .popover-header::before{position:absolute;top:0;left:50%;display:block;width:var(--bs-popover-arrow-width);margin-left:calc(-.5 * var(--bs-popover-arrow-width));content:"";border-bottom:var(--bs-popover-border-width) solid var(--bs-popover-header-bg)}.bs-popover-auto[data-popper-placement^=left]>.popover-arrow,.bs-popover-start>.popover-arrow{right:calc(-1 * (var(--bs-popover-arrow-height)) - var(--bs-popover-border-width));width:var(--bs-popover-arrow-height);height:var(--bs-popover-arrow-width)}.bs-popover-auto[data-popper-placement^=left]>.popover-arrow::after,.bs-popover-auto[data-popper-placement^=left]>.popover-arrow::before,.bs-popover-start>.popover-arrow::after,.bs-popover-start>.popover-arrow::before{border-width:calc(var(--bs-popover-arrow-width) * .5) 0 calc(var(--bs-popover-arrow-width) * .5) var(--bs-popover-arrow-height)}.bs-popover-auto[data-popper-placement^=left]>.popover-arrow::before,.bs-popover-start>.popover-arrow::before{right:0;border-left-color:var(--bs-popover-arrow-border)}.bs-popover-auto[data-popper-placement^=left]>.popover-arrow::after,.bs-popover-start>.popover-arrow::after{right:var(--bs-popover-border-width);border-left-color:var(--bs-popover-bg)}.popover-header{padding:var(--bs-popover-header-padding-y) var(--bs-popover-header-padding-x);margin-bottom:0;font-size:var(--bs-popover-header-font-size);color:var(--bs-popover-header-color);background-color:var(--bs-popover-header-bg);border-bottom:var(--bs-popover-border-width) solid var(--bs-popover-border-color);border-top-left-radius:var(--bs-popover-inner-border-radius);border-top-right-radius:var(--bs-popover-inner-border-radius)}.popover-header:empty{display:none}.popover-body{padding:var(--bs-popover-body-padding-y) var(--bs-popover-body-padding-x);color:var(--bs-popover-body-color)}.carousel{position:relative}.carousel.pointer-event{touch-action:pan-y}.carousel-inner{position:relative;width:100%;overflow:hidden}.carousel-inner::after{display:block;clear:both;content:""}.carousel-item{position:relative;display:none;float:left;width:100%;margin-right:-100%;-webkit-backface-visibility:hidden;backface-visibility:hidden;transition:transform .6s ease-in-out}@media (prefers-reduced-motion:reduce){.carousel-item{transition:none}}.carousel-item-next,.carousel-item-prev,.carousel-item.active{display:block}.active.carousel-item-end,.carousel-item-next:not(.carousel-item-start){transform:translateX(100%)}.active.carousel-item-start,.carousel-item-prev:not(.carousel-item-end){transform:translateX(-100%)}.carousel-fade .carousel-item{opacity:0;transition-property:opacity;transform:none}.carousel-fade .carousel-item-next.carousel-item-start,.carousel-fade .carousel-item-prev.carousel-item-end,.carousel-fade .carousel-item.active{z-index:1;opacity:1}.carousel-fade .active.carousel-item-end,.carousel-fade .active.carousel-item-start{z-index:0;opacity:0;transition:opacity 0s .6s}@media (prefers-reduced-motion:reduce){.carousel-fade .active.carousel-item-end,.carousel-fade .active.carousel-item-start{transition:none}}.carousel-control-next,.carousel-control-prev{position:absolute;top:0;bottom:0;z-index:1;display:flex;align-items:center;justify-content:center;width:15%;padding:0;color:#fff;text-align:center;background:0 0;border:0;opacity:.5;transition:opacity .15s ease}@media (prefers-reduced-motion:reduce){.carousel-control-next,.carousel-control-prev{transition:none}}.carousel-control-next:focus,.carousel-control-next:hover,.carousel-control-prev:focus,.carousel-control-prev:hover{color:#fff;text-decoration:none;outline:0;opacity:.9}.carousel-control-prev{left:0}.carousel-control-next{right:0}.carousel-control-next-icon,.carousel-control-prev-icon{display:inline-block;width:2rem;height:2rem;background-repeat:no-repeat;background-position:50%;background-size:100% 100%}.carousel-control-prev-icon{background-image:url(${q})}.carousel-control-next-icon{background-image:url(${G})}.carousel-indicators{position:absolute;right:0;bottom:0;left:0;z-index:2;display:flex;justify-content:center;padding:0;margin-right:15%;margin-bottom:1rem;margin-left:15%}.carousel-indicators [data-bs-target]{box-sizing:content-box;flex:0 1 auto;width:30px;height:3px;padding:0;margin-right:3px;margin-left:3px;text-indent:-999px;cursor:pointer;background-color:#fff;background-clip:padding-box;border:0;border-top:10px solid transparent;border-bottom:10px solid transparent;opacity:.5;transition:opacity .6s ease}@media (prefers-reduced-motion:reduce){.carousel-indicators [data-bs-target]{transition:none}}.carousel-indicators .active{opacity:1}.carousel-caption{position:absolute;right:15%;bottom:1.25rem;left:15%;padding-top:1.25rem;padding-bottom:1.25rem;color:#fff;text-align:center}.carousel-dark .carousel-control-next-icon,.carousel-dark .carousel-control-prev-icon{filter:invert(1) grayscale(100)}.carousel-dark .carousel-indicators [data-bs-target]{background-color:#000}.carousel-dark .carousel-caption{color:#000}[data-bs-theme=dark] .carousel .carousel-control-next-icon,[data-bs-theme=dark] .carousel .carousel-control-prev-icon,[data-bs-theme=dark].carousel .carousel-control-next-icon,[data-bs-theme=dark].carousel .carousel-control-prev-icon{filter:invert(1) grayscale(100)}[data-bs-theme=dark] .carousel .carousel-indicators [data-bs-target],[data-bs-theme=dark].carousel .carousel-indicators [data-bs-target]{background-color:#000}[data-bs-theme=dark] .carousel .carousel-caption,[data-bs-theme=dark].carousel .carousel-caption{color:#000}.spinner-border,.spinner-grow{display:inline-block;width:var(--bs-spinner-width);height:var(--bs-spinner-height);vertical-align:var(--bs-spinner-vertical-align);border-radius:50%;animation:var(--bs-spinner-animation-speed) linear infinite var(--bs-spinner-animation-name)}@keyframes spinner-border{to{transform:rotate(360deg)}}.spinner-border{--bs-spinner-width:2rem;--bs-spinner-height:2rem;--bs-spinner-vertical-align:-0.125em;--bs-spinner-border-width:0.25em;--bs-spinner-animation-speed:0.75s;--bs-spinner-animation-name:spinner-border;border:var(--bs-spinner-border-width) solid currentcolor;border-right-color:transparent}.spinner-border-sm{--bs-spinner-width:1rem;--bs-spinner-height:1rem;--bs-spinner-border-width:0.2em}@keyframes spinner-grow{0%{transform:scale(0)}50%{opacity:1;transform:none}}.spinner-grow{--bs-spinner-width:2rem;--bs-spinner-height:2rem;--bs-spinner-vertical-align:-0.125em;--bs-spinner-animation-speed:0.75s;--bs-spinner-animation-name:spinner-grow;background-color:currentcolor;opacity:0}.spinner-grow-sm{--bs-spinner-width:1rem;--bs-spinner-height:1rem}@media (prefers-reduced-motion:reduce){.spinner-border,.spinner-grow{--bs-spinner-animation-speed:1.5s}}.offcanvas,.offcanvas-lg,.offcanvas-md,.offcanvas-sm,.offcanvas-xl,.offcanvas-xxl{--bs-offcanvas-zindex:1045;--bs-offcanvas-width:400px;--bs-offcanvas-height:30vh;--bs-offcanvas-padding-x:1rem;--bs-offcanvas-padding-y:1rem;--bs-offcanvas-color:var(--bs-body-color);--bs-offcanvas-bg:var(--bs-body-bg);--bs-offcanvas-border-width:var(--bs-border-width);--bs-offcanvas-border-color:var(--bs-border-color-translucent);--bs-offcanvas-box-shadow:var(--bs-box-shadow-sm);--bs-offcanvas-transition:transform 0.3s ease-in-out;--bs-offcanvas-title-line-height:1.5}@media (max-width:575.98px){.offcanvas-sm{position:fixed;bottom:0;z-index:var(--bs-offcanvas-zindex);display:flex;flex-direction:column;max-width:100%;color:var(--bs-offcanvas-color);visibility:hidden;background-color:var(--bs-offcanvas-bg);background-clip:padding-box;outline:0;transition:var(--bs-offcanvas-transition)}}@media (max-width:575.98px) and (prefers-reduced-motion:reduce){.offcanvas-sm{transition:none}}@media (max-width:575.98px){.offcanvas-sm.offcanvas-start{top:0;left:0;width:var(--bs-offcanvas-width);border-right:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(-100%)}.offcanvas-sm.offcanvas-end{top:0;right:0;width:var(--bs-offcanvas-width);border-left:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(100%)}.offcanvas-sm.offcanvas-top{top:0;right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-bottom:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(-100%)}.offcanvas-sm.offcanvas-bottom{right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-top:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(100%)}.offcanvas-sm.show:not(.hiding),.offcanvas-sm.showing{transform:none}.offcanvas-sm.hiding,.offcanvas-sm.show,.offcanvas-sm.showing{visibility:visible}}@media (min-width:576px){.offcanvas-sm{--bs-offcanvas-height:auto;--bs-offcanvas-border-width:0;background-color:transparent!important}.offcanvas-sm .offcanvas-header{display:none}.offcanvas-sm .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible;background-color:transparent!important}}@media (max-width:767.98px){.offcanvas-md{position:fixed;bottom:0;z-index:var(--bs-offcanvas-zindex);display:flex;flex-direction:column;max-width:100%;color:var(--bs-offcanvas-color);visibility:hidden;background-color:var(--bs-offcanvas-bg);background-clip:padding-box;outline:0;transition:var(--bs-offcanvas-transition)}}@media (max-width:767.98px) and (prefers-reduced-motion:reduce){.offcanvas-md{transition:none}}@media (max-width:767.98px){.offcanvas-md.offcanvas-start{top:0;left:0;width:var(--bs-offcanvas-width);border-right:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(-100%)}.offcanvas-md.offcanvas-end{top:0;right:0;width:var(--bs-offcanvas-width);border-left:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(100%)}.offcanvas-md.offcanvas-top{top:0;right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-bottom:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(-100%)}.offcanvas-md.offcanvas-bottom{right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-top:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(100%)}.offcanvas-md.show:not(.hiding),.offcanvas-md.showing{transform:none}.offcanvas-md.hiding,.offcanvas-md.show,.offcanvas-md.showing{visibility:visible}}@media (min-width:768px){.offcanvas-md{--bs-offcanvas-height:auto;--bs-offcanvas-border-width:0;background-color:transparent!important}.offcanvas-md .offcanvas-header{display:none}.offcanvas-md .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible;background-color:transparent!important}}@media (max-width:991.98px){.offcanvas-lg{position:fixed;bottom:0;z-index:var(--bs-offcanvas-zindex);display:flex;flex-direction:column;max-width:100%;color:var(--bs-offcanvas-color);visibility:hidden;background-color:var(--bs-offcanvas-bg);background-clip:padding-box;outline:0;transition:var(--bs-offcanvas-transition)}}@media (max-width:991.98px) and (prefers-reduced-motion:reduce){.offcanvas-lg{transition:none}}@media (max-width:991.98px){.offcanvas-lg.offcanvas-start{top:0;left:0;width:var(--bs-offcanvas-width);border-right:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(-100%)}.offcanvas-lg.offcanvas-end{top:0;right:0;width:var(--bs-offcanvas-width);border-left:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(100%)}.offcanvas-lg.offcanvas-top{top:0;right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-bottom:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(-100%)}.offcanvas-lg.offcanvas-bottom{right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-top:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(100%)}.offcanvas-lg.show:not(.hiding),.offcanvas-lg.showing{transform:none}.offcanvas-lg.hiding,.offcanvas-lg.show,.offcanvas-lg.showing{visibility:visible}}@media (min-width:992px){.offcanvas-lg{--bs-offcanvas-height:auto;--bs-offcanvas-border-width:0;background-color:transparent!important}.offcanvas-lg .offcanvas-header{display:none}.offcanvas-lg .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible;background-color:transparent!important}}@media (max-width:1199.98px){.offcanvas-xl{position:fixed;bottom:0;z-index:var(--bs-offcanvas-zindex);display:flex;flex-direction:column;max-width:100%;color:var(--bs-offcanvas-color);visibility:hidden;background-color:var(--bs-offcanvas-bg);background-clip:padding-box;outline:0;transition:var(--bs-offcanvas-transition)}}@media (max-width:1199.98px) and (prefers-reduced-motion:reduce){.offcanvas-xl{transition:none}}@media (max-width:1199.98px){.offcanvas-xl.offcanvas-start{top:0;left:0;width:var(--bs-offcanvas-width);border-right:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(-100%)}.offcanvas-xl.offcanvas-end{top:0;right:0;width:var(--bs-offcanvas-width);border-left:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(100%)}.offcanvas-xl.offcanvas-top{top:0;right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-bottom:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(-100%)}.offcanvas-xl.offcanvas-bottom{right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-top:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(100%)}.offcanvas-xl.show:not(.hiding),.offcanvas-xl.showing{transform:none}.offcanvas-xl.hiding,.offcanvas-xl.show,.offcanvas-xl.showing{visibility:visible}}@media (min-width:1200px){.offcanvas-xl{--bs-offcanvas-height:auto;--bs-offcanvas-border-width:0;background-color:transparent!important}.offcanvas-xl .offcanvas-header{display:none}.offcanvas-xl .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible;background-color:transparent!important}}@media (max-width:1399.98px){.offcanvas-xxl{position:fixed;bottom:0;z-index:var(--bs-offcanvas-zindex);display:flex;flex-direction:column;max-width:100%;color:var(--bs-offcanvas-color);visibility:hidden;background-color:var(--bs-offcanvas-bg);background-clip:padding-box;outline:0;transition:var(--bs-offcanvas-transition)}}@media (max-width:1399.98px) and (prefers-reduced-motion:reduce){.offcanvas-xxl{transition:none}}@media (max-width:1399.98px){.offcanvas-xxl.offcanvas-start{top:0;left:0;width:var(--bs-offcanvas-width);border-right:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(-100%)}.offcanvas-xxl.offcanvas-end{top:0;right:0;width:var(--bs-offcanvas-width);border-left:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(100%)}.offcanvas-xxl.offcanvas-top{top:0;right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-bottom:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(-100%)}.offcanvas-xxl.offcanvas-bottom{right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-top:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(100%)}.offcanvas-xxl.show:not(.hiding),.offcanvas-xxl.showing{transform:none}.offcanvas-xxl.hiding,.offcanvas-xxl.show,.offcanvas-xxl.showing{visibility:visible}}@media (min-width:1400px){.offcanvas-xxl{--bs-offcanvas-height:auto;--bs-offcanvas-border-width:0;background-color:transparent!important}.offcanvas-xxl .offcanvas-header{display:none}.offcanvas-xxl .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible;background-color:transparent!important}}.offcanvas{position:fixed;bottom:0;z-index:var(--bs-offcanvas-zindex);display:flex;flex-direction:column;max-width:100%;color:var(--bs-offcanvas-color);visibility:hidden;background-color:var(--bs-offcanvas-bg);background-clip:padding-box;outline:0;transition:var(--bs-offcanvas-transition)}@media (prefers-reduced-motion:reduce){.offcanvas{transition:none}}.offcanvas.offcanvas-start{top:0;left:0;width:var(--bs-offcanvas-width);border-right:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(-100%)}.offcanvas.offcanvas-end{top:0;right:0;width:var(--bs-offcanvas-width);border-left:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(100%)}.offcanvas.offcanvas-top{top:0;right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-bottom:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(-100%)}.offcanvas.offcanvas-bottom{right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-top:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(100%)}.offcanvas.show:not(.hiding),.offcanvas.showing{transform:none}.offcanvas.hiding,.offcanvas.show,.offcanvas.showing{visibility:visible}.offcanvas-backdrop{position:fixed;top:0;left:0;z-index:1040;width:100vw;height:100vh;background-color:#000}.offcanvas-backdrop.fade{opacity:0}.offcanvas-backdrop.show{opacity:.5}.offcanvas-header{display:flex;align-items:center;padding:var(--bs-offcanvas-padding-y) var(--bs-offcanvas-padding-x)}.offcanvas-header .btn-close{padding:calc(var(--bs-offcanvas-padding-y) * .5) calc(var(--bs-offcanvas-padding-x) * .5);margin:calc(-.5 * var(--bs-offcanvas-padding-y)) calc(-.5 * var(--bs-offcanvas-padding-x)) calc(-.5 * var(--bs-offcanvas-padding-y)) auto}.offcanvas-title{margin-bottom:0;line-height:var(--bs-offcanvas-title-line-height)}.offcanvas-body{flex-grow:1;padding:var(--bs-offcanvas-padding-y) var(--bs-offcanvas-padding-x);overflow-y:auto}.placeholder{display:inline-block;min-height:1em;vertical-align:middle;cursor:wait;background-color:currentcolor;opacity:.5}.placeholder.btn::before{display:inline-block;content:""}.placeholder-xs{min-height:.6em}.placeholder-sm{min-height:.8em}.placeholder-lg{min-height:1.2em}.placeholder-glow .placeholder{animation:placeholder-glow 2s ease-in-out infinite}@keyframes placeholder-glow{50%{opacity:.2}}.placeholder-wave{-webkit-mask-image:linear-gradient(130deg,#000 55%,rgba(0,0,0,0.8) 75%,#000 95%);mask-image:linear-gradient(130deg,#000 55%,rgba(0,0,0,0.8) 75%,#000 95%);-webkit-mask-size:200% 100%;mask-size:200% 100%;animation:placeholder-wave 2s linear infinite}@keyframes placeholder-wave{100%{-webkit-mask-position:-200% 0%;mask-position:-200% 0%}}.clearfix::after{display:block;clear:both;content:""}.text-bg-primary{color:#fff!important;background-color:RGBA(var(--bs-primary-rgb),var(--bs-bg-opacity,1))!important}.text-bg-secondary{color:#fff!important;background-color:RGBA(var(--bs-secondary-rgb),var(--bs-bg-opacity,1))!important}.text-bg-success{color:#fff!important;background-color:RGBA(var(--bs-success-rgb),var(--bs-bg-opacity,1))!important}.text-bg-info{color:#000!important;background-color:RGBA(var(--bs-info-rgb),var(--bs-bg-opacity,1))!important}.text-bg-warning{color:#000!important;background-color:RGBA(var(--bs-warning-rgb),var(--bs-bg-opacity,1))!important}.text-bg-danger{color:#fff!important;background-color:RGBA(var(--bs-danger-rgb),var(--bs-bg-opacity,1))!important}.text-bg-light{color:#000!important;background-color:RGBA(var(--bs-light-rgb),var(--bs-bg-opacity,1))!important}.text-bg-dark{color:#fff!important;background-color:RGBA(var(--bs-dark-rgb),var(--bs-bg-opacity,1))!important}.link-primary{color:RGBA(var(--bs-primary-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-primary-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-primary-rgb),var(--bs-link-underline-opacity,1))!important}.link-primary:focus,.link-primary:hover{color:RGBA(10,88,202,var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(10,88,202,var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(10,88,202,var(--bs-link-underline-opacity,1))!important}.link-secondary{color:RGBA(var(--bs-secondary-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-secondary-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-secondary-rgb),var(--bs-link-underline-opacity,1))!important}.link-secondary:focus,.link-secondary:hover{color:RGBA(86,94,100,var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(86,94,100,var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(86,94,100,var(--bs-link-underline-opacity,1))!important}.link-success{color:RGBA(var(--bs-success-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-success-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-success-rgb),var(--bs-link-underline-opacity,1))!important}.link-success:focus,.link-success:hover{color:RGBA(20,108,67,var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(20,108,67,var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(20,108,67,var(--bs-link-underline-opacity,1))!important}.link-info{color:RGBA(var(--bs-info-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-info-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-info-rgb),var(--bs-link-underline-opacity,1))!important}.link-info:focus,.link-info:hover{color:RGBA(61,213,243,var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(61,213,243,var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(61,213,243,var(--bs-link-underline-opacity,1))!important}.link-warning{color:RGBA(var(--bs-warning-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-warning-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-warning-rgb),var(--bs-link-underline-opacity,1))!important}.link-warning:focus,.link-warning:hover{color:RGBA(255,205,57,var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(255,205,57,var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(255,205,57,var(--bs-link-underline-opacity,1))!important}.link-danger{color:RGBA(var(--bs-danger-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-danger-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-danger-rgb),var(--bs-link-underline-opacity,1))!important}.link-danger:focus,.link-danger:hover{color:RGBA(176,42,55,var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(176,42,55,var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(176,42,55,var(--bs-link-underline-opacity,1))!important}.link-light{color:RGBA(var(--bs-light-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-light-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-light-rgb),var(--bs-link-underline-opacity,1))!important}.link-light:focus,.link-light:hover{color:RGBA(249,250,251,var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(249,250,251,var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(249,250,251,var(--bs-link-underline-opacity,1))!important}.link-dark{color:RGBA(var(--bs-dark-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-dark-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-dark-rgb),var(--bs-link-underline-opacity,1))!important}.link-dark:focus,.link-dark:hover{color:RGBA(26,30,33,var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(26,30,33,var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(26,30,33,var(--bs-link-underline-opacity,1))!important}.link-body-emphasis{color:RGBA(var(--bs-emphasis-color-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-emphasis-color-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-emphasis-color-rgb),var(--bs-link-underline-opacity,1))!important}.link-body-emphasis:focus,.link-body-emphasis:hover{color:RGBA(var(--bs-emphasis-color-rgb),var(--bs-link-opacity,.75))!important;-webkit-text-decoration-color:RGBA(var(--bs-emphasis-color-rgb),var(--bs-link-underline-opacity,0.75))!important;text-decoration-color:RGBA(var(--bs-emphasis-color-rgb),var(--bs-link-underline-opacity,0.75))!important}.focus-ring:focus{outline:0;box-shadow:var(--bs-focus-ring-x,0) var(--bs-focus-ring-y,0) var(--bs-focus-ring-blur,0) var(--bs-focus-ring-width) var(--bs-focus-ring-color)}.icon-link{display:inline-flex;gap:.375rem;align-items:center;-webkit-text-decoration-color:rgba(var(--bs-link-color-rgb),var(--bs-link-opacity,0.5));text-decoration-color:rgba(var(--bs-link-color-rgb),var(--bs-link-opacity,0.5));text-underline-offset:0.25em;-webkit-backface-visibility:hidden;backface-visibility:hidden}.icon-link>.bi{flex-shrink:0;width:1em;height:1em;fill:currentcolor;transition:.2s ease-in-out transform}@media (prefers-reduced-motion:reduce){.icon-link>.bi{transition:none}}.icon-link-hover:focus-visible>.bi,.icon-link-hover:hover>.bi{transform:var(--bs-icon-link-transform,translate3d(.25em,0,0))}.ratio{position:relative;width:100%}.ratio::before{display:block;padding-top:var(--bs-aspect-ratio);content:""}.ratio>*{position:absolute;top:0;left:0;width:100%;height:100%}.ratio-1x1{--bs-aspect-ratio:100%}.ratio-4x3{--bs-aspect-ratio:75%}.ratio-16x9{--bs-aspect-ratio:56.25%}.ratio-21x9{--bs-aspect-ratio:42.8571428571%}.fixed-top{position:fixed;top:0;right:0;left:0;z-index:1030}.fixed-bottom{position:fixed;right:0;bottom:0;left:0;z-index:1030}.sticky-top{position:-webkit-sticky;position:sticky;top:0;z-index:1020}.sticky-bottom{position:-webkit-sticky;position:sticky;bottom:0;z-index:1020}@media (min-width:576px){.sticky-sm-top{position:-webkit-sticky;position:sticky;top:0;z-index:1020}.sticky-sm-bottom{position:-webkit-sticky;position:sticky;bottom:0;z-index:1020}}@media (min-width:768px){.sticky-md-top{position:-webkit-sticky;position:sticky;top:0;z-index:1020}.sticky-md-bottom{position:-webkit-sticky;position:sticky;bottom:0;z-index:1020}}@media (min-width:992px){.sticky-lg-top{position:-webkit-sticky;position:sticky;top:0;z-index:1020}.sticky-lg-bottom{position:-webkit-sticky;position:sticky;bottom:0;z-index:1020}}@media (min-width:1200px){.sticky-xl-top{position:-webkit-sticky;position:sticky;top:0;z-index:1020}.sticky-xl-bottom{position:-webkit-sticky;position:sticky;bottom:0;z-index:1020}}@media (min-width:1400px){.sticky-xxl-top{position:-webkit-sticky;position:sticky;top:0;z-index:1020}.sticky-xxl-bottom{position:-webkit-sticky;position:sticky;bottom:0;z-index:1020}}.hstack{display:flex;flex-direction:row;align-items:center;align-self:stretch}.vstack{display:flex;flex:1 1 auto;flex-direction:column;align-self:stretch}.visually-hidden,.visually-hidden-focusable:not(:focus):not(:focus-within){width:1px!important;height:1px!important;padding:0!important;margin:-1px!important;overflow:hidden!important;clip:rect(0,0,0,0)!important;white-space:nowrap!important;border:0!important}.visually-hidden-focusable:not(:focus):not(:focus-within):not(caption),.visually-hidden:not(caption){position:absolute!important}.stretched-link::after{position:absolute;top:0;right:0;bottom:0;left:0;z-index:1;content:""}.text-truncate{overflow:hidden;text-overflow:ellipsis;white-space:nowrap}.vr{display:inline-block;align-self:stretch;width:var(--bs-border-width);min-height:1em;background-color:currentcolor;opacity:.25}.align-baseline{vertical-align:baseline!important}.align-top{vertical-align:top!important}.align-middle{vertical-align:middle!important}.align-bottom{vertical-align:bottom!important}.align-text-bottom{vertical-align:text-bottom!important}.align-text-top{vertical-align:text-top!important}.float-start{float:left!important}.float-end{float:right!important}.float-none{float:none!important}.object-fit-contain{-o-object-fit:contain!important;object-fit:contain!important}.object-fit-cover{-o-object-fit:cover!important;object-fit:cover!important}.object-fit-fill{-o-object-fit:fill!important;object-fit:fill!important}.object-fit-scale{-o-object-fit:scale-down!important;object-fit:scale-down!important}.object-fit-none{-o-object-fit:none!important;object-fit:none!important}.opacity-0{opacity:0!important}.opacity-25{opacity:.25!important}.opacity-50{opacity:.5!important}.opacity-75{opacity:.75!important}.opacity-100{opacity:1!important}.overflow-auto{overflow:auto!important}.overflow-hidden{overflow:hidden!important}.overflow-visible{overflow:visible!important}.overflow-scroll{overflow:scroll!important}.overflow-x-auto{overflow-x:auto!important}.overflow-x-hidden{overflow-x:hidden!important}.overflow-x-visible{overflow-x:visible!important}.overflow-x-scroll{overflow-x:scroll!important}.overflow-y-auto{overflow-y:auto!important}.overflow-y-hidden{overflow-y:hidden!important}.overflow-y-visible{overflow-y:visible!important}.overflow-y-scroll{overflow-y:scroll!important}.d-inline{display:inline!important}.d-inline-block{display:inline-block!important}.d-block{display:block!important}.d-grid{display:grid!important}.d-inline-grid{display:inline-grid!important}.d-table{display:table!important}.d-table-row{display:table-row!important}.d-table-cell{display:table-cell!important}.d-flex{display:flex!important}.d-inline-flex{display:inline-flex!important}.d-none{display:none!important}.shadow{box-shadow:var(--bs-box-shadow)!important}.shadow-sm{box-shadow:var(--bs-box-shadow-sm)!important}.shadow-lg{box-shadow:var(--bs-box-shadow-lg)!important}.shadow-none{box-shadow:none!important}.focus-ring-primary{--bs-focus-ring-color:rgba(var(--bs-primary-rgb), var(--bs-focus-ring-opacity))}.focus-ring-secondary{--bs-focus-ring-color:rgba(var(--bs-secondary-rgb), var(--bs-focus-ring-opacity))}.focus-ring-success{--bs-focus-ring-color:rgba(var(--bs-success-rgb), var(--bs-focus-ring-opacity))}.focus-ring-info{--bs-focus-ring-color:rgba(var(--bs-info-rgb), var(--bs-focus-ring-opacity))}.focus-ring-warning{--bs-focus-ring-color:rgba(var(--bs-warning-rgb), var(--bs-focus-ring-opacity))}.focus-ring-danger{--bs-focus-ring-color:rgba(var(--bs-danger-rgb), var(--bs-focus-ring-opacity))}.focus-ring-light{--bs-focus-ring-color:rgba(var(--bs-light-rgb), var(--bs-focus-ring-opacity))}.focus-ring-dark{--bs-focus-ring-color:rgba(var(--bs-dark-rgb), var(--bs-focus-ring-opacity))}.position-static{position:static!important}.position-relative{position:relative!important}.position-absolute{position:absolute!important}.position-fixed{position:fixed!important}.position-sticky{position:-webkit-sticky!important;position:sticky!important}.top-0{top:0!important}.top-50{top:50%!important}.top-100{top:100%!important}.bottom-0{bottom:0!important}.bottom-50{bottom:50%!important}.bottom-100{bottom:100%!important}.start-0{left:0!important}.start-50{left:50%!important}.start-100{left:100%!important}.end-0{right:0!important}.end-50{right:50%!important}.end-100{right:100%!important}.translate-middle{transform:translate(-50%,-50%)!important}.translate-middle-x{transform:translateX(-50%)!important}.translate-middle-y{transform:translateY(-50%)!important}.border{border:var(--bs-border-width) var(--bs-border-style) var(--bs-border-color)!important}.border-0{border:0!important}.border-top{border-top:var(--bs-border-width) var(--bs-border-style) var(--bs-border-color)!important}.border-top-0{border-top:0!important}.border-end{border-right:var(--bs-border-width) var(--bs-border-style) var(--bs-border-color)!important}.border-end-0{border-right:0!important}.border-bottom{border-bottom:var(--bs-border-width) var(--bs-border-style) var(--bs-border-color)!important}.border-bottom-0{border-bottom:0!important}.border-start{border-left:var(--bs-border-width) var(--bs-border-style) var(--bs-border-color)!important}.border-start-0{border-left:0!important}.border-primary{--bs-border-opacity:1;border-color:rgba(var(--bs-primary-rgb),var(--bs-border-opacity))!important}.border-secondary{--bs-border-opacity:1;border-color:rgba(var(--bs-secondary-rgb),var(--bs-border-opacity))!important}.border-success{--bs-border-opacity:1;border-color:rgba(var(--bs-success-rgb),var(--bs-border-opacity))!important}.border-info{--bs-border-opacity:1;border-color:rgba(var(--bs-info-rgb),var(--bs-border-opacity))!important}.border-warning{--bs-border-opacity:1;border-color:rgba(var(--bs-warning-rgb),var(--bs-border-opacity))!important}.border-danger{--bs-border-opacity:1;border-color:rgba(var(--bs-danger-rgb),var(--bs-border-opacity))!important}.border-light{--bs-border-opacity:1;border-color:rgba(var(--bs-light-rgb),var(--bs-border-opacity))!important}.border-dark{--bs-border-opacity:1;border-color:rgba(var(--bs-dark-rgb),var(--bs-border-opacity))!important}.border-black{--bs-border-opacity:1;border-color:rgba(var(--bs-black-rgb),var(--bs-border-opacity))!important}.border-white{--bs-border-opacity:1;border-color:rgba(var(--bs-white-rgb),var(--bs-border-opacity))!important}.border-primary-subtle{border-color:var(--bs-primary-border-subtle)!important}.border-secondary-subtle{border-color:var(--bs-secondary-border-subtle)!important}.border-success-subtle{border-color:var(--bs-success-border-subtle)!important}.border-info-subtle{border-color:var(--bs-info-border-subtle)!important}.border-warning-subtle{border-color:var(--bs-warning-border-subtle)!important}.border-danger-subtle{border-color:var(--bs-danger-border-subtle)!important}.border-light-subtle{border-color:var(--bs-light-border-subtle)!important}.border-dark-subtle{border-color:var(--bs-dark-border-subtle)!important}.border-1{border-width:1px!important}.border-2{border-width:2px!important}.border-3{border-width:3px!important}.border-4{border-width:4px!important}.border-5{border-width:5px!important}.border-opacity-10{--bs-border-opacity:0.1}.border-opacity-25{--bs-border-opacity:0.25}.border-opacity-50{--bs-border-opacity:0.5}.border-opacity-75{--bs-border-opacity:0.75}.border-opacity-100{--bs-border-opacity:1}.w-25{width:25%!important}.w-50{width:50%!important}.w-75{width:75%!important}.w-100{width:100%!important}.w-auto{width:auto!important}.mw-100{max-width:100%!important}.vw-100{width:100vw!important}.min-vw-100{min-width:100vw!important}.h-25{height:25%!important}.h-50{height:50%!important}.h-75{height:75%!important}.h-100{height:100%!important}.h-auto{height:auto!important}.mh-100{max-height:100%!important}.vh-100{height:100vh!important}.min-vh-100{min-height:100vh!important}.flex-fill{flex:1 1 auto!important}.flex-row{flex-direction:row!important}.flex-column{flex-direction:column!important}.flex-row-reverse{flex-direction:row-reverse!important}.flex-column-reverse{flex-direction:column-reverse!important}.flex-grow-0{flex-grow:0!important}.flex-grow-1{flex-grow:1!important}.flex-shrink-0{flex-shrink:0!important}.flex-shrink-1{flex-shrink:1!important}.flex-wrap{flex-wrap:wrap!important}.flex-nowrap{flex-wrap:nowrap!important}.flex-wrap-reverse{flex-wrap:wrap-reverse!important}.justify-content-start{justify-content:flex-start!important}.justify-content-end{justify-content:flex-end!important}.justify-content-center{justify-content:center!important}.justify-content-between{justify-content:space-between!important}.justify-content-around{justify-content:space-around!important}.justify-content-evenly{justify-content:space-evenly!important}.align-items-start{align-items:flex-start!important}.align-items-end{align-items:flex-end!important}.align-items-center{align-items:center!important}.align-items-baseline{align-items:baseline!important}.align-items-stretch{align-items:stretch!important}.align-content-start{align-content:flex-start!important}.align-content-end{align-content:flex-end!important}.align-content-center{align-content:center!important}.align-content-between{align-content:space-between!important}.align-content-around{align-content:space-around!important}.align-content-stretch{align-content:stretch!important}.align-self-auto{align-self:auto!important}.align-self-start{align-self:flex-start!important}.align-self-end{align-self:flex-end!important}.align-self-center{align-self:center!important}.align-self-baseline{align-self:baseline!important}.align-self-stretch{align-self:stretch!important}.order-first{order:-1!important}.order-0{order:0!important}.order-1{order:1!important}.order-2{order:2!important}.order-3{order:3!important}.order-4{order:4!important}.order-5{order:5!important}.order-last{order:6!important}.m-0{margin:0!important}.m-1{margin:.25rem!important}.m-2{margin:.5rem!important}.m-3{margin:1rem!important}.m-4{margin:1.5rem!important}.m-5{margin:3rem!important}.m-auto{margin:auto!important}.mx-0{margin-right:0!important;margin-left:0!important}.mx-1{margin-right:.25rem!important;margin-left:.25rem!important}.mx-2{margin-right:.5rem!important;margin-left:.5rem!important}.mx-3{margin-right:1rem!important;margin-left:1rem!important}.mx-4{margin-right:1.5rem!important;margin-left:1.5rem!important}.mx-5{margin-right:3rem!important;margin-left:3rem!important}.mx-auto{margin-right:auto!important;margin-left:auto!important}.my-0{margin-top:0!important;margin-bottom:0!important}.my-1{margin-top:.25rem!important;margin-bottom:.25rem!important}.my-2{margin-top:.5rem!important;margin-bottom:.5rem!important}.my-3{margin-top:1rem!important;margin-bottom:1rem!important}.my-4{margin-top:1.5rem!important;margin-bottom:1.5rem!important}.my-5{margin-top:3rem!important;margin-bottom:3rem!important}.my-auto{margin-top:auto!important;margin-bottom:auto!important}.mt-0{margin-top:0!important}.mt-1{margin-top:.25rem!important}.mt-2{margin-top:.5rem!important}.mt-3{margin-top:1rem!important}.mt-4{margin-top:1.5rem!important}.mt-5{margin-top:3rem!important}.mt-auto{margin-top:auto!important}.me-0{margin-right:0!important}.me-1{margin-right:.25rem!important}.me-2{margin-right:.5rem!important}.me-3{margin-right:1rem!important}.me-4{margin-right:1.5rem!important}.me-5{margin-right:3rem!important}.me-auto{margin-right:auto!important}.mb-0{margin-bottom:0!important}.mb-1{margin-bottom:.25rem!important}.mb-2{margin-bottom:.5rem!important}.mb-3{margin-bottom:1rem!important}.mb-4{margin-bottom:1.5rem!important}.mb-5{margin-bottom:3rem!important}.mb-auto{margin-bottom:auto!important}.ms-0{margin-left:0!important}.ms-1{margin-left:.25rem!important}.ms-2{margin-left:.5rem!important}.ms-3{margin-left:1rem!important}.ms-4{margin-left:1.5rem!important}.ms-5{margin-left:3rem!important}.ms-auto{margin-left:auto!important}.p-0{padding:0!important}.p-1{padding:.25rem!important}.p-2{padding:.5rem!important}.p-3{padding:1rem!important}.p-4{padding:1.5rem!important}.p-5{padding:3rem!important}.px-0{padding-right:0!important;padding-left:0!important}.px-1{padding-right:.25rem!important;padding-left:.25rem!important}.px-2{padding-right:.5rem!important;padding-left:.5rem!important}.px-3{padding-right:1rem!important;padding-left:1rem!important}.px-4{padding-right:1.5rem!important;padding-left:1.5rem!important}.px-5{padding-right:3rem!important;padding-left:3rem!important}.py-0{padding-top:0!important;padding-bottom:0!important}.py-1{padding-top:.25rem!important;padding-bottom:.25rem!important}.py-2{padding-top:.5rem!important;padding-bottom:.5rem!important}.py-3{padding-top:1rem!important;padding-bottom:1rem!important}.py-4{padding-top:1.5rem!important;padding-bottom:1.5rem!important}.py-5{padding-top:3rem!important;padding-bottom:3rem!important}.pt-0{padding-top:0!important}.pt-1{padding-top:.25rem!important}.pt-2{padding-top:.5rem!important}.pt-3{padding-top:1rem!important}.pt-4{padding-top:1.5rem!important}.pt-5{padding-top:3rem!important}.pe-0{padding-right:0!important}.pe-1{padding-right:.25rem!important}.pe-2{padding-right:.5rem!important}.pe-3{padding-right:1rem!important}.pe-4{padding-right:1.5rem!important}.pe-5{padding-right:3rem!important}.pb-0{padding-bottom:0!important}.pb-1{padding-bottom:.25rem!important}.pb-2{padding-bottom:.5rem!important}.pb-3{padding-bottom:1rem!important}.pb-4{padding-bottom:1.5rem!important}.pb-5{padding-bottom:3rem!important}.ps-0{padding-left:0!important}.ps-1{padding-left:.25rem!important}.ps-2{padding-left:.5rem!important}.ps-3{padding-left:1rem!important}.ps-4{padding-left:1.5rem!important}.ps-5{padding-left:3rem!important}.gap-0{gap:0!important}.gap-1{gap:.25rem!important}.gap-2{gap:.5rem!important}.gap-3{gap:1rem!important}.gap-4{gap:1.5rem!important}.gap-5{gap:3rem!important}.row-gap-0{row-gap:0!important}.row-gap-1{row-gap:.25rem!important}.row-gap-2{row-gap:.5rem!important}.row-gap-3{row-gap:1rem!important}.row-gap-4{row-gap:1.5rem!important}.row-gap-5{row-gap:3rem!important}.column-gap-0{-moz-column-gap:0!important;column-gap:0!important}.column-gap-1{-moz-column-gap:0.25rem!important;column-gap:.25rem!important}.column-gap-2{-moz-column-gap:0.5rem!important;column-gap:.5rem!important}.column-gap-3{-moz-column-gap:1rem!important;column-gap:1rem!important}.column-gap-4{-moz-column-gap:1.5rem!important;column-gap:1.5rem!important}.column-gap-5{-moz-column-gap:3rem!important;column-gap:3rem!important}.font-monospace{font-family:var(--bs-font-monospace)!important}.fs-1{font-size:calc(1.375rem + 1.5vw)!important}.fs-2{font-size:calc(1.325rem + .9vw)!important}.fs-3{font-size:calc(1.3rem + .6vw)!important}.fs-4{font-size:calc(1.275rem + .3vw)!important}.fs-5{font-size:1.25rem!important}.fs-6{font-size:1rem!important}.fst-italic{font-style:italic!important}.fst-normal{font-style:normal!important}.fw-lighter{font-weight:lighter!important}.fw-light{font-weight:300!important}.fw-normal{font-weight:400!important}.fw-medium{font-weight:500!important}.fw-semibold{font-weight:600!important}.fw-bold{font-weight:700!important}.fw-bolder{font-weight:bolder!important}.lh-1{line-height:1!important}.lh-sm{line-height:1.25!important}.lh-base{line-height:1.5!important}.lh-lg{line-height:2!important}.text-start{text-align:left!important}.text-end{text-align:right!important}.text-center{text-align:center!important}.text-decoration-none{text-decoration:none!important}.text-decoration-underline{text-decoration:underline!important}.text-decoration-line-through{text-decoration:line-through!important}.text-lowercase{text-transform:lowercase!important}.text-uppercase{text-transform:uppercase!important}.text-capitalize{text-transform:capitalize!important}.text-wrap{white-space:normal!important}.text-nowrap{white-space:nowrap!important}.text-break{word-wrap:break-word!important;word-break:break-word!important}.text-primary{--bs-text-opacity:1;color:rgba(var(--bs-primary-rgb),var(--bs-text-opacity))!important}.text-secondary{--bs-text-opacity:1;color:rgba(var(--bs-secondary-rgb),var(--bs-text-opacity))!important}.text-success{--bs-text-opacity:1;color:rgba(var(--bs-success-rgb),var(--bs-text-opacity))!important}.text-info{--bs-text-opacity:1;color:rgba(var(--bs-info-rgb),var(--bs-text-opacity))!important}.text-warning{--bs-text-opacity:1;color:rgba(var(--bs-warning-rgb),var(--bs-text-opacity))!important}.text-danger{--bs-text-opacity:1;color:rgba(var(--bs-danger-rgb),var(--bs-text-opacity))!important}.text-light{--bs-text-opacity:1;color:rgba(var(--bs-light-rgb),var(--bs-text-opacity))!important}.text-dark{--bs-text-opacity:1;color:rgba(var(--bs-dark-rgb),var(--bs-text-opacity))!important}.text-black{--bs-text-opacity:1;color:rgba(var(--bs-black-rgb),var(--bs-text-opacity))!important}.text-white{--bs-text-opacity:1;color:rgba(var(--bs-white-rgb),var(--bs-text-opacity))!important}.text-body{--bs-text-opacity:1;color:rgba(var(--bs-body-color-rgb),var(--bs-text-opacity))!important}.text-muted{--bs-text-opacity:1;color:var(--bs-secondary-color)!important}.text-black-50{--bs-text-opacity:1;color:rgba(0,0,0,.5)!important}.text-white-50{--bs-text-opacity:1;color:rgba(255,255,255,.5)!important}.text-body-secondary{--bs-text-opacity:1;color:var(--bs-secondary-color)!important}.text-body-tertiary{--bs-text-opacity:1;color:var(--bs-tertiary-color)!important}.text-body-emphasis{--bs-text-opacity:1;color:var(--bs-emphasis-color)!important}.text-reset{--bs-text-opacity:1;color:inherit!important}.text-opacity-25{--bs-text-opacity:0.25}.text-opacity-50{--bs-text-opacity:0.5}.text-opacity-75{--bs-text-opacity:0.75}.text-opacity-100{--bs-text-opacity:1}.text-primary-emphasis{color:var(--bs-primary-text-emphasis)!important}.text-secondary-emphasis{color:var(--bs-secondary-text-emphasis)!important}.text-success-emphasis{color:var(--bs-success-text-emphasis)!important}.text-info-emphasis{color:var(--bs-info-text-emphasis)!important}.text-warning-emphasis{color:var(--bs-warning-text-emphasis)!important}.text-danger-emphasis{color:var(--bs-danger-text-emphasis)!important}.text-light-emphasis{color:var(--bs-light-text-emphasis)!important}.text-dark-emphasis{color:var(--bs-dark-text-emphasis)!important}.link-opacity-10{--bs-link-opacity:0.1}.link-opacity-10-hover:hover{--bs-link-opacity:0.1}.link-opacity-25{--bs-link-opacity:0.25}.link-opacity-25-hover:hover{--bs-link-opacity:0.25}.link-opacity-50{--bs-link-opacity:0.5}.link-opacity-50-hover:hover{--bs-link-opacity:0.5}.link-opacity-75{--bs-link-opacity:0.75}.link-opacity-75-hover:hover{--bs-link-opacity:0.75}.link-opacity-100{--bs-link-opacity:1}.link-opacity-100-hover:hover{--bs-link-opacity:1}.link-offset-1{text-underline-offset:0.125em!important}.link-offset-1-hover:hover{text-underline-offset:0.125em!important}.link-offset-2{text-underline-offset:0.25em!important}.link-offset-2-hover:hover{text-underline-offset:0.25em!important}.link-offset-3{text-underline-offset:0.375em!important}.link-offset-3-hover:hover{text-underline-offset:0.375em!important}.link-underline-primary{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-primary-rgb),var(--bs-link-underline-opacity))!important;text-decoration-color:rgba(var(--bs-primary-rgb),var(--bs-link-underline-opacity))!important}.link-underline-secondary{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-secondary-rgb),var(--bs-link-underline-opacity))!important;text-decoration-color:rgba(var(--bs-secondary-rgb),var(--bs-link-underline-opacity))!important}.link-underline-success{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-success-rgb),var(--bs-link-underline-opacity))!important;text-decoration-color:rgba(var(--bs-success-rgb),var(--bs-link-underline-opacity))!important}.link-underline-info{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-info-rgb),var(--bs-link-underline-opacity))!important;text-decoration-color:rgba(var(--bs-info-rgb),var(--bs-link-underline-opacity))!important}.link-underline-warning{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-warning-rgb),var(--bs-link-underline-opacity))!important;text-decoration-color:rgba(var(--bs-warning-rgb),var(--bs-link-underline-opacity))!important}.link-underline-danger{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-danger-rgb),var(--bs-link-underline-opacity))!important;text-decoration-color:rgba(var(--bs-danger-rgb),var(--bs-link-underline-opacity))!important}.link-underline-light{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-light-rgb),var(--bs-link-underline-opacity))!important;text-decoration-color:rgba(var(--bs-light-rgb),var(--bs-link-underline-opacity))!important}.link-underline-dark{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-dark-rgb),var(--bs-link-underline-opacity))!important;text-decoration-color:rgba(var(--bs-dark-rgb),var(--bs-link-underline-opacity))!important}.link-underline{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-link-color-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:rgba(var(--bs-link-color-rgb),var(--bs-link-underline-opacity,1))!important}.link-underline-opacity-0{--bs-link-underline-opacity:0}.link-underline-opacity-0-hover:hover{--bs-link-underline-opacity:0}.link-underline-opacity-10{--bs-link-underline-opacity:0.1}.link-underline-opacity-10-hover:hover{--bs-link-underline-opacity:0.1}.link-underline-opacity-25{--bs-link-underline-opacity:0.25}.link-underline-opacity-25-hover:hover{--bs-link-underline-opacity:0.25}.link-underline-opacity-50{--bs-link-underline-opacity:0.5}.link-underline-opacity-50-hover:hover{--bs-link-underline-opacity:0.5}.link-underline-opacity-75{--bs-link-underline-opacity:0.75}.link-underline-opacity-75-hover:hover{--bs-link-underline-opacity:0.75}.link-underline-opacity-100{--bs-link-underline-opacity:1}.link-underline-opacity-100-hover:hover{--bs-link-underline-opacity:1}.bg-primary{--bs-bg-opacity:1;background-color:rgba(var(--bs-primary-rgb),var(--bs-bg-opacity))!important}.bg-secondary{--bs-bg-opacity:1;background-color:rgba(var(--bs-secondary-rgb),var(--bs-bg-opacity))!important}.bg-success{--bs-bg-opacity:1;background-color:rgba(var(--bs-success-rgb),var(--bs-bg-opacity))!important}.bg-info{--bs-bg-opacity:1;background-color:rgba(var(--bs-info-rgb),var(--bs-bg-opacity))!important}.bg-warning{--bs-bg-opacity:1;background-color:rgba(var(--bs-warning-rgb),var(--bs-bg-opacity))!important}.bg-danger{--bs-bg-opacity:1;background-color:rgba(var(--bs-danger-rgb),var(--bs-bg-opacity))!important}.bg-light{--bs-bg-opacity:1;background-color:rgba(var(--bs-light-rgb),var(--bs-bg-opacity))!important}.bg-dark{--bs-bg-opacity:1;background-color:rgba(var(--bs-dark-rgb),var(--bs-bg-opacity))!important}.bg-black{--bs-bg-opacity:1;background-color:rgba(var(--bs-black-rgb),var(--bs-bg-opacity))!important}.bg-white{--bs-bg-opacity:1;background-color:rgba(var(--bs-white-rgb),var(--bs-bg-opacity))!important}.bg-body{--bs-bg-opacity:1;background-color:rgba(var(--bs-body-bg-rgb),var(--bs-bg-opacity))!important}.bg-transparent{--bs-bg-opacity:1;background-color:transparent!important}.bg-body-secondary{--bs-bg-opacity:1;background-color:rgba(var(--bs-secondary-bg-rgb),var(--bs-bg-opacity))!important}.bg-body-tertiary{--bs-bg-opacity:1;background-color:rgba(var(--bs-tertiary-bg-rgb),var(--bs-bg-opacity))!important}.bg-opacity-10{--bs-bg-opacity:0.1}.bg-opacity-25{--bs-bg-opacity:0.25}.bg-opacity-50{--bs-bg-opacity:0.5}.bg-opacity-75{--bs-bg-opacity:0.75}.bg-opacity-100{--bs-bg-opacity:1}.bg-primary-subtle{background-color:var(--bs-primary-bg-subtle)!important}.bg-secondary-subtle{background-color:var(--bs-secondary-bg-subtle)!important}.bg-success-subtle{background-color:var(--bs-success-bg-subtle)!important}.bg-info-subtle{background-color:var(--bs-info-bg-subtle)!important}.bg-warning-subtle{background-color:var(--bs-warning-bg-subtle)!important}.bg-danger-subtle{background-color:var(--bs-danger-bg-subtle)!important}.bg-light-subtle{background-color:var(--bs-light-bg-subtle)!important}.bg-dark-subtle{background-color:var(--bs-dark-bg-subtle)!important}.bg-gradient{background-image:var(--bs-gradient)!important}.user-select-all{-webkit-user-select:all!important;-moz-user-select:all!important;user-select:all!important}.user-select-auto{-webkit-user-select:auto!important;-moz-user-select:auto!important;user-select:auto!important}.user-select-none{-webkit-user-select:none!important;-moz-user-select:none!important;user-select:none!important}.pe-none{pointer-events:none!important}.pe-auto{pointer-events:auto!important}.rounded{border-radius:var(--bs-border-radius)!important}.rounded-0{border-radius:0!important}.rounded-1{border-radius:var(--bs-border-radius-sm)!important}.rounded-2{border-radius:var(--bs-border-radius)!important}.rounded-3{border-radius:var(--bs-border-radius-lg)!important}.rounded-4{border-radius:var(--bs-border-radius-xl)!important}.rounded-5{border-radius:var(--bs-border-radius-xxl)!important}.rounded-circle{border-radius:50%!important}.rounded-pill{border-radius:var(--bs-border-radius-pill)!important}.rounded-top{border-top-left-radius:var(--bs-border-radius)!important;border-top-right-radius:var(--bs-border-radius)!important}.rounded-top-0{border-top-left-radius:0!important;border-top-right-radius:0!important}.rounded-top-1{border-top-left-radius:var(--bs-border-radius-sm)!important;border-top-right-radius:var(--bs-border-radius-sm)!important}.rounded-top-2{border-top-left-radius:var(--bs-border-radius)!important;border-top-right-radius:var(--bs-border-radius)!important}.rounded-top-3{border-top-left-radius:var(--bs-border-radius-lg)!important;border-top-right-radius:var(--bs-border-radius-lg)!important}.rounded-top-4{border-top-left-radius:var(--bs-border-radius-xl)!important;border-top-right-radius:var(--bs-border-radius-xl)!important}.rounded-top-5{border-top-left-radius:var(--bs-border-radius-xxl)!important;border-top-right-radius:var(--bs-border-radius-xxl)!important}.rounded-top-circle{border-top-left-radius:50%!important;border-top-right-radius:50%!important}.rounded-top-pill{border-top-left-radius:var(--bs-border-radius-pill)!important;border-top-right-radius:var(--bs-border-radius-pill)!important}.rounded-end{border-top-right-radius:var(--bs-border-radius)!important;border-bottom-right-radius:var(--bs-border-radius)!important}.rounded-end-0{border-top-right-radius:0!important;border-bottom-right-radius:0!important}.rounded-end-1{border-top-right-radius:var(--bs-border-radius-sm)!important;border-bottom-right-radius:var(--bs-border-radius-sm)!important}.rounded-end-2{border-top-right-radius:var(--bs-border-radius)!important;border-bottom-right-radius:var(--bs-border-radius)!important}.rounded-end-3{border-top-right-radius:var(--bs-border-radius-lg)!important;border-bottom-right-radius:var(--bs-border-radius-lg)!important}.rounded-end-4{border-top-right-radius:var(--bs-border-radius-xl)!important;border-bottom-right-radius:var(--bs-border-radius-xl)!important}.rounded-end-5{border-top-right-radius:var(--bs-border-radius-xxl)!important;border-bottom-right-radius:var(--bs-border-radius-xxl)!important}.rounded-end-circle{border-top-right-radius:50%!important;border-bottom-right-radius:50%!important}.rounded-end-pill{border-top-right-radius:var(--bs-border-radius-pill)!important;border-bottom-right-radius:var(--bs-border-radius-pill)!important}.rounded-bottom{border-bottom-right-radius:var(--bs-border-radius)!important;border-bottom-left-radius:var(--bs-border-radius)!important}.rounded-bottom-0{border-bottom-right-radius:0!important;border-bottom-left-radius:0!important}.rounded-bottom-1{border-bottom-right-radius:var(--bs-border-radius-sm)!important;border-bottom-left-radius:var(--bs-border-radius-sm)!important}.rounded-bottom-2{border-bottom-right-radius:var(--bs-border-radius)!important;border-bottom-left-radius:var(--bs-border-radius)!important}.rounded-bottom-3{border-bottom-right-radius:var(--bs-border-radius-lg)!important;border-bottom-left-radius:var(--bs-border-radius-lg)!important}.rounded-bottom-4{border-bottom-right-radius:var(--bs-border-radius-xl)!important;border-bottom-left-radius:var(--bs-border-radius-xl)!important}.rounded-bottom-5{border-bottom-right-radius:var(--bs-border-radius-xxl)!important;border-bottom-left-radius:var(--bs-border-radius-xxl)!important}.rounded-bottom-circle{border-bottom-right-radius:50%!important;border-bottom-left-radius:50%!important}.rounded-bottom-pill{border-bottom-right-radius:var(--bs-border-radius-pill)!important;border-bottom-left-radius:var(--bs-border-radius-pill)!important}.rounded-start{border-bottom-left-radius:var(--bs-border-radius)!important;border-top-left-radius:var(--bs-border-radius)!important}.rounded-start-0{border-bottom-left-radius:0!important;border-top-left-radius:0!important}.rounded-start-1{border-bottom-left-radius:var(--bs-border-radius-sm)!important;border-top-left-radius:var(--bs-border-radius-sm)!important}.rounded-start-2{border-bottom-left-radius:var(--bs-border-radius)!important;border-top-left-radius:var(--bs-border-radius)!important}.rounded-start-3{border-bottom-left-radius:var(--bs-border-radius-lg)!important;border-top-left-radius:var(--bs-border-radius-lg)!important}.rounded-start-4{border-bottom-left-radius:var(--bs-border-radius-xl)!important;border-top-left-radius:var(--bs-border-radius-xl)!important}.rounded-start-5{border-bottom-left-radius:var(--bs-border-radius-xxl)!important;border-top-left-radius:var(--bs-border-radius-xxl)!important}.rounded-start-circle{border-bottom-left-radius:50%!important;border-top-left-radius:50%!important}.rounded-start-pill{border-bottom-left-radius:var(--bs-border-radius-pill)!important;border-top-left-radius:var(--bs-border-radius-pill)!important}.visible{visibility:visible!important}.invisible{visibility:hidden!important}.z-n1{z-index:-1!important}.z-0{z-index:0!important}.z-1{z-index:1!important}.z-2{z-index:2!important}.z-3{z-index:3!important}@media (min-width:576px){.float-sm-start{float:left!important}.float-sm-end{float:right!important}.float-sm-none{float:none!important}.object-fit-sm-contain{-o-object-fit:contain!important;object-fit:contain!important}.object-fit-sm-cover{-o-object-fit:cover!important;object-fit:cover!important}.object-fit-sm-fill{-o-object-fit:fill!important;object-fit:fill!important}.object-fit-sm-scale{-o-object-fit:scale-down!important;object-fit:scale-down!important}.object-fit-sm-none{-o-object-fit:none!important;object-fit:none!important}.d-sm-inline{display:inline!important}.d-sm-inline-block{display:inline-block!important}.d-sm-block{display:block!important}.d-sm-grid{display:grid!important}.d-sm-inline-grid{display:inline-grid!important}.d-sm-table{display:table!important}.d-sm-table-row{display:table-row!important}.d-sm-table-cell{display:table-cell!important}.d-sm-flex{display:flex!important}.d-sm-inline-flex{display:inline-flex!important}.d-sm-none{display:none!important}.flex-sm-fill{flex:1 1 auto!important}.flex-sm-row{flex-direction:row!important}.flex-sm-column{flex-direction:column!important}.flex-sm-row-reverse{flex-direction:row-reverse!important}.flex-sm-column-reverse{flex-direction:column-reverse!important}.flex-sm-grow-0{flex-grow:0!important}.flex-sm-grow-1{flex-grow:1!important}.flex-sm-shrink-0{flex-shrink:0!important}.flex-sm-shrink-1{flex-shrink:1!important}.flex-sm-wrap{flex-wrap:wrap!important}.flex-sm-nowrap{flex-wrap:nowrap!important}.flex-sm-wrap-reverse{flex-wrap:wrap-reverse!important}.justify-content-sm-start{justify-content:flex-start!important}.justify-content-sm-end{justify-content:flex-end!important}.justify-content-sm-center{justify-content:center!important}.justify-content-sm-between{justify-content:space-between!important}.justify-content-sm-around{justify-content:space-around!important}.justify-content-sm-evenly{justify-content:space-evenly!important}.align-items-sm-start{align-items:flex-start!important}.align-items-sm-end{align-items:flex-end!important}.align-items-sm-center{align-items:center!important}.align-items-sm-baseline{align-items:baseline!important}.align-items-sm-stretch{align-items:stretch!important}.align-content-sm-start{align-content:flex-start!important}.align-content-sm-end{align-content:flex-end!important}.align-content-sm-center{align-content:center!important}.align-content-sm-between{align-content:space-between!important}.align-content-sm-around{align-content:space-around!important}.align-content-sm-stretch{align-content:stretch!important}.align-self-sm-auto{align-self:auto!important}.align-self-sm-start{align-self:flex-start!important}.align-self-sm-end{align-self:flex-end!important}.align-self-sm-center{align-self:center!important}.align-self-sm-baseline{align-self:baseline!important}.align-self-sm-stretch{align-self:stretch!important}.order-sm-first{order:-1!important}.order-sm-0{order:0!important}.order-sm-1{order:1!important}.order-sm-2{order:2!important}.order-sm-3{order:3!important}.order-sm-4{order:4!important}.order-sm-5{order:5!important}.order-sm-last{order:6!important}.m-sm-0{margin:0!important}.m-sm-1{margin:.25rem!important}.m-sm-2{margin:.5rem!important}.m-sm-3{margin:1rem!important}.m-sm-4{margin:1.5rem!important}.m-sm-5{margin:3rem!important}.m-sm-auto{margin:auto!important}.mx-sm-0{margin-right:0!important;margin-left:0!important}.mx-sm-1{margin-right:.25rem!important;margin-left:.25rem!important}.mx-sm-2{margin-right:.5rem!important;margin-left:.5rem!important}.mx-sm-3{margin-right:1rem!important;margin-left:1rem!important}.mx-sm-4{margin-right:1.5rem!important;margin-left:1.5rem!important}.mx-sm-5{margin-right:3rem!important;margin-left:3rem!important}.mx-sm-auto{margin-right:auto!important;margin-left:auto!important}.my-sm-0{margin-top:0!important;margin-bottom:0!important}.my-sm-1{margin-top:.25rem!important;margin-bottom:.25rem!important}.my-sm-2{margin-top:.5rem!important;margin-bottom:.5rem!important}.my-sm-3{margin-top:1rem!important;margin-bottom:1rem!important}.my-sm-4{margin-top:1.5rem!important;margin-bottom:1.5rem!important}.my-sm-5{margin-top:3rem!important;margin-bottom:3rem!important}.my-sm-auto{margin-top:auto!important;margin-bottom:auto!important}.mt-sm-0{margin-top:0!important}.mt-sm-1{margin-top:.25rem!important}.mt-sm-2{margin-top:.5rem!important}.mt-sm-3{margin-top:1rem!important}.mt-sm-4{margin-top:1.5rem!important}.mt-sm-5{margin-top:3rem!important}.mt-sm-auto{margin-top:auto!important}.me-sm-0{margin-right:0!important}.me-sm-1{margin-right:.25rem!important}.me-sm-2{margin-right:.5rem!important}.me-sm-3{margin-right:1rem!important}.me-sm-4{margin-right:1.5rem!important}.me-sm-5{margin-right:3rem!important}.me-sm-auto{margin-right:auto!important}.mb-sm-0{margin-bottom:0!important}.mb-sm-1{margin-bottom:.25rem!important}.mb-sm-2{margin-bottom:.5rem!important}.mb-sm-3{margin-bottom:1rem!important}.mb-sm-4{margin-bottom:1.5rem!important}.mb-sm-5{margin-bottom:3rem!important}.mb-sm-auto{margin-bottom:auto!important}.ms-sm-0{margin-left:0!important}.ms-sm-1{margin-left:.25rem!important}.ms-sm-2{margin-left:.5rem!important}.ms-sm-3{margin-left:1rem!important}.ms-sm-4{margin-left:1.5rem!important}.ms-sm-5{margin-left:3rem!important}.ms-sm-auto{margin-left:auto!important}.p-sm-0{padding:0!important}.p-sm-1{padding:.25rem!important}.p-sm-2{padding:.5rem!important}.p-sm-3{padding:1rem!important}.p-sm-4{padding:1.5rem!important}.p-sm-5{padding:3rem!important}.px-sm-0{padding-right:0!important;padding-left:0!important}.px-sm-1{padding-right:.25rem!important;padding-left:.25rem!important}.px-sm-2{padding-right:.5rem!important;padding-left:.5rem!important}.px-sm-3{padding-right:1rem!important;padding-left:1rem!important}.px-sm-4{padding-right:1.5rem!important;padding-left:1.5rem!important}.px-sm-5{padding-right:3rem!important;padding-left:3rem!important}.py-sm-0{padding-top:0!important;padding-bottom:0!important}.py-sm-1{padding-top:.25rem!important;padding-bottom:.25rem!important}.py-sm-2{padding-top:.5rem!important;padding-bottom:.5rem!important}.py-sm-3{padding-top:1rem!important;padding-bottom:1rem!important}.py-sm-4{padding-top:1.5rem!important;padding-bottom:1.5rem!important}.py-sm-5{padding-top:3rem!important;padding-bottom:3rem!important}.pt-sm-0{padding-top:0!important}.pt-sm-1{padding-top:.25rem!important}.pt-sm-2{padding-top:.5rem!important}.pt-sm-3{padding-top:1rem!important}.pt-sm-4{padding-top:1.5rem!important}.pt-sm-5{padding-top:3rem!important}.pe-sm-0{padding-right:0!important}.pe-sm-1{padding-right:.25rem!important}.pe-sm-2{padding-right:.5rem!important}.pe-sm-3{padding-right:1rem!important}.pe-sm-4{padding-right:1.5rem!important}.pe-sm-5{padding-right:3rem!important}.pb-sm-0{padding-bottom:0!important}.pb-sm-1{padding-bottom:.25rem!important}.pb-sm-2{padding-bottom:.5rem!important}.pb-sm-3{padding-bottom:1rem!important}.pb-sm-4{padding-bottom:1.5rem!important}.pb-sm-5{padding-bottom:3rem!important}.ps-sm-0{padding-left:0!important}.ps-sm-1{padding-left:.25rem!important}.ps-sm-2{padding-left:.5rem!important}.ps-sm-3{padding-left:1rem!important}.ps-sm-4{padding-left:1.5rem!important}.ps-sm-5{padding-left:3rem!important}.gap-sm-0{gap:0!important}.gap-sm-1{gap:.25rem!important}.gap-sm-2{gap:.5rem!important}.gap-sm-3{gap:1rem!important}.gap-sm-4{gap:1.5rem!important}.gap-sm-5{gap:3rem!important}.row-gap-sm-0{row-gap:0!important}.row-gap-sm-1{row-gap:.25rem!important}.row-gap-sm-2{row-gap:.5rem!important}.row-gap-sm-3{row-gap:1rem!important}.row-gap-sm-4{row-gap:1.5rem!important}.row-gap-sm-5{row-gap:3rem!important}.column-gap-sm-0{-moz-column-gap:0!important;column-gap:0!important}.column-gap-sm-1{-moz-column-gap:0.25rem!important;column-gap:.25rem!important}.column-gap-sm-2{-moz-column-gap:0.5rem!important;column-gap:.5rem!important}.column-gap-sm-3{-moz-column-gap:1rem!important;column-gap:1rem!important}.column-gap-sm-4{-moz-column-gap:1.5rem!important;column-gap:1.5rem!important}.column-gap-sm-5{-moz-column-gap:3rem!important;column-gap:3rem!important}.text-sm-start{text-align:left!important}.text-sm-end{text-align:right!important}.text-sm-center{text-align:center!important}}@media (min-width:768px){.float-md-start{float:left!important}.float-md-end{float:right!important}.float-md-none{float:none!important}.object-fit-md-contain{-o-object-fit:contain!important;object-fit:contain!important}.object-fit-md-cover{-o-object-fit:cover!important;object-fit:cover!important}.object-fit-md-fill{-o-object-fit:fill!important;object-fit:fill!important}.object-fit-md-scale{-o-object-fit:scale-down!important;object-fit:scale-down!important}.object-fit-md-none{-o-object-fit:none!important;object-fit:none!important}.d-md-inline{display:inline!important}.d-md-inline-block{display:inline-block!important}.d-md-block{display:block!important}.d-md-grid{display:grid!important}.d-md-inline-grid{display:inline-grid!important}.d-md-table{display:table!important}.d-md-table-row{display:table-row!important}.d-md-table-cell{display:table-cell!important}.d-md-flex{display:flex!important}.d-md-inline-flex{display:inline-flex!important}.d-md-none{display:none!important}.flex-md-fill{flex:1 1 auto!important}.flex-md-row{flex-direction:row!important}.flex-md-column{flex-direction:column!important}.flex-md-row-reverse{flex-direction:row-reverse!important}.flex-md-column-reverse{flex-direction:column-reverse!important}.flex-md-grow-0{flex-grow:0!important}.flex-md-grow-1{flex-grow:1!important}.flex-md-shrink-0{flex-shrink:0!important}.flex-md-shrink-1{flex-shrink:1!important}.flex-md-wrap{flex-wrap:wrap!important}.flex-md-nowrap{flex-wrap:nowrap!important}.flex-md-wrap-reverse{flex-wrap:wrap-reverse!important}.justify-content-md-start{justify-content:flex-start!important}.justify-content-md-end{justify-content:flex-end!important}.justify-content-md-center{justify-content:center!important}.justify-content-md-between{justify-content:space-between!important}.justify-content-md-around{justify-content:space-around!important}.justify-content-md-evenly{justify-content:space-evenly!important}.align-items-md-start{align-items:flex-start!important}.align-items-md-end{align-items:flex-end!important}.align-items-md-center{align-items:center!important}.align-items-md-baseline{align-items:baseline!important}.align-items-md-stretch{align-items:stretch!important}.align-content-md-start{align-content:flex-start!important}.align-content-md-end{align-content:flex-end!important}.align-content-md-center{align-content:center!important}.align-content-md-between{align-content:space-between!important}.align-content-md-around{align-content:space-around!important}.align-content-md-stretch{align-content:stretch!important}.align-self-md-auto{align-self:auto!important}.align-self-md-start{align-self:flex-start!important}.align-self-md-end{align-self:flex-end!important}.align-self-md-center{align-self:center!important}.align-self-md-baseline{align-self:baseline!important}.align-self-md-stretch{align-self:stretch!important}.order-md-first{order:-1!important}.order-md-0{order:0!important}.order-md-1{order:1!important}.order-md-2{order:2!important}.order-md-3{order:3!important}.order-md-4{order:4!important}.order-md-5{order:5!important}.order-md-last{order:6!important}.m-md-0{margin:0!important}.m-md-1{margin:.25rem!important}.m-md-2{margin:.5rem!important}.m-md-3{margin:1rem!important}.m-md-4{margin:1.5rem!important}.m-md-5{margin:3rem!important}.m-md-auto{margin:auto!important}.mx-md-0{margin-right:0!important;margin-left:0!important}.mx-md-1{margin-right:.25rem!important;margin-left:.25rem!important}.mx-md-2{margin-right:.5rem!important;margin-left:.5rem!important}.mx-md-3{margin-right:1rem!important;margin-left:1rem!important}.mx-md-4{margin-right:1.5rem!important;margin-left:1.5rem!important}.mx-md-5{margin-right:3rem!important;margin-left:3rem!important}.mx-md-auto{margin-right:auto!important;margin-left:auto!important}.my-md-0{margin-top:0!important;margin-bottom:0!important}.my-md-1{margin-top:.25rem!important;margin-bottom:.25rem!important}.my-md-2{margin-top:.5rem!important;margin-bottom:.5rem!important}.my-md-3{margin-top:1rem!important;margin-bottom:1rem!important}.my-md-4{margin-top:1.5rem!important;margin-bottom:1.5rem!important}.my-md-5{margin-top:3rem!important;margin-bottom:3rem!important}.my-md-auto{margin-top:auto!important;margin-bottom:auto!important}.mt-md-0{margin-top:0!important}.mt-md-1{margin-top:.25rem!important}.mt-md-2{margin-top:.5rem!important}.mt-md-3{margin-top:1rem!important}.mt-md-4{margin-top:1.5rem!important}.mt-md-5{margin-top:3rem!important}.mt-md-auto{margin-top:auto!important}.me-md-0{margin-right:0!important}.me-md-1{margin-right:.25rem!important}.me-md-2{margin-right:.5rem!important}.me-md-3{margin-right:1rem!important}.me-md-4{margin-right:1.5rem!important}.me-md-5{margin-right:3rem!important}.me-md-auto{margin-right:auto!important}.mb-md-0{margin-bottom:0!important}.mb-md-1{margin-bottom:.25rem!important}.mb-md-2{margin-bottom:.5rem!important}.mb-md-3{margin-bottom:1rem!important}.mb-md-4{margin-bottom:1.5rem!important}.mb-md-5{margin-bottom:3rem!important}.mb-md-auto{margin-bottom:auto!important}.ms-md-0{margin-left:0!important}.ms-md-1{margin-left:.25rem!important}.ms-md-2{margin-left:.5rem!important}.ms-md-3{margin-left:1rem!important}.ms-md-4{margin-left:1.5rem!important}.ms-md-5{margin-left:3rem!important}.ms-md-auto{margin-left:auto!important}.p-md-0{padding:0!important}.p-md-1{padding:.25rem!important}.p-md-2{padding:.5rem!important}.p-md-3{padding:1rem!important}.p-md-4{padding:1.5rem!important}.p-md-5{padding:3rem!important}.px-md-0{padding-right:0!important;padding-left:0!important}.px-md-1{padding-right:.25rem!important;padding-left:.25rem!important}.px-md-2{padding-right:.5rem!important;padding-left:.5rem!important}.px-md-3{padding-right:1rem!important;padding-left:1rem!important}.px-md-4{padding-right:1.5rem!important;padding-left:1.5rem!important}.px-md-5{padding-right:3rem!important;padding-left:3rem!important}.py-md-0{padding-top:0!important;padding-bottom:0!important}.py-md-1{padding-top:.25rem!important;padding-bottom:.25rem!important}.py-md-2{padding-top:.5rem!important;padding-bottom:.5rem!important}.py-md-3{padding-top:1rem!important;padding-bottom:1rem!important}.py-md-4{padding-top:1.5rem!important;padding-bottom:1.5rem!important}.py-md-5{padding-top:3rem!important;padding-bottom:3rem!important}.pt-md-0{padding-top:0!important}.pt-md-1{padding-top:.25rem!important}.pt-md-2{padding-top:.5rem!important}.pt-md-3{padding-top:1rem!important}.pt-md-4{padding-top:1.5rem!important}.pt-md-5{padding-top:3rem!important}.pe-md-0{padding-right:0!important}.pe-md-1{padding-right:.25rem!important}.pe-md-2{padding-right:.5rem!important}.pe-md-3{padding-right:1rem!important}.pe-md-4{padding-right:1.5rem!important}.pe-md-5{padding-right:3rem!important}.pb-md-0{padding-bottom:0!important}.pb-md-1{padding-bottom:.25rem!important}.pb-md-2{padding-bottom:.5rem!important}.pb-md-3{padding-bottom:1rem!important}.pb-md-4{padding-bottom:1.5rem!important}.pb-md-5{padding-bottom:3rem!important}.ps-md-0{padding-left:0!important}.ps-md-1{padding-left:.25rem!important}.ps-md-2{padding-left:.5rem!important}.ps-md-3{padding-left:1rem!important}.ps-md-4{padding-left:1.5rem!important}.ps-md-5{padding-left:3rem!important}.gap-md-0{gap:0!important}.gap-md-1{gap:.25rem!important}.gap-md-2{gap:.5rem!important}.gap-md-3{gap:1rem!important}.gap-md-4{gap:1.5rem!important}.gap-md-5{gap:3rem!important}.row-gap-md-0{row-gap:0!important}.row-gap-md-1{row-gap:.25rem!important}.row-gap-md-2{row-gap:.5rem!important}.row-gap-md-3{row-gap:1rem!important}.row-gap-md-4{row-gap:1.5rem!important}.row-gap-md-5{row-gap:3rem!important}.column-gap-md-0{-moz-column-gap:0!important;column-gap:0!important}.column-gap-md-1{-moz-column-gap:0.25rem!important;column-gap:.25rem!important}.column-gap-md-2{-moz-column-gap:0.5rem!important;column-gap:.5rem!important}.column-gap-md-3{-moz-column-gap:1rem!important;column-gap:1rem!important}.column-gap-md-4{-moz-column-gap:1.5rem!important;column-gap:1.5rem!important}.column-gap-md-5{-moz-column-gap:3rem!important;column-gap:3rem!important}.text-md-start{text-align:left!important}.text-md-end{text-align:right!important}.text-md-center{text-align:center!important}}@media (min-width:992px){.float-lg-start{float:left!important}.float-lg-end{float:right!important}.float-lg-none{float:none!important}.object-fit-lg-contain{-o-object-fit:contain!important;object-fit:contain!important}.object-fit-lg-cover{-o-object-fit:cover!important;object-fit:cover!important}.object-fit-lg-fill{-o-object-fit:fill!important;object-fit:fill!important}.object-fit-lg-scale{-o-object-fit:scale-down!important;object-fit:scale-down!important}.object-fit-lg-none{-o-object-fit:none!important;object-fit:none!important}.d-lg-inline{display:inline!important}.d-lg-inline-block{display:inline-block!important}.d-lg-block{display:block!important}.d-lg-grid{display:grid!important}.d-lg-inline-grid{display:inline-grid!important}.d-lg-table{display:table!important}.d-lg-table-row{display:table-row!important}.d-lg-table-cell{display:table-cell!important}.d-lg-flex{display:flex!important}.d-lg-inline-flex{display:inline-flex!important}.d-lg-none{display:none!important}.flex-lg-fill{flex:1 1 auto!important}.flex-lg-row{flex-direction:row!important}.flex-lg-column{flex-direction:column!important}.flex-lg-row-reverse{flex-direction:row-reverse!important}.flex-lg-column-reverse{flex-direction:column-reverse!important}.flex-lg-grow-0{flex-grow:0!important}.flex-lg-grow-1{flex-grow:1!important}.flex-lg-shrink-0{flex-shrink:0!important}.flex-lg-shrink-1{flex-shrink:1!important}.flex-lg-wrap{flex-wrap:wrap!important}.flex-lg-nowrap{flex-wrap:nowrap!important}.flex-lg-wrap-reverse{flex-wrap:wrap-reverse!important}.justify-content-lg-start{justify-content:flex-start!important}.justify-content-lg-end{justify-content:flex-end!important}.justify-content-lg-center{justify-content:center!important}.justify-content-lg-between{justify-content:space-between!important}.justify-content-lg-around{justify-content:space-around!important}.justify-content-lg-evenly{justify-content:space-evenly!important}.align-items-lg-start{align-items:flex-start!important}.align-items-lg-end{align-items:flex-end!important}.align-items-lg-center{align-items:center!important}.align-items-lg-baseline{align-items:baseline!important}.align-items-lg-stretch{align-items:stretch!important}.align-content-lg-start{align-content:flex-start!important}.align-content-lg-end{align-content:flex-end!important}.align-content-lg-center{align-content:center!important}.align-content-lg-between{align-content:space-between!important}.align-content-lg-around{align-content:space-around!important}.align-content-lg-stretch{align-content:stretch!important}.align-self-lg-auto{align-self:auto!important}.align-self-lg-start{align-self:flex-start!important}.align-self-lg-end{align-self:flex-end!important}.align-self-lg-center{align-self:center!important}.align-self-lg-baseline{align-self:baseline!important}.align-self-lg-stretch{align-self:stretch!important}.order-lg-first{order:-1!important}.order-lg-0{order:0!important}.order-lg-1{order:1!important}.order-lg-2{order:2!important}.order-lg-3{order:3!important}.order-lg-4{order:4!important}.order-lg-5{order:5!important}.order-lg-last{order:6!important}.m-lg-0{margin:0!important}.m-lg-1{margin:.25rem!important}.m-lg-2{margin:.5rem!important}.m-lg-3{margin:1rem!important}.m-lg-4{margin:1.5rem!important}.m-lg-5{margin:3rem!important}.m-lg-auto{margin:auto!important}.mx-lg-0{margin-right:0!important;margin-left:0!important}.mx-lg-1{margin-right:.25rem!important;margin-left:.25rem!important}.mx-lg-2{margin-right:.5rem!important;margin-left:.5rem!important}.mx-lg-3{margin-right:1rem!important;margin-left:1rem!important}.mx-lg-4{margin-right:1.5rem!important;margin-left:1.5rem!important}.mx-lg-5{margin-right:3rem!important;margin-left:3rem!important}.mx-lg-auto{margin-right:auto!important;margin-left:auto!important}.my-lg-0{margin-top:0!important;margin-bottom:0!important}.my-lg-1{margin-top:.25rem!important;margin-bottom:.25rem!important}.my-lg-2{margin-top:.5rem!important;margin-bottom:.5rem!important}.my-lg-3{margin-top:1rem!important;margin-bottom:1rem!important}.my-lg-4{margin-top:1.5rem!important;margin-bottom:1.5rem!important}.my-lg-5{margin-top:3rem!important;margin-bottom:3rem!important}.my-lg-auto{margin-top:auto!important;margin-bottom:auto!important}.mt-lg-0{margin-top:0!important}.mt-lg-1{margin-top:.25rem!important}.mt-lg-2{margin-top:.5rem!important}.mt-lg-3{margin-top:1rem!important}.mt-lg-4{margin-top:1.5rem!important}.mt-lg-5{margin-top:3rem!important}.mt-lg-auto{margin-top:auto!important}.me-lg-0{margin-right:0!important}.me-lg-1{margin-right:.25rem!important}.me-lg-2{margin-right:.5rem!important}.me-lg-3{margin-right:1rem!important}.me-lg-4{margin-right:1.5rem!important}.me-lg-5{margin-right:3rem!important}.me-lg-auto{margin-right:auto!important}.mb-lg-0{margin-bottom:0!important}.mb-lg-1{margin-bottom:.25rem!important}.mb-lg-2{margin-bottom:.5rem!important}.mb-lg-3{margin-bottom:1rem!important}.mb-lg-4{margin-bottom:1.5rem!important}.mb-lg-5{margin-bottom:3rem!important}.mb-lg-auto{margin-bottom:auto!important}.ms-lg-0{margin-left:0!important}.ms-lg-1{margin-left:.25rem!important}.ms-lg-2{margin-left:.5rem!important}.ms-lg-3{margin-left:1rem!important}.ms-lg-4{margin-left:1.5rem!important}.ms-lg-5{margin-left:3rem!important}.ms-lg-auto{margin-left:auto!important}.p-lg-0{padding:0!important}.p-lg-1{padding:.25rem!important}.p-lg-2{padding:.5rem!important}.p-lg-3{padding:1rem!important}.p-lg-4{padding:1.5rem!important}.p-lg-5{padding:3rem!important}.px-lg-0{padding-right:0!important;padding-left:0!important}.px-lg-1{padding-right:.25rem!important;padding-left:.25rem!important}.px-lg-2{padding-right:.5rem!important;padding-left:.5rem!important}.px-lg-3{padding-right:1rem!important;padding-left:1rem!important}.px-lg-4{padding-right:1.5rem!important;padding-left:1.5rem!important}.px-lg-5{padding-right:3rem!important;padding-left:3rem!important}.py-lg-0{padding-top:0!important;padding-bottom:0!important}.py-lg-1{padding-top:.25rem!important;padding-bottom:.25rem!important}.py-lg-2{padding-top:.5rem!important;padding-bottom:.5rem!important}.py-lg-3{padding-top:1rem!important;padding-bottom:1rem!important}.py-lg-4{padding-top:1.5rem!important;padding-bottom:1.5rem!important}.py-lg-5{padding-top:3rem!important;padding-bottom:3rem!important}.pt-lg-0{padding-top:0!important}.pt-lg-1{padding-top:.25rem!important}.pt-lg-2{padding-top:.5rem!important}.pt-lg-3{padding-top:1rem!important}.pt-lg-4{padding-top:1.5rem!important}.pt-lg-5{padding-top:3rem!important}.pe-lg-0{padding-right:0!important}.pe-lg-1{padding-right:.25rem!important}.pe-lg-2{padding-right:.5rem!important}.pe-lg-3{padding-right:1rem!important}.pe-lg-4{padding-right:1.5rem!important}.pe-lg-5{padding-right:3rem!important}.pb-lg-0{padding-bottom:0!important}.pb-lg-1{padding-bottom:.25rem!important}.pb-lg-2{padding-bottom:.5rem!important}.pb-lg-3{padding-bottom:1rem!important}.pb-lg-4{padding-bottom:1.5rem!important}.pb-lg-5{padding-bottom:3rem!important}.ps-lg-0{padding-left:0!important}.ps-lg-1{padding-left:.25rem!important}.ps-lg-2{padding-left:.5rem!important}.ps-lg-3{padding-left:1rem!important}.ps-lg-4{padding-left:1.5rem!important}.ps-lg-5{padding-left:3rem!important}.gap-lg-0{gap:0!important}.gap-lg-1{gap:.25rem!important}.gap-lg-2{gap:.5rem!important}.gap-lg-3{gap:1rem!important}.gap-lg-4{gap:1.5rem!important}.gap-lg-5{gap:3rem!important}.row-gap-lg-0{row-gap:0!important}.row-gap-lg-1{row-gap:.25rem!important}.row-gap-lg-2{row-gap:.5rem!important}.row-gap-lg-3{row-gap:1rem!important}.row-gap-lg-4{row-gap:1.5rem!important}.row-gap-lg-5{row-gap:3rem!important}.column-gap-lg-0{-moz-column-gap:0!important;column-gap:0!important}.column-gap-lg-1{-moz-column-gap:0.25rem!important;column-gap:.25rem!important}.column-gap-lg-2{-moz-column-gap:0.5rem!important;column-gap:.5rem!important}.column-gap-lg-3{-moz-column-gap:1rem!important;column-gap:1rem!important}.column-gap-lg-4{-moz-column-gap:1.5rem!important;column-gap:1.5rem!important}.column-gap-lg-5{-moz-column-gap:3rem!important;column-gap:3rem!important}.text-lg-start{text-align:left!important}.text-lg-end{text-align:right!important}.text-lg-center{text-align:center!important}}@media (min-width:1200px){.float-xl-start{float:left!important}.float-xl-end{float:right!important}.float-xl-none{float:none!important}.object-fit-xl-contain{-o-object-fit:contain!important;object-fit:contain!important}.object-fit-xl-cover{-o-object-fit:cover!important;object-fit:cover!important}.object-fit-xl-fill{-o-object-fit:fill!important;object-fit:fill!important}.object-fit-xl-scale{-o-object-fit:scale-down!important;object-fit:scale-down!important}.object-fit-xl-none{-o-object-fit:none!important;object-fit:none!important}.d-xl-inline{display:inline!important}.d-xl-inline-block{display:inline-block!important}.d-xl-block{display:block!important}.d-xl-grid{display:grid!important}.d-xl-inline-grid{display:inline-grid!important}.d-xl-table{display:table!important}.d-xl-table-row{display:table-row!important}.d-xl-table-cell{display:table-cell!important}.d-xl-flex{display:flex!important}.d-xl-inline-flex{display:inline-flex!important}.d-xl-none{display:none!important}.flex-xl-fill{flex:1 1 auto!important}.flex-xl-row{flex-direction:row!important}.flex-xl-column{flex-direction:column!important}.flex-xl-row-reverse{flex-direction:row-reverse!important}.flex-xl-column-reverse{flex-direction:column-reverse!important}.flex-xl-grow-0{flex-grow:0!important}.flex-xl-grow-1{flex-grow:1!important}.flex-xl-shrink-0{flex-shrink:0!important}.flex-xl-shrink-1{flex-shrink:1!important}.flex-xl-wrap{flex-wrap:wrap!important}.flex-xl-nowrap{flex-wrap:nowrap!important}.flex-xl-wrap-reverse{flex-wrap:wrap-reverse!important}.justify-content-xl-start{justify-content:flex-start!important}.justify-content-xl-end{justify-content:flex-end!important}.justify-content-xl-center{justify-content:center!important}.justify-content-xl-between{justify-content:space-between!important}.justify-content-xl-around{justify-content:space-around!important}.justify-content-xl-evenly{justify-content:space-evenly!important}.align-items-xl-start{align-items:flex-start!important}.align-items-xl-end{align-items:flex-end!important}.align-items-xl-center{align-items:center!important}.align-items-xl-baseline{align-items:baseline!important}.align-items-xl-stretch{align-items:stretch!important}.align-content-xl-start{align-content:flex-start!important}.align-content-xl-end{align-content:flex-end!important}.align-content-xl-center{align-content:center!important}.align-content-xl-between{align-content:space-between!important}.align-content-xl-around{align-content:space-around!important}.align-content-xl-stretch{align-content:stretch!important}.align-self-xl-auto{align-self:auto!important}.align-self-xl-start{align-self:flex-start!important}.align-self-xl-end{align-self:flex-end!important}.align-self-xl-center{align-self:center!important}.align-self-xl-baseline{align-self:baseline!important}.align-self-xl-stretch{align-self:stretch!important}.order-xl-first{order:-1!important}.order-xl-0{order:0!important}.order-xl-1{order:1!important}.order-xl-2{order:2!important}.order-xl-3{order:3!important}.order-xl-4{order:4!important}.order-xl-5{order:5!important}.order-xl-last{order:6!important}.m-xl-0{margin:0!important}.m-xl-1{margin:.25rem!important}.m-xl-2{margin:.5rem!important}.m-xl-3{margin:1rem!important}.m-xl-4{margin:1.5rem!important}.m-xl-5{margin:3rem!important}.m-xl-auto{margin:auto!important}.mx-xl-0{margin-right:0!important;margin-left:0!important}.mx-xl-1{margin-right:.25rem!important;margin-left:.25rem!important}.mx-xl-2{margin-right:.5rem!important;margin-left:.5rem!important}.mx-xl-3{margin-right:1rem!important;margin-left:1rem!important}.mx-xl-4{margin-right:1.5rem!important;margin-left:1.5rem!important}.mx-xl-5{margin-right:3rem!important;margin-left:3rem!important}.mx-xl-auto{margin-right:auto!important;margin-left:auto!important}.my-xl-0{margin-top:0!important;margin-bottom:0!important}.my-xl-1{margin-top:.25rem!important;margin-bottom:.25rem!important}.my-xl-2{margin-top:.5rem!important;margin-bottom:.5rem!important}.my-xl-3{margin-top:1rem!important;margin-bottom:1rem!important}.my-xl-4{margin-top:1.5rem!important;margin-bottom:1.5rem!important}.my-xl-5{margin-top:3rem!important;margin-bottom:3rem!important}.my-xl-auto{margin-top:auto!important;margin-bottom:auto!important}.mt-xl-0{margin-top:0!important}.mt-xl-1{margin-top:.25rem!important}.mt-xl-2{margin-top:.5rem!important}.mt-xl-3{margin-top:1rem!important}.mt-xl-4{margin-top:1.5rem!important}.mt-xl-5{margin-top:3rem!important}.mt-xl-auto{margin-top:auto!important}.me-xl-0{margin-right:0!important}.me-xl-1{margin-right:.25rem!important}.me-xl-2{margin-right:.5rem!important}.me-xl-3{margin-right:1rem!important}.me-xl-4{margin-right:1.5rem!important}.me-xl-5{margin-right:3rem!important}.me-xl-auto{margin-right:auto!important}.mb-xl-0{margin-bottom:0!important}.mb-xl-1{margin-bottom:.25rem!important}.mb-xl-2{margin-bottom:.5rem!important}.mb-xl-3{margin-bottom:1rem!important}.mb-xl-4{margin-bottom:1.5rem!important}.mb-xl-5{margin-bottom:3rem!important}.mb-xl-auto{margin-bottom:auto!important}.ms-xl-0{margin-left:0!important}.ms-xl-1{margin-left:.25rem!important}.ms-xl-2{margin-left:.5rem!important}.ms-xl-3{margin-left:1rem!important}.ms-xl-4{margin-left:1.5rem!important}.ms-xl-5{margin-left:3rem!important}.ms-xl-auto{margin-left:auto!important}.p-xl-0{padding:0!important}.p-xl-1{padding:.25rem!important}.p-xl-2{padding:.5rem!important}.p-xl-3{padding:1rem!important}.p-xl-4{padding:1.5rem!important}.p-xl-5{padding:3rem!important}.px-xl-0{padding-right:0!important;padding-left:0!important}.px-xl-1{padding-right:.25rem!important;padding-left:.25rem!important}.px-xl-2{padding-right:.5rem!important;padding-left:.5rem!important}.px-xl-3{padding-right:1rem!important;padding-left:1rem!important}.px-xl-4{padding-right:1.5rem!important;padding-left:1.5rem!important}.px-xl-5{padding-right:3rem!important;padding-left:3rem!important}.py-xl-0{padding-top:0!important;padding-bottom:0!important}.py-xl-1{padding-top:.25rem!important;padding-bottom:.25rem!important}.py-xl-2{padding-top:.5rem!important;padding-bottom:.5rem!important}.py-xl-3{padding-top:1rem!important;padding-bottom:1rem!important}.py-xl-4{padding-top:1.5rem!important;padding-bottom:1.5rem!important}.py-xl-5{padding-top:3rem!important;padding-bottom:3rem!important}.pt-xl-0{padding-top:0!important}.pt-xl-1{padding-top:.25rem!important}.pt-xl-2{padding-top:.5rem!important}.pt-xl-3{padding-top:1rem!important}.pt-xl-4{padding-top:1.5rem!important}.pt-xl-5{padding-top:3rem!important}.pe-xl-0{padding-right:0!important}.pe-xl-1{padding-right:.25rem!important}.pe-xl-2{padding-right:.5rem!important}.pe-xl-3{padding-right:1rem!important}.pe-xl-4{padding-right:1.5rem!important}.pe-xl-5{padding-right:3rem!important}.pb-xl-0{padding-bottom:0!important}.pb-xl-1{padding-bottom:.25rem!important}.pb-xl-2{padding-bottom:.5rem!important}.pb-xl-3{padding-bottom:1rem!important}.pb-xl-4{padding-bottom:1.5rem!important}.pb-xl-5{padding-bottom:3rem!important}.ps-xl-0{padding-left:0!important}.ps-xl-1{padding-left:.25rem!important}.ps-xl-2{padding-left:.5rem!important}.ps-xl-3{padding-left:1rem!important}.ps-xl-4{padding-left:1.5rem!important}.ps-xl-5{padding-left:3rem!important}.gap-xl-0{gap:0!important}.gap-xl-1{gap:.25rem!important}.gap-xl-2{gap:.5rem!important}.gap-xl-3{gap:1rem!important}.gap-xl-4{gap:1.5rem!important}.gap-xl-5{gap:3rem!important}.row-gap-xl-0{row-gap:0!important}.row-gap-xl-1{row-gap:.25rem!important}.row-gap-xl-2{row-gap:.5rem!important}.row-gap-xl-3{row-gap:1rem!important}.row-gap-xl-4{row-gap:1.5rem!important}.row-gap-xl-5{row-gap:3rem!important}.column-gap-xl-0{-moz-column-gap:0!important;column-gap:0!important}.column-gap-xl-1{-moz-column-gap:0.25rem!important;column-gap:.25rem!important}.column-gap-xl-2{-moz-column-gap:0.5rem!important;column-gap:.5rem!important}.column-gap-xl-3{-moz-column-gap:1rem!important;column-gap:1rem!important}.column-gap-xl-4{-moz-column-gap:1.5rem!important;column-gap:1.5rem!important}.column-gap-xl-5{-moz-column-gap:3rem!important;column-gap:3rem!important}.text-xl-start{text-align:left!important}.text-xl-end{text-align:right!important}.text-xl-center{text-align:center!important}}@media (min-width:1400px){.float-xxl-start{float:left!important}.float-xxl-end{float:right!important}.float-xxl-none{float:none!important}.object-fit-xxl-contain{-o-object-fit:contain!important;object-fit:contain!important}.object-fit-xxl-cover{-o-object-fit:cover!important;object-fit:cover!important}.object-fit-xxl-fill{-o-object-fit:fill!important;object-fit:fill!important}.object-fit-xxl-scale{-o-object-fit:scale-down!important;object-fit:scale-down!important}.object-fit-xxl-none{-o-object-fit:none!important;object-fit:none!important}.d-xxl-inline{display:inline!important}.d-xxl-inline-block{display:inline-block!important}.d-xxl-block{display:block!important}.d-xxl-grid{display:grid!important}.d-xxl-inline-grid{display:inline-grid!important}.d-xxl-table{display:table!important}.d-xxl-table-row{display:table-row!important}.d-xxl-table-cell{display:table-cell!important}.d-xxl-flex{display:flex!important}.d-xxl-inline-flex{display:inline-flex!important}.d-xxl-none{display:none!important}.flex-xxl-fill{flex:1 1 auto!important}.flex-xxl-row{flex-direction:row!important}.flex-xxl-column{flex-direction:column!important}.flex-xxl-row-reverse{flex-direction:row-reverse!important}.flex-xxl-column-reverse{flex-direction:column-reverse!important}.flex-xxl-grow-0{flex-grow:0!important}.flex-xxl-grow-1{flex-grow:1!important}.flex-xxl-shrink-0{flex-shrink:0!important}.flex-xxl-shrink-1{flex-shrink:1!important}.flex-xxl-wrap{flex-wrap:wrap!important}.flex-xxl-nowrap{flex-wrap:nowrap!important}.flex-xxl-wrap-reverse{flex-wrap:wrap-reverse!important}.justify-content-xxl-start{justify-content:flex-start!important}.justify-content-xxl-end{justify-content:flex-end!important}.justify-content-xxl-center{justify-content:center!important}.justify-content-xxl-between{justify-content:space-between!important}.justify-content-xxl-around{justify-content:space-around!important}.justify-content-xxl-evenly{justify-content:space-evenly!important}.align-items-xxl-start{align-items:flex-start!important}.align-items-xxl-end{align-items:flex-end!important}.align-items-xxl-center{align-items:center!important}.align-items-xxl-baseline{align-items:baseline!important}.align-items-xxl-stretch{align-items:stretch!important}.align-content-xxl-start{align-content:flex-start!important}.align-content-xxl-end{align-content:flex-end!important}.align-content-xxl-center{align-content:center!important}.align-content-xxl-between{align-content:space-between!important}.align-content-xxl-around{align-content:space-around!important}.align-content-xxl-stretch{align-content:stretch!important}.align-self-xxl-auto{align-self:auto!important}.align-self-xxl-start{align-self:flex-start!important}.align-self-xxl-end{align-self:flex-end!important}.align-self-xxl-center{align-self:center!important}.align-self-xxl-baseline{align-self:baseline!important}.align-self-xxl-stretch{align-self:stretch!important}.order-xxl-first{order:-1!important}.order-xxl-0{order:0!important}.order-xxl-1{order:1!important}.order-xxl-2{order:2!important}.order-xxl-3{order:3!important}.order-xxl-4{order:4!important}.order-xxl-5{order:5!important}.order-xxl-last{order:6!important}.m-xxl-0{margin:0!important}.m-xxl-1{margin:.25rem!important}.m-xxl-2{margin:.5rem!important}.m-xxl-3{margin:1rem!important}.m-xxl-4{margin:1.5rem!important}.m-xxl-5{margin:3rem!important}.m-xxl-auto{margin:auto!important}.mx-xxl-0{margin-right:0!important;margin-left:0!important}.mx-xxl-1{margin-right:.25rem!important;margin-left:.25rem!important}.mx-xxl-2{margin-right:.5rem!important;margin-left:.5rem!important}.mx-xxl-3{margin-right:1rem!important;margin-left:1rem!important}.mx-xxl-4{margin-right:1.5rem!important;margin-left:1.5rem!important}.mx-xxl-5{margin-right:3rem!important;margin-left:3rem!important}.mx-xxl-auto{margin-right:auto!important;margin-left:auto!important}.my-xxl-0{margin-top:0!important;margin-bottom:0!important}.my-xxl-1{margin-top:.25rem!important;margin-bottom:.25rem!important}.my-xxl-2{margin-top:.5rem!important;margin-bottom:.5rem!important}.my-xxl-3{margin-top:1rem!important;margin-bottom:1rem!important}.my-xxl-4{margin-top:1.5rem!important;margin-bottom:1.5rem!important}.my-xxl-5{margin-top:3rem!important;margin-bottom:3rem!important}.my-xxl-auto{margin-top:auto!important;margin-bottom:auto!important}.mt-xxl-0{margin-top:0!important}.mt-xxl-1{margin-top:.25rem!important}.mt-xxl-2{margin-top:.5rem!important}.mt-xxl-3{margin-top:1rem!important}.mt-xxl-4{margin-top:1.5rem!important}.mt-xxl-5{margin-top:3rem!important}.mt-xxl-auto{margin-top:auto!important}.me-xxl-0{margin-right:0!important}.me-xxl-1{margin-right:.25rem!important}.me-xxl-2{margin-right:.5rem!important}.me-xxl-3{margin-right:1rem!important}.me-xxl-4{margin-right:1.5rem!important}.me-xxl-5{margin-right:3rem!important}.me-xxl-auto{margin-right:auto!important}.mb-xxl-0{margin-bottom:0!important}.mb-xxl-1{margin-bottom:.25rem!important}.mb-xxl-2{margin-bottom:.5rem!important}.mb-xxl-3{margin-bottom:1rem!important}.mb-xxl-4{margin-bottom:1.5rem!important}.mb-xxl-5{margin-bottom:3rem!important}.mb-xxl-auto{margin-bottom:auto!important}.ms-xxl-0{margin-left:0!important}.ms-xxl-1{margin-left:.25rem!important}.ms-xxl-2{margin-left:.5rem!important}.ms-xxl-3{margin-left:1rem!important}.ms-xxl-4{margin-left:1.5rem!important}.ms-xxl-5{margin-left:3rem!important}.ms-xxl-auto{margin-left:auto!important}.p-xxl-0{padding:0!important}.p-xxl-1{padding:.25rem!important}.p-xxl-2{padding:.5rem!important}.p-xxl-3{padding:1rem!important}.p-xxl-4{padding:1.5rem!important}.p-xxl-5{padding:3rem!important}.px-xxl-0{padding-right:0!important;padding-left:0!important}.px-xxl-1{padding-right:.25rem!important;padding-left:.25rem!important}.px-xxl-2{padding-right:.5rem!important;padding-left:.5rem!important}.px-xxl-3{padding-right:1rem!important;padding-left:1rem!important}.px-xxl-4{padding-right:1.5rem!important;padding-left:1.5rem!important}.px-xxl-5{padding-right:3rem!important;padding-left:3rem!important}.py-xxl-0{padding-top:0!important;padding-bottom:0!important}.py-xxl-1{padding-top:.25rem!important;padding-bottom:.25rem!important}.py-xxl-2{padding-top:.5rem!important;padding-bottom:.5rem!important}.py-xxl-3{padding-top:1rem!important;padding-bottom:1rem!important}.py-xxl-4{padding-top:1.5rem!important;padding-bottom:1.5rem!important}.py-xxl-5{padding-top:3rem!important;padding-bottom:3rem!important}.pt-xxl-0{padding-top:0!important}.pt-xxl-1{padding-top:.25rem!important}.pt-xxl-2{padding-top:.5rem!important}.pt-xxl-3{padding-top:1rem!important}.pt-xxl-4{padding-top:1.5rem!important}.pt-xxl-5{padding-top:3rem!important}.pe-xxl-0{padding-right:0!important}.pe-xxl-1{padding-right:.25rem!important}.pe-xxl-2{padding-right:.5rem!important}.pe-xxl-3{padding-right:1rem!important}.pe-xxl-4{padding-right:1.5rem!important}.pe-xxl-5{padding-right:3rem!important}.pb-xxl-0{padding-bottom:0!important}.pb-xxl-1{padding-bottom:.25rem!important}.pb-xxl-2{padding-bottom:.5rem!important}.pb-xxl-3{padding-bottom:1rem!important}.pb-xxl-4{padding-bottom:1.5rem!important}.pb-xxl-5{padding-bottom:3rem!important}.ps-xxl-0{padding-left:0!important}.ps-xxl-1{padding-left:.25rem!important}.ps-xxl-2{padding-left:.5rem!important}.ps-xxl-3{padding-left:1rem!important}.ps-xxl-4{padding-left:1.5rem!important}.ps-xxl-5{padding-left:3rem!important}.gap-xxl-0{gap:0!important}.gap-xxl-1{gap:.25rem!important}.gap-xxl-2{gap:.5rem!important}.gap-xxl-3{gap:1rem!important}.gap-xxl-4{gap:1.5rem!important}.gap-xxl-5{gap:3rem!important}.row-gap-xxl-0{row-gap:0!important}.row-gap-xxl-1{row-gap:.25rem!important}.row-gap-xxl-2{row-gap:.5rem!important}.row-gap-xxl-3{row-gap:1rem!important}.row-gap-xxl-4{row-gap:1.5rem!important}.row-gap-xxl-5{row-gap:3rem!important}.column-gap-xxl-0{-moz-column-gap:0!important;column-gap:0!important}.column-gap-xxl-1{-moz-column-gap:0.25rem!important;column-gap:.25rem!important}.column-gap-xxl-2{-moz-column-gap:0.5rem!important;column-gap:.5rem!important}.column-gap-xxl-3{-moz-column-gap:1rem!important;column-gap:1rem!important}.column-gap-xxl-4{-moz-column-gap:1.5rem!important;column-gap:1.5rem!important}.column-gap-xxl-5{-moz-column-gap:3rem!important;column-gap:3rem!important}.text-xxl-start{text-align:left!important}.text-xxl-end{text-align:right!important}.text-xxl-center{text-align:center!important}}@media (min-width:1200px){.fs-1{font-size:2.5rem!important}.fs-2{font-size:2rem!important}.fs-3{font-size:1.75rem!important}.fs-4{font-size:1.5rem!important}}@media print{.d-print-inline{display:inline!important}.d-print-inline-block{display:inline-block!important}.d-print-block{display:block!important}.d-print-grid{display:grid!important}.d-print-inline-grid{display:inline-grid!important}.d-print-table{display:table!important}.d-print-table-row{display:table-row!important}.d-print-table-cell{display:table-cell!important}.d-print-flex{display:flex!important}.d-print-inline-flex{display:inline-flex!important}.d-print-none{display:none!important}}`,""]);const K=O},709:(t,e,r)=>{"use strict";r.r(e),r.d(e,{default:()=>s});var o=r(601),n=r.n(o),i=r(314),a=r.n(i)()(n());a.push([t.id,"\n#app[data-v-47c9ecaa] {\n}\n",""]);const s=a},523:(t,e,r)=>{"use strict";r.r(e),r.d(e,{default:()=>s});var o=r(601),n=r.n(o),i=r(314),a=r.n(i)()(n());a.push([t.id,"\n/* Optional: Styling for buttons if necessary */\n",""]);const s=a},591:(t,e,r)=>{"use strict";r.r(e),r.d(e,{default:()=>s});var o=r(601),n=r.n(o),i=r(314),a=r.n(i)()(n());a.push([t.id,"\n/* Optional: You can style the component here */\n",""]);const s=a},684:(t,e,r)=>{"use strict";r.r(e),r.d(e,{default:()=>s});var o=r(601),n=r.n(o),i=r(314),a=r.n(i)()(n());a.push([t.id,"body.mounted footer {\n    display: block !important;\n}\n\n.accordion-button:focus {\n    box-shadow: none;\n    border-color: rgba(0,0,0,.125);\n}",""]);const s=a},314:t=>{"use strict";t.exports=function(t){var e=[];return e.toString=function(){return this.map((function(e){var r="",o=void 0!==e[5];return e[4]&&(r+="@supports (".concat(e[4],") {")),e[2]&&(r+="@media ".concat(e[2]," {")),o&&(r+="@layer".concat(e[5].length>0?" ".concat(e[5]):""," {")),r+=t(e),o&&(r+="}"),e[2]&&(r+="}"),e[4]&&(r+="}"),r})).join("")},e.i=function(t,r,o,n,i){"string"==typeof t&&(t=[[null,t,void 0]]);var a={};if(o)for(var s=0;s<this.length;s++){var l=this[s][0];null!=l&&(a[l]=!0)}for(var d=0;d<t.length;d++){var c=[].concat(t[d]);o&&a[c[0]]||(void 0!==i&&(void 0===c[5]||(c[1]="@layer".concat(c[5].length>0?" ".concat(c[5]):""," {").concat(c[1],"}")),c[5]=i),r&&(c[2]?(c[1]="@media ".concat(c[2]," {").concat(c[1],"}"),c[2]=r):c[2]=r),n&&(c[4]?(c[1]="@supports (".concat(c[4],") {").concat(c[1],"}"),c[4]=n):c[4]="".concat(n)),e.push(c))}},e}},417:t=>{"use strict";t.exports=function(t,e){return e||(e={}),t?(t=String(t.__esModule?t.default:t),/^['"].*['"]$/.test(t)&&(t=t.slice(1,-1)),e.hash&&(t+=e.hash),/["'() \t\n]|(%20)/.test(t)||e.needQuotes?'"'.concat(t.replace(/"/g,'\\"').replace(/\n/g,"\\n"),'"'):t):t}},601:t=>{"use strict";t.exports=function(t){return t[1]}},262:(t,e)=>{"use strict";e.A=(t,e)=>{const r=t.__vccOpts||t;for(const[t,o]of e)r[t]=o;return r}},902:(t,e,r)=>{var o=r(261);o.__esModule&&(o=o.default),"string"==typeof o&&(o=[[t.id,o,""]]),o.locals&&(t.exports=o.locals),(0,r(534).A)("46d99e2a",o,!1,{})},230:(t,e,r)=>{var o=r(709);o.__esModule&&(o=o.default),"string"==typeof o&&(o=[[t.id,o,""]]),o.locals&&(t.exports=o.locals),(0,r(534).A)("4df78cb5",o,!1,{})},648:(t,e,r)=>{var o=r(523);o.__esModule&&(o=o.default),"string"==typeof o&&(o=[[t.id,o,""]]),o.locals&&(t.exports=o.locals),(0,r(534).A)("7d0dfdca",o,!1,{})},254:(t,e,r)=>{var o=r(591);o.__esModule&&(o=o.default),"string"==typeof o&&(o=[[t.id,o,""]]),o.locals&&(t.exports=o.locals),(0,r(534).A)("13755fde",o,!1,{})},277:(t,e,r)=>{var o=r(684);o.__esModule&&(o=o.default),"string"==typeof o&&(o=[[t.id,o,""]]),o.locals&&(t.exports=o.locals),(0,r(534).A)("3a812de8",o,!1,{})},534:(t,e,r)=>{"use strict";function o(t,e){for(var r=[],o={},n=0;n<e.length;n++){var i=e[n],a=i[0],s={id:t+":"+n,css:i[1],media:i[2],sourceMap:i[3]};o[a]?o[a].parts.push(s):r.push(o[a]={id:a,parts:[s]})}return r}r.d(e,{A:()=>g});var n="undefined"!=typeof document;if("undefined"!=typeof DEBUG&&DEBUG&&!n)throw new Error("vue-style-loader cannot be used in a non-browser environment. Use { target: 'node' } in your Webpack config to indicate a server-rendering environment.");var i={},a=n&&(document.head||document.getElementsByTagName("head")[0]),s=null,l=0,d=!1,c=function(){},p=null,b="data-vue-ssr-id",m="undefined"!=typeof navigator&&/msie [6-9]\b/.test(navigator.userAgent.toLowerCase());function g(t,e,r,n){d=r,p=n||{};var a=o(t,e);return f(a),function(e){for(var r=[],n=0;n<a.length;n++){var s=a[n];(l=i[s.id]).refs--,r.push(l)}for(e?f(a=o(t,e)):a=[],n=0;n<r.length;n++){var l;if(0===(l=r[n]).refs){for(var d=0;d<l.parts.length;d++)l.parts[d]();delete i[l.id]}}}}function f(t){for(var e=0;e<t.length;e++){var r=t[e],o=i[r.id];if(o){o.refs++;for(var n=0;n<o.parts.length;n++)o.parts[n](r.parts[n]);for(;n<r.parts.length;n++)o.parts.push(h(r.parts[n]));o.parts.length>r.parts.length&&(o.parts.length=r.parts.length)}else{var a=[];for(n=0;n<r.parts.length;n++)a.push(h(r.parts[n]));i[r.id]={id:r.id,refs:1,parts:a}}}}function u(){var t=document.createElement("style");return t.type="text/css",a.appendChild(t),t}function h(t){var e,r,o=document.querySelector("style["+b+'~="'+t.id+'"]');if(o){if(d)return c;o.parentNode.removeChild(o)}if(m){var n=l++;o=s||(s=u()),e=w.bind(null,o,n,!1),r=w.bind(null,o,n,!0)}else o=u(),e=y.bind(null,o),r=function(){o.parentNode.removeChild(o)};return e(t),function(o){if(o){if(o.css===t.css&&o.media===t.media&&o.sourceMap===t.sourceMap)return;e(t=o)}else r()}}var v,x=(v=[],function(t,e){return v[t]=e,v.filter(Boolean).join("\n")});function w(t,e,r,o){var n=r?"":o.css;if(t.styleSheet)t.styleSheet.cssText=x(e,n);else{var i=document.createTextNode(n),a=t.childNodes;a[e]&&t.removeChild(a[e]),a.length?t.insertBefore(i,a[e]):t.appendChild(i)}}function y(t,e){var r=e.css,o=e.media,n=e.sourceMap;if(o&&t.setAttribute("media",o),p.ssrId&&t.setAttribute(b,e.id),n&&(r+="\n/*# sourceURL="+n.sources[0]+" */",r+="\n/*# sourceMappingURL=data:application/json;base64,"+btoa(unescape(encodeURIComponent(JSON.stringify(n))))+" */"),t.styleSheet)t.styleSheet.cssText=r;else{for(;t.firstChild;)t.removeChild(t.firstChild);t.appendChild(document.createTextNode(r))}}},385:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%27-4 -4 8 8%27%3e%3ccircle r=%272%27 fill=%27%23fff%27/%3e%3c/svg%3e"},782:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%27-4 -4 8 8%27%3e%3ccircle r=%273%27 fill=%27%2386b7fe%27/%3e%3c/svg%3e"},718:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%27-4 -4 8 8%27%3e%3ccircle r=%273%27 fill=%27%23fff%27/%3e%3c/svg%3e"},154:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%27-4 -4 8 8%27%3e%3ccircle r=%273%27 fill=%27rgba%280, 0, 0, 0.25%29%27/%3e%3c/svg%3e"},734:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%27-4 -4 8 8%27%3e%3ccircle r=%273%27 fill=%27rgba%28255, 255, 255, 0.25%29%27/%3e%3c/svg%3e"},372:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 12 12%27 width=%2712%27 height=%2712%27 fill=%27none%27 stroke=%27%23dc3545%27%3e%3ccircle cx=%276%27 cy=%276%27 r=%274.5%27/%3e%3cpath stroke-linejoin=%27round%27 d=%27M5.8 3.6h.4L6 6.5z%27/%3e%3ccircle cx=%276%27 cy=%278.2%27 r=%27.6%27 fill=%27%23dc3545%27 stroke=%27none%27/%3e%3c/svg%3e"},249:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 16 16%27 fill=%27%23000%27%3e%3cpath d=%27M.293.293a1 1 0 0 1 1.414 0L8 6.586 14.293.293a1 1 0 1 1 1.414 1.414L9.414 8l6.293 6.293a1 1 0 0 1-1.414 1.414L8 9.414l-6.293 6.293a1 1 0 0 1-1.414-1.414L6.586 8 .293 1.707a1 1 0 0 1 0-1.414z%27/%3e%3c/svg%3e"},690:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 16 16%27 fill=%27%236ea8fe%27%3e%3cpath fill-rule=%27evenodd%27 d=%27M1.646 4.646a.5.5 0 0 1 .708 0L8 10.293l5.646-5.647a.5.5 0 0 1 .708.708l-6 6a.5.5 0 0 1-.708 0l-6-6a.5.5 0 0 1 0-.708z%27/%3e%3c/svg%3e"},932:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 16 16%27 fill=%27%23fff%27%3e%3cpath d=%27M11.354 1.646a.5.5 0 0 1 0 .708L5.707 8l5.647 5.646a.5.5 0 0 1-.708.708l-6-6a.5.5 0 0 1 0-.708l6-6a.5.5 0 0 1 .708 0z%27/%3e%3c/svg%3e"},144:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 16 16%27 fill=%27%23fff%27%3e%3cpath d=%27M4.646 1.646a.5.5 0 0 1 .708 0l6 6a.5.5 0 0 1 0 .708l-6 6a.5.5 0 0 1-.708-.708L10.293 8 4.646 2.354a.5.5 0 0 1 0-.708z%27/%3e%3c/svg%3e"},210:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 16 16%27 fill=%27none%27 stroke=%27%23052c65%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3e%3cpath d=%27M2 5L8 11L14 5%27/%3e%3c/svg%3e"},326:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 16 16%27 fill=%27none%27 stroke=%27%23212529%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3e%3cpath d=%27M2 5L8 11L14 5%27/%3e%3c/svg%3e"},531:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 16 16%27%3e%3cpath fill=%27none%27 stroke=%27%23343a40%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27 stroke-width=%272%27 d=%27m2 5 6 6 6-6%27/%3e%3c/svg%3e"},115:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 16 16%27%3e%3cpath fill=%27none%27 stroke=%27%23dee2e6%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27 stroke-width=%272%27 d=%27m2 5 6 6 6-6%27/%3e%3c/svg%3e"},274:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 20 20%27%3e%3cpath fill=%27none%27 stroke=%27%23fff%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27 stroke-width=%273%27 d=%27M6 10h8%27/%3e%3c/svg%3e"},419:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 20 20%27%3e%3cpath fill=%27none%27 stroke=%27%23fff%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27 stroke-width=%273%27 d=%27m6 10 3 3 6-6%27/%3e%3c/svg%3e"},366:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 30 30%27%3e%3cpath stroke=%27rgba%28255, 255, 255, 0.55%29%27 stroke-linecap=%27round%27 stroke-miterlimit=%2710%27 stroke-width=%272%27 d=%27M4 7h22M4 15h22M4 23h22%27/%3e%3c/svg%3e"},247:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 30 30%27%3e%3cpath stroke=%27rgba%2833, 37, 41, 0.75%29%27 stroke-linecap=%27round%27 stroke-miterlimit=%2710%27 stroke-width=%272%27 d=%27M4 7h22M4 15h22M4 23h22%27/%3e%3c/svg%3e"},487:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 8 8%27%3e%3cpath fill=%27%23198754%27 d=%27M2.3 6.73.6 4.53c-.4-1.04.46-1.4 1.1-.8l1.1 1.4 3.4-3.8c.6-.63 1.6-.27 1.2.7l-4 4.6c-.43.5-.8.4-1.1.1z%27/%3e%3c/svg%3e"}},e={};function r(o){var n=e[o];if(void 0!==n)return n.exports;var i=e[o]={id:o,exports:{}};return t[o](i,i.exports,r),i.exports}r.m=t,r.n=t=>{var e=t&&t.__esModule?()=>t.default:()=>t;return r.d(e,{a:e}),e},r.d=(t,e)=>{for(var o in e)r.o(e,o)&&!r.o(t,o)&&Object.defineProperty(t,o,{enumerable:!0,get:e[o]})},r.g=function(){if("object"==typeof globalThis)return globalThis;try{return this||new Function("return this")()}catch(t){if("object"==typeof window)return window}}(),r.o=(t,e)=>Object.prototype.hasOwnProperty.call(t,e),r.r=t=>{"undefined"!=typeof Symbol&&Symbol.toStringTag&&Object.defineProperty(t,Symbol.toStringTag,{value:"Module"}),Object.defineProperty(t,"__esModule",{value:!0})},r.b=document.baseURI||self.location.href,(()=>{"use strict";var t={};r.r(t),r.d(t,{hasBrowserEnv:()=>_a,hasStandardBrowserEnv:()=>Ea,hasStandardBrowserWebWorkerEnv:()=>Aa,navigator:()=>ka,origin:()=>Sa});var e={};function o(t){const e=Object.create(null);for(const r of t.split(","))e[r]=1;return t=>t in e}r.r(e),r.d(e,{afterMain:()=>Cd,afterRead:()=>Sd,afterWrite:()=>Ld,applyStyles:()=>Bd,arrow:()=>ic,auto:()=>gd,basePlacements:()=>fd,beforeMain:()=>Td,beforeRead:()=>Ed,beforeWrite:()=>jd,bottom:()=>pd,clippingParents:()=>vd,computeStyles:()=>dc,createPopper:()=>Ic,createPopperBase:()=>Nc,createPopperLite:()=>Bc,detectOverflow:()=>Ec,end:()=>hd,eventListeners:()=>pc,flip:()=>Ac,hide:()=>Oc,left:()=>md,main:()=>Od,modifierPhases:()=>Rd,offset:()=>Cc,placements:()=>kd,popper:()=>wd,popperGenerator:()=>Mc,popperOffsets:()=>jc,preventOverflow:()=>zc,read:()=>Ad,reference:()=>yd,right:()=>bd,start:()=>ud,top:()=>cd,variationPlacements:()=>_d,viewport:()=>xd,write:()=>zd});const n={},i=[],a=()=>{},s=()=>!1,l=t=>111===t.charCodeAt(0)&&110===t.charCodeAt(1)&&(t.charCodeAt(2)>122||t.charCodeAt(2)<97),d=t=>t.startsWith("onUpdate:"),c=Object.assign,p=(t,e)=>{const r=t.indexOf(e);r>-1&&t.splice(r,1)},b=Object.prototype.hasOwnProperty,m=(t,e)=>b.call(t,e),g=Array.isArray,f=t=>"[object Map]"===E(t),u=t=>"[object Set]"===E(t),h=t=>"[object Date]"===E(t),v=t=>"function"==typeof t,x=t=>"string"==typeof t,w=t=>"symbol"==typeof t,y=t=>null!==t&&"object"==typeof t,_=t=>(y(t)||v(t))&&v(t.then)&&v(t.catch),k=Object.prototype.toString,E=t=>k.call(t),A=t=>"[object Object]"===E(t),S=t=>x(t)&&"NaN"!==t&&"-"!==t[0]&&""+parseInt(t,10)===t,T=o(",key,ref,ref_for,ref_key,onVnodeBeforeMount,onVnodeMounted,onVnodeBeforeUpdate,onVnodeUpdated,onVnodeBeforeUnmount,onVnodeUnmounted"),O=t=>{const e=Object.create(null);return r=>e[r]||(e[r]=t(r))},C=/-(\w)/g,j=O((t=>t.replace(C,((t,e)=>e?e.toUpperCase():"")))),z=/\B([A-Z])/g,L=O((t=>t.replace(z,"-$1").toLowerCase())),R=O((t=>t.charAt(0).toUpperCase()+t.slice(1))),P=O((t=>t?`on${R(t)}`:"")),D=(t,e)=>!Object.is(t,e),M=(t,...e)=>{for(let r=0;r<t.length;r++)t[r](...e)},N=(t,e,r,o=!1)=>{Object.defineProperty(t,e,{configurable:!0,enumerable:!1,writable:o,value:r})},I=t=>{const e=parseFloat(t);return isNaN(e)?t:e};let B;const F=()=>B||(B="undefined"!=typeof globalThis?globalThis:"undefined"!=typeof self?self:"undefined"!=typeof window?window:void 0!==r.g?r.g:{});function $(t){if(g(t)){const e={};for(let r=0;r<t.length;r++){const o=t[r],n=x(o)?H(o):$(o);if(n)for(const t in n)e[t]=n[t]}return e}if(x(t)||y(t))return t}const U=/;(?![^(]*\))/g,V=/:([^]+)/,W=/\/\*[^]*?\*\//g;function H(t){const e={};return t.replace(W,"").split(U).forEach((t=>{if(t){const r=t.split(V);r.length>1&&(e[r[0].trim()]=r[1].trim())}})),e}function q(t){let e="";if(x(t))e=t;else if(g(t))for(let r=0;r<t.length;r++){const o=q(t[r]);o&&(e+=o+" ")}else if(y(t))for(const r in t)t[r]&&(e+=r+" ");return e.trim()}const G=o("itemscope,allowfullscreen,formnovalidate,ismap,nomodule,novalidate,readonly");function K(t){return!!t||""===t}function X(t,e){if(t===e)return!0;let r=h(t),o=h(e);if(r||o)return!(!r||!o)&&t.getTime()===e.getTime();if(r=w(t),o=w(e),r||o)return t===e;if(r=g(t),o=g(e),r||o)return!(!r||!o)&&function(t,e){if(t.length!==e.length)return!1;let r=!0;for(let o=0;r&&o<t.length;o++)r=X(t[o],e[o]);return r}(t,e);if(r=y(t),o=y(e),r||o){if(!r||!o)return!1;if(Object.keys(t).length!==Object.keys(e).length)return!1;for(const r in t){const o=t.hasOwnProperty(r),n=e.hasOwnProperty(r);if(o&&!n||!o&&n||!X(t[r],e[r]))return!1}}return String(t)===String(e)}function Y(t,e){return t.findIndex((t=>X(t,e)))}const J=t=>!(!t||!0!==t.__v_isRef),Q=t=>x(t)?t:null==t?"":g(t)||y(t)&&(t.toString===k||!v(t.toString))?J(t)?Q(t.value):JSON.stringify(t,Z,2):String(t),Z=(t,e)=>J(e)?Z(t,e.value):f(e)?{[`Map(${e.size})`]:[...e.entries()].reduce(((t,[e,r],o)=>(t[tt(e,o)+" =>"]=r,t)),{})}:u(e)?{[`Set(${e.size})`]:[...e.values()].map((t=>tt(t)))}:w(e)?tt(e):!y(e)||g(e)||A(e)?e:String(e),tt=(t,e="")=>{var r;return w(t)?`Symbol(${null!=(r=t.description)?r:e})`:t};let et,rt;class ot{constructor(t=!1){this.detached=t,this._active=!0,this.effects=[],this.cleanups=[],this._isPaused=!1,this.parent=et,!t&&et&&(this.index=(et.scopes||(et.scopes=[])).push(this)-1)}get active(){return this._active}pause(){if(this._active){let t,e;if(this._isPaused=!0,this.scopes)for(t=0,e=this.scopes.length;t<e;t++)this.scopes[t].pause();for(t=0,e=this.effects.length;t<e;t++)this.effects[t].pause()}}resume(){if(this._active&&this._isPaused){let t,e;if(this._isPaused=!1,this.scopes)for(t=0,e=this.scopes.length;t<e;t++)this.scopes[t].resume();for(t=0,e=this.effects.length;t<e;t++)this.effects[t].resume()}}run(t){if(this._active){const e=et;try{return et=this,t()}finally{et=e}}}on(){et=this}off(){et=this.parent}stop(t){if(this._active){let e,r;for(e=0,r=this.effects.length;e<r;e++)this.effects[e].stop();for(e=0,r=this.cleanups.length;e<r;e++)this.cleanups[e]();if(this.scopes)for(e=0,r=this.scopes.length;e<r;e++)this.scopes[e].stop(!0);if(!this.detached&&this.parent&&!t){const t=this.parent.scopes.pop();t&&t!==this&&(this.parent.scopes[this.index]=t,t.index=this.index)}this.parent=void 0,this._active=!1}}}const nt=new WeakSet;class it{constructor(t){this.fn=t,this.deps=void 0,this.depsTail=void 0,this.flags=5,this.next=void 0,this.cleanup=void 0,this.scheduler=void 0,et&&et.active&&et.effects.push(this)}pause(){this.flags|=64}resume(){64&this.flags&&(this.flags&=-65,nt.has(this)&&(nt.delete(this),this.trigger()))}notify(){2&this.flags&&!(32&this.flags)||8&this.flags||dt(this)}run(){if(!(1&this.flags))return this.fn();this.flags|=2,_t(this),bt(this);const t=rt,e=vt;rt=this,vt=!0;try{return this.fn()}finally{mt(this),rt=t,vt=e,this.flags&=-3}}stop(){if(1&this.flags){for(let t=this.deps;t;t=t.nextDep)ut(t);this.deps=this.depsTail=void 0,_t(this),this.onStop&&this.onStop(),this.flags&=-2}}trigger(){64&this.flags?nt.add(this):this.scheduler?this.scheduler():this.runIfDirty()}runIfDirty(){gt(this)&&this.run()}get dirty(){return gt(this)}}let at,st,lt=0;function dt(t,e=!1){if(t.flags|=8,e)return t.next=st,void(st=t);t.next=at,at=t}function ct(){lt++}function pt(){if(--lt>0)return;if(st){let t=st;for(st=void 0;t;){const e=t.next;t.next=void 0,t.flags&=-9,t=e}}let t;for(;at;){let e=at;for(at=void 0;e;){const r=e.next;if(e.next=void 0,e.flags&=-9,1&e.flags)try{e.trigger()}catch(e){t||(t=e)}e=r}}if(t)throw t}function bt(t){for(let e=t.deps;e;e=e.nextDep)e.version=-1,e.prevActiveLink=e.dep.activeLink,e.dep.activeLink=e}function mt(t){let e,r=t.depsTail,o=r;for(;o;){const t=o.prevDep;-1===o.version?(o===r&&(r=t),ut(o),ht(o)):e=o,o.dep.activeLink=o.prevActiveLink,o.prevActiveLink=void 0,o=t}t.deps=e,t.depsTail=r}function gt(t){for(let e=t.deps;e;e=e.nextDep)if(e.dep.version!==e.version||e.dep.computed&&(ft(e.dep.computed)||e.dep.version!==e.version))return!0;return!!t._dirty}function ft(t){if(4&t.flags&&!(16&t.flags))return;if(t.flags&=-17,t.globalVersion===kt)return;t.globalVersion=kt;const e=t.dep;if(t.flags|=2,e.version>0&&!t.isSSR&&t.deps&&!gt(t))return void(t.flags&=-3);const r=rt,o=vt;rt=t,vt=!0;try{bt(t);const r=t.fn(t._value);(0===e.version||D(r,t._value))&&(t._value=r,e.version++)}catch(t){throw e.version++,t}finally{rt=r,vt=o,mt(t),t.flags&=-3}}function ut(t,e=!1){const{dep:r,prevSub:o,nextSub:n}=t;if(o&&(o.nextSub=n,t.prevSub=void 0),n&&(n.prevSub=o,t.nextSub=void 0),r.subs===t&&(r.subs=o,!o&&r.computed)){r.computed.flags&=-5;for(let t=r.computed.deps;t;t=t.nextDep)ut(t,!0)}e||--r.sc||!r.map||r.map.delete(r.key)}function ht(t){const{prevDep:e,nextDep:r}=t;e&&(e.nextDep=r,t.prevDep=void 0),r&&(r.prevDep=e,t.nextDep=void 0)}let vt=!0;const xt=[];function wt(){xt.push(vt),vt=!1}function yt(){const t=xt.pop();vt=void 0===t||t}function _t(t){const{cleanup:e}=t;if(t.cleanup=void 0,e){const t=rt;rt=void 0;try{e()}finally{rt=t}}}let kt=0;class Et{constructor(t,e){this.sub=t,this.dep=e,this.version=e.version,this.nextDep=this.prevDep=this.nextSub=this.prevSub=this.prevActiveLink=void 0}}class At{constructor(t){this.computed=t,this.version=0,this.activeLink=void 0,this.subs=void 0,this.map=void 0,this.key=void 0,this.sc=0}track(t){if(!rt||!vt||rt===this.computed)return;let e=this.activeLink;if(void 0===e||e.sub!==rt)e=this.activeLink=new Et(rt,this),rt.deps?(e.prevDep=rt.depsTail,rt.depsTail.nextDep=e,rt.depsTail=e):rt.deps=rt.depsTail=e,St(e);else if(-1===e.version&&(e.version=this.version,e.nextDep)){const t=e.nextDep;t.prevDep=e.prevDep,e.prevDep&&(e.prevDep.nextDep=t),e.prevDep=rt.depsTail,e.nextDep=void 0,rt.depsTail.nextDep=e,rt.depsTail=e,rt.deps===e&&(rt.deps=t)}return e}trigger(t){this.version++,kt++,this.notify(t)}notify(t){ct();try{for(let t=this.subs;t;t=t.prevSub)t.sub.notify()&&t.sub.dep.notify()}finally{pt()}}}function St(t){if(t.dep.sc++,4&t.sub.flags){const e=t.dep.computed;if(e&&!t.dep.subs){e.flags|=20;for(let t=e.deps;t;t=t.nextDep)St(t)}const r=t.dep.subs;r!==t&&(t.prevSub=r,r&&(r.nextSub=t)),t.dep.subs=t}}const Tt=new WeakMap,Ot=Symbol(""),Ct=Symbol(""),jt=Symbol("");function zt(t,e,r){if(vt&&rt){let e=Tt.get(t);e||Tt.set(t,e=new Map);let o=e.get(r);o||(e.set(r,o=new At),o.map=e,o.key=r),o.track()}}function Lt(t,e,r,o,n,i){const a=Tt.get(t);if(!a)return void kt++;const s=t=>{t&&t.trigger()};if(ct(),"clear"===e)a.forEach(s);else{const n=g(t),i=n&&S(r);if(n&&"length"===r){const t=Number(o);a.forEach(((e,r)=>{("length"===r||r===jt||!w(r)&&r>=t)&&s(e)}))}else switch((void 0!==r||a.has(void 0))&&s(a.get(r)),i&&s(a.get(jt)),e){case"add":n?i&&s(a.get("length")):(s(a.get(Ot)),f(t)&&s(a.get(Ct)));break;case"delete":n||(s(a.get(Ot)),f(t)&&s(a.get(Ct)));break;case"set":f(t)&&s(a.get(Ot))}}pt()}function Rt(t){const e=fe(t);return e===t?e:(zt(e,0,jt),me(t)?e:e.map(ue))}function Pt(t){return zt(t=fe(t),0,jt),t}const Dt={__proto__:null,[Symbol.iterator](){return Mt(this,Symbol.iterator,ue)},concat(...t){return Rt(this).concat(...t.map((t=>g(t)?Rt(t):t)))},entries(){return Mt(this,"entries",(t=>(t[1]=ue(t[1]),t)))},every(t,e){return It(this,"every",t,e,void 0,arguments)},filter(t,e){return It(this,"filter",t,e,(t=>t.map(ue)),arguments)},find(t,e){return It(this,"find",t,e,ue,arguments)},findIndex(t,e){return It(this,"findIndex",t,e,void 0,arguments)},findLast(t,e){return It(this,"findLast",t,e,ue,arguments)},findLastIndex(t,e){return It(this,"findLastIndex",t,e,void 0,arguments)},forEach(t,e){return It(this,"forEach",t,e,void 0,arguments)},includes(...t){return Ft(this,"includes",t)},indexOf(...t){return Ft(this,"indexOf",t)},join(t){return Rt(this).join(t)},lastIndexOf(...t){return Ft(this,"lastIndexOf",t)},map(t,e){return It(this,"map",t,e,void 0,arguments)},pop(){return $t(this,"pop")},push(...t){return $t(this,"push",t)},reduce(t,...e){return Bt(this,"reduce",t,e)},reduceRight(t,...e){return Bt(this,"reduceRight",t,e)},shift(){return $t(this,"shift")},some(t,e){return It(this,"some",t,e,void 0,arguments)},splice(...t){return $t(this,"splice",t)},toReversed(){return Rt(this).toReversed()},toSorted(t){return Rt(this).toSorted(t)},toSpliced(...t){return Rt(this).toSpliced(...t)},unshift(...t){return $t(this,"unshift",t)},values(){return Mt(this,"values",ue)}};function Mt(t,e,r){const o=Pt(t),n=o[e]();return o===t||me(t)||(n._next=n.next,n.next=()=>{const t=n._next();return t.value&&(t.value=r(t.value)),t}),n}const Nt=Array.prototype;function It(t,e,r,o,n,i){const a=Pt(t),s=a!==t&&!me(t),l=a[e];if(l!==Nt[e]){const e=l.apply(t,i);return s?ue(e):e}let d=r;a!==t&&(s?d=function(e,o){return r.call(this,ue(e),o,t)}:r.length>2&&(d=function(e,o){return r.call(this,e,o,t)}));const c=l.call(a,d,o);return s&&n?n(c):c}function Bt(t,e,r,o){const n=Pt(t);let i=r;return n!==t&&(me(t)?r.length>3&&(i=function(e,o,n){return r.call(this,e,o,n,t)}):i=function(e,o,n){return r.call(this,e,ue(o),n,t)}),n[e](i,...o)}function Ft(t,e,r){const o=fe(t);zt(o,0,jt);const n=o[e](...r);return-1!==n&&!1!==n||!ge(r[0])?n:(r[0]=fe(r[0]),o[e](...r))}function $t(t,e,r=[]){wt(),ct();const o=fe(t)[e].apply(t,r);return pt(),yt(),o}const Ut=o("__proto__,__v_isRef,__isVue"),Vt=new Set(Object.getOwnPropertyNames(Symbol).filter((t=>"arguments"!==t&&"caller"!==t)).map((t=>Symbol[t])).filter(w));function Wt(t){w(t)||(t=String(t));const e=fe(this);return zt(e,0,t),e.hasOwnProperty(t)}class Ht{constructor(t=!1,e=!1){this._isReadonly=t,this._isShallow=e}get(t,e,r){const o=this._isReadonly,n=this._isShallow;if("__v_isReactive"===e)return!o;if("__v_isReadonly"===e)return o;if("__v_isShallow"===e)return n;if("__v_raw"===e)return r===(o?n?se:ae:n?ie:ne).get(t)||Object.getPrototypeOf(t)===Object.getPrototypeOf(r)?t:void 0;const i=g(t);if(!o){let t;if(i&&(t=Dt[e]))return t;if("hasOwnProperty"===e)return Wt}const a=Reflect.get(t,e,ve(t)?t:r);return(w(e)?Vt.has(e):Ut(e))?a:(o||zt(t,0,e),n?a:ve(a)?i&&S(e)?a:a.value:y(a)?o?de(a):le(a):a)}}class qt extends Ht{constructor(t=!1){super(!1,t)}set(t,e,r,o){let n=t[e];if(!this._isShallow){const e=be(n);if(me(r)||be(r)||(n=fe(n),r=fe(r)),!g(t)&&ve(n)&&!ve(r))return!e&&(n.value=r,!0)}const i=g(t)&&S(e)?Number(e)<t.length:m(t,e),a=Reflect.set(t,e,r,ve(t)?t:o);return t===fe(o)&&(i?D(r,n)&&Lt(t,"set",e,r):Lt(t,"add",e,r)),a}deleteProperty(t,e){const r=m(t,e),o=(t[e],Reflect.deleteProperty(t,e));return o&&r&&Lt(t,"delete",e,void 0),o}has(t,e){const r=Reflect.has(t,e);return w(e)&&Vt.has(e)||zt(t,0,e),r}ownKeys(t){return zt(t,0,g(t)?"length":Ot),Reflect.ownKeys(t)}}class Gt extends Ht{constructor(t=!1){super(!0,t)}set(t,e){return!0}deleteProperty(t,e){return!0}}const Kt=new qt,Xt=new Gt,Yt=new qt(!0),Jt=t=>t,Qt=t=>Reflect.getPrototypeOf(t);function Zt(t){return function(...e){return"delete"!==t&&("clear"===t?void 0:this)}}function te(t,e){const r=function(t,e){const r={get(r){const o=this.__v_raw,n=fe(o),i=fe(r);t||(D(r,i)&&zt(n,0,r),zt(n,0,i));const{has:a}=Qt(n),s=e?Jt:t?he:ue;return a.call(n,r)?s(o.get(r)):a.call(n,i)?s(o.get(i)):void(o!==n&&o.get(r))},get size(){const e=this.__v_raw;return!t&&zt(fe(e),0,Ot),Reflect.get(e,"size",e)},has(e){const r=this.__v_raw,o=fe(r),n=fe(e);return t||(D(e,n)&&zt(o,0,e),zt(o,0,n)),e===n?r.has(e):r.has(e)||r.has(n)},forEach(r,o){const n=this,i=n.__v_raw,a=fe(i),s=e?Jt:t?he:ue;return!t&&zt(a,0,Ot),i.forEach(((t,e)=>r.call(o,s(t),s(e),n)))}};return c(r,t?{add:Zt("add"),set:Zt("set"),delete:Zt("delete"),clear:Zt("clear")}:{add(t){e||me(t)||be(t)||(t=fe(t));const r=fe(this);return Qt(r).has.call(r,t)||(r.add(t),Lt(r,"add",t,t)),this},set(t,r){e||me(r)||be(r)||(r=fe(r));const o=fe(this),{has:n,get:i}=Qt(o);let a=n.call(o,t);a||(t=fe(t),a=n.call(o,t));const s=i.call(o,t);return o.set(t,r),a?D(r,s)&&Lt(o,"set",t,r):Lt(o,"add",t,r),this},delete(t){const e=fe(this),{has:r,get:o}=Qt(e);let n=r.call(e,t);n||(t=fe(t),n=r.call(e,t)),o&&o.call(e,t);const i=e.delete(t);return n&&Lt(e,"delete",t,void 0),i},clear(){const t=fe(this),e=0!==t.size,r=t.clear();return e&&Lt(t,"clear",void 0,void 0),r}}),["keys","values","entries",Symbol.iterator].forEach((o=>{r[o]=function(t,e,r){return function(...o){const n=this.__v_raw,i=fe(n),a=f(i),s="entries"===t||t===Symbol.iterator&&a,l="keys"===t&&a,d=n[t](...o),c=r?Jt:e?he:ue;return!e&&zt(i,0,l?Ct:Ot),{next(){const{value:t,done:e}=d.next();return e?{value:t,done:e}:{value:s?[c(t[0]),c(t[1])]:c(t),done:e}},[Symbol.iterator](){return this}}}}(o,t,e)})),r}(t,e);return(e,o,n)=>"__v_isReactive"===o?!t:"__v_isReadonly"===o?t:"__v_raw"===o?e:Reflect.get(m(r,o)&&o in e?r:e,o,n)}const ee={get:te(!1,!1)},re={get:te(!1,!0)},oe={get:te(!0,!1)},ne=new WeakMap,ie=new WeakMap,ae=new WeakMap,se=new WeakMap;function le(t){return be(t)?t:ce(t,!1,Kt,ee,ne)}function de(t){return ce(t,!0,Xt,oe,ae)}function ce(t,e,r,o,n){if(!y(t))return t;if(t.__v_raw&&(!e||!t.__v_isReactive))return t;const i=n.get(t);if(i)return i;const a=(s=t).__v_skip||!Object.isExtensible(s)?0:function(t){switch(t){case"Object":case"Array":return 1;case"Map":case"Set":case"WeakMap":case"WeakSet":return 2;default:return 0}}((t=>E(t).slice(8,-1))(s));var s;if(0===a)return t;const l=new Proxy(t,2===a?o:r);return n.set(t,l),l}function pe(t){return be(t)?pe(t.__v_raw):!(!t||!t.__v_isReactive)}function be(t){return!(!t||!t.__v_isReadonly)}function me(t){return!(!t||!t.__v_isShallow)}function ge(t){return!!t&&!!t.__v_raw}function fe(t){const e=t&&t.__v_raw;return e?fe(e):t}const ue=t=>y(t)?le(t):t,he=t=>y(t)?de(t):t;function ve(t){return!!t&&!0===t.__v_isRef}const xe={get:(t,e,r)=>{return"__v_raw"===e?t:ve(o=Reflect.get(t,e,r))?o.value:o;var o},set:(t,e,r,o)=>{const n=t[e];return ve(n)&&!ve(r)?(n.value=r,!0):Reflect.set(t,e,r,o)}};function we(t){return pe(t)?t:new Proxy(t,xe)}class ye{constructor(t,e,r){this.fn=t,this.setter=e,this._value=void 0,this.dep=new At(this),this.__v_isRef=!0,this.deps=void 0,this.depsTail=void 0,this.flags=16,this.globalVersion=kt-1,this.next=void 0,this.effect=this,this.__v_isReadonly=!e,this.isSSR=r}notify(){if(this.flags|=16,!(8&this.flags||rt===this))return dt(this,!0),!0}get value(){const t=this.dep.track();return ft(this),t&&(t.version=this.dep.version),this._value}set value(t){this.setter&&this.setter(t)}}const _e={},ke=new WeakMap;let Ee;function Ae(t,e=1/0,r){if(e<=0||!y(t)||t.__v_skip)return t;if((r=r||new Set).has(t))return t;if(r.add(t),e--,ve(t))Ae(t.value,e,r);else if(g(t))for(let o=0;o<t.length;o++)Ae(t[o],e,r);else if(u(t)||f(t))t.forEach((t=>{Ae(t,e,r)}));else if(A(t)){for(const o in t)Ae(t[o],e,r);for(const o of Object.getOwnPropertySymbols(t))Object.prototype.propertyIsEnumerable.call(t,o)&&Ae(t[o],e,r)}return t}function Se(t,e,r,o){try{return o?t(...o):t()}catch(t){Oe(t,e,r)}}function Te(t,e,r,o){if(v(t)){const n=Se(t,e,r,o);return n&&_(n)&&n.catch((t=>{Oe(t,e,r)})),n}if(g(t)){const n=[];for(let i=0;i<t.length;i++)n.push(Te(t[i],e,r,o));return n}}function Oe(t,e,r,o=!0){e&&e.vnode;const{errorHandler:i,throwUnhandledErrorInProduction:a}=e&&e.appContext.config||n;if(e){let o=e.parent;const n=e.proxy,a=`https://vuejs.org/error-reference/#runtime-${r}`;for(;o;){const e=o.ec;if(e)for(let r=0;r<e.length;r++)if(!1===e[r](t,n,a))return;o=o.parent}if(i)return wt(),Se(i,null,10,[t,n,a]),void yt()}!function(t,e,r,o=!0,n=!1){if(n)throw t;console.error(t)}(t,0,0,o,a)}const Ce=[];let je=-1;const ze=[];let Le=null,Re=0;const Pe=Promise.resolve();let De=null;function Me(t){const e=De||Pe;return t?e.then(this?t.bind(this):t):e}function Ne(t){if(!(1&t.flags)){const e=$e(t),r=Ce[Ce.length-1];!r||!(2&t.flags)&&e>=$e(r)?Ce.push(t):Ce.splice(function(t){let e=je+1,r=Ce.length;for(;e<r;){const o=e+r>>>1,n=Ce[o],i=$e(n);i<t||i===t&&2&n.flags?e=o+1:r=o}return e}(e),0,t),t.flags|=1,Ie()}}function Ie(){De||(De=Pe.then(Ue))}function Be(t,e,r=je+1){for(;r<Ce.length;r++){const e=Ce[r];if(e&&2&e.flags){if(t&&e.id!==t.uid)continue;Ce.splice(r,1),r--,4&e.flags&&(e.flags&=-2),e(),4&e.flags||(e.flags&=-2)}}}function Fe(t){if(ze.length){const t=[...new Set(ze)].sort(((t,e)=>$e(t)-$e(e)));if(ze.length=0,Le)return void Le.push(...t);for(Le=t,Re=0;Re<Le.length;Re++){const t=Le[Re];4&t.flags&&(t.flags&=-2),8&t.flags||t(),t.flags&=-2}Le=null,Re=0}}const $e=t=>null==t.id?2&t.flags?-1:1/0:t.id;function Ue(t){try{for(je=0;je<Ce.length;je++){const t=Ce[je];!t||8&t.flags||(4&t.flags&&(t.flags&=-2),Se(t,t.i,t.i?15:14),4&t.flags||(t.flags&=-2))}}finally{for(;je<Ce.length;je++){const t=Ce[je];t&&(t.flags&=-2)}je=-1,Ce.length=0,Fe(),De=null,(Ce.length||ze.length)&&Ue(t)}}let Ve,We=[],He=!1;function qe(t,...e){Ve?Ve.emit(t,...e):He||We.push({event:t,args:e})}function Ge(t,e){var r,o;Ve=t,Ve?(Ve.enabled=!0,We.forEach((({event:t,args:e})=>Ve.emit(t,...e))),We=[]):"undefined"!=typeof window&&window.HTMLElement&&!(null==(o=null==(r=window.navigator)?void 0:r.userAgent)?void 0:o.includes("jsdom"))?((e.__VUE_DEVTOOLS_HOOK_REPLAY__=e.__VUE_DEVTOOLS_HOOK_REPLAY__||[]).push((t=>{Ge(t,e)})),setTimeout((()=>{Ve||(e.__VUE_DEVTOOLS_HOOK_REPLAY__=null,He=!0,We=[])}),3e3)):(He=!0,We=[])}const Ke=Je("component:added"),Xe=Je("component:updated"),Ye=Je("component:removed");function Je(t){return e=>{qe(t,e.appContext.app,e.uid,e.parent?e.parent.uid:void 0,e)}}let Qe=null,Ze=null;function tr(t){const e=Qe;return Qe=t,Ze=t&&t.type.__scopeId||null,e}function er(t,e){if(null===Qe)return t;const r=xn(Qe),o=t.dirs||(t.dirs=[]);for(let t=0;t<e.length;t++){let[i,a,s,l=n]=e[t];i&&(v(i)&&(i={mounted:i,updated:i}),i.deep&&Ae(a),o.push({dir:i,instance:r,value:a,oldValue:void 0,arg:s,modifiers:l}))}return t}function rr(t,e,r,o){const n=t.dirs,i=e&&e.dirs;for(let a=0;a<n.length;a++){const s=n[a];i&&(s.oldValue=i[a].value);let l=s.dir[o];l&&(wt(),Te(l,r,8,[t.el,s,t,e]),yt())}}const or=Symbol("_vte");Symbol("_leaveCb"),Symbol("_enterCb");function nr(t,e){6&t.shapeFlag&&t.component?(t.transition=e,nr(t.component.subTree,e)):128&t.shapeFlag?(t.ssContent.transition=e.clone(t.ssContent),t.ssFallback.transition=e.clone(t.ssFallback)):t.transition=e}function ir(t){t.ids=[t.ids[0]+t.ids[2]+++"-",0,0]}function ar(t,e,r,o,i=!1){if(g(t))return void t.forEach(((t,n)=>ar(t,e&&(g(e)?e[n]:e),r,o,i)));if(sr(o)&&!i)return;const a=4&o.shapeFlag?xn(o.component):o.el,s=i?null:a,{i:l,r:d}=t,c=e&&e.r,b=l.refs===n?l.refs={}:l.refs,f=l.setupState,u=fe(f),h=f===n?()=>!1:t=>m(u,t);if(null!=c&&c!==d&&(x(c)?(b[c]=null,h(c)&&(f[c]=null)):ve(c)&&(c.value=null)),v(d))Se(d,l,12,[s,b]);else{const e=x(d),o=ve(d);if(e||o){const n=()=>{if(t.f){const r=e?h(d)?f[d]:b[d]:d.value;i?g(r)&&p(r,a):g(r)?r.includes(a)||r.push(a):e?(b[d]=[a],h(d)&&(f[d]=b[d])):(d.value=[a],t.k&&(b[t.k]=d.value))}else e?(b[d]=s,h(d)&&(f[d]=s)):o&&(d.value=s,t.k&&(b[t.k]=s))};s?(n.id=-1,bo(n,r)):n()}}}Boolean,Boolean,F().requestIdleCallback,F().cancelIdleCallback;const sr=t=>!!t.type.__asyncLoader,lr=t=>t.type.__isKeepAlive;function dr(t,e){pr(t,"a",e)}function cr(t,e){pr(t,"da",e)}function pr(t,e,r=sn){const o=t.__wdc||(t.__wdc=()=>{let e=r;for(;e;){if(e.isDeactivated)return;e=e.parent}return t()});if(mr(e,o,r),r){let t=r.parent;for(;t&&t.parent;)lr(t.parent.vnode)&&br(o,e,r,t),t=t.parent}}function br(t,e,r,o){const n=mr(e,t,o,!0);wr((()=>{p(o[e],n)}),r)}function mr(t,e,r=sn,o=!1){if(r){const n=r[t]||(r[t]=[]),i=e.__weh||(e.__weh=(...o)=>{wt();const n=cn(r),i=Te(e,r,t,o);return n(),yt(),i});return o?n.unshift(i):n.push(i),i}}RegExp,RegExp;const gr=t=>(e,r=sn)=>{fn&&"sp"!==t||mr(t,((...t)=>e(...t)),r)},fr=gr("bm"),ur=gr("m"),hr=gr("bu"),vr=gr("u"),xr=gr("bum"),wr=gr("um"),yr=gr("sp"),_r=gr("rtg"),kr=gr("rtc");function Er(t,e=sn){mr("ec",t,e)}const Ar="components";function Sr(t,e){return function(t,e,r=!0,o=!1){const n=Qe||sn;if(n){const r=n.type;if(t===Ar){const t=function(t,e=!0){return v(t)?t.displayName||t.name:t.name||e&&t.__name}(r,!1);if(t&&(t===e||t===j(e)||t===R(j(e))))return r}const i=Or(n[t]||r[t],e)||Or(n.appContext[t],e);return!i&&o?r:i}}(Ar,t,!0,e)||t}const Tr=Symbol.for("v-ndc");function Or(t,e){return t&&(t[e]||t[j(e)]||t[R(j(e))])}function Cr(t,e,r,o){let n;const i=r&&r[o],a=g(t);if(a||x(t)){let r=!1;a&&pe(t)&&(r=!me(t),t=Pt(t)),n=new Array(t.length);for(let o=0,a=t.length;o<a;o++)n[o]=e(r?ue(t[o]):t[o],o,void 0,i&&i[o])}else if("number"==typeof t){n=new Array(t);for(let r=0;r<t;r++)n[r]=e(r+1,r,void 0,i&&i[r])}else if(y(t))if(t[Symbol.iterator])n=Array.from(t,((t,r)=>e(t,r,void 0,i&&i[r])));else{const r=Object.keys(t);n=new Array(r.length);for(let o=0,a=r.length;o<a;o++){const a=r[o];n[o]=e(t[a],a,o,i&&i[o])}}else n=[];return r&&(r[o]=n),n}const jr=t=>t?bn(t)?xn(t):jr(t.parent):null,zr=c(Object.create(null),{$:t=>t,$el:t=>t.vnode.el,$data:t=>t.data,$props:t=>t.props,$attrs:t=>t.attrs,$slots:t=>t.slots,$refs:t=>t.refs,$parent:t=>jr(t.parent),$root:t=>jr(t.root),$host:t=>t.ce,$emit:t=>t.emit,$options:t=>__VUE_OPTIONS_API__?Ir(t):t.type,$forceUpdate:t=>t.f||(t.f=()=>{Ne(t.update)}),$nextTick:t=>t.n||(t.n=Me.bind(t.proxy)),$watch:t=>__VUE_OPTIONS_API__?ko.bind(t):a}),Lr=(t,e)=>t!==n&&!t.__isScriptSetup&&m(t,e),Rr={get({_:t},e){if("__v_skip"===e)return!0;const{ctx:r,setupState:o,data:i,props:a,accessCache:s,type:l,appContext:d}=t;let c;if("$"!==e[0]){const l=s[e];if(void 0!==l)switch(l){case 1:return o[e];case 2:return i[e];case 4:return r[e];case 3:return a[e]}else{if(Lr(o,e))return s[e]=1,o[e];if(i!==n&&m(i,e))return s[e]=2,i[e];if((c=t.propsOptions[0])&&m(c,e))return s[e]=3,a[e];if(r!==n&&m(r,e))return s[e]=4,r[e];__VUE_OPTIONS_API__&&!Dr||(s[e]=0)}}const p=zr[e];let b,g;return p?("$attrs"===e&&zt(t.attrs,0,""),p(t)):(b=l.__cssModules)&&(b=b[e])?b:r!==n&&m(r,e)?(s[e]=4,r[e]):(g=d.config.globalProperties,m(g,e)?g[e]:void 0)},set({_:t},e,r){const{data:o,setupState:i,ctx:a}=t;return Lr(i,e)?(i[e]=r,!0):o!==n&&m(o,e)?(o[e]=r,!0):!(m(t.props,e)||"$"===e[0]&&e.slice(1)in t||(a[e]=r,0))},has({_:{data:t,setupState:e,accessCache:r,ctx:o,appContext:i,propsOptions:a}},s){let l;return!!r[s]||t!==n&&m(t,s)||Lr(e,s)||(l=a[0])&&m(l,s)||m(o,s)||m(zr,s)||m(i.config.globalProperties,s)},defineProperty(t,e,r){return null!=r.get?t._.accessCache[e]=0:m(r,"value")&&this.set(t,e,r.value,null),Reflect.defineProperty(t,e,r)}};function Pr(t){return g(t)?t.reduce(((t,e)=>(t[e]=null,t)),{}):t}let Dr=!0;function Mr(t,e,r){Te(g(t)?t.map((t=>t.bind(e.proxy))):t.bind(e.proxy),e,r)}function Nr(t,e,r,o){let n=o.includes(".")?Eo(r,o):()=>r[o];if(x(t)){const r=e[t];v(r)&&yo(n,r)}else if(v(t))yo(n,t.bind(r));else if(y(t))if(g(t))t.forEach((t=>Nr(t,e,r,o)));else{const o=v(t.handler)?t.handler.bind(r):e[t.handler];v(o)&&yo(n,o,t)}}function Ir(t){const e=t.type,{mixins:r,extends:o}=e,{mixins:n,optionsCache:i,config:{optionMergeStrategies:a}}=t.appContext,s=i.get(e);let l;return s?l=s:n.length||r||o?(l={},n.length&&n.forEach((t=>Br(l,t,a,!0))),Br(l,e,a)):l=e,y(e)&&i.set(e,l),l}function Br(t,e,r,o=!1){const{mixins:n,extends:i}=e;i&&Br(t,i,r,!0),n&&n.forEach((e=>Br(t,e,r,!0)));for(const n in e)if(o&&"expose"===n);else{const o=Fr[n]||r&&r[n];t[n]=o?o(t[n],e[n]):e[n]}return t}const Fr={data:$r,props:Hr,emits:Hr,methods:Wr,computed:Wr,beforeCreate:Vr,created:Vr,beforeMount:Vr,mounted:Vr,beforeUpdate:Vr,updated:Vr,beforeDestroy:Vr,beforeUnmount:Vr,destroyed:Vr,unmounted:Vr,activated:Vr,deactivated:Vr,errorCaptured:Vr,serverPrefetch:Vr,components:Wr,directives:Wr,watch:function(t,e){if(!t)return e;if(!e)return t;const r=c(Object.create(null),t);for(const o in e)r[o]=Vr(t[o],e[o]);return r},provide:$r,inject:function(t,e){return Wr(Ur(t),Ur(e))}};function $r(t,e){return e?t?function(){return c(v(t)?t.call(this,this):t,v(e)?e.call(this,this):e)}:e:t}function Ur(t){if(g(t)){const e={};for(let r=0;r<t.length;r++)e[t[r]]=t[r];return e}return t}function Vr(t,e){return t?[...new Set([].concat(t,e))]:e}function Wr(t,e){return t?c(Object.create(null),t,e):e}function Hr(t,e){return t?g(t)&&g(e)?[...new Set([...t,...e])]:c(Object.create(null),Pr(t),Pr(null!=e?e:{})):e}function qr(){return{app:null,config:{isNativeTag:s,performance:!1,globalProperties:{},optionMergeStrategies:{},errorHandler:void 0,warnHandler:void 0,compilerOptions:{}},mixins:[],components:{},directives:{},provides:Object.create(null),optionsCache:new WeakMap,propsCache:new WeakMap,emitsCache:new WeakMap}}let Gr=0;function Kr(t,e){return function(r,o=null){v(r)||(r=c({},r)),null==o||y(o)||(o=null);const n=qr(),i=new WeakSet,a=[];let s=!1;const l=n.app={_uid:Gr++,_component:r,_props:o,_container:null,_context:n,_instance:null,version:yn,get config(){return n.config},set config(t){},use:(t,...e)=>(i.has(t)||(t&&v(t.install)?(i.add(t),t.install(l,...e)):v(t)&&(i.add(t),t(l,...e))),l),mixin:t=>(__VUE_OPTIONS_API__&&(n.mixins.includes(t)||n.mixins.push(t)),l),component:(t,e)=>e?(n.components[t]=e,l):n.components[t],directive:(t,e)=>e?(n.directives[t]=e,l):n.directives[t],mount(i,a,d){if(!s){const c=l._ceVNode||Yo(r,o);return c.appContext=n,!0===d?d="svg":!1===d&&(d=void 0),a&&e?e(c,i):t(c,i,d),s=!0,l._container=i,i.__vue_app__=l,__VUE_PROD_DEVTOOLS__&&(l._instance=c.component,function(t,e){qe("app:init",t,e,{Fragment:Po,Text:Do,Comment:Mo,Static:No})}(l,yn)),xn(c.component)}},onUnmount(t){a.push(t)},unmount(){s&&(Te(a,l._instance,16),t(null,l._container),__VUE_PROD_DEVTOOLS__&&(l._instance=null,function(t){qe("app:unmount",t)}(l)),delete l._container.__vue_app__)},provide:(t,e)=>(n.provides[t]=e,l),runWithContext(t){const e=Xr;Xr=l;try{return t()}finally{Xr=e}}};return l}}let Xr=null;function Yr(t,e,r=!1){const o=sn||Qe;if(o||Xr){const n=Xr?Xr._context.provides:o?null==o.parent?o.vnode.appContext&&o.vnode.appContext.provides:o.parent.provides:void 0;if(n&&t in n)return n[t];if(arguments.length>1)return r&&v(e)?e.call(o&&o.proxy):e}}const Jr={},Qr=()=>Object.create(Jr),Zr=t=>Object.getPrototypeOf(t)===Jr;function to(t,e,r,o){const[i,a]=t.propsOptions;let s,l=!1;if(e)for(let n in e){if(T(n))continue;const d=e[n];let c;i&&m(i,c=j(n))?a&&a.includes(c)?(s||(s={}))[c]=d:r[c]=d:Oo(t.emitsOptions,n)||n in o&&d===o[n]||(o[n]=d,l=!0)}if(a){const e=fe(r),o=s||n;for(let n=0;n<a.length;n++){const s=a[n];r[s]=eo(i,e,s,o[s],t,!m(o,s))}}return l}function eo(t,e,r,o,n,i){const a=t[r];if(null!=a){const t=m(a,"default");if(t&&void 0===o){const t=a.default;if(a.type!==Function&&!a.skipFactory&&v(t)){const{propsDefaults:i}=n;if(r in i)o=i[r];else{const a=cn(n);o=i[r]=t.call(null,e),a()}}else o=t;n.ce&&n.ce._setProp(r,o)}a[0]&&(i&&!t?o=!1:!a[1]||""!==o&&o!==L(r)||(o=!0))}return o}const ro=new WeakMap;function oo(t,e,r=!1){const o=__VUE_OPTIONS_API__&&r?ro:e.propsCache,a=o.get(t);if(a)return a;const s=t.props,l={},d=[];let p=!1;if(__VUE_OPTIONS_API__&&!v(t)){const o=t=>{p=!0;const[r,o]=oo(t,e,!0);c(l,r),o&&d.push(...o)};!r&&e.mixins.length&&e.mixins.forEach(o),t.extends&&o(t.extends),t.mixins&&t.mixins.forEach(o)}if(!s&&!p)return y(t)&&o.set(t,i),i;if(g(s))for(let t=0;t<s.length;t++){const e=j(s[t]);no(e)&&(l[e]=n)}else if(s)for(const t in s){const e=j(t);if(no(e)){const r=s[t],o=l[e]=g(r)||v(r)?{type:r}:c({},r),n=o.type;let i=!1,a=!0;if(g(n))for(let t=0;t<n.length;++t){const e=n[t],r=v(e)&&e.name;if("Boolean"===r){i=!0;break}"String"===r&&(a=!1)}else i=v(n)&&"Boolean"===n.name;o[0]=i,o[1]=a,(i||m(o,"default"))&&d.push(e)}}const b=[l,d];return y(t)&&o.set(t,b),b}function no(t){return"$"!==t[0]&&!T(t)}const io=t=>"_"===t[0]||"$stable"===t,ao=t=>g(t)?t.map(tn):[tn(t)],so=(t,e,r)=>{if(e._n)return e;const o=function(t,e=Qe){if(!e)return t;if(t._n)return t;const r=(...o)=>{r._d&&Uo(-1);const n=tr(e);let i;try{i=t(...o)}finally{tr(n),r._d&&Uo(1)}return __VUE_PROD_DEVTOOLS__&&Xe(e),i};return r._n=!0,r._c=!0,r._d=!0,r}(((...t)=>ao(e(...t))),r);return o._c=!1,o},lo=(t,e,r)=>{const o=t._ctx;for(const r in t){if(io(r))continue;const n=t[r];if(v(n))e[r]=so(0,n,o);else if(null!=n){const t=ao(n);e[r]=()=>t}}},co=(t,e)=>{const r=ao(e);t.slots.default=()=>r},po=(t,e,r)=>{for(const o in e)(r||"_"!==o)&&(t[o]=e[o])},bo=function(t,e){e&&e.pendingBranch?g(t)?e.effects.push(...t):e.effects.push(t):(r=t,g(r)?ze.push(...r):Le&&-1===r.id?Le.splice(Re+1,0,r):1&r.flags||(ze.push(r),r.flags|=1),Ie());var r};function mo(t,e){"boolean"!=typeof __VUE_OPTIONS_API__&&(F().__VUE_OPTIONS_API__=!0),"boolean"!=typeof __VUE_PROD_DEVTOOLS__&&(F().__VUE_PROD_DEVTOOLS__=!1),"boolean"!=typeof __VUE_PROD_HYDRATION_MISMATCH_DETAILS__&&(F().__VUE_PROD_HYDRATION_MISMATCH_DETAILS__=!1);const r=F();r.__VUE__=!0,__VUE_PROD_DEVTOOLS__&&Ge(r.__VUE_DEVTOOLS_GLOBAL_HOOK__,r);const{insert:o,remove:s,patchProp:l,createElement:d,createText:c,createComment:p,setText:b,setElementText:g,parentNode:f,nextSibling:u,setScopeId:h=a,insertStaticContent:v}=t,x=(t,e,r,o=null,n=null,i=null,a=void 0,s=null,l=!!e.dynamicChildren)=>{if(t===e)return;t&&!qo(t,e)&&(o=Q(t),G(t,n,i,!0),t=null),-2===e.patchFlag&&(l=!1,e.dynamicChildren=null);const{type:d,ref:c,shapeFlag:p}=e;switch(d){case Do:w(t,e,r,o);break;case Mo:y(t,e,r,o);break;case No:null==t&&k(e,r,o,a);break;case Po:P(t,e,r,o,n,i,a,s,l);break;default:1&p?E(t,e,r,o,n,i,a,s,l):6&p?D(t,e,r,o,n,i,a,s,l):(64&p||128&p)&&d.process(t,e,r,o,n,i,a,s,l,et)}null!=c&&n&&ar(c,t&&t.ref,i,e||t,!e)},w=(t,e,r,n)=>{if(null==t)o(e.el=c(e.children),r,n);else{const r=e.el=t.el;e.children!==t.children&&b(r,e.children)}},y=(t,e,r,n)=>{null==t?o(e.el=p(e.children||""),r,n):e.el=t.el},k=(t,e,r,o)=>{[t.el,t.anchor]=v(t.children,e,r,o,t.el,t.anchor)},E=(t,e,r,o,n,i,a,s,l)=>{"svg"===e.type?a="svg":"math"===e.type&&(a="mathml"),null==t?A(e,r,o,n,i,a,s,l):C(t,e,n,i,a,s,l)},A=(t,e,r,n,i,a,s,c)=>{let p,b;const{props:m,shapeFlag:f,transition:u,dirs:h}=t;if(p=t.el=d(t.type,a,m&&m.is,m),8&f?g(p,t.children):16&f&&O(t.children,p,null,n,i,go(t,a),s,c),h&&rr(t,null,n,"created"),S(p,t,t.scopeId,s,n),m){for(const t in m)"value"===t||T(t)||l(p,t,null,m[t],a,n);"value"in m&&l(p,"value",null,m.value,a),(b=m.onVnodeBeforeMount)&&on(b,n,t)}__VUE_PROD_DEVTOOLS__&&(N(p,"__vnode",t,!0),N(p,"__vueParentComponent",n,!0)),h&&rr(t,null,n,"beforeMount");const v=function(t,e){return(!t||t&&!t.pendingBranch)&&e&&!e.persisted}(i,u);v&&u.beforeEnter(p),o(p,e,r),((b=m&&m.onVnodeMounted)||v||h)&&bo((()=>{b&&on(b,n,t),v&&u.enter(p),h&&rr(t,null,n,"mounted")}),i)},S=(t,e,r,o,n)=>{if(r&&h(t,r),o)for(let e=0;e<o.length;e++)h(t,o[e]);if(n){let r=n.subTree;if(e===r||Ro(r.type)&&(r.ssContent===e||r.ssFallback===e)){const e=n.vnode;S(t,e,e.scopeId,e.slotScopeIds,n.parent)}}},O=(t,e,r,o,n,i,a,s,l=0)=>{for(let d=l;d<t.length;d++){const l=t[d]=s?en(t[d]):tn(t[d]);x(null,l,e,r,o,n,i,a,s)}},C=(t,e,r,o,i,a,s)=>{const d=e.el=t.el;__VUE_PROD_DEVTOOLS__&&(d.__vnode=e);let{patchFlag:c,dynamicChildren:p,dirs:b}=e;c|=16&t.patchFlag;const m=t.props||n,f=e.props||n;let u;if(r&&fo(r,!1),(u=f.onVnodeBeforeUpdate)&&on(u,r,e,t),b&&rr(e,t,r,"beforeUpdate"),r&&fo(r,!0),(m.innerHTML&&null==f.innerHTML||m.textContent&&null==f.textContent)&&g(d,""),p?z(t.dynamicChildren,p,d,r,o,go(e,i),a):s||V(t,e,d,null,r,o,go(e,i),a,!1),c>0){if(16&c)R(d,m,f,r,i);else if(2&c&&m.class!==f.class&&l(d,"class",null,f.class,i),4&c&&l(d,"style",m.style,f.style,i),8&c){const t=e.dynamicProps;for(let e=0;e<t.length;e++){const o=t[e],n=m[o],a=f[o];a===n&&"value"!==o||l(d,o,n,a,i,r)}}1&c&&t.children!==e.children&&g(d,e.children)}else s||null!=p||R(d,m,f,r,i);((u=f.onVnodeUpdated)||b)&&bo((()=>{u&&on(u,r,e,t),b&&rr(e,t,r,"updated")}),o)},z=(t,e,r,o,n,i,a)=>{for(let s=0;s<e.length;s++){const l=t[s],d=e[s],c=l.el&&(l.type===Po||!qo(l,d)||70&l.shapeFlag)?f(l.el):r;x(l,d,c,null,o,n,i,a,!0)}},R=(t,e,r,o,i)=>{if(e!==r){if(e!==n)for(const n in e)T(n)||n in r||l(t,n,e[n],null,i,o);for(const n in r){if(T(n))continue;const a=r[n],s=e[n];a!==s&&"value"!==n&&l(t,n,s,a,i,o)}"value"in r&&l(t,"value",e.value,r.value,i)}},P=(t,e,r,n,i,a,s,l,d)=>{const p=e.el=t?t.el:c(""),b=e.anchor=t?t.anchor:c("");let{patchFlag:m,dynamicChildren:g,slotScopeIds:f}=e;f&&(l=l?l.concat(f):f),null==t?(o(p,r,n),o(b,r,n),O(e.children||[],r,b,i,a,s,l,d)):m>0&&64&m&&g&&t.dynamicChildren?(z(t.dynamicChildren,g,r,i,a,s,l),(null!=e.key||i&&e===i.subTree)&&uo(t,e,!0)):V(t,e,r,b,i,a,s,l,d)},D=(t,e,r,o,n,i,a,s,l)=>{e.slotScopeIds=s,null==t?512&e.shapeFlag?n.ctx.activate(e,r,o,a,l):I(e,r,o,n,i,a,l):B(t,e,l)},I=(t,e,r,o,i,a,s)=>{const l=t.component=function(t,e,r){const o=t.type,i=(e?e.appContext:t.appContext)||nn,a={uid:an++,vnode:t,type:o,parent:e,appContext:i,root:null,next:null,subTree:null,effect:null,update:null,job:null,scope:new ot(!0),render:null,proxy:null,exposed:null,exposeProxy:null,withProxy:null,provides:e?e.provides:Object.create(i.provides),ids:e?e.ids:["",0,0],accessCache:null,renderCache:[],components:null,directives:null,propsOptions:oo(o,i),emitsOptions:To(o,i),emit:null,emitted:null,propsDefaults:n,inheritAttrs:o.inheritAttrs,ctx:n,data:n,props:n,attrs:n,slots:n,refs:n,setupState:n,setupContext:null,suspense:r,suspenseId:r?r.pendingId:0,asyncDep:null,asyncResolved:!1,isMounted:!1,isUnmounted:!1,isDeactivated:!1,bc:null,c:null,bm:null,m:null,bu:null,u:null,um:null,bum:null,da:null,a:null,rtg:null,rtc:null,ec:null,sp:null};return a.ctx={_:a},a.root=e?e.root:a,a.emit=So.bind(null,a),t.ce&&t.ce(a),a}(t,o,i);if(lr(t)&&(l.ctx.renderer=et),function(t,e=!1,r=!1){e&&dn(e);const{props:o,children:n}=t.vnode,i=bn(t);(function(t,e,r,o=!1){const n={},i=Qr();t.propsDefaults=Object.create(null),to(t,e,n,i);for(const e in t.propsOptions[0])e in n||(n[e]=void 0);r?t.props=o?n:ce(n,!1,Yt,re,ie):t.type.props?t.props=n:t.props=i,t.attrs=i})(t,o,i,e),((t,e,r)=>{const o=t.slots=Qr();if(32&t.vnode.shapeFlag){const t=e._;t?(po(o,e,r),r&&N(o,"_",t,!0)):lo(e,o)}else e&&co(t,e)})(t,n,r);const a=i?function(t,e){const r=t.type;t.accessCache=Object.create(null),t.proxy=new Proxy(t.ctx,Rr);const{setup:o}=r;if(o){wt();const r=t.setupContext=o.length>1?function(t){const e=e=>{t.exposed=e||{}};return{attrs:new Proxy(t.attrs,vn),slots:t.slots,emit:t.emit,expose:e}}(t):null,n=cn(t),i=Se(o,t,0,[t.props,r]),a=_(i);if(yt(),n(),!a&&!t.sp||sr(t)||ir(t),a){if(i.then(pn,pn),e)return i.then((r=>{un(t,r,e)})).catch((e=>{Oe(e,t,0)}));t.asyncDep=i}else un(t,i,e)}else hn(t,e)}(t,e):void 0;e&&dn(!1)}(l,!1,s),l.asyncDep){if(i&&i.registerDep(l,$,s),!t.el){const t=l.subTree=Yo(Mo);y(null,t,e,r)}}else $(l,t,e,r,i,a,s)},B=(t,e,r)=>{const o=e.component=t.component;if(function(t,e,r){const{props:o,children:n,component:i}=t,{props:a,children:s,patchFlag:l}=e,d=i.emitsOptions;if(e.dirs||e.transition)return!0;if(!(r&&l>=0))return!(!n&&!s||s&&s.$stable)||o!==a&&(o?!a||Lo(o,a,d):!!a);if(1024&l)return!0;if(16&l)return o?Lo(o,a,d):!!a;if(8&l){const t=e.dynamicProps;for(let e=0;e<t.length;e++){const r=t[e];if(a[r]!==o[r]&&!Oo(d,r))return!0}}return!1}(t,e,r)){if(o.asyncDep&&!o.asyncResolved)return void U(o,e,r);o.next=e,o.update()}else e.el=t.el,o.vnode=e},$=(t,e,r,o,n,i,a)=>{const s=()=>{if(t.isMounted){let{next:e,bu:r,u:o,parent:l,vnode:d}=t;{const r=ho(t);if(r)return e&&(e.el=d.el,U(t,e,a)),void r.asyncDep.then((()=>{t.isUnmounted||s()}))}let c,p=e;fo(t,!1),e?(e.el=d.el,U(t,e,a)):e=d,r&&M(r),(c=e.props&&e.props.onVnodeBeforeUpdate)&&on(c,l,e,d),fo(t,!0);const b=Co(t),m=t.subTree;t.subTree=b,x(m,b,f(m.el),Q(m),t,n,i),e.el=b.el,null===p&&function({vnode:t,parent:e},r){for(;e;){const o=e.subTree;if(o.suspense&&o.suspense.activeBranch===t&&(o.el=t.el),o!==t)break;(t=e.vnode).el=r,e=e.parent}}(t,b.el),o&&bo(o,n),(c=e.props&&e.props.onVnodeUpdated)&&bo((()=>on(c,l,e,d)),n),__VUE_PROD_DEVTOOLS__&&Xe(t)}else{let a;const{el:s,props:l}=e,{bm:d,m:c,parent:p,root:b,type:m}=t,g=sr(e);if(fo(t,!1),d&&M(d),!g&&(a=l&&l.onVnodeBeforeMount)&&on(a,p,e),fo(t,!0),s&&nt){const e=()=>{t.subTree=Co(t),nt(s,t.subTree,t,n,null)};g&&m.__asyncHydrate?m.__asyncHydrate(s,t,e):e()}else{b.ce&&b.ce._injectChildStyle(m);const a=t.subTree=Co(t);x(null,a,r,o,t,n,i),e.el=a.el}if(c&&bo(c,n),!g&&(a=l&&l.onVnodeMounted)){const t=e;bo((()=>on(a,p,t)),n)}(256&e.shapeFlag||p&&sr(p.vnode)&&256&p.vnode.shapeFlag)&&t.a&&bo(t.a,n),t.isMounted=!0,__VUE_PROD_DEVTOOLS__&&Ke(t),e=r=o=null}};t.scope.on();const l=t.effect=new it(s);t.scope.off();const d=t.update=l.run.bind(l),c=t.job=l.runIfDirty.bind(l);c.i=t,c.id=t.uid,l.scheduler=()=>Ne(c),fo(t,!0),d()},U=(t,e,r)=>{e.component=t;const o=t.vnode.props;t.vnode=e,t.next=null,function(t,e,r,o){const{props:n,attrs:i,vnode:{patchFlag:a}}=t,s=fe(n),[l]=t.propsOptions;let d=!1;if(!(o||a>0)||16&a){let o;to(t,e,n,i)&&(d=!0);for(const i in s)e&&(m(e,i)||(o=L(i))!==i&&m(e,o))||(l?!r||void 0===r[i]&&void 0===r[o]||(n[i]=eo(l,s,i,void 0,t,!0)):delete n[i]);if(i!==s)for(const t in i)e&&m(e,t)||(delete i[t],d=!0)}else if(8&a){const r=t.vnode.dynamicProps;for(let o=0;o<r.length;o++){let a=r[o];if(Oo(t.emitsOptions,a))continue;const c=e[a];if(l)if(m(i,a))c!==i[a]&&(i[a]=c,d=!0);else{const e=j(a);n[e]=eo(l,s,e,c,t,!1)}else c!==i[a]&&(i[a]=c,d=!0)}}d&&Lt(t.attrs,"set","")}(t,e.props,o,r),((t,e,r)=>{const{vnode:o,slots:i}=t;let a=!0,s=n;if(32&o.shapeFlag){const t=e._;t?r&&1===t?a=!1:po(i,e,r):(a=!e.$stable,lo(e,i)),s=e}else e&&(co(t,e),s={default:1});if(a)for(const t in i)io(t)||null!=s[t]||delete i[t]})(t,e.children,r),wt(),Be(t),yt()},V=(t,e,r,o,n,i,a,s,l=!1)=>{const d=t&&t.children,c=t?t.shapeFlag:0,p=e.children,{patchFlag:b,shapeFlag:m}=e;if(b>0){if(128&b)return void H(d,p,r,o,n,i,a,s,l);if(256&b)return void W(d,p,r,o,n,i,a,s,l)}8&m?(16&c&&J(d,n,i),p!==d&&g(r,p)):16&c?16&m?H(d,p,r,o,n,i,a,s,l):J(d,n,i,!0):(8&c&&g(r,""),16&m&&O(p,r,o,n,i,a,s,l))},W=(t,e,r,o,n,a,s,l,d)=>{e=e||i;const c=(t=t||i).length,p=e.length,b=Math.min(c,p);let m;for(m=0;m<b;m++){const o=e[m]=d?en(e[m]):tn(e[m]);x(t[m],o,r,null,n,a,s,l,d)}c>p?J(t,n,a,!0,!1,b):O(e,r,o,n,a,s,l,d,b)},H=(t,e,r,o,n,a,s,l,d)=>{let c=0;const p=e.length;let b=t.length-1,m=p-1;for(;c<=b&&c<=m;){const o=t[c],i=e[c]=d?en(e[c]):tn(e[c]);if(!qo(o,i))break;x(o,i,r,null,n,a,s,l,d),c++}for(;c<=b&&c<=m;){const o=t[b],i=e[m]=d?en(e[m]):tn(e[m]);if(!qo(o,i))break;x(o,i,r,null,n,a,s,l,d),b--,m--}if(c>b){if(c<=m){const t=m+1,i=t<p?e[t].el:o;for(;c<=m;)x(null,e[c]=d?en(e[c]):tn(e[c]),r,i,n,a,s,l,d),c++}}else if(c>m)for(;c<=b;)G(t[c],n,a,!0),c++;else{const g=c,f=c,u=new Map;for(c=f;c<=m;c++){const t=e[c]=d?en(e[c]):tn(e[c]);null!=t.key&&u.set(t.key,c)}let h,v=0;const w=m-f+1;let y=!1,_=0;const k=new Array(w);for(c=0;c<w;c++)k[c]=0;for(c=g;c<=b;c++){const o=t[c];if(v>=w){G(o,n,a,!0);continue}let i;if(null!=o.key)i=u.get(o.key);else for(h=f;h<=m;h++)if(0===k[h-f]&&qo(o,e[h])){i=h;break}void 0===i?G(o,n,a,!0):(k[i-f]=c+1,i>=_?_=i:y=!0,x(o,e[i],r,null,n,a,s,l,d),v++)}const E=y?function(t){const e=t.slice(),r=[0];let o,n,i,a,s;const l=t.length;for(o=0;o<l;o++){const l=t[o];if(0!==l){if(n=r[r.length-1],t[n]<l){e[o]=n,r.push(o);continue}for(i=0,a=r.length-1;i<a;)s=i+a>>1,t[r[s]]<l?i=s+1:a=s;l<t[r[i]]&&(i>0&&(e[o]=r[i-1]),r[i]=o)}}for(i=r.length,a=r[i-1];i-- >0;)r[i]=a,a=e[a];return r}(k):i;for(h=E.length-1,c=w-1;c>=0;c--){const t=f+c,i=e[t],b=t+1<p?e[t+1].el:o;0===k[c]?x(null,i,r,b,n,a,s,l,d):y&&(h<0||c!==E[h]?q(i,r,b,2):h--)}}},q=(t,e,r,n,i=null)=>{const{el:a,type:s,transition:l,children:d,shapeFlag:c}=t;if(6&c)q(t.component.subTree,e,r,n);else if(128&c)t.suspense.move(e,r,n);else if(64&c)s.move(t,e,r,et);else if(s!==Po)if(s!==No)if(2!==n&&1&c&&l)if(0===n)l.beforeEnter(a),o(a,e,r),bo((()=>l.enter(a)),i);else{const{leave:t,delayLeave:n,afterLeave:i}=l,s=()=>o(a,e,r),d=()=>{t(a,(()=>{s(),i&&i()}))};n?n(a,s,d):d()}else o(a,e,r);else(({el:t,anchor:e},r,n)=>{let i;for(;t&&t!==e;)i=u(t),o(t,r,n),t=i;o(e,r,n)})(t,e,r);else{o(a,e,r);for(let t=0;t<d.length;t++)q(d[t],e,r,n);o(t.anchor,e,r)}},G=(t,e,r,o=!1,n=!1)=>{const{type:i,props:a,ref:s,children:l,dynamicChildren:d,shapeFlag:c,patchFlag:p,dirs:b,cacheIndex:m}=t;if(-2===p&&(n=!1),null!=s&&ar(s,null,r,t,!0),null!=m&&(e.renderCache[m]=void 0),256&c)return void e.ctx.deactivate(t);const g=1&c&&b,f=!sr(t);let u;if(f&&(u=a&&a.onVnodeBeforeUnmount)&&on(u,e,t),6&c)Y(t.component,r,o);else{if(128&c)return void t.suspense.unmount(r,o);g&&rr(t,null,e,"beforeUnmount"),64&c?t.type.remove(t,e,r,et,o):d&&!d.hasOnce&&(i!==Po||p>0&&64&p)?J(d,e,r,!1,!0):(i===Po&&384&p||!n&&16&c)&&J(l,e,r),o&&K(t)}(f&&(u=a&&a.onVnodeUnmounted)||g)&&bo((()=>{u&&on(u,e,t),g&&rr(t,null,e,"unmounted")}),r)},K=t=>{const{type:e,el:r,anchor:o,transition:n}=t;if(e===Po)return void X(r,o);if(e===No)return void(({el:t,anchor:e})=>{let r;for(;t&&t!==e;)r=u(t),s(t),t=r;s(e)})(t);const i=()=>{s(r),n&&!n.persisted&&n.afterLeave&&n.afterLeave()};if(1&t.shapeFlag&&n&&!n.persisted){const{leave:e,delayLeave:o}=n,a=()=>e(r,i);o?o(t.el,i,a):a()}else i()},X=(t,e)=>{let r;for(;t!==e;)r=u(t),s(t),t=r;s(e)},Y=(t,e,r)=>{const{bum:o,scope:n,job:i,subTree:a,um:s,m:l,a:d}=t;var c;vo(l),vo(d),o&&M(o),n.stop(),i&&(i.flags|=8,G(a,t,e,r)),s&&bo(s,e),bo((()=>{t.isUnmounted=!0}),e),e&&e.pendingBranch&&!e.isUnmounted&&t.asyncDep&&!t.asyncResolved&&t.suspenseId===e.pendingId&&(e.deps--,0===e.deps&&e.resolve()),__VUE_PROD_DEVTOOLS__&&(c=t,Ve&&"function"==typeof Ve.cleanupBuffer&&!Ve.cleanupBuffer(c)&&Ye(c))},J=(t,e,r,o=!1,n=!1,i=0)=>{for(let a=i;a<t.length;a++)G(t[a],e,r,o,n)},Q=t=>{if(6&t.shapeFlag)return Q(t.component.subTree);if(128&t.shapeFlag)return t.suspense.next();const e=u(t.anchor||t.el),r=e&&e[or];return r?u(r):e};let Z=!1;const tt=(t,e,r)=>{null==t?e._vnode&&G(e._vnode,null,null,!0):x(e._vnode||null,t,e,null,null,null,r),e._vnode=t,Z||(Z=!0,Be(),Fe(),Z=!1)},et={p:x,um:G,m:q,r:K,mt:I,mc:O,pc:V,pbc:z,n:Q,o:t};let rt,nt;return e&&([rt,nt]=e(et)),{render:tt,hydrate:rt,createApp:Kr(tt,rt)}}function go({type:t,props:e},r){return"svg"===r&&"foreignObject"===t||"mathml"===r&&"annotation-xml"===t&&e&&e.encoding&&e.encoding.includes("html")?void 0:r}function fo({effect:t,job:e},r){r?(t.flags|=32,e.flags|=4):(t.flags&=-33,e.flags&=-5)}function uo(t,e,r=!1){const o=t.children,n=e.children;if(g(o)&&g(n))for(let t=0;t<o.length;t++){const e=o[t];let i=n[t];1&i.shapeFlag&&!i.dynamicChildren&&((i.patchFlag<=0||32===i.patchFlag)&&(i=n[t]=en(n[t]),i.el=e.el),r||-2===i.patchFlag||uo(e,i)),i.type===Do&&(i.el=e.el)}}function ho(t){const e=t.subTree.component;if(e)return e.asyncDep&&!e.asyncResolved?e:ho(e)}function vo(t){if(t)for(let e=0;e<t.length;e++)t[e].flags|=8}const xo=Symbol.for("v-scx"),wo=()=>Yr(xo);function yo(t,e,r){return _o(t,e,r)}function _o(t,e,r=n){const{immediate:o,deep:i,flush:s,once:l}=r,d=c({},r),b=e&&o||!e&&"post"!==s;let m;if(fn)if("sync"===s){const t=wo();m=t.__watcherHandles||(t.__watcherHandles=[])}else if(!b){const t=()=>{};return t.stop=a,t.resume=a,t.pause=a,t}const f=sn;d.call=(t,e,r)=>Te(t,f,e,r);let u=!1;"post"===s?d.scheduler=t=>{bo(t,f&&f.suspense)}:"sync"!==s&&(u=!0,d.scheduler=(t,e)=>{e?t():Ne(t)}),d.augmentJob=t=>{e&&(t.flags|=4),u&&(t.flags|=2,f&&(t.id=f.uid,t.i=f))};const h=function(t,e,r=n){const{immediate:o,deep:i,once:s,scheduler:l,augmentJob:d,call:c}=r,b=t=>i?t:me(t)||!1===i||0===i?Ae(t,1):Ae(t);let m,f,u,h,x=!1,w=!1;if(ve(t)?(f=()=>t.value,x=me(t)):pe(t)?(f=()=>b(t),x=!0):g(t)?(w=!0,x=t.some((t=>pe(t)||me(t))),f=()=>t.map((t=>ve(t)?t.value:pe(t)?b(t):v(t)?c?c(t,2):t():void 0))):f=v(t)?e?c?()=>c(t,2):t:()=>{if(u){wt();try{u()}finally{yt()}}const e=Ee;Ee=m;try{return c?c(t,3,[h]):t(h)}finally{Ee=e}}:a,e&&i){const t=f,e=!0===i?1/0:i;f=()=>Ae(t(),e)}const y=et,_=()=>{m.stop(),y&&p(y.effects,m)};if(s&&e){const t=e;e=(...e)=>{t(...e),_()}}let k=w?new Array(t.length).fill(_e):_e;const E=t=>{if(1&m.flags&&(m.dirty||t))if(e){const t=m.run();if(i||x||(w?t.some(((t,e)=>D(t,k[e]))):D(t,k))){u&&u();const r=Ee;Ee=m;try{const r=[t,k===_e?void 0:w&&k[0]===_e?[]:k,h];c?c(e,3,r):e(...r),k=t}finally{Ee=r}}}else m.run()};return d&&d(E),m=new it(f),m.scheduler=l?()=>l(E,!1):E,h=t=>function(t,e=!1,r=Ee){if(r){let e=ke.get(r);e||ke.set(r,e=[]),e.push(t)}}(t,!1,m),u=m.onStop=()=>{const t=ke.get(m);if(t){if(c)c(t,4);else for(const e of t)e();ke.delete(m)}},e?o?E(!0):k=m.run():l?l(E.bind(null,!0),!0):m.run(),_.pause=m.pause.bind(m),_.resume=m.resume.bind(m),_.stop=_,_}(t,e,d);return fn&&(m?m.push(h):b&&h()),h}function ko(t,e,r){const o=this.proxy,n=x(t)?t.includes(".")?Eo(o,t):()=>o[t]:t.bind(o,o);let i;v(e)?i=e:(i=e.handler,r=e);const a=cn(this),s=_o(n,i.bind(o),r);return a(),s}function Eo(t,e){const r=e.split(".");return()=>{let e=t;for(let t=0;t<r.length&&e;t++)e=e[r[t]];return e}}const Ao=(t,e)=>"modelValue"===e||"model-value"===e?t.modelModifiers:t[`${e}Modifiers`]||t[`${j(e)}Modifiers`]||t[`${L(e)}Modifiers`];function So(t,e,...r){if(t.isUnmounted)return;const o=t.vnode.props||n;let i=r;const a=e.startsWith("update:"),s=a&&Ao(o,e.slice(7));let l;s&&(s.trim&&(i=r.map((t=>x(t)?t.trim():t))),s.number&&(i=r.map(I))),__VUE_PROD_DEVTOOLS__&&function(t,e,r){qe("component:emit",t.appContext.app,t,e,r)}(t,e,i);let d=o[l=P(e)]||o[l=P(j(e))];!d&&a&&(d=o[l=P(L(e))]),d&&Te(d,t,6,i);const c=o[l+"Once"];if(c){if(t.emitted){if(t.emitted[l])return}else t.emitted={};t.emitted[l]=!0,Te(c,t,6,i)}}function To(t,e,r=!1){const o=e.emitsCache,n=o.get(t);if(void 0!==n)return n;const i=t.emits;let a={},s=!1;if(__VUE_OPTIONS_API__&&!v(t)){const o=t=>{const r=To(t,e,!0);r&&(s=!0,c(a,r))};!r&&e.mixins.length&&e.mixins.forEach(o),t.extends&&o(t.extends),t.mixins&&t.mixins.forEach(o)}return i||s?(g(i)?i.forEach((t=>a[t]=null)):c(a,i),y(t)&&o.set(t,a),a):(y(t)&&o.set(t,null),null)}function Oo(t,e){return!(!t||!l(e))&&(e=e.slice(2).replace(/Once$/,""),m(t,e[0].toLowerCase()+e.slice(1))||m(t,L(e))||m(t,e))}function Co(t){const{type:e,vnode:r,proxy:o,withProxy:n,propsOptions:[i],slots:a,attrs:s,emit:l,render:c,renderCache:p,props:b,data:m,setupState:g,ctx:f,inheritAttrs:u}=t,h=tr(t);let v,x;try{if(4&r.shapeFlag){const t=n||o,e=t;v=tn(c.call(e,t,p,b,g,m,f)),x=s}else{const t=e;v=tn(t.length>1?t(b,{attrs:s,slots:a,emit:l}):t(b,null)),x=e.props?s:jo(s)}}catch(e){Io.length=0,Oe(e,t,1),v=Yo(Mo)}let w=v;if(x&&!1!==u){const t=Object.keys(x),{shapeFlag:e}=w;t.length&&7&e&&(i&&t.some(d)&&(x=zo(x,i)),w=Jo(w,x,!1,!0))}return r.dirs&&(w=Jo(w,null,!1,!0),w.dirs=w.dirs?w.dirs.concat(r.dirs):r.dirs),r.transition&&nr(w,r.transition),v=w,tr(h),v}const jo=t=>{let e;for(const r in t)("class"===r||"style"===r||l(r))&&((e||(e={}))[r]=t[r]);return e},zo=(t,e)=>{const r={};for(const o in t)d(o)&&o.slice(9)in e||(r[o]=t[o]);return r};function Lo(t,e,r){const o=Object.keys(e);if(o.length!==Object.keys(t).length)return!0;for(let n=0;n<o.length;n++){const i=o[n];if(e[i]!==t[i]&&!Oo(r,i))return!0}return!1}const Ro=t=>t.__isSuspense;const Po=Symbol.for("v-fgt"),Do=Symbol.for("v-txt"),Mo=Symbol.for("v-cmt"),No=Symbol.for("v-stc"),Io=[];let Bo=null;function Fo(t=!1){Io.push(Bo=t?null:[])}let $o=1;function Uo(t){$o+=t,t<0&&Bo&&(Bo.hasOnce=!0)}function Vo(t){return t.dynamicChildren=$o>0?Bo||i:null,Io.pop(),Bo=Io[Io.length-1]||null,$o>0&&Bo&&Bo.push(t),t}function Wo(t,e,r,o,n,i){return Vo(Xo(t,e,r,o,n,i,!0))}function Ho(t){return!!t&&!0===t.__v_isVNode}function qo(t,e){return t.type===e.type&&t.key===e.key}const Go=({key:t})=>null!=t?t:null,Ko=({ref:t,ref_key:e,ref_for:r})=>("number"==typeof t&&(t=""+t),null!=t?x(t)||ve(t)||v(t)?{i:Qe,r:t,k:e,f:!!r}:t:null);function Xo(t,e=null,r=null,o=0,n=null,i=(t===Po?0:1),a=!1,s=!1){const l={__v_isVNode:!0,__v_skip:!0,type:t,props:e,key:e&&Go(e),ref:e&&Ko(e),scopeId:Ze,slotScopeIds:null,children:r,component:null,suspense:null,ssContent:null,ssFallback:null,dirs:null,transition:null,el:null,anchor:null,target:null,targetStart:null,targetAnchor:null,staticCount:0,shapeFlag:i,patchFlag:o,dynamicProps:n,dynamicChildren:null,appContext:null,ctx:Qe};return s?(rn(l,r),128&i&&t.normalize(l)):r&&(l.shapeFlag|=x(r)?8:16),$o>0&&!a&&Bo&&(l.patchFlag>0||6&i)&&32!==l.patchFlag&&Bo.push(l),l}const Yo=function(t,e=null,r=null,o=0,n=null,i=!1){if(t&&t!==Tr||(t=Mo),Ho(t)){const o=Jo(t,e,!0);return r&&rn(o,r),$o>0&&!i&&Bo&&(6&o.shapeFlag?Bo[Bo.indexOf(t)]=o:Bo.push(o)),o.patchFlag=-2,o}if(a=t,v(a)&&"__vccOpts"in a&&(t=t.__vccOpts),e){e=function(t){return t?ge(t)||Zr(t)?c({},t):t:null}(e);let{class:t,style:r}=e;t&&!x(t)&&(e.class=q(t)),y(r)&&(ge(r)&&!g(r)&&(r=c({},r)),e.style=$(r))}var a;return Xo(t,e,r,o,n,x(t)?1:Ro(t)?128:(t=>t.__isTeleport)(t)?64:y(t)?4:v(t)?2:0,i,!0)};function Jo(t,e,r=!1,o=!1){const{props:n,ref:i,patchFlag:a,children:s,transition:d}=t,c=e?function(...t){const e={};for(let r=0;r<t.length;r++){const o=t[r];for(const t in o)if("class"===t)e.class!==o.class&&(e.class=q([e.class,o.class]));else if("style"===t)e.style=$([e.style,o.style]);else if(l(t)){const r=e[t],n=o[t];!n||r===n||g(r)&&r.includes(n)||(e[t]=r?[].concat(r,n):n)}else""!==t&&(e[t]=o[t])}return e}(n||{},e):n,p={__v_isVNode:!0,__v_skip:!0,type:t.type,props:c,key:c&&Go(c),ref:e&&e.ref?r&&i?g(i)?i.concat(Ko(e)):[i,Ko(e)]:Ko(e):i,scopeId:t.scopeId,slotScopeIds:t.slotScopeIds,children:s,target:t.target,targetStart:t.targetStart,targetAnchor:t.targetAnchor,staticCount:t.staticCount,shapeFlag:t.shapeFlag,patchFlag:e&&t.type!==Po?-1===a?16:16|a:a,dynamicProps:t.dynamicProps,dynamicChildren:t.dynamicChildren,appContext:t.appContext,dirs:t.dirs,transition:d,component:t.component,suspense:t.suspense,ssContent:t.ssContent&&Jo(t.ssContent),ssFallback:t.ssFallback&&Jo(t.ssFallback),el:t.el,anchor:t.anchor,ctx:t.ctx,ce:t.ce};return d&&o&&nr(p,d.clone(p)),p}function Qo(t=" ",e=0){return Yo(Do,null,t,e)}function Zo(t="",e=!1){return e?(Fo(),Vo(Yo(Mo,null,t,r,o,!0))):Yo(Mo,null,t);var r,o}function tn(t){return null==t||"boolean"==typeof t?Yo(Mo):g(t)?Yo(Po,null,t.slice()):Ho(t)?en(t):Yo(Do,null,String(t))}function en(t){return null===t.el&&-1!==t.patchFlag||t.memo?t:Jo(t)}function rn(t,e){let r=0;const{shapeFlag:o}=t;if(null==e)e=null;else if(g(e))r=16;else if("object"==typeof e){if(65&o){const r=e.default;return void(r&&(r._c&&(r._d=!1),rn(t,r()),r._c&&(r._d=!0)))}{r=32;const o=e._;o||Zr(e)?3===o&&Qe&&(1===Qe.slots._?e._=1:(e._=2,t.patchFlag|=1024)):e._ctx=Qe}}else v(e)?(e={default:e,_ctx:Qe},r=32):(e=String(e),64&o?(r=16,e=[Qo(e)]):r=8);t.children=e,t.shapeFlag|=r}function on(t,e,r,o=null){Te(t,e,7,[r,o])}const nn=qr();let an=0;let sn=null;let ln,dn;{const t=F(),e=(e,r)=>{let o;return(o=t[e])||(o=t[e]=[]),o.push(r),t=>{o.length>1?o.forEach((e=>e(t))):o[0](t)}};ln=e("__VUE_INSTANCE_SETTERS__",(t=>sn=t)),dn=e("__VUE_SSR_SETTERS__",(t=>fn=t))}const cn=t=>{const e=sn;return ln(t),t.scope.on(),()=>{t.scope.off(),ln(e)}},pn=()=>{sn&&sn.scope.off(),ln(null)};function bn(t){return 4&t.vnode.shapeFlag}let mn,gn,fn=!1;function un(t,e,r){v(e)?t.type.__ssrInlineRender?t.ssrRender=e:t.render=e:y(e)&&(__VUE_PROD_DEVTOOLS__&&(t.devtoolsRawSetupState=e),t.setupState=we(e)),hn(t,r)}function hn(t,e,r){const o=t.type;if(!t.render){if(!e&&mn&&!o.render){const e=o.template||Ir(t).template;if(e){const{isCustomElement:r,compilerOptions:n}=t.appContext.config,{delimiters:i,compilerOptions:a}=o,s=c(c({isCustomElement:r,delimiters:i},n),a);o.render=mn(e,s)}}t.render=o.render||a,gn&&gn(t)}if(__VUE_OPTIONS_API__){const e=cn(t);wt();try{!function(t){const e=Ir(t),r=t.proxy,o=t.ctx;Dr=!1,e.beforeCreate&&Mr(e.beforeCreate,t,"bc");const{data:n,computed:i,methods:s,watch:l,provide:d,inject:c,created:p,beforeMount:b,mounted:m,beforeUpdate:f,updated:u,activated:h,deactivated:x,beforeDestroy:w,beforeUnmount:_,destroyed:k,unmounted:E,render:A,renderTracked:S,renderTriggered:T,errorCaptured:O,serverPrefetch:C,expose:j,inheritAttrs:z,components:L,directives:R,filters:P}=e;if(c&&function(t,e){g(t)&&(t=Ur(t));for(const r in t){const o=t[r];let n;n=y(o)?"default"in o?Yr(o.from||r,o.default,!0):Yr(o.from||r):Yr(o),ve(n)?Object.defineProperty(e,r,{enumerable:!0,configurable:!0,get:()=>n.value,set:t=>n.value=t}):e[r]=n}}(c,o),s)for(const t in s){const e=s[t];v(e)&&(o[t]=e.bind(r))}if(n){const e=n.call(r,r);y(e)&&(t.data=le(e))}if(Dr=!0,i)for(const t in i){const e=i[t],n=v(e)?e.bind(r,r):v(e.get)?e.get.bind(r,r):a,s=!v(e)&&v(e.set)?e.set.bind(r):a,l=wn({get:n,set:s});Object.defineProperty(o,t,{enumerable:!0,configurable:!0,get:()=>l.value,set:t=>l.value=t})}if(l)for(const t in l)Nr(l[t],o,r,t);if(d){const t=v(d)?d.call(r):d;Reflect.ownKeys(t).forEach((e=>{!function(t,e){if(sn){let r=sn.provides;const o=sn.parent&&sn.parent.provides;o===r&&(r=sn.provides=Object.create(o)),r[t]=e}}(e,t[e])}))}function D(t,e){g(e)?e.forEach((e=>t(e.bind(r)))):e&&t(e.bind(r))}if(p&&Mr(p,t,"c"),D(fr,b),D(ur,m),D(hr,f),D(vr,u),D(dr,h),D(cr,x),D(Er,O),D(kr,S),D(_r,T),D(xr,_),D(wr,E),D(yr,C),g(j))if(j.length){const e=t.exposed||(t.exposed={});j.forEach((t=>{Object.defineProperty(e,t,{get:()=>r[t],set:e=>r[t]=e})}))}else t.exposed||(t.exposed={});A&&t.render===a&&(t.render=A),null!=z&&(t.inheritAttrs=z),L&&(t.components=L),R&&(t.directives=R),C&&ir(t)}(t)}finally{yt(),e()}}}const vn={get:(t,e)=>(zt(t,0,""),t[e])};function xn(t){return t.exposed?t.exposeProxy||(t.exposeProxy=new Proxy(we((e=t.exposed,!m(e,"__v_skip")&&Object.isExtensible(e)&&N(e,"__v_skip",!0),e)),{get:(e,r)=>r in e?e[r]:r in zr?zr[r](t):void 0,has:(t,e)=>e in t||e in zr})):t.proxy;var e}const wn=(t,e)=>{const r=function(t,e,r=!1){let o,n;return v(t)?o=t:(o=t.get,n=t.set),new ye(o,n,r)}(t,0,fn);return r},yn="3.5.12";let _n;const kn="undefined"!=typeof window&&window.trustedTypes;if(kn)try{_n=kn.createPolicy("vue",{createHTML:t=>t})}catch(t){}const En=_n?t=>_n.createHTML(t):t=>t,An="undefined"!=typeof document?document:null,Sn=An&&An.createElement("template"),Tn={insert:(t,e,r)=>{e.insertBefore(t,r||null)},remove:t=>{const e=t.parentNode;e&&e.removeChild(t)},createElement:(t,e,r,o)=>{const n="svg"===e?An.createElementNS("http://www.w3.org/2000/svg",t):"mathml"===e?An.createElementNS("http://www.w3.org/1998/Math/MathML",t):r?An.createElement(t,{is:r}):An.createElement(t);return"select"===t&&o&&null!=o.multiple&&n.setAttribute("multiple",o.multiple),n},createText:t=>An.createTextNode(t),createComment:t=>An.createComment(t),setText:(t,e)=>{t.nodeValue=e},setElementText:(t,e)=>{t.textContent=e},parentNode:t=>t.parentNode,nextSibling:t=>t.nextSibling,querySelector:t=>An.querySelector(t),setScopeId(t,e){t.setAttribute(e,"")},insertStaticContent(t,e,r,o,n,i){const a=r?r.previousSibling:e.lastChild;if(n&&(n===i||n.nextSibling))for(;e.insertBefore(n.cloneNode(!0),r),n!==i&&(n=n.nextSibling););else{Sn.innerHTML=En("svg"===o?`<svg>${t}</svg>`:"mathml"===o?`<math>${t}</math>`:t);const n=Sn.content;if("svg"===o||"mathml"===o){const t=n.firstChild;for(;t.firstChild;)n.appendChild(t.firstChild);n.removeChild(t)}e.insertBefore(n,r)}return[a?a.nextSibling:e.firstChild,r?r.previousSibling:e.lastChild]}},On=Symbol("_vtc");Boolean;const Cn=Symbol("_vod"),jn=Symbol("_vsh"),zn=Symbol(""),Ln=/(^|;)\s*display\s*:/,Rn=/\s*!important$/;function Pn(t,e,r){if(g(r))r.forEach((r=>Pn(t,e,r)));else if(null==r&&(r=""),e.startsWith("--"))t.setProperty(e,r);else{const o=function(t,e){const r=Mn[e];if(r)return r;let o=j(e);if("filter"!==o&&o in t)return Mn[e]=o;o=R(o);for(let r=0;r<Dn.length;r++){const n=Dn[r]+o;if(n in t)return Mn[e]=n}return e}(t,e);Rn.test(r)?t.setProperty(L(o),r.replace(Rn,""),"important"):t[o]=r}}const Dn=["Webkit","Moz","ms"],Mn={},Nn="http://www.w3.org/1999/xlink";function In(t,e,r,o,n,i=G(e)){o&&e.startsWith("xlink:")?null==r?t.removeAttributeNS(Nn,e.slice(6,e.length)):t.setAttributeNS(Nn,e,r):null==r||i&&!K(r)?t.removeAttribute(e):t.setAttribute(e,i?"":w(r)?String(r):r)}function Bn(t,e,r,o,n){if("innerHTML"===e||"textContent"===e)return void(null!=r&&(t[e]="innerHTML"===e?En(r):r));const i=t.tagName;if("value"===e&&"PROGRESS"!==i&&!i.includes("-")){const o="OPTION"===i?t.getAttribute("value")||"":t.value,n=null==r?"checkbox"===t.type?"on":"":String(r);return o===n&&"_value"in t||(t.value=n),null==r&&t.removeAttribute(e),void(t._value=r)}let a=!1;if(""===r||null==r){const o=typeof t[e];"boolean"===o?r=K(r):null==r&&"string"===o?(r="",a=!0):"number"===o&&(r=0,a=!0)}try{t[e]=r}catch(t){}a&&t.removeAttribute(n||e)}function Fn(t,e,r,o){t.addEventListener(e,r,o)}const $n=Symbol("_vei");const Un=/(?:Once|Passive|Capture)$/;let Vn=0;const Wn=Promise.resolve(),Hn=()=>Vn||(Wn.then((()=>Vn=0)),Vn=Date.now()),qn=t=>111===t.charCodeAt(0)&&110===t.charCodeAt(1)&&t.charCodeAt(2)>96&&t.charCodeAt(2)<123;"undefined"!=typeof HTMLElement&&HTMLElement,Symbol("_moveCb"),Symbol("_enterCb");const Gn=t=>{const e=t.props["onUpdate:modelValue"]||!1;return g(e)?t=>M(e,t):e};function Kn(t){t.target.composing=!0}function Xn(t){const e=t.target;e.composing&&(e.composing=!1,e.dispatchEvent(new Event("input")))}const Yn=Symbol("_assign"),Jn={created(t,{modifiers:{lazy:e,trim:r,number:o}},n){t[Yn]=Gn(n);const i=o||n.props&&"number"===n.props.type;Fn(t,e?"change":"input",(e=>{if(e.target.composing)return;let o=t.value;r&&(o=o.trim()),i&&(o=I(o)),t[Yn](o)})),r&&Fn(t,"change",(()=>{t.value=t.value.trim()})),e||(Fn(t,"compositionstart",Kn),Fn(t,"compositionend",Xn),Fn(t,"change",Xn))},mounted(t,{value:e}){t.value=null==e?"":e},beforeUpdate(t,{value:e,oldValue:r,modifiers:{lazy:o,trim:n,number:i}},a){if(t[Yn]=Gn(a),t.composing)return;const s=null==e?"":e;if((!i&&"number"!==t.type||/^0\d/.test(t.value)?t.value:I(t.value))!==s){if(document.activeElement===t&&"range"!==t.type){if(o&&e===r)return;if(n&&t.value.trim()===s)return}t.value=s}}},Qn={deep:!0,created(t,e,r){t[Yn]=Gn(r),Fn(t,"change",(()=>{const e=t._modelValue,r=function(t){return"_value"in t?t._value:t.value}(t),o=t.checked,n=t[Yn];if(g(e)){const t=Y(e,r),i=-1!==t;if(o&&!i)n(e.concat(r));else if(!o&&i){const r=[...e];r.splice(t,1),n(r)}}else if(u(e)){const t=new Set(e);o?t.add(r):t.delete(r),n(t)}else n(ti(t,o))}))},mounted:Zn,beforeUpdate(t,e,r){t[Yn]=Gn(r),Zn(t,e,r)}};function Zn(t,{value:e,oldValue:r},o){let n;if(t._modelValue=e,g(e))n=Y(e,o.props.value)>-1;else if(u(e))n=e.has(o.props.value);else{if(e===r)return;n=X(e,ti(t,!0))}t.checked!==n&&(t.checked=n)}function ti(t,e){const r=e?"_trueValue":"_falseValue";return r in t?t[r]:e}const ei=["ctrl","shift","alt","meta"],ri={stop:t=>t.stopPropagation(),prevent:t=>t.preventDefault(),self:t=>t.target!==t.currentTarget,ctrl:t=>!t.ctrlKey,shift:t=>!t.shiftKey,alt:t=>!t.altKey,meta:t=>!t.metaKey,left:t=>"button"in t&&0!==t.button,middle:t=>"button"in t&&1!==t.button,right:t=>"button"in t&&2!==t.button,exact:(t,e)=>ei.some((r=>t[`${r}Key`]&&!e.includes(r)))},oi=(t,e)=>{const r=t._withMods||(t._withMods={}),o=e.join(".");return r[o]||(r[o]=(r,...o)=>{for(let t=0;t<e.length;t++){const o=ri[e[t]];if(o&&o(r,e))return}return t(r,...o)})},ni=c({patchProp:(t,e,r,o,n,i)=>{const a="svg"===n;"class"===e?function(t,e,r){const o=t[On];o&&(e=(e?[e,...o]:[...o]).join(" ")),null==e?t.removeAttribute("class"):r?t.setAttribute("class",e):t.className=e}(t,o,a):"style"===e?function(t,e,r){const o=t.style,n=x(r);let i=!1;if(r&&!n){if(e)if(x(e))for(const t of e.split(";")){const e=t.slice(0,t.indexOf(":")).trim();null==r[e]&&Pn(o,e,"")}else for(const t in e)null==r[t]&&Pn(o,t,"");for(const t in r)"display"===t&&(i=!0),Pn(o,t,r[t])}else if(n){if(e!==r){const t=o[zn];t&&(r+=";"+t),o.cssText=r,i=Ln.test(r)}}else e&&t.removeAttribute("style");Cn in t&&(t[Cn]=i?o.display:"",t[jn]&&(o.display="none"))}(t,r,o):l(e)?d(e)||function(t,e,r,o,n=null){const i=t[$n]||(t[$n]={}),a=i[e];if(o&&a)a.value=o;else{const[r,s]=function(t){let e;if(Un.test(t)){let r;for(e={};r=t.match(Un);)t=t.slice(0,t.length-r[0].length),e[r[0].toLowerCase()]=!0}return[":"===t[2]?t.slice(3):L(t.slice(2)),e]}(e);if(o){const a=i[e]=function(t,e){const r=t=>{if(t._vts){if(t._vts<=r.attached)return}else t._vts=Date.now();Te(function(t,e){if(g(e)){const r=t.stopImmediatePropagation;return t.stopImmediatePropagation=()=>{r.call(t),t._stopped=!0},e.map((t=>e=>!e._stopped&&t&&t(e)))}return e}(t,r.value),e,5,[t])};return r.value=t,r.attached=Hn(),r}(o,n);Fn(t,r,a,s)}else a&&(function(t,e,r,o){t.removeEventListener(e,r,o)}(t,r,a,s),i[e]=void 0)}}(t,e,0,o,i):("."===e[0]?(e=e.slice(1),1):"^"===e[0]?(e=e.slice(1),0):function(t,e,r,o){if(o)return"innerHTML"===e||"textContent"===e||!!(e in t&&qn(e)&&v(r));if("spellcheck"===e||"draggable"===e||"translate"===e)return!1;if("form"===e)return!1;if("list"===e&&"INPUT"===t.tagName)return!1;if("type"===e&&"TEXTAREA"===t.tagName)return!1;if("width"===e||"height"===e){const e=t.tagName;if("IMG"===e||"VIDEO"===e||"CANVAS"===e||"SOURCE"===e)return!1}return(!qn(e)||!x(r))&&e in t}(t,e,o,a))?(Bn(t,e,o),t.tagName.includes("-")||"value"!==e&&"checked"!==e&&"selected"!==e||In(t,e,o,a,0,"value"!==e)):!t._isVueCE||!/[A-Z]/.test(e)&&x(o)?("true-value"===e?t._trueValue=o:"false-value"===e&&(t._falseValue=o),In(t,e,o,a)):Bn(t,j(e),o,0,e)}},Tn);let ii;const ai={id:"app"},si={class:"container"},li={class:"row justify-content-center mb-5"},di={class:"col-12 col-sm-10 col-md-8 col-lg-6 text-center"},ci={key:0},pi={key:0,class:"alert alert-warning text-muted",style:{"font-size":"0.7em"},role:"alert"},bi={key:1};function mi(t,e){return function(){return t.apply(e,arguments)}}const{toString:gi}=Object.prototype,{getPrototypeOf:fi}=Object,ui=(hi=Object.create(null),t=>{const e=gi.call(t);return hi[e]||(hi[e]=e.slice(8,-1).toLowerCase())});var hi;const vi=t=>(t=t.toLowerCase(),e=>ui(e)===t),xi=t=>e=>typeof e===t,{isArray:wi}=Array,yi=xi("undefined"),_i=vi("ArrayBuffer"),ki=xi("string"),Ei=xi("function"),Ai=xi("number"),Si=t=>null!==t&&"object"==typeof t,Ti=t=>{if("object"!==ui(t))return!1;const e=fi(t);return!(null!==e&&e!==Object.prototype&&null!==Object.getPrototypeOf(e)||Symbol.toStringTag in t||Symbol.iterator in t)},Oi=vi("Date"),Ci=vi("File"),ji=vi("Blob"),zi=vi("FileList"),Li=vi("URLSearchParams"),[Ri,Pi,Di,Mi]=["ReadableStream","Request","Response","Headers"].map(vi);function Ni(t,e,{allOwnKeys:r=!1}={}){if(null==t)return;let o,n;if("object"!=typeof t&&(t=[t]),wi(t))for(o=0,n=t.length;o<n;o++)e.call(null,t[o],o,t);else{const n=r?Object.getOwnPropertyNames(t):Object.keys(t),i=n.length;let a;for(o=0;o<i;o++)a=n[o],e.call(null,t[a],a,t)}}function Ii(t,e){e=e.toLowerCase();const r=Object.keys(t);let o,n=r.length;for(;n-- >0;)if(o=r[n],e===o.toLowerCase())return o;return null}const Bi="undefined"!=typeof globalThis?globalThis:"undefined"!=typeof self?self:"undefined"!=typeof window?window:global,Fi=t=>!yi(t)&&t!==Bi,$i=(Ui="undefined"!=typeof Uint8Array&&fi(Uint8Array),t=>Ui&&t instanceof Ui);var Ui;const Vi=vi("HTMLFormElement"),Wi=(({hasOwnProperty:t})=>(e,r)=>t.call(e,r))(Object.prototype),Hi=vi("RegExp"),qi=(t,e)=>{const r=Object.getOwnPropertyDescriptors(t),o={};Ni(r,((r,n)=>{let i;!1!==(i=e(r,n,t))&&(o[n]=i||r)})),Object.defineProperties(t,o)},Gi="abcdefghijklmnopqrstuvwxyz",Ki="0123456789",Xi={DIGIT:Ki,ALPHA:Gi,ALPHA_DIGIT:Gi+Gi.toUpperCase()+Ki},Yi=vi("AsyncFunction"),Ji=(Qi="function"==typeof setImmediate,Zi=Ei(Bi.postMessage),Qi?setImmediate:Zi?(ta=`axios@${Math.random()}`,ea=[],Bi.addEventListener("message",(({source:t,data:e})=>{t===Bi&&e===ta&&ea.length&&ea.shift()()}),!1),t=>{ea.push(t),Bi.postMessage(ta,"*")}):t=>setTimeout(t));var Qi,Zi,ta,ea;const ra="undefined"!=typeof queueMicrotask?queueMicrotask.bind(Bi):"undefined"!=typeof process&&process.nextTick||Ji,oa={isArray:wi,isArrayBuffer:_i,isBuffer:function(t){return null!==t&&!yi(t)&&null!==t.constructor&&!yi(t.constructor)&&Ei(t.constructor.isBuffer)&&t.constructor.isBuffer(t)},isFormData:t=>{let e;return t&&("function"==typeof FormData&&t instanceof FormData||Ei(t.append)&&("formdata"===(e=ui(t))||"object"===e&&Ei(t.toString)&&"[object FormData]"===t.toString()))},isArrayBufferView:function(t){let e;return e="undefined"!=typeof ArrayBuffer&&ArrayBuffer.isView?ArrayBuffer.isView(t):t&&t.buffer&&_i(t.buffer),e},isString:ki,isNumber:Ai,isBoolean:t=>!0===t||!1===t,isObject:Si,isPlainObject:Ti,isReadableStream:Ri,isRequest:Pi,isResponse:Di,isHeaders:Mi,isUndefined:yi,isDate:Oi,isFile:Ci,isBlob:ji,isRegExp:Hi,isFunction:Ei,isStream:t=>Si(t)&&Ei(t.pipe),isURLSearchParams:Li,isTypedArray:$i,isFileList:zi,forEach:Ni,merge:function t(){const{caseless:e}=Fi(this)&&this||{},r={},o=(o,n)=>{const i=e&&Ii(r,n)||n;Ti(r[i])&&Ti(o)?r[i]=t(r[i],o):Ti(o)?r[i]=t({},o):wi(o)?r[i]=o.slice():r[i]=o};for(let t=0,e=arguments.length;t<e;t++)arguments[t]&&Ni(arguments[t],o);return r},extend:(t,e,r,{allOwnKeys:o}={})=>(Ni(e,((e,o)=>{r&&Ei(e)?t[o]=mi(e,r):t[o]=e}),{allOwnKeys:o}),t),trim:t=>t.trim?t.trim():t.replace(/^[\s\uFEFF\xA0]+|[\s\uFEFF\xA0]+$/g,""),stripBOM:t=>(65279===t.charCodeAt(0)&&(t=t.slice(1)),t),inherits:(t,e,r,o)=>{t.prototype=Object.create(e.prototype,o),t.prototype.constructor=t,Object.defineProperty(t,"super",{value:e.prototype}),r&&Object.assign(t.prototype,r)},toFlatObject:(t,e,r,o)=>{let n,i,a;const s={};if(e=e||{},null==t)return e;do{for(n=Object.getOwnPropertyNames(t),i=n.length;i-- >0;)a=n[i],o&&!o(a,t,e)||s[a]||(e[a]=t[a],s[a]=!0);t=!1!==r&&fi(t)}while(t&&(!r||r(t,e))&&t!==Object.prototype);return e},kindOf:ui,kindOfTest:vi,endsWith:(t,e,r)=>{t=String(t),(void 0===r||r>t.length)&&(r=t.length),r-=e.length;const o=t.indexOf(e,r);return-1!==o&&o===r},toArray:t=>{if(!t)return null;if(wi(t))return t;let e=t.length;if(!Ai(e))return null;const r=new Array(e);for(;e-- >0;)r[e]=t[e];return r},forEachEntry:(t,e)=>{const r=(t&&t[Symbol.iterator]).call(t);let o;for(;(o=r.next())&&!o.done;){const r=o.value;e.call(t,r[0],r[1])}},matchAll:(t,e)=>{let r;const o=[];for(;null!==(r=t.exec(e));)o.push(r);return o},isHTMLForm:Vi,hasOwnProperty:Wi,hasOwnProp:Wi,reduceDescriptors:qi,freezeMethods:t=>{qi(t,((e,r)=>{if(Ei(t)&&-1!==["arguments","caller","callee"].indexOf(r))return!1;const o=t[r];Ei(o)&&(e.enumerable=!1,"writable"in e?e.writable=!1:e.set||(e.set=()=>{throw Error("Can not rewrite read-only method '"+r+"'")}))}))},toObjectSet:(t,e)=>{const r={},o=t=>{t.forEach((t=>{r[t]=!0}))};return wi(t)?o(t):o(String(t).split(e)),r},toCamelCase:t=>t.toLowerCase().replace(/[-_\s]([a-z\d])(\w*)/g,(function(t,e,r){return e.toUpperCase()+r})),noop:()=>{},toFiniteNumber:(t,e)=>null!=t&&Number.isFinite(t=+t)?t:e,findKey:Ii,global:Bi,isContextDefined:Fi,ALPHABET:Xi,generateString:(t=16,e=Xi.ALPHA_DIGIT)=>{let r="";const{length:o}=e;for(;t--;)r+=e[Math.random()*o|0];return r},isSpecCompliantForm:function(t){return!!(t&&Ei(t.append)&&"FormData"===t[Symbol.toStringTag]&&t[Symbol.iterator])},toJSONObject:t=>{const e=new Array(10),r=(t,o)=>{if(Si(t)){if(e.indexOf(t)>=0)return;if(!("toJSON"in t)){e[o]=t;const n=wi(t)?[]:{};return Ni(t,((t,e)=>{const i=r(t,o+1);!yi(i)&&(n[e]=i)})),e[o]=void 0,n}}return t};return r(t,0)},isAsyncFn:Yi,isThenable:t=>t&&(Si(t)||Ei(t))&&Ei(t.then)&&Ei(t.catch),setImmediate:Ji,asap:ra};function na(t,e,r,o,n){Error.call(this),Error.captureStackTrace?Error.captureStackTrace(this,this.constructor):this.stack=(new Error).stack,this.message=t,this.name="AxiosError",e&&(this.code=e),r&&(this.config=r),o&&(this.request=o),n&&(this.response=n,this.status=n.status?n.status:null)}oa.inherits(na,Error,{toJSON:function(){return{message:this.message,name:this.name,description:this.description,number:this.number,fileName:this.fileName,lineNumber:this.lineNumber,columnNumber:this.columnNumber,stack:this.stack,config:oa.toJSONObject(this.config),code:this.code,status:this.status}}});const ia=na.prototype,aa={};["ERR_BAD_OPTION_VALUE","ERR_BAD_OPTION","ECONNABORTED","ETIMEDOUT","ERR_NETWORK","ERR_FR_TOO_MANY_REDIRECTS","ERR_DEPRECATED","ERR_BAD_RESPONSE","ERR_BAD_REQUEST","ERR_CANCELED","ERR_NOT_SUPPORT","ERR_INVALID_URL"].forEach((t=>{aa[t]={value:t}})),Object.defineProperties(na,aa),Object.defineProperty(ia,"isAxiosError",{value:!0}),na.from=(t,e,r,o,n,i)=>{const a=Object.create(ia);return oa.toFlatObject(t,a,(function(t){return t!==Error.prototype}),(t=>"isAxiosError"!==t)),na.call(a,t.message,e,r,o,n),a.cause=t,a.name=t.name,i&&Object.assign(a,i),a};const sa=na;function la(t){return oa.isPlainObject(t)||oa.isArray(t)}function da(t){return oa.endsWith(t,"[]")?t.slice(0,-2):t}function ca(t,e,r){return t?t.concat(e).map((function(t,e){return t=da(t),!r&&e?"["+t+"]":t})).join(r?".":""):e}const pa=oa.toFlatObject(oa,{},null,(function(t){return/^is[A-Z]/.test(t)})),ba=function(t,e,r){if(!oa.isObject(t))throw new TypeError("target must be an object");e=e||new FormData;const o=(r=oa.toFlatObject(r,{metaTokens:!0,dots:!1,indexes:!1},!1,(function(t,e){return!oa.isUndefined(e[t])}))).metaTokens,n=r.visitor||d,i=r.dots,a=r.indexes,s=(r.Blob||"undefined"!=typeof Blob&&Blob)&&oa.isSpecCompliantForm(e);if(!oa.isFunction(n))throw new TypeError("visitor must be a function");function l(t){if(null===t)return"";if(oa.isDate(t))return t.toISOString();if(!s&&oa.isBlob(t))throw new sa("Blob is not supported. Use a Buffer instead.");return oa.isArrayBuffer(t)||oa.isTypedArray(t)?s&&"function"==typeof Blob?new Blob([t]):Buffer.from(t):t}function d(t,r,n){let s=t;if(t&&!n&&"object"==typeof t)if(oa.endsWith(r,"{}"))r=o?r:r.slice(0,-2),t=JSON.stringify(t);else if(oa.isArray(t)&&function(t){return oa.isArray(t)&&!t.some(la)}(t)||(oa.isFileList(t)||oa.endsWith(r,"[]"))&&(s=oa.toArray(t)))return r=da(r),s.forEach((function(t,o){!oa.isUndefined(t)&&null!==t&&e.append(!0===a?ca([r],o,i):null===a?r:r+"[]",l(t))})),!1;return!!la(t)||(e.append(ca(n,r,i),l(t)),!1)}const c=[],p=Object.assign(pa,{defaultVisitor:d,convertValue:l,isVisitable:la});if(!oa.isObject(t))throw new TypeError("data must be an object");return function t(r,o){if(!oa.isUndefined(r)){if(-1!==c.indexOf(r))throw Error("Circular reference detected in "+o.join("."));c.push(r),oa.forEach(r,(function(r,i){!0===(!(oa.isUndefined(r)||null===r)&&n.call(e,r,oa.isString(i)?i.trim():i,o,p))&&t(r,o?o.concat(i):[i])})),c.pop()}}(t),e};function ma(t){const e={"!":"%21","'":"%27","(":"%28",")":"%29","~":"%7E","%20":"+","%00":"\0"};return encodeURIComponent(t).replace(/[!'()~]|%20|%00/g,(function(t){return e[t]}))}function ga(t,e){this._pairs=[],t&&ba(t,this,e)}const fa=ga.prototype;fa.append=function(t,e){this._pairs.push([t,e])},fa.toString=function(t){const e=t?function(e){return t.call(this,e,ma)}:ma;return this._pairs.map((function(t){return e(t[0])+"="+e(t[1])}),"").join("&")};const ua=ga;function ha(t){return encodeURIComponent(t).replace(/%3A/gi,":").replace(/%24/g,"$").replace(/%2C/gi,",").replace(/%20/g,"+").replace(/%5B/gi,"[").replace(/%5D/gi,"]")}function va(t,e,r){if(!e)return t;const o=r&&r.encode||ha,n=r&&r.serialize;let i;if(i=n?n(e,r):oa.isURLSearchParams(e)?e.toString():new ua(e,r).toString(o),i){const e=t.indexOf("#");-1!==e&&(t=t.slice(0,e)),t+=(-1===t.indexOf("?")?"?":"&")+i}return t}const xa=class{constructor(){this.handlers=[]}use(t,e,r){return this.handlers.push({fulfilled:t,rejected:e,synchronous:!!r&&r.synchronous,runWhen:r?r.runWhen:null}),this.handlers.length-1}eject(t){this.handlers[t]&&(this.handlers[t]=null)}clear(){this.handlers&&(this.handlers=[])}forEach(t){oa.forEach(this.handlers,(function(e){null!==e&&t(e)}))}},wa={silentJSONParsing:!0,forcedJSONParsing:!0,clarifyTimeoutError:!1},ya={isBrowser:!0,classes:{URLSearchParams:"undefined"!=typeof URLSearchParams?URLSearchParams:ua,FormData:"undefined"!=typeof FormData?FormData:null,Blob:"undefined"!=typeof Blob?Blob:null},protocols:["http","https","file","blob","url","data"]},_a="undefined"!=typeof window&&"undefined"!=typeof document,ka="object"==typeof navigator&&navigator||void 0,Ea=_a&&(!ka||["ReactNative","NativeScript","NS"].indexOf(ka.product)<0),Aa="undefined"!=typeof WorkerGlobalScope&&self instanceof WorkerGlobalScope&&"function"==typeof self.importScripts,Sa=_a&&window.location.href||"http://localhost",Ta={...t,...ya},Oa=function(t){function e(t,r,o,n){let i=t[n++];if("__proto__"===i)return!0;const a=Number.isFinite(+i),s=n>=t.length;return i=!i&&oa.isArray(o)?o.length:i,s?(oa.hasOwnProp(o,i)?o[i]=[o[i],r]:o[i]=r,!a):(o[i]&&oa.isObject(o[i])||(o[i]=[]),e(t,r,o[i],n)&&oa.isArray(o[i])&&(o[i]=function(t){const e={},r=Object.keys(t);let o;const n=r.length;let i;for(o=0;o<n;o++)i=r[o],e[i]=t[i];return e}(o[i])),!a)}if(oa.isFormData(t)&&oa.isFunction(t.entries)){const r={};return oa.forEachEntry(t,((t,o)=>{e(function(t){return oa.matchAll(/\w+|\[(\w*)]/g,t).map((t=>"[]"===t[0]?"":t[1]||t[0]))}(t),o,r,0)})),r}return null},Ca={transitional:wa,adapter:["xhr","http","fetch"],transformRequest:[function(t,e){const r=e.getContentType()||"",o=r.indexOf("application/json")>-1,n=oa.isObject(t);if(n&&oa.isHTMLForm(t)&&(t=new FormData(t)),oa.isFormData(t))return o?JSON.stringify(Oa(t)):t;if(oa.isArrayBuffer(t)||oa.isBuffer(t)||oa.isStream(t)||oa.isFile(t)||oa.isBlob(t)||oa.isReadableStream(t))return t;if(oa.isArrayBufferView(t))return t.buffer;if(oa.isURLSearchParams(t))return e.setContentType("application/x-www-form-urlencoded;charset=utf-8",!1),t.toString();let i;if(n){if(r.indexOf("application/x-www-form-urlencoded")>-1)return function(t,e){return ba(t,new Ta.classes.URLSearchParams,Object.assign({visitor:function(t,e,r,o){return Ta.isNode&&oa.isBuffer(t)?(this.append(e,t.toString("base64")),!1):o.defaultVisitor.apply(this,arguments)}},e))}(t,this.formSerializer).toString();if((i=oa.isFileList(t))||r.indexOf("multipart/form-data")>-1){const e=this.env&&this.env.FormData;return ba(i?{"files[]":t}:t,e&&new e,this.formSerializer)}}return n||o?(e.setContentType("application/json",!1),function(t){if(oa.isString(t))try{return(0,JSON.parse)(t),oa.trim(t)}catch(t){if("SyntaxError"!==t.name)throw t}return(0,JSON.stringify)(t)}(t)):t}],transformResponse:[function(t){const e=this.transitional||Ca.transitional,r=e&&e.forcedJSONParsing,o="json"===this.responseType;if(oa.isResponse(t)||oa.isReadableStream(t))return t;if(t&&oa.isString(t)&&(r&&!this.responseType||o)){const r=!(e&&e.silentJSONParsing)&&o;try{return JSON.parse(t)}catch(t){if(r){if("SyntaxError"===t.name)throw sa.from(t,sa.ERR_BAD_RESPONSE,this,null,this.response);throw t}}}return t}],timeout:0,xsrfCookieName:"XSRF-TOKEN",xsrfHeaderName:"X-XSRF-TOKEN",maxContentLength:-1,maxBodyLength:-1,env:{FormData:Ta.classes.FormData,Blob:Ta.classes.Blob},validateStatus:function(t){return t>=200&&t<300},headers:{common:{Accept:"application/json, text/plain, */*","Content-Type":void 0}}};oa.forEach(["delete","get","head","post","put","patch"],(t=>{Ca.headers[t]={}}));const ja=Ca,za=oa.toObjectSet(["age","authorization","content-length","content-type","etag","expires","from","host","if-modified-since","if-unmodified-since","last-modified","location","max-forwards","proxy-authorization","referer","retry-after","user-agent"]),La=Symbol("internals");function Ra(t){return t&&String(t).trim().toLowerCase()}function Pa(t){return!1===t||null==t?t:oa.isArray(t)?t.map(Pa):String(t)}function Da(t,e,r,o,n){return oa.isFunction(o)?o.call(this,e,r):(n&&(e=r),oa.isString(e)?oa.isString(o)?-1!==e.indexOf(o):oa.isRegExp(o)?o.test(e):void 0:void 0)}class Ma{constructor(t){t&&this.set(t)}set(t,e,r){const o=this;function n(t,e,r){const n=Ra(e);if(!n)throw new Error("header name must be a non-empty string");const i=oa.findKey(o,n);(!i||void 0===o[i]||!0===r||void 0===r&&!1!==o[i])&&(o[i||e]=Pa(t))}const i=(t,e)=>oa.forEach(t,((t,r)=>n(t,r,e)));if(oa.isPlainObject(t)||t instanceof this.constructor)i(t,e);else if(oa.isString(t)&&(t=t.trim())&&!/^[-_a-zA-Z0-9^`|~,!#$%&'*+.]+$/.test(t.trim()))i((t=>{const e={};let r,o,n;return t&&t.split("\n").forEach((function(t){n=t.indexOf(":"),r=t.substring(0,n).trim().toLowerCase(),o=t.substring(n+1).trim(),!r||e[r]&&za[r]||("set-cookie"===r?e[r]?e[r].push(o):e[r]=[o]:e[r]=e[r]?e[r]+", "+o:o)})),e})(t),e);else if(oa.isHeaders(t))for(const[e,o]of t.entries())n(o,e,r);else null!=t&&n(e,t,r);return this}get(t,e){if(t=Ra(t)){const r=oa.findKey(this,t);if(r){const t=this[r];if(!e)return t;if(!0===e)return function(t){const e=Object.create(null),r=/([^\s,;=]+)\s*(?:=\s*([^,;]+))?/g;let o;for(;o=r.exec(t);)e[o[1]]=o[2];return e}(t);if(oa.isFunction(e))return e.call(this,t,r);if(oa.isRegExp(e))return e.exec(t);throw new TypeError("parser must be boolean|regexp|function")}}}has(t,e){if(t=Ra(t)){const r=oa.findKey(this,t);return!(!r||void 0===this[r]||e&&!Da(0,this[r],r,e))}return!1}delete(t,e){const r=this;let o=!1;function n(t){if(t=Ra(t)){const n=oa.findKey(r,t);!n||e&&!Da(0,r[n],n,e)||(delete r[n],o=!0)}}return oa.isArray(t)?t.forEach(n):n(t),o}clear(t){const e=Object.keys(this);let r=e.length,o=!1;for(;r--;){const n=e[r];t&&!Da(0,this[n],n,t,!0)||(delete this[n],o=!0)}return o}normalize(t){const e=this,r={};return oa.forEach(this,((o,n)=>{const i=oa.findKey(r,n);if(i)return e[i]=Pa(o),void delete e[n];const a=t?function(t){return t.trim().toLowerCase().replace(/([a-z\d])(\w*)/g,((t,e,r)=>e.toUpperCase()+r))}(n):String(n).trim();a!==n&&delete e[n],e[a]=Pa(o),r[a]=!0})),this}concat(...t){return this.constructor.concat(this,...t)}toJSON(t){const e=Object.create(null);return oa.forEach(this,((r,o)=>{null!=r&&!1!==r&&(e[o]=t&&oa.isArray(r)?r.join(", "):r)})),e}[Symbol.iterator](){return Object.entries(this.toJSON())[Symbol.iterator]()}toString(){return Object.entries(this.toJSON()).map((([t,e])=>t+": "+e)).join("\n")}get[Symbol.toStringTag](){return"AxiosHeaders"}static from(t){return t instanceof this?t:new this(t)}static concat(t,...e){const r=new this(t);return e.forEach((t=>r.set(t))),r}static accessor(t){const e=(this[La]=this[La]={accessors:{}}).accessors,r=this.prototype;function o(t){const o=Ra(t);e[o]||(function(t,e){const r=oa.toCamelCase(" "+e);["get","set","has"].forEach((o=>{Object.defineProperty(t,o+r,{value:function(t,r,n){return this[o].call(this,e,t,r,n)},configurable:!0})}))}(r,t),e[o]=!0)}return oa.isArray(t)?t.forEach(o):o(t),this}}Ma.accessor(["Content-Type","Content-Length","Accept","Accept-Encoding","User-Agent","Authorization"]),oa.reduceDescriptors(Ma.prototype,(({value:t},e)=>{let r=e[0].toUpperCase()+e.slice(1);return{get:()=>t,set(t){this[r]=t}}})),oa.freezeMethods(Ma);const Na=Ma;function Ia(t,e){const r=this||ja,o=e||r,n=Na.from(o.headers);let i=o.data;return oa.forEach(t,(function(t){i=t.call(r,i,n.normalize(),e?e.status:void 0)})),n.normalize(),i}function Ba(t){return!(!t||!t.__CANCEL__)}function Fa(t,e,r){sa.call(this,null==t?"canceled":t,sa.ERR_CANCELED,e,r),this.name="CanceledError"}oa.inherits(Fa,sa,{__CANCEL__:!0});const $a=Fa;function Ua(t,e,r){const o=r.config.validateStatus;r.status&&o&&!o(r.status)?e(new sa("Request failed with status code "+r.status,[sa.ERR_BAD_REQUEST,sa.ERR_BAD_RESPONSE][Math.floor(r.status/100)-4],r.config,r.request,r)):t(r)}const Va=(t,e,r=3)=>{let o=0;const n=function(t,e){t=t||10;const r=new Array(t),o=new Array(t);let n,i=0,a=0;return e=void 0!==e?e:1e3,function(s){const l=Date.now(),d=o[a];n||(n=l),r[i]=s,o[i]=l;let c=a,p=0;for(;c!==i;)p+=r[c++],c%=t;if(i=(i+1)%t,i===a&&(a=(a+1)%t),l-n<e)return;const b=d&&l-d;return b?Math.round(1e3*p/b):void 0}}(50,250);return function(t,e){let r,o,n=0,i=1e3/e;const a=(e,i=Date.now())=>{n=i,r=null,o&&(clearTimeout(o),o=null),t.apply(null,e)};return[(...t)=>{const e=Date.now(),s=e-n;s>=i?a(t,e):(r=t,o||(o=setTimeout((()=>{o=null,a(r)}),i-s)))},()=>r&&a(r)]}((r=>{const i=r.loaded,a=r.lengthComputable?r.total:void 0,s=i-o,l=n(s);o=i,t({loaded:i,total:a,progress:a?i/a:void 0,bytes:s,rate:l||void 0,estimated:l&&a&&i<=a?(a-i)/l:void 0,event:r,lengthComputable:null!=a,[e?"download":"upload"]:!0})}),r)},Wa=(t,e)=>{const r=null!=t;return[o=>e[0]({lengthComputable:r,total:t,loaded:o}),e[1]]},Ha=t=>(...e)=>oa.asap((()=>t(...e))),qa=Ta.hasStandardBrowserEnv?function(){const t=Ta.navigator&&/(msie|trident)/i.test(Ta.navigator.userAgent),e=document.createElement("a");let r;function o(r){let o=r;return t&&(e.setAttribute("href",o),o=e.href),e.setAttribute("href",o),{href:e.href,protocol:e.protocol?e.protocol.replace(/:$/,""):"",host:e.host,search:e.search?e.search.replace(/^\?/,""):"",hash:e.hash?e.hash.replace(/^#/,""):"",hostname:e.hostname,port:e.port,pathname:"/"===e.pathname.charAt(0)?e.pathname:"/"+e.pathname}}return r=o(window.location.href),function(t){const e=oa.isString(t)?o(t):t;return e.protocol===r.protocol&&e.host===r.host}}():function(){return!0},Ga=Ta.hasStandardBrowserEnv?{write(t,e,r,o,n,i){const a=[t+"="+encodeURIComponent(e)];oa.isNumber(r)&&a.push("expires="+new Date(r).toGMTString()),oa.isString(o)&&a.push("path="+o),oa.isString(n)&&a.push("domain="+n),!0===i&&a.push("secure"),document.cookie=a.join("; ")},read(t){const e=document.cookie.match(new RegExp("(^|;\\s*)("+t+")=([^;]*)"));return e?decodeURIComponent(e[3]):null},remove(t){this.write(t,"",Date.now()-864e5)}}:{write(){},read:()=>null,remove(){}};function Ka(t,e){return t&&!/^([a-z][a-z\d+\-.]*:)?\/\//i.test(e)?function(t,e){return e?t.replace(/\/?\/$/,"")+"/"+e.replace(/^\/+/,""):t}(t,e):e}const Xa=t=>t instanceof Na?{...t}:t;function Ya(t,e){e=e||{};const r={};function o(t,e,r){return oa.isPlainObject(t)&&oa.isPlainObject(e)?oa.merge.call({caseless:r},t,e):oa.isPlainObject(e)?oa.merge({},e):oa.isArray(e)?e.slice():e}function n(t,e,r){return oa.isUndefined(e)?oa.isUndefined(t)?void 0:o(void 0,t,r):o(t,e,r)}function i(t,e){if(!oa.isUndefined(e))return o(void 0,e)}function a(t,e){return oa.isUndefined(e)?oa.isUndefined(t)?void 0:o(void 0,t):o(void 0,e)}function s(r,n,i){return i in e?o(r,n):i in t?o(void 0,r):void 0}const l={url:i,method:i,data:i,baseURL:a,transformRequest:a,transformResponse:a,paramsSerializer:a,timeout:a,timeoutMessage:a,withCredentials:a,withXSRFToken:a,adapter:a,responseType:a,xsrfCookieName:a,xsrfHeaderName:a,onUploadProgress:a,onDownloadProgress:a,decompress:a,maxContentLength:a,maxBodyLength:a,beforeRedirect:a,transport:a,httpAgent:a,httpsAgent:a,cancelToken:a,socketPath:a,responseEncoding:a,validateStatus:s,headers:(t,e)=>n(Xa(t),Xa(e),!0)};return oa.forEach(Object.keys(Object.assign({},t,e)),(function(o){const i=l[o]||n,a=i(t[o],e[o],o);oa.isUndefined(a)&&i!==s||(r[o]=a)})),r}const Ja=t=>{const e=Ya({},t);let r,{data:o,withXSRFToken:n,xsrfHeaderName:i,xsrfCookieName:a,headers:s,auth:l}=e;if(e.headers=s=Na.from(s),e.url=va(Ka(e.baseURL,e.url),t.params,t.paramsSerializer),l&&s.set("Authorization","Basic "+btoa((l.username||"")+":"+(l.password?unescape(encodeURIComponent(l.password)):""))),oa.isFormData(o))if(Ta.hasStandardBrowserEnv||Ta.hasStandardBrowserWebWorkerEnv)s.setContentType(void 0);else if(!1!==(r=s.getContentType())){const[t,...e]=r?r.split(";").map((t=>t.trim())).filter(Boolean):[];s.setContentType([t||"multipart/form-data",...e].join("; "))}if(Ta.hasStandardBrowserEnv&&(n&&oa.isFunction(n)&&(n=n(e)),n||!1!==n&&qa(e.url))){const t=i&&a&&Ga.read(a);t&&s.set(i,t)}return e},Qa="undefined"!=typeof XMLHttpRequest&&function(t){return new Promise((function(e,r){const o=Ja(t);let n=o.data;const i=Na.from(o.headers).normalize();let a,s,l,d,c,{responseType:p,onUploadProgress:b,onDownloadProgress:m}=o;function g(){d&&d(),c&&c(),o.cancelToken&&o.cancelToken.unsubscribe(a),o.signal&&o.signal.removeEventListener("abort",a)}let f=new XMLHttpRequest;function u(){if(!f)return;const o=Na.from("getAllResponseHeaders"in f&&f.getAllResponseHeaders());Ua((function(t){e(t),g()}),(function(t){r(t),g()}),{data:p&&"text"!==p&&"json"!==p?f.response:f.responseText,status:f.status,statusText:f.statusText,headers:o,config:t,request:f}),f=null}f.open(o.method.toUpperCase(),o.url,!0),f.timeout=o.timeout,"onloadend"in f?f.onloadend=u:f.onreadystatechange=function(){f&&4===f.readyState&&(0!==f.status||f.responseURL&&0===f.responseURL.indexOf("file:"))&&setTimeout(u)},f.onabort=function(){f&&(r(new sa("Request aborted",sa.ECONNABORTED,t,f)),f=null)},f.onerror=function(){r(new sa("Network Error",sa.ERR_NETWORK,t,f)),f=null},f.ontimeout=function(){let e=o.timeout?"timeout of "+o.timeout+"ms exceeded":"timeout exceeded";const n=o.transitional||wa;o.timeoutErrorMessage&&(e=o.timeoutErrorMessage),r(new sa(e,n.clarifyTimeoutError?sa.ETIMEDOUT:sa.ECONNABORTED,t,f)),f=null},void 0===n&&i.setContentType(null),"setRequestHeader"in f&&oa.forEach(i.toJSON(),(function(t,e){f.setRequestHeader(e,t)})),oa.isUndefined(o.withCredentials)||(f.withCredentials=!!o.withCredentials),p&&"json"!==p&&(f.responseType=o.responseType),m&&([l,c]=Va(m,!0),f.addEventListener("progress",l)),b&&f.upload&&([s,d]=Va(b),f.upload.addEventListener("progress",s),f.upload.addEventListener("loadend",d)),(o.cancelToken||o.signal)&&(a=e=>{f&&(r(!e||e.type?new $a(null,t,f):e),f.abort(),f=null)},o.cancelToken&&o.cancelToken.subscribe(a),o.signal&&(o.signal.aborted?a():o.signal.addEventListener("abort",a)));const h=function(t){const e=/^([-+\w]{1,25})(:?\/\/|:)/.exec(t);return e&&e[1]||""}(o.url);h&&-1===Ta.protocols.indexOf(h)?r(new sa("Unsupported protocol "+h+":",sa.ERR_BAD_REQUEST,t)):f.send(n||null)}))},Za=(t,e)=>{const{length:r}=t=t?t.filter(Boolean):[];if(e||r){let r,o=new AbortController;const n=function(t){if(!r){r=!0,a();const e=t instanceof Error?t:this.reason;o.abort(e instanceof sa?e:new $a(e instanceof Error?e.message:e))}};let i=e&&setTimeout((()=>{i=null,n(new sa(`timeout ${e} of ms exceeded`,sa.ETIMEDOUT))}),e);const a=()=>{t&&(i&&clearTimeout(i),i=null,t.forEach((t=>{t.unsubscribe?t.unsubscribe(n):t.removeEventListener("abort",n)})),t=null)};t.forEach((t=>t.addEventListener("abort",n)));const{signal:s}=o;return s.unsubscribe=()=>oa.asap(a),s}},ts=function*(t,e){let r=t.byteLength;if(!e||r<e)return void(yield t);let o,n=0;for(;n<r;)o=n+e,yield t.slice(n,o),n=o},es=(t,e,r,o)=>{const n=async function*(t,e){for await(const r of async function*(t){if(t[Symbol.asyncIterator])return void(yield*t);const e=t.getReader();try{for(;;){const{done:t,value:r}=await e.read();if(t)break;yield r}}finally{await e.cancel()}}(t))yield*ts(r,e)}(t,e);let i,a=0,s=t=>{i||(i=!0,o&&o(t))};return new ReadableStream({async pull(t){try{const{done:e,value:o}=await n.next();if(e)return s(),void t.close();let i=o.byteLength;if(r){let t=a+=i;r(t)}t.enqueue(new Uint8Array(o))}catch(t){throw s(t),t}},cancel:t=>(s(t),n.return())},{highWaterMark:2})},rs="function"==typeof fetch&&"function"==typeof Request&&"function"==typeof Response,os=rs&&"function"==typeof ReadableStream,ns=rs&&("function"==typeof TextEncoder?(is=new TextEncoder,t=>is.encode(t)):async t=>new Uint8Array(await new Response(t).arrayBuffer()));var is;const as=(t,...e)=>{try{return!!t(...e)}catch(t){return!1}},ss=os&&as((()=>{let t=!1;const e=new Request(Ta.origin,{body:new ReadableStream,method:"POST",get duplex(){return t=!0,"half"}}).headers.has("Content-Type");return t&&!e})),ls=os&&as((()=>oa.isReadableStream(new Response("").body))),ds={stream:ls&&(t=>t.body)};var cs;rs&&(cs=new Response,["text","arrayBuffer","blob","formData","stream"].forEach((t=>{!ds[t]&&(ds[t]=oa.isFunction(cs[t])?e=>e[t]():(e,r)=>{throw new sa(`Response type '${t}' is not supported`,sa.ERR_NOT_SUPPORT,r)})})));const ps=rs&&(async t=>{let{url:e,method:r,data:o,signal:n,cancelToken:i,timeout:a,onDownloadProgress:s,onUploadProgress:l,responseType:d,headers:c,withCredentials:p="same-origin",fetchOptions:b}=Ja(t);d=d?(d+"").toLowerCase():"text";let m,g=Za([n,i&&i.toAbortSignal()],a);const f=g&&g.unsubscribe&&(()=>{g.unsubscribe()});let u;try{if(l&&ss&&"get"!==r&&"head"!==r&&0!==(u=await(async(t,e)=>{const r=oa.toFiniteNumber(t.getContentLength());return null==r?(async t=>{if(null==t)return 0;if(oa.isBlob(t))return t.size;if(oa.isSpecCompliantForm(t)){const e=new Request(Ta.origin,{method:"POST",body:t});return(await e.arrayBuffer()).byteLength}return oa.isArrayBufferView(t)||oa.isArrayBuffer(t)?t.byteLength:(oa.isURLSearchParams(t)&&(t+=""),oa.isString(t)?(await ns(t)).byteLength:void 0)})(e):r})(c,o))){let t,r=new Request(e,{method:"POST",body:o,duplex:"half"});if(oa.isFormData(o)&&(t=r.headers.get("content-type"))&&c.setContentType(t),r.body){const[t,e]=Wa(u,Va(Ha(l)));o=es(r.body,65536,t,e)}}oa.isString(p)||(p=p?"include":"omit");const n="credentials"in Request.prototype;m=new Request(e,{...b,signal:g,method:r.toUpperCase(),headers:c.normalize().toJSON(),body:o,duplex:"half",credentials:n?p:void 0});let i=await fetch(m);const a=ls&&("stream"===d||"response"===d);if(ls&&(s||a&&f)){const t={};["status","statusText","headers"].forEach((e=>{t[e]=i[e]}));const e=oa.toFiniteNumber(i.headers.get("content-length")),[r,o]=s&&Wa(e,Va(Ha(s),!0))||[];i=new Response(es(i.body,65536,r,(()=>{o&&o(),f&&f()})),t)}d=d||"text";let h=await ds[oa.findKey(ds,d)||"text"](i,t);return!a&&f&&f(),await new Promise(((e,r)=>{Ua(e,r,{data:h,headers:Na.from(i.headers),status:i.status,statusText:i.statusText,config:t,request:m})}))}catch(e){if(f&&f(),e&&"TypeError"===e.name&&/fetch/i.test(e.message))throw Object.assign(new sa("Network Error",sa.ERR_NETWORK,t,m),{cause:e.cause||e});throw sa.from(e,e&&e.code,t,m)}}),bs={http:null,xhr:Qa,fetch:ps};oa.forEach(bs,((t,e)=>{if(t){try{Object.defineProperty(t,"name",{value:e})}catch(t){}Object.defineProperty(t,"adapterName",{value:e})}}));const ms=t=>`- ${t}`,gs=t=>oa.isFunction(t)||null===t||!1===t,fs=t=>{t=oa.isArray(t)?t:[t];const{length:e}=t;let r,o;const n={};for(let i=0;i<e;i++){let e;if(r=t[i],o=r,!gs(r)&&(o=bs[(e=String(r)).toLowerCase()],void 0===o))throw new sa(`Unknown adapter '${e}'`);if(o)break;n[e||"#"+i]=o}if(!o){const t=Object.entries(n).map((([t,e])=>`adapter ${t} `+(!1===e?"is not supported by the environment":"is not available in the build")));let r=e?t.length>1?"since :\n"+t.map(ms).join("\n"):" "+ms(t[0]):"as no adapter specified";throw new sa("There is no suitable adapter to dispatch the request "+r,"ERR_NOT_SUPPORT")}return o};function us(t){if(t.cancelToken&&t.cancelToken.throwIfRequested(),t.signal&&t.signal.aborted)throw new $a(null,t)}function hs(t){return us(t),t.headers=Na.from(t.headers),t.data=Ia.call(t,t.transformRequest),-1!==["post","put","patch"].indexOf(t.method)&&t.headers.setContentType("application/x-www-form-urlencoded",!1),fs(t.adapter||ja.adapter)(t).then((function(e){return us(t),e.data=Ia.call(t,t.transformResponse,e),e.headers=Na.from(e.headers),e}),(function(e){return Ba(e)||(us(t),e&&e.response&&(e.response.data=Ia.call(t,t.transformResponse,e.response),e.response.headers=Na.from(e.response.headers))),Promise.reject(e)}))}const vs={};["object","boolean","number","function","string","symbol"].forEach(((t,e)=>{vs[t]=function(r){return typeof r===t||"a"+(e<1?"n ":" ")+t}}));const xs={};vs.transitional=function(t,e,r){function o(t,e){return"[Axios v1.7.7] Transitional option '"+t+"'"+e+(r?". "+r:"")}return(r,n,i)=>{if(!1===t)throw new sa(o(n," has been removed"+(e?" in "+e:"")),sa.ERR_DEPRECATED);return e&&!xs[n]&&(xs[n]=!0,console.warn(o(n," has been deprecated since v"+e+" and will be removed in the near future"))),!t||t(r,n,i)}};const ws={assertOptions:function(t,e,r){if("object"!=typeof t)throw new sa("options must be an object",sa.ERR_BAD_OPTION_VALUE);const o=Object.keys(t);let n=o.length;for(;n-- >0;){const i=o[n],a=e[i];if(a){const e=t[i],r=void 0===e||a(e,i,t);if(!0!==r)throw new sa("option "+i+" must be "+r,sa.ERR_BAD_OPTION_VALUE)}else if(!0!==r)throw new sa("Unknown option "+i,sa.ERR_BAD_OPTION)}},validators:vs},ys=ws.validators;class _s{constructor(t){this.defaults=t,this.interceptors={request:new xa,response:new xa}}async request(t,e){try{return await this._request(t,e)}catch(t){if(t instanceof Error){let e;Error.captureStackTrace?Error.captureStackTrace(e={}):e=new Error;const r=e.stack?e.stack.replace(/^.+\n/,""):"";try{t.stack?r&&!String(t.stack).endsWith(r.replace(/^.+\n.+\n/,""))&&(t.stack+="\n"+r):t.stack=r}catch(t){}}throw t}}_request(t,e){"string"==typeof t?(e=e||{}).url=t:e=t||{},e=Ya(this.defaults,e);const{transitional:r,paramsSerializer:o,headers:n}=e;void 0!==r&&ws.assertOptions(r,{silentJSONParsing:ys.transitional(ys.boolean),forcedJSONParsing:ys.transitional(ys.boolean),clarifyTimeoutError:ys.transitional(ys.boolean)},!1),null!=o&&(oa.isFunction(o)?e.paramsSerializer={serialize:o}:ws.assertOptions(o,{encode:ys.function,serialize:ys.function},!0)),e.method=(e.method||this.defaults.method||"get").toLowerCase();let i=n&&oa.merge(n.common,n[e.method]);n&&oa.forEach(["delete","get","head","post","put","patch","common"],(t=>{delete n[t]})),e.headers=Na.concat(i,n);const a=[];let s=!0;this.interceptors.request.forEach((function(t){"function"==typeof t.runWhen&&!1===t.runWhen(e)||(s=s&&t.synchronous,a.unshift(t.fulfilled,t.rejected))}));const l=[];let d;this.interceptors.response.forEach((function(t){l.push(t.fulfilled,t.rejected)}));let c,p=0;if(!s){const t=[hs.bind(this),void 0];for(t.unshift.apply(t,a),t.push.apply(t,l),c=t.length,d=Promise.resolve(e);p<c;)d=d.then(t[p++],t[p++]);return d}c=a.length;let b=e;for(p=0;p<c;){const t=a[p++],e=a[p++];try{b=t(b)}catch(t){e.call(this,t);break}}try{d=hs.call(this,b)}catch(t){return Promise.reject(t)}for(p=0,c=l.length;p<c;)d=d.then(l[p++],l[p++]);return d}getUri(t){return va(Ka((t=Ya(this.defaults,t)).baseURL,t.url),t.params,t.paramsSerializer)}}oa.forEach(["delete","get","head","options"],(function(t){_s.prototype[t]=function(e,r){return this.request(Ya(r||{},{method:t,url:e,data:(r||{}).data}))}})),oa.forEach(["post","put","patch"],(function(t){function e(e){return function(r,o,n){return this.request(Ya(n||{},{method:t,headers:e?{"Content-Type":"multipart/form-data"}:{},url:r,data:o}))}}_s.prototype[t]=e(),_s.prototype[t+"Form"]=e(!0)}));const ks=_s;class Es{constructor(t){if("function"!=typeof t)throw new TypeError("executor must be a function.");let e;this.promise=new Promise((function(t){e=t}));const r=this;this.promise.then((t=>{if(!r._listeners)return;let e=r._listeners.length;for(;e-- >0;)r._listeners[e](t);r._listeners=null})),this.promise.then=t=>{let e;const o=new Promise((t=>{r.subscribe(t),e=t})).then(t);return o.cancel=function(){r.unsubscribe(e)},o},t((function(t,o,n){r.reason||(r.reason=new $a(t,o,n),e(r.reason))}))}throwIfRequested(){if(this.reason)throw this.reason}subscribe(t){this.reason?t(this.reason):this._listeners?this._listeners.push(t):this._listeners=[t]}unsubscribe(t){if(!this._listeners)return;const e=this._listeners.indexOf(t);-1!==e&&this._listeners.splice(e,1)}toAbortSignal(){const t=new AbortController,e=e=>{t.abort(e)};return this.subscribe(e),t.signal.unsubscribe=()=>this.unsubscribe(e),t.signal}static source(){let t;return{token:new Es((function(e){t=e})),cancel:t}}}const As=Es,Ss={Continue:100,SwitchingProtocols:101,Processing:102,EarlyHints:103,Ok:200,Created:201,Accepted:202,NonAuthoritativeInformation:203,NoContent:204,ResetContent:205,PartialContent:206,MultiStatus:207,AlreadyReported:208,ImUsed:226,MultipleChoices:300,MovedPermanently:301,Found:302,SeeOther:303,NotModified:304,UseProxy:305,Unused:306,TemporaryRedirect:307,PermanentRedirect:308,BadRequest:400,Unauthorized:401,PaymentRequired:402,Forbidden:403,NotFound:404,MethodNotAllowed:405,NotAcceptable:406,ProxyAuthenticationRequired:407,RequestTimeout:408,Conflict:409,Gone:410,LengthRequired:411,PreconditionFailed:412,PayloadTooLarge:413,UriTooLong:414,UnsupportedMediaType:415,RangeNotSatisfiable:416,ExpectationFailed:417,ImATeapot:418,MisdirectedRequest:421,UnprocessableEntity:422,Locked:423,FailedDependency:424,TooEarly:425,UpgradeRequired:426,PreconditionRequired:428,TooManyRequests:429,RequestHeaderFieldsTooLarge:431,UnavailableForLegalReasons:451,InternalServerError:500,NotImplemented:501,BadGateway:502,ServiceUnavailable:503,GatewayTimeout:504,HttpVersionNotSupported:505,VariantAlsoNegotiates:506,InsufficientStorage:507,LoopDetected:508,NotExtended:510,NetworkAuthenticationRequired:511};Object.entries(Ss).forEach((([t,e])=>{Ss[e]=t}));const Ts=Ss,Os=function t(e){const r=new ks(e),o=mi(ks.prototype.request,r);return oa.extend(o,ks.prototype,r,{allOwnKeys:!0}),oa.extend(o,r,null,{allOwnKeys:!0}),o.create=function(r){return t(Ya(e,r))},o}(ja);Os.Axios=ks,Os.CanceledError=$a,Os.CancelToken=As,Os.isCancel=Ba,Os.VERSION="1.7.7",Os.toFormData=ba,Os.AxiosError=sa,Os.Cancel=Os.CanceledError,Os.all=function(t){return Promise.all(t)},Os.spread=function(t){return function(e){return t.apply(null,e)}},Os.isAxiosError=function(t){return oa.isObject(t)&&!0===t.isAxiosError},Os.mergeConfig=Ya,Os.AxiosHeaders=Na,Os.formToJSON=t=>Oa(oa.isHTMLForm(t)?new FormData(t):t),Os.getAdapter=fs,Os.HttpStatusCode=Ts,Os.default=Os;const Cs=Os,js={class:"d-grid gap-2 d-md-block mb-4"},zs={class:"position-fixed top-0 end-0 p-3",style:{"z-index":"11"}},Ls={class:"toast-body"},Rs={props:{show:{type:Boolean,required:!0},message:{type:String,required:!0},bgClass:{type:String,default:"text-bg-primary"}},methods:{closeToast(){this.$emit("close")}}};var Ps=r(262);const Ds=(0,Ps.A)(Rs,[["render",function(t,e,r,o,n,i){return Fo(),Wo("div",zs,[r.show?(Fo(),Wo("div",{key:0,class:q(["toast fade show",r.bgClass]),role:"alert","aria-live":"assertive","aria-atomic":"true"},[Xo("div",Ls,Q(r.message),1)],2)):Zo("v-if",!0)])}]]),Ms={components:{Notification:Ds},props:{status:{type:Object,required:!0}},data:()=>({showToast:!1,toastMessage:"",bgClass:""}),methods:{async sendAction(t){try{if(200!==(await Cs.post(t)).status)throw new Error("Non-OK response");this.toastMessage=`Action sent to ${t} successfully!`,this.bgClass="text-bg-success",setTimeout((()=>{this.$emit("button-pressed")}),500)}catch(e){this.toastMessage=`Error sending action to ${t}.`,this.bgClass="text-bg-danger"}finally{this.showToast=!0,setTimeout((()=>{this.showToast=!1}),8e3)}}}};r(648);const Ns=(0,Ps.A)(Ms,[["render",function(t,e,r,o,n,i){const a=Sr("Notification");return Fo(),Wo("div",null,[Xo("div",js,[Xo("button",{class:"btn btn-primary mx-1",onClick:e[0]||(e[0]=t=>i.sendAction("/start"))},"Start"),Xo("button",{class:"btn btn-secondary mx-1",onClick:e[1]||(e[1]=t=>i.sendAction("/home"))},"Home"),Xo("button",{class:"btn btn-danger mx-1",onClick:e[2]||(e[2]=t=>i.sendAction("/stop"))},"Stop"),r.status.isIdle?Zo("v-if",!0):(Fo(),Wo(Po,{key:0},[r.status.isLocked?(Fo(),Wo("button",{key:0,class:"btn btn-info mx-1",onClick:e[3]||(e[3]=t=>i.sendAction("/unlock"))},"Unlock")):(Fo(),Wo("button",{key:1,class:"btn btn-warning mx-1",onClick:e[4]||(e[4]=t=>i.sendAction("/lock"))},"Lock"))],64))]),Zo(" Toast Notification "),Yo(a,{show:n.showToast,message:n.toastMessage,bgClass:n.bgClass,onClose:e[5]||(e[5]=t=>n.showToast=!1)},null,8,["show","message","bgClass"])])}],["__scopeId","data-v-aece0ea4"]]),Is={class:"status mb-4"},Bs={key:0,class:"badge rounded-pill text-bg-primary mx-1"},Fs={key:1,class:"badge rounded-pill text-bg-dark mx-1"},$s={key:2,class:"badge rounded-pill text-bg-danger mx-1"},Us={key:3,class:"badge rounded-pill text-bg-warning mx-1"},Vs={key:1,class:"badge rounded-pill text-bg-info mx-1"},Ws={props:{status:{type:Object,required:!0}}};r(254);const Hs=(0,Ps.A)(Ws,[["render",function(t,e,r,o,n,i){return Fo(),Wo("div",Is,[r.status.isIdle?(Fo(),Wo("span",Vs,"Idle")):(Fo(),Wo(Po,{key:0},[r.status.isCharging?(Fo(),Wo("span",Bs,"In docking station")):(Fo(),Wo("span",Fs,"Outside docking station")),r.status.isEmergency?(Fo(),Wo("span",$s,"Emergency")):Zo("v-if",!0),r.status.isLocked?(Fo(),Wo("span",Us,"Locked")):Zo("v-if",!0)],64))])}],["__scopeId","data-v-3175ef1e"]]),qs={class:"accordion mb-3"},Gs={class:"accordion-item"},Ks={id:"accordion-content-mowing-plan",class:"accordion-collapse collapse"},Xs={class:"accordion-body"},Ys={class:"form-check form-switch mb-3",style:{display:"inline-block"}},Js={key:0,class:"custom-mowing-plan"},Qs={class:"custom-mowing-plan-days mb-3"},Zs=["id","onUpdate:modelValue"],tl=["for"],el={class:"custom-mowing-plan-time"},rl={class:"row justify-content-center"},ol={class:"col-6 col-xl-4"},nl={class:"form-floating mb-3"},il={class:"col-6 col-xl-4"},al={class:"form-floating mb-3"},sl={class:"mb-3",style:{"font-size":"0.7em"}},ll={key:0,class:"text-danger"},dl={key:1,class:"text-muted"},cl={key:1,class:"text-end"},pl={props:{currentDate:String,currentTime:String,currentMowingPlanStatusActive:Boolean},components:{Notification:Ds},data:()=>({isMowingPlanActive:!1,selectedDays:[!1,!1,!1,!1,!1,!1,!1],days:["Mon","Tue","Wed","Thu","Fri","Sat","Sun"],planTimeStart:"",planTimeEnd:"",showToast:!1,toastMessage:"",bgClass:""}),methods:{toggleMowingPlan(){this.isMowingPlanActive},async saveMowingPlan(){const t={customMowingPlanActive:this.isMowingPlanActive,days:this.selectedDays,planTimeStart:this.planTimeStart,planTimeEnd:this.planTimeEnd};try{await Cs.post("/mowing-plan",t,{headers:{"Content-Type":"application/json"}}),this.toastMessage="Mowing plan saved successfully!",this.bgClass="text-bg-success",this.showToast=!0,this.$emit("plan-saved"),setTimeout((()=>{this.showToast=!1}),8e3)}catch(t){this.toastMessage="Error saving mowing plan!",this.bgClass="text-bg-error",this.showToast=!0,setTimeout((()=>{this.showToast=!1}),8e3)}},async fetchMowingPlan(){try{const t=await Cs.get("/mowing-plan");if(!t.data)return void console.log("No mowing plan found");const{customMowingPlanActive:e,days:r,startTime:o,endTime:n}=t.data;this.isMowingPlanActive=e,this.selectedDays=r,this.planTimeStart=o,this.planTimeEnd=n,console.log("Fetched Mowing Plan:",t.data)}catch(t){this.toastMessage="Error fetching mowing plan",this.bgClass="text-bg-error",this.showToast=!0,setTimeout((()=>{this.showToast=!1}),8e3)}},showNotification(t,e){this.notification={message:t,type:e},setTimeout((()=>{this.notification=null}),3e3)}},mounted(){this.fetchMowingPlan()}},bl=(0,Ps.A)(pl,[["render",function(t,e,r,o,n,i){const a=Sr("Notification");return Fo(),Wo("div",qs,[Xo("div",Gs,[e[12]||(e[12]=Xo("h2",{class:"accordion-header"},[Xo("button",{class:"accordion-button collapsed",type:"button","data-bs-toggle":"collapse","aria-expanded":"false","aria-controls":"accordion-content-mowing-plan","data-bs-target":"#accordion-content-mowing-plan"}," Mowing Plan ")],-1)),Xo("div",Ks,[Xo("div",Xs,[Xo("form",{onSubmit:e[5]||(e[5]=oi(((...t)=>i.saveMowingPlan&&i.saveMowingPlan(...t)),["prevent"])),autocomplete:"off"},[e[11]||(e[11]=Xo("p",{class:"text-muted",style:{"font-size":"0.7em"}},[Qo(" For manual starts only, activate the following field, without selecting days below."),Xo("br"),Qo(" If deactivated, the mower will mow according to it's original schedule. ")],-1)),Xo("div",Ys,[er(Xo("input",{class:"form-check-input",type:"checkbox",role:"switch",id:"custom-mowing-plan-active","onUpdate:modelValue":e[0]||(e[0]=t=>n.isMowingPlanActive=t),onChange:e[1]||(e[1]=(...t)=>i.toggleMowingPlan&&i.toggleMowingPlan(...t)),value:"1"},null,544),[[Qn,n.isMowingPlanActive]]),e[7]||(e[7]=Xo("label",{class:"form-check-label",for:"custom-mowing-plan-active"}," Activate custom mowing plan ",-1))]),n.isMowingPlanActive?(Fo(),Wo("div",Js,[Xo("div",Qs,[(Fo(!0),Wo(Po,null,Cr(n.days,((t,e)=>(Fo(),Wo(Po,{key:e},[er(Xo("input",{type:"checkbox",class:"btn-check",id:"btn-check-day-"+t.toLowerCase(),"onUpdate:modelValue":t=>n.selectedDays[e]=t,autocomplete:"off",value:1},null,8,Zs),[[Qn,n.selectedDays[e]]]),Xo("label",{class:"btn btn-sm mx-1",for:"btn-check-day-"+t.toLowerCase()},Q(t),9,tl)],64)))),128))]),Xo("div",el,[Xo("div",rl,[Xo("div",ol,[Xo("div",nl,[er(Xo("input",{type:"time",class:"form-control form-control-sm",id:"custom-mowing-plan-time-start","onUpdate:modelValue":e[2]||(e[2]=t=>n.planTimeStart=t)},null,512),[[Jn,n.planTimeStart]]),e[8]||(e[8]=Xo("label",{for:"custom-mowing-plan-time-start"},"Start",-1))])]),Xo("div",il,[Xo("div",al,[er(Xo("input",{type:"time",class:"form-control form-control-sm",id:"custom-mowing-plan-time-end","onUpdate:modelValue":e[3]||(e[3]=t=>n.planTimeEnd=t)},null,512),[[Jn,n.planTimeEnd]]),e[9]||(e[9]=Xo("label",{for:"custom-mowing-plan-time-end"},"End",-1))])])]),Xo("div",sl,[Zo(" show little warning, if {{ currentDate }} {{ currentTime }} are unset, otherwise show date/time "),r.currentDate&&r.currentTime?(Fo(),Wo("span",dl,"Date: "+Q(r.currentDate)+", Time: "+Q(r.currentTime),1)):(Fo(),Wo("span",ll,"Date and time are not set on the mower currently. Mowing Plan will not be active."))])]),e[10]||(e[10]=Xo("div",{class:"text-end"},[Xo("button",{type:"submit",class:"btn btn-outline-primary btn-sm"},"Save Mowing Plan")],-1))])):Zo("v-if",!0),!n.isMowingPlanActive&&r.currentMowingPlanStatusActive?(Fo(),Wo("div",cl,[Xo("button",{type:"button",class:"btn btn-outline-warning btn-sm",onClick:e[4]||(e[4]=(...t)=>i.saveMowingPlan&&i.saveMowingPlan(...t))}," Deactivate Mowing Plan on Mower ")])):Zo("v-if",!0)],32),Yo(a,{show:n.showToast,message:n.toastMessage,bgClass:n.bgClass,onClose:e[6]||(e[6]=t=>n.showToast=!1)},null,8,["show","message","bgClass"])])])])])}]]),ml={class:"accordion mb-3"},gl={class:"accordion-item"},fl={class:"accordion-header"},ul={id:"accordion-content-wifi-setup",class:"accordion-collapse collapse"},hl={class:"accordion-body"},vl={class:"text-muted",style:{"font-size":"0.7em"}},xl={key:0},wl={class:"text-danger",style:{"font-size":"0.7em"}},yl=["href"],_l={class:"row"},kl={class:"col-xl-6"},El={class:"form-floating mb-3"},Al={id:"wifiOptions"},Sl=["value"],Tl={class:"col-xl-6"},Ol={class:"form-floating mb-3"},Cl={class:"d-flex justify-content-between align-items-center"},jl=["disabled"],zl={key:0,class:"spinner-border spinner-border-sm","aria-hidden":"true"},Ll={components:{Notification:Ds},props:{currentSSID:String,currentIP:String,hostname:String,isAccessPoint:Boolean},data:()=>({ssid:"",password:"",wifiOptions:[],showToast:!1,toastMessage:"",bgClass:"",isLoading:!1}),methods:{async setWifi(){try{await Cs.post("/wifi",{ssid:this.ssid,password:this.password}),this.toastMessage="Wifi settings saved successfully!",this.bgClass="text-bg-success",this.showToast=!0,setTimeout((()=>{this.showToast=!1}),8e3)}catch(t){this.toastMessage="Error saving Wifi settings. Please try again.",this.bgClass="bg-danger",this.showToast=!0,setTimeout((()=>{this.showToast=!1}),8e3)}},async searchWifis(){this.isLoading=!0;try{const t=await Cs.get("/wifis");this.wifiOptions=t.data.filter(((t,e,r)=>r.indexOf(t)===e))}catch(t){this.toastMessage="Error fetching Wifi networks.",this.bgClass="bg-danger",this.showToast=!0,setTimeout((()=>{this.showToast=!1}),8e3)}finally{this.isLoading=!1}}}},Rl=(0,Ps.A)(Ll,[["render",function(t,e,r,o,n,i){const a=Sr("Notification");return Fo(),Wo("div",ml,[Xo("div",gl,[Xo("h2",fl,[Xo("button",{class:"accordion-button collapsed",type:"button","data-bs-toggle":"collapse","aria-expanded":"false","aria-controls":"accordion-content-wifi-setup","data-bs-target":"#accordion-content-wifi-setup",onClick:e[0]||(e[0]=(...t)=>i.searchWifis&&i.searchWifis(...t))}," Wifi-Setup ")]),Xo("div",ul,[Xo("div",hl,[Xo("p",vl,[e[6]||(e[6]=Qo("If no Wifi entered, or connection can't be established, an Access Point will be created.")),e[7]||(e[7]=Xo("br",null,null,-1)),e[8]||(e[8]=Qo(" Current wifi: ")),Xo("i",null,Q(r.currentSSID),1),e[9]||(e[9]=Qo(" with IP ")),Xo("i",null,Q(r.currentIP),1),e[10]||(e[10]=Qo(" and hostname ")),Xo("i",null,Q(r.hostname),1),e[11]||(e[11]=Xo("br",null,null,-1)),Zo(" if isAccessPoint: show info that it is access point mode "),r.isAccessPoint?(Fo(),Wo("span",xl,"(📡 Access Point Mode)")):Zo("v-if",!0)]),Xo("p",wl,[e[12]||(e[12]=Qo("After saving a Wifi-Connection, the mower interface will reboot and try to connect to the new Wifi. In the new Wifi it might be available ")),Xo("a",{target:"_blank",href:"http://"+r.hostname+".local"},"here",8,yl),e[13]||(e[13]=Qo(". If not, you might need to find out the ip address manually!"))]),Xo("form",{onSubmit:e[4]||(e[4]=oi(((...t)=>i.setWifi&&i.setWifi(...t)),["prevent"]))},[Xo("div",_l,[Xo("div",kl,[Xo("div",El,[er(Xo("input",{autocomplete:"off",class:"form-control",list:"wifiOptions",id:"ssid","onUpdate:modelValue":e[1]||(e[1]=t=>n.ssid=t),placeholder:"Wifi SSID"},null,512),[[Jn,n.ssid]]),e[14]||(e[14]=Xo("label",{for:"ssid"},"Connect to Wifi SSID..",-1)),Xo("datalist",Al,[(Fo(!0),Wo(Po,null,Cr(n.wifiOptions,(t=>(Fo(),Wo("option",{key:t,value:t},Q(t),9,Sl)))),128))])])]),Xo("div",Tl,[Xo("div",Ol,[er(Xo("input",{autocomplete:"off",type:"password",class:"form-control",id:"password","onUpdate:modelValue":e[2]||(e[2]=t=>n.password=t),placeholder:"Wifi password"},null,512),[[Jn,n.password]]),e[15]||(e[15]=Xo("label",{for:"password"},"Wifi password",-1))])])]),Zo(" Search Button & Spinner "),Xo("div",Cl,[Xo("div",null,[Xo("button",{type:"button",class:"btn btn-outline-secondary btn-sm",onClick:e[3]||(e[3]=(...t)=>i.searchWifis&&i.searchWifis(...t)),disabled:n.isLoading},[n.isLoading?(Fo(),Wo("span",zl)):Zo("v-if",!0),e[16]||(e[16]=Qo(" Search for Wireless LANs "))],8,jl)]),e[17]||(e[17]=Xo("button",{type:"submit",class:"btn btn-outline-primary btn-sm"},"Save Wifi",-1))])],32),Yo(a,{show:n.showToast,message:n.toastMessage,bgClass:n.bgClass,onClose:e[5]||(e[5]=t=>n.showToast=!1)},null,8,["show","message","bgClass"])])])])])}]]),Pl={class:"accordion mb-3"},Dl={class:"accordion-item"},Ml={id:"accordion-content-time-setup",class:"accordion-collapse collapse"},Nl={class:"accordion-body"},Il={class:"row justify-content-center"},Bl={class:"col-6 col-xl-4"},Fl={class:"form-floating mb-3"},$l={class:"col-6 col-xl-4"},Ul={class:"form-floating mb-3"},Vl={components:{Notification:Ds},data:()=>({date:"",time:"",timer:null,showToast:!1,toastMessage:"",bgClass:"text-bg-primary"}),mounted(){this.setCurrentDateTime(),this.startTimer()},beforeDestroy(){clearInterval(this.timer)},methods:{setCurrentDateTime(){const t=new Date;this.date=t.toISOString().split("T")[0],this.time=t.toTimeString().split(":").slice(0,2).join(":")},startTimer(){this.timer=setInterval((()=>{this.setCurrentDateTime()}),6e4)},saveTime(){Cs.post("/date-time",{date:this.date,time:this.time}).then((t=>{this.toastMessage="Time saved successfully!",this.showToast=!0,this.bgClass="text-bg-success",setTimeout((()=>{this.showToast=!1}),8e3),this.$emit("time-saved")})).catch((t=>{this.toastMessage="Error saving time. Please try again.",this.showToast=!0,this.bgClass="text-bg-danger",setTimeout((()=>{this.showToast=!1}),8e3),console.error("Error saving time:",t)}))}}},Wl=(0,Ps.A)(Vl,[["render",function(t,e,r,o,n,i){const a=Sr("Notification");return Fo(),Wo("div",Pl,[Xo("div",Dl,[e[8]||(e[8]=Xo("h2",{class:"accordion-header"},[Xo("button",{class:"accordion-button collapsed",type:"button","data-bs-toggle":"collapse","aria-expanded":"false","aria-controls":"accordion-content-time-setup","data-bs-target":"#accordion-content-time-setup"}," Time & Date-Setup ")],-1)),Xo("div",Ml,[Xo("div",Nl,[e[7]||(e[7]=Xo("p",{class:"text-muted",style:{"font-size":"0.7em"}}," With internet connection, UTC is set automatically. Here you can adjust to your timezone or set Date & Time in Access Point Mode. After Mower complete shutdown, time will be reset. ",-1)),Xo("form",{onSubmit:e[2]||(e[2]=oi(((...t)=>i.saveTime&&i.saveTime(...t)),["prevent"]))},[Xo("div",Il,[Xo("div",Bl,[Xo("div",Fl,[er(Xo("input",{type:"date","onUpdate:modelValue":e[0]||(e[0]=t=>n.date=t),class:"form-control"},null,512),[[Jn,n.date]]),e[4]||(e[4]=Xo("label",{for:"date",class:"form-label"},"Set current date",-1))])]),Xo("div",$l,[Xo("div",Ul,[er(Xo("input",{type:"time","onUpdate:modelValue":e[1]||(e[1]=t=>n.time=t),class:"form-control"},null,512),[[Jn,n.time]]),e[5]||(e[5]=Xo("label",{for:"time",class:"form-label"},"Set current time",-1))])])]),e[6]||(e[6]=Xo("div",{class:"text-end"},[Xo("button",{type:"submit",class:"btn btn-sm btn-outline-primary"},"Save date and time")],-1))],32),Zo(" Toast Notification "),Yo(a,{show:n.showToast,message:n.toastMessage,bgClass:n.bgClass,onClose:e[3]||(e[3]=t=>n.showToast=!1)},null,8,["show","message","bgClass"])])])])])}]]),Hl={class:"accordion mb-3"},ql={class:"accordion-item"},Gl={id:"accordion-content-logs",class:"accordion-collapse collapse"},Kl={class:"accordion-body"},Xl={data:()=>({logMessages:"",autoRefresh:!0,refreshLogsTimer:null}),methods:{refreshLogMessages(){Cs.get("/log-messages").then((t=>{this.logMessages=t.data,this.$nextTick((()=>{const t=this.$el.querySelector("textarea");t.scrollTop=t.scrollHeight}))})).catch((t=>{console.error("Error fetching log messages:",t)}))},startAutoRefresh(){console.log("Starting refresh..."),this.autoRefresh&&(this.refreshLogMessages(),this.refreshLogsTimer=setInterval(this.refreshLogMessages,15e3))},stopAutoRefresh(){console.log("Stopping refresh..."),clearInterval(this.refreshLogsTimer)}},mounted(){const t=document.getElementById("accordion-content-logs");t&&(t.addEventListener("shown.bs.collapse",this.startAutoRefresh),t.addEventListener("hidden.bs.collapse",this.stopAutoRefresh)),t&&t.classList.contains("show")&&this.startAutoRefresh()},beforeDestroy(){const t=document.getElementById("accordion-content-logs");t&&(t.removeEventListener("shown.bs.collapse",this.startAutoRefresh),t.removeEventListener("hidden.bs.collapse",this.stopAutoRefresh)),this.stopAutoRefresh()}},Yl=(0,Ps.A)(Xl,[["render",function(t,e,r,o,n,i){return Fo(),Wo("div",Hl,[Xo("div",ql,[e[2]||(e[2]=Xo("h2",{class:"accordion-header"},[Xo("button",{class:"accordion-button collapsed",type:"button","data-bs-toggle":"collapse","aria-expanded":"false","aria-controls":"accordion-content-logs","data-bs-target":"#accordion-content-logs"}," Logs & Debugging ")],-1)),Xo("div",Gl,[Xo("div",Kl,[Xo("form",{onSubmit:e[1]||(e[1]=oi((()=>{}),["prevent"]))},[er(Xo("textarea",{"onUpdate:modelValue":e[0]||(e[0]=t=>n.logMessages=t),class:"w-100",rows:"14",readonly:"",style:{"white-space":"pre",overflow:"auto","font-size":"0.75em","font-family":"Courier New, monospace"},wrap:"off"},null,512),[[Jn,n.logMessages]])],32)])])])])}]]),Jl={class:"accordion mb-3"},Ql={class:"accordion-item"},Zl={id:"accordion-content-update",class:"accordion-collapse collapse"},td={class:"accordion-body"},ed={class:"mb-3 text-start"},rd={class:"mb-3 text-start"},od={class:"text-end"},nd=["disabled"],id={key:0,class:"spinner-border spinner-border-sm","aria-hidden":"true"},ad={key:0,class:"alert alert-info mt-3",role:"alert"},sd={data:()=>({firmwareFile:null,filesystemFile:null,uploadStatus:"",isLoading:!1}),methods:{onFirmwareFileChange(t){this.firmwareFile=t.target.files[0]},onFilesystemFileChange(t){this.filesystemFile=t.target.files[0]},async uploadFiles(){if(!this.firmwareFile&&!this.filesystemFile)return void(this.uploadStatus="Please choose at least one file.");const t=new FormData;this.firmwareFile&&t.append("firmware",this.firmwareFile,"firmware.bin"),this.filesystemFile&&t.append("filesystem",this.filesystemFile,"filesystem.bin"),this.isLoading=!0;try{const e=await Cs.post("/update",t,{headers:{"Content-Type":"multipart/form-data"}});this.uploadStatus=200===e.status?"Upload successful! Rebooting...":"Upload failed."}catch(t){this.uploadStatus="Error on update.",console.error("Upload-error:",t)}finally{this.isLoading=!1,this.firmwareFile=null,this.filesystemFile=null,document.getElementById("firmwareUpload").value="",document.getElementById("filesystemUpload").value=""}}},mounted(){},beforeDestroy(){}},ld={name:"App",components:{MowerActions:Ns,MowerStatus:Hs,MowingPlan:bl,WifiSetup:Rl,SetDateAndTime:Wl,LogMessages:Yl,UpdateSystem:(0,Ps.A)(sd,[["render",function(t,e,r,o,n,i){return Fo(),Wo("div",Jl,[Xo("div",Ql,[e[7]||(e[7]=Xo("h2",{class:"accordion-header"},[Xo("button",{class:"accordion-button collapsed",type:"button","data-bs-toggle":"collapse","aria-expanded":"false","aria-controls":"accordion-content-update","data-bs-target":"#accordion-content-update"}," Update System ")],-1)),Xo("div",Zl,[Xo("div",td,[Xo("form",{onSubmit:e[2]||(e[2]=oi(((...t)=>i.uploadFiles&&i.uploadFiles(...t)),["prevent"]))},[e[6]||(e[6]=Xo("p",{class:"text-muted",style:{"font-size":"0.7em"}}," You can either upload a firmware.bin update, a filesystem.bin update, or both. The system will automatically restart after the update. ",-1)),Xo("div",ed,[e[3]||(e[3]=Xo("label",{for:"firmwareUpload",class:"form-label"},[Xo("b",null,"Firmware Update")],-1)),Xo("input",{type:"file",class:"form-control",id:"firmwareUpload",onChange:e[0]||(e[0]=(...t)=>i.onFirmwareFileChange&&i.onFirmwareFileChange(...t))},null,32)]),Xo("div",rd,[e[4]||(e[4]=Xo("label",{for:"filesystemUpload",class:"form-label"},[Xo("b",null,"Filesystem Update")],-1)),Xo("input",{type:"file",class:"form-control",id:"filesystemUpload",onChange:e[1]||(e[1]=(...t)=>i.onFilesystemFileChange&&i.onFilesystemFileChange(...t))},null,32)]),Xo("div",od,[Xo("button",{type:"submit",class:"btn btn-outline-primary btn-sm",disabled:n.isLoading},[n.isLoading?(Fo(),Wo("span",id)):Zo("v-if",!0),e[5]||(e[5]=Qo(" Upload and update "))],8,nd)])],32),n.uploadStatus?(Fo(),Wo("div",ad,Q(n.uploadStatus),1)):Zo("v-if",!0)])])])])}]])},data:()=>({status:{date:"",time:"",isCharging:!1,isLocked:!1,isEmergency:!1,isIdle:!1,isAccessPoint:!1,ssid:"",ip:"",hostname:"",mowingPlanActive:!1},statusLoaded:!1,version:""}),methods:{enableBody(){document.body.classList.add("mounted")},scrollTo(t){document.querySelector(t).scrollIntoView({behavior:"smooth"})},async fetchStatus(){try{const t=await Cs.get("/status");this.status=t.data,this.statusLoaded=!0,console.log("Status fetched:",this.status)}catch(t){console.error("Error fetching status:",t)}},async fetchVersion(){console.log("Loading version...");try{const t=await Cs.get("/version.json");this.version=t.data.version,document.getElementById("version").textContent="v"+this.version}catch(t){console.error("Error fetching version:",t)}}},mounted(){this.enableBody(),this.fetchStatus(),this.fetchVersion(),setInterval(this.fetchStatus,15e3)}};r(230);const dd=(0,Ps.A)(ld,[["render",function(t,e,r,o,n,i){const a=Sr("MowerActions"),s=Sr("MowerStatus"),l=Sr("MowingPlan"),d=Sr("WifiSetup"),c=Sr("SetDateAndTime"),p=Sr("LogMessages"),b=Sr("UpdateSystem");return Fo(),Wo("div",ai,[Xo("div",si,[Xo("div",li,[Xo("div",di,[e[6]||(e[6]=Xo("h1",{class:"my-4"},"Robot Mower 🤖🚜",-1)),n.statusLoaded?(Fo(),Wo("div",ci,[Yo(a,{onButtonPressed:i.fetchStatus,status:n.status},null,8,["onButtonPressed","status"]),Yo(s,{status:n.status},null,8,["status"]),n.status.date&&n.status.time?Zo("v-if",!0):(Fo(),Wo("div",pi,[e[1]||(e[1]=Qo(" Date and time are not set on the mower currently. Set it ")),Xo("a",{href:"#accordion-content-time-setup","data-bs-toggle":"collapse",onClick:e[0]||(e[0]=t=>i.scrollTo("#accordion-content-time-setup"))},"here"),e[2]||(e[2]=Qo(".")),e[3]||(e[3]=Xo("br",null,null,-1)),e[4]||(e[4]=Qo(" In Access Point mode, it will get reset on mower shutdown. In Wifi mode with internet connection, it will be set automatically. "))])),Yo(l,{onPlanSaved:i.fetchStatus,currentDate:n.status.date,currentTime:n.status.time,currentMowingPlanStatusActive:n.status.mowingPlanActive},null,8,["onPlanSaved","currentDate","currentTime","currentMowingPlanStatusActive"]),Yo(d,{currentSSID:n.status.ssid,currentIP:n.status.ip,isAccessPoint:n.status.isAccessPoint,hostname:n.status.hostname},null,8,["currentSSID","currentIP","isAccessPoint","hostname"]),Yo(c,{onTimeSaved:i.fetchStatus},null,8,["onTimeSaved"]),Yo(p),Yo(b)])):(Fo(),Wo("div",bi,e[5]||(e[5]=[Xo("p",null,"Loading status, please wait...",-1),Xo("div",{class:"spinner-border",role:"status"},[Xo("span",{class:"visually-hidden"},"Loading...")],-1)])))])])])])}],["__scopeId","data-v-47c9ecaa"]]);r(902);var cd="top",pd="bottom",bd="right",md="left",gd="auto",fd=[cd,pd,bd,md],ud="start",hd="end",vd="clippingParents",xd="viewport",wd="popper",yd="reference",_d=fd.reduce((function(t,e){return t.concat([e+"-"+ud,e+"-"+hd])}),[]),kd=[].concat(fd,[gd]).reduce((function(t,e){return t.concat([e,e+"-"+ud,e+"-"+hd])}),[]),Ed="beforeRead",Ad="read",Sd="afterRead",Td="beforeMain",Od="main",Cd="afterMain",jd="beforeWrite",zd="write",Ld="afterWrite",Rd=[Ed,Ad,Sd,Td,Od,Cd,jd,zd,Ld];function Pd(t){return t?(t.nodeName||"").toLowerCase():null}function Dd(t){if(null==t)return window;if("[object Window]"!==t.toString()){var e=t.ownerDocument;return e&&e.defaultView||window}return t}function Md(t){return t instanceof Dd(t).Element||t instanceof Element}function Nd(t){return t instanceof Dd(t).HTMLElement||t instanceof HTMLElement}function Id(t){return"undefined"!=typeof ShadowRoot&&(t instanceof Dd(t).ShadowRoot||t instanceof ShadowRoot)}const Bd={name:"applyStyles",enabled:!0,phase:"write",fn:function(t){var e=t.state;Object.keys(e.elements).forEach((function(t){var r=e.styles[t]||{},o=e.attributes[t]||{},n=e.elements[t];Nd(n)&&Pd(n)&&(Object.assign(n.style,r),Object.keys(o).forEach((function(t){var e=o[t];!1===e?n.removeAttribute(t):n.setAttribute(t,!0===e?"":e)})))}))},effect:function(t){var e=t.state,r={popper:{position:e.options.strategy,left:"0",top:"0",margin:"0"},arrow:{position:"absolute"},reference:{}};return Object.assign(e.elements.popper.style,r.popper),e.styles=r,e.elements.arrow&&Object.assign(e.elements.arrow.style,r.arrow),function(){Object.keys(e.elements).forEach((function(t){var o=e.elements[t],n=e.attributes[t]||{},i=Object.keys(e.styles.hasOwnProperty(t)?e.styles[t]:r[t]).reduce((function(t,e){return t[e]="",t}),{});Nd(o)&&Pd(o)&&(Object.assign(o.style,i),Object.keys(n).forEach((function(t){o.removeAttribute(t)})))}))}},requires:["computeStyles"]};function Fd(t){return t.split("-")[0]}var $d=Math.max,Ud=Math.min,Vd=Math.round;function Wd(){var t=navigator.userAgentData;return null!=t&&t.brands&&Array.isArray(t.brands)?t.brands.map((function(t){return t.brand+"/"+t.version})).join(" "):navigator.userAgent}function Hd(){return!/^((?!chrome|android).)*safari/i.test(Wd())}function qd(t,e,r){void 0===e&&(e=!1),void 0===r&&(r=!1);var o=t.getBoundingClientRect(),n=1,i=1;e&&Nd(t)&&(n=t.offsetWidth>0&&Vd(o.width)/t.offsetWidth||1,i=t.offsetHeight>0&&Vd(o.height)/t.offsetHeight||1);var a=(Md(t)?Dd(t):window).visualViewport,s=!Hd()&&r,l=(o.left+(s&&a?a.offsetLeft:0))/n,d=(o.top+(s&&a?a.offsetTop:0))/i,c=o.width/n,p=o.height/i;return{width:c,height:p,top:d,right:l+c,bottom:d+p,left:l,x:l,y:d}}function Gd(t){var e=qd(t),r=t.offsetWidth,o=t.offsetHeight;return Math.abs(e.width-r)<=1&&(r=e.width),Math.abs(e.height-o)<=1&&(o=e.height),{x:t.offsetLeft,y:t.offsetTop,width:r,height:o}}function Kd(t,e){var r=e.getRootNode&&e.getRootNode();if(t.contains(e))return!0;if(r&&Id(r)){var o=e;do{if(o&&t.isSameNode(o))return!0;o=o.parentNode||o.host}while(o)}return!1}function Xd(t){return Dd(t).getComputedStyle(t)}function Yd(t){return["table","td","th"].indexOf(Pd(t))>=0}function Jd(t){return((Md(t)?t.ownerDocument:t.document)||window.document).documentElement}function Qd(t){return"html"===Pd(t)?t:t.assignedSlot||t.parentNode||(Id(t)?t.host:null)||Jd(t)}function Zd(t){return Nd(t)&&"fixed"!==Xd(t).position?t.offsetParent:null}function tc(t){for(var e=Dd(t),r=Zd(t);r&&Yd(r)&&"static"===Xd(r).position;)r=Zd(r);return r&&("html"===Pd(r)||"body"===Pd(r)&&"static"===Xd(r).position)?e:r||function(t){var e=/firefox/i.test(Wd());if(/Trident/i.test(Wd())&&Nd(t)&&"fixed"===Xd(t).position)return null;var r=Qd(t);for(Id(r)&&(r=r.host);Nd(r)&&["html","body"].indexOf(Pd(r))<0;){var o=Xd(r);if("none"!==o.transform||"none"!==o.perspective||"paint"===o.contain||-1!==["transform","perspective"].indexOf(o.willChange)||e&&"filter"===o.willChange||e&&o.filter&&"none"!==o.filter)return r;r=r.parentNode}return null}(t)||e}function ec(t){return["top","bottom"].indexOf(t)>=0?"x":"y"}function rc(t,e,r){return $d(t,Ud(e,r))}function oc(t){return Object.assign({},{top:0,right:0,bottom:0,left:0},t)}function nc(t,e){return e.reduce((function(e,r){return e[r]=t,e}),{})}const ic={name:"arrow",enabled:!0,phase:"main",fn:function(t){var e,r=t.state,o=t.name,n=t.options,i=r.elements.arrow,a=r.modifiersData.popperOffsets,s=Fd(r.placement),l=ec(s),d=[md,bd].indexOf(s)>=0?"height":"width";if(i&&a){var c=function(t,e){return oc("number"!=typeof(t="function"==typeof t?t(Object.assign({},e.rects,{placement:e.placement})):t)?t:nc(t,fd))}(n.padding,r),p=Gd(i),b="y"===l?cd:md,m="y"===l?pd:bd,g=r.rects.reference[d]+r.rects.reference[l]-a[l]-r.rects.popper[d],f=a[l]-r.rects.reference[l],u=tc(i),h=u?"y"===l?u.clientHeight||0:u.clientWidth||0:0,v=g/2-f/2,x=c[b],w=h-p[d]-c[m],y=h/2-p[d]/2+v,_=rc(x,y,w),k=l;r.modifiersData[o]=((e={})[k]=_,e.centerOffset=_-y,e)}},effect:function(t){var e=t.state,r=t.options.element,o=void 0===r?"[data-popper-arrow]":r;null!=o&&("string"!=typeof o||(o=e.elements.popper.querySelector(o)))&&Kd(e.elements.popper,o)&&(e.elements.arrow=o)},requires:["popperOffsets"],requiresIfExists:["preventOverflow"]};function ac(t){return t.split("-")[1]}var sc={top:"auto",right:"auto",bottom:"auto",left:"auto"};function lc(t){var e,r=t.popper,o=t.popperRect,n=t.placement,i=t.variation,a=t.offsets,s=t.position,l=t.gpuAcceleration,d=t.adaptive,c=t.roundOffsets,p=t.isFixed,b=a.x,m=void 0===b?0:b,g=a.y,f=void 0===g?0:g,u="function"==typeof c?c({x:m,y:f}):{x:m,y:f};m=u.x,f=u.y;var h=a.hasOwnProperty("x"),v=a.hasOwnProperty("y"),x=md,w=cd,y=window;if(d){var _=tc(r),k="clientHeight",E="clientWidth";_===Dd(r)&&"static"!==Xd(_=Jd(r)).position&&"absolute"===s&&(k="scrollHeight",E="scrollWidth"),(n===cd||(n===md||n===bd)&&i===hd)&&(w=pd,f-=(p&&_===y&&y.visualViewport?y.visualViewport.height:_[k])-o.height,f*=l?1:-1),n!==md&&(n!==cd&&n!==pd||i!==hd)||(x=bd,m-=(p&&_===y&&y.visualViewport?y.visualViewport.width:_[E])-o.width,m*=l?1:-1)}var A,S=Object.assign({position:s},d&&sc),T=!0===c?function(t,e){var r=t.x,o=t.y,n=e.devicePixelRatio||1;return{x:Vd(r*n)/n||0,y:Vd(o*n)/n||0}}({x:m,y:f},Dd(r)):{x:m,y:f};return m=T.x,f=T.y,l?Object.assign({},S,((A={})[w]=v?"0":"",A[x]=h?"0":"",A.transform=(y.devicePixelRatio||1)<=1?"translate("+m+"px, "+f+"px)":"translate3d("+m+"px, "+f+"px, 0)",A)):Object.assign({},S,((e={})[w]=v?f+"px":"",e[x]=h?m+"px":"",e.transform="",e))}const dc={name:"computeStyles",enabled:!0,phase:"beforeWrite",fn:function(t){var e=t.state,r=t.options,o=r.gpuAcceleration,n=void 0===o||o,i=r.adaptive,a=void 0===i||i,s=r.roundOffsets,l=void 0===s||s,d={placement:Fd(e.placement),variation:ac(e.placement),popper:e.elements.popper,popperRect:e.rects.popper,gpuAcceleration:n,isFixed:"fixed"===e.options.strategy};null!=e.modifiersData.popperOffsets&&(e.styles.popper=Object.assign({},e.styles.popper,lc(Object.assign({},d,{offsets:e.modifiersData.popperOffsets,position:e.options.strategy,adaptive:a,roundOffsets:l})))),null!=e.modifiersData.arrow&&(e.styles.arrow=Object.assign({},e.styles.arrow,lc(Object.assign({},d,{offsets:e.modifiersData.arrow,position:"absolute",adaptive:!1,roundOffsets:l})))),e.attributes.popper=Object.assign({},e.attributes.popper,{"data-popper-placement":e.placement})},data:{}};var cc={passive:!0};const pc={name:"eventListeners",enabled:!0,phase:"write",fn:function(){},effect:function(t){var e=t.state,r=t.instance,o=t.options,n=o.scroll,i=void 0===n||n,a=o.resize,s=void 0===a||a,l=Dd(e.elements.popper),d=[].concat(e.scrollParents.reference,e.scrollParents.popper);return i&&d.forEach((function(t){t.addEventListener("scroll",r.update,cc)})),s&&l.addEventListener("resize",r.update,cc),function(){i&&d.forEach((function(t){t.removeEventListener("scroll",r.update,cc)})),s&&l.removeEventListener("resize",r.update,cc)}},data:{}};var bc={left:"right",right:"left",bottom:"top",top:"bottom"};function mc(t){return t.replace(/left|right|bottom|top/g,(function(t){return bc[t]}))}var gc={start:"end",end:"start"};function fc(t){return t.replace(/start|end/g,(function(t){return gc[t]}))}function uc(t){var e=Dd(t);return{scrollLeft:e.pageXOffset,scrollTop:e.pageYOffset}}function hc(t){return qd(Jd(t)).left+uc(t).scrollLeft}function vc(t){var e=Xd(t),r=e.overflow,o=e.overflowX,n=e.overflowY;return/auto|scroll|overlay|hidden/.test(r+n+o)}function xc(t){return["html","body","#document"].indexOf(Pd(t))>=0?t.ownerDocument.body:Nd(t)&&vc(t)?t:xc(Qd(t))}function wc(t,e){var r;void 0===e&&(e=[]);var o=xc(t),n=o===(null==(r=t.ownerDocument)?void 0:r.body),i=Dd(o),a=n?[i].concat(i.visualViewport||[],vc(o)?o:[]):o,s=e.concat(a);return n?s:s.concat(wc(Qd(a)))}function yc(t){return Object.assign({},t,{left:t.x,top:t.y,right:t.x+t.width,bottom:t.y+t.height})}function _c(t,e,r){return e===xd?yc(function(t,e){var r=Dd(t),o=Jd(t),n=r.visualViewport,i=o.clientWidth,a=o.clientHeight,s=0,l=0;if(n){i=n.width,a=n.height;var d=Hd();(d||!d&&"fixed"===e)&&(s=n.offsetLeft,l=n.offsetTop)}return{width:i,height:a,x:s+hc(t),y:l}}(t,r)):Md(e)?function(t,e){var r=qd(t,!1,"fixed"===e);return r.top=r.top+t.clientTop,r.left=r.left+t.clientLeft,r.bottom=r.top+t.clientHeight,r.right=r.left+t.clientWidth,r.width=t.clientWidth,r.height=t.clientHeight,r.x=r.left,r.y=r.top,r}(e,r):yc(function(t){var e,r=Jd(t),o=uc(t),n=null==(e=t.ownerDocument)?void 0:e.body,i=$d(r.scrollWidth,r.clientWidth,n?n.scrollWidth:0,n?n.clientWidth:0),a=$d(r.scrollHeight,r.clientHeight,n?n.scrollHeight:0,n?n.clientHeight:0),s=-o.scrollLeft+hc(t),l=-o.scrollTop;return"rtl"===Xd(n||r).direction&&(s+=$d(r.clientWidth,n?n.clientWidth:0)-i),{width:i,height:a,x:s,y:l}}(Jd(t)))}function kc(t){var e,r=t.reference,o=t.element,n=t.placement,i=n?Fd(n):null,a=n?ac(n):null,s=r.x+r.width/2-o.width/2,l=r.y+r.height/2-o.height/2;switch(i){case cd:e={x:s,y:r.y-o.height};break;case pd:e={x:s,y:r.y+r.height};break;case bd:e={x:r.x+r.width,y:l};break;case md:e={x:r.x-o.width,y:l};break;default:e={x:r.x,y:r.y}}var d=i?ec(i):null;if(null!=d){var c="y"===d?"height":"width";switch(a){case ud:e[d]=e[d]-(r[c]/2-o[c]/2);break;case hd:e[d]=e[d]+(r[c]/2-o[c]/2)}}return e}function Ec(t,e){void 0===e&&(e={});var r=e,o=r.placement,n=void 0===o?t.placement:o,i=r.strategy,a=void 0===i?t.strategy:i,s=r.boundary,l=void 0===s?vd:s,d=r.rootBoundary,c=void 0===d?xd:d,p=r.elementContext,b=void 0===p?wd:p,m=r.altBoundary,g=void 0!==m&&m,f=r.padding,u=void 0===f?0:f,h=oc("number"!=typeof u?u:nc(u,fd)),v=b===wd?yd:wd,x=t.rects.popper,w=t.elements[g?v:b],y=function(t,e,r,o){var n="clippingParents"===e?function(t){var e=wc(Qd(t)),r=["absolute","fixed"].indexOf(Xd(t).position)>=0&&Nd(t)?tc(t):t;return Md(r)?e.filter((function(t){return Md(t)&&Kd(t,r)&&"body"!==Pd(t)})):[]}(t):[].concat(e),i=[].concat(n,[r]),a=i[0],s=i.reduce((function(e,r){var n=_c(t,r,o);return e.top=$d(n.top,e.top),e.right=Ud(n.right,e.right),e.bottom=Ud(n.bottom,e.bottom),e.left=$d(n.left,e.left),e}),_c(t,a,o));return s.width=s.right-s.left,s.height=s.bottom-s.top,s.x=s.left,s.y=s.top,s}(Md(w)?w:w.contextElement||Jd(t.elements.popper),l,c,a),_=qd(t.elements.reference),k=kc({reference:_,element:x,strategy:"absolute",placement:n}),E=yc(Object.assign({},x,k)),A=b===wd?E:_,S={top:y.top-A.top+h.top,bottom:A.bottom-y.bottom+h.bottom,left:y.left-A.left+h.left,right:A.right-y.right+h.right},T=t.modifiersData.offset;if(b===wd&&T){var O=T[n];Object.keys(S).forEach((function(t){var e=[bd,pd].indexOf(t)>=0?1:-1,r=[cd,pd].indexOf(t)>=0?"y":"x";S[t]+=O[r]*e}))}return S}const Ac={name:"flip",enabled:!0,phase:"main",fn:function(t){var e=t.state,r=t.options,o=t.name;if(!e.modifiersData[o]._skip){for(var n=r.mainAxis,i=void 0===n||n,a=r.altAxis,s=void 0===a||a,l=r.fallbackPlacements,d=r.padding,c=r.boundary,p=r.rootBoundary,b=r.altBoundary,m=r.flipVariations,g=void 0===m||m,f=r.allowedAutoPlacements,u=e.options.placement,h=Fd(u),v=l||(h!==u&&g?function(t){if(Fd(t)===gd)return[];var e=mc(t);return[fc(t),e,fc(e)]}(u):[mc(u)]),x=[u].concat(v).reduce((function(t,r){return t.concat(Fd(r)===gd?function(t,e){void 0===e&&(e={});var r=e,o=r.placement,n=r.boundary,i=r.rootBoundary,a=r.padding,s=r.flipVariations,l=r.allowedAutoPlacements,d=void 0===l?kd:l,c=ac(o),p=c?s?_d:_d.filter((function(t){return ac(t)===c})):fd,b=p.filter((function(t){return d.indexOf(t)>=0}));0===b.length&&(b=p);var m=b.reduce((function(e,r){return e[r]=Ec(t,{placement:r,boundary:n,rootBoundary:i,padding:a})[Fd(r)],e}),{});return Object.keys(m).sort((function(t,e){return m[t]-m[e]}))}(e,{placement:r,boundary:c,rootBoundary:p,padding:d,flipVariations:g,allowedAutoPlacements:f}):r)}),[]),w=e.rects.reference,y=e.rects.popper,_=new Map,k=!0,E=x[0],A=0;A<x.length;A++){var S=x[A],T=Fd(S),O=ac(S)===ud,C=[cd,pd].indexOf(T)>=0,j=C?"width":"height",z=Ec(e,{placement:S,boundary:c,rootBoundary:p,altBoundary:b,padding:d}),L=C?O?bd:md:O?pd:cd;w[j]>y[j]&&(L=mc(L));var R=mc(L),P=[];if(i&&P.push(z[T]<=0),s&&P.push(z[L]<=0,z[R]<=0),P.every((function(t){return t}))){E=S,k=!1;break}_.set(S,P)}if(k)for(var D=function(t){var e=x.find((function(e){var r=_.get(e);if(r)return r.slice(0,t).every((function(t){return t}))}));if(e)return E=e,"break"},M=g?3:1;M>0&&"break"!==D(M);M--);e.placement!==E&&(e.modifiersData[o]._skip=!0,e.placement=E,e.reset=!0)}},requiresIfExists:["offset"],data:{_skip:!1}};function Sc(t,e,r){return void 0===r&&(r={x:0,y:0}),{top:t.top-e.height-r.y,right:t.right-e.width+r.x,bottom:t.bottom-e.height+r.y,left:t.left-e.width-r.x}}function Tc(t){return[cd,bd,pd,md].some((function(e){return t[e]>=0}))}const Oc={name:"hide",enabled:!0,phase:"main",requiresIfExists:["preventOverflow"],fn:function(t){var e=t.state,r=t.name,o=e.rects.reference,n=e.rects.popper,i=e.modifiersData.preventOverflow,a=Ec(e,{elementContext:"reference"}),s=Ec(e,{altBoundary:!0}),l=Sc(a,o),d=Sc(s,n,i),c=Tc(l),p=Tc(d);e.modifiersData[r]={referenceClippingOffsets:l,popperEscapeOffsets:d,isReferenceHidden:c,hasPopperEscaped:p},e.attributes.popper=Object.assign({},e.attributes.popper,{"data-popper-reference-hidden":c,"data-popper-escaped":p})}},Cc={name:"offset",enabled:!0,phase:"main",requires:["popperOffsets"],fn:function(t){var e=t.state,r=t.options,o=t.name,n=r.offset,i=void 0===n?[0,0]:n,a=kd.reduce((function(t,r){return t[r]=function(t,e,r){var o=Fd(t),n=[md,cd].indexOf(o)>=0?-1:1,i="function"==typeof r?r(Object.assign({},e,{placement:t})):r,a=i[0],s=i[1];return a=a||0,s=(s||0)*n,[md,bd].indexOf(o)>=0?{x:s,y:a}:{x:a,y:s}}(r,e.rects,i),t}),{}),s=a[e.placement],l=s.x,d=s.y;null!=e.modifiersData.popperOffsets&&(e.modifiersData.popperOffsets.x+=l,e.modifiersData.popperOffsets.y+=d),e.modifiersData[o]=a}},jc={name:"popperOffsets",enabled:!0,phase:"read",fn:function(t){var e=t.state,r=t.name;e.modifiersData[r]=kc({reference:e.rects.reference,element:e.rects.popper,strategy:"absolute",placement:e.placement})},data:{}},zc={name:"preventOverflow",enabled:!0,phase:"main",fn:function(t){var e=t.state,r=t.options,o=t.name,n=r.mainAxis,i=void 0===n||n,a=r.altAxis,s=void 0!==a&&a,l=r.boundary,d=r.rootBoundary,c=r.altBoundary,p=r.padding,b=r.tether,m=void 0===b||b,g=r.tetherOffset,f=void 0===g?0:g,u=Ec(e,{boundary:l,rootBoundary:d,padding:p,altBoundary:c}),h=Fd(e.placement),v=ac(e.placement),x=!v,w=ec(h),y="x"===w?"y":"x",_=e.modifiersData.popperOffsets,k=e.rects.reference,E=e.rects.popper,A="function"==typeof f?f(Object.assign({},e.rects,{placement:e.placement})):f,S="number"==typeof A?{mainAxis:A,altAxis:A}:Object.assign({mainAxis:0,altAxis:0},A),T=e.modifiersData.offset?e.modifiersData.offset[e.placement]:null,O={x:0,y:0};if(_){if(i){var C,j="y"===w?cd:md,z="y"===w?pd:bd,L="y"===w?"height":"width",R=_[w],P=R+u[j],D=R-u[z],M=m?-E[L]/2:0,N=v===ud?k[L]:E[L],I=v===ud?-E[L]:-k[L],B=e.elements.arrow,F=m&&B?Gd(B):{width:0,height:0},$=e.modifiersData["arrow#persistent"]?e.modifiersData["arrow#persistent"].padding:{top:0,right:0,bottom:0,left:0},U=$[j],V=$[z],W=rc(0,k[L],F[L]),H=x?k[L]/2-M-W-U-S.mainAxis:N-W-U-S.mainAxis,q=x?-k[L]/2+M+W+V+S.mainAxis:I+W+V+S.mainAxis,G=e.elements.arrow&&tc(e.elements.arrow),K=G?"y"===w?G.clientTop||0:G.clientLeft||0:0,X=null!=(C=null==T?void 0:T[w])?C:0,Y=R+q-X,J=rc(m?Ud(P,R+H-X-K):P,R,m?$d(D,Y):D);_[w]=J,O[w]=J-R}if(s){var Q,Z="x"===w?cd:md,tt="x"===w?pd:bd,et=_[y],rt="y"===y?"height":"width",ot=et+u[Z],nt=et-u[tt],it=-1!==[cd,md].indexOf(h),at=null!=(Q=null==T?void 0:T[y])?Q:0,st=it?ot:et-k[rt]-E[rt]-at+S.altAxis,lt=it?et+k[rt]+E[rt]-at-S.altAxis:nt,dt=m&&it?function(t,e,r){var o=rc(t,e,r);return o>r?r:o}(st,et,lt):rc(m?st:ot,et,m?lt:nt);_[y]=dt,O[y]=dt-et}e.modifiersData[o]=O}},requiresIfExists:["offset"]};function Lc(t,e,r){void 0===r&&(r=!1);var o,n,i=Nd(e),a=Nd(e)&&function(t){var e=t.getBoundingClientRect(),r=Vd(e.width)/t.offsetWidth||1,o=Vd(e.height)/t.offsetHeight||1;return 1!==r||1!==o}(e),s=Jd(e),l=qd(t,a,r),d={scrollLeft:0,scrollTop:0},c={x:0,y:0};return(i||!i&&!r)&&(("body"!==Pd(e)||vc(s))&&(d=(o=e)!==Dd(o)&&Nd(o)?{scrollLeft:(n=o).scrollLeft,scrollTop:n.scrollTop}:uc(o)),Nd(e)?((c=qd(e,!0)).x+=e.clientLeft,c.y+=e.clientTop):s&&(c.x=hc(s))),{x:l.left+d.scrollLeft-c.x,y:l.top+d.scrollTop-c.y,width:l.width,height:l.height}}function Rc(t){var e=new Map,r=new Set,o=[];function n(t){r.add(t.name),[].concat(t.requires||[],t.requiresIfExists||[]).forEach((function(t){if(!r.has(t)){var o=e.get(t);o&&n(o)}})),o.push(t)}return t.forEach((function(t){e.set(t.name,t)})),t.forEach((function(t){r.has(t.name)||n(t)})),o}var Pc={placement:"bottom",modifiers:[],strategy:"absolute"};function Dc(){for(var t=arguments.length,e=new Array(t),r=0;r<t;r++)e[r]=arguments[r];return!e.some((function(t){return!(t&&"function"==typeof t.getBoundingClientRect)}))}function Mc(t){void 0===t&&(t={});var e=t,r=e.defaultModifiers,o=void 0===r?[]:r,n=e.defaultOptions,i=void 0===n?Pc:n;return function(t,e,r){void 0===r&&(r=i);var n,a,s={placement:"bottom",orderedModifiers:[],options:Object.assign({},Pc,i),modifiersData:{},elements:{reference:t,popper:e},attributes:{},styles:{}},l=[],d=!1,c={state:s,setOptions:function(r){var n="function"==typeof r?r(s.options):r;p(),s.options=Object.assign({},i,s.options,n),s.scrollParents={reference:Md(t)?wc(t):t.contextElement?wc(t.contextElement):[],popper:wc(e)};var a,d,b=function(t){var e=Rc(t);return Rd.reduce((function(t,r){return t.concat(e.filter((function(t){return t.phase===r})))}),[])}((a=[].concat(o,s.options.modifiers),d=a.reduce((function(t,e){var r=t[e.name];return t[e.name]=r?Object.assign({},r,e,{options:Object.assign({},r.options,e.options),data:Object.assign({},r.data,e.data)}):e,t}),{}),Object.keys(d).map((function(t){return d[t]}))));return s.orderedModifiers=b.filter((function(t){return t.enabled})),s.orderedModifiers.forEach((function(t){var e=t.name,r=t.options,o=void 0===r?{}:r,n=t.effect;if("function"==typeof n){var i=n({state:s,name:e,instance:c,options:o});l.push(i||function(){})}})),c.update()},forceUpdate:function(){if(!d){var t=s.elements,e=t.reference,r=t.popper;if(Dc(e,r)){s.rects={reference:Lc(e,tc(r),"fixed"===s.options.strategy),popper:Gd(r)},s.reset=!1,s.placement=s.options.placement,s.orderedModifiers.forEach((function(t){return s.modifiersData[t.name]=Object.assign({},t.data)}));for(var o=0;o<s.orderedModifiers.length;o++)if(!0!==s.reset){var n=s.orderedModifiers[o],i=n.fn,a=n.options,l=void 0===a?{}:a,p=n.name;"function"==typeof i&&(s=i({state:s,options:l,name:p,instance:c})||s)}else s.reset=!1,o=-1}}},update:(n=function(){return new Promise((function(t){c.forceUpdate(),t(s)}))},function(){return a||(a=new Promise((function(t){Promise.resolve().then((function(){a=void 0,t(n())}))}))),a}),destroy:function(){p(),d=!0}};if(!Dc(t,e))return c;function p(){l.forEach((function(t){return t()})),l=[]}return c.setOptions(r).then((function(t){!d&&r.onFirstUpdate&&r.onFirstUpdate(t)})),c}}var Nc=Mc(),Ic=Mc({defaultModifiers:[pc,jc,dc,Bd,Cc,Ac,zc,ic,Oc]}),Bc=Mc({defaultModifiers:[pc,jc,dc,Bd]});const Fc=new Map,$c={set(t,e,r){Fc.has(t)||Fc.set(t,new Map);const o=Fc.get(t);o.has(e)||0===o.size?o.set(e,r):console.error(`Bootstrap doesn't allow more than one instance per element. Bound instance: ${Array.from(o.keys())[0]}.`)},get:(t,e)=>Fc.has(t)&&Fc.get(t).get(e)||null,remove(t,e){if(!Fc.has(t))return;const r=Fc.get(t);r.delete(e),0===r.size&&Fc.delete(t)}},Uc="transitionend",Vc=t=>(t&&window.CSS&&window.CSS.escape&&(t=t.replace(/#([^\s"#']+)/g,((t,e)=>`#${CSS.escape(e)}`))),t),Wc=t=>{t.dispatchEvent(new Event(Uc))},Hc=t=>!(!t||"object"!=typeof t)&&(void 0!==t.jquery&&(t=t[0]),void 0!==t.nodeType),qc=t=>Hc(t)?t.jquery?t[0]:t:"string"==typeof t&&t.length>0?document.querySelector(Vc(t)):null,Gc=t=>{if(!Hc(t)||0===t.getClientRects().length)return!1;const e="visible"===getComputedStyle(t).getPropertyValue("visibility"),r=t.closest("details:not([open])");if(!r)return e;if(r!==t){const e=t.closest("summary");if(e&&e.parentNode!==r)return!1;if(null===e)return!1}return e},Kc=t=>!t||t.nodeType!==Node.ELEMENT_NODE||!!t.classList.contains("disabled")||(void 0!==t.disabled?t.disabled:t.hasAttribute("disabled")&&"false"!==t.getAttribute("disabled")),Xc=t=>{if(!document.documentElement.attachShadow)return null;if("function"==typeof t.getRootNode){const e=t.getRootNode();return e instanceof ShadowRoot?e:null}return t instanceof ShadowRoot?t:t.parentNode?Xc(t.parentNode):null},Yc=()=>{},Jc=t=>{t.offsetHeight},Qc=()=>window.jQuery&&!document.body.hasAttribute("data-bs-no-jquery")?window.jQuery:null,Zc=[],tp=()=>"rtl"===document.documentElement.dir,ep=t=>{var e;e=()=>{const e=Qc();if(e){const r=t.NAME,o=e.fn[r];e.fn[r]=t.jQueryInterface,e.fn[r].Constructor=t,e.fn[r].noConflict=()=>(e.fn[r]=o,t.jQueryInterface)}},"loading"===document.readyState?(Zc.length||document.addEventListener("DOMContentLoaded",(()=>{for(const t of Zc)t()})),Zc.push(e)):e()},rp=(t,e=[],r=t)=>"function"==typeof t?t(...e):r,op=(t,e,r=!0)=>{if(!r)return void rp(t);const o=(t=>{if(!t)return 0;let{transitionDuration:e,transitionDelay:r}=window.getComputedStyle(t);const o=Number.parseFloat(e),n=Number.parseFloat(r);return o||n?(e=e.split(",")[0],r=r.split(",")[0],1e3*(Number.parseFloat(e)+Number.parseFloat(r))):0})(e)+5;let n=!1;const i=({target:r})=>{r===e&&(n=!0,e.removeEventListener(Uc,i),rp(t))};e.addEventListener(Uc,i),setTimeout((()=>{n||Wc(e)}),o)},np=(t,e,r,o)=>{const n=t.length;let i=t.indexOf(e);return-1===i?!r&&o?t[n-1]:t[0]:(i+=r?1:-1,o&&(i=(i+n)%n),t[Math.max(0,Math.min(i,n-1))])},ip=/[^.]*(?=\..*)\.|.*/,ap=/\..*/,sp=/::\d+$/,lp={};let dp=1;const cp={mouseenter:"mouseover",mouseleave:"mouseout"},pp=new Set(["click","dblclick","mouseup","mousedown","contextmenu","mousewheel","DOMMouseScroll","mouseover","mouseout","mousemove","selectstart","selectend","keydown","keypress","keyup","orientationchange","touchstart","touchmove","touchend","touchcancel","pointerdown","pointermove","pointerup","pointerleave","pointercancel","gesturestart","gesturechange","gestureend","focus","blur","change","reset","select","submit","focusin","focusout","load","unload","beforeunload","resize","move","DOMContentLoaded","readystatechange","error","abort","scroll"]);function bp(t,e){return e&&`${e}::${dp++}`||t.uidEvent||dp++}function mp(t){const e=bp(t);return t.uidEvent=e,lp[e]=lp[e]||{},lp[e]}function gp(t,e,r=null){return Object.values(t).find((t=>t.callable===e&&t.delegationSelector===r))}function fp(t,e,r){const o="string"==typeof e,n=o?r:e||r;let i=xp(t);return pp.has(i)||(i=t),[o,n,i]}function up(t,e,r,o,n){if("string"!=typeof e||!t)return;let[i,a,s]=fp(e,r,o);if(e in cp){const t=t=>function(e){if(!e.relatedTarget||e.relatedTarget!==e.delegateTarget&&!e.delegateTarget.contains(e.relatedTarget))return t.call(this,e)};a=t(a)}const l=mp(t),d=l[s]||(l[s]={}),c=gp(d,a,i?r:null);if(c)return void(c.oneOff=c.oneOff&&n);const p=bp(a,e.replace(ip,"")),b=i?function(t,e,r){return function o(n){const i=t.querySelectorAll(e);for(let{target:a}=n;a&&a!==this;a=a.parentNode)for(const s of i)if(s===a)return yp(n,{delegateTarget:a}),o.oneOff&&wp.off(t,n.type,e,r),r.apply(a,[n])}}(t,r,a):function(t,e){return function r(o){return yp(o,{delegateTarget:t}),r.oneOff&&wp.off(t,o.type,e),e.apply(t,[o])}}(t,a);b.delegationSelector=i?r:null,b.callable=a,b.oneOff=n,b.uidEvent=p,d[p]=b,t.addEventListener(s,b,i)}function hp(t,e,r,o,n){const i=gp(e[r],o,n);i&&(t.removeEventListener(r,i,Boolean(n)),delete e[r][i.uidEvent])}function vp(t,e,r,o){const n=e[r]||{};for(const[i,a]of Object.entries(n))i.includes(o)&&hp(t,e,r,a.callable,a.delegationSelector)}function xp(t){return t=t.replace(ap,""),cp[t]||t}const wp={on(t,e,r,o){up(t,e,r,o,!1)},one(t,e,r,o){up(t,e,r,o,!0)},off(t,e,r,o){if("string"!=typeof e||!t)return;const[n,i,a]=fp(e,r,o),s=a!==e,l=mp(t),d=l[a]||{},c=e.startsWith(".");if(void 0===i){if(c)for(const r of Object.keys(l))vp(t,l,r,e.slice(1));for(const[r,o]of Object.entries(d)){const n=r.replace(sp,"");s&&!e.includes(n)||hp(t,l,a,o.callable,o.delegationSelector)}}else{if(!Object.keys(d).length)return;hp(t,l,a,i,n?r:null)}},trigger(t,e,r){if("string"!=typeof e||!t)return null;const o=Qc();let n=null,i=!0,a=!0,s=!1;e!==xp(e)&&o&&(n=o.Event(e,r),o(t).trigger(n),i=!n.isPropagationStopped(),a=!n.isImmediatePropagationStopped(),s=n.isDefaultPrevented());const l=yp(new Event(e,{bubbles:i,cancelable:!0}),r);return s&&l.preventDefault(),a&&t.dispatchEvent(l),l.defaultPrevented&&n&&n.preventDefault(),l}};function yp(t,e={}){for(const[r,o]of Object.entries(e))try{t[r]=o}catch(e){Object.defineProperty(t,r,{configurable:!0,get:()=>o})}return t}function _p(t){if("true"===t)return!0;if("false"===t)return!1;if(t===Number(t).toString())return Number(t);if(""===t||"null"===t)return null;if("string"!=typeof t)return t;try{return JSON.parse(decodeURIComponent(t))}catch(e){return t}}function kp(t){return t.replace(/[A-Z]/g,(t=>`-${t.toLowerCase()}`))}const Ep={setDataAttribute(t,e,r){t.setAttribute(`data-bs-${kp(e)}`,r)},removeDataAttribute(t,e){t.removeAttribute(`data-bs-${kp(e)}`)},getDataAttributes(t){if(!t)return{};const e={},r=Object.keys(t.dataset).filter((t=>t.startsWith("bs")&&!t.startsWith("bsConfig")));for(const o of r){let r=o.replace(/^bs/,"");r=r.charAt(0).toLowerCase()+r.slice(1,r.length),e[r]=_p(t.dataset[o])}return e},getDataAttribute:(t,e)=>_p(t.getAttribute(`data-bs-${kp(e)}`))};class Ap{static get Default(){return{}}static get DefaultType(){return{}}static get NAME(){throw new Error('You have to implement the static method "NAME", for each component!')}_getConfig(t){return t=this._mergeConfigObj(t),t=this._configAfterMerge(t),this._typeCheckConfig(t),t}_configAfterMerge(t){return t}_mergeConfigObj(t,e){const r=Hc(e)?Ep.getDataAttribute(e,"config"):{};return{...this.constructor.Default,..."object"==typeof r?r:{},...Hc(e)?Ep.getDataAttributes(e):{},..."object"==typeof t?t:{}}}_typeCheckConfig(t,e=this.constructor.DefaultType){for(const[o,n]of Object.entries(e)){const e=t[o],i=Hc(e)?"element":null==(r=e)?`${r}`:Object.prototype.toString.call(r).match(/\s([a-z]+)/i)[1].toLowerCase();if(!new RegExp(n).test(i))throw new TypeError(`${this.constructor.NAME.toUpperCase()}: Option "${o}" provided type "${i}" but expected type "${n}".`)}var r}}class Sp extends Ap{constructor(t,e){super(),(t=qc(t))&&(this._element=t,this._config=this._getConfig(e),$c.set(this._element,this.constructor.DATA_KEY,this))}dispose(){$c.remove(this._element,this.constructor.DATA_KEY),wp.off(this._element,this.constructor.EVENT_KEY);for(const t of Object.getOwnPropertyNames(this))this[t]=null}_queueCallback(t,e,r=!0){op(t,e,r)}_getConfig(t){return t=this._mergeConfigObj(t,this._element),t=this._configAfterMerge(t),this._typeCheckConfig(t),t}static getInstance(t){return $c.get(qc(t),this.DATA_KEY)}static getOrCreateInstance(t,e={}){return this.getInstance(t)||new this(t,"object"==typeof e?e:null)}static get VERSION(){return"5.3.3"}static get DATA_KEY(){return`bs.${this.NAME}`}static get EVENT_KEY(){return`.${this.DATA_KEY}`}static eventName(t){return`${t}${this.EVENT_KEY}`}}const Tp=t=>{let e=t.getAttribute("data-bs-target");if(!e||"#"===e){let r=t.getAttribute("href");if(!r||!r.includes("#")&&!r.startsWith("."))return null;r.includes("#")&&!r.startsWith("#")&&(r=`#${r.split("#")[1]}`),e=r&&"#"!==r?r.trim():null}return e?e.split(",").map((t=>Vc(t))).join(","):null},Op={find:(t,e=document.documentElement)=>[].concat(...Element.prototype.querySelectorAll.call(e,t)),findOne:(t,e=document.documentElement)=>Element.prototype.querySelector.call(e,t),children:(t,e)=>[].concat(...t.children).filter((t=>t.matches(e))),parents(t,e){const r=[];let o=t.parentNode.closest(e);for(;o;)r.push(o),o=o.parentNode.closest(e);return r},prev(t,e){let r=t.previousElementSibling;for(;r;){if(r.matches(e))return[r];r=r.previousElementSibling}return[]},next(t,e){let r=t.nextElementSibling;for(;r;){if(r.matches(e))return[r];r=r.nextElementSibling}return[]},focusableChildren(t){const e=["a","button","input","textarea","select","details","[tabindex]",'[contenteditable="true"]'].map((t=>`${t}:not([tabindex^="-"])`)).join(",");return this.find(e,t).filter((t=>!Kc(t)&&Gc(t)))},getSelectorFromElement(t){const e=Tp(t);return e&&Op.findOne(e)?e:null},getElementFromSelector(t){const e=Tp(t);return e?Op.findOne(e):null},getMultipleElementsFromSelector(t){const e=Tp(t);return e?Op.find(e):[]}},Cp=(t,e="hide")=>{const r=`click.dismiss${t.EVENT_KEY}`,o=t.NAME;wp.on(document,r,`[data-bs-dismiss="${o}"]`,(function(r){if(["A","AREA"].includes(this.tagName)&&r.preventDefault(),Kc(this))return;const n=Op.getElementFromSelector(this)||this.closest(`.${o}`);t.getOrCreateInstance(n)[e]()}))},jp=".bs.alert",zp=`close${jp}`,Lp=`closed${jp}`;class Rp extends Sp{static get NAME(){return"alert"}close(){if(wp.trigger(this._element,zp).defaultPrevented)return;this._element.classList.remove("show");const t=this._element.classList.contains("fade");this._queueCallback((()=>this._destroyElement()),this._element,t)}_destroyElement(){this._element.remove(),wp.trigger(this._element,Lp),this.dispose()}static jQueryInterface(t){return this.each((function(){const e=Rp.getOrCreateInstance(this);if("string"==typeof t){if(void 0===e[t]||t.startsWith("_")||"constructor"===t)throw new TypeError(`No method named "${t}"`);e[t](this)}}))}}Cp(Rp,"close"),ep(Rp);const Pp='[data-bs-toggle="button"]';class Dp extends Sp{static get NAME(){return"button"}toggle(){this._element.setAttribute("aria-pressed",this._element.classList.toggle("active"))}static jQueryInterface(t){return this.each((function(){const e=Dp.getOrCreateInstance(this);"toggle"===t&&e[t]()}))}}wp.on(document,"click.bs.button.data-api",Pp,(t=>{t.preventDefault();const e=t.target.closest(Pp);Dp.getOrCreateInstance(e).toggle()})),ep(Dp);const Mp=".bs.swipe",Np=`touchstart${Mp}`,Ip=`touchmove${Mp}`,Bp=`touchend${Mp}`,Fp=`pointerdown${Mp}`,$p=`pointerup${Mp}`,Up={endCallback:null,leftCallback:null,rightCallback:null},Vp={endCallback:"(function|null)",leftCallback:"(function|null)",rightCallback:"(function|null)"};class Wp extends Ap{constructor(t,e){super(),this._element=t,t&&Wp.isSupported()&&(this._config=this._getConfig(e),this._deltaX=0,this._supportPointerEvents=Boolean(window.PointerEvent),this._initEvents())}static get Default(){return Up}static get DefaultType(){return Vp}static get NAME(){return"swipe"}dispose(){wp.off(this._element,Mp)}_start(t){this._supportPointerEvents?this._eventIsPointerPenTouch(t)&&(this._deltaX=t.clientX):this._deltaX=t.touches[0].clientX}_end(t){this._eventIsPointerPenTouch(t)&&(this._deltaX=t.clientX-this._deltaX),this._handleSwipe(),rp(this._config.endCallback)}_move(t){this._deltaX=t.touches&&t.touches.length>1?0:t.touches[0].clientX-this._deltaX}_handleSwipe(){const t=Math.abs(this._deltaX);if(t<=40)return;const e=t/this._deltaX;this._deltaX=0,e&&rp(e>0?this._config.rightCallback:this._config.leftCallback)}_initEvents(){this._supportPointerEvents?(wp.on(this._element,Fp,(t=>this._start(t))),wp.on(this._element,$p,(t=>this._end(t))),this._element.classList.add("pointer-event")):(wp.on(this._element,Np,(t=>this._start(t))),wp.on(this._element,Ip,(t=>this._move(t))),wp.on(this._element,Bp,(t=>this._end(t))))}_eventIsPointerPenTouch(t){return this._supportPointerEvents&&("pen"===t.pointerType||"touch"===t.pointerType)}static isSupported(){return"ontouchstart"in document.documentElement||navigator.maxTouchPoints>0}}const Hp=".bs.carousel",qp=".data-api",Gp="ArrowLeft",Kp="ArrowRight",Xp="next",Yp="prev",Jp="left",Qp="right",Zp=`slide${Hp}`,tb=`slid${Hp}`,eb=`keydown${Hp}`,rb=`mouseenter${Hp}`,ob=`mouseleave${Hp}`,nb=`dragstart${Hp}`,ib=`load${Hp}${qp}`,ab=`click${Hp}${qp}`,sb="carousel",lb="active",db=".active",cb=".carousel-item",pb=db+cb,bb={[Gp]:Qp,[Kp]:Jp},mb={interval:5e3,keyboard:!0,pause:"hover",ride:!1,touch:!0,wrap:!0},gb={interval:"(number|boolean)",keyboard:"boolean",pause:"(string|boolean)",ride:"(boolean|string)",touch:"boolean",wrap:"boolean"};class fb extends Sp{constructor(t,e){super(t,e),this._interval=null,this._activeElement=null,this._isSliding=!1,this.touchTimeout=null,this._swipeHelper=null,this._indicatorsElement=Op.findOne(".carousel-indicators",this._element),this._addEventListeners(),this._config.ride===sb&&this.cycle()}static get Default(){return mb}static get DefaultType(){return gb}static get NAME(){return"carousel"}next(){this._slide(Xp)}nextWhenVisible(){!document.hidden&&Gc(this._element)&&this.next()}prev(){this._slide(Yp)}pause(){this._isSliding&&Wc(this._element),this._clearInterval()}cycle(){this._clearInterval(),this._updateInterval(),this._interval=setInterval((()=>this.nextWhenVisible()),this._config.interval)}_maybeEnableCycle(){this._config.ride&&(this._isSliding?wp.one(this._element,tb,(()=>this.cycle())):this.cycle())}to(t){const e=this._getItems();if(t>e.length-1||t<0)return;if(this._isSliding)return void wp.one(this._element,tb,(()=>this.to(t)));const r=this._getItemIndex(this._getActive());if(r===t)return;const o=t>r?Xp:Yp;this._slide(o,e[t])}dispose(){this._swipeHelper&&this._swipeHelper.dispose(),super.dispose()}_configAfterMerge(t){return t.defaultInterval=t.interval,t}_addEventListeners(){this._config.keyboard&&wp.on(this._element,eb,(t=>this._keydown(t))),"hover"===this._config.pause&&(wp.on(this._element,rb,(()=>this.pause())),wp.on(this._element,ob,(()=>this._maybeEnableCycle()))),this._config.touch&&Wp.isSupported()&&this._addTouchEventListeners()}_addTouchEventListeners(){for(const t of Op.find(".carousel-item img",this._element))wp.on(t,nb,(t=>t.preventDefault()));const t={leftCallback:()=>this._slide(this._directionToOrder(Jp)),rightCallback:()=>this._slide(this._directionToOrder(Qp)),endCallback:()=>{"hover"===this._config.pause&&(this.pause(),this.touchTimeout&&clearTimeout(this.touchTimeout),this.touchTimeout=setTimeout((()=>this._maybeEnableCycle()),500+this._config.interval))}};this._swipeHelper=new Wp(this._element,t)}_keydown(t){if(/input|textarea/i.test(t.target.tagName))return;const e=bb[t.key];e&&(t.preventDefault(),this._slide(this._directionToOrder(e)))}_getItemIndex(t){return this._getItems().indexOf(t)}_setActiveIndicatorElement(t){if(!this._indicatorsElement)return;const e=Op.findOne(db,this._indicatorsElement);e.classList.remove(lb),e.removeAttribute("aria-current");const r=Op.findOne(`[data-bs-slide-to="${t}"]`,this._indicatorsElement);r&&(r.classList.add(lb),r.setAttribute("aria-current","true"))}_updateInterval(){const t=this._activeElement||this._getActive();if(!t)return;const e=Number.parseInt(t.getAttribute("data-bs-interval"),10);this._config.interval=e||this._config.defaultInterval}_slide(t,e=null){if(this._isSliding)return;const r=this._getActive(),o=t===Xp,n=e||np(this._getItems(),r,o,this._config.wrap);if(n===r)return;const i=this._getItemIndex(n),a=e=>wp.trigger(this._element,e,{relatedTarget:n,direction:this._orderToDirection(t),from:this._getItemIndex(r),to:i});if(a(Zp).defaultPrevented)return;if(!r||!n)return;const s=Boolean(this._interval);this.pause(),this._isSliding=!0,this._setActiveIndicatorElement(i),this._activeElement=n;const l=o?"carousel-item-start":"carousel-item-end",d=o?"carousel-item-next":"carousel-item-prev";n.classList.add(d),Jc(n),r.classList.add(l),n.classList.add(l),this._queueCallback((()=>{n.classList.remove(l,d),n.classList.add(lb),r.classList.remove(lb,d,l),this._isSliding=!1,a(tb)}),r,this._isAnimated()),s&&this.cycle()}_isAnimated(){return this._element.classList.contains("slide")}_getActive(){return Op.findOne(pb,this._element)}_getItems(){return Op.find(cb,this._element)}_clearInterval(){this._interval&&(clearInterval(this._interval),this._interval=null)}_directionToOrder(t){return tp()?t===Jp?Yp:Xp:t===Jp?Xp:Yp}_orderToDirection(t){return tp()?t===Yp?Jp:Qp:t===Yp?Qp:Jp}static jQueryInterface(t){return this.each((function(){const e=fb.getOrCreateInstance(this,t);if("number"!=typeof t){if("string"==typeof t){if(void 0===e[t]||t.startsWith("_")||"constructor"===t)throw new TypeError(`No method named "${t}"`);e[t]()}}else e.to(t)}))}}wp.on(document,ab,"[data-bs-slide], [data-bs-slide-to]",(function(t){const e=Op.getElementFromSelector(this);if(!e||!e.classList.contains(sb))return;t.preventDefault();const r=fb.getOrCreateInstance(e),o=this.getAttribute("data-bs-slide-to");return o?(r.to(o),void r._maybeEnableCycle()):"next"===Ep.getDataAttribute(this,"slide")?(r.next(),void r._maybeEnableCycle()):(r.prev(),void r._maybeEnableCycle())})),wp.on(window,ib,(()=>{const t=Op.find('[data-bs-ride="carousel"]');for(const e of t)fb.getOrCreateInstance(e)})),ep(fb);const ub=".bs.collapse",hb=`show${ub}`,vb=`shown${ub}`,xb=`hide${ub}`,wb=`hidden${ub}`,yb=`click${ub}.data-api`,_b="show",kb="collapse",Eb="collapsing",Ab=`:scope .${kb} .${kb}`,Sb='[data-bs-toggle="collapse"]',Tb={parent:null,toggle:!0},Ob={parent:"(null|element)",toggle:"boolean"};class Cb extends Sp{constructor(t,e){super(t,e),this._isTransitioning=!1,this._triggerArray=[];const r=Op.find(Sb);for(const t of r){const e=Op.getSelectorFromElement(t),r=Op.find(e).filter((t=>t===this._element));null!==e&&r.length&&this._triggerArray.push(t)}this._initializeChildren(),this._config.parent||this._addAriaAndCollapsedClass(this._triggerArray,this._isShown()),this._config.toggle&&this.toggle()}static get Default(){return Tb}static get DefaultType(){return Ob}static get NAME(){return"collapse"}toggle(){this._isShown()?this.hide():this.show()}show(){if(this._isTransitioning||this._isShown())return;let t=[];if(this._config.parent&&(t=this._getFirstLevelChildren(".collapse.show, .collapse.collapsing").filter((t=>t!==this._element)).map((t=>Cb.getOrCreateInstance(t,{toggle:!1})))),t.length&&t[0]._isTransitioning)return;if(wp.trigger(this._element,hb).defaultPrevented)return;for(const e of t)e.hide();const e=this._getDimension();this._element.classList.remove(kb),this._element.classList.add(Eb),this._element.style[e]=0,this._addAriaAndCollapsedClass(this._triggerArray,!0),this._isTransitioning=!0;const r=`scroll${e[0].toUpperCase()+e.slice(1)}`;this._queueCallback((()=>{this._isTransitioning=!1,this._element.classList.remove(Eb),this._element.classList.add(kb,_b),this._element.style[e]="",wp.trigger(this._element,vb)}),this._element,!0),this._element.style[e]=`${this._element[r]}px`}hide(){if(this._isTransitioning||!this._isShown())return;if(wp.trigger(this._element,xb).defaultPrevented)return;const t=this._getDimension();this._element.style[t]=`${this._element.getBoundingClientRect()[t]}px`,Jc(this._element),this._element.classList.add(Eb),this._element.classList.remove(kb,_b);for(const t of this._triggerArray){const e=Op.getElementFromSelector(t);e&&!this._isShown(e)&&this._addAriaAndCollapsedClass([t],!1)}this._isTransitioning=!0,this._element.style[t]="",this._queueCallback((()=>{this._isTransitioning=!1,this._element.classList.remove(Eb),this._element.classList.add(kb),wp.trigger(this._element,wb)}),this._element,!0)}_isShown(t=this._element){return t.classList.contains(_b)}_configAfterMerge(t){return t.toggle=Boolean(t.toggle),t.parent=qc(t.parent),t}_getDimension(){return this._element.classList.contains("collapse-horizontal")?"width":"height"}_initializeChildren(){if(!this._config.parent)return;const t=this._getFirstLevelChildren(Sb);for(const e of t){const t=Op.getElementFromSelector(e);t&&this._addAriaAndCollapsedClass([e],this._isShown(t))}}_getFirstLevelChildren(t){const e=Op.find(Ab,this._config.parent);return Op.find(t,this._config.parent).filter((t=>!e.includes(t)))}_addAriaAndCollapsedClass(t,e){if(t.length)for(const r of t)r.classList.toggle("collapsed",!e),r.setAttribute("aria-expanded",e)}static jQueryInterface(t){const e={};return"string"==typeof t&&/show|hide/.test(t)&&(e.toggle=!1),this.each((function(){const r=Cb.getOrCreateInstance(this,e);if("string"==typeof t){if(void 0===r[t])throw new TypeError(`No method named "${t}"`);r[t]()}}))}}wp.on(document,yb,Sb,(function(t){("A"===t.target.tagName||t.delegateTarget&&"A"===t.delegateTarget.tagName)&&t.preventDefault();for(const t of Op.getMultipleElementsFromSelector(this))Cb.getOrCreateInstance(t,{toggle:!1}).toggle()})),ep(Cb);const jb="dropdown",zb=".bs.dropdown",Lb=".data-api",Rb="ArrowUp",Pb="ArrowDown",Db=`hide${zb}`,Mb=`hidden${zb}`,Nb=`show${zb}`,Ib=`shown${zb}`,Bb=`click${zb}${Lb}`,Fb=`keydown${zb}${Lb}`,$b=`keyup${zb}${Lb}`,Ub="show",Vb='[data-bs-toggle="dropdown"]:not(.disabled):not(:disabled)',Wb=`${Vb}.${Ub}`,Hb=".dropdown-menu",qb=tp()?"top-end":"top-start",Gb=tp()?"top-start":"top-end",Kb=tp()?"bottom-end":"bottom-start",Xb=tp()?"bottom-start":"bottom-end",Yb=tp()?"left-start":"right-start",Jb=tp()?"right-start":"left-start",Qb={autoClose:!0,boundary:"clippingParents",display:"dynamic",offset:[0,2],popperConfig:null,reference:"toggle"},Zb={autoClose:"(boolean|string)",boundary:"(string|element)",display:"string",offset:"(array|string|function)",popperConfig:"(null|object|function)",reference:"(string|element|object)"};class tm extends Sp{constructor(t,e){super(t,e),this._popper=null,this._parent=this._element.parentNode,this._menu=Op.next(this._element,Hb)[0]||Op.prev(this._element,Hb)[0]||Op.findOne(Hb,this._parent),this._inNavbar=this._detectNavbar()}static get Default(){return Qb}static get DefaultType(){return Zb}static get NAME(){return jb}toggle(){return this._isShown()?this.hide():this.show()}show(){if(Kc(this._element)||this._isShown())return;const t={relatedTarget:this._element};if(!wp.trigger(this._element,Nb,t).defaultPrevented){if(this._createPopper(),"ontouchstart"in document.documentElement&&!this._parent.closest(".navbar-nav"))for(const t of[].concat(...document.body.children))wp.on(t,"mouseover",Yc);this._element.focus(),this._element.setAttribute("aria-expanded",!0),this._menu.classList.add(Ub),this._element.classList.add(Ub),wp.trigger(this._element,Ib,t)}}hide(){if(Kc(this._element)||!this._isShown())return;const t={relatedTarget:this._element};this._completeHide(t)}dispose(){this._popper&&this._popper.destroy(),super.dispose()}update(){this._inNavbar=this._detectNavbar(),this._popper&&this._popper.update()}_completeHide(t){if(!wp.trigger(this._element,Db,t).defaultPrevented){if("ontouchstart"in document.documentElement)for(const t of[].concat(...document.body.children))wp.off(t,"mouseover",Yc);this._popper&&this._popper.destroy(),this._menu.classList.remove(Ub),this._element.classList.remove(Ub),this._element.setAttribute("aria-expanded","false"),Ep.removeDataAttribute(this._menu,"popper"),wp.trigger(this._element,Mb,t)}}_getConfig(t){if("object"==typeof(t=super._getConfig(t)).reference&&!Hc(t.reference)&&"function"!=typeof t.reference.getBoundingClientRect)throw new TypeError(`${jb.toUpperCase()}: Option "reference" provided type "object" without a required "getBoundingClientRect" method.`);return t}_createPopper(){let t=this._element;"parent"===this._config.reference?t=this._parent:Hc(this._config.reference)?t=qc(this._config.reference):"object"==typeof this._config.reference&&(t=this._config.reference);const e=this._getPopperConfig();this._popper=Ic(t,this._menu,e)}_isShown(){return this._menu.classList.contains(Ub)}_getPlacement(){const t=this._parent;if(t.classList.contains("dropend"))return Yb;if(t.classList.contains("dropstart"))return Jb;if(t.classList.contains("dropup-center"))return"top";if(t.classList.contains("dropdown-center"))return"bottom";const e="end"===getComputedStyle(this._menu).getPropertyValue("--bs-position").trim();return t.classList.contains("dropup")?e?Gb:qb:e?Xb:Kb}_detectNavbar(){return null!==this._element.closest(".navbar")}_getOffset(){const{offset:t}=this._config;return"string"==typeof t?t.split(",").map((t=>Number.parseInt(t,10))):"function"==typeof t?e=>t(e,this._element):t}_getPopperConfig(){const t={placement:this._getPlacement(),modifiers:[{name:"preventOverflow",options:{boundary:this._config.boundary}},{name:"offset",options:{offset:this._getOffset()}}]};return(this._inNavbar||"static"===this._config.display)&&(Ep.setDataAttribute(this._menu,"popper","static"),t.modifiers=[{name:"applyStyles",enabled:!1}]),{...t,...rp(this._config.popperConfig,[t])}}_selectMenuItem({key:t,target:e}){const r=Op.find(".dropdown-menu .dropdown-item:not(.disabled):not(:disabled)",this._menu).filter((t=>Gc(t)));r.length&&np(r,e,t===Pb,!r.includes(e)).focus()}static jQueryInterface(t){return this.each((function(){const e=tm.getOrCreateInstance(this,t);if("string"==typeof t){if(void 0===e[t])throw new TypeError(`No method named "${t}"`);e[t]()}}))}static clearMenus(t){if(2===t.button||"keyup"===t.type&&"Tab"!==t.key)return;const e=Op.find(Wb);for(const r of e){const e=tm.getInstance(r);if(!e||!1===e._config.autoClose)continue;const o=t.composedPath(),n=o.includes(e._menu);if(o.includes(e._element)||"inside"===e._config.autoClose&&!n||"outside"===e._config.autoClose&&n)continue;if(e._menu.contains(t.target)&&("keyup"===t.type&&"Tab"===t.key||/input|select|option|textarea|form/i.test(t.target.tagName)))continue;const i={relatedTarget:e._element};"click"===t.type&&(i.clickEvent=t),e._completeHide(i)}}static dataApiKeydownHandler(t){const e=/input|textarea/i.test(t.target.tagName),r="Escape"===t.key,o=[Rb,Pb].includes(t.key);if(!o&&!r)return;if(e&&!r)return;t.preventDefault();const n=this.matches(Vb)?this:Op.prev(this,Vb)[0]||Op.next(this,Vb)[0]||Op.findOne(Vb,t.delegateTarget.parentNode),i=tm.getOrCreateInstance(n);if(o)return t.stopPropagation(),i.show(),void i._selectMenuItem(t);i._isShown()&&(t.stopPropagation(),i.hide(),n.focus())}}wp.on(document,Fb,Vb,tm.dataApiKeydownHandler),wp.on(document,Fb,Hb,tm.dataApiKeydownHandler),wp.on(document,Bb,tm.clearMenus),wp.on(document,$b,tm.clearMenus),wp.on(document,Bb,Vb,(function(t){t.preventDefault(),tm.getOrCreateInstance(this).toggle()})),ep(tm);const em="backdrop",rm="show",om=`mousedown.bs.${em}`,nm={className:"modal-backdrop",clickCallback:null,isAnimated:!1,isVisible:!0,rootElement:"body"},im={className:"string",clickCallback:"(function|null)",isAnimated:"boolean",isVisible:"boolean",rootElement:"(element|string)"};class am extends Ap{constructor(t){super(),this._config=this._getConfig(t),this._isAppended=!1,this._element=null}static get Default(){return nm}static get DefaultType(){return im}static get NAME(){return em}show(t){if(!this._config.isVisible)return void rp(t);this._append();const e=this._getElement();this._config.isAnimated&&Jc(e),e.classList.add(rm),this._emulateAnimation((()=>{rp(t)}))}hide(t){this._config.isVisible?(this._getElement().classList.remove(rm),this._emulateAnimation((()=>{this.dispose(),rp(t)}))):rp(t)}dispose(){this._isAppended&&(wp.off(this._element,om),this._element.remove(),this._isAppended=!1)}_getElement(){if(!this._element){const t=document.createElement("div");t.className=this._config.className,this._config.isAnimated&&t.classList.add("fade"),this._element=t}return this._element}_configAfterMerge(t){return t.rootElement=qc(t.rootElement),t}_append(){if(this._isAppended)return;const t=this._getElement();this._config.rootElement.append(t),wp.on(t,om,(()=>{rp(this._config.clickCallback)})),this._isAppended=!0}_emulateAnimation(t){op(t,this._getElement(),this._config.isAnimated)}}const sm=".bs.focustrap",lm=`focusin${sm}`,dm=`keydown.tab${sm}`,cm="backward",pm={autofocus:!0,trapElement:null},bm={autofocus:"boolean",trapElement:"element"};class mm extends Ap{constructor(t){super(),this._config=this._getConfig(t),this._isActive=!1,this._lastTabNavDirection=null}static get Default(){return pm}static get DefaultType(){return bm}static get NAME(){return"focustrap"}activate(){this._isActive||(this._config.autofocus&&this._config.trapElement.focus(),wp.off(document,sm),wp.on(document,lm,(t=>this._handleFocusin(t))),wp.on(document,dm,(t=>this._handleKeydown(t))),this._isActive=!0)}deactivate(){this._isActive&&(this._isActive=!1,wp.off(document,sm))}_handleFocusin(t){const{trapElement:e}=this._config;if(t.target===document||t.target===e||e.contains(t.target))return;const r=Op.focusableChildren(e);0===r.length?e.focus():this._lastTabNavDirection===cm?r[r.length-1].focus():r[0].focus()}_handleKeydown(t){"Tab"===t.key&&(this._lastTabNavDirection=t.shiftKey?cm:"forward")}}const gm=".fixed-top, .fixed-bottom, .is-fixed, .sticky-top",fm=".sticky-top",um="padding-right",hm="margin-right";class vm{constructor(){this._element=document.body}getWidth(){const t=document.documentElement.clientWidth;return Math.abs(window.innerWidth-t)}hide(){const t=this.getWidth();this._disableOverFlow(),this._setElementAttributes(this._element,um,(e=>e+t)),this._setElementAttributes(gm,um,(e=>e+t)),this._setElementAttributes(fm,hm,(e=>e-t))}reset(){this._resetElementAttributes(this._element,"overflow"),this._resetElementAttributes(this._element,um),this._resetElementAttributes(gm,um),this._resetElementAttributes(fm,hm)}isOverflowing(){return this.getWidth()>0}_disableOverFlow(){this._saveInitialAttribute(this._element,"overflow"),this._element.style.overflow="hidden"}_setElementAttributes(t,e,r){const o=this.getWidth();this._applyManipulationCallback(t,(t=>{if(t!==this._element&&window.innerWidth>t.clientWidth+o)return;this._saveInitialAttribute(t,e);const n=window.getComputedStyle(t).getPropertyValue(e);t.style.setProperty(e,`${r(Number.parseFloat(n))}px`)}))}_saveInitialAttribute(t,e){const r=t.style.getPropertyValue(e);r&&Ep.setDataAttribute(t,e,r)}_resetElementAttributes(t,e){this._applyManipulationCallback(t,(t=>{const r=Ep.getDataAttribute(t,e);null!==r?(Ep.removeDataAttribute(t,e),t.style.setProperty(e,r)):t.style.removeProperty(e)}))}_applyManipulationCallback(t,e){if(Hc(t))e(t);else for(const r of Op.find(t,this._element))e(r)}}const xm=".bs.modal",wm=`hide${xm}`,ym=`hidePrevented${xm}`,_m=`hidden${xm}`,km=`show${xm}`,Em=`shown${xm}`,Am=`resize${xm}`,Sm=`click.dismiss${xm}`,Tm=`mousedown.dismiss${xm}`,Om=`keydown.dismiss${xm}`,Cm=`click${xm}.data-api`,jm="modal-open",zm="show",Lm="modal-static",Rm={backdrop:!0,focus:!0,keyboard:!0},Pm={backdrop:"(boolean|string)",focus:"boolean",keyboard:"boolean"};class Dm extends Sp{constructor(t,e){super(t,e),this._dialog=Op.findOne(".modal-dialog",this._element),this._backdrop=this._initializeBackDrop(),this._focustrap=this._initializeFocusTrap(),this._isShown=!1,this._isTransitioning=!1,this._scrollBar=new vm,this._addEventListeners()}static get Default(){return Rm}static get DefaultType(){return Pm}static get NAME(){return"modal"}toggle(t){return this._isShown?this.hide():this.show(t)}show(t){this._isShown||this._isTransitioning||wp.trigger(this._element,km,{relatedTarget:t}).defaultPrevented||(this._isShown=!0,this._isTransitioning=!0,this._scrollBar.hide(),document.body.classList.add(jm),this._adjustDialog(),this._backdrop.show((()=>this._showElement(t))))}hide(){this._isShown&&!this._isTransitioning&&(wp.trigger(this._element,wm).defaultPrevented||(this._isShown=!1,this._isTransitioning=!0,this._focustrap.deactivate(),this._element.classList.remove(zm),this._queueCallback((()=>this._hideModal()),this._element,this._isAnimated())))}dispose(){wp.off(window,xm),wp.off(this._dialog,xm),this._backdrop.dispose(),this._focustrap.deactivate(),super.dispose()}handleUpdate(){this._adjustDialog()}_initializeBackDrop(){return new am({isVisible:Boolean(this._config.backdrop),isAnimated:this._isAnimated()})}_initializeFocusTrap(){return new mm({trapElement:this._element})}_showElement(t){document.body.contains(this._element)||document.body.append(this._element),this._element.style.display="block",this._element.removeAttribute("aria-hidden"),this._element.setAttribute("aria-modal",!0),this._element.setAttribute("role","dialog"),this._element.scrollTop=0;const e=Op.findOne(".modal-body",this._dialog);e&&(e.scrollTop=0),Jc(this._element),this._element.classList.add(zm),this._queueCallback((()=>{this._config.focus&&this._focustrap.activate(),this._isTransitioning=!1,wp.trigger(this._element,Em,{relatedTarget:t})}),this._dialog,this._isAnimated())}_addEventListeners(){wp.on(this._element,Om,(t=>{"Escape"===t.key&&(this._config.keyboard?this.hide():this._triggerBackdropTransition())})),wp.on(window,Am,(()=>{this._isShown&&!this._isTransitioning&&this._adjustDialog()})),wp.on(this._element,Tm,(t=>{wp.one(this._element,Sm,(e=>{this._element===t.target&&this._element===e.target&&("static"!==this._config.backdrop?this._config.backdrop&&this.hide():this._triggerBackdropTransition())}))}))}_hideModal(){this._element.style.display="none",this._element.setAttribute("aria-hidden",!0),this._element.removeAttribute("aria-modal"),this._element.removeAttribute("role"),this._isTransitioning=!1,this._backdrop.hide((()=>{document.body.classList.remove(jm),this._resetAdjustments(),this._scrollBar.reset(),wp.trigger(this._element,_m)}))}_isAnimated(){return this._element.classList.contains("fade")}_triggerBackdropTransition(){if(wp.trigger(this._element,ym).defaultPrevented)return;const t=this._element.scrollHeight>document.documentElement.clientHeight,e=this._element.style.overflowY;"hidden"===e||this._element.classList.contains(Lm)||(t||(this._element.style.overflowY="hidden"),this._element.classList.add(Lm),this._queueCallback((()=>{this._element.classList.remove(Lm),this._queueCallback((()=>{this._element.style.overflowY=e}),this._dialog)}),this._dialog),this._element.focus())}_adjustDialog(){const t=this._element.scrollHeight>document.documentElement.clientHeight,e=this._scrollBar.getWidth(),r=e>0;if(r&&!t){const t=tp()?"paddingLeft":"paddingRight";this._element.style[t]=`${e}px`}if(!r&&t){const t=tp()?"paddingRight":"paddingLeft";this._element.style[t]=`${e}px`}}_resetAdjustments(){this._element.style.paddingLeft="",this._element.style.paddingRight=""}static jQueryInterface(t,e){return this.each((function(){const r=Dm.getOrCreateInstance(this,t);if("string"==typeof t){if(void 0===r[t])throw new TypeError(`No method named "${t}"`);r[t](e)}}))}}wp.on(document,Cm,'[data-bs-toggle="modal"]',(function(t){const e=Op.getElementFromSelector(this);["A","AREA"].includes(this.tagName)&&t.preventDefault(),wp.one(e,km,(t=>{t.defaultPrevented||wp.one(e,_m,(()=>{Gc(this)&&this.focus()}))}));const r=Op.findOne(".modal.show");r&&Dm.getInstance(r).hide(),Dm.getOrCreateInstance(e).toggle(this)})),Cp(Dm),ep(Dm);const Mm=".bs.offcanvas",Nm=".data-api",Im=`load${Mm}${Nm}`,Bm="show",Fm="showing",$m="hiding",Um=".offcanvas.show",Vm=`show${Mm}`,Wm=`shown${Mm}`,Hm=`hide${Mm}`,qm=`hidePrevented${Mm}`,Gm=`hidden${Mm}`,Km=`resize${Mm}`,Xm=`click${Mm}${Nm}`,Ym=`keydown.dismiss${Mm}`,Jm={backdrop:!0,keyboard:!0,scroll:!1},Qm={backdrop:"(boolean|string)",keyboard:"boolean",scroll:"boolean"};class Zm extends Sp{constructor(t,e){super(t,e),this._isShown=!1,this._backdrop=this._initializeBackDrop(),this._focustrap=this._initializeFocusTrap(),this._addEventListeners()}static get Default(){return Jm}static get DefaultType(){return Qm}static get NAME(){return"offcanvas"}toggle(t){return this._isShown?this.hide():this.show(t)}show(t){this._isShown||wp.trigger(this._element,Vm,{relatedTarget:t}).defaultPrevented||(this._isShown=!0,this._backdrop.show(),this._config.scroll||(new vm).hide(),this._element.setAttribute("aria-modal",!0),this._element.setAttribute("role","dialog"),this._element.classList.add(Fm),this._queueCallback((()=>{this._config.scroll&&!this._config.backdrop||this._focustrap.activate(),this._element.classList.add(Bm),this._element.classList.remove(Fm),wp.trigger(this._element,Wm,{relatedTarget:t})}),this._element,!0))}hide(){this._isShown&&(wp.trigger(this._element,Hm).defaultPrevented||(this._focustrap.deactivate(),this._element.blur(),this._isShown=!1,this._element.classList.add($m),this._backdrop.hide(),this._queueCallback((()=>{this._element.classList.remove(Bm,$m),this._element.removeAttribute("aria-modal"),this._element.removeAttribute("role"),this._config.scroll||(new vm).reset(),wp.trigger(this._element,Gm)}),this._element,!0)))}dispose(){this._backdrop.dispose(),this._focustrap.deactivate(),super.dispose()}_initializeBackDrop(){const t=Boolean(this._config.backdrop);return new am({className:"offcanvas-backdrop",isVisible:t,isAnimated:!0,rootElement:this._element.parentNode,clickCallback:t?()=>{"static"!==this._config.backdrop?this.hide():wp.trigger(this._element,qm)}:null})}_initializeFocusTrap(){return new mm({trapElement:this._element})}_addEventListeners(){wp.on(this._element,Ym,(t=>{"Escape"===t.key&&(this._config.keyboard?this.hide():wp.trigger(this._element,qm))}))}static jQueryInterface(t){return this.each((function(){const e=Zm.getOrCreateInstance(this,t);if("string"==typeof t){if(void 0===e[t]||t.startsWith("_")||"constructor"===t)throw new TypeError(`No method named "${t}"`);e[t](this)}}))}}wp.on(document,Xm,'[data-bs-toggle="offcanvas"]',(function(t){const e=Op.getElementFromSelector(this);if(["A","AREA"].includes(this.tagName)&&t.preventDefault(),Kc(this))return;wp.one(e,Gm,(()=>{Gc(this)&&this.focus()}));const r=Op.findOne(Um);r&&r!==e&&Zm.getInstance(r).hide(),Zm.getOrCreateInstance(e).toggle(this)})),wp.on(window,Im,(()=>{for(const t of Op.find(Um))Zm.getOrCreateInstance(t).show()})),wp.on(window,Km,(()=>{for(const t of Op.find("[aria-modal][class*=show][class*=offcanvas-]"))"fixed"!==getComputedStyle(t).position&&Zm.getOrCreateInstance(t).hide()})),Cp(Zm),ep(Zm);const tg={"*":["class","dir","id","lang","role",/^aria-[\w-]*$/i],a:["target","href","title","rel"],area:[],b:[],br:[],col:[],code:[],dd:[],div:[],dl:[],dt:[],em:[],hr:[],h1:[],h2:[],h3:[],h4:[],h5:[],h6:[],i:[],img:["src","srcset","alt","title","width","height"],li:[],ol:[],p:[],pre:[],s:[],small:[],span:[],sub:[],sup:[],strong:[],u:[],ul:[]},eg=new Set(["background","cite","href","itemtype","longdesc","poster","src","xlink:href"]),rg=/^(?!javascript:)(?:[a-z0-9+.-]+:|[^&:/?#]*(?:[/?#]|$))/i,og=(t,e)=>{const r=t.nodeName.toLowerCase();return e.includes(r)?!eg.has(r)||Boolean(rg.test(t.nodeValue)):e.filter((t=>t instanceof RegExp)).some((t=>t.test(r)))},ng={allowList:tg,content:{},extraClass:"",html:!1,sanitize:!0,sanitizeFn:null,template:"<div></div>"},ig={allowList:"object",content:"object",extraClass:"(string|function)",html:"boolean",sanitize:"boolean",sanitizeFn:"(null|function)",template:"string"},ag={entry:"(string|element|function|null)",selector:"(string|element)"};class sg extends Ap{constructor(t){super(),this._config=this._getConfig(t)}static get Default(){return ng}static get DefaultType(){return ig}static get NAME(){return"TemplateFactory"}getContent(){return Object.values(this._config.content).map((t=>this._resolvePossibleFunction(t))).filter(Boolean)}hasContent(){return this.getContent().length>0}changeContent(t){return this._checkContent(t),this._config.content={...this._config.content,...t},this}toHtml(){const t=document.createElement("div");t.innerHTML=this._maybeSanitize(this._config.template);for(const[e,r]of Object.entries(this._config.content))this._setContent(t,r,e);const e=t.children[0],r=this._resolvePossibleFunction(this._config.extraClass);return r&&e.classList.add(...r.split(" ")),e}_typeCheckConfig(t){super._typeCheckConfig(t),this._checkContent(t.content)}_checkContent(t){for(const[e,r]of Object.entries(t))super._typeCheckConfig({selector:e,entry:r},ag)}_setContent(t,e,r){const o=Op.findOne(r,t);o&&((e=this._resolvePossibleFunction(e))?Hc(e)?this._putElementInTemplate(qc(e),o):this._config.html?o.innerHTML=this._maybeSanitize(e):o.textContent=e:o.remove())}_maybeSanitize(t){return this._config.sanitize?function(t,e,r){if(!t.length)return t;if(r&&"function"==typeof r)return r(t);const o=(new window.DOMParser).parseFromString(t,"text/html"),n=[].concat(...o.body.querySelectorAll("*"));for(const t of n){const r=t.nodeName.toLowerCase();if(!Object.keys(e).includes(r)){t.remove();continue}const o=[].concat(...t.attributes),n=[].concat(e["*"]||[],e[r]||[]);for(const e of o)og(e,n)||t.removeAttribute(e.nodeName)}return o.body.innerHTML}(t,this._config.allowList,this._config.sanitizeFn):t}_resolvePossibleFunction(t){return rp(t,[this])}_putElementInTemplate(t,e){if(this._config.html)return e.innerHTML="",void e.append(t);e.textContent=t.textContent}}const lg=new Set(["sanitize","allowList","sanitizeFn"]),dg="fade",cg="show",pg=".tooltip-inner",bg=".modal",mg="hide.bs.modal",gg="hover",fg="focus",ug={AUTO:"auto",TOP:"top",RIGHT:tp()?"left":"right",BOTTOM:"bottom",LEFT:tp()?"right":"left"},hg={allowList:tg,animation:!0,boundary:"clippingParents",container:!1,customClass:"",delay:0,fallbackPlacements:["top","right","bottom","left"],html:!1,offset:[0,6],placement:"top",popperConfig:null,sanitize:!0,sanitizeFn:null,selector:!1,template:'<div class="tooltip" role="tooltip"><div class="tooltip-arrow"></div><div class="tooltip-inner"></div></div>',title:"",trigger:"hover focus"},vg={allowList:"object",animation:"boolean",boundary:"(string|element)",container:"(string|element|boolean)",customClass:"(string|function)",delay:"(number|object)",fallbackPlacements:"array",html:"boolean",offset:"(array|string|function)",placement:"(string|function)",popperConfig:"(null|object|function)",sanitize:"boolean",sanitizeFn:"(null|function)",selector:"(string|boolean)",template:"string",title:"(string|element|function)",trigger:"string"};class xg extends Sp{constructor(t,e){super(t,e),this._isEnabled=!0,this._timeout=0,this._isHovered=null,this._activeTrigger={},this._popper=null,this._templateFactory=null,this._newContent=null,this.tip=null,this._setListeners(),this._config.selector||this._fixTitle()}static get Default(){return hg}static get DefaultType(){return vg}static get NAME(){return"tooltip"}enable(){this._isEnabled=!0}disable(){this._isEnabled=!1}toggleEnabled(){this._isEnabled=!this._isEnabled}toggle(){this._isEnabled&&(this._activeTrigger.click=!this._activeTrigger.click,this._isShown()?this._leave():this._enter())}dispose(){clearTimeout(this._timeout),wp.off(this._element.closest(bg),mg,this._hideModalHandler),this._element.getAttribute("data-bs-original-title")&&this._element.setAttribute("title",this._element.getAttribute("data-bs-original-title")),this._disposePopper(),super.dispose()}show(){if("none"===this._element.style.display)throw new Error("Please use show on visible elements");if(!this._isWithContent()||!this._isEnabled)return;const t=wp.trigger(this._element,this.constructor.eventName("show")),e=(Xc(this._element)||this._element.ownerDocument.documentElement).contains(this._element);if(t.defaultPrevented||!e)return;this._disposePopper();const r=this._getTipElement();this._element.setAttribute("aria-describedby",r.getAttribute("id"));const{container:o}=this._config;if(this._element.ownerDocument.documentElement.contains(this.tip)||(o.append(r),wp.trigger(this._element,this.constructor.eventName("inserted"))),this._popper=this._createPopper(r),r.classList.add(cg),"ontouchstart"in document.documentElement)for(const t of[].concat(...document.body.children))wp.on(t,"mouseover",Yc);this._queueCallback((()=>{wp.trigger(this._element,this.constructor.eventName("shown")),!1===this._isHovered&&this._leave(),this._isHovered=!1}),this.tip,this._isAnimated())}hide(){if(this._isShown()&&!wp.trigger(this._element,this.constructor.eventName("hide")).defaultPrevented){if(this._getTipElement().classList.remove(cg),"ontouchstart"in document.documentElement)for(const t of[].concat(...document.body.children))wp.off(t,"mouseover",Yc);this._activeTrigger.click=!1,this._activeTrigger[fg]=!1,this._activeTrigger[gg]=!1,this._isHovered=null,this._queueCallback((()=>{this._isWithActiveTrigger()||(this._isHovered||this._disposePopper(),this._element.removeAttribute("aria-describedby"),wp.trigger(this._element,this.constructor.eventName("hidden")))}),this.tip,this._isAnimated())}}update(){this._popper&&this._popper.update()}_isWithContent(){return Boolean(this._getTitle())}_getTipElement(){return this.tip||(this.tip=this._createTipElement(this._newContent||this._getContentForTemplate())),this.tip}_createTipElement(t){const e=this._getTemplateFactory(t).toHtml();if(!e)return null;e.classList.remove(dg,cg),e.classList.add(`bs-${this.constructor.NAME}-auto`);const r=(t=>{do{t+=Math.floor(1e6*Math.random())}while(document.getElementById(t));return t})(this.constructor.NAME).toString();return e.setAttribute("id",r),this._isAnimated()&&e.classList.add(dg),e}setContent(t){this._newContent=t,this._isShown()&&(this._disposePopper(),this.show())}_getTemplateFactory(t){return this._templateFactory?this._templateFactory.changeContent(t):this._templateFactory=new sg({...this._config,content:t,extraClass:this._resolvePossibleFunction(this._config.customClass)}),this._templateFactory}_getContentForTemplate(){return{[pg]:this._getTitle()}}_getTitle(){return this._resolvePossibleFunction(this._config.title)||this._element.getAttribute("data-bs-original-title")}_initializeOnDelegatedTarget(t){return this.constructor.getOrCreateInstance(t.delegateTarget,this._getDelegateConfig())}_isAnimated(){return this._config.animation||this.tip&&this.tip.classList.contains(dg)}_isShown(){return this.tip&&this.tip.classList.contains(cg)}_createPopper(t){const e=rp(this._config.placement,[this,t,this._element]),r=ug[e.toUpperCase()];return Ic(this._element,t,this._getPopperConfig(r))}_getOffset(){const{offset:t}=this._config;return"string"==typeof t?t.split(",").map((t=>Number.parseInt(t,10))):"function"==typeof t?e=>t(e,this._element):t}_resolvePossibleFunction(t){return rp(t,[this._element])}_getPopperConfig(t){const e={placement:t,modifiers:[{name:"flip",options:{fallbackPlacements:this._config.fallbackPlacements}},{name:"offset",options:{offset:this._getOffset()}},{name:"preventOverflow",options:{boundary:this._config.boundary}},{name:"arrow",options:{element:`.${this.constructor.NAME}-arrow`}},{name:"preSetPlacement",enabled:!0,phase:"beforeMain",fn:t=>{this._getTipElement().setAttribute("data-popper-placement",t.state.placement)}}]};return{...e,...rp(this._config.popperConfig,[e])}}_setListeners(){const t=this._config.trigger.split(" ");for(const e of t)if("click"===e)wp.on(this._element,this.constructor.eventName("click"),this._config.selector,(t=>{this._initializeOnDelegatedTarget(t).toggle()}));else if("manual"!==e){const t=e===gg?this.constructor.eventName("mouseenter"):this.constructor.eventName("focusin"),r=e===gg?this.constructor.eventName("mouseleave"):this.constructor.eventName("focusout");wp.on(this._element,t,this._config.selector,(t=>{const e=this._initializeOnDelegatedTarget(t);e._activeTrigger["focusin"===t.type?fg:gg]=!0,e._enter()})),wp.on(this._element,r,this._config.selector,(t=>{const e=this._initializeOnDelegatedTarget(t);e._activeTrigger["focusout"===t.type?fg:gg]=e._element.contains(t.relatedTarget),e._leave()}))}this._hideModalHandler=()=>{this._element&&this.hide()},wp.on(this._element.closest(bg),mg,this._hideModalHandler)}_fixTitle(){const t=this._element.getAttribute("title");t&&(this._element.getAttribute("aria-label")||this._element.textContent.trim()||this._element.setAttribute("aria-label",t),this._element.setAttribute("data-bs-original-title",t),this._element.removeAttribute("title"))}_enter(){this._isShown()||this._isHovered?this._isHovered=!0:(this._isHovered=!0,this._setTimeout((()=>{this._isHovered&&this.show()}),this._config.delay.show))}_leave(){this._isWithActiveTrigger()||(this._isHovered=!1,this._setTimeout((()=>{this._isHovered||this.hide()}),this._config.delay.hide))}_setTimeout(t,e){clearTimeout(this._timeout),this._timeout=setTimeout(t,e)}_isWithActiveTrigger(){return Object.values(this._activeTrigger).includes(!0)}_getConfig(t){const e=Ep.getDataAttributes(this._element);for(const t of Object.keys(e))lg.has(t)&&delete e[t];return t={...e,..."object"==typeof t&&t?t:{}},t=this._mergeConfigObj(t),t=this._configAfterMerge(t),this._typeCheckConfig(t),t}_configAfterMerge(t){return t.container=!1===t.container?document.body:qc(t.container),"number"==typeof t.delay&&(t.delay={show:t.delay,hide:t.delay}),"number"==typeof t.title&&(t.title=t.title.toString()),"number"==typeof t.content&&(t.content=t.content.toString()),t}_getDelegateConfig(){const t={};for(const[e,r]of Object.entries(this._config))this.constructor.Default[e]!==r&&(t[e]=r);return t.selector=!1,t.trigger="manual",t}_disposePopper(){this._popper&&(this._popper.destroy(),this._popper=null),this.tip&&(this.tip.remove(),this.tip=null)}static jQueryInterface(t){return this.each((function(){const e=xg.getOrCreateInstance(this,t);if("string"==typeof t){if(void 0===e[t])throw new TypeError(`No method named "${t}"`);e[t]()}}))}}ep(xg);const wg=".popover-header",yg=".popover-body",_g={...xg.Default,content:"",offset:[0,8],placement:"right",template:'<div class="popover" role="tooltip"><div class="popover-arrow"></div><h3 class="popover-header"></h3><div class="popover-body"></div></div>',trigger:"click"},kg={...xg.DefaultType,content:"(null|string|element|function)"};class Eg extends xg{static get Default(){return _g}static get DefaultType(){return kg}static get NAME(){return"popover"}_isWithContent(){return this._getTitle()||this._getContent()}_getContentForTemplate(){return{[wg]:this._getTitle(),[yg]:this._getContent()}}_getContent(){return this._resolvePossibleFunction(this._config.content)}static jQueryInterface(t){return this.each((function(){const e=Eg.getOrCreateInstance(this,t);if("string"==typeof t){if(void 0===e[t])throw new TypeError(`No method named "${t}"`);e[t]()}}))}}ep(Eg);const Ag=".bs.scrollspy",Sg=`activate${Ag}`,Tg=`click${Ag}`,Og=`load${Ag}.data-api`,Cg="active",jg="[href]",zg=".nav-link",Lg=`${zg}, .nav-item > ${zg}, .list-group-item`,Rg={offset:null,rootMargin:"0px 0px -25%",smoothScroll:!1,target:null,threshold:[.1,.5,1]},Pg={offset:"(number|null)",rootMargin:"string",smoothScroll:"boolean",target:"element",threshold:"array"};class Dg extends Sp{constructor(t,e){super(t,e),this._targetLinks=new Map,this._observableSections=new Map,this._rootElement="visible"===getComputedStyle(this._element).overflowY?null:this._element,this._activeTarget=null,this._observer=null,this._previousScrollData={visibleEntryTop:0,parentScrollTop:0},this.refresh()}static get Default(){return Rg}static get DefaultType(){return Pg}static get NAME(){return"scrollspy"}refresh(){this._initializeTargetsAndObservables(),this._maybeEnableSmoothScroll(),this._observer?this._observer.disconnect():this._observer=this._getNewObserver();for(const t of this._observableSections.values())this._observer.observe(t)}dispose(){this._observer.disconnect(),super.dispose()}_configAfterMerge(t){return t.target=qc(t.target)||document.body,t.rootMargin=t.offset?`${t.offset}px 0px -30%`:t.rootMargin,"string"==typeof t.threshold&&(t.threshold=t.threshold.split(",").map((t=>Number.parseFloat(t)))),t}_maybeEnableSmoothScroll(){this._config.smoothScroll&&(wp.off(this._config.target,Tg),wp.on(this._config.target,Tg,jg,(t=>{const e=this._observableSections.get(t.target.hash);if(e){t.preventDefault();const r=this._rootElement||window,o=e.offsetTop-this._element.offsetTop;if(r.scrollTo)return void r.scrollTo({top:o,behavior:"smooth"});r.scrollTop=o}})))}_getNewObserver(){const t={root:this._rootElement,threshold:this._config.threshold,rootMargin:this._config.rootMargin};return new IntersectionObserver((t=>this._observerCallback(t)),t)}_observerCallback(t){const e=t=>this._targetLinks.get(`#${t.target.id}`),r=t=>{this._previousScrollData.visibleEntryTop=t.target.offsetTop,this._process(e(t))},o=(this._rootElement||document.documentElement).scrollTop,n=o>=this._previousScrollData.parentScrollTop;this._previousScrollData.parentScrollTop=o;for(const i of t){if(!i.isIntersecting){this._activeTarget=null,this._clearActiveClass(e(i));continue}const t=i.target.offsetTop>=this._previousScrollData.visibleEntryTop;if(n&&t){if(r(i),!o)return}else n||t||r(i)}}_initializeTargetsAndObservables(){this._targetLinks=new Map,this._observableSections=new Map;const t=Op.find(jg,this._config.target);for(const e of t){if(!e.hash||Kc(e))continue;const t=Op.findOne(decodeURI(e.hash),this._element);Gc(t)&&(this._targetLinks.set(decodeURI(e.hash),e),this._observableSections.set(e.hash,t))}}_process(t){this._activeTarget!==t&&(this._clearActiveClass(this._config.target),this._activeTarget=t,t.classList.add(Cg),this._activateParents(t),wp.trigger(this._element,Sg,{relatedTarget:t}))}_activateParents(t){if(t.classList.contains("dropdown-item"))Op.findOne(".dropdown-toggle",t.closest(".dropdown")).classList.add(Cg);else for(const e of Op.parents(t,".nav, .list-group"))for(const t of Op.prev(e,Lg))t.classList.add(Cg)}_clearActiveClass(t){t.classList.remove(Cg);const e=Op.find(`${jg}.${Cg}`,t);for(const t of e)t.classList.remove(Cg)}static jQueryInterface(t){return this.each((function(){const e=Dg.getOrCreateInstance(this,t);if("string"==typeof t){if(void 0===e[t]||t.startsWith("_")||"constructor"===t)throw new TypeError(`No method named "${t}"`);e[t]()}}))}}wp.on(window,Og,(()=>{for(const t of Op.find('[data-bs-spy="scroll"]'))Dg.getOrCreateInstance(t)})),ep(Dg);const Mg=".bs.tab",Ng=`hide${Mg}`,Ig=`hidden${Mg}`,Bg=`show${Mg}`,Fg=`shown${Mg}`,$g=`click${Mg}`,Ug=`keydown${Mg}`,Vg=`load${Mg}`,Wg="ArrowLeft",Hg="ArrowRight",qg="ArrowUp",Gg="ArrowDown",Kg="Home",Xg="End",Yg="active",Jg="fade",Qg="show",Zg=".dropdown-toggle",tf=`:not(${Zg})`,ef='[data-bs-toggle="tab"], [data-bs-toggle="pill"], [data-bs-toggle="list"]',rf=`.nav-link${tf}, .list-group-item${tf}, [role="tab"]${tf}, ${ef}`,of=`.${Yg}[data-bs-toggle="tab"], .${Yg}[data-bs-toggle="pill"], .${Yg}[data-bs-toggle="list"]`;class nf extends Sp{constructor(t){super(t),this._parent=this._element.closest('.list-group, .nav, [role="tablist"]'),this._parent&&(this._setInitialAttributes(this._parent,this._getChildren()),wp.on(this._element,Ug,(t=>this._keydown(t))))}static get NAME(){return"tab"}show(){const t=this._element;if(this._elemIsActive(t))return;const e=this._getActiveElem(),r=e?wp.trigger(e,Ng,{relatedTarget:t}):null;wp.trigger(t,Bg,{relatedTarget:e}).defaultPrevented||r&&r.defaultPrevented||(this._deactivate(e,t),this._activate(t,e))}_activate(t,e){t&&(t.classList.add(Yg),this._activate(Op.getElementFromSelector(t)),this._queueCallback((()=>{"tab"===t.getAttribute("role")?(t.removeAttribute("tabindex"),t.setAttribute("aria-selected",!0),this._toggleDropDown(t,!0),wp.trigger(t,Fg,{relatedTarget:e})):t.classList.add(Qg)}),t,t.classList.contains(Jg)))}_deactivate(t,e){t&&(t.classList.remove(Yg),t.blur(),this._deactivate(Op.getElementFromSelector(t)),this._queueCallback((()=>{"tab"===t.getAttribute("role")?(t.setAttribute("aria-selected",!1),t.setAttribute("tabindex","-1"),this._toggleDropDown(t,!1),wp.trigger(t,Ig,{relatedTarget:e})):t.classList.remove(Qg)}),t,t.classList.contains(Jg)))}_keydown(t){if(![Wg,Hg,qg,Gg,Kg,Xg].includes(t.key))return;t.stopPropagation(),t.preventDefault();const e=this._getChildren().filter((t=>!Kc(t)));let r;if([Kg,Xg].includes(t.key))r=e[t.key===Kg?0:e.length-1];else{const o=[Hg,Gg].includes(t.key);r=np(e,t.target,o,!0)}r&&(r.focus({preventScroll:!0}),nf.getOrCreateInstance(r).show())}_getChildren(){return Op.find(rf,this._parent)}_getActiveElem(){return this._getChildren().find((t=>this._elemIsActive(t)))||null}_setInitialAttributes(t,e){this._setAttributeIfNotExists(t,"role","tablist");for(const t of e)this._setInitialAttributesOnChild(t)}_setInitialAttributesOnChild(t){t=this._getInnerElement(t);const e=this._elemIsActive(t),r=this._getOuterElement(t);t.setAttribute("aria-selected",e),r!==t&&this._setAttributeIfNotExists(r,"role","presentation"),e||t.setAttribute("tabindex","-1"),this._setAttributeIfNotExists(t,"role","tab"),this._setInitialAttributesOnTargetPanel(t)}_setInitialAttributesOnTargetPanel(t){const e=Op.getElementFromSelector(t);e&&(this._setAttributeIfNotExists(e,"role","tabpanel"),t.id&&this._setAttributeIfNotExists(e,"aria-labelledby",`${t.id}`))}_toggleDropDown(t,e){const r=this._getOuterElement(t);if(!r.classList.contains("dropdown"))return;const o=(t,o)=>{const n=Op.findOne(t,r);n&&n.classList.toggle(o,e)};o(Zg,Yg),o(".dropdown-menu",Qg),r.setAttribute("aria-expanded",e)}_setAttributeIfNotExists(t,e,r){t.hasAttribute(e)||t.setAttribute(e,r)}_elemIsActive(t){return t.classList.contains(Yg)}_getInnerElement(t){return t.matches(rf)?t:Op.findOne(rf,t)}_getOuterElement(t){return t.closest(".nav-item, .list-group-item")||t}static jQueryInterface(t){return this.each((function(){const e=nf.getOrCreateInstance(this);if("string"==typeof t){if(void 0===e[t]||t.startsWith("_")||"constructor"===t)throw new TypeError(`No method named "${t}"`);e[t]()}}))}}wp.on(document,$g,ef,(function(t){["A","AREA"].includes(this.tagName)&&t.preventDefault(),Kc(this)||nf.getOrCreateInstance(this).show()})),wp.on(window,Vg,(()=>{for(const t of Op.find(of))nf.getOrCreateInstance(t)})),ep(nf);const af=".bs.toast",sf=`mouseover${af}`,lf=`mouseout${af}`,df=`focusin${af}`,cf=`focusout${af}`,pf=`hide${af}`,bf=`hidden${af}`,mf=`show${af}`,gf=`shown${af}`,ff="hide",uf="show",hf="showing",vf={animation:"boolean",autohide:"boolean",delay:"number"},xf={animation:!0,autohide:!0,delay:5e3};class wf extends Sp{constructor(t,e){super(t,e),this._timeout=null,this._hasMouseInteraction=!1,this._hasKeyboardInteraction=!1,this._setListeners()}static get Default(){return xf}static get DefaultType(){return vf}static get NAME(){return"toast"}show(){wp.trigger(this._element,mf).defaultPrevented||(this._clearTimeout(),this._config.animation&&this._element.classList.add("fade"),this._element.classList.remove(ff),Jc(this._element),this._element.classList.add(uf,hf),this._queueCallback((()=>{this._element.classList.remove(hf),wp.trigger(this._element,gf),this._maybeScheduleHide()}),this._element,this._config.animation))}hide(){this.isShown()&&(wp.trigger(this._element,pf).defaultPrevented||(this._element.classList.add(hf),this._queueCallback((()=>{this._element.classList.add(ff),this._element.classList.remove(hf,uf),wp.trigger(this._element,bf)}),this._element,this._config.animation)))}dispose(){this._clearTimeout(),this.isShown()&&this._element.classList.remove(uf),super.dispose()}isShown(){return this._element.classList.contains(uf)}_maybeScheduleHide(){this._config.autohide&&(this._hasMouseInteraction||this._hasKeyboardInteraction||(this._timeout=setTimeout((()=>{this.hide()}),this._config.delay)))}_onInteraction(t,e){switch(t.type){case"mouseover":case"mouseout":this._hasMouseInteraction=e;break;case"focusin":case"focusout":this._hasKeyboardInteraction=e}if(e)return void this._clearTimeout();const r=t.relatedTarget;this._element===r||this._element.contains(r)||this._maybeScheduleHide()}_setListeners(){wp.on(this._element,sf,(t=>this._onInteraction(t,!0))),wp.on(this._element,lf,(t=>this._onInteraction(t,!1))),wp.on(this._element,df,(t=>this._onInteraction(t,!0))),wp.on(this._element,cf,(t=>this._onInteraction(t,!1)))}_clearTimeout(){clearTimeout(this._timeout),this._timeout=null}static jQueryInterface(t){return this.each((function(){const e=wf.getOrCreateInstance(this,t);if("string"==typeof t){if(void 0===e[t])throw new TypeError(`No method named "${t}"`);e[t](this)}}))}}Cp(wf),ep(wf),r(277),((...t)=>{const e=(ii||(ii=mo(ni))).createApp(...t),{mount:r}=e;return e.mount=t=>{const o=function(t){if(x(t))return document.querySelector(t);return t}(t);if(!o)return;const n=e._component;v(n)||n.render||n.template||(n.template=o.innerHTML),1===o.nodeType&&(o.textContent="");const i=r(o,!1,function(t){return t instanceof SVGElement?"svg":"function"==typeof MathMLElement&&t instanceof MathMLElement?"mathml":void 0}(o));return o instanceof Element&&(o.removeAttribute("v-cloak"),o.setAttribute("data-v-app","")),i},e})(dd).mount("#app")})()})();
\ No newline at end of file
+(()=>{var t={261:(t,e,r)=>{"use strict";r.r(e),r.d(e,{default:()=>K});var o=r(601),n=r.n(o),i=r(314),a=r.n(i),s=r(417),l=r.n(s),d=new URL(r(531),r.b),c=new URL(r(115),r.b),p=new URL(r(419),r.b),b=new URL(r(385),r.b),m=new URL(r(274),r.b),g=new URL(r(154),r.b),f=new URL(r(782),r.b),u=new URL(r(718),r.b),h=new URL(r(734),r.b),v=new URL(r(487),r.b),x=new URL(r(372),r.b),w=new URL(r(247),r.b),y=new URL(r(366),r.b),_=new URL(r(326),r.b),k=new URL(r(210),r.b),E=new URL(r(690),r.b),A=new URL(r(249),r.b),S=new URL(r(932),r.b),T=new URL(r(144),r.b),O=a()(n()),C=l()(d),j=l()(c),z=l()(p),L=l()(b),R=l()(m),P=l()(g),D=l()(f),M=l()(u),N=l()(h),I=l()(v),B=l()(x),F=l()(w),$=l()(y),U=l()(_),V=l()(k),W=l()(E),H=l()(A),q=l()(S),G=l()(T);O.push([t.id,`@charset "UTF-8";/*!\n * Bootstrap  v5.3.3 (https://getbootstrap.com/)\n * Copyright 2011-2024 The Bootstrap Authors\n * Licensed under MIT (https://github.com/twbs/bootstrap/blob/main/LICENSE)\n */:root,[data-bs-theme=light]{--bs-blue:#0d6efd;--bs-indigo:#6610f2;--bs-purple:#6f42c1;--bs-pink:#d63384;--bs-red:#dc3545;--bs-orange:#fd7e14;--bs-yellow:#ffc107;--bs-green:#198754;--bs-teal:#20c997;--bs-cyan:#0dcaf0;--bs-black:#000;--bs-white:#fff;--bs-gray:#6c757d;--bs-gray-dark:#343a40;--bs-gray-100:#f8f9fa;--bs-gray-200:#e9ecef;--bs-gray-300:#dee2e6;--bs-gray-400:#ced4da;--bs-gray-500:#adb5bd;--bs-gray-600:#6c757d;--bs-gray-700:#495057;--bs-gray-800:#343a40;--bs-gray-900:#212529;--bs-primary:#0d6efd;--bs-secondary:#6c757d;--bs-success:#198754;--bs-info:#0dcaf0;--bs-warning:#ffc107;--bs-danger:#dc3545;--bs-light:#f8f9fa;--bs-dark:#212529;--bs-primary-rgb:13,110,253;--bs-secondary-rgb:108,117,125;--bs-success-rgb:25,135,84;--bs-info-rgb:13,202,240;--bs-warning-rgb:255,193,7;--bs-danger-rgb:220,53,69;--bs-light-rgb:248,249,250;--bs-dark-rgb:33,37,41;--bs-primary-text-emphasis:#052c65;--bs-secondary-text-emphasis:#2b2f32;--bs-success-text-emphasis:#0a3622;--bs-info-text-emphasis:#055160;--bs-warning-text-emphasis:#664d03;--bs-danger-text-emphasis:#58151c;--bs-light-text-emphasis:#495057;--bs-dark-text-emphasis:#495057;--bs-primary-bg-subtle:#cfe2ff;--bs-secondary-bg-subtle:#e2e3e5;--bs-success-bg-subtle:#d1e7dd;--bs-info-bg-subtle:#cff4fc;--bs-warning-bg-subtle:#fff3cd;--bs-danger-bg-subtle:#f8d7da;--bs-light-bg-subtle:#fcfcfd;--bs-dark-bg-subtle:#ced4da;--bs-primary-border-subtle:#9ec5fe;--bs-secondary-border-subtle:#c4c8cb;--bs-success-border-subtle:#a3cfbb;--bs-info-border-subtle:#9eeaf9;--bs-warning-border-subtle:#ffe69c;--bs-danger-border-subtle:#f1aeb5;--bs-light-border-subtle:#e9ecef;--bs-dark-border-subtle:#adb5bd;--bs-white-rgb:255,255,255;--bs-black-rgb:0,0,0;--bs-font-sans-serif:system-ui,-apple-system,"Segoe UI",Roboto,"Helvetica Neue","Noto Sans","Liberation Sans",Arial,sans-serif,"Apple Color Emoji","Segoe UI Emoji","Segoe UI Symbol","Noto Color Emoji";--bs-font-monospace:SFMono-Regular,Menlo,Monaco,Consolas,"Liberation Mono","Courier New",monospace;--bs-gradient:linear-gradient(180deg, rgba(255, 255, 255, 0.15), rgba(255, 255, 255, 0));--bs-body-font-family:var(--bs-font-sans-serif);--bs-body-font-size:1rem;--bs-body-font-weight:400;--bs-body-line-height:1.5;--bs-body-color:#212529;--bs-body-color-rgb:33,37,41;--bs-body-bg:#fff;--bs-body-bg-rgb:255,255,255;--bs-emphasis-color:#000;--bs-emphasis-color-rgb:0,0,0;--bs-secondary-color:rgba(33, 37, 41, 0.75);--bs-secondary-color-rgb:33,37,41;--bs-secondary-bg:#e9ecef;--bs-secondary-bg-rgb:233,236,239;--bs-tertiary-color:rgba(33, 37, 41, 0.5);--bs-tertiary-color-rgb:33,37,41;--bs-tertiary-bg:#f8f9fa;--bs-tertiary-bg-rgb:248,249,250;--bs-heading-color:inherit;--bs-link-color:#0d6efd;--bs-link-color-rgb:13,110,253;--bs-link-decoration:underline;--bs-link-hover-color:#0a58ca;--bs-link-hover-color-rgb:10,88,202;--bs-code-color:#d63384;--bs-highlight-color:#212529;--bs-highlight-bg:#fff3cd;--bs-border-width:1px;--bs-border-style:solid;--bs-border-color:#dee2e6;--bs-border-color-translucent:rgba(0, 0, 0, 0.175);--bs-border-radius:0.375rem;--bs-border-radius-sm:0.25rem;--bs-border-radius-lg:0.5rem;--bs-border-radius-xl:1rem;--bs-border-radius-xxl:2rem;--bs-border-radius-2xl:var(--bs-border-radius-xxl);--bs-border-radius-pill:50rem;--bs-box-shadow:0 0.5rem 1rem rgba(0, 0, 0, 0.15);--bs-box-shadow-sm:0 0.125rem 0.25rem rgba(0, 0, 0, 0.075);--bs-box-shadow-lg:0 1rem 3rem rgba(0, 0, 0, 0.175);--bs-box-shadow-inset:inset 0 1px 2px rgba(0, 0, 0, 0.075);--bs-focus-ring-width:0.25rem;--bs-focus-ring-opacity:0.25;--bs-focus-ring-color:rgba(13, 110, 253, 0.25);--bs-form-valid-color:#198754;--bs-form-valid-border-color:#198754;--bs-form-invalid-color:#dc3545;--bs-form-invalid-border-color:#dc3545}[data-bs-theme=dark]{color-scheme:dark;--bs-body-color:#dee2e6;--bs-body-color-rgb:222,226,230;--bs-body-bg:#212529;--bs-body-bg-rgb:33,37,41;--bs-emphasis-color:#fff;--bs-emphasis-color-rgb:255,255,255;--bs-secondary-color:rgba(222, 226, 230, 0.75);--bs-secondary-color-rgb:222,226,230;--bs-secondary-bg:#343a40;--bs-secondary-bg-rgb:52,58,64;--bs-tertiary-color:rgba(222, 226, 230, 0.5);--bs-tertiary-color-rgb:222,226,230;--bs-tertiary-bg:#2b3035;--bs-tertiary-bg-rgb:43,48,53;--bs-primary-text-emphasis:#6ea8fe;--bs-secondary-text-emphasis:#a7acb1;--bs-success-text-emphasis:#75b798;--bs-info-text-emphasis:#6edff6;--bs-warning-text-emphasis:#ffda6a;--bs-danger-text-emphasis:#ea868f;--bs-light-text-emphasis:#f8f9fa;--bs-dark-text-emphasis:#dee2e6;--bs-primary-bg-subtle:#031633;--bs-secondary-bg-subtle:#161719;--bs-success-bg-subtle:#051b11;--bs-info-bg-subtle:#032830;--bs-warning-bg-subtle:#332701;--bs-danger-bg-subtle:#2c0b0e;--bs-light-bg-subtle:#343a40;--bs-dark-bg-subtle:#1a1d20;--bs-primary-border-subtle:#084298;--bs-secondary-border-subtle:#41464b;--bs-success-border-subtle:#0f5132;--bs-info-border-subtle:#087990;--bs-warning-border-subtle:#997404;--bs-danger-border-subtle:#842029;--bs-light-border-subtle:#495057;--bs-dark-border-subtle:#343a40;--bs-heading-color:inherit;--bs-link-color:#6ea8fe;--bs-link-hover-color:#8bb9fe;--bs-link-color-rgb:110,168,254;--bs-link-hover-color-rgb:139,185,254;--bs-code-color:#e685b5;--bs-highlight-color:#dee2e6;--bs-highlight-bg:#664d03;--bs-border-color:#495057;--bs-border-color-translucent:rgba(255, 255, 255, 0.15);--bs-form-valid-color:#75b798;--bs-form-valid-border-color:#75b798;--bs-form-invalid-color:#ea868f;--bs-form-invalid-border-color:#ea868f}*,::after,::before{box-sizing:border-box}@media (prefers-reduced-motion:no-preference){:root{scroll-behavior:smooth}}body{margin:0;font-family:var(--bs-body-font-family);font-size:var(--bs-body-font-size);font-weight:var(--bs-body-font-weight);line-height:var(--bs-body-line-height);color:var(--bs-body-color);text-align:var(--bs-body-text-align);background-color:var(--bs-body-bg);-webkit-text-size-adjust:100%;-webkit-tap-highlight-color:transparent}hr{margin:1rem 0;color:inherit;border:0;border-top:var(--bs-border-width) solid;opacity:.25}.h1,.h2,.h3,.h4,.h5,.h6,h1,h2,h3,h4,h5,h6{margin-top:0;margin-bottom:.5rem;font-weight:500;line-height:1.2;color:var(--bs-heading-color)}.h1,h1{font-size:calc(1.375rem + 1.5vw)}@media (min-width:1200px){.h1,h1{font-size:2.5rem}}.h2,h2{font-size:calc(1.325rem + .9vw)}@media (min-width:1200px){.h2,h2{font-size:2rem}}.h3,h3{font-size:calc(1.3rem + .6vw)}@media (min-width:1200px){.h3,h3{font-size:1.75rem}}.h4,h4{font-size:calc(1.275rem + .3vw)}@media (min-width:1200px){.h4,h4{font-size:1.5rem}}.h5,h5{font-size:1.25rem}.h6,h6{font-size:1rem}p{margin-top:0;margin-bottom:1rem}abbr[title]{-webkit-text-decoration:underline dotted;text-decoration:underline dotted;cursor:help;-webkit-text-decoration-skip-ink:none;text-decoration-skip-ink:none}address{margin-bottom:1rem;font-style:normal;line-height:inherit}ol,ul{padding-left:2rem}dl,ol,ul{margin-top:0;margin-bottom:1rem}ol ol,ol ul,ul ol,ul ul{margin-bottom:0}dt{font-weight:700}dd{margin-bottom:.5rem;margin-left:0}blockquote{margin:0 0 1rem}b,strong{font-weight:bolder}.small,small{font-size:.875em}.mark,mark{padding:.1875em;color:var(--bs-highlight-color);background-color:var(--bs-highlight-bg)}sub,sup{position:relative;font-size:.75em;line-height:0;vertical-align:baseline}sub{bottom:-.25em}sup{top:-.5em}a{color:rgba(var(--bs-link-color-rgb),var(--bs-link-opacity,1));text-decoration:underline}a:hover{--bs-link-color-rgb:var(--bs-link-hover-color-rgb)}a:not([href]):not([class]),a:not([href]):not([class]):hover{color:inherit;text-decoration:none}code,kbd,pre,samp{font-family:var(--bs-font-monospace);font-size:1em}pre{display:block;margin-top:0;margin-bottom:1rem;overflow:auto;font-size:.875em}pre code{font-size:inherit;color:inherit;word-break:normal}code{font-size:.875em;color:var(--bs-code-color);word-wrap:break-word}a>code{color:inherit}kbd{padding:.1875rem .375rem;font-size:.875em;color:var(--bs-body-bg);background-color:var(--bs-body-color);border-radius:.25rem}kbd kbd{padding:0;font-size:1em}figure{margin:0 0 1rem}img,svg{vertical-align:middle}table{caption-side:bottom;border-collapse:collapse}caption{padding-top:.5rem;padding-bottom:.5rem;color:var(--bs-secondary-color);text-align:left}th{text-align:inherit;text-align:-webkit-match-parent}tbody,td,tfoot,th,thead,tr{border-color:inherit;border-style:solid;border-width:0}label{display:inline-block}button{border-radius:0}button:focus:not(:focus-visible){outline:0}button,input,optgroup,select,textarea{margin:0;font-family:inherit;font-size:inherit;line-height:inherit}button,select{text-transform:none}[role=button]{cursor:pointer}select{word-wrap:normal}select:disabled{opacity:1}[list]:not([type=date]):not([type=datetime-local]):not([type=month]):not([type=week]):not([type=time])::-webkit-calendar-picker-indicator{display:none!important}[type=button],[type=reset],[type=submit],button{-webkit-appearance:button}[type=button]:not(:disabled),[type=reset]:not(:disabled),[type=submit]:not(:disabled),button:not(:disabled){cursor:pointer}::-moz-focus-inner{padding:0;border-style:none}textarea{resize:vertical}fieldset{min-width:0;padding:0;margin:0;border:0}legend{float:left;width:100%;padding:0;margin-bottom:.5rem;font-size:calc(1.275rem + .3vw);line-height:inherit}@media (min-width:1200px){legend{font-size:1.5rem}}legend+*{clear:left}::-webkit-datetime-edit-day-field,::-webkit-datetime-edit-fields-wrapper,::-webkit-datetime-edit-hour-field,::-webkit-datetime-edit-minute,::-webkit-datetime-edit-month-field,::-webkit-datetime-edit-text,::-webkit-datetime-edit-year-field{padding:0}::-webkit-inner-spin-button{height:auto}[type=search]{-webkit-appearance:textfield;outline-offset:-2px}::-webkit-search-decoration{-webkit-appearance:none}::-webkit-color-swatch-wrapper{padding:0}::-webkit-file-upload-button{font:inherit;-webkit-appearance:button}::file-selector-button{font:inherit;-webkit-appearance:button}output{display:inline-block}iframe{border:0}summary{display:list-item;cursor:pointer}progress{vertical-align:baseline}[hidden]{display:none!important}.lead{font-size:1.25rem;font-weight:300}.display-1{font-size:calc(1.625rem + 4.5vw);font-weight:300;line-height:1.2}@media (min-width:1200px){.display-1{font-size:5rem}}.display-2{font-size:calc(1.575rem + 3.9vw);font-weight:300;line-height:1.2}@media (min-width:1200px){.display-2{font-size:4.5rem}}.display-3{font-size:calc(1.525rem + 3.3vw);font-weight:300;line-height:1.2}@media (min-width:1200px){.display-3{font-size:4rem}}.display-4{font-size:calc(1.475rem + 2.7vw);font-weight:300;line-height:1.2}@media (min-width:1200px){.display-4{font-size:3.5rem}}.display-5{font-size:calc(1.425rem + 2.1vw);font-weight:300;line-height:1.2}@media (min-width:1200px){.display-5{font-size:3rem}}.display-6{font-size:calc(1.375rem + 1.5vw);font-weight:300;line-height:1.2}@media (min-width:1200px){.display-6{font-size:2.5rem}}.list-unstyled{padding-left:0;list-style:none}.list-inline{padding-left:0;list-style:none}.list-inline-item{display:inline-block}.list-inline-item:not(:last-child){margin-right:.5rem}.initialism{font-size:.875em;text-transform:uppercase}.blockquote{margin-bottom:1rem;font-size:1.25rem}.blockquote>:last-child{margin-bottom:0}.blockquote-footer{margin-top:-1rem;margin-bottom:1rem;font-size:.875em;color:#6c757d}.blockquote-footer::before{content:"— "}.img-fluid{max-width:100%;height:auto}.img-thumbnail{padding:.25rem;background-color:var(--bs-body-bg);border:var(--bs-border-width) solid var(--bs-border-color);border-radius:var(--bs-border-radius);max-width:100%;height:auto}.figure{display:inline-block}.figure-img{margin-bottom:.5rem;line-height:1}.figure-caption{font-size:.875em;color:var(--bs-secondary-color)}.container,.container-fluid,.container-lg,.container-md,.container-sm,.container-xl,.container-xxl{--bs-gutter-x:1.5rem;--bs-gutter-y:0;width:100%;padding-right:calc(var(--bs-gutter-x) * .5);padding-left:calc(var(--bs-gutter-x) * .5);margin-right:auto;margin-left:auto}@media (min-width:576px){.container,.container-sm{max-width:540px}}@media (min-width:768px){.container,.container-md,.container-sm{max-width:720px}}@media (min-width:992px){.container,.container-lg,.container-md,.container-sm{max-width:960px}}@media (min-width:1200px){.container,.container-lg,.container-md,.container-sm,.container-xl{max-width:1140px}}@media (min-width:1400px){.container,.container-lg,.container-md,.container-sm,.container-xl,.container-xxl{max-width:1320px}}:root{--bs-breakpoint-xs:0;--bs-breakpoint-sm:576px;--bs-breakpoint-md:768px;--bs-breakpoint-lg:992px;--bs-breakpoint-xl:1200px;--bs-breakpoint-xxl:1400px}.row{--bs-gutter-x:1.5rem;--bs-gutter-y:0;display:flex;flex-wrap:wrap;margin-top:calc(-1 * var(--bs-gutter-y));margin-right:calc(-.5 * var(--bs-gutter-x));margin-left:calc(-.5 * var(--bs-gutter-x))}.row>*{flex-shrink:0;width:100%;max-width:100%;padding-right:calc(var(--bs-gutter-x) * .5);padding-left:calc(var(--bs-gutter-x) * .5);margin-top:var(--bs-gutter-y)}.col{flex:1 0 0%}.row-cols-auto>*{flex:0 0 auto;width:auto}.row-cols-1>*{flex:0 0 auto;width:100%}.row-cols-2>*{flex:0 0 auto;width:50%}.row-cols-3>*{flex:0 0 auto;width:33.33333333%}.row-cols-4>*{flex:0 0 auto;width:25%}.row-cols-5>*{flex:0 0 auto;width:20%}.row-cols-6>*{flex:0 0 auto;width:16.66666667%}.col-auto{flex:0 0 auto;width:auto}.col-1{flex:0 0 auto;width:8.33333333%}.col-2{flex:0 0 auto;width:16.66666667%}.col-3{flex:0 0 auto;width:25%}.col-4{flex:0 0 auto;width:33.33333333%}.col-5{flex:0 0 auto;width:41.66666667%}.col-6{flex:0 0 auto;width:50%}.col-7{flex:0 0 auto;width:58.33333333%}.col-8{flex:0 0 auto;width:66.66666667%}.col-9{flex:0 0 auto;width:75%}.col-10{flex:0 0 auto;width:83.33333333%}.col-11{flex:0 0 auto;width:91.66666667%}.col-12{flex:0 0 auto;width:100%}.offset-1{margin-left:8.33333333%}.offset-2{margin-left:16.66666667%}.offset-3{margin-left:25%}.offset-4{margin-left:33.33333333%}.offset-5{margin-left:41.66666667%}.offset-6{margin-left:50%}.offset-7{margin-left:58.33333333%}.offset-8{margin-left:66.66666667%}.offset-9{margin-left:75%}.offset-10{margin-left:83.33333333%}.offset-11{margin-left:91.66666667%}.g-0,.gx-0{--bs-gutter-x:0}.g-0,.gy-0{--bs-gutter-y:0}.g-1,.gx-1{--bs-gutter-x:0.25rem}.g-1,.gy-1{--bs-gutter-y:0.25rem}.g-2,.gx-2{--bs-gutter-x:0.5rem}.g-2,.gy-2{--bs-gutter-y:0.5rem}.g-3,.gx-3{--bs-gutter-x:1rem}.g-3,.gy-3{--bs-gutter-y:1rem}.g-4,.gx-4{--bs-gutter-x:1.5rem}.g-4,.gy-4{--bs-gutter-y:1.5rem}.g-5,.gx-5{--bs-gutter-x:3rem}.g-5,.gy-5{--bs-gutter-y:3rem}@media (min-width:576px){.col-sm{flex:1 0 0%}.row-cols-sm-auto>*{flex:0 0 auto;width:auto}.row-cols-sm-1>*{flex:0 0 auto;width:100%}.row-cols-sm-2>*{flex:0 0 auto;width:50%}.row-cols-sm-3>*{flex:0 0 auto;width:33.33333333%}.row-cols-sm-4>*{flex:0 0 auto;width:25%}.row-cols-sm-5>*{flex:0 0 auto;width:20%}.row-cols-sm-6>*{flex:0 0 auto;width:16.66666667%}.col-sm-auto{flex:0 0 auto;width:auto}.col-sm-1{flex:0 0 auto;width:8.33333333%}.col-sm-2{flex:0 0 auto;width:16.66666667%}.col-sm-3{flex:0 0 auto;width:25%}.col-sm-4{flex:0 0 auto;width:33.33333333%}.col-sm-5{flex:0 0 auto;width:41.66666667%}.col-sm-6{flex:0 0 auto;width:50%}.col-sm-7{flex:0 0 auto;width:58.33333333%}.col-sm-8{flex:0 0 auto;width:66.66666667%}.col-sm-9{flex:0 0 auto;width:75%}.col-sm-10{flex:0 0 auto;width:83.33333333%}.col-sm-11{flex:0 0 auto;width:91.66666667%}.col-sm-12{flex:0 0 auto;width:100%}.offset-sm-0{margin-left:0}.offset-sm-1{margin-left:8.33333333%}.offset-sm-2{margin-left:16.66666667%}.offset-sm-3{margin-left:25%}.offset-sm-4{margin-left:33.33333333%}.offset-sm-5{margin-left:41.66666667%}.offset-sm-6{margin-left:50%}.offset-sm-7{margin-left:58.33333333%}.offset-sm-8{margin-left:66.66666667%}.offset-sm-9{margin-left:75%}.offset-sm-10{margin-left:83.33333333%}.offset-sm-11{margin-left:91.66666667%}.g-sm-0,.gx-sm-0{--bs-gutter-x:0}.g-sm-0,.gy-sm-0{--bs-gutter-y:0}.g-sm-1,.gx-sm-1{--bs-gutter-x:0.25rem}.g-sm-1,.gy-sm-1{--bs-gutter-y:0.25rem}.g-sm-2,.gx-sm-2{--bs-gutter-x:0.5rem}.g-sm-2,.gy-sm-2{--bs-gutter-y:0.5rem}.g-sm-3,.gx-sm-3{--bs-gutter-x:1rem}.g-sm-3,.gy-sm-3{--bs-gutter-y:1rem}.g-sm-4,.gx-sm-4{--bs-gutter-x:1.5rem}.g-sm-4,.gy-sm-4{--bs-gutter-y:1.5rem}.g-sm-5,.gx-sm-5{--bs-gutter-x:3rem}.g-sm-5,.gy-sm-5{--bs-gutter-y:3rem}}@media (min-width:768px){.col-md{flex:1 0 0%}.row-cols-md-auto>*{flex:0 0 auto;width:auto}.row-cols-md-1>*{flex:0 0 auto;width:100%}.row-cols-md-2>*{flex:0 0 auto;width:50%}.row-cols-md-3>*{flex:0 0 auto;width:33.33333333%}.row-cols-md-4>*{flex:0 0 auto;width:25%}.row-cols-md-5>*{flex:0 0 auto;width:20%}.row-cols-md-6>*{flex:0 0 auto;width:16.66666667%}.col-md-auto{flex:0 0 auto;width:auto}.col-md-1{flex:0 0 auto;width:8.33333333%}.col-md-2{flex:0 0 auto;width:16.66666667%}.col-md-3{flex:0 0 auto;width:25%}.col-md-4{flex:0 0 auto;width:33.33333333%}.col-md-5{flex:0 0 auto;width:41.66666667%}.col-md-6{flex:0 0 auto;width:50%}.col-md-7{flex:0 0 auto;width:58.33333333%}.col-md-8{flex:0 0 auto;width:66.66666667%}.col-md-9{flex:0 0 auto;width:75%}.col-md-10{flex:0 0 auto;width:83.33333333%}.col-md-11{flex:0 0 auto;width:91.66666667%}.col-md-12{flex:0 0 auto;width:100%}.offset-md-0{margin-left:0}.offset-md-1{margin-left:8.33333333%}.offset-md-2{margin-left:16.66666667%}.offset-md-3{margin-left:25%}.offset-md-4{margin-left:33.33333333%}.offset-md-5{margin-left:41.66666667%}.offset-md-6{margin-left:50%}.offset-md-7{margin-left:58.33333333%}.offset-md-8{margin-left:66.66666667%}.offset-md-9{margin-left:75%}.offset-md-10{margin-left:83.33333333%}.offset-md-11{margin-left:91.66666667%}.g-md-0,.gx-md-0{--bs-gutter-x:0}.g-md-0,.gy-md-0{--bs-gutter-y:0}.g-md-1,.gx-md-1{--bs-gutter-x:0.25rem}.g-md-1,.gy-md-1{--bs-gutter-y:0.25rem}.g-md-2,.gx-md-2{--bs-gutter-x:0.5rem}.g-md-2,.gy-md-2{--bs-gutter-y:0.5rem}.g-md-3,.gx-md-3{--bs-gutter-x:1rem}.g-md-3,.gy-md-3{--bs-gutter-y:1rem}.g-md-4,.gx-md-4{--bs-gutter-x:1.5rem}.g-md-4,.gy-md-4{--bs-gutter-y:1.5rem}.g-md-5,.gx-md-5{--bs-gutter-x:3rem}.g-md-5,.gy-md-5{--bs-gutter-y:3rem}}@media (min-width:992px){.col-lg{flex:1 0 0%}.row-cols-lg-auto>*{flex:0 0 auto;width:auto}.row-cols-lg-1>*{flex:0 0 auto;width:100%}.row-cols-lg-2>*{flex:0 0 auto;width:50%}.row-cols-lg-3>*{flex:0 0 auto;width:33.33333333%}.row-cols-lg-4>*{flex:0 0 auto;width:25%}.row-cols-lg-5>*{flex:0 0 auto;width:20%}.row-cols-lg-6>*{flex:0 0 auto;width:16.66666667%}.col-lg-auto{flex:0 0 auto;width:auto}.col-lg-1{flex:0 0 auto;width:8.33333333%}.col-lg-2{flex:0 0 auto;width:16.66666667%}.col-lg-3{flex:0 0 auto;width:25%}.col-lg-4{flex:0 0 auto;width:33.33333333%}.col-lg-5{flex:0 0 auto;width:41.66666667%}.col-lg-6{flex:0 0 auto;width:50%}.col-lg-7{flex:0 0 auto;width:58.33333333%}.col-lg-8{flex:0 0 auto;width:66.66666667%}.col-lg-9{flex:0 0 auto;width:75%}.col-lg-10{flex:0 0 auto;width:83.33333333%}.col-lg-11{flex:0 0 auto;width:91.66666667%}.col-lg-12{flex:0 0 auto;width:100%}.offset-lg-0{margin-left:0}.offset-lg-1{margin-left:8.33333333%}.offset-lg-2{margin-left:16.66666667%}.offset-lg-3{margin-left:25%}.offset-lg-4{margin-left:33.33333333%}.offset-lg-5{margin-left:41.66666667%}.offset-lg-6{margin-left:50%}.offset-lg-7{margin-left:58.33333333%}.offset-lg-8{margin-left:66.66666667%}.offset-lg-9{margin-left:75%}.offset-lg-10{margin-left:83.33333333%}.offset-lg-11{margin-left:91.66666667%}.g-lg-0,.gx-lg-0{--bs-gutter-x:0}.g-lg-0,.gy-lg-0{--bs-gutter-y:0}.g-lg-1,.gx-lg-1{--bs-gutter-x:0.25rem}.g-lg-1,.gy-lg-1{--bs-gutter-y:0.25rem}.g-lg-2,.gx-lg-2{--bs-gutter-x:0.5rem}.g-lg-2,.gy-lg-2{--bs-gutter-y:0.5rem}.g-lg-3,.gx-lg-3{--bs-gutter-x:1rem}.g-lg-3,.gy-lg-3{--bs-gutter-y:1rem}.g-lg-4,.gx-lg-4{--bs-gutter-x:1.5rem}.g-lg-4,.gy-lg-4{--bs-gutter-y:1.5rem}.g-lg-5,.gx-lg-5{--bs-gutter-x:3rem}.g-lg-5,.gy-lg-5{--bs-gutter-y:3rem}}@media (min-width:1200px){.col-xl{flex:1 0 0%}.row-cols-xl-auto>*{flex:0 0 auto;width:auto}.row-cols-xl-1>*{flex:0 0 auto;width:100%}.row-cols-xl-2>*{flex:0 0 auto;width:50%}.row-cols-xl-3>*{flex:0 0 auto;width:33.33333333%}.row-cols-xl-4>*{flex:0 0 auto;width:25%}.row-cols-xl-5>*{flex:0 0 auto;width:20%}.row-cols-xl-6>*{flex:0 0 auto;width:16.66666667%}.col-xl-auto{flex:0 0 auto;width:auto}.col-xl-1{flex:0 0 auto;width:8.33333333%}.col-xl-2{flex:0 0 auto;width:16.66666667%}.col-xl-3{flex:0 0 auto;width:25%}.col-xl-4{flex:0 0 auto;width:33.33333333%}.col-xl-5{flex:0 0 auto;width:41.66666667%}.col-xl-6{flex:0 0 auto;width:50%}.col-xl-7{flex:0 0 auto;width:58.33333333%}.col-xl-8{flex:0 0 auto;width:66.66666667%}.col-xl-9{flex:0 0 auto;width:75%}.col-xl-10{flex:0 0 auto;width:83.33333333%}.col-xl-11{flex:0 0 auto;width:91.66666667%}.col-xl-12{flex:0 0 auto;width:100%}.offset-xl-0{margin-left:0}.offset-xl-1{margin-left:8.33333333%}.offset-xl-2{margin-left:16.66666667%}.offset-xl-3{margin-left:25%}.offset-xl-4{margin-left:33.33333333%}.offset-xl-5{margin-left:41.66666667%}.offset-xl-6{margin-left:50%}.offset-xl-7{margin-left:58.33333333%}.offset-xl-8{margin-left:66.66666667%}.offset-xl-9{margin-left:75%}.offset-xl-10{margin-left:83.33333333%}.offset-xl-11{margin-left:91.66666667%}.g-xl-0,.gx-xl-0{--bs-gutter-x:0}.g-xl-0,.gy-xl-0{--bs-gutter-y:0}.g-xl-1,.gx-xl-1{--bs-gutter-x:0.25rem}.g-xl-1,.gy-xl-1{--bs-gutter-y:0.25rem}.g-xl-2,.gx-xl-2{--bs-gutter-x:0.5rem}.g-xl-2,.gy-xl-2{--bs-gutter-y:0.5rem}.g-xl-3,.gx-xl-3{--bs-gutter-x:1rem}.g-xl-3,.gy-xl-3{--bs-gutter-y:1rem}.g-xl-4,.gx-xl-4{--bs-gutter-x:1.5rem}.g-xl-4,.gy-xl-4{--bs-gutter-y:1.5rem}.g-xl-5,.gx-xl-5{--bs-gutter-x:3rem}.g-xl-5,.gy-xl-5{--bs-gutter-y:3rem}}@media (min-width:1400px){.col-xxl{flex:1 0 0%}.row-cols-xxl-auto>*{flex:0 0 auto;width:auto}.row-cols-xxl-1>*{flex:0 0 auto;width:100%}.row-cols-xxl-2>*{flex:0 0 auto;width:50%}.row-cols-xxl-3>*{flex:0 0 auto;width:33.33333333%}.row-cols-xxl-4>*{flex:0 0 auto;width:25%}.row-cols-xxl-5>*{flex:0 0 auto;width:20%}.row-cols-xxl-6>*{flex:0 0 auto;width:16.66666667%}.col-xxl-auto{flex:0 0 auto;width:auto}.col-xxl-1{flex:0 0 auto;width:8.33333333%}.col-xxl-2{flex:0 0 auto;width:16.66666667%}.col-xxl-3{flex:0 0 auto;width:25%}.col-xxl-4{flex:0 0 auto;width:33.33333333%}.col-xxl-5{flex:0 0 auto;width:41.66666667%}.col-xxl-6{flex:0 0 auto;width:50%}.col-xxl-7{flex:0 0 auto;width:58.33333333%}.col-xxl-8{flex:0 0 auto;width:66.66666667%}.col-xxl-9{flex:0 0 auto;width:75%}.col-xxl-10{flex:0 0 auto;width:83.33333333%}.col-xxl-11{flex:0 0 auto;width:91.66666667%}.col-xxl-12{flex:0 0 auto;width:100%}.offset-xxl-0{margin-left:0}.offset-xxl-1{margin-left:8.33333333%}.offset-xxl-2{margin-left:16.66666667%}.offset-xxl-3{margin-left:25%}.offset-xxl-4{margin-left:33.33333333%}.offset-xxl-5{margin-left:41.66666667%}.offset-xxl-6{margin-left:50%}.offset-xxl-7{margin-left:58.33333333%}.offset-xxl-8{margin-left:66.66666667%}.offset-xxl-9{margin-left:75%}.offset-xxl-10{margin-left:83.33333333%}.offset-xxl-11{margin-left:91.66666667%}.g-xxl-0,.gx-xxl-0{--bs-gutter-x:0}.g-xxl-0,.gy-xxl-0{--bs-gutter-y:0}.g-xxl-1,.gx-xxl-1{--bs-gutter-x:0.25rem}.g-xxl-1,.gy-xxl-1{--bs-gutter-y:0.25rem}.g-xxl-2,.gx-xxl-2{--bs-gutter-x:0.5rem}.g-xxl-2,.gy-xxl-2{--bs-gutter-y:0.5rem}.g-xxl-3,.gx-xxl-3{--bs-gutter-x:1rem}.g-xxl-3,.gy-xxl-3{--bs-gutter-y:1rem}.g-xxl-4,.gx-xxl-4{--bs-gutter-x:1.5rem}.g-xxl-4,.gy-xxl-4{--bs-gutter-y:1.5rem}.g-xxl-5,.gx-xxl-5{--bs-gutter-x:3rem}.g-xxl-5,.gy-xxl-5{--bs-gutter-y:3rem}}.table{--bs-table-color-type:initial;--bs-table-bg-type:initial;--bs-table-color-state:initial;--bs-table-bg-state:initial;--bs-table-color:var(--bs-emphasis-color);--bs-table-bg:var(--bs-body-bg);--bs-table-border-color:var(--bs-border-color);--bs-table-accent-bg:transparent;--bs-table-striped-color:var(--bs-emphasis-color);--bs-table-striped-bg:rgba(var(--bs-emphasis-color-rgb), 0.05);--bs-table-active-color:var(--bs-emphasis-color);--bs-table-active-bg:rgba(var(--bs-emphasis-color-rgb), 0.1);--bs-table-hover-color:var(--bs-emphasis-color);--bs-table-hover-bg:rgba(var(--bs-emphasis-color-rgb), 0.075);width:100%;margin-bottom:1rem;vertical-align:top;border-color:var(--bs-table-border-color)}.table>:not(caption)>*>*{padding:.5rem .5rem;color:var(--bs-table-color-state,var(--bs-table-color-type,var(--bs-table-color)));background-color:var(--bs-table-bg);border-bottom-width:var(--bs-border-width);box-shadow:inset 0 0 0 9999px var(--bs-table-bg-state,var(--bs-table-bg-type,var(--bs-table-accent-bg)))}.table>tbody{vertical-align:inherit}.table>thead{vertical-align:bottom}.table-group-divider{border-top:calc(var(--bs-border-width) * 2) solid currentcolor}.caption-top{caption-side:top}.table-sm>:not(caption)>*>*{padding:.25rem .25rem}.table-bordered>:not(caption)>*{border-width:var(--bs-border-width) 0}.table-bordered>:not(caption)>*>*{border-width:0 var(--bs-border-width)}.table-borderless>:not(caption)>*>*{border-bottom-width:0}.table-borderless>:not(:first-child){border-top-width:0}.table-striped>tbody>tr:nth-of-type(odd)>*{--bs-table-color-type:var(--bs-table-striped-color);--bs-table-bg-type:var(--bs-table-striped-bg)}.table-striped-columns>:not(caption)>tr>:nth-child(2n){--bs-table-color-type:var(--bs-table-striped-color);--bs-table-bg-type:var(--bs-table-striped-bg)}.table-active{--bs-table-color-state:var(--bs-table-active-color);--bs-table-bg-state:var(--bs-table-active-bg)}.table-hover>tbody>tr:hover>*{--bs-table-color-state:var(--bs-table-hover-color);--bs-table-bg-state:var(--bs-table-hover-bg)}.table-primary{--bs-table-color:#000;--bs-table-bg:#cfe2ff;--bs-table-border-color:#a6b5cc;--bs-table-striped-bg:#c5d7f2;--bs-table-striped-color:#000;--bs-table-active-bg:#bacbe6;--bs-table-active-color:#000;--bs-table-hover-bg:#bfd1ec;--bs-table-hover-color:#000;color:var(--bs-table-color);border-color:var(--bs-table-border-color)}.table-secondary{--bs-table-color:#000;--bs-table-bg:#e2e3e5;--bs-table-border-color:#b5b6b7;--bs-table-striped-bg:#d7d8da;--bs-table-striped-color:#000;--bs-table-active-bg:#cbccce;--bs-table-active-color:#000;--bs-table-hover-bg:#d1d2d4;--bs-table-hover-color:#000;color:var(--bs-table-color);border-color:var(--bs-table-border-color)}.table-success{--bs-table-color:#000;--bs-table-bg:#d1e7dd;--bs-table-border-color:#a7b9b1;--bs-table-striped-bg:#c7dbd2;--bs-table-striped-color:#000;--bs-table-active-bg:#bcd0c7;--bs-table-active-color:#000;--bs-table-hover-bg:#c1d6cc;--bs-table-hover-color:#000;color:var(--bs-table-color);border-color:var(--bs-table-border-color)}.table-info{--bs-table-color:#000;--bs-table-bg:#cff4fc;--bs-table-border-color:#a6c3ca;--bs-table-striped-bg:#c5e8ef;--bs-table-striped-color:#000;--bs-table-active-bg:#badce3;--bs-table-active-color:#000;--bs-table-hover-bg:#bfe2e9;--bs-table-hover-color:#000;color:var(--bs-table-color);border-color:var(--bs-table-border-color)}.table-warning{--bs-table-color:#000;--bs-table-bg:#fff3cd;--bs-table-border-color:#ccc2a4;--bs-table-striped-bg:#f2e7c3;--bs-table-striped-color:#000;--bs-table-active-bg:#e6dbb9;--bs-table-active-color:#000;--bs-table-hover-bg:#ece1be;--bs-table-hover-color:#000;color:var(--bs-table-color);border-color:var(--bs-table-border-color)}.table-danger{--bs-table-color:#000;--bs-table-bg:#f8d7da;--bs-table-border-color:#c6acae;--bs-table-striped-bg:#eccccf;--bs-table-striped-color:#000;--bs-table-active-bg:#dfc2c4;--bs-table-active-color:#000;--bs-table-hover-bg:#e5c7ca;--bs-table-hover-color:#000;color:var(--bs-table-color);border-color:var(--bs-table-border-color)}.table-light{--bs-table-color:#000;--bs-table-bg:#f8f9fa;--bs-table-border-color:#c6c7c8;--bs-table-striped-bg:#ecedee;--bs-table-striped-color:#000;--bs-table-active-bg:#dfe0e1;--bs-table-active-color:#000;--bs-table-hover-bg:#e5e6e7;--bs-table-hover-color:#000;color:var(--bs-table-color);border-color:var(--bs-table-border-color)}.table-dark{--bs-table-color:#fff;--bs-table-bg:#212529;--bs-table-border-color:#4d5154;--bs-table-striped-bg:#2c3034;--bs-table-striped-color:#fff;--bs-table-active-bg:#373b3e;--bs-table-active-color:#fff;--bs-table-hover-bg:#323539;--bs-table-hover-color:#fff;color:var(--bs-table-color);border-color:var(--bs-table-border-color)}.table-responsive{overflow-x:auto;-webkit-overflow-scrolling:touch}@media (max-width:575.98px){.table-responsive-sm{overflow-x:auto;-webkit-overflow-scrolling:touch}}@media (max-width:767.98px){.table-responsive-md{overflow-x:auto;-webkit-overflow-scrolling:touch}}@media (max-width:991.98px){.table-responsive-lg{overflow-x:auto;-webkit-overflow-scrolling:touch}}@media (max-width:1199.98px){.table-responsive-xl{overflow-x:auto;-webkit-overflow-scrolling:touch}}@media (max-width:1399.98px){.table-responsive-xxl{overflow-x:auto;-webkit-overflow-scrolling:touch}}.form-label{margin-bottom:.5rem}.col-form-label{padding-top:calc(.375rem + var(--bs-border-width));padding-bottom:calc(.375rem + var(--bs-border-width));margin-bottom:0;font-size:inherit;line-height:1.5}.col-form-label-lg{padding-top:calc(.5rem + var(--bs-border-width));padding-bottom:calc(.5rem + var(--bs-border-width));font-size:1.25rem}.col-form-label-sm{padding-top:calc(.25rem + var(--bs-border-width));padding-bottom:calc(.25rem + var(--bs-border-width));font-size:.875rem}.form-text{margin-top:.25rem;font-size:.875em;color:var(--bs-secondary-color)}.form-control{display:block;width:100%;padding:.375rem .75rem;font-size:1rem;font-weight:400;line-height:1.5;color:var(--bs-body-color);-webkit-appearance:none;-moz-appearance:none;appearance:none;background-color:var(--bs-body-bg);background-clip:padding-box;border:var(--bs-border-width) solid var(--bs-border-color);border-radius:var(--bs-border-radius);transition:border-color .15s ease-in-out,box-shadow .15s ease-in-out}@media (prefers-reduced-motion:reduce){.form-control{transition:none}}.form-control[type=file]{overflow:hidden}.form-control[type=file]:not(:disabled):not([readonly]){cursor:pointer}.form-control:focus{color:var(--bs-body-color);background-color:var(--bs-body-bg);border-color:#86b7fe;outline:0;box-shadow:0 0 0 .25rem rgba(13,110,253,.25)}.form-control::-webkit-date-and-time-value{min-width:85px;height:1.5em;margin:0}.form-control::-webkit-datetime-edit{display:block;padding:0}.form-control::-moz-placeholder{color:var(--bs-secondary-color);opacity:1}.form-control::placeholder{color:var(--bs-secondary-color);opacity:1}.form-control:disabled{background-color:var(--bs-secondary-bg);opacity:1}.form-control::-webkit-file-upload-button{padding:.375rem .75rem;margin:-.375rem -.75rem;-webkit-margin-end:.75rem;margin-inline-end:.75rem;color:var(--bs-body-color);background-color:var(--bs-tertiary-bg);pointer-events:none;border-color:inherit;border-style:solid;border-width:0;border-inline-end-width:var(--bs-border-width);border-radius:0;-webkit-transition:color .15s ease-in-out,background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out;transition:color .15s ease-in-out,background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out}.form-control::file-selector-button{padding:.375rem .75rem;margin:-.375rem -.75rem;-webkit-margin-end:.75rem;margin-inline-end:.75rem;color:var(--bs-body-color);background-color:var(--bs-tertiary-bg);pointer-events:none;border-color:inherit;border-style:solid;border-width:0;border-inline-end-width:var(--bs-border-width);border-radius:0;transition:color .15s ease-in-out,background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out}@media (prefers-reduced-motion:reduce){.form-control::-webkit-file-upload-button{-webkit-transition:none;transition:none}.form-control::file-selector-button{transition:none}}.form-control:hover:not(:disabled):not([readonly])::-webkit-file-upload-button{background-color:var(--bs-secondary-bg)}.form-control:hover:not(:disabled):not([readonly])::file-selector-button{background-color:var(--bs-secondary-bg)}.form-control-plaintext{display:block;width:100%;padding:.375rem 0;margin-bottom:0;line-height:1.5;color:var(--bs-body-color);background-color:transparent;border:solid transparent;border-width:var(--bs-border-width) 0}.form-control-plaintext:focus{outline:0}.form-control-plaintext.form-control-lg,.form-control-plaintext.form-control-sm{padding-right:0;padding-left:0}.form-control-sm{min-height:calc(1.5em + .5rem + calc(var(--bs-border-width) * 2));padding:.25rem .5rem;font-size:.875rem;border-radius:var(--bs-border-radius-sm)}.form-control-sm::-webkit-file-upload-button{padding:.25rem .5rem;margin:-.25rem -.5rem;-webkit-margin-end:.5rem;margin-inline-end:.5rem}.form-control-sm::file-selector-button{padding:.25rem .5rem;margin:-.25rem -.5rem;-webkit-margin-end:.5rem;margin-inline-end:.5rem}.form-control-lg{min-height:calc(1.5em + 1rem + calc(var(--bs-border-width) * 2));padding:.5rem 1rem;font-size:1.25rem;border-radius:var(--bs-border-radius-lg)}.form-control-lg::-webkit-file-upload-button{padding:.5rem 1rem;margin:-.5rem -1rem;-webkit-margin-end:1rem;margin-inline-end:1rem}.form-control-lg::file-selector-button{padding:.5rem 1rem;margin:-.5rem -1rem;-webkit-margin-end:1rem;margin-inline-end:1rem}textarea.form-control{min-height:calc(1.5em + .75rem + calc(var(--bs-border-width) * 2))}textarea.form-control-sm{min-height:calc(1.5em + .5rem + calc(var(--bs-border-width) * 2))}textarea.form-control-lg{min-height:calc(1.5em + 1rem + calc(var(--bs-border-width) * 2))}.form-control-color{width:3rem;height:calc(1.5em + .75rem + calc(var(--bs-border-width) * 2));padding:.375rem}.form-control-color:not(:disabled):not([readonly]){cursor:pointer}.form-control-color::-moz-color-swatch{border:0!important;border-radius:var(--bs-border-radius)}.form-control-color::-webkit-color-swatch{border:0!important;border-radius:var(--bs-border-radius)}.form-control-color.form-control-sm{height:calc(1.5em + .5rem + calc(var(--bs-border-width) * 2))}.form-control-color.form-control-lg{height:calc(1.5em + 1rem + calc(var(--bs-border-width) * 2))}.form-select{--bs-form-select-bg-img:url(${C});display:block;width:100%;padding:.375rem 2.25rem .375rem .75rem;font-size:1rem;font-weight:400;line-height:1.5;color:var(--bs-body-color);-webkit-appearance:none;-moz-appearance:none;appearance:none;background-color:var(--bs-body-bg);background-image:var(--bs-form-select-bg-img),var(--bs-form-select-bg-icon,none);background-repeat:no-repeat;background-position:right .75rem center;background-size:16px 12px;border:var(--bs-border-width) solid var(--bs-border-color);border-radius:var(--bs-border-radius);transition:border-color .15s ease-in-out,box-shadow .15s ease-in-out}@media (prefers-reduced-motion:reduce){.form-select{transition:none}}.form-select:focus{border-color:#86b7fe;outline:0;box-shadow:0 0 0 .25rem rgba(13,110,253,.25)}.form-select[multiple],.form-select[size]:not([size="1"]){padding-right:.75rem;background-image:none}.form-select:disabled{background-color:var(--bs-secondary-bg)}.form-select:-moz-focusring{color:transparent;text-shadow:0 0 0 var(--bs-body-color)}.form-select-sm{padding-top:.25rem;padding-bottom:.25rem;padding-left:.5rem;font-size:.875rem;border-radius:var(--bs-border-radius-sm)}.form-select-lg{padding-top:.5rem;padding-bottom:.5rem;padding-left:1rem;font-size:1.25rem;border-radius:var(--bs-border-radius-lg)}[data-bs-theme=dark] .form-select{--bs-form-select-bg-img:url(${j})}.form-check{display:block;min-height:1.5rem;padding-left:1.5em;margin-bottom:.125rem}.form-check .form-check-input{float:left;margin-left:-1.5em}.form-check-reverse{padding-right:1.5em;padding-left:0;text-align:right}.form-check-reverse .form-check-input{float:right;margin-right:-1.5em;margin-left:0}.form-check-input{--bs-form-check-bg:var(--bs-body-bg);flex-shrink:0;width:1em;height:1em;margin-top:.25em;vertical-align:top;-webkit-appearance:none;-moz-appearance:none;appearance:none;background-color:var(--bs-form-check-bg);background-image:var(--bs-form-check-bg-image);background-repeat:no-repeat;background-position:center;background-size:contain;border:var(--bs-border-width) solid var(--bs-border-color);-webkit-print-color-adjust:exact;color-adjust:exact;print-color-adjust:exact}.form-check-input[type=checkbox]{border-radius:.25em}.form-check-input[type=radio]{border-radius:50%}.form-check-input:active{filter:brightness(90%)}.form-check-input:focus{border-color:#86b7fe;outline:0;box-shadow:0 0 0 .25rem rgba(13,110,253,.25)}.form-check-input:checked{background-color:#0d6efd;border-color:#0d6efd}.form-check-input:checked[type=checkbox]{--bs-form-check-bg-image:url(${z})}.form-check-input:checked[type=radio]{--bs-form-check-bg-image:url(${L})}.form-check-input[type=checkbox]:indeterminate{background-color:#0d6efd;border-color:#0d6efd;--bs-form-check-bg-image:url(${R})}.form-check-input:disabled{pointer-events:none;filter:none;opacity:.5}.form-check-input:disabled~.form-check-label,.form-check-input[disabled]~.form-check-label{cursor:default;opacity:.5}.form-switch{padding-left:2.5em}.form-switch .form-check-input{--bs-form-switch-bg:url(${P});width:2em;margin-left:-2.5em;background-image:var(--bs-form-switch-bg);background-position:left center;border-radius:2em;transition:background-position .15s ease-in-out}@media (prefers-reduced-motion:reduce){.form-switch .form-check-input{transition:none}}.form-switch .form-check-input:focus{--bs-form-switch-bg:url(${D})}.form-switch .form-check-input:checked{background-position:right center;--bs-form-switch-bg:url(${M})}.form-switch.form-check-reverse{padding-right:2.5em;padding-left:0}.form-switch.form-check-reverse .form-check-input{margin-right:-2.5em;margin-left:0}.form-check-inline{display:inline-block;margin-right:1rem}.btn-check{position:absolute;clip:rect(0,0,0,0);pointer-events:none}.btn-check:disabled+.btn,.btn-check[disabled]+.btn{pointer-events:none;filter:none;opacity:.65}[data-bs-theme=dark] .form-switch .form-check-input:not(:checked):not(:focus){--bs-form-switch-bg:url(${N})}.form-range{width:100%;height:1.5rem;padding:0;-webkit-appearance:none;-moz-appearance:none;appearance:none;background-color:transparent}.form-range:focus{outline:0}.form-range:focus::-webkit-slider-thumb{box-shadow:0 0 0 1px #fff,0 0 0 .25rem rgba(13,110,253,.25)}.form-range:focus::-moz-range-thumb{box-shadow:0 0 0 1px #fff,0 0 0 .25rem rgba(13,110,253,.25)}.form-range::-moz-focus-outer{border:0}.form-range::-webkit-slider-thumb{width:1rem;height:1rem;margin-top:-.25rem;-webkit-appearance:none;appearance:none;background-color:#0d6efd;border:0;border-radius:1rem;-webkit-transition:background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out;transition:background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out}@media (prefers-reduced-motion:reduce){.form-range::-webkit-slider-thumb{-webkit-transition:none;transition:none}}.form-range::-webkit-slider-thumb:active{background-color:#b6d4fe}.form-range::-webkit-slider-runnable-track{width:100%;height:.5rem;color:transparent;cursor:pointer;background-color:var(--bs-secondary-bg);border-color:transparent;border-radius:1rem}.form-range::-moz-range-thumb{width:1rem;height:1rem;-moz-appearance:none;appearance:none;background-color:#0d6efd;border:0;border-radius:1rem;-moz-transition:background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out;transition:background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out}@media (prefers-reduced-motion:reduce){.form-range::-moz-range-thumb{-moz-transition:none;transition:none}}.form-range::-moz-range-thumb:active{background-color:#b6d4fe}.form-range::-moz-range-track{width:100%;height:.5rem;color:transparent;cursor:pointer;background-color:var(--bs-secondary-bg);border-color:transparent;border-radius:1rem}.form-range:disabled{pointer-events:none}.form-range:disabled::-webkit-slider-thumb{background-color:var(--bs-secondary-color)}.form-range:disabled::-moz-range-thumb{background-color:var(--bs-secondary-color)}.form-floating{position:relative}.form-floating>.form-control,.form-floating>.form-control-plaintext,.form-floating>.form-select{height:calc(3.5rem + calc(var(--bs-border-width) * 2));min-height:calc(3.5rem + calc(var(--bs-border-width) * 2));line-height:1.25}.form-floating>label{position:absolute;top:0;left:0;z-index:2;height:100%;padding:1rem .75rem;overflow:hidden;text-align:start;text-overflow:ellipsis;white-space:nowrap;pointer-events:none;border:var(--bs-border-width) solid transparent;transform-origin:0 0;transition:opacity .1s ease-in-out,transform .1s ease-in-out}@media (prefers-reduced-motion:reduce){.form-floating>label{transition:none}}.form-floating>.form-control,.form-floating>.form-control-plaintext{padding:1rem .75rem}.form-floating>.form-control-plaintext::-moz-placeholder,.form-floating>.form-control::-moz-placeholder{color:transparent}.form-floating>.form-control-plaintext::placeholder,.form-floating>.form-control::placeholder{color:transparent}.form-floating>.form-control-plaintext:not(:-moz-placeholder-shown),.form-floating>.form-control:not(:-moz-placeholder-shown){padding-top:1.625rem;padding-bottom:.625rem}.form-floating>.form-control-plaintext:focus,.form-floating>.form-control-plaintext:not(:placeholder-shown),.form-floating>.form-control:focus,.form-floating>.form-control:not(:placeholder-shown){padding-top:1.625rem;padding-bottom:.625rem}.form-floating>.form-control-plaintext:-webkit-autofill,.form-floating>.form-control:-webkit-autofill{padding-top:1.625rem;padding-bottom:.625rem}.form-floating>.form-select{padding-top:1.625rem;padding-bottom:.625rem}.form-floating>.form-control:not(:-moz-placeholder-shown)~label{color:rgba(var(--bs-body-color-rgb),.65);transform:scale(.85) translateY(-.5rem) translateX(.15rem)}.form-floating>.form-control-plaintext~label,.form-floating>.form-control:focus~label,.form-floating>.form-control:not(:placeholder-shown)~label,.form-floating>.form-select~label{color:rgba(var(--bs-body-color-rgb),.65);transform:scale(.85) translateY(-.5rem) translateX(.15rem)}.form-floating>.form-control:not(:-moz-placeholder-shown)~label::after{position:absolute;inset:1rem 0.375rem;z-index:-1;height:1.5em;content:"";background-color:var(--bs-body-bg);border-radius:var(--bs-border-radius)}.form-floating>.form-control-plaintext~label::after,.form-floating>.form-control:focus~label::after,.form-floating>.form-control:not(:placeholder-shown)~label::after,.form-floating>.form-select~label::after{position:absolute;inset:1rem 0.375rem;z-index:-1;height:1.5em;content:"";background-color:var(--bs-body-bg);border-radius:var(--bs-border-radius)}.form-floating>.form-control:-webkit-autofill~label{color:rgba(var(--bs-body-color-rgb),.65);transform:scale(.85) translateY(-.5rem) translateX(.15rem)}.form-floating>.form-control-plaintext~label{border-width:var(--bs-border-width) 0}.form-floating>.form-control:disabled~label,.form-floating>:disabled~label{color:#6c757d}.form-floating>.form-control:disabled~label::after,.form-floating>:disabled~label::after{background-color:var(--bs-secondary-bg)}.input-group{position:relative;display:flex;flex-wrap:wrap;align-items:stretch;width:100%}.input-group>.form-control,.input-group>.form-floating,.input-group>.form-select{position:relative;flex:1 1 auto;width:1%;min-width:0}.input-group>.form-control:focus,.input-group>.form-floating:focus-within,.input-group>.form-select:focus{z-index:5}.input-group .btn{position:relative;z-index:2}.input-group .btn:focus{z-index:5}.input-group-text{display:flex;align-items:center;padding:.375rem .75rem;font-size:1rem;font-weight:400;line-height:1.5;color:var(--bs-body-color);text-align:center;white-space:nowrap;background-color:var(--bs-tertiary-bg);border:var(--bs-border-width) solid var(--bs-border-color);border-radius:var(--bs-border-radius)}.input-group-lg>.btn,.input-group-lg>.form-control,.input-group-lg>.form-select,.input-group-lg>.input-group-text{padding:.5rem 1rem;font-size:1.25rem;border-radius:var(--bs-border-radius-lg)}.input-group-sm>.btn,.input-group-sm>.form-control,.input-group-sm>.form-select,.input-group-sm>.input-group-text{padding:.25rem .5rem;font-size:.875rem;border-radius:var(--bs-border-radius-sm)}.input-group-lg>.form-select,.input-group-sm>.form-select{padding-right:3rem}.input-group:not(.has-validation)>.dropdown-toggle:nth-last-child(n+3),.input-group:not(.has-validation)>.form-floating:not(:last-child)>.form-control,.input-group:not(.has-validation)>.form-floating:not(:last-child)>.form-select,.input-group:not(.has-validation)>:not(:last-child):not(.dropdown-toggle):not(.dropdown-menu):not(.form-floating){border-top-right-radius:0;border-bottom-right-radius:0}.input-group.has-validation>.dropdown-toggle:nth-last-child(n+4),.input-group.has-validation>.form-floating:nth-last-child(n+3)>.form-control,.input-group.has-validation>.form-floating:nth-last-child(n+3)>.form-select,.input-group.has-validation>:nth-last-child(n+3):not(.dropdown-toggle):not(.dropdown-menu):not(.form-floating){border-top-right-radius:0;border-bottom-right-radius:0}.input-group>:not(:first-child):not(.dropdown-menu):not(.valid-tooltip):not(.valid-feedback):not(.invalid-tooltip):not(.invalid-feedback){margin-left:calc(var(--bs-border-width) * -1);border-top-left-radius:0;border-bottom-left-radius:0}.input-group>.form-floating:not(:first-child)>.form-control,.input-group>.form-floating:not(:first-child)>.form-select{border-top-left-radius:0;border-bottom-left-radius:0}.valid-feedback{display:none;width:100%;margin-top:.25rem;font-size:.875em;color:var(--bs-form-valid-color)}.valid-tooltip{position:absolute;top:100%;z-index:5;display:none;max-width:100%;padding:.25rem .5rem;margin-top:.1rem;font-size:.875rem;color:#fff;background-color:var(--bs-success);border-radius:var(--bs-border-radius)}.is-valid~.valid-feedback,.is-valid~.valid-tooltip,.was-validated :valid~.valid-feedback,.was-validated :valid~.valid-tooltip{display:block}.form-control.is-valid,.was-validated .form-control:valid{border-color:var(--bs-form-valid-border-color);padding-right:calc(1.5em + .75rem);background-image:url(${I});background-repeat:no-repeat;background-position:right calc(.375em + .1875rem) center;background-size:calc(.75em + .375rem) calc(.75em + .375rem)}.form-control.is-valid:focus,.was-validated .form-control:valid:focus{border-color:var(--bs-form-valid-border-color);box-shadow:0 0 0 .25rem rgba(var(--bs-success-rgb),.25)}.was-validated textarea.form-control:valid,textarea.form-control.is-valid{padding-right:calc(1.5em + .75rem);background-position:top calc(.375em + .1875rem) right calc(.375em + .1875rem)}.form-select.is-valid,.was-validated .form-select:valid{border-color:var(--bs-form-valid-border-color)}.form-select.is-valid:not([multiple]):not([size]),.form-select.is-valid:not([multiple])[size="1"],.was-validated .form-select:valid:not([multiple]):not([size]),.was-validated .form-select:valid:not([multiple])[size="1"]{--bs-form-select-bg-icon:url(${I});padding-right:4.125rem;background-position:right .75rem center,center right 2.25rem;background-size:16px 12px,calc(.75em + .375rem) calc(.75em + .375rem)}.form-select.is-valid:focus,.was-validated .form-select:valid:focus{border-color:var(--bs-form-valid-border-color);box-shadow:0 0 0 .25rem rgba(var(--bs-success-rgb),.25)}.form-control-color.is-valid,.was-validated .form-control-color:valid{width:calc(3rem + calc(1.5em + .75rem))}.form-check-input.is-valid,.was-validated .form-check-input:valid{border-color:var(--bs-form-valid-border-color)}.form-check-input.is-valid:checked,.was-validated .form-check-input:valid:checked{background-color:var(--bs-form-valid-color)}.form-check-input.is-valid:focus,.was-validated .form-check-input:valid:focus{box-shadow:0 0 0 .25rem rgba(var(--bs-success-rgb),.25)}.form-check-input.is-valid~.form-check-label,.was-validated .form-check-input:valid~.form-check-label{color:var(--bs-form-valid-color)}.form-check-inline .form-check-input~.valid-feedback{margin-left:.5em}.input-group>.form-control:not(:focus).is-valid,.input-group>.form-floating:not(:focus-within).is-valid,.input-group>.form-select:not(:focus).is-valid,.was-validated .input-group>.form-control:not(:focus):valid,.was-validated .input-group>.form-floating:not(:focus-within):valid,.was-validated .input-group>.form-select:not(:focus):valid{z-index:3}.invalid-feedback{display:none;width:100%;margin-top:.25rem;font-size:.875em;color:var(--bs-form-invalid-color)}.invalid-tooltip{position:absolute;top:100%;z-index:5;display:none;max-width:100%;padding:.25rem .5rem;margin-top:.1rem;font-size:.875rem;color:#fff;background-color:var(--bs-danger);border-radius:var(--bs-border-radius)}.is-invalid~.invalid-feedback,.is-invalid~.invalid-tooltip,.was-validated :invalid~.invalid-feedback,.was-validated :invalid~.invalid-tooltip{display:block}.form-control.is-invalid,.was-validated .form-control:invalid{border-color:var(--bs-form-invalid-border-color);padding-right:calc(1.5em + .75rem);background-image:url(${B});background-repeat:no-repeat;background-position:right calc(.375em + .1875rem) center;background-size:calc(.75em + .375rem) calc(.75em + .375rem)}.form-control.is-invalid:focus,.was-validated .form-control:invalid:focus{border-color:var(--bs-form-invalid-border-color);box-shadow:0 0 0 .25rem rgba(var(--bs-danger-rgb),.25)}.was-validated textarea.form-control:invalid,textarea.form-control.is-invalid{padding-right:calc(1.5em + .75rem);background-position:top calc(.375em + .1875rem) right calc(.375em + .1875rem)}.form-select.is-invalid,.was-validated .form-select:invalid{border-color:var(--bs-form-invalid-border-color)}.form-select.is-invalid:not([multiple]):not([size]),.form-select.is-invalid:not([multiple])[size="1"],.was-validated .form-select:invalid:not([multiple]):not([size]),.was-validated .form-select:invalid:not([multiple])[size="1"]{--bs-form-select-bg-icon:url(${B});padding-right:4.125rem;background-position:right .75rem center,center right 2.25rem;background-size:16px 12px,calc(.75em + .375rem) calc(.75em + .375rem)}.form-select.is-invalid:focus,.was-validated .form-select:invalid:focus{border-color:var(--bs-form-invalid-border-color);box-shadow:0 0 0 .25rem rgba(var(--bs-danger-rgb),.25)}.form-control-color.is-invalid,.was-validated .form-control-color:invalid{width:calc(3rem + calc(1.5em + .75rem))}.form-check-input.is-invalid,.was-validated .form-check-input:invalid{border-color:var(--bs-form-invalid-border-color)}.form-check-input.is-invalid:checked,.was-validated .form-check-input:invalid:checked{background-color:var(--bs-form-invalid-color)}.form-check-input.is-invalid:focus,.was-validated .form-check-input:invalid:focus{box-shadow:0 0 0 .25rem rgba(var(--bs-danger-rgb),.25)}.form-check-input.is-invalid~.form-check-label,.was-validated .form-check-input:invalid~.form-check-label{color:var(--bs-form-invalid-color)}.form-check-inline .form-check-input~.invalid-feedback{margin-left:.5em}.input-group>.form-control:not(:focus).is-invalid,.input-group>.form-floating:not(:focus-within).is-invalid,.input-group>.form-select:not(:focus).is-invalid,.was-validated .input-group>.form-control:not(:focus):invalid,.was-validated .input-group>.form-floating:not(:focus-within):invalid,.was-validated .input-group>.form-select:not(:focus):invalid{z-index:4}.btn{--bs-btn-padding-x:0.75rem;--bs-btn-padding-y:0.375rem;--bs-btn-font-family: ;--bs-btn-font-size:1rem;--bs-btn-font-weight:400;--bs-btn-line-height:1.5;--bs-btn-color:var(--bs-body-color);--bs-btn-bg:transparent;--bs-btn-border-width:var(--bs-border-width);--bs-btn-border-color:transparent;--bs-btn-border-radius:var(--bs-border-radius);--bs-btn-hover-border-color:transparent;--bs-btn-box-shadow:inset 0 1px 0 rgba(255, 255, 255, 0.15),0 1px 1px rgba(0, 0, 0, 0.075);--bs-btn-disabled-opacity:0.65;--bs-btn-focus-box-shadow:0 0 0 0.25rem rgba(var(--bs-btn-focus-shadow-rgb), .5);display:inline-block;padding:var(--bs-btn-padding-y) var(--bs-btn-padding-x);font-family:var(--bs-btn-font-family);font-size:var(--bs-btn-font-size);font-weight:var(--bs-btn-font-weight);line-height:var(--bs-btn-line-height);color:var(--bs-btn-color);text-align:center;text-decoration:none;vertical-align:middle;cursor:pointer;-webkit-user-select:none;-moz-user-select:none;user-select:none;border:var(--bs-btn-border-width) solid var(--bs-btn-border-color);border-radius:var(--bs-btn-border-radius);background-color:var(--bs-btn-bg);transition:color .15s ease-in-out,background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out}@media (prefers-reduced-motion:reduce){.btn{transition:none}}.btn:hover{color:var(--bs-btn-hover-color);background-color:var(--bs-btn-hover-bg);border-color:var(--bs-btn-hover-border-color)}.btn-check+.btn:hover{color:var(--bs-btn-color);background-color:var(--bs-btn-bg);border-color:var(--bs-btn-border-color)}.btn:focus-visible{color:var(--bs-btn-hover-color);background-color:var(--bs-btn-hover-bg);border-color:var(--bs-btn-hover-border-color);outline:0;box-shadow:var(--bs-btn-focus-box-shadow)}.btn-check:focus-visible+.btn{border-color:var(--bs-btn-hover-border-color);outline:0;box-shadow:var(--bs-btn-focus-box-shadow)}.btn-check:checked+.btn,.btn.active,.btn.show,.btn:first-child:active,:not(.btn-check)+.btn:active{color:var(--bs-btn-active-color);background-color:var(--bs-btn-active-bg);border-color:var(--bs-btn-active-border-color)}.btn-check:checked+.btn:focus-visible,.btn.active:focus-visible,.btn.show:focus-visible,.btn:first-child:active:focus-visible,:not(.btn-check)+.btn:active:focus-visible{box-shadow:var(--bs-btn-focus-box-shadow)}.btn-check:checked:focus-visible+.btn{box-shadow:var(--bs-btn-focus-box-shadow)}.btn.disabled,.btn:disabled,fieldset:disabled .btn{color:var(--bs-btn-disabled-color);pointer-events:none;background-color:var(--bs-btn-disabled-bg);border-color:var(--bs-btn-disabled-border-color);opacity:var(--bs-btn-disabled-opacity)}.btn-primary{--bs-btn-color:#fff;--bs-btn-bg:#0d6efd;--bs-btn-border-color:#0d6efd;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#0b5ed7;--bs-btn-hover-border-color:#0a58ca;--bs-btn-focus-shadow-rgb:49,132,253;--bs-btn-active-color:#fff;--bs-btn-active-bg:#0a58ca;--bs-btn-active-border-color:#0a53be;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#fff;--bs-btn-disabled-bg:#0d6efd;--bs-btn-disabled-border-color:#0d6efd}.btn-secondary{--bs-btn-color:#fff;--bs-btn-bg:#6c757d;--bs-btn-border-color:#6c757d;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#5c636a;--bs-btn-hover-border-color:#565e64;--bs-btn-focus-shadow-rgb:130,138,145;--bs-btn-active-color:#fff;--bs-btn-active-bg:#565e64;--bs-btn-active-border-color:#51585e;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#fff;--bs-btn-disabled-bg:#6c757d;--bs-btn-disabled-border-color:#6c757d}.btn-success{--bs-btn-color:#fff;--bs-btn-bg:#198754;--bs-btn-border-color:#198754;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#157347;--bs-btn-hover-border-color:#146c43;--bs-btn-focus-shadow-rgb:60,153,110;--bs-btn-active-color:#fff;--bs-btn-active-bg:#146c43;--bs-btn-active-border-color:#13653f;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#fff;--bs-btn-disabled-bg:#198754;--bs-btn-disabled-border-color:#198754}.btn-info{--bs-btn-color:#000;--bs-btn-bg:#0dcaf0;--bs-btn-border-color:#0dcaf0;--bs-btn-hover-color:#000;--bs-btn-hover-bg:#31d2f2;--bs-btn-hover-border-color:#25cff2;--bs-btn-focus-shadow-rgb:11,172,204;--bs-btn-active-color:#000;--bs-btn-active-bg:#3dd5f3;--bs-btn-active-border-color:#25cff2;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#000;--bs-btn-disabled-bg:#0dcaf0;--bs-btn-disabled-border-color:#0dcaf0}.btn-warning{--bs-btn-color:#000;--bs-btn-bg:#ffc107;--bs-btn-border-color:#ffc107;--bs-btn-hover-color:#000;--bs-btn-hover-bg:#ffca2c;--bs-btn-hover-border-color:#ffc720;--bs-btn-focus-shadow-rgb:217,164,6;--bs-btn-active-color:#000;--bs-btn-active-bg:#ffcd39;--bs-btn-active-border-color:#ffc720;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#000;--bs-btn-disabled-bg:#ffc107;--bs-btn-disabled-border-color:#ffc107}.btn-danger{--bs-btn-color:#fff;--bs-btn-bg:#dc3545;--bs-btn-border-color:#dc3545;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#bb2d3b;--bs-btn-hover-border-color:#b02a37;--bs-btn-focus-shadow-rgb:225,83,97;--bs-btn-active-color:#fff;--bs-btn-active-bg:#b02a37;--bs-btn-active-border-color:#a52834;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#fff;--bs-btn-disabled-bg:#dc3545;--bs-btn-disabled-border-color:#dc3545}.btn-light{--bs-btn-color:#000;--bs-btn-bg:#f8f9fa;--bs-btn-border-color:#f8f9fa;--bs-btn-hover-color:#000;--bs-btn-hover-bg:#d3d4d5;--bs-btn-hover-border-color:#c6c7c8;--bs-btn-focus-shadow-rgb:211,212,213;--bs-btn-active-color:#000;--bs-btn-active-bg:#c6c7c8;--bs-btn-active-border-color:#babbbc;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#000;--bs-btn-disabled-bg:#f8f9fa;--bs-btn-disabled-border-color:#f8f9fa}.btn-dark{--bs-btn-color:#fff;--bs-btn-bg:#212529;--bs-btn-border-color:#212529;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#424649;--bs-btn-hover-border-color:#373b3e;--bs-btn-focus-shadow-rgb:66,70,73;--bs-btn-active-color:#fff;--bs-btn-active-bg:#4d5154;--bs-btn-active-border-color:#373b3e;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#fff;--bs-btn-disabled-bg:#212529;--bs-btn-disabled-border-color:#212529}.btn-outline-primary{--bs-btn-color:#0d6efd;--bs-btn-border-color:#0d6efd;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#0d6efd;--bs-btn-hover-border-color:#0d6efd;--bs-btn-focus-shadow-rgb:13,110,253;--bs-btn-active-color:#fff;--bs-btn-active-bg:#0d6efd;--bs-btn-active-border-color:#0d6efd;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#0d6efd;--bs-btn-disabled-bg:transparent;--bs-btn-disabled-border-color:#0d6efd;--bs-gradient:none}.btn-outline-secondary{--bs-btn-color:#6c757d;--bs-btn-border-color:#6c757d;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#6c757d;--bs-btn-hover-border-color:#6c757d;--bs-btn-focus-shadow-rgb:108,117,125;--bs-btn-active-color:#fff;--bs-btn-active-bg:#6c757d;--bs-btn-active-border-color:#6c757d;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#6c757d;--bs-btn-disabled-bg:transparent;--bs-btn-disabled-border-color:#6c757d;--bs-gradient:none}.btn-outline-success{--bs-btn-color:#198754;--bs-btn-border-color:#198754;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#198754;--bs-btn-hover-border-color:#198754;--bs-btn-focus-shadow-rgb:25,135,84;--bs-btn-active-color:#fff;--bs-btn-active-bg:#198754;--bs-btn-active-border-color:#198754;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#198754;--bs-btn-disabled-bg:transparent;--bs-btn-disabled-border-color:#198754;--bs-gradient:none}.btn-outline-info{--bs-btn-color:#0dcaf0;--bs-btn-border-color:#0dcaf0;--bs-btn-hover-color:#000;--bs-btn-hover-bg:#0dcaf0;--bs-btn-hover-border-color:#0dcaf0;--bs-btn-focus-shadow-rgb:13,202,240;--bs-btn-active-color:#000;--bs-btn-active-bg:#0dcaf0;--bs-btn-active-border-color:#0dcaf0;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#0dcaf0;--bs-btn-disabled-bg:transparent;--bs-btn-disabled-border-color:#0dcaf0;--bs-gradient:none}.btn-outline-warning{--bs-btn-color:#ffc107;--bs-btn-border-color:#ffc107;--bs-btn-hover-color:#000;--bs-btn-hover-bg:#ffc107;--bs-btn-hover-border-color:#ffc107;--bs-btn-focus-shadow-rgb:255,193,7;--bs-btn-active-color:#000;--bs-btn-active-bg:#ffc107;--bs-btn-active-border-color:#ffc107;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#ffc107;--bs-btn-disabled-bg:transparent;--bs-btn-disabled-border-color:#ffc107;--bs-gradient:none}.btn-outline-danger{--bs-btn-color:#dc3545;--bs-btn-border-color:#dc3545;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#dc3545;--bs-btn-hover-border-color:#dc3545;--bs-btn-focus-shadow-rgb:220,53,69;--bs-btn-active-color:#fff;--bs-btn-active-bg:#dc3545;--bs-btn-active-border-color:#dc3545;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#dc3545;--bs-btn-disabled-bg:transparent;--bs-btn-disabled-border-color:#dc3545;--bs-gradient:none}.btn-outline-light{--bs-btn-color:#f8f9fa;--bs-btn-border-color:#f8f9fa;--bs-btn-hover-color:#000;--bs-btn-hover-bg:#f8f9fa;--bs-btn-hover-border-color:#f8f9fa;--bs-btn-focus-shadow-rgb:248,249,250;--bs-btn-active-color:#000;--bs-btn-active-bg:#f8f9fa;--bs-btn-active-border-color:#f8f9fa;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#f8f9fa;--bs-btn-disabled-bg:transparent;--bs-btn-disabled-border-color:#f8f9fa;--bs-gradient:none}.btn-outline-dark{--bs-btn-color:#212529;--bs-btn-border-color:#212529;--bs-btn-hover-color:#fff;--bs-btn-hover-bg:#212529;--bs-btn-hover-border-color:#212529;--bs-btn-focus-shadow-rgb:33,37,41;--bs-btn-active-color:#fff;--bs-btn-active-bg:#212529;--bs-btn-active-border-color:#212529;--bs-btn-active-shadow:inset 0 3px 5px rgba(0, 0, 0, 0.125);--bs-btn-disabled-color:#212529;--bs-btn-disabled-bg:transparent;--bs-btn-disabled-border-color:#212529;--bs-gradient:none}.btn-link{--bs-btn-font-weight:400;--bs-btn-color:var(--bs-link-color);--bs-btn-bg:transparent;--bs-btn-border-color:transparent;--bs-btn-hover-color:var(--bs-link-hover-color);--bs-btn-hover-border-color:transparent;--bs-btn-active-color:var(--bs-link-hover-color);--bs-btn-active-border-color:transparent;--bs-btn-disabled-color:#6c757d;--bs-btn-disabled-border-color:transparent;--bs-btn-box-shadow:0 0 0 #000;--bs-btn-focus-shadow-rgb:49,132,253;text-decoration:underline}.btn-link:focus-visible{color:var(--bs-btn-color)}.btn-link:hover{color:var(--bs-btn-hover-color)}.btn-group-lg>.btn,.btn-lg{--bs-btn-padding-y:0.5rem;--bs-btn-padding-x:1rem;--bs-btn-font-size:1.25rem;--bs-btn-border-radius:var(--bs-border-radius-lg)}.btn-group-sm>.btn,.btn-sm{--bs-btn-padding-y:0.25rem;--bs-btn-padding-x:0.5rem;--bs-btn-font-size:0.875rem;--bs-btn-border-radius:var(--bs-border-radius-sm)}.fade{transition:opacity .15s linear}@media (prefers-reduced-motion:reduce){.fade{transition:none}}.fade:not(.show){opacity:0}.collapse:not(.show){display:none}.collapsing{height:0;overflow:hidden;transition:height .35s ease}@media (prefers-reduced-motion:reduce){.collapsing{transition:none}}.collapsing.collapse-horizontal{width:0;height:auto;transition:width .35s ease}@media (prefers-reduced-motion:reduce){.collapsing.collapse-horizontal{transition:none}}.dropdown,.dropdown-center,.dropend,.dropstart,.dropup,.dropup-center{position:relative}.dropdown-toggle{white-space:nowrap}.dropdown-toggle::after{display:inline-block;margin-left:.255em;vertical-align:.255em;content:"";border-top:.3em solid;border-right:.3em solid transparent;border-bottom:0;border-left:.3em solid transparent}.dropdown-toggle:empty::after{margin-left:0}.dropdown-menu{--bs-dropdown-zindex:1000;--bs-dropdown-min-width:10rem;--bs-dropdown-padding-x:0;--bs-dropdown-padding-y:0.5rem;--bs-dropdown-spacer:0.125rem;--bs-dropdown-font-size:1rem;--bs-dropdown-color:var(--bs-body-color);--bs-dropdown-bg:var(--bs-body-bg);--bs-dropdown-border-color:var(--bs-border-color-translucent);--bs-dropdown-border-radius:var(--bs-border-radius);--bs-dropdown-border-width:var(--bs-border-width);--bs-dropdown-inner-border-radius:calc(var(--bs-border-radius) - var(--bs-border-width));--bs-dropdown-divider-bg:var(--bs-border-color-translucent);--bs-dropdown-divider-margin-y:0.5rem;--bs-dropdown-box-shadow:var(--bs-box-shadow);--bs-dropdown-link-color:var(--bs-body-color);--bs-dropdown-link-hover-color:var(--bs-body-color);--bs-dropdown-link-hover-bg:var(--bs-tertiary-bg);--bs-dropdown-link-active-color:#fff;--bs-dropdown-link-active-bg:#0d6efd;--bs-dropdown-link-disabled-color:var(--bs-tertiary-color);--bs-dropdown-item-padding-x:1rem;--bs-dropdown-item-padding-y:0.25rem;--bs-dropdown-header-color:#6c757d;--bs-dropdown-header-padding-x:1rem;--bs-dropdown-header-padding-y:0.5rem;position:absolute;z-index:var(--bs-dropdown-zindex);display:none;min-width:var(--bs-dropdown-min-width);padding:var(--bs-dropdown-padding-y) var(--bs-dropdown-padding-x);margin:0;font-size:var(--bs-dropdown-font-size);color:var(--bs-dropdown-color);text-align:left;list-style:none;background-color:var(--bs-dropdown-bg);background-clip:padding-box;border:var(--bs-dropdown-border-width) solid var(--bs-dropdown-border-color);border-radius:var(--bs-dropdown-border-radius)}.dropdown-menu[data-bs-popper]{top:100%;left:0;margin-top:var(--bs-dropdown-spacer)}.dropdown-menu-start{--bs-position:start}.dropdown-menu-start[data-bs-popper]{right:auto;left:0}.dropdown-menu-end{--bs-position:end}.dropdown-menu-end[data-bs-popper]{right:0;left:auto}@media (min-width:576px){.dropdown-menu-sm-start{--bs-position:start}.dropdown-menu-sm-start[data-bs-popper]{right:auto;left:0}.dropdown-menu-sm-end{--bs-position:end}.dropdown-menu-sm-end[data-bs-popper]{right:0;left:auto}}@media (min-width:768px){.dropdown-menu-md-start{--bs-position:start}.dropdown-menu-md-start[data-bs-popper]{right:auto;left:0}.dropdown-menu-md-end{--bs-position:end}.dropdown-menu-md-end[data-bs-popper]{right:0;left:auto}}@media (min-width:992px){.dropdown-menu-lg-start{--bs-position:start}.dropdown-menu-lg-start[data-bs-popper]{right:auto;left:0}.dropdown-menu-lg-end{--bs-position:end}.dropdown-menu-lg-end[data-bs-popper]{right:0;left:auto}}@media (min-width:1200px){.dropdown-menu-xl-start{--bs-position:start}.dropdown-menu-xl-start[data-bs-popper]{right:auto;left:0}.dropdown-menu-xl-end{--bs-position:end}.dropdown-menu-xl-end[data-bs-popper]{right:0;left:auto}}@media (min-width:1400px){.dropdown-menu-xxl-start{--bs-position:start}.dropdown-menu-xxl-start[data-bs-popper]{right:auto;left:0}.dropdown-menu-xxl-end{--bs-position:end}.dropdown-menu-xxl-end[data-bs-popper]{right:0;left:auto}}.dropup .dropdown-menu[data-bs-popper]{top:auto;bottom:100%;margin-top:0;margin-bottom:var(--bs-dropdown-spacer)}.dropup .dropdown-toggle::after{display:inline-block;margin-left:.255em;vertical-align:.255em;content:"";border-top:0;border-right:.3em solid transparent;border-bottom:.3em solid;border-left:.3em solid transparent}.dropup .dropdown-toggle:empty::after{margin-left:0}.dropend .dropdown-menu[data-bs-popper]{top:0;right:auto;left:100%;margin-top:0;margin-left:var(--bs-dropdown-spacer)}.dropend .dropdown-toggle::after{display:inline-block;margin-left:.255em;vertical-align:.255em;content:"";border-top:.3em solid transparent;border-right:0;border-bottom:.3em solid transparent;border-left:.3em solid}.dropend .dropdown-toggle:empty::after{margin-left:0}.dropend .dropdown-toggle::after{vertical-align:0}.dropstart .dropdown-menu[data-bs-popper]{top:0;right:100%;left:auto;margin-top:0;margin-right:var(--bs-dropdown-spacer)}.dropstart .dropdown-toggle::after{display:inline-block;margin-left:.255em;vertical-align:.255em;content:""}.dropstart .dropdown-toggle::after{display:none}.dropstart .dropdown-toggle::before{display:inline-block;margin-right:.255em;vertical-align:.255em;content:"";border-top:.3em solid transparent;border-right:.3em solid;border-bottom:.3em solid transparent}.dropstart .dropdown-toggle:empty::after{margin-left:0}.dropstart .dropdown-toggle::before{vertical-align:0}.dropdown-divider{height:0;margin:var(--bs-dropdown-divider-margin-y) 0;overflow:hidden;border-top:1px solid var(--bs-dropdown-divider-bg);opacity:1}.dropdown-item{display:block;width:100%;padding:var(--bs-dropdown-item-padding-y) var(--bs-dropdown-item-padding-x);clear:both;font-weight:400;color:var(--bs-dropdown-link-color);text-align:inherit;text-decoration:none;white-space:nowrap;background-color:transparent;border:0;border-radius:var(--bs-dropdown-item-border-radius,0)}.dropdown-item:focus,.dropdown-item:hover{color:var(--bs-dropdown-link-hover-color);background-color:var(--bs-dropdown-link-hover-bg)}.dropdown-item.active,.dropdown-item:active{color:var(--bs-dropdown-link-active-color);text-decoration:none;background-color:var(--bs-dropdown-link-active-bg)}.dropdown-item.disabled,.dropdown-item:disabled{color:var(--bs-dropdown-link-disabled-color);pointer-events:none;background-color:transparent}.dropdown-menu.show{display:block}.dropdown-header{display:block;padding:var(--bs-dropdown-header-padding-y) var(--bs-dropdown-header-padding-x);margin-bottom:0;font-size:.875rem;color:var(--bs-dropdown-header-color);white-space:nowrap}.dropdown-item-text{display:block;padding:var(--bs-dropdown-item-padding-y) var(--bs-dropdown-item-padding-x);color:var(--bs-dropdown-link-color)}.dropdown-menu-dark{--bs-dropdown-color:#dee2e6;--bs-dropdown-bg:#343a40;--bs-dropdown-border-color:var(--bs-border-color-translucent);--bs-dropdown-box-shadow: ;--bs-dropdown-link-color:#dee2e6;--bs-dropdown-link-hover-color:#fff;--bs-dropdown-divider-bg:var(--bs-border-color-translucent);--bs-dropdown-link-hover-bg:rgba(255, 255, 255, 0.15);--bs-dropdown-link-active-color:#fff;--bs-dropdown-link-active-bg:#0d6efd;--bs-dropdown-link-disabled-color:#adb5bd;--bs-dropdown-header-color:#adb5bd}.btn-group,.btn-group-vertical{position:relative;display:inline-flex;vertical-align:middle}.btn-group-vertical>.btn,.btn-group>.btn{position:relative;flex:1 1 auto}.btn-group-vertical>.btn-check:checked+.btn,.btn-group-vertical>.btn-check:focus+.btn,.btn-group-vertical>.btn.active,.btn-group-vertical>.btn:active,.btn-group-vertical>.btn:focus,.btn-group-vertical>.btn:hover,.btn-group>.btn-check:checked+.btn,.btn-group>.btn-check:focus+.btn,.btn-group>.btn.active,.btn-group>.btn:active,.btn-group>.btn:focus,.btn-group>.btn:hover{z-index:1}.btn-toolbar{display:flex;flex-wrap:wrap;justify-content:flex-start}.btn-toolbar .input-group{width:auto}.btn-group{border-radius:var(--bs-border-radius)}.btn-group>.btn-group:not(:first-child),.btn-group>:not(.btn-check:first-child)+.btn{margin-left:calc(var(--bs-border-width) * -1)}.btn-group>.btn-group:not(:last-child)>.btn,.btn-group>.btn.dropdown-toggle-split:first-child,.btn-group>.btn:not(:last-child):not(.dropdown-toggle){border-top-right-radius:0;border-bottom-right-radius:0}.btn-group>.btn-group:not(:first-child)>.btn,.btn-group>.btn:nth-child(n+3),.btn-group>:not(.btn-check)+.btn{border-top-left-radius:0;border-bottom-left-radius:0}.dropdown-toggle-split{padding-right:.5625rem;padding-left:.5625rem}.dropdown-toggle-split::after,.dropend .dropdown-toggle-split::after,.dropup .dropdown-toggle-split::after{margin-left:0}.dropstart .dropdown-toggle-split::before{margin-right:0}.btn-group-sm>.btn+.dropdown-toggle-split,.btn-sm+.dropdown-toggle-split{padding-right:.375rem;padding-left:.375rem}.btn-group-lg>.btn+.dropdown-toggle-split,.btn-lg+.dropdown-toggle-split{padding-right:.75rem;padding-left:.75rem}.btn-group-vertical{flex-direction:column;align-items:flex-start;justify-content:center}.btn-group-vertical>.btn,.btn-group-vertical>.btn-group{width:100%}.btn-group-vertical>.btn-group:not(:first-child),.btn-group-vertical>.btn:not(:first-child){margin-top:calc(var(--bs-border-width) * -1)}.btn-group-vertical>.btn-group:not(:last-child)>.btn,.btn-group-vertical>.btn:not(:last-child):not(.dropdown-toggle){border-bottom-right-radius:0;border-bottom-left-radius:0}.btn-group-vertical>.btn-group:not(:first-child)>.btn,.btn-group-vertical>.btn~.btn{border-top-left-radius:0;border-top-right-radius:0}.nav{--bs-nav-link-padding-x:1rem;--bs-nav-link-padding-y:0.5rem;--bs-nav-link-font-weight: ;--bs-nav-link-color:var(--bs-link-color);--bs-nav-link-hover-color:var(--bs-link-hover-color);--bs-nav-link-disabled-color:var(--bs-secondary-color);display:flex;flex-wrap:wrap;padding-left:0;margin-bottom:0;list-style:none}.nav-link{display:block;padding:var(--bs-nav-link-padding-y) var(--bs-nav-link-padding-x);font-size:var(--bs-nav-link-font-size);font-weight:var(--bs-nav-link-font-weight);color:var(--bs-nav-link-color);text-decoration:none;background:0 0;border:0;transition:color .15s ease-in-out,background-color .15s ease-in-out,border-color .15s ease-in-out}@media (prefers-reduced-motion:reduce){.nav-link{transition:none}}.nav-link:focus,.nav-link:hover{color:var(--bs-nav-link-hover-color)}.nav-link:focus-visible{outline:0;box-shadow:0 0 0 .25rem rgba(13,110,253,.25)}.nav-link.disabled,.nav-link:disabled{color:var(--bs-nav-link-disabled-color);pointer-events:none;cursor:default}.nav-tabs{--bs-nav-tabs-border-width:var(--bs-border-width);--bs-nav-tabs-border-color:var(--bs-border-color);--bs-nav-tabs-border-radius:var(--bs-border-radius);--bs-nav-tabs-link-hover-border-color:var(--bs-secondary-bg) var(--bs-secondary-bg) var(--bs-border-color);--bs-nav-tabs-link-active-color:var(--bs-emphasis-color);--bs-nav-tabs-link-active-bg:var(--bs-body-bg);--bs-nav-tabs-link-active-border-color:var(--bs-border-color) var(--bs-border-color) var(--bs-body-bg);border-bottom:var(--bs-nav-tabs-border-width) solid var(--bs-nav-tabs-border-color)}.nav-tabs .nav-link{margin-bottom:calc(-1 * var(--bs-nav-tabs-border-width));border:var(--bs-nav-tabs-border-width) solid transparent;border-top-left-radius:var(--bs-nav-tabs-border-radius);border-top-right-radius:var(--bs-nav-tabs-border-radius)}.nav-tabs .nav-link:focus,.nav-tabs .nav-link:hover{isolation:isolate;border-color:var(--bs-nav-tabs-link-hover-border-color)}.nav-tabs .nav-item.show .nav-link,.nav-tabs .nav-link.active{color:var(--bs-nav-tabs-link-active-color);background-color:var(--bs-nav-tabs-link-active-bg);border-color:var(--bs-nav-tabs-link-active-border-color)}.nav-tabs .dropdown-menu{margin-top:calc(-1 * var(--bs-nav-tabs-border-width));border-top-left-radius:0;border-top-right-radius:0}.nav-pills{--bs-nav-pills-border-radius:var(--bs-border-radius);--bs-nav-pills-link-active-color:#fff;--bs-nav-pills-link-active-bg:#0d6efd}.nav-pills .nav-link{border-radius:var(--bs-nav-pills-border-radius)}.nav-pills .nav-link.active,.nav-pills .show>.nav-link{color:var(--bs-nav-pills-link-active-color);background-color:var(--bs-nav-pills-link-active-bg)}.nav-underline{--bs-nav-underline-gap:1rem;--bs-nav-underline-border-width:0.125rem;--bs-nav-underline-link-active-color:var(--bs-emphasis-color);gap:var(--bs-nav-underline-gap)}.nav-underline .nav-link{padding-right:0;padding-left:0;border-bottom:var(--bs-nav-underline-border-width) solid transparent}.nav-underline .nav-link:focus,.nav-underline .nav-link:hover{border-bottom-color:currentcolor}.nav-underline .nav-link.active,.nav-underline .show>.nav-link{font-weight:700;color:var(--bs-nav-underline-link-active-color);border-bottom-color:currentcolor}.nav-fill .nav-item,.nav-fill>.nav-link{flex:1 1 auto;text-align:center}.nav-justified .nav-item,.nav-justified>.nav-link{flex-basis:0;flex-grow:1;text-align:center}.nav-fill .nav-item .nav-link,.nav-justified .nav-item .nav-link{width:100%}.tab-content>.tab-pane{display:none}.tab-content>.active{display:block}.navbar{--bs-navbar-padding-x:0;--bs-navbar-padding-y:0.5rem;--bs-navbar-color:rgba(var(--bs-emphasis-color-rgb), 0.65);--bs-navbar-hover-color:rgba(var(--bs-emphasis-color-rgb), 0.8);--bs-navbar-disabled-color:rgba(var(--bs-emphasis-color-rgb), 0.3);--bs-navbar-active-color:rgba(var(--bs-emphasis-color-rgb), 1);--bs-navbar-brand-padding-y:0.3125rem;--bs-navbar-brand-margin-end:1rem;--bs-navbar-brand-font-size:1.25rem;--bs-navbar-brand-color:rgba(var(--bs-emphasis-color-rgb), 1);--bs-navbar-brand-hover-color:rgba(var(--bs-emphasis-color-rgb), 1);--bs-navbar-nav-link-padding-x:0.5rem;--bs-navbar-toggler-padding-y:0.25rem;--bs-navbar-toggler-padding-x:0.75rem;--bs-navbar-toggler-font-size:1.25rem;--bs-navbar-toggler-icon-bg:url(${F});--bs-navbar-toggler-border-color:rgba(var(--bs-emphasis-color-rgb), 0.15);--bs-navbar-toggler-border-radius:var(--bs-border-radius);--bs-navbar-toggler-focus-width:0.25rem;--bs-navbar-toggler-transition:box-shadow 0.15s ease-in-out;position:relative;display:flex;flex-wrap:wrap;align-items:center;justify-content:space-between;padding:var(--bs-navbar-padding-y) var(--bs-navbar-padding-x)}.navbar>.container,.navbar>.container-fluid,.navbar>.container-lg,.navbar>.container-md,.navbar>.container-sm,.navbar>.container-xl,.navbar>.container-xxl{display:flex;flex-wrap:inherit;align-items:center;justify-content:space-between}.navbar-brand{padding-top:var(--bs-navbar-brand-padding-y);padding-bottom:var(--bs-navbar-brand-padding-y);margin-right:var(--bs-navbar-brand-margin-end);font-size:var(--bs-navbar-brand-font-size);color:var(--bs-navbar-brand-color);text-decoration:none;white-space:nowrap}.navbar-brand:focus,.navbar-brand:hover{color:var(--bs-navbar-brand-hover-color)}.navbar-nav{--bs-nav-link-padding-x:0;--bs-nav-link-padding-y:0.5rem;--bs-nav-link-font-weight: ;--bs-nav-link-color:var(--bs-navbar-color);--bs-nav-link-hover-color:var(--bs-navbar-hover-color);--bs-nav-link-disabled-color:var(--bs-navbar-disabled-color);display:flex;flex-direction:column;padding-left:0;margin-bottom:0;list-style:none}.navbar-nav .nav-link.active,.navbar-nav .nav-link.show{color:var(--bs-navbar-active-color)}.navbar-nav .dropdown-menu{position:static}.navbar-text{padding-top:.5rem;padding-bottom:.5rem;color:var(--bs-navbar-color)}.navbar-text a,.navbar-text a:focus,.navbar-text a:hover{color:var(--bs-navbar-active-color)}.navbar-collapse{flex-basis:100%;flex-grow:1;align-items:center}.navbar-toggler{padding:var(--bs-navbar-toggler-padding-y) var(--bs-navbar-toggler-padding-x);font-size:var(--bs-navbar-toggler-font-size);line-height:1;color:var(--bs-navbar-color);background-color:transparent;border:var(--bs-border-width) solid var(--bs-navbar-toggler-border-color);border-radius:var(--bs-navbar-toggler-border-radius);transition:var(--bs-navbar-toggler-transition)}@media (prefers-reduced-motion:reduce){.navbar-toggler{transition:none}}.navbar-toggler:hover{text-decoration:none}.navbar-toggler:focus{text-decoration:none;outline:0;box-shadow:0 0 0 var(--bs-navbar-toggler-focus-width)}.navbar-toggler-icon{display:inline-block;width:1.5em;height:1.5em;vertical-align:middle;background-image:var(--bs-navbar-toggler-icon-bg);background-repeat:no-repeat;background-position:center;background-size:100%}.navbar-nav-scroll{max-height:var(--bs-scroll-height,75vh);overflow-y:auto}@media (min-width:576px){.navbar-expand-sm{flex-wrap:nowrap;justify-content:flex-start}.navbar-expand-sm .navbar-nav{flex-direction:row}.navbar-expand-sm .navbar-nav .dropdown-menu{position:absolute}.navbar-expand-sm .navbar-nav .nav-link{padding-right:var(--bs-navbar-nav-link-padding-x);padding-left:var(--bs-navbar-nav-link-padding-x)}.navbar-expand-sm .navbar-nav-scroll{overflow:visible}.navbar-expand-sm .navbar-collapse{display:flex!important;flex-basis:auto}.navbar-expand-sm .navbar-toggler{display:none}.navbar-expand-sm .offcanvas{position:static;z-index:auto;flex-grow:1;width:auto!important;height:auto!important;visibility:visible!important;background-color:transparent!important;border:0!important;transform:none!important;transition:none}.navbar-expand-sm .offcanvas .offcanvas-header{display:none}.navbar-expand-sm .offcanvas .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible}}@media (min-width:768px){.navbar-expand-md{flex-wrap:nowrap;justify-content:flex-start}.navbar-expand-md .navbar-nav{flex-direction:row}.navbar-expand-md .navbar-nav .dropdown-menu{position:absolute}.navbar-expand-md .navbar-nav .nav-link{padding-right:var(--bs-navbar-nav-link-padding-x);padding-left:var(--bs-navbar-nav-link-padding-x)}.navbar-expand-md .navbar-nav-scroll{overflow:visible}.navbar-expand-md .navbar-collapse{display:flex!important;flex-basis:auto}.navbar-expand-md .navbar-toggler{display:none}.navbar-expand-md .offcanvas{position:static;z-index:auto;flex-grow:1;width:auto!important;height:auto!important;visibility:visible!important;background-color:transparent!important;border:0!important;transform:none!important;transition:none}.navbar-expand-md .offcanvas .offcanvas-header{display:none}.navbar-expand-md .offcanvas .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible}}@media (min-width:992px){.navbar-expand-lg{flex-wrap:nowrap;justify-content:flex-start}.navbar-expand-lg .navbar-nav{flex-direction:row}.navbar-expand-lg .navbar-nav .dropdown-menu{position:absolute}.navbar-expand-lg .navbar-nav .nav-link{padding-right:var(--bs-navbar-nav-link-padding-x);padding-left:var(--bs-navbar-nav-link-padding-x)}.navbar-expand-lg .navbar-nav-scroll{overflow:visible}.navbar-expand-lg .navbar-collapse{display:flex!important;flex-basis:auto}.navbar-expand-lg .navbar-toggler{display:none}.navbar-expand-lg .offcanvas{position:static;z-index:auto;flex-grow:1;width:auto!important;height:auto!important;visibility:visible!important;background-color:transparent!important;border:0!important;transform:none!important;transition:none}.navbar-expand-lg .offcanvas .offcanvas-header{display:none}.navbar-expand-lg .offcanvas .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible}}@media (min-width:1200px){.navbar-expand-xl{flex-wrap:nowrap;justify-content:flex-start}.navbar-expand-xl .navbar-nav{flex-direction:row}.navbar-expand-xl .navbar-nav .dropdown-menu{position:absolute}.navbar-expand-xl .navbar-nav .nav-link{padding-right:var(--bs-navbar-nav-link-padding-x);padding-left:var(--bs-navbar-nav-link-padding-x)}.navbar-expand-xl .navbar-nav-scroll{overflow:visible}.navbar-expand-xl .navbar-collapse{display:flex!important;flex-basis:auto}.navbar-expand-xl .navbar-toggler{display:none}.navbar-expand-xl .offcanvas{position:static;z-index:auto;flex-grow:1;width:auto!important;height:auto!important;visibility:visible!important;background-color:transparent!important;border:0!important;transform:none!important;transition:none}.navbar-expand-xl .offcanvas .offcanvas-header{display:none}.navbar-expand-xl .offcanvas .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible}}@media (min-width:1400px){.navbar-expand-xxl{flex-wrap:nowrap;justify-content:flex-start}.navbar-expand-xxl .navbar-nav{flex-direction:row}.navbar-expand-xxl .navbar-nav .dropdown-menu{position:absolute}.navbar-expand-xxl .navbar-nav .nav-link{padding-right:var(--bs-navbar-nav-link-padding-x);padding-left:var(--bs-navbar-nav-link-padding-x)}.navbar-expand-xxl .navbar-nav-scroll{overflow:visible}.navbar-expand-xxl .navbar-collapse{display:flex!important;flex-basis:auto}.navbar-expand-xxl .navbar-toggler{display:none}.navbar-expand-xxl .offcanvas{position:static;z-index:auto;flex-grow:1;width:auto!important;height:auto!important;visibility:visible!important;background-color:transparent!important;border:0!important;transform:none!important;transition:none}.navbar-expand-xxl .offcanvas .offcanvas-header{display:none}.navbar-expand-xxl .offcanvas .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible}}.navbar-expand{flex-wrap:nowrap;justify-content:flex-start}.navbar-expand .navbar-nav{flex-direction:row}.navbar-expand .navbar-nav .dropdown-menu{position:absolute}.navbar-expand .navbar-nav .nav-link{padding-right:var(--bs-navbar-nav-link-padding-x);padding-left:var(--bs-navbar-nav-link-padding-x)}.navbar-expand .navbar-nav-scroll{overflow:visible}.navbar-expand .navbar-collapse{display:flex!important;flex-basis:auto}.navbar-expand .navbar-toggler{display:none}.navbar-expand .offcanvas{position:static;z-index:auto;flex-grow:1;width:auto!important;height:auto!important;visibility:visible!important;background-color:transparent!important;border:0!important;transform:none!important;transition:none}.navbar-expand .offcanvas .offcanvas-header{display:none}.navbar-expand .offcanvas .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible}.navbar-dark,.navbar[data-bs-theme=dark]{--bs-navbar-color:rgba(255, 255, 255, 0.55);--bs-navbar-hover-color:rgba(255, 255, 255, 0.75);--bs-navbar-disabled-color:rgba(255, 255, 255, 0.25);--bs-navbar-active-color:#fff;--bs-navbar-brand-color:#fff;--bs-navbar-brand-hover-color:#fff;--bs-navbar-toggler-border-color:rgba(255, 255, 255, 0.1);--bs-navbar-toggler-icon-bg:url(${$})}[data-bs-theme=dark] .navbar-toggler-icon{--bs-navbar-toggler-icon-bg:url(${$})}.card{--bs-card-spacer-y:1rem;--bs-card-spacer-x:1rem;--bs-card-title-spacer-y:0.5rem;--bs-card-title-color: ;--bs-card-subtitle-color: ;--bs-card-border-width:var(--bs-border-width);--bs-card-border-color:var(--bs-border-color-translucent);--bs-card-border-radius:var(--bs-border-radius);--bs-card-box-shadow: ;--bs-card-inner-border-radius:calc(var(--bs-border-radius) - (var(--bs-border-width)));--bs-card-cap-padding-y:0.5rem;--bs-card-cap-padding-x:1rem;--bs-card-cap-bg:rgba(var(--bs-body-color-rgb), 0.03);--bs-card-cap-color: ;--bs-card-height: ;--bs-card-color: ;--bs-card-bg:var(--bs-body-bg);--bs-card-img-overlay-padding:1rem;--bs-card-group-margin:0.75rem;position:relative;display:flex;flex-direction:column;min-width:0;height:var(--bs-card-height);color:var(--bs-body-color);word-wrap:break-word;background-color:var(--bs-card-bg);background-clip:border-box;border:var(--bs-card-border-width) solid var(--bs-card-border-color);border-radius:var(--bs-card-border-radius)}.card>hr{margin-right:0;margin-left:0}.card>.list-group{border-top:inherit;border-bottom:inherit}.card>.list-group:first-child{border-top-width:0;border-top-left-radius:var(--bs-card-inner-border-radius);border-top-right-radius:var(--bs-card-inner-border-radius)}.card>.list-group:last-child{border-bottom-width:0;border-bottom-right-radius:var(--bs-card-inner-border-radius);border-bottom-left-radius:var(--bs-card-inner-border-radius)}.card>.card-header+.list-group,.card>.list-group+.card-footer{border-top:0}.card-body{flex:1 1 auto;padding:var(--bs-card-spacer-y) var(--bs-card-spacer-x);color:var(--bs-card-color)}.card-title{margin-bottom:var(--bs-card-title-spacer-y);color:var(--bs-card-title-color)}.card-subtitle{margin-top:calc(-.5 * var(--bs-card-title-spacer-y));margin-bottom:0;color:var(--bs-card-subtitle-color)}.card-text:last-child{margin-bottom:0}.card-link+.card-link{margin-left:var(--bs-card-spacer-x)}.card-header{padding:var(--bs-card-cap-padding-y) var(--bs-card-cap-padding-x);margin-bottom:0;color:var(--bs-card-cap-color);background-color:var(--bs-card-cap-bg);border-bottom:var(--bs-card-border-width) solid var(--bs-card-border-color)}.card-header:first-child{border-radius:var(--bs-card-inner-border-radius) var(--bs-card-inner-border-radius) 0 0}.card-footer{padding:var(--bs-card-cap-padding-y) var(--bs-card-cap-padding-x);color:var(--bs-card-cap-color);background-color:var(--bs-card-cap-bg);border-top:var(--bs-card-border-width) solid var(--bs-card-border-color)}.card-footer:last-child{border-radius:0 0 var(--bs-card-inner-border-radius) var(--bs-card-inner-border-radius)}.card-header-tabs{margin-right:calc(-.5 * var(--bs-card-cap-padding-x));margin-bottom:calc(-1 * var(--bs-card-cap-padding-y));margin-left:calc(-.5 * var(--bs-card-cap-padding-x));border-bottom:0}.card-header-tabs .nav-link.active{background-color:var(--bs-card-bg);border-bottom-color:var(--bs-card-bg)}.card-header-pills{margin-right:calc(-.5 * var(--bs-card-cap-padding-x));margin-left:calc(-.5 * var(--bs-card-cap-padding-x))}.card-img-overlay{position:absolute;top:0;right:0;bottom:0;left:0;padding:var(--bs-card-img-overlay-padding);border-radius:var(--bs-card-inner-border-radius)}.card-img,.card-img-bottom,.card-img-top{width:100%}.card-img,.card-img-top{border-top-left-radius:var(--bs-card-inner-border-radius);border-top-right-radius:var(--bs-card-inner-border-radius)}.card-img,.card-img-bottom{border-bottom-right-radius:var(--bs-card-inner-border-radius);border-bottom-left-radius:var(--bs-card-inner-border-radius)}.card-group>.card{margin-bottom:var(--bs-card-group-margin)}@media (min-width:576px){.card-group{display:flex;flex-flow:row wrap}.card-group>.card{flex:1 0 0%;margin-bottom:0}.card-group>.card+.card{margin-left:0;border-left:0}.card-group>.card:not(:last-child){border-top-right-radius:0;border-bottom-right-radius:0}.card-group>.card:not(:last-child) .card-header,.card-group>.card:not(:last-child) .card-img-top{border-top-right-radius:0}.card-group>.card:not(:last-child) .card-footer,.card-group>.card:not(:last-child) .card-img-bottom{border-bottom-right-radius:0}.card-group>.card:not(:first-child){border-top-left-radius:0;border-bottom-left-radius:0}.card-group>.card:not(:first-child) .card-header,.card-group>.card:not(:first-child) .card-img-top{border-top-left-radius:0}.card-group>.card:not(:first-child) .card-footer,.card-group>.card:not(:first-child) .card-img-bottom{border-bottom-left-radius:0}}.accordion{--bs-accordion-color:var(--bs-body-color);--bs-accordion-bg:var(--bs-body-bg);--bs-accordion-transition:color 0.15s ease-in-out,background-color 0.15s ease-in-out,border-color 0.15s ease-in-out,box-shadow 0.15s ease-in-out,border-radius 0.15s ease;--bs-accordion-border-color:var(--bs-border-color);--bs-accordion-border-width:var(--bs-border-width);--bs-accordion-border-radius:var(--bs-border-radius);--bs-accordion-inner-border-radius:calc(var(--bs-border-radius) - (var(--bs-border-width)));--bs-accordion-btn-padding-x:1.25rem;--bs-accordion-btn-padding-y:1rem;--bs-accordion-btn-color:var(--bs-body-color);--bs-accordion-btn-bg:var(--bs-accordion-bg);--bs-accordion-btn-icon:url(${U});--bs-accordion-btn-icon-width:1.25rem;--bs-accordion-btn-icon-transform:rotate(-180deg);--bs-accordion-btn-icon-transition:transform 0.2s ease-in-out;--bs-accordion-btn-active-icon:url(${V});--bs-accordion-btn-focus-box-shadow:0 0 0 0.25rem rgba(13, 110, 253, 0.25);--bs-accordion-body-padding-x:1.25rem;--bs-accordion-body-padding-y:1rem;--bs-accordion-active-color:var(--bs-primary-text-emphasis);--bs-accordion-active-bg:var(--bs-primary-bg-subtle)}.accordion-button{position:relative;display:flex;align-items:center;width:100%;padding:var(--bs-accordion-btn-padding-y) var(--bs-accordion-btn-padding-x);font-size:1rem;color:var(--bs-accordion-btn-color);text-align:left;background-color:var(--bs-accordion-btn-bg);border:0;border-radius:0;overflow-anchor:none;transition:var(--bs-accordion-transition)}@media (prefers-reduced-motion:reduce){.accordion-button{transition:none}}.accordion-button:not(.collapsed){color:var(--bs-accordion-active-color);background-color:var(--bs-accordion-active-bg);box-shadow:inset 0 calc(-1 * var(--bs-accordion-border-width)) 0 var(--bs-accordion-border-color)}.accordion-button:not(.collapsed)::after{background-image:var(--bs-accordion-btn-active-icon);transform:var(--bs-accordion-btn-icon-transform)}.accordion-button::after{flex-shrink:0;width:var(--bs-accordion-btn-icon-width);height:var(--bs-accordion-btn-icon-width);margin-left:auto;content:"";background-image:var(--bs-accordion-btn-icon);background-repeat:no-repeat;background-size:var(--bs-accordion-btn-icon-width);transition:var(--bs-accordion-btn-icon-transition)}@media (prefers-reduced-motion:reduce){.accordion-button::after{transition:none}}.accordion-button:hover{z-index:2}.accordion-button:focus{z-index:3;outline:0;box-shadow:var(--bs-accordion-btn-focus-box-shadow)}.accordion-header{margin-bottom:0}.accordion-item{color:var(--bs-accordion-color);background-color:var(--bs-accordion-bg);border:var(--bs-accordion-border-width) solid var(--bs-accordion-border-color)}.accordion-item:first-of-type{border-top-left-radius:var(--bs-accordion-border-radius);border-top-right-radius:var(--bs-accordion-border-radius)}.accordion-item:first-of-type>.accordion-header .accordion-button{border-top-left-radius:var(--bs-accordion-inner-border-radius);border-top-right-radius:var(--bs-accordion-inner-border-radius)}.accordion-item:not(:first-of-type){border-top:0}.accordion-item:last-of-type{border-bottom-right-radius:var(--bs-accordion-border-radius);border-bottom-left-radius:var(--bs-accordion-border-radius)}.accordion-item:last-of-type>.accordion-header .accordion-button.collapsed{border-bottom-right-radius:var(--bs-accordion-inner-border-radius);border-bottom-left-radius:var(--bs-accordion-inner-border-radius)}.accordion-item:last-of-type>.accordion-collapse{border-bottom-right-radius:var(--bs-accordion-border-radius);border-bottom-left-radius:var(--bs-accordion-border-radius)}.accordion-body{padding:var(--bs-accordion-body-padding-y) var(--bs-accordion-body-padding-x)}.accordion-flush>.accordion-item{border-right:0;border-left:0;border-radius:0}.accordion-flush>.accordion-item:first-child{border-top:0}.accordion-flush>.accordion-item:last-child{border-bottom:0}.accordion-flush>.accordion-item>.accordion-header .accordion-button,.accordion-flush>.accordion-item>.accordion-header .accordion-button.collapsed{border-radius:0}.accordion-flush>.accordion-item>.accordion-collapse{border-radius:0}[data-bs-theme=dark] .accordion-button::after{--bs-accordion-btn-icon:url(${W});--bs-accordion-btn-active-icon:url(${W})}.breadcrumb{--bs-breadcrumb-padding-x:0;--bs-breadcrumb-padding-y:0;--bs-breadcrumb-margin-bottom:1rem;--bs-breadcrumb-bg: ;--bs-breadcrumb-border-radius: ;--bs-breadcrumb-divider-color:var(--bs-secondary-color);--bs-breadcrumb-item-padding-x:0.5rem;--bs-breadcrumb-item-active-color:var(--bs-secondary-color);display:flex;flex-wrap:wrap;padding:var(--bs-breadcrumb-padding-y) var(--bs-breadcrumb-padding-x);margin-bottom:var(--bs-breadcrumb-margin-bottom);font-size:var(--bs-breadcrumb-font-size);list-style:none;background-color:var(--bs-breadcrumb-bg);border-radius:var(--bs-breadcrumb-border-radius)}.breadcrumb-item+.breadcrumb-item{padding-left:var(--bs-breadcrumb-item-padding-x)}.breadcrumb-item+.breadcrumb-item::before{float:left;padding-right:var(--bs-breadcrumb-item-padding-x);color:var(--bs-breadcrumb-divider-color);content:var(--bs-breadcrumb-divider, "/")}.breadcrumb-item.active{color:var(--bs-breadcrumb-item-active-color)}.pagination{--bs-pagination-padding-x:0.75rem;--bs-pagination-padding-y:0.375rem;--bs-pagination-font-size:1rem;--bs-pagination-color:var(--bs-link-color);--bs-pagination-bg:var(--bs-body-bg);--bs-pagination-border-width:var(--bs-border-width);--bs-pagination-border-color:var(--bs-border-color);--bs-pagination-border-radius:var(--bs-border-radius);--bs-pagination-hover-color:var(--bs-link-hover-color);--bs-pagination-hover-bg:var(--bs-tertiary-bg);--bs-pagination-hover-border-color:var(--bs-border-color);--bs-pagination-focus-color:var(--bs-link-hover-color);--bs-pagination-focus-bg:var(--bs-secondary-bg);--bs-pagination-focus-box-shadow:0 0 0 0.25rem rgba(13, 110, 253, 0.25);--bs-pagination-active-color:#fff;--bs-pagination-active-bg:#0d6efd;--bs-pagination-active-border-color:#0d6efd;--bs-pagination-disabled-color:var(--bs-secondary-color);--bs-pagination-disabled-bg:var(--bs-secondary-bg);--bs-pagination-disabled-border-color:var(--bs-border-color);display:flex;padding-left:0;list-style:none}.page-link{position:relative;display:block;padding:var(--bs-pagination-padding-y) var(--bs-pagination-padding-x);font-size:var(--bs-pagination-font-size);color:var(--bs-pagination-color);text-decoration:none;background-color:var(--bs-pagination-bg);border:var(--bs-pagination-border-width) solid var(--bs-pagination-border-color);transition:color .15s ease-in-out,background-color .15s ease-in-out,border-color .15s ease-in-out,box-shadow .15s ease-in-out}@media (prefers-reduced-motion:reduce){.page-link{transition:none}}.page-link:hover{z-index:2;color:var(--bs-pagination-hover-color);background-color:var(--bs-pagination-hover-bg);border-color:var(--bs-pagination-hover-border-color)}.page-link:focus{z-index:3;color:var(--bs-pagination-focus-color);background-color:var(--bs-pagination-focus-bg);outline:0;box-shadow:var(--bs-pagination-focus-box-shadow)}.active>.page-link,.page-link.active{z-index:3;color:var(--bs-pagination-active-color);background-color:var(--bs-pagination-active-bg);border-color:var(--bs-pagination-active-border-color)}.disabled>.page-link,.page-link.disabled{color:var(--bs-pagination-disabled-color);pointer-events:none;background-color:var(--bs-pagination-disabled-bg);border-color:var(--bs-pagination-disabled-border-color)}.page-item:not(:first-child) .page-link{margin-left:calc(var(--bs-border-width) * -1)}.page-item:first-child .page-link{border-top-left-radius:var(--bs-pagination-border-radius);border-bottom-left-radius:var(--bs-pagination-border-radius)}.page-item:last-child .page-link{border-top-right-radius:var(--bs-pagination-border-radius);border-bottom-right-radius:var(--bs-pagination-border-radius)}.pagination-lg{--bs-pagination-padding-x:1.5rem;--bs-pagination-padding-y:0.75rem;--bs-pagination-font-size:1.25rem;--bs-pagination-border-radius:var(--bs-border-radius-lg)}.pagination-sm{--bs-pagination-padding-x:0.5rem;--bs-pagination-padding-y:0.25rem;--bs-pagination-font-size:0.875rem;--bs-pagination-border-radius:var(--bs-border-radius-sm)}.badge{--bs-badge-padding-x:0.65em;--bs-badge-padding-y:0.35em;--bs-badge-font-size:0.75em;--bs-badge-font-weight:700;--bs-badge-color:#fff;--bs-badge-border-radius:var(--bs-border-radius);display:inline-block;padding:var(--bs-badge-padding-y) var(--bs-badge-padding-x);font-size:var(--bs-badge-font-size);font-weight:var(--bs-badge-font-weight);line-height:1;color:var(--bs-badge-color);text-align:center;white-space:nowrap;vertical-align:baseline;border-radius:var(--bs-badge-border-radius)}.badge:empty{display:none}.btn .badge{position:relative;top:-1px}.alert{--bs-alert-bg:transparent;--bs-alert-padding-x:1rem;--bs-alert-padding-y:1rem;--bs-alert-margin-bottom:1rem;--bs-alert-color:inherit;--bs-alert-border-color:transparent;--bs-alert-border:var(--bs-border-width) solid var(--bs-alert-border-color);--bs-alert-border-radius:var(--bs-border-radius);--bs-alert-link-color:inherit;position:relative;padding:var(--bs-alert-padding-y) var(--bs-alert-padding-x);margin-bottom:var(--bs-alert-margin-bottom);color:var(--bs-alert-color);background-color:var(--bs-alert-bg);border:var(--bs-alert-border);border-radius:var(--bs-alert-border-radius)}.alert-heading{color:inherit}.alert-link{font-weight:700;color:var(--bs-alert-link-color)}.alert-dismissible{padding-right:3rem}.alert-dismissible .btn-close{position:absolute;top:0;right:0;z-index:2;padding:1.25rem 1rem}.alert-primary{--bs-alert-color:var(--bs-primary-text-emphasis);--bs-alert-bg:var(--bs-primary-bg-subtle);--bs-alert-border-color:var(--bs-primary-border-subtle);--bs-alert-link-color:var(--bs-primary-text-emphasis)}.alert-secondary{--bs-alert-color:var(--bs-secondary-text-emphasis);--bs-alert-bg:var(--bs-secondary-bg-subtle);--bs-alert-border-color:var(--bs-secondary-border-subtle);--bs-alert-link-color:var(--bs-secondary-text-emphasis)}.alert-success{--bs-alert-color:var(--bs-success-text-emphasis);--bs-alert-bg:var(--bs-success-bg-subtle);--bs-alert-border-color:var(--bs-success-border-subtle);--bs-alert-link-color:var(--bs-success-text-emphasis)}.alert-info{--bs-alert-color:var(--bs-info-text-emphasis);--bs-alert-bg:var(--bs-info-bg-subtle);--bs-alert-border-color:var(--bs-info-border-subtle);--bs-alert-link-color:var(--bs-info-text-emphasis)}.alert-warning{--bs-alert-color:var(--bs-warning-text-emphasis);--bs-alert-bg:var(--bs-warning-bg-subtle);--bs-alert-border-color:var(--bs-warning-border-subtle);--bs-alert-link-color:var(--bs-warning-text-emphasis)}.alert-danger{--bs-alert-color:var(--bs-danger-text-emphasis);--bs-alert-bg:var(--bs-danger-bg-subtle);--bs-alert-border-color:var(--bs-danger-border-subtle);--bs-alert-link-color:var(--bs-danger-text-emphasis)}.alert-light{--bs-alert-color:var(--bs-light-text-emphasis);--bs-alert-bg:var(--bs-light-bg-subtle);--bs-alert-border-color:var(--bs-light-border-subtle);--bs-alert-link-color:var(--bs-light-text-emphasis)}.alert-dark{--bs-alert-color:var(--bs-dark-text-emphasis);--bs-alert-bg:var(--bs-dark-bg-subtle);--bs-alert-border-color:var(--bs-dark-border-subtle);--bs-alert-link-color:var(--bs-dark-text-emphasis)}@keyframes progress-bar-stripes{0%{background-position-x:1rem}}.progress,.progress-stacked{--bs-progress-height:1rem;--bs-progress-font-size:0.75rem;--bs-progress-bg:var(--bs-secondary-bg);--bs-progress-border-radius:var(--bs-border-radius);--bs-progress-box-shadow:var(--bs-box-shadow-inset);--bs-progress-bar-color:#fff;--bs-progress-bar-bg:#0d6efd;--bs-progress-bar-transition:width 0.6s ease;display:flex;height:var(--bs-progress-height);overflow:hidden;font-size:var(--bs-progress-font-size);background-color:var(--bs-progress-bg);border-radius:var(--bs-progress-border-radius)}.progress-bar{display:flex;flex-direction:column;justify-content:center;overflow:hidden;color:var(--bs-progress-bar-color);text-align:center;white-space:nowrap;background-color:var(--bs-progress-bar-bg);transition:var(--bs-progress-bar-transition)}@media (prefers-reduced-motion:reduce){.progress-bar{transition:none}}.progress-bar-striped{background-image:linear-gradient(45deg,rgba(255,255,255,.15) 25%,transparent 25%,transparent 50%,rgba(255,255,255,.15) 50%,rgba(255,255,255,.15) 75%,transparent 75%,transparent);background-size:var(--bs-progress-height) var(--bs-progress-height)}.progress-stacked>.progress{overflow:visible}.progress-stacked>.progress>.progress-bar{width:100%}.progress-bar-animated{animation:1s linear infinite progress-bar-stripes}@media (prefers-reduced-motion:reduce){.progress-bar-animated{animation:none}}.list-group{--bs-list-group-color:var(--bs-body-color);--bs-list-group-bg:var(--bs-body-bg);--bs-list-group-border-color:var(--bs-border-color);--bs-list-group-border-width:var(--bs-border-width);--bs-list-group-border-radius:var(--bs-border-radius);--bs-list-group-item-padding-x:1rem;--bs-list-group-item-padding-y:0.5rem;--bs-list-group-action-color:var(--bs-secondary-color);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-tertiary-bg);--bs-list-group-action-active-color:var(--bs-body-color);--bs-list-group-action-active-bg:var(--bs-secondary-bg);--bs-list-group-disabled-color:var(--bs-secondary-color);--bs-list-group-disabled-bg:var(--bs-body-bg);--bs-list-group-active-color:#fff;--bs-list-group-active-bg:#0d6efd;--bs-list-group-active-border-color:#0d6efd;display:flex;flex-direction:column;padding-left:0;margin-bottom:0;border-radius:var(--bs-list-group-border-radius)}.list-group-numbered{list-style-type:none;counter-reset:section}.list-group-numbered>.list-group-item::before{content:counters(section, ".") ". ";counter-increment:section}.list-group-item-action{width:100%;color:var(--bs-list-group-action-color);text-align:inherit}.list-group-item-action:focus,.list-group-item-action:hover{z-index:1;color:var(--bs-list-group-action-hover-color);text-decoration:none;background-color:var(--bs-list-group-action-hover-bg)}.list-group-item-action:active{color:var(--bs-list-group-action-active-color);background-color:var(--bs-list-group-action-active-bg)}.list-group-item{position:relative;display:block;padding:var(--bs-list-group-item-padding-y) var(--bs-list-group-item-padding-x);color:var(--bs-list-group-color);text-decoration:none;background-color:var(--bs-list-group-bg);border:var(--bs-list-group-border-width) solid var(--bs-list-group-border-color)}.list-group-item:first-child{border-top-left-radius:inherit;border-top-right-radius:inherit}.list-group-item:last-child{border-bottom-right-radius:inherit;border-bottom-left-radius:inherit}.list-group-item.disabled,.list-group-item:disabled{color:var(--bs-list-group-disabled-color);pointer-events:none;background-color:var(--bs-list-group-disabled-bg)}.list-group-item.active{z-index:2;color:var(--bs-list-group-active-color);background-color:var(--bs-list-group-active-bg);border-color:var(--bs-list-group-active-border-color)}.list-group-item+.list-group-item{border-top-width:0}.list-group-item+.list-group-item.active{margin-top:calc(-1 * var(--bs-list-group-border-width));border-top-width:var(--bs-list-group-border-width)}.list-group-horizontal{flex-direction:row}.list-group-horizontal>.list-group-item:first-child:not(:last-child){border-bottom-left-radius:var(--bs-list-group-border-radius);border-top-right-radius:0}.list-group-horizontal>.list-group-item:last-child:not(:first-child){border-top-right-radius:var(--bs-list-group-border-radius);border-bottom-left-radius:0}.list-group-horizontal>.list-group-item.active{margin-top:0}.list-group-horizontal>.list-group-item+.list-group-item{border-top-width:var(--bs-list-group-border-width);border-left-width:0}.list-group-horizontal>.list-group-item+.list-group-item.active{margin-left:calc(-1 * var(--bs-list-group-border-width));border-left-width:var(--bs-list-group-border-width)}@media (min-width:576px){.list-group-horizontal-sm{flex-direction:row}.list-group-horizontal-sm>.list-group-item:first-child:not(:last-child){border-bottom-left-radius:var(--bs-list-group-border-radius);border-top-right-radius:0}.list-group-horizontal-sm>.list-group-item:last-child:not(:first-child){border-top-right-radius:var(--bs-list-group-border-radius);border-bottom-left-radius:0}.list-group-horizontal-sm>.list-group-item.active{margin-top:0}.list-group-horizontal-sm>.list-group-item+.list-group-item{border-top-width:var(--bs-list-group-border-width);border-left-width:0}.list-group-horizontal-sm>.list-group-item+.list-group-item.active{margin-left:calc(-1 * var(--bs-list-group-border-width));border-left-width:var(--bs-list-group-border-width)}}@media (min-width:768px){.list-group-horizontal-md{flex-direction:row}.list-group-horizontal-md>.list-group-item:first-child:not(:last-child){border-bottom-left-radius:var(--bs-list-group-border-radius);border-top-right-radius:0}.list-group-horizontal-md>.list-group-item:last-child:not(:first-child){border-top-right-radius:var(--bs-list-group-border-radius);border-bottom-left-radius:0}.list-group-horizontal-md>.list-group-item.active{margin-top:0}.list-group-horizontal-md>.list-group-item+.list-group-item{border-top-width:var(--bs-list-group-border-width);border-left-width:0}.list-group-horizontal-md>.list-group-item+.list-group-item.active{margin-left:calc(-1 * var(--bs-list-group-border-width));border-left-width:var(--bs-list-group-border-width)}}@media (min-width:992px){.list-group-horizontal-lg{flex-direction:row}.list-group-horizontal-lg>.list-group-item:first-child:not(:last-child){border-bottom-left-radius:var(--bs-list-group-border-radius);border-top-right-radius:0}.list-group-horizontal-lg>.list-group-item:last-child:not(:first-child){border-top-right-radius:var(--bs-list-group-border-radius);border-bottom-left-radius:0}.list-group-horizontal-lg>.list-group-item.active{margin-top:0}.list-group-horizontal-lg>.list-group-item+.list-group-item{border-top-width:var(--bs-list-group-border-width);border-left-width:0}.list-group-horizontal-lg>.list-group-item+.list-group-item.active{margin-left:calc(-1 * var(--bs-list-group-border-width));border-left-width:var(--bs-list-group-border-width)}}@media (min-width:1200px){.list-group-horizontal-xl{flex-direction:row}.list-group-horizontal-xl>.list-group-item:first-child:not(:last-child){border-bottom-left-radius:var(--bs-list-group-border-radius);border-top-right-radius:0}.list-group-horizontal-xl>.list-group-item:last-child:not(:first-child){border-top-right-radius:var(--bs-list-group-border-radius);border-bottom-left-radius:0}.list-group-horizontal-xl>.list-group-item.active{margin-top:0}.list-group-horizontal-xl>.list-group-item+.list-group-item{border-top-width:var(--bs-list-group-border-width);border-left-width:0}.list-group-horizontal-xl>.list-group-item+.list-group-item.active{margin-left:calc(-1 * var(--bs-list-group-border-width));border-left-width:var(--bs-list-group-border-width)}}@media (min-width:1400px){.list-group-horizontal-xxl{flex-direction:row}.list-group-horizontal-xxl>.list-group-item:first-child:not(:last-child){border-bottom-left-radius:var(--bs-list-group-border-radius);border-top-right-radius:0}.list-group-horizontal-xxl>.list-group-item:last-child:not(:first-child){border-top-right-radius:var(--bs-list-group-border-radius);border-bottom-left-radius:0}.list-group-horizontal-xxl>.list-group-item.active{margin-top:0}.list-group-horizontal-xxl>.list-group-item+.list-group-item{border-top-width:var(--bs-list-group-border-width);border-left-width:0}.list-group-horizontal-xxl>.list-group-item+.list-group-item.active{margin-left:calc(-1 * var(--bs-list-group-border-width));border-left-width:var(--bs-list-group-border-width)}}.list-group-flush{border-radius:0}.list-group-flush>.list-group-item{border-width:0 0 var(--bs-list-group-border-width)}.list-group-flush>.list-group-item:last-child{border-bottom-width:0}.list-group-item-primary{--bs-list-group-color:var(--bs-primary-text-emphasis);--bs-list-group-bg:var(--bs-primary-bg-subtle);--bs-list-group-border-color:var(--bs-primary-border-subtle);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-primary-border-subtle);--bs-list-group-action-active-color:var(--bs-emphasis-color);--bs-list-group-action-active-bg:var(--bs-primary-border-subtle);--bs-list-group-active-color:var(--bs-primary-bg-subtle);--bs-list-group-active-bg:var(--bs-primary-text-emphasis);--bs-list-group-active-border-color:var(--bs-primary-text-emphasis)}.list-group-item-secondary{--bs-list-group-color:var(--bs-secondary-text-emphasis);--bs-list-group-bg:var(--bs-secondary-bg-subtle);--bs-list-group-border-color:var(--bs-secondary-border-subtle);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-secondary-border-subtle);--bs-list-group-action-active-color:var(--bs-emphasis-color);--bs-list-group-action-active-bg:var(--bs-secondary-border-subtle);--bs-list-group-active-color:var(--bs-secondary-bg-subtle);--bs-list-group-active-bg:var(--bs-secondary-text-emphasis);--bs-list-group-active-border-color:var(--bs-secondary-text-emphasis)}.list-group-item-success{--bs-list-group-color:var(--bs-success-text-emphasis);--bs-list-group-bg:var(--bs-success-bg-subtle);--bs-list-group-border-color:var(--bs-success-border-subtle);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-success-border-subtle);--bs-list-group-action-active-color:var(--bs-emphasis-color);--bs-list-group-action-active-bg:var(--bs-success-border-subtle);--bs-list-group-active-color:var(--bs-success-bg-subtle);--bs-list-group-active-bg:var(--bs-success-text-emphasis);--bs-list-group-active-border-color:var(--bs-success-text-emphasis)}.list-group-item-info{--bs-list-group-color:var(--bs-info-text-emphasis);--bs-list-group-bg:var(--bs-info-bg-subtle);--bs-list-group-border-color:var(--bs-info-border-subtle);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-info-border-subtle);--bs-list-group-action-active-color:var(--bs-emphasis-color);--bs-list-group-action-active-bg:var(--bs-info-border-subtle);--bs-list-group-active-color:var(--bs-info-bg-subtle);--bs-list-group-active-bg:var(--bs-info-text-emphasis);--bs-list-group-active-border-color:var(--bs-info-text-emphasis)}.list-group-item-warning{--bs-list-group-color:var(--bs-warning-text-emphasis);--bs-list-group-bg:var(--bs-warning-bg-subtle);--bs-list-group-border-color:var(--bs-warning-border-subtle);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-warning-border-subtle);--bs-list-group-action-active-color:var(--bs-emphasis-color);--bs-list-group-action-active-bg:var(--bs-warning-border-subtle);--bs-list-group-active-color:var(--bs-warning-bg-subtle);--bs-list-group-active-bg:var(--bs-warning-text-emphasis);--bs-list-group-active-border-color:var(--bs-warning-text-emphasis)}.list-group-item-danger{--bs-list-group-color:var(--bs-danger-text-emphasis);--bs-list-group-bg:var(--bs-danger-bg-subtle);--bs-list-group-border-color:var(--bs-danger-border-subtle);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-danger-border-subtle);--bs-list-group-action-active-color:var(--bs-emphasis-color);--bs-list-group-action-active-bg:var(--bs-danger-border-subtle);--bs-list-group-active-color:var(--bs-danger-bg-subtle);--bs-list-group-active-bg:var(--bs-danger-text-emphasis);--bs-list-group-active-border-color:var(--bs-danger-text-emphasis)}.list-group-item-light{--bs-list-group-color:var(--bs-light-text-emphasis);--bs-list-group-bg:var(--bs-light-bg-subtle);--bs-list-group-border-color:var(--bs-light-border-subtle);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-light-border-subtle);--bs-list-group-action-active-color:var(--bs-emphasis-color);--bs-list-group-action-active-bg:var(--bs-light-border-subtle);--bs-list-group-active-color:var(--bs-light-bg-subtle);--bs-list-group-active-bg:var(--bs-light-text-emphasis);--bs-list-group-active-border-color:var(--bs-light-text-emphasis)}.list-group-item-dark{--bs-list-group-color:var(--bs-dark-text-emphasis);--bs-list-group-bg:var(--bs-dark-bg-subtle);--bs-list-group-border-color:var(--bs-dark-border-subtle);--bs-list-group-action-hover-color:var(--bs-emphasis-color);--bs-list-group-action-hover-bg:var(--bs-dark-border-subtle);--bs-list-group-action-active-color:var(--bs-emphasis-color);--bs-list-group-action-active-bg:var(--bs-dark-border-subtle);--bs-list-group-active-color:var(--bs-dark-bg-subtle);--bs-list-group-active-bg:var(--bs-dark-text-emphasis);--bs-list-group-active-border-color:var(--bs-dark-text-emphasis)}.btn-close{--bs-btn-close-color:#000;--bs-btn-close-bg:url(${H});--bs-btn-close-opacity:0.5;--bs-btn-close-hover-opacity:0.75;--bs-btn-close-focus-shadow:0 0 0 0.25rem rgba(13, 110, 253, 0.25);--bs-btn-close-focus-opacity:1;--bs-btn-close-disabled-opacity:0.25;--bs-btn-close-white-filter:invert(1) grayscale(100%) brightness(200%);box-sizing:content-box;width:1em;height:1em;padding:.25em .25em;color:var(--bs-btn-close-color);background:transparent var(--bs-btn-close-bg) center/1em auto no-repeat;border:0;border-radius:.375rem;opacity:var(--bs-btn-close-opacity)}.btn-close:hover{color:var(--bs-btn-close-color);text-decoration:none;opacity:var(--bs-btn-close-hover-opacity)}.btn-close:focus{outline:0;box-shadow:var(--bs-btn-close-focus-shadow);opacity:var(--bs-btn-close-focus-opacity)}.btn-close.disabled,.btn-close:disabled{pointer-events:none;-webkit-user-select:none;-moz-user-select:none;user-select:none;opacity:var(--bs-btn-close-disabled-opacity)}.btn-close-white{filter:var(--bs-btn-close-white-filter)}[data-bs-theme=dark] .btn-close{filter:var(--bs-btn-close-white-filter)}.toast{--bs-toast-zindex:1090;--bs-toast-padding-x:0.75rem;--bs-toast-padding-y:0.5rem;--bs-toast-spacing:1.5rem;--bs-toast-max-width:350px;--bs-toast-font-size:0.875rem;--bs-toast-color: ;--bs-toast-bg:rgba(var(--bs-body-bg-rgb), 0.85);--bs-toast-border-width:var(--bs-border-width);--bs-toast-border-color:var(--bs-border-color-translucent);--bs-toast-border-radius:var(--bs-border-radius);--bs-toast-box-shadow:var(--bs-box-shadow);--bs-toast-header-color:var(--bs-secondary-color);--bs-toast-header-bg:rgba(var(--bs-body-bg-rgb), 0.85);--bs-toast-header-border-color:var(--bs-border-color-translucent);width:var(--bs-toast-max-width);max-width:100%;font-size:var(--bs-toast-font-size);color:var(--bs-toast-color);pointer-events:auto;background-color:var(--bs-toast-bg);background-clip:padding-box;border:var(--bs-toast-border-width) solid var(--bs-toast-border-color);box-shadow:var(--bs-toast-box-shadow);border-radius:var(--bs-toast-border-radius)}.toast.showing{opacity:0}.toast:not(.show){display:none}.toast-container{--bs-toast-zindex:1090;position:absolute;z-index:var(--bs-toast-zindex);width:-webkit-max-content;width:-moz-max-content;width:max-content;max-width:100%;pointer-events:none}.toast-container>:not(:last-child){margin-bottom:var(--bs-toast-spacing)}.toast-header{display:flex;align-items:center;padding:var(--bs-toast-padding-y) var(--bs-toast-padding-x);color:var(--bs-toast-header-color);background-color:var(--bs-toast-header-bg);background-clip:padding-box;border-bottom:var(--bs-toast-border-width) solid var(--bs-toast-header-border-color);border-top-left-radius:calc(var(--bs-toast-border-radius) - var(--bs-toast-border-width));border-top-right-radius:calc(var(--bs-toast-border-radius) - var(--bs-toast-border-width))}.toast-header .btn-close{margin-right:calc(-.5 * var(--bs-toast-padding-x));margin-left:var(--bs-toast-padding-x)}.toast-body{padding:var(--bs-toast-padding-x);word-wrap:break-word}.modal{--bs-modal-zindex:1055;--bs-modal-width:500px;--bs-modal-padding:1rem;--bs-modal-margin:0.5rem;--bs-modal-color: ;--bs-modal-bg:var(--bs-body-bg);--bs-modal-border-color:var(--bs-border-color-translucent);--bs-modal-border-width:var(--bs-border-width);--bs-modal-border-radius:var(--bs-border-radius-lg);--bs-modal-box-shadow:var(--bs-box-shadow-sm);--bs-modal-inner-border-radius:calc(var(--bs-border-radius-lg) - (var(--bs-border-width)));--bs-modal-header-padding-x:1rem;--bs-modal-header-padding-y:1rem;--bs-modal-header-padding:1rem 1rem;--bs-modal-header-border-color:var(--bs-border-color);--bs-modal-header-border-width:var(--bs-border-width);--bs-modal-title-line-height:1.5;--bs-modal-footer-gap:0.5rem;--bs-modal-footer-bg: ;--bs-modal-footer-border-color:var(--bs-border-color);--bs-modal-footer-border-width:var(--bs-border-width);position:fixed;top:0;left:0;z-index:var(--bs-modal-zindex);display:none;width:100%;height:100%;overflow-x:hidden;overflow-y:auto;outline:0}.modal-dialog{position:relative;width:auto;margin:var(--bs-modal-margin);pointer-events:none}.modal.fade .modal-dialog{transition:transform .3s ease-out;transform:translate(0,-50px)}@media (prefers-reduced-motion:reduce){.modal.fade .modal-dialog{transition:none}}.modal.show .modal-dialog{transform:none}.modal.modal-static .modal-dialog{transform:scale(1.02)}.modal-dialog-scrollable{height:calc(100% - var(--bs-modal-margin) * 2)}.modal-dialog-scrollable .modal-content{max-height:100%;overflow:hidden}.modal-dialog-scrollable .modal-body{overflow-y:auto}.modal-dialog-centered{display:flex;align-items:center;min-height:calc(100% - var(--bs-modal-margin) * 2)}.modal-content{position:relative;display:flex;flex-direction:column;width:100%;color:var(--bs-modal-color);pointer-events:auto;background-color:var(--bs-modal-bg);background-clip:padding-box;border:var(--bs-modal-border-width) solid var(--bs-modal-border-color);border-radius:var(--bs-modal-border-radius);outline:0}.modal-backdrop{--bs-backdrop-zindex:1050;--bs-backdrop-bg:#000;--bs-backdrop-opacity:0.5;position:fixed;top:0;left:0;z-index:var(--bs-backdrop-zindex);width:100vw;height:100vh;background-color:var(--bs-backdrop-bg)}.modal-backdrop.fade{opacity:0}.modal-backdrop.show{opacity:var(--bs-backdrop-opacity)}.modal-header{display:flex;flex-shrink:0;align-items:center;padding:var(--bs-modal-header-padding);border-bottom:var(--bs-modal-header-border-width) solid var(--bs-modal-header-border-color);border-top-left-radius:var(--bs-modal-inner-border-radius);border-top-right-radius:var(--bs-modal-inner-border-radius)}.modal-header .btn-close{padding:calc(var(--bs-modal-header-padding-y) * .5) calc(var(--bs-modal-header-padding-x) * .5);margin:calc(-.5 * var(--bs-modal-header-padding-y)) calc(-.5 * var(--bs-modal-header-padding-x)) calc(-.5 * var(--bs-modal-header-padding-y)) auto}.modal-title{margin-bottom:0;line-height:var(--bs-modal-title-line-height)}.modal-body{position:relative;flex:1 1 auto;padding:var(--bs-modal-padding)}.modal-footer{display:flex;flex-shrink:0;flex-wrap:wrap;align-items:center;justify-content:flex-end;padding:calc(var(--bs-modal-padding) - var(--bs-modal-footer-gap) * .5);background-color:var(--bs-modal-footer-bg);border-top:var(--bs-modal-footer-border-width) solid var(--bs-modal-footer-border-color);border-bottom-right-radius:var(--bs-modal-inner-border-radius);border-bottom-left-radius:var(--bs-modal-inner-border-radius)}.modal-footer>*{margin:calc(var(--bs-modal-footer-gap) * .5)}@media (min-width:576px){.modal{--bs-modal-margin:1.75rem;--bs-modal-box-shadow:var(--bs-box-shadow)}.modal-dialog{max-width:var(--bs-modal-width);margin-right:auto;margin-left:auto}.modal-sm{--bs-modal-width:300px}}@media (min-width:992px){.modal-lg,.modal-xl{--bs-modal-width:800px}}@media (min-width:1200px){.modal-xl{--bs-modal-width:1140px}}.modal-fullscreen{width:100vw;max-width:none;height:100%;margin:0}.modal-fullscreen .modal-content{height:100%;border:0;border-radius:0}.modal-fullscreen .modal-footer,.modal-fullscreen .modal-header{border-radius:0}.modal-fullscreen .modal-body{overflow-y:auto}@media (max-width:575.98px){.modal-fullscreen-sm-down{width:100vw;max-width:none;height:100%;margin:0}.modal-fullscreen-sm-down .modal-content{height:100%;border:0;border-radius:0}.modal-fullscreen-sm-down .modal-footer,.modal-fullscreen-sm-down .modal-header{border-radius:0}.modal-fullscreen-sm-down .modal-body{overflow-y:auto}}@media (max-width:767.98px){.modal-fullscreen-md-down{width:100vw;max-width:none;height:100%;margin:0}.modal-fullscreen-md-down .modal-content{height:100%;border:0;border-radius:0}.modal-fullscreen-md-down .modal-footer,.modal-fullscreen-md-down .modal-header{border-radius:0}.modal-fullscreen-md-down .modal-body{overflow-y:auto}}@media (max-width:991.98px){.modal-fullscreen-lg-down{width:100vw;max-width:none;height:100%;margin:0}.modal-fullscreen-lg-down .modal-content{height:100%;border:0;border-radius:0}.modal-fullscreen-lg-down .modal-footer,.modal-fullscreen-lg-down .modal-header{border-radius:0}.modal-fullscreen-lg-down .modal-body{overflow-y:auto}}@media (max-width:1199.98px){.modal-fullscreen-xl-down{width:100vw;max-width:none;height:100%;margin:0}.modal-fullscreen-xl-down .modal-content{height:100%;border:0;border-radius:0}.modal-fullscreen-xl-down .modal-footer,.modal-fullscreen-xl-down .modal-header{border-radius:0}.modal-fullscreen-xl-down .modal-body{overflow-y:auto}}@media (max-width:1399.98px){.modal-fullscreen-xxl-down{width:100vw;max-width:none;height:100%;margin:0}.modal-fullscreen-xxl-down .modal-content{height:100%;border:0;border-radius:0}.modal-fullscreen-xxl-down .modal-footer,.modal-fullscreen-xxl-down .modal-header{border-radius:0}.modal-fullscreen-xxl-down .modal-body{overflow-y:auto}}.tooltip{--bs-tooltip-zindex:1080;--bs-tooltip-max-width:200px;--bs-tooltip-padding-x:0.5rem;--bs-tooltip-padding-y:0.25rem;--bs-tooltip-margin: ;--bs-tooltip-font-size:0.875rem;--bs-tooltip-color:var(--bs-body-bg);--bs-tooltip-bg:var(--bs-emphasis-color);--bs-tooltip-border-radius:var(--bs-border-radius);--bs-tooltip-opacity:0.9;--bs-tooltip-arrow-width:0.8rem;--bs-tooltip-arrow-height:0.4rem;z-index:var(--bs-tooltip-zindex);display:block;margin:var(--bs-tooltip-margin);font-family:var(--bs-font-sans-serif);font-style:normal;font-weight:400;line-height:1.5;text-align:left;text-align:start;text-decoration:none;text-shadow:none;text-transform:none;letter-spacing:normal;word-break:normal;white-space:normal;word-spacing:normal;line-break:auto;font-size:var(--bs-tooltip-font-size);word-wrap:break-word;opacity:0}.tooltip.show{opacity:var(--bs-tooltip-opacity)}.tooltip .tooltip-arrow{display:block;width:var(--bs-tooltip-arrow-width);height:var(--bs-tooltip-arrow-height)}.tooltip .tooltip-arrow::before{position:absolute;content:"";border-color:transparent;border-style:solid}.bs-tooltip-auto[data-popper-placement^=top] .tooltip-arrow,.bs-tooltip-top .tooltip-arrow{bottom:calc(-1 * var(--bs-tooltip-arrow-height))}.bs-tooltip-auto[data-popper-placement^=top] .tooltip-arrow::before,.bs-tooltip-top .tooltip-arrow::before{top:-1px;border-width:var(--bs-tooltip-arrow-height) calc(var(--bs-tooltip-arrow-width) * .5) 0;border-top-color:var(--bs-tooltip-bg)}.bs-tooltip-auto[data-popper-placement^=right] .tooltip-arrow,.bs-tooltip-end .tooltip-arrow{left:calc(-1 * var(--bs-tooltip-arrow-height));width:var(--bs-tooltip-arrow-height);height:var(--bs-tooltip-arrow-width)}.bs-tooltip-auto[data-popper-placement^=right] .tooltip-arrow::before,.bs-tooltip-end .tooltip-arrow::before{right:-1px;border-width:calc(var(--bs-tooltip-arrow-width) * .5) var(--bs-tooltip-arrow-height) calc(var(--bs-tooltip-arrow-width) * .5) 0;border-right-color:var(--bs-tooltip-bg)}.bs-tooltip-auto[data-popper-placement^=bottom] .tooltip-arrow,.bs-tooltip-bottom .tooltip-arrow{top:calc(-1 * var(--bs-tooltip-arrow-height))}.bs-tooltip-auto[data-popper-placement^=bottom] .tooltip-arrow::before,.bs-tooltip-bottom .tooltip-arrow::before{bottom:-1px;border-width:0 calc(var(--bs-tooltip-arrow-width) * .5) var(--bs-tooltip-arrow-height);border-bottom-color:var(--bs-tooltip-bg)}.bs-tooltip-auto[data-popper-placement^=left] .tooltip-arrow,.bs-tooltip-start .tooltip-arrow{right:calc(-1 * var(--bs-tooltip-arrow-height));width:var(--bs-tooltip-arrow-height);height:var(--bs-tooltip-arrow-width)}.bs-tooltip-auto[data-popper-placement^=left] .tooltip-arrow::before,.bs-tooltip-start .tooltip-arrow::before{left:-1px;border-width:calc(var(--bs-tooltip-arrow-width) * .5) 0 calc(var(--bs-tooltip-arrow-width) * .5) var(--bs-tooltip-arrow-height);border-left-color:var(--bs-tooltip-bg)}.tooltip-inner{max-width:var(--bs-tooltip-max-width);padding:var(--bs-tooltip-padding-y) var(--bs-tooltip-padding-x);color:var(--bs-tooltip-color);text-align:center;background-color:var(--bs-tooltip-bg);border-radius:var(--bs-tooltip-border-radius)}.popover{--bs-popover-zindex:1070;--bs-popover-max-width:276px;--bs-popover-font-size:0.875rem;--bs-popover-bg:var(--bs-body-bg);--bs-popover-border-width:var(--bs-border-width);--bs-popover-border-color:var(--bs-border-color-translucent);--bs-popover-border-radius:var(--bs-border-radius-lg);--bs-popover-inner-border-radius:calc(var(--bs-border-radius-lg) - var(--bs-border-width));--bs-popover-box-shadow:var(--bs-box-shadow);--bs-popover-header-padding-x:1rem;--bs-popover-header-padding-y:0.5rem;--bs-popover-header-font-size:1rem;--bs-popover-header-color:inherit;--bs-popover-header-bg:var(--bs-secondary-bg);--bs-popover-body-padding-x:1rem;--bs-popover-body-padding-y:1rem;--bs-popover-body-color:var(--bs-body-color);--bs-popover-arrow-width:1rem;--bs-popover-arrow-height:0.5rem;--bs-popover-arrow-border:var(--bs-popover-border-color);z-index:var(--bs-popover-zindex);display:block;max-width:var(--bs-popover-max-width);font-family:var(--bs-font-sans-serif);font-style:normal;font-weight:400;line-height:1.5;text-align:left;text-align:start;text-decoration:none;text-shadow:none;text-transform:none;letter-spacing:normal;word-break:normal;white-space:normal;word-spacing:normal;line-break:auto;font-size:var(--bs-popover-font-size);word-wrap:break-word;background-color:var(--bs-popover-bg);background-clip:padding-box;border:var(--bs-popover-border-width) solid var(--bs-popover-border-color);border-radius:var(--bs-popover-border-radius)}.popover .popover-arrow{display:block;width:var(--bs-popover-arrow-width);height:var(--bs-popover-arrow-height)}.popover .popover-arrow::after,.popover .popover-arrow::before{position:absolute;display:block;content:"";border-color:transparent;border-style:solid;border-width:0}.bs-popover-auto[data-popper-placement^=top]>.popover-arrow,.bs-popover-top>.popover-arrow{bottom:calc(-1 * (var(--bs-popover-arrow-height)) - var(--bs-popover-border-width))}.bs-popover-auto[data-popper-placement^=top]>.popover-arrow::after,.bs-popover-auto[data-popper-placement^=top]>.popover-arrow::before,.bs-popover-top>.popover-arrow::after,.bs-popover-top>.popover-arrow::before{border-width:var(--bs-popover-arrow-height) calc(var(--bs-popover-arrow-width) * .5) 0}.bs-popover-auto[data-popper-placement^=top]>.popover-arrow::before,.bs-popover-top>.popover-arrow::before{bottom:0;border-top-color:var(--bs-popover-arrow-border)}.bs-popover-auto[data-popper-placement^=top]>.popover-arrow::after,.bs-popover-top>.popover-arrow::after{bottom:var(--bs-popover-border-width);border-top-color:var(--bs-popover-bg)}.bs-popover-auto[data-popper-placement^=right]>.popover-arrow,.bs-popover-end>.popover-arrow{left:calc(-1 * (var(--bs-popover-arrow-height)) - var(--bs-popover-border-width));width:var(--bs-popover-arrow-height);height:var(--bs-popover-arrow-width)}.bs-popover-auto[data-popper-placement^=right]>.popover-arrow::after,.bs-popover-auto[data-popper-placement^=right]>.popover-arrow::before,.bs-popover-end>.popover-arrow::after,.bs-popover-end>.popover-arrow::before{border-width:calc(var(--bs-popover-arrow-width) * .5) var(--bs-popover-arrow-height) calc(var(--bs-popover-arrow-width) * .5) 0}.bs-popover-auto[data-popper-placement^=right]>.popover-arrow::before,.bs-popover-end>.popover-arrow::before{left:0;border-right-color:var(--bs-popover-arrow-border)}.bs-popover-auto[data-popper-placement^=right]>.popover-arrow::after,.bs-popover-end>.popover-arrow::after{left:var(--bs-popover-border-width);border-right-color:var(--bs-popover-bg)}.bs-popover-auto[data-popper-placement^=bottom]>.popover-arrow,.bs-popover-bottom>.popover-arrow{top:calc(-1 * (var(--bs-popover-arrow-height)) - var(--bs-popover-border-width))}.bs-popover-auto[data-popper-placement^=bottom]>.popover-arrow::after,.bs-popover-auto[data-popper-placement^=bottom]>.popover-arrow::before,.bs-popover-bottom>.popover-arrow::after,.bs-popover-bottom>.popover-arrow::before{border-width:0 calc(var(--bs-popover-arrow-width) * .5) var(--bs-popover-arrow-height)}.bs-popover-auto[data-popper-placement^=bottom]>.popover-arrow::before,.bs-popover-bottom>.popover-arrow::before{top:0;border-bottom-color:var(--bs-popover-arrow-border)}.bs-popover-auto[data-popper-placement^=bottom]>.popover-arrow::after,.bs-popover-bottom>.popover-arrow::after{top:var(--bs-popover-border-width);border-bottom-color:var(--bs-popover-bg)}.bs-popover-auto[data-popper-placement^=bottom] .popover-header::before,.bs-popover-bottom .popover-header::before{position:absolute;top:0;left:50%;display:block;width:var(--bs-popover-arrow-width);margin-left:calc(-.5 * var(--bs-popover-arrow-width));content:"";border-bottom:var(--bs-popover-border-width) solid var(--bs-popover-header-bg)}.bs-popover-auto[data-popper-placement^=left]>.popover-arrow,.bs-popover-start>.popover-arrow{right:calc(-1 * (var(--bs-popover-arrow-height)) - var(--bs-popover-border-width));width:var(--bs-popover-arrow-height);height:var(--bs-popover-arrow-width)}.bs-popover-auto[data-popper-placement^=left]>.popover-arrow::after,.bs-popover-auto[data-popper-placement^=left]>.popover-arrow::before,.bs-popover-start>.popover-arrow::after,.bs-popover-start>.popover-arrow::before{border-width:calc(var(--bs-popover-arrow-width) * .5) 0 calc(var(--bs-popover-arrow-width) * .5) var(--bs-popover-arrow-height)}.bs-popover-auto[data-popper-placement^=left]>.popover-arrow::before,.bs-popover-start>.popover-arrow::before{right:0;border-left-color:var(--bs-popover-arrow-border)}.bs-popover-auto[data-popper-placement^=left]>.popover-arrow::after,.bs-popover-start>.popover-arrow::after{right:var(--bs-popover-border-width);border-left-color:var(--bs-popover-bg)}.popover-header{padding:var(--bs-popover-header-padding-y) var(--bs-popover-header-padding-x);margin-bottom:0;font-size:var(--bs-popover-header-font-size);color:var(--bs-popover-header-color);background-color:var(--bs-popover-header-bg);border-bottom:var(--bs-popover-border-width) solid var(--bs-popover-border-color);border-top-left-radius:var(--bs-popover-inner-border-radius);border-top-right-radius:var(--bs-popover-inner-border-radius)}.popover-header:empty{display:none}.popover-body{padding:var(--bs-popover-body-padding-y) var(--bs-popover-body-padding-x);color:var(--bs-popover-body-color)}.carousel{position:relative}.carousel.pointer-event{touch-action:pan-y}.carousel-inner{position:relative;width:100%;overflow:hidden}.carousel-inner::after{display:block;clear:both;content:""}.carousel-item{position:relative;display:none;float:left;width:100%;margin-right:-100%;-webkit-backface-visibility:hidden;backface-visibility:hidden;transition:transform .6s ease-in-out}@media (prefers-reduced-motion:reduce){.carousel-item{transition:none}}.carousel-item-next,.carousel-item-prev,.carousel-item.active{display:block}.active.carousel-item-end,.carousel-item-next:not(.carousel-item-start){transform:translateX(100%)}.active.carousel-item-start,.carousel-item-prev:not(.carousel-item-end){transform:translateX(-100%)}.carousel-fade .carousel-item{opacity:0;transition-property:opacity;transform:none}.carousel-fade .carousel-item-next.carousel-item-start,.carousel-fade .carousel-item-prev.carousel-item-end,.carousel-fade .carousel-item.active{z-index:1;opacity:1}.carousel-fade .active.carousel-item-end,.carousel-fade .active.carousel-item-start{z-index:0;opacity:0;transition:opacity 0s .6s}@media (prefers-reduced-motion:reduce){.carousel-fade .active.carousel-item-end,.carousel-fade .active.carousel-item-start{transition:none}}.carousel-control-next,.carousel-control-prev{position:absolute;top:0;bottom:0;z-index:1;display:flex;align-items:center;justify-content:center;width:15%;padding:0;color:#fff;text-align:center;background:0 0;border:0;opacity:.5;transition:opacity .15s ease}@media (prefers-reduced-motion:reduce){.carousel-control-next,.carousel-control-prev{transition:none}}.carousel-control-next:focus,.carousel-control-next:hover,.carousel-control-prev:focus,.carousel-control-prev:hover{color:#fff;text-decoration:none;outline:0;opacity:.9}.carousel-control-prev{left:0}.carousel-control-next{right:0}.carousel-control-next-icon,.carousel-control-prev-icon{display:inline-block;width:2rem;height:2rem;background-repeat:no-repeat;background-position:50%;background-size:100% 100%}.carousel-control-prev-icon{background-image:url(${q})}.carousel-control-next-icon{background-image:url(${G})}.carousel-indicators{position:absolute;right:0;bottom:0;left:0;z-index:2;display:flex;justify-content:center;padding:0;margin-right:15%;margin-bottom:1rem;margin-left:15%}.carousel-indicators [data-bs-target]{box-sizing:content-box;flex:0 1 auto;width:30px;height:3px;padding:0;margin-right:3px;margin-left:3px;text-indent:-999px;cursor:pointer;background-color:#fff;background-clip:padding-box;border:0;border-top:10px solid transparent;border-bottom:10px solid transparent;opacity:.5;transition:opacity .6s ease}@media (prefers-reduced-motion:reduce){.carousel-indicators [data-bs-target]{transition:none}}.carousel-indicators .active{opacity:1}.carousel-caption{position:absolute;right:15%;bottom:1.25rem;left:15%;padding-top:1.25rem;padding-bottom:1.25rem;color:#fff;text-align:center}.carousel-dark .carousel-control-next-icon,.carousel-dark .carousel-control-prev-icon{filter:invert(1) grayscale(100)}.carousel-dark .carousel-indicators [data-bs-target]{background-color:#000}.carousel-dark .carousel-caption{color:#000}[data-bs-theme=dark] .carousel .carousel-control-next-icon,[data-bs-theme=dark] .carousel .carousel-control-prev-icon,[data-bs-theme=dark].carousel .carousel-control-next-icon,[data-bs-theme=dark].carousel .carousel-control-prev-icon{filter:invert(1) grayscale(100)}[data-bs-theme=dark] .carousel .carousel-indicators [data-bs-target],[data-bs-theme=dark].carousel .carousel-indicators [data-bs-target]{background-color:#000}[data-bs-theme=dark] .carousel .carousel-caption,[data-bs-theme=dark].carousel .carousel-caption{color:#000}.spinner-border,.spinner-grow{display:inline-block;width:var(--bs-spinner-width);height:var(--bs-spinner-height);vertical-align:var(--bs-spinner-vertical-align);border-radius:50%;animation:var(--bs-spinner-animation-speed) linear infinite var(--bs-spinner-animation-name)}@keyframes spinner-border{to{transform:rotate(360deg)}}.spinner-border{--bs-spinner-width:2rem;--bs-spinner-height:2rem;--bs-spinner-vertical-align:-0.125em;--bs-spinner-border-width:0.25em;--bs-spinner-animation-speed:0.75s;--bs-spinner-animation-name:spinner-border;border:var(--bs-spinner-border-width) solid currentcolor;border-right-color:transparent}.spinner-border-sm{--bs-spinner-width:1rem;--bs-spinner-height:1rem;--bs-spinner-border-width:0.2em}@keyframes spinner-grow{0%{transform:scale(0)}50%{opacity:1;transform:none}}.spinner-grow{--bs-spinner-width:2rem;--bs-spinner-height:2rem;--bs-spinner-vertical-align:-0.125em;--bs-spinner-animation-speed:0.75s;--bs-spinner-animation-name:spinner-grow;background-color:currentcolor;opacity:0}.spinner-grow-sm{--bs-spinner-width:1rem;--bs-spinner-height:1rem}@media (prefers-reduced-motion:reduce){.spinner-border,.spinner-grow{--bs-spinner-animation-speed:1.5s}}.offcanvas,.offcanvas-lg,.offcanvas-md,.offcanvas-sm,.offcanvas-xl,.offcanvas-xxl{--bs-offcanvas-zindex:1045;--bs-offcanvas-width:400px;--bs-offcanvas-height:30vh;--bs-offcanvas-padding-x:1rem;--bs-offcanvas-padding-y:1rem;--bs-offcanvas-color:var(--bs-body-color);--bs-offcanvas-bg:var(--bs-body-bg);--bs-offcanvas-border-width:var(--bs-border-width);--bs-offcanvas-border-color:var(--bs-border-color-translucent);--bs-offcanvas-box-shadow:var(--bs-box-shadow-sm);--bs-offcanvas-transition:transform 0.3s ease-in-out;--bs-offcanvas-title-line-height:1.5}@media (max-width:575.98px){.offcanvas-sm{position:fixed;bottom:0;z-index:var(--bs-offcanvas-zindex);display:flex;flex-direction:column;max-width:100%;color:var(--bs-offcanvas-color);visibility:hidden;background-color:var(--bs-offcanvas-bg);background-clip:padding-box;outline:0;transition:var(--bs-offcanvas-transition)}}@media (max-width:575.98px) and (prefers-reduced-motion:reduce){.offcanvas-sm{transition:none}}@media (max-width:575.98px){.offcanvas-sm.offcanvas-start{top:0;left:0;width:var(--bs-offcanvas-width);border-right:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(-100%)}.offcanvas-sm.offcanvas-end{top:0;right:0;width:var(--bs-offcanvas-width);border-left:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(100%)}.offcanvas-sm.offcanvas-top{top:0;right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-bottom:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(-100%)}.offcanvas-sm.offcanvas-bottom{right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-top:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(100%)}.offcanvas-sm.show:not(.hiding),.offcanvas-sm.showing{transform:none}.offcanvas-sm.hiding,.offcanvas-sm.show,.offcanvas-sm.showing{visibility:visible}}@media (min-width:576px){.offcanvas-sm{--bs-offcanvas-height:auto;--bs-offcanvas-border-width:0;background-color:transparent!important}.offcanvas-sm .offcanvas-header{display:none}.offcanvas-sm .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible;background-color:transparent!important}}@media (max-width:767.98px){.offcanvas-md{position:fixed;bottom:0;z-index:var(--bs-offcanvas-zindex);display:flex;flex-direction:column;max-width:100%;color:var(--bs-offcanvas-color);visibility:hidden;background-color:var(--bs-offcanvas-bg);background-clip:padding-box;outline:0;transition:var(--bs-offcanvas-transition)}}@media (max-width:767.98px) and (prefers-reduced-motion:reduce){.offcanvas-md{transition:none}}@media (max-width:767.98px){.offcanvas-md.offcanvas-start{top:0;left:0;width:var(--bs-offcanvas-width);border-right:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(-100%)}.offcanvas-md.offcanvas-end{top:0;right:0;width:var(--bs-offcanvas-width);border-left:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(100%)}.offcanvas-md.offcanvas-top{top:0;right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-bottom:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(-100%)}.offcanvas-md.offcanvas-bottom{right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-top:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(100%)}.offcanvas-md.show:not(.hiding),.offcanvas-md.showing{transform:none}.offcanvas-md.hiding,.offcanvas-md.show,.offcanvas-md.showing{visibility:visible}}@media (min-width:768px){.offcanvas-md{--bs-offcanvas-height:auto;--bs-offcanvas-border-width:0;background-color:transparent!important}.offcanvas-md .offcanvas-header{display:none}.offcanvas-md .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible;background-color:transparent!important}}@media (max-width:991.98px){.offcanvas-lg{position:fixed;bottom:0;z-index:var(--bs-offcanvas-zindex);display:flex;flex-direction:column;max-width:100%;color:var(--bs-offcanvas-color);visibility:hidden;background-color:var(--bs-offcanvas-bg);background-clip:padding-box;outline:0;transition:var(--bs-offcanvas-transition)}}@media (max-width:991.98px) and (prefers-reduced-motion:reduce){.offcanvas-lg{transition:none}}@media (max-width:991.98px){.offcanvas-lg.offcanvas-start{top:0;left:0;width:var(--bs-offcanvas-width);border-right:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(-100%)}.offcanvas-lg.offcanvas-end{top:0;right:0;width:var(--bs-offcanvas-width);border-left:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(100%)}.offcanvas-lg.offcanvas-top{top:0;right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-bottom:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(-100%)}.offcanvas-lg.offcanvas-bottom{right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-top:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(100%)}.offcanvas-lg.show:not(.hiding),.offcanvas-lg.showing{transform:none}.offcanvas-lg.hiding,.offcanvas-lg.show,.offcanvas-lg.showing{visibility:visible}}@media (min-width:992px){.offcanvas-lg{--bs-offcanvas-height:auto;--bs-offcanvas-border-width:0;background-color:transparent!important}.offcanvas-lg .offcanvas-header{display:none}.offcanvas-lg .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible;background-color:transparent!important}}@media (max-width:1199.98px){.offcanvas-xl{position:fixed;bottom:0;z-index:var(--bs-offcanvas-zindex);display:flex;flex-direction:column;max-width:100%;color:var(--bs-offcanvas-color);visibility:hidden;background-color:var(--bs-offcanvas-bg);background-clip:padding-box;outline:0;transition:var(--bs-offcanvas-transition)}}@media (max-width:1199.98px) and (prefers-reduced-motion:reduce){.offcanvas-xl{transition:none}}@media (max-width:1199.98px){.offcanvas-xl.offcanvas-start{top:0;left:0;width:var(--bs-offcanvas-width);border-right:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(-100%)}.offcanvas-xl.offcanvas-end{top:0;right:0;width:var(--bs-offcanvas-width);border-left:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(100%)}.offcanvas-xl.offcanvas-top{top:0;right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-bottom:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(-100%)}.offcanvas-xl.offcanvas-bottom{right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-top:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(100%)}.offcanvas-xl.show:not(.hiding),.offcanvas-xl.showing{transform:none}.offcanvas-xl.hiding,.offcanvas-xl.show,.offcanvas-xl.showing{visibility:visible}}@media (min-width:1200px){.offcanvas-xl{--bs-offcanvas-height:auto;--bs-offcanvas-border-width:0;background-color:transparent!important}.offcanvas-xl .offcanvas-header{display:none}.offcanvas-xl .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible;background-color:transparent!important}}@media (max-width:1399.98px){.offcanvas-xxl{position:fixed;bottom:0;z-index:var(--bs-offcanvas-zindex);display:flex;flex-direction:column;max-width:100%;color:var(--bs-offcanvas-color);visibility:hidden;background-color:var(--bs-offcanvas-bg);background-clip:padding-box;outline:0;transition:var(--bs-offcanvas-transition)}}@media (max-width:1399.98px) and (prefers-reduced-motion:reduce){.offcanvas-xxl{transition:none}}@media (max-width:1399.98px){.offcanvas-xxl.offcanvas-start{top:0;left:0;width:var(--bs-offcanvas-width);border-right:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(-100%)}.offcanvas-xxl.offcanvas-end{top:0;right:0;width:var(--bs-offcanvas-width);border-left:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(100%)}.offcanvas-xxl.offcanvas-top{top:0;right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-bottom:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(-100%)}.offcanvas-xxl.offcanvas-bottom{right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-top:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(100%)}.offcanvas-xxl.show:not(.hiding),.offcanvas-xxl.showing{transform:none}.offcanvas-xxl.hiding,.offcanvas-xxl.show,.offcanvas-xxl.showing{visibility:visible}}@media (min-width:1400px){.offcanvas-xxl{--bs-offcanvas-height:auto;--bs-offcanvas-border-width:0;background-color:transparent!important}.offcanvas-xxl .offcanvas-header{display:none}.offcanvas-xxl .offcanvas-body{display:flex;flex-grow:0;padding:0;overflow-y:visible;background-color:transparent!important}}.offcanvas{position:fixed;bottom:0;z-index:var(--bs-offcanvas-zindex);display:flex;flex-direction:column;max-width:100%;color:var(--bs-offcanvas-color);visibility:hidden;background-color:var(--bs-offcanvas-bg);background-clip:padding-box;outline:0;transition:var(--bs-offcanvas-transition)}@media (prefers-reduced-motion:reduce){.offcanvas{transition:none}}.offcanvas.offcanvas-start{top:0;left:0;width:var(--bs-offcanvas-width);border-right:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(-100%)}.offcanvas.offcanvas-end{top:0;right:0;width:var(--bs-offcanvas-width);border-left:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateX(100%)}.offcanvas.offcanvas-top{top:0;right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-bottom:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(-100%)}.offcanvas.offcanvas-bottom{right:0;left:0;height:var(--bs-offcanvas-height);max-height:100%;border-top:var(--bs-offcanvas-border-width) solid var(--bs-offcanvas-border-color);transform:translateY(100%)}.offcanvas.show:not(.hiding),.offcanvas.showing{transform:none}.offcanvas.hiding,.offcanvas.show,.offcanvas.showing{visibility:visible}.offcanvas-backdrop{position:fixed;top:0;left:0;z-index:1040;width:100vw;height:100vh;background-color:#000}.offcanvas-backdrop.fade{opacity:0}.offcanvas-backdrop.show{opacity:.5}.offcanvas-header{display:flex;align-items:center;padding:var(--bs-offcanvas-padding-y) var(--bs-offcanvas-padding-x)}.offcanvas-header .btn-close{padding:calc(var(--bs-offcanvas-padding-y) * .5) calc(var(--bs-offcanvas-padding-x) * .5);margin:calc(-.5 * var(--bs-offcanvas-padding-y)) calc(-.5 * var(--bs-offcanvas-padding-x)) calc(-.5 * var(--bs-offcanvas-padding-y)) auto}.offcanvas-title{margin-bottom:0;line-height:var(--bs-offcanvas-title-line-height)}.offcanvas-body{flex-grow:1;padding:var(--bs-offcanvas-padding-y) var(--bs-offcanvas-padding-x);overflow-y:auto}.placeholder{display:inline-block;min-height:1em;vertical-align:middle;cursor:wait;background-color:currentcolor;opacity:.5}.placeholder.btn::before{display:inline-block;content:""}.placeholder-xs{min-height:.6em}.placeholder-sm{min-height:.8em}.placeholder-lg{min-height:1.2em}.placeholder-glow .placeholder{animation:placeholder-glow 2s ease-in-out infinite}@keyframes placeholder-glow{50%{opacity:.2}}.placeholder-wave{-webkit-mask-image:linear-gradient(130deg,#000 55%,rgba(0,0,0,0.8) 75%,#000 95%);mask-image:linear-gradient(130deg,#000 55%,rgba(0,0,0,0.8) 75%,#000 95%);-webkit-mask-size:200% 100%;mask-size:200% 100%;animation:placeholder-wave 2s linear infinite}@keyframes placeholder-wave{100%{-webkit-mask-position:-200% 0%;mask-position:-200% 0%}}.clearfix::after{display:block;clear:both;content:""}.text-bg-primary{color:#fff!important;background-color:RGBA(var(--bs-primary-rgb),var(--bs-bg-opacity,1))!important}.text-bg-secondary{color:#fff!important;background-color:RGBA(var(--bs-secondary-rgb),var(--bs-bg-opacity,1))!important}.text-bg-success{color:#fff!important;background-color:RGBA(var(--bs-success-rgb),var(--bs-bg-opacity,1))!important}.text-bg-info{color:#000!important;background-color:RGBA(var(--bs-info-rgb),var(--bs-bg-opacity,1))!important}.text-bg-warning{color:#000!important;background-color:RGBA(var(--bs-warning-rgb),var(--bs-bg-opacity,1))!important}.text-bg-danger{color:#fff!important;background-color:RGBA(var(--bs-danger-rgb),var(--bs-bg-opacity,1))!important}.text-bg-light{color:#000!important;background-color:RGBA(var(--bs-light-rgb),var(--bs-bg-opacity,1))!important}.text-bg-dark{color:#fff!important;background-color:RGBA(var(--bs-dark-rgb),var(--bs-bg-opacity,1))!important}.link-primary{color:RGBA(var(--bs-primary-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-primary-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-primary-rgb),var(--bs-link-underline-opacity,1))!important}.link-primary:focus,.link-primary:hover{color:RGBA(10,88,202,var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(10,88,202,var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(10,88,202,var(--bs-link-underline-opacity,1))!important}.link-secondary{color:RGBA(var(--bs-secondary-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-secondary-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-secondary-rgb),var(--bs-link-underline-opacity,1))!important}.link-secondary:focus,.link-secondary:hover{color:RGBA(86,94,100,var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(86,94,100,var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(86,94,100,var(--bs-link-underline-opacity,1))!important}.link-success{color:RGBA(var(--bs-success-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-success-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-success-rgb),var(--bs-link-underline-opacity,1))!important}.link-success:focus,.link-success:hover{color:RGBA(20,108,67,var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(20,108,67,var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(20,108,67,var(--bs-link-underline-opacity,1))!important}.link-info{color:RGBA(var(--bs-info-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-info-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-info-rgb),var(--bs-link-underline-opacity,1))!important}.link-info:focus,.link-info:hover{color:RGBA(61,213,243,var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(61,213,243,var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(61,213,243,var(--bs-link-underline-opacity,1))!important}.link-warning{color:RGBA(var(--bs-warning-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-warning-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-warning-rgb),var(--bs-link-underline-opacity,1))!important}.link-warning:focus,.link-warning:hover{color:RGBA(255,205,57,var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(255,205,57,var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(255,205,57,var(--bs-link-underline-opacity,1))!important}.link-danger{color:RGBA(var(--bs-danger-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-danger-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-danger-rgb),var(--bs-link-underline-opacity,1))!important}.link-danger:focus,.link-danger:hover{color:RGBA(176,42,55,var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(176,42,55,var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(176,42,55,var(--bs-link-underline-opacity,1))!important}.link-light{color:RGBA(var(--bs-light-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-light-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-light-rgb),var(--bs-link-underline-opacity,1))!important}.link-light:focus,.link-light:hover{color:RGBA(249,250,251,var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(249,250,251,var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(249,250,251,var(--bs-link-underline-opacity,1))!important}.link-dark{color:RGBA(var(--bs-dark-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-dark-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-dark-rgb),var(--bs-link-underline-opacity,1))!important}.link-dark:focus,.link-dark:hover{color:RGBA(26,30,33,var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(26,30,33,var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(26,30,33,var(--bs-link-underline-opacity,1))!important}.link-body-emphasis{color:RGBA(var(--bs-emphasis-color-rgb),var(--bs-link-opacity,1))!important;-webkit-text-decoration-color:RGBA(var(--bs-emphasis-color-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:RGBA(var(--bs-emphasis-color-rgb),var(--bs-link-underline-opacity,1))!important}.link-body-emphasis:focus,.link-body-emphasis:hover{color:RGBA(var(--bs-emphasis-color-rgb),var(--bs-link-opacity,.75))!important;-webkit-text-decoration-color:RGBA(var(--bs-emphasis-color-rgb),var(--bs-link-underline-opacity,0.75))!important;text-decoration-color:RGBA(var(--bs-emphasis-color-rgb),var(--bs-link-underline-opacity,0.75))!important}.focus-ring:focus{outline:0;box-shadow:var(--bs-focus-ring-x,0) var(--bs-focus-ring-y,0) var(--bs-focus-ring-blur,0) var(--bs-focus-ring-width) var(--bs-focus-ring-color)}.icon-link{display:inline-flex;gap:.375rem;align-items:center;-webkit-text-decoration-color:rgba(var(--bs-link-color-rgb),var(--bs-link-opacity,0.5));text-decoration-color:rgba(var(--bs-link-color-rgb),var(--bs-link-opacity,0.5));text-underline-offset:0.25em;-webkit-backface-visibility:hidden;backface-visibility:hidden}.icon-link>.bi{flex-shrink:0;width:1em;height:1em;fill:currentcolor;transition:.2s ease-in-out transform}@media (prefers-reduced-motion:reduce){.icon-link>.bi{transition:none}}.icon-link-hover:focus-visible>.bi,.icon-link-hover:hover>.bi{transform:var(--bs-icon-link-transform,translate3d(.25em,0,0))}.ratio{position:relative;width:100%}.ratio::before{display:block;padding-top:var(--bs-aspect-ratio);content:""}.ratio>*{position:absolute;top:0;left:0;width:100%;height:100%}.ratio-1x1{--bs-aspect-ratio:100%}.ratio-4x3{--bs-aspect-ratio:75%}.ratio-16x9{--bs-aspect-ratio:56.25%}.ratio-21x9{--bs-aspect-ratio:42.8571428571%}.fixed-top{position:fixed;top:0;right:0;left:0;z-index:1030}.fixed-bottom{position:fixed;right:0;bottom:0;left:0;z-index:1030}.sticky-top{position:-webkit-sticky;position:sticky;top:0;z-index:1020}.sticky-bottom{position:-webkit-sticky;position:sticky;bottom:0;z-index:1020}@media (min-width:576px){.sticky-sm-top{position:-webkit-sticky;position:sticky;top:0;z-index:1020}.sticky-sm-bottom{position:-webkit-sticky;position:sticky;bottom:0;z-index:1020}}@media (min-width:768px){.sticky-md-top{position:-webkit-sticky;position:sticky;top:0;z-index:1020}.sticky-md-bottom{position:-webkit-sticky;position:sticky;bottom:0;z-index:1020}}@media (min-width:992px){.sticky-lg-top{position:-webkit-sticky;position:sticky;top:0;z-index:1020}.sticky-lg-bottom{position:-webkit-sticky;position:sticky;bottom:0;z-index:1020}}@media (min-width:1200px){.sticky-xl-top{position:-webkit-sticky;position:sticky;top:0;z-index:1020}.sticky-xl-bottom{position:-webkit-sticky;position:sticky;bottom:0;z-index:1020}}@media (min-width:1400px){.sticky-xxl-top{position:-webkit-sticky;position:sticky;top:0;z-index:1020}.sticky-xxl-bottom{position:-webkit-sticky;position:sticky;bottom:0;z-index:1020}}.hstack{display:flex;flex-direction:row;align-items:center;align-self:stretch}.vstack{display:flex;flex:1 1 auto;flex-direction:column;align-self:stretch}.visually-hidden,.visually-hidden-focusable:not(:focus):not(:focus-within){width:1px!important;height:1px!important;padding:0!important;margin:-1px!important;overflow:hidden!important;clip:rect(0,0,0,0)!important;white-space:nowrap!important;border:0!important}.visually-hidden-focusable:not(:focus):not(:focus-within):not(caption),.visually-hidden:not(caption){position:absolute!important}.stretched-link::after{position:absolute;top:0;right:0;bottom:0;left:0;z-index:1;content:""}.text-truncate{overflow:hidden;text-overflow:ellipsis;white-space:nowrap}.vr{display:inline-block;align-self:stretch;width:var(--bs-border-width);min-height:1em;background-color:currentcolor;opacity:.25}.align-baseline{vertical-align:baseline!important}.align-top{vertical-align:top!important}.align-middle{vertical-align:middle!important}.align-bottom{vertical-align:bottom!important}.align-text-bottom{vertical-align:text-bottom!important}.align-text-top{vertical-align:text-top!important}.float-start{float:left!important}.float-end{float:right!important}.float-none{float:none!important}.object-fit-contain{-o-object-fit:contain!important;object-fit:contain!important}.object-fit-cover{-o-object-fit:cover!important;object-fit:cover!important}.object-fit-fill{-o-object-fit:fill!important;object-fit:fill!important}.object-fit-scale{-o-object-fit:scale-down!important;object-fit:scale-down!important}.object-fit-none{-o-object-fit:none!important;object-fit:none!important}.opacity-0{opacity:0!important}.opacity-25{opacity:.25!important}.opacity-50{opacity:.5!important}.opacity-75{opacity:.75!important}.opacity-100{opacity:1!important}.overflow-auto{overflow:auto!important}.overflow-hidden{overflow:hidden!important}.overflow-visible{overflow:visible!important}.overflow-scroll{overflow:scroll!important}.overflow-x-auto{overflow-x:auto!important}.overflow-x-hidden{overflow-x:hidden!important}.overflow-x-visible{overflow-x:visible!important}.overflow-x-scroll{overflow-x:scroll!important}.overflow-y-auto{overflow-y:auto!important}.overflow-y-hidden{overflow-y:hidden!important}.overflow-y-visible{overflow-y:visible!important}.overflow-y-scroll{overflow-y:scroll!important}.d-inline{display:inline!important}.d-inline-block{display:inline-block!important}.d-block{display:block!important}.d-grid{display:grid!important}.d-inline-grid{display:inline-grid!important}.d-table{display:table!important}.d-table-row{display:table-row!important}.d-table-cell{display:table-cell!important}.d-flex{display:flex!important}.d-inline-flex{display:inline-flex!important}.d-none{display:none!important}.shadow{box-shadow:var(--bs-box-shadow)!important}.shadow-sm{box-shadow:var(--bs-box-shadow-sm)!important}.shadow-lg{box-shadow:var(--bs-box-shadow-lg)!important}.shadow-none{box-shadow:none!important}.focus-ring-primary{--bs-focus-ring-color:rgba(var(--bs-primary-rgb), var(--bs-focus-ring-opacity))}.focus-ring-secondary{--bs-focus-ring-color:rgba(var(--bs-secondary-rgb), var(--bs-focus-ring-opacity))}.focus-ring-success{--bs-focus-ring-color:rgba(var(--bs-success-rgb), var(--bs-focus-ring-opacity))}.focus-ring-info{--bs-focus-ring-color:rgba(var(--bs-info-rgb), var(--bs-focus-ring-opacity))}.focus-ring-warning{--bs-focus-ring-color:rgba(var(--bs-warning-rgb), var(--bs-focus-ring-opacity))}.focus-ring-danger{--bs-focus-ring-color:rgba(var(--bs-danger-rgb), var(--bs-focus-ring-opacity))}.focus-ring-light{--bs-focus-ring-color:rgba(var(--bs-light-rgb), var(--bs-focus-ring-opacity))}.focus-ring-dark{--bs-focus-ring-color:rgba(var(--bs-dark-rgb), var(--bs-focus-ring-opacity))}.position-static{position:static!important}.position-relative{position:relative!important}.position-absolute{position:absolute!important}.position-fixed{position:fixed!important}.position-sticky{position:-webkit-sticky!important;position:sticky!important}.top-0{top:0!important}.top-50{top:50%!important}.top-100{top:100%!important}.bottom-0{bottom:0!important}.bottom-50{bottom:50%!important}.bottom-100{bottom:100%!important}.start-0{left:0!important}.start-50{left:50%!important}.start-100{left:100%!important}.end-0{right:0!important}.end-50{right:50%!important}.end-100{right:100%!important}.translate-middle{transform:translate(-50%,-50%)!important}.translate-middle-x{transform:translateX(-50%)!important}.translate-middle-y{transform:translateY(-50%)!important}.border{border:var(--bs-border-width) var(--bs-border-style) var(--bs-border-color)!important}.border-0{border:0!important}.border-top{border-top:var(--bs-border-width) var(--bs-border-style) var(--bs-border-color)!important}.border-top-0{border-top:0!important}.border-end{border-right:var(--bs-border-width) var(--bs-border-style) var(--bs-border-color)!important}.border-end-0{border-right:0!important}.border-bottom{border-bottom:var(--bs-border-width) var(--bs-border-style) var(--bs-border-color)!important}.border-bottom-0{border-bottom:0!important}.border-start{border-left:var(--bs-border-width) var(--bs-border-style) var(--bs-border-color)!important}.border-start-0{border-left:0!important}.border-primary{--bs-border-opacity:1;border-color:rgba(var(--bs-primary-rgb),var(--bs-border-opacity))!important}.border-secondary{--bs-border-opacity:1;border-color:rgba(var(--bs-secondary-rgb),var(--bs-border-opacity))!important}.border-success{--bs-border-opacity:1;border-color:rgba(var(--bs-success-rgb),var(--bs-border-opacity))!important}.border-info{--bs-border-opacity:1;border-color:rgba(var(--bs-info-rgb),var(--bs-border-opacity))!important}.border-warning{--bs-border-opacity:1;border-color:rgba(var(--bs-warning-rgb),var(--bs-border-opacity))!important}.border-danger{--bs-border-opacity:1;border-color:rgba(var(--bs-danger-rgb),var(--bs-border-opacity))!important}.border-light{--bs-border-opacity:1;border-color:rgba(var(--bs-light-rgb),var(--bs-border-opacity))!important}.border-dark{--bs-border-opacity:1;border-color:rgba(var(--bs-dark-rgb),var(--bs-border-opacity))!important}.border-black{--bs-border-opacity:1;border-color:rgba(var(--bs-black-rgb),var(--bs-border-opacity))!important}.border-white{--bs-border-opacity:1;border-color:rgba(var(--bs-white-rgb),var(--bs-border-opacity))!important}.border-primary-subtle{border-color:var(--bs-primary-border-subtle)!important}.border-secondary-subtle{border-color:var(--bs-secondary-border-subtle)!important}.border-success-subtle{border-color:var(--bs-success-border-subtle)!important}.border-info-subtle{border-color:var(--bs-info-border-subtle)!important}.border-warning-subtle{border-color:var(--bs-warning-border-subtle)!important}.border-danger-subtle{border-color:var(--bs-danger-border-subtle)!important}.border-light-subtle{border-color:var(--bs-light-border-subtle)!important}.border-dark-subtle{border-color:var(--bs-dark-border-subtle)!important}.border-1{border-width:1px!important}.border-2{border-width:2px!important}.border-3{border-width:3px!important}.border-4{border-width:4px!important}.border-5{border-width:5px!important}.border-opacity-10{--bs-border-opacity:0.1}.border-opacity-25{--bs-border-opacity:0.25}.border-opacity-50{--bs-border-opacity:0.5}.border-opacity-75{--bs-border-opacity:0.75}.border-opacity-100{--bs-border-opacity:1}.w-25{width:25%!important}.w-50{width:50%!important}.w-75{width:75%!important}.w-100{width:100%!important}.w-auto{width:auto!important}.mw-100{max-width:100%!important}.vw-100{width:100vw!important}.min-vw-100{min-width:100vw!important}.h-25{height:25%!important}.h-50{height:50%!important}.h-75{height:75%!important}.h-100{height:100%!important}.h-auto{height:auto!important}.mh-100{max-height:100%!important}.vh-100{height:100vh!important}.min-vh-100{min-height:100vh!important}.flex-fill{flex:1 1 auto!important}.flex-row{flex-direction:row!important}.flex-column{flex-direction:column!important}.flex-row-reverse{flex-direction:row-reverse!important}.flex-column-reverse{flex-direction:column-reverse!important}.flex-grow-0{flex-grow:0!important}.flex-grow-1{flex-grow:1!important}.flex-shrink-0{flex-shrink:0!important}.flex-shrink-1{flex-shrink:1!important}.flex-wrap{flex-wrap:wrap!important}.flex-nowrap{flex-wrap:nowrap!important}.flex-wrap-reverse{flex-wrap:wrap-reverse!important}.justify-content-start{justify-content:flex-start!important}.justify-content-end{justify-content:flex-end!important}.justify-content-center{justify-content:center!important}.justify-content-between{justify-content:space-between!important}.justify-content-around{justify-content:space-around!important}.justify-content-evenly{justify-content:space-evenly!important}.align-items-start{align-items:flex-start!important}.align-items-end{align-items:flex-end!important}.align-items-center{align-items:center!important}.align-items-baseline{align-items:baseline!important}.align-items-stretch{align-items:stretch!important}.align-content-start{align-content:flex-start!important}.align-content-end{align-content:flex-end!important}.align-content-center{align-content:center!important}.align-content-between{align-content:space-between!important}.align-content-around{align-content:space-around!important}.align-content-stretch{align-content:stretch!important}.align-self-auto{align-self:auto!important}.align-self-start{align-self:flex-start!important}.align-self-end{align-self:flex-end!important}.align-self-center{align-self:center!important}.align-self-baseline{align-self:baseline!important}.align-self-stretch{align-self:stretch!important}.order-first{order:-1!important}.order-0{order:0!important}.order-1{order:1!important}.order-2{order:2!important}.order-3{order:3!important}.order-4{order:4!important}.order-5{order:5!important}.order-last{order:6!important}.m-0{margin:0!important}.m-1{margin:.25rem!important}.m-2{margin:.5rem!important}.m-3{margin:1rem!important}.m-4{margin:1.5rem!important}.m-5{margin:3rem!important}.m-auto{margin:auto!important}.mx-0{margin-right:0!important;margin-left:0!important}.mx-1{margin-right:.25rem!important;margin-left:.25rem!important}.mx-2{margin-right:.5rem!important;margin-left:.5rem!important}.mx-3{margin-right:1rem!important;margin-left:1rem!important}.mx-4{margin-right:1.5rem!important;margin-left:1.5rem!important}.mx-5{margin-right:3rem!important;margin-left:3rem!important}.mx-auto{margin-right:auto!important;margin-left:auto!important}.my-0{margin-top:0!important;margin-bottom:0!important}.my-1{margin-top:.25rem!important;margin-bottom:.25rem!important}.my-2{margin-top:.5rem!important;margin-bottom:.5rem!important}.my-3{margin-top:1rem!important;margin-bottom:1rem!important}.my-4{margin-top:1.5rem!important;margin-bottom:1.5rem!important}.my-5{margin-top:3rem!important;margin-bottom:3rem!important}.my-auto{margin-top:auto!important;margin-bottom:auto!important}.mt-0{margin-top:0!important}.mt-1{margin-top:.25rem!important}.mt-2{margin-top:.5rem!important}.mt-3{margin-top:1rem!important}.mt-4{margin-top:1.5rem!important}.mt-5{margin-top:3rem!important}.mt-auto{margin-top:auto!important}.me-0{margin-right:0!important}.me-1{margin-right:.25rem!important}.me-2{margin-right:.5rem!important}.me-3{margin-right:1rem!important}.me-4{margin-right:1.5rem!important}.me-5{margin-right:3rem!important}.me-auto{margin-right:auto!important}.mb-0{margin-bottom:0!important}.mb-1{margin-bottom:.25rem!important}.mb-2{margin-bottom:.5rem!important}.mb-3{margin-bottom:1rem!important}.mb-4{margin-bottom:1.5rem!important}.mb-5{margin-bottom:3rem!important}.mb-auto{margin-bottom:auto!important}.ms-0{margin-left:0!important}.ms-1{margin-left:.25rem!important}.ms-2{margin-left:.5rem!important}.ms-3{margin-left:1rem!important}.ms-4{margin-left:1.5rem!important}.ms-5{margin-left:3rem!important}.ms-auto{margin-left:auto!important}.p-0{padding:0!important}.p-1{padding:.25rem!important}.p-2{padding:.5rem!important}.p-3{padding:1rem!important}.p-4{padding:1.5rem!important}.p-5{padding:3rem!important}.px-0{padding-right:0!important;padding-left:0!important}.px-1{padding-right:.25rem!important;padding-left:.25rem!important}.px-2{padding-right:.5rem!important;padding-left:.5rem!important}.px-3{padding-right:1rem!important;padding-left:1rem!important}.px-4{padding-right:1.5rem!important;padding-left:1.5rem!important}.px-5{padding-right:3rem!important;padding-left:3rem!important}.py-0{padding-top:0!important;padding-bottom:0!important}.py-1{padding-top:.25rem!important;padding-bottom:.25rem!important}.py-2{padding-top:.5rem!important;padding-bottom:.5rem!important}.py-3{padding-top:1rem!important;padding-bottom:1rem!important}.py-4{padding-top:1.5rem!important;padding-bottom:1.5rem!important}.py-5{padding-top:3rem!important;padding-bottom:3rem!important}.pt-0{padding-top:0!important}.pt-1{padding-top:.25rem!important}.pt-2{padding-top:.5rem!important}.pt-3{padding-top:1rem!important}.pt-4{padding-top:1.5rem!important}.pt-5{padding-top:3rem!important}.pe-0{padding-right:0!important}.pe-1{padding-right:.25rem!important}.pe-2{padding-right:.5rem!important}.pe-3{padding-right:1rem!important}.pe-4{padding-right:1.5rem!important}.pe-5{padding-right:3rem!important}.pb-0{padding-bottom:0!important}.pb-1{padding-bottom:.25rem!important}.pb-2{padding-bottom:.5rem!important}.pb-3{padding-bottom:1rem!important}.pb-4{padding-bottom:1.5rem!important}.pb-5{padding-bottom:3rem!important}.ps-0{padding-left:0!important}.ps-1{padding-left:.25rem!important}.ps-2{padding-left:.5rem!important}.ps-3{padding-left:1rem!important}.ps-4{padding-left:1.5rem!important}.ps-5{padding-left:3rem!important}.gap-0{gap:0!important}.gap-1{gap:.25rem!important}.gap-2{gap:.5rem!important}.gap-3{gap:1rem!important}.gap-4{gap:1.5rem!important}.gap-5{gap:3rem!important}.row-gap-0{row-gap:0!important}.row-gap-1{row-gap:.25rem!important}.row-gap-2{row-gap:.5rem!important}.row-gap-3{row-gap:1rem!important}.row-gap-4{row-gap:1.5rem!important}.row-gap-5{row-gap:3rem!important}.column-gap-0{-moz-column-gap:0!important;column-gap:0!important}.column-gap-1{-moz-column-gap:0.25rem!important;column-gap:.25rem!important}.column-gap-2{-moz-column-gap:0.5rem!important;column-gap:.5rem!important}.column-gap-3{-moz-column-gap:1rem!important;column-gap:1rem!important}.column-gap-4{-moz-column-gap:1.5rem!important;column-gap:1.5rem!important}.column-gap-5{-moz-column-gap:3rem!important;column-gap:3rem!important}.font-monospace{font-family:var(--bs-font-monospace)!important}.fs-1{font-size:calc(1.375rem + 1.5vw)!important}.fs-2{font-size:calc(1.325rem + .9vw)!important}.fs-3{font-size:calc(1.3rem + .6vw)!important}.fs-4{font-size:calc(1.275rem + .3vw)!important}.fs-5{font-size:1.25rem!important}.fs-6{font-size:1rem!important}.fst-italic{font-style:italic!important}.fst-normal{font-style:normal!important}.fw-lighter{font-weight:lighter!important}.fw-light{font-weight:300!important}.fw-normal{font-weight:400!important}.fw-medium{font-weight:500!important}.fw-semibold{font-weight:600!important}.fw-bold{font-weight:700!important}.fw-bolder{font-weight:bolder!important}.lh-1{line-height:1!important}.lh-sm{line-height:1.25!important}.lh-base{line-height:1.5!important}.lh-lg{line-height:2!important}.text-start{text-align:left!important}.text-end{text-align:right!important}.text-center{text-align:center!important}.text-decoration-none{text-decoration:none!important}.text-decoration-underline{text-decoration:underline!important}.text-decoration-line-through{text-decoration:line-through!important}.text-lowercase{text-transform:lowercase!important}.text-uppercase{text-transform:uppercase!important}.text-capitalize{text-transform:capitalize!important}.text-wrap{white-space:normal!important}.text-nowrap{white-space:nowrap!important}.text-break{word-wrap:break-word!important;word-break:break-word!important}.text-primary{--bs-text-opacity:1;color:rgba(var(--bs-primary-rgb),var(--bs-text-opacity))!important}.text-secondary{--bs-text-opacity:1;color:rgba(var(--bs-secondary-rgb),var(--bs-text-opacity))!important}.text-success{--bs-text-opacity:1;color:rgba(var(--bs-success-rgb),var(--bs-text-opacity))!important}.text-info{--bs-text-opacity:1;color:rgba(var(--bs-info-rgb),var(--bs-text-opacity))!important}.text-warning{--bs-text-opacity:1;color:rgba(var(--bs-warning-rgb),var(--bs-text-opacity))!important}.text-danger{--bs-text-opacity:1;color:rgba(var(--bs-danger-rgb),var(--bs-text-opacity))!important}.text-light{--bs-text-opacity:1;color:rgba(var(--bs-light-rgb),var(--bs-text-opacity))!important}.text-dark{--bs-text-opacity:1;color:rgba(var(--bs-dark-rgb),var(--bs-text-opacity))!important}.text-black{--bs-text-opacity:1;color:rgba(var(--bs-black-rgb),var(--bs-text-opacity))!important}.text-white{--bs-text-opacity:1;color:rgba(var(--bs-white-rgb),var(--bs-text-opacity))!important}.text-body{--bs-text-opacity:1;color:rgba(var(--bs-body-color-rgb),var(--bs-text-opacity))!important}.text-muted{--bs-text-opacity:1;color:var(--bs-secondary-color)!important}.text-black-50{--bs-text-opacity:1;color:rgba(0,0,0,.5)!important}.text-white-50{--bs-text-opacity:1;color:rgba(255,255,255,.5)!important}.text-body-secondary{--bs-text-opacity:1;color:var(--bs-secondary-color)!important}.text-body-tertiary{--bs-text-opacity:1;color:var(--bs-tertiary-color)!important}.text-body-emphasis{--bs-text-opacity:1;color:var(--bs-emphasis-color)!important}.text-reset{--bs-text-opacity:1;color:inherit!important}.text-opacity-25{--bs-text-opacity:0.25}.text-opacity-50{--bs-text-opacity:0.5}.text-opacity-75{--bs-text-opacity:0.75}.text-opacity-100{--bs-text-opacity:1}.text-primary-emphasis{color:var(--bs-primary-text-emphasis)!important}.text-secondary-emphasis{color:var(--bs-secondary-text-emphasis)!important}.text-success-emphasis{color:var(--bs-success-text-emphasis)!important}.text-info-emphasis{color:var(--bs-info-text-emphasis)!important}.text-warning-emphasis{color:var(--bs-warning-text-emphasis)!important}.text-danger-emphasis{color:var(--bs-danger-text-emphasis)!important}.text-light-emphasis{color:var(--bs-light-text-emphasis)!important}.text-dark-emphasis{color:var(--bs-dark-text-emphasis)!important}.link-opacity-10{--bs-link-opacity:0.1}.link-opacity-10-hover:hover{--bs-link-opacity:0.1}.link-opacity-25{--bs-link-opacity:0.25}.link-opacity-25-hover:hover{--bs-link-opacity:0.25}.link-opacity-50{--bs-link-opacity:0.5}.link-opacity-50-hover:hover{--bs-link-opacity:0.5}.link-opacity-75{--bs-link-opacity:0.75}.link-opacity-75-hover:hover{--bs-link-opacity:0.75}.link-opacity-100{--bs-link-opacity:1}.link-opacity-100-hover:hover{--bs-link-opacity:1}.link-offset-1{text-underline-offset:0.125em!important}.link-offset-1-hover:hover{text-underline-offset:0.125em!important}.link-offset-2{text-underline-offset:0.25em!important}.link-offset-2-hover:hover{text-underline-offset:0.25em!important}.link-offset-3{text-underline-offset:0.375em!important}.link-offset-3-hover:hover{text-underline-offset:0.375em!important}.link-underline-primary{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-primary-rgb),var(--bs-link-underline-opacity))!important;text-decoration-color:rgba(var(--bs-primary-rgb),var(--bs-link-underline-opacity))!important}.link-underline-secondary{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-secondary-rgb),var(--bs-link-underline-opacity))!important;text-decoration-color:rgba(var(--bs-secondary-rgb),var(--bs-link-underline-opacity))!important}.link-underline-success{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-success-rgb),var(--bs-link-underline-opacity))!important;text-decoration-color:rgba(var(--bs-success-rgb),var(--bs-link-underline-opacity))!important}.link-underline-info{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-info-rgb),var(--bs-link-underline-opacity))!important;text-decoration-color:rgba(var(--bs-info-rgb),var(--bs-link-underline-opacity))!important}.link-underline-warning{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-warning-rgb),var(--bs-link-underline-opacity))!important;text-decoration-color:rgba(var(--bs-warning-rgb),var(--bs-link-underline-opacity))!important}.link-underline-danger{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-danger-rgb),var(--bs-link-underline-opacity))!important;text-decoration-color:rgba(var(--bs-danger-rgb),var(--bs-link-underline-opacity))!important}.link-underline-light{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-light-rgb),var(--bs-link-underline-opacity))!important;text-decoration-color:rgba(var(--bs-light-rgb),var(--bs-link-underline-opacity))!important}.link-underline-dark{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-dark-rgb),var(--bs-link-underline-opacity))!important;text-decoration-color:rgba(var(--bs-dark-rgb),var(--bs-link-underline-opacity))!important}.link-underline{--bs-link-underline-opacity:1;-webkit-text-decoration-color:rgba(var(--bs-link-color-rgb),var(--bs-link-underline-opacity,1))!important;text-decoration-color:rgba(var(--bs-link-color-rgb),var(--bs-link-underline-opacity,1))!important}.link-underline-opacity-0{--bs-link-underline-opacity:0}.link-underline-opacity-0-hover:hover{--bs-link-underline-opacity:0}.link-underline-opacity-10{--bs-link-underline-opacity:0.1}.link-underline-opacity-10-hover:hover{--bs-link-underline-opacity:0.1}.link-underline-opacity-25{--bs-link-underline-opacity:0.25}.link-underline-opacity-25-hover:hover{--bs-link-underline-opacity:0.25}.link-underline-opacity-50{--bs-link-underline-opacity:0.5}.link-underline-opacity-50-hover:hover{--bs-link-underline-opacity:0.5}.link-underline-opacity-75{--bs-link-underline-opacity:0.75}.link-underline-opacity-75-hover:hover{--bs-link-underline-opacity:0.75}.link-underline-opacity-100{--bs-link-underline-opacity:1}.link-underline-opacity-100-hover:hover{--bs-link-underline-opacity:1}.bg-primary{--bs-bg-opacity:1;background-color:rgba(var(--bs-primary-rgb),var(--bs-bg-opacity))!important}.bg-secondary{--bs-bg-opacity:1;background-color:rgba(var(--bs-secondary-rgb),var(--bs-bg-opacity))!important}.bg-success{--bs-bg-opacity:1;background-color:rgba(var(--bs-success-rgb),var(--bs-bg-opacity))!important}.bg-info{--bs-bg-opacity:1;background-color:rgba(var(--bs-info-rgb),var(--bs-bg-opacity))!important}.bg-warning{--bs-bg-opacity:1;background-color:rgba(var(--bs-warning-rgb),var(--bs-bg-opacity))!important}.bg-danger{--bs-bg-opacity:1;background-color:rgba(var(--bs-danger-rgb),var(--bs-bg-opacity))!important}.bg-light{--bs-bg-opacity:1;background-color:rgba(var(--bs-light-rgb),var(--bs-bg-opacity))!important}.bg-dark{--bs-bg-opacity:1;background-color:rgba(var(--bs-dark-rgb),var(--bs-bg-opacity))!important}.bg-black{--bs-bg-opacity:1;background-color:rgba(var(--bs-black-rgb),var(--bs-bg-opacity))!important}.bg-white{--bs-bg-opacity:1;background-color:rgba(var(--bs-white-rgb),var(--bs-bg-opacity))!important}.bg-body{--bs-bg-opacity:1;background-color:rgba(var(--bs-body-bg-rgb),var(--bs-bg-opacity))!important}.bg-transparent{--bs-bg-opacity:1;background-color:transparent!important}.bg-body-secondary{--bs-bg-opacity:1;background-color:rgba(var(--bs-secondary-bg-rgb),var(--bs-bg-opacity))!important}.bg-body-tertiary{--bs-bg-opacity:1;background-color:rgba(var(--bs-tertiary-bg-rgb),var(--bs-bg-opacity))!important}.bg-opacity-10{--bs-bg-opacity:0.1}.bg-opacity-25{--bs-bg-opacity:0.25}.bg-opacity-50{--bs-bg-opacity:0.5}.bg-opacity-75{--bs-bg-opacity:0.75}.bg-opacity-100{--bs-bg-opacity:1}.bg-primary-subtle{background-color:var(--bs-primary-bg-subtle)!important}.bg-secondary-subtle{background-color:var(--bs-secondary-bg-subtle)!important}.bg-success-subtle{background-color:var(--bs-success-bg-subtle)!important}.bg-info-subtle{background-color:var(--bs-info-bg-subtle)!important}.bg-warning-subtle{background-color:var(--bs-warning-bg-subtle)!important}.bg-danger-subtle{background-color:var(--bs-danger-bg-subtle)!important}.bg-light-subtle{background-color:var(--bs-light-bg-subtle)!important}.bg-dark-subtle{background-color:var(--bs-dark-bg-subtle)!important}.bg-gradient{background-image:var(--bs-gradient)!important}.user-select-all{-webkit-user-select:all!important;-moz-user-select:all!important;user-select:all!important}.user-select-auto{-webkit-user-select:auto!important;-moz-user-select:auto!important;user-select:auto!important}.user-select-none{-webkit-user-select:none!important;-moz-user-select:none!important;user-select:none!important}.pe-none{pointer-events:none!important}.pe-auto{pointer-events:auto!important}.rounded{border-radius:var(--bs-border-radius)!important}.rounded-0{border-radius:0!important}.rounded-1{border-radius:var(--bs-border-radius-sm)!important}.rounded-2{border-radius:var(--bs-border-radius)!important}.rounded-3{border-radius:var(--bs-border-radius-lg)!important}.rounded-4{border-radius:var(--bs-border-radius-xl)!important}.rounded-5{border-radius:var(--bs-border-radius-xxl)!important}.rounded-circle{border-radius:50%!important}.rounded-pill{border-radius:var(--bs-border-radius-pill)!important}.rounded-top{border-top-left-radius:var(--bs-border-radius)!important;border-top-right-radius:var(--bs-border-radius)!important}.rounded-top-0{border-top-left-radius:0!important;border-top-right-radius:0!important}.rounded-top-1{border-top-left-radius:var(--bs-border-radius-sm)!important;border-top-right-radius:var(--bs-border-radius-sm)!important}.rounded-top-2{border-top-left-radius:var(--bs-border-radius)!important;border-top-right-radius:var(--bs-border-radius)!important}.rounded-top-3{border-top-left-radius:var(--bs-border-radius-lg)!important;border-top-right-radius:var(--bs-border-radius-lg)!important}.rounded-top-4{border-top-left-radius:var(--bs-border-radius-xl)!important;border-top-right-radius:var(--bs-border-radius-xl)!important}.rounded-top-5{border-top-left-radius:var(--bs-border-radius-xxl)!important;border-top-right-radius:var(--bs-border-radius-xxl)!important}.rounded-top-circle{border-top-left-radius:50%!important;border-top-right-radius:50%!important}.rounded-top-pill{border-top-left-radius:var(--bs-border-radius-pill)!important;border-top-right-radius:var(--bs-border-radius-pill)!important}.rounded-end{border-top-right-radius:var(--bs-border-radius)!important;border-bottom-right-radius:var(--bs-border-radius)!important}.rounded-end-0{border-top-right-radius:0!important;border-bottom-right-radius:0!important}.rounded-end-1{border-top-right-radius:var(--bs-border-radius-sm)!important;border-bottom-right-radius:var(--bs-border-radius-sm)!important}.rounded-end-2{border-top-right-radius:var(--bs-border-radius)!important;border-bottom-right-radius:var(--bs-border-radius)!important}.rounded-end-3{border-top-right-radius:var(--bs-border-radius-lg)!important;border-bottom-right-radius:var(--bs-border-radius-lg)!important}.rounded-end-4{border-top-right-radius:var(--bs-border-radius-xl)!important;border-bottom-right-radius:var(--bs-border-radius-xl)!important}.rounded-end-5{border-top-right-radius:var(--bs-border-radius-xxl)!important;border-bottom-right-radius:var(--bs-border-radius-xxl)!important}.rounded-end-circle{border-top-right-radius:50%!important;border-bottom-right-radius:50%!important}.rounded-end-pill{border-top-right-radius:var(--bs-border-radius-pill)!important;border-bottom-right-radius:var(--bs-border-radius-pill)!important}.rounded-bottom{border-bottom-right-radius:var(--bs-border-radius)!important;border-bottom-left-radius:var(--bs-border-radius)!important}.rounded-bottom-0{border-bottom-right-radius:0!important;border-bottom-left-radius:0!important}.rounded-bottom-1{border-bottom-right-radius:var(--bs-border-radius-sm)!important;border-bottom-left-radius:var(--bs-border-radius-sm)!important}.rounded-bottom-2{border-bottom-right-radius:var(--bs-border-radius)!important;border-bottom-left-radius:var(--bs-border-radius)!important}.rounded-bottom-3{border-bottom-right-radius:var(--bs-border-radius-lg)!important;border-bottom-left-radius:var(--bs-border-radius-lg)!important}.rounded-bottom-4{border-bottom-right-radius:var(--bs-border-radius-xl)!important;border-bottom-left-radius:var(--bs-border-radius-xl)!important}.rounded-bottom-5{border-bottom-right-radius:var(--bs-border-radius-xxl)!important;border-bottom-left-radius:var(--bs-border-radius-xxl)!important}.rounded-bottom-circle{border-bottom-right-radius:50%!important;border-bottom-left-radius:50%!important}.rounded-bottom-pill{border-bottom-right-radius:var(--bs-border-radius-pill)!important;border-bottom-left-radius:var(--bs-border-radius-pill)!important}.rounded-start{border-bottom-left-radius:var(--bs-border-radius)!important;border-top-left-radius:var(--bs-border-radius)!important}.rounded-start-0{border-bottom-left-radius:0!important;border-top-left-radius:0!important}.rounded-start-1{border-bottom-left-radius:var(--bs-border-radius-sm)!important;border-top-left-radius:var(--bs-border-radius-sm)!important}.rounded-start-2{border-bottom-left-radius:var(--bs-border-radius)!important;border-top-left-radius:var(--bs-border-radius)!important}.rounded-start-3{border-bottom-left-radius:var(--bs-border-radius-lg)!important;border-top-left-radius:var(--bs-border-radius-lg)!important}.rounded-start-4{border-bottom-left-radius:var(--bs-border-radius-xl)!important;border-top-left-radius:var(--bs-border-radius-xl)!important}.rounded-start-5{border-bottom-left-radius:var(--bs-border-radius-xxl)!important;border-top-left-radius:var(--bs-border-radius-xxl)!important}.rounded-start-circle{border-bottom-left-radius:50%!important;border-top-left-radius:50%!important}.rounded-start-pill{border-bottom-left-radius:var(--bs-border-radius-pill)!important;border-top-left-radius:var(--bs-border-radius-pill)!important}.visible{visibility:visible!important}.invisible{visibility:hidden!important}.z-n1{z-index:-1!important}.z-0{z-index:0!important}.z-1{z-index:1!important}.z-2{z-index:2!important}.z-3{z-index:3!important}@media (min-width:576px){.float-sm-start{float:left!important}.float-sm-end{float:right!important}.float-sm-none{float:none!important}.object-fit-sm-contain{-o-object-fit:contain!important;object-fit:contain!important}.object-fit-sm-cover{-o-object-fit:cover!important;object-fit:cover!important}.object-fit-sm-fill{-o-object-fit:fill!important;object-fit:fill!important}.object-fit-sm-scale{-o-object-fit:scale-down!important;object-fit:scale-down!important}.object-fit-sm-none{-o-object-fit:none!important;object-fit:none!important}.d-sm-inline{display:inline!important}.d-sm-inline-block{display:inline-block!important}.d-sm-block{display:block!important}.d-sm-grid{display:grid!important}.d-sm-inline-grid{display:inline-grid!important}.d-sm-table{display:table!important}.d-sm-table-row{display:table-row!important}.d-sm-table-cell{display:table-cell!important}.d-sm-flex{display:flex!important}.d-sm-inline-flex{display:inline-flex!important}.d-sm-none{display:none!important}.flex-sm-fill{flex:1 1 auto!important}.flex-sm-row{flex-direction:row!important}.flex-sm-column{flex-direction:column!important}.flex-sm-row-reverse{flex-direction:row-reverse!important}.flex-sm-column-reverse{flex-direction:column-reverse!important}.flex-sm-grow-0{flex-grow:0!important}.flex-sm-grow-1{flex-grow:1!important}.flex-sm-shrink-0{flex-shrink:0!important}.flex-sm-shrink-1{flex-shrink:1!important}.flex-sm-wrap{flex-wrap:wrap!important}.flex-sm-nowrap{flex-wrap:nowrap!important}.flex-sm-wrap-reverse{flex-wrap:wrap-reverse!important}.justify-content-sm-start{justify-content:flex-start!important}.justify-content-sm-end{justify-content:flex-end!important}.justify-content-sm-center{justify-content:center!important}.justify-content-sm-between{justify-content:space-between!important}.justify-content-sm-around{justify-content:space-around!important}.justify-content-sm-evenly{justify-content:space-evenly!important}.align-items-sm-start{align-items:flex-start!important}.align-items-sm-end{align-items:flex-end!important}.align-items-sm-center{align-items:center!important}.align-items-sm-baseline{align-items:baseline!important}.align-items-sm-stretch{align-items:stretch!important}.align-content-sm-start{align-content:flex-start!important}.align-content-sm-end{align-content:flex-end!important}.align-content-sm-center{align-content:center!important}.align-content-sm-between{align-content:space-between!important}.align-content-sm-around{align-content:space-around!important}.align-content-sm-stretch{align-content:stretch!important}.align-self-sm-auto{align-self:auto!important}.align-self-sm-start{align-self:flex-start!important}.align-self-sm-end{align-self:flex-end!important}.align-self-sm-center{align-self:center!important}.align-self-sm-baseline{align-self:baseline!important}.align-self-sm-stretch{align-self:stretch!important}.order-sm-first{order:-1!important}.order-sm-0{order:0!important}.order-sm-1{order:1!important}.order-sm-2{order:2!important}.order-sm-3{order:3!important}.order-sm-4{order:4!important}.order-sm-5{order:5!important}.order-sm-last{order:6!important}.m-sm-0{margin:0!important}.m-sm-1{margin:.25rem!important}.m-sm-2{margin:.5rem!important}.m-sm-3{margin:1rem!important}.m-sm-4{margin:1.5rem!important}.m-sm-5{margin:3rem!important}.m-sm-auto{margin:auto!important}.mx-sm-0{margin-right:0!important;margin-left:0!important}.mx-sm-1{margin-right:.25rem!important;margin-left:.25rem!important}.mx-sm-2{margin-right:.5rem!important;margin-left:.5rem!important}.mx-sm-3{margin-right:1rem!important;margin-left:1rem!important}.mx-sm-4{margin-right:1.5rem!important;margin-left:1.5rem!important}.mx-sm-5{margin-right:3rem!important;margin-left:3rem!important}.mx-sm-auto{margin-right:auto!important;margin-left:auto!important}.my-sm-0{margin-top:0!important;margin-bottom:0!important}.my-sm-1{margin-top:.25rem!important;margin-bottom:.25rem!important}.my-sm-2{margin-top:.5rem!important;margin-bottom:.5rem!important}.my-sm-3{margin-top:1rem!important;margin-bottom:1rem!important}.my-sm-4{margin-top:1.5rem!important;margin-bottom:1.5rem!important}.my-sm-5{margin-top:3rem!important;margin-bottom:3rem!important}.my-sm-auto{margin-top:auto!important;margin-bottom:auto!important}.mt-sm-0{margin-top:0!important}.mt-sm-1{margin-top:.25rem!important}.mt-sm-2{margin-top:.5rem!important}.mt-sm-3{margin-top:1rem!important}.mt-sm-4{margin-top:1.5rem!important}.mt-sm-5{margin-top:3rem!important}.mt-sm-auto{margin-top:auto!important}.me-sm-0{margin-right:0!important}.me-sm-1{margin-right:.25rem!important}.me-sm-2{margin-right:.5rem!important}.me-sm-3{margin-right:1rem!important}.me-sm-4{margin-right:1.5rem!important}.me-sm-5{margin-right:3rem!important}.me-sm-auto{margin-right:auto!important}.mb-sm-0{margin-bottom:0!important}.mb-sm-1{margin-bottom:.25rem!important}.mb-sm-2{margin-bottom:.5rem!important}.mb-sm-3{margin-bottom:1rem!important}.mb-sm-4{margin-bottom:1.5rem!important}.mb-sm-5{margin-bottom:3rem!important}.mb-sm-auto{margin-bottom:auto!important}.ms-sm-0{margin-left:0!important}.ms-sm-1{margin-left:.25rem!important}.ms-sm-2{margin-left:.5rem!important}.ms-sm-3{margin-left:1rem!important}.ms-sm-4{margin-left:1.5rem!important}.ms-sm-5{margin-left:3rem!important}.ms-sm-auto{margin-left:auto!important}.p-sm-0{padding:0!important}.p-sm-1{padding:.25rem!important}.p-sm-2{padding:.5rem!important}.p-sm-3{padding:1rem!important}.p-sm-4{padding:1.5rem!important}.p-sm-5{padding:3rem!important}.px-sm-0{padding-right:0!important;padding-left:0!important}.px-sm-1{padding-right:.25rem!important;padding-left:.25rem!important}.px-sm-2{padding-right:.5rem!important;padding-left:.5rem!important}.px-sm-3{padding-right:1rem!important;padding-left:1rem!important}.px-sm-4{padding-right:1.5rem!important;padding-left:1.5rem!important}.px-sm-5{padding-right:3rem!important;padding-left:3rem!important}.py-sm-0{padding-top:0!important;padding-bottom:0!important}.py-sm-1{padding-top:.25rem!important;padding-bottom:.25rem!important}.py-sm-2{padding-top:.5rem!important;padding-bottom:.5rem!important}.py-sm-3{padding-top:1rem!important;padding-bottom:1rem!important}.py-sm-4{padding-top:1.5rem!important;padding-bottom:1.5rem!important}.py-sm-5{padding-top:3rem!important;padding-bottom:3rem!important}.pt-sm-0{padding-top:0!important}.pt-sm-1{padding-top:.25rem!important}.pt-sm-2{padding-top:.5rem!important}.pt-sm-3{padding-top:1rem!important}.pt-sm-4{padding-top:1.5rem!important}.pt-sm-5{padding-top:3rem!important}.pe-sm-0{padding-right:0!important}.pe-sm-1{padding-right:.25rem!important}.pe-sm-2{padding-right:.5rem!important}.pe-sm-3{padding-right:1rem!important}.pe-sm-4{padding-right:1.5rem!important}.pe-sm-5{padding-right:3rem!important}.pb-sm-0{padding-bottom:0!important}.pb-sm-1{padding-bottom:.25rem!important}.pb-sm-2{padding-bottom:.5rem!important}.pb-sm-3{padding-bottom:1rem!important}.pb-sm-4{padding-bottom:1.5rem!important}.pb-sm-5{padding-bottom:3rem!important}.ps-sm-0{padding-left:0!important}.ps-sm-1{padding-left:.25rem!important}.ps-sm-2{padding-left:.5rem!important}.ps-sm-3{padding-left:1rem!important}.ps-sm-4{padding-left:1.5rem!important}.ps-sm-5{padding-left:3rem!important}.gap-sm-0{gap:0!important}.gap-sm-1{gap:.25rem!important}.gap-sm-2{gap:.5rem!important}.gap-sm-3{gap:1rem!important}.gap-sm-4{gap:1.5rem!important}.gap-sm-5{gap:3rem!important}.row-gap-sm-0{row-gap:0!important}.row-gap-sm-1{row-gap:.25rem!important}.row-gap-sm-2{row-gap:.5rem!important}.row-gap-sm-3{row-gap:1rem!important}.row-gap-sm-4{row-gap:1.5rem!important}.row-gap-sm-5{row-gap:3rem!important}.column-gap-sm-0{-moz-column-gap:0!important;column-gap:0!important}.column-gap-sm-1{-moz-column-gap:0.25rem!important;column-gap:.25rem!important}.column-gap-sm-2{-moz-column-gap:0.5rem!important;column-gap:.5rem!important}.column-gap-sm-3{-moz-column-gap:1rem!important;column-gap:1rem!important}.column-gap-sm-4{-moz-column-gap:1.5rem!important;column-gap:1.5rem!important}.column-gap-sm-5{-moz-column-gap:3rem!important;column-gap:3rem!important}.text-sm-start{text-align:left!important}.text-sm-end{text-align:right!important}.text-sm-center{text-align:center!important}}@media (min-width:768px){.float-md-start{float:left!important}.float-md-end{float:right!important}.float-md-none{float:none!important}.object-fit-md-contain{-o-object-fit:contain!important;object-fit:contain!important}.object-fit-md-cover{-o-object-fit:cover!important;object-fit:cover!important}.object-fit-md-fill{-o-object-fit:fill!important;object-fit:fill!important}.object-fit-md-scale{-o-object-fit:scale-down!important;object-fit:scale-down!important}.object-fit-md-none{-o-object-fit:none!important;object-fit:none!important}.d-md-inline{display:inline!important}.d-md-inline-block{display:inline-block!important}.d-md-block{display:block!important}.d-md-grid{display:grid!important}.d-md-inline-grid{display:inline-grid!important}.d-md-table{display:table!important}.d-md-table-row{display:table-row!important}.d-md-table-cell{display:table-cell!important}.d-md-flex{display:flex!important}.d-md-inline-flex{display:inline-flex!important}.d-md-none{display:none!important}.flex-md-fill{flex:1 1 auto!important}.flex-md-row{flex-direction:row!important}.flex-md-column{flex-direction:column!important}.flex-md-row-reverse{flex-direction:row-reverse!important}.flex-md-column-reverse{flex-direction:column-reverse!important}.flex-md-grow-0{flex-grow:0!important}.flex-md-grow-1{flex-grow:1!important}.flex-md-shrink-0{flex-shrink:0!important}.flex-md-shrink-1{flex-shrink:1!important}.flex-md-wrap{flex-wrap:wrap!important}.flex-md-nowrap{flex-wrap:nowrap!important}.flex-md-wrap-reverse{flex-wrap:wrap-reverse!important}.justify-content-md-start{justify-content:flex-start!important}.justify-content-md-end{justify-content:flex-end!important}.justify-content-md-center{justify-content:center!important}.justify-content-md-between{justify-content:space-between!important}.justify-content-md-around{justify-content:space-around!important}.justify-content-md-evenly{justify-content:space-evenly!important}.align-items-md-start{align-items:flex-start!important}.align-items-md-end{align-items:flex-end!important}.align-items-md-center{align-items:center!important}.align-items-md-baseline{align-items:baseline!important}.align-items-md-stretch{align-items:stretch!important}.align-content-md-start{align-content:flex-start!important}.align-content-md-end{align-content:flex-end!important}.align-content-md-center{align-content:center!important}.align-content-md-between{align-content:space-between!important}.align-content-md-around{align-content:space-around!important}.align-content-md-stretch{align-content:stretch!important}.align-self-md-auto{align-self:auto!important}.align-self-md-start{align-self:flex-start!important}.align-self-md-end{align-self:flex-end!important}.align-self-md-center{align-self:center!important}.align-self-md-baseline{align-self:baseline!important}.align-self-md-stretch{align-self:stretch!important}.order-md-first{order:-1!important}.order-md-0{order:0!important}.order-md-1{order:1!important}.order-md-2{order:2!important}.order-md-3{order:3!important}.order-md-4{order:4!important}.order-md-5{order:5!important}.order-md-last{order:6!important}.m-md-0{margin:0!important}.m-md-1{margin:.25rem!important}.m-md-2{margin:.5rem!important}.m-md-3{margin:1rem!important}.m-md-4{margin:1.5rem!important}.m-md-5{margin:3rem!important}.m-md-auto{margin:auto!important}.mx-md-0{margin-right:0!important;margin-left:0!important}.mx-md-1{margin-right:.25rem!important;margin-left:.25rem!important}.mx-md-2{margin-right:.5rem!important;margin-left:.5rem!important}.mx-md-3{margin-right:1rem!important;margin-left:1rem!important}.mx-md-4{margin-right:1.5rem!important;margin-left:1.5rem!important}.mx-md-5{margin-right:3rem!important;margin-left:3rem!important}.mx-md-auto{margin-right:auto!important;margin-left:auto!important}.my-md-0{margin-top:0!important;margin-bottom:0!important}.my-md-1{margin-top:.25rem!important;margin-bottom:.25rem!important}.my-md-2{margin-top:.5rem!important;margin-bottom:.5rem!important}.my-md-3{margin-top:1rem!important;margin-bottom:1rem!important}.my-md-4{margin-top:1.5rem!important;margin-bottom:1.5rem!important}.my-md-5{margin-top:3rem!important;margin-bottom:3rem!important}.my-md-auto{margin-top:auto!important;margin-bottom:auto!important}.mt-md-0{margin-top:0!important}.mt-md-1{margin-top:.25rem!important}.mt-md-2{margin-top:.5rem!important}.mt-md-3{margin-top:1rem!important}.mt-md-4{margin-top:1.5rem!important}.mt-md-5{margin-top:3rem!important}.mt-md-auto{margin-top:auto!important}.me-md-0{margin-right:0!important}.me-md-1{margin-right:.25rem!important}.me-md-2{margin-right:.5rem!important}.me-md-3{margin-right:1rem!important}.me-md-4{margin-right:1.5rem!important}.me-md-5{margin-right:3rem!important}.me-md-auto{margin-right:auto!important}.mb-md-0{margin-bottom:0!important}.mb-md-1{margin-bottom:.25rem!important}.mb-md-2{margin-bottom:.5rem!important}.mb-md-3{margin-bottom:1rem!important}.mb-md-4{margin-bottom:1.5rem!important}.mb-md-5{margin-bottom:3rem!important}.mb-md-auto{margin-bottom:auto!important}.ms-md-0{margin-left:0!important}.ms-md-1{margin-left:.25rem!important}.ms-md-2{margin-left:.5rem!important}.ms-md-3{margin-left:1rem!important}.ms-md-4{margin-left:1.5rem!important}.ms-md-5{margin-left:3rem!important}.ms-md-auto{margin-left:auto!important}.p-md-0{padding:0!important}.p-md-1{padding:.25rem!important}.p-md-2{padding:.5rem!important}.p-md-3{padding:1rem!important}.p-md-4{padding:1.5rem!important}.p-md-5{padding:3rem!important}.px-md-0{padding-right:0!important;padding-left:0!important}.px-md-1{padding-right:.25rem!important;padding-left:.25rem!important}.px-md-2{padding-right:.5rem!important;padding-left:.5rem!important}.px-md-3{padding-right:1rem!important;padding-left:1rem!important}.px-md-4{padding-right:1.5rem!important;padding-left:1.5rem!important}.px-md-5{padding-right:3rem!important;padding-left:3rem!important}.py-md-0{padding-top:0!important;padding-bottom:0!important}.py-md-1{padding-top:.25rem!important;padding-bottom:.25rem!important}.py-md-2{padding-top:.5rem!important;padding-bottom:.5rem!important}.py-md-3{padding-top:1rem!important;padding-bottom:1rem!important}.py-md-4{padding-top:1.5rem!important;padding-bottom:1.5rem!important}.py-md-5{padding-top:3rem!important;padding-bottom:3rem!important}.pt-md-0{padding-top:0!important}.pt-md-1{padding-top:.25rem!important}.pt-md-2{padding-top:.5rem!important}.pt-md-3{padding-top:1rem!important}.pt-md-4{padding-top:1.5rem!important}.pt-md-5{padding-top:3rem!important}.pe-md-0{padding-right:0!important}.pe-md-1{padding-right:.25rem!important}.pe-md-2{padding-right:.5rem!important}.pe-md-3{padding-right:1rem!important}.pe-md-4{padding-right:1.5rem!important}.pe-md-5{padding-right:3rem!important}.pb-md-0{padding-bottom:0!important}.pb-md-1{padding-bottom:.25rem!important}.pb-md-2{padding-bottom:.5rem!important}.pb-md-3{padding-bottom:1rem!important}.pb-md-4{padding-bottom:1.5rem!important}.pb-md-5{padding-bottom:3rem!important}.ps-md-0{padding-left:0!important}.ps-md-1{padding-left:.25rem!important}.ps-md-2{padding-left:.5rem!important}.ps-md-3{padding-left:1rem!important}.ps-md-4{padding-left:1.5rem!important}.ps-md-5{padding-left:3rem!important}.gap-md-0{gap:0!important}.gap-md-1{gap:.25rem!important}.gap-md-2{gap:.5rem!important}.gap-md-3{gap:1rem!important}.gap-md-4{gap:1.5rem!important}.gap-md-5{gap:3rem!important}.row-gap-md-0{row-gap:0!important}.row-gap-md-1{row-gap:.25rem!important}.row-gap-md-2{row-gap:.5rem!important}.row-gap-md-3{row-gap:1rem!important}.row-gap-md-4{row-gap:1.5rem!important}.row-gap-md-5{row-gap:3rem!important}.column-gap-md-0{-moz-column-gap:0!important;column-gap:0!important}.column-gap-md-1{-moz-column-gap:0.25rem!important;column-gap:.25rem!important}.column-gap-md-2{-moz-column-gap:0.5rem!important;column-gap:.5rem!important}.column-gap-md-3{-moz-column-gap:1rem!important;column-gap:1rem!important}.column-gap-md-4{-moz-column-gap:1.5rem!important;column-gap:1.5rem!important}.column-gap-md-5{-moz-column-gap:3rem!important;column-gap:3rem!important}.text-md-start{text-align:left!important}.text-md-end{text-align:right!important}.text-md-center{text-align:center!important}}@media (min-width:992px){.float-lg-start{float:left!important}.float-lg-end{float:right!important}.float-lg-none{float:none!important}.object-fit-lg-contain{-o-object-fit:contain!important;object-fit:contain!important}.object-fit-lg-cover{-o-object-fit:cover!important;object-fit:cover!important}.object-fit-lg-fill{-o-object-fit:fill!important;object-fit:fill!important}.object-fit-lg-scale{-o-object-fit:scale-down!important;object-fit:scale-down!important}.object-fit-lg-none{-o-object-fit:none!important;object-fit:none!important}.d-lg-inline{display:inline!important}.d-lg-inline-block{display:inline-block!important}.d-lg-block{display:block!important}.d-lg-grid{display:grid!important}.d-lg-inline-grid{display:inline-grid!important}.d-lg-table{display:table!important}.d-lg-table-row{display:table-row!important}.d-lg-table-cell{display:table-cell!important}.d-lg-flex{display:flex!important}.d-lg-inline-flex{display:inline-flex!important}.d-lg-none{display:none!important}.flex-lg-fill{flex:1 1 auto!important}.flex-lg-row{flex-direction:row!important}.flex-lg-column{flex-direction:column!important}.flex-lg-row-reverse{flex-direction:row-reverse!important}.flex-lg-column-reverse{flex-direction:column-reverse!important}.flex-lg-grow-0{flex-grow:0!important}.flex-lg-grow-1{flex-grow:1!important}.flex-lg-shrink-0{flex-shrink:0!important}.flex-lg-shrink-1{flex-shrink:1!important}.flex-lg-wrap{flex-wrap:wrap!important}.flex-lg-nowrap{flex-wrap:nowrap!important}.flex-lg-wrap-reverse{flex-wrap:wrap-reverse!important}.justify-content-lg-start{justify-content:flex-start!important}.justify-content-lg-end{justify-content:flex-end!important}.justify-content-lg-center{justify-content:center!important}.justify-content-lg-between{justify-content:space-between!important}.justify-content-lg-around{justify-content:space-around!important}.justify-content-lg-evenly{justify-content:space-evenly!important}.align-items-lg-start{align-items:flex-start!important}.align-items-lg-end{align-items:flex-end!important}.align-items-lg-center{align-items:center!important}.align-items-lg-baseline{align-items:baseline!important}.align-items-lg-stretch{align-items:stretch!important}.align-content-lg-start{align-content:flex-start!important}.align-content-lg-end{align-content:flex-end!important}.align-content-lg-center{align-content:center!important}.align-content-lg-between{align-content:space-between!important}.align-content-lg-around{align-content:space-around!important}.align-content-lg-stretch{align-content:stretch!important}.align-self-lg-auto{align-self:auto!important}.align-self-lg-start{align-self:flex-start!important}.align-self-lg-end{align-self:flex-end!important}.align-self-lg-center{align-self:center!important}.align-self-lg-baseline{align-self:baseline!important}.align-self-lg-stretch{align-self:stretch!important}.order-lg-first{order:-1!important}.order-lg-0{order:0!important}.order-lg-1{order:1!important}.order-lg-2{order:2!important}.order-lg-3{order:3!important}.order-lg-4{order:4!important}.order-lg-5{order:5!important}.order-lg-last{order:6!important}.m-lg-0{margin:0!important}.m-lg-1{margin:.25rem!important}.m-lg-2{margin:.5rem!important}.m-lg-3{margin:1rem!important}.m-lg-4{margin:1.5rem!important}.m-lg-5{margin:3rem!important}.m-lg-auto{margin:auto!important}.mx-lg-0{margin-right:0!important;margin-left:0!important}.mx-lg-1{margin-right:.25rem!important;margin-left:.25rem!important}.mx-lg-2{margin-right:.5rem!important;margin-left:.5rem!important}.mx-lg-3{margin-right:1rem!important;margin-left:1rem!important}.mx-lg-4{margin-right:1.5rem!important;margin-left:1.5rem!important}.mx-lg-5{margin-right:3rem!important;margin-left:3rem!important}.mx-lg-auto{margin-right:auto!important;margin-left:auto!important}.my-lg-0{margin-top:0!important;margin-bottom:0!important}.my-lg-1{margin-top:.25rem!important;margin-bottom:.25rem!important}.my-lg-2{margin-top:.5rem!important;margin-bottom:.5rem!important}.my-lg-3{margin-top:1rem!important;margin-bottom:1rem!important}.my-lg-4{margin-top:1.5rem!important;margin-bottom:1.5rem!important}.my-lg-5{margin-top:3rem!important;margin-bottom:3rem!important}.my-lg-auto{margin-top:auto!important;margin-bottom:auto!important}.mt-lg-0{margin-top:0!important}.mt-lg-1{margin-top:.25rem!important}.mt-lg-2{margin-top:.5rem!important}.mt-lg-3{margin-top:1rem!important}.mt-lg-4{margin-top:1.5rem!important}.mt-lg-5{margin-top:3rem!important}.mt-lg-auto{margin-top:auto!important}.me-lg-0{margin-right:0!important}.me-lg-1{margin-right:.25rem!important}.me-lg-2{margin-right:.5rem!important}.me-lg-3{margin-right:1rem!important}.me-lg-4{margin-right:1.5rem!important}.me-lg-5{margin-right:3rem!important}.me-lg-auto{margin-right:auto!important}.mb-lg-0{margin-bottom:0!important}.mb-lg-1{margin-bottom:.25rem!important}.mb-lg-2{margin-bottom:.5rem!important}.mb-lg-3{margin-bottom:1rem!important}.mb-lg-4{margin-bottom:1.5rem!important}.mb-lg-5{margin-bottom:3rem!important}.mb-lg-auto{margin-bottom:auto!important}.ms-lg-0{margin-left:0!important}.ms-lg-1{margin-left:.25rem!important}.ms-lg-2{margin-left:.5rem!important}.ms-lg-3{margin-left:1rem!important}.ms-lg-4{margin-left:1.5rem!important}.ms-lg-5{margin-left:3rem!important}.ms-lg-auto{margin-left:auto!important}.p-lg-0{padding:0!important}.p-lg-1{padding:.25rem!important}.p-lg-2{padding:.5rem!important}.p-lg-3{padding:1rem!important}.p-lg-4{padding:1.5rem!important}.p-lg-5{padding:3rem!important}.px-lg-0{padding-right:0!important;padding-left:0!important}.px-lg-1{padding-right:.25rem!important;padding-left:.25rem!important}.px-lg-2{padding-right:.5rem!important;padding-left:.5rem!important}.px-lg-3{padding-right:1rem!important;padding-left:1rem!important}.px-lg-4{padding-right:1.5rem!important;padding-left:1.5rem!important}.px-lg-5{padding-right:3rem!important;padding-left:3rem!important}.py-lg-0{padding-top:0!important;padding-bottom:0!important}.py-lg-1{padding-top:.25rem!important;padding-bottom:.25rem!important}.py-lg-2{padding-top:.5rem!important;padding-bottom:.5rem!important}.py-lg-3{padding-top:1rem!important;padding-bottom:1rem!important}.py-lg-4{padding-top:1.5rem!important;padding-bottom:1.5rem!important}.py-lg-5{padding-top:3rem!important;padding-bottom:3rem!important}.pt-lg-0{padding-top:0!important}.pt-lg-1{padding-top:.25rem!important}.pt-lg-2{padding-top:.5rem!important}.pt-lg-3{padding-top:1rem!important}.pt-lg-4{padding-top:1.5rem!important}.pt-lg-5{padding-top:3rem!important}.pe-lg-0{padding-right:0!important}.pe-lg-1{padding-right:.25rem!important}.pe-lg-2{padding-right:.5rem!important}.pe-lg-3{padding-right:1rem!important}.pe-lg-4{padding-right:1.5rem!important}.pe-lg-5{padding-right:3rem!important}.pb-lg-0{padding-bottom:0!important}.pb-lg-1{padding-bottom:.25rem!important}.pb-lg-2{padding-bottom:.5rem!important}.pb-lg-3{padding-bottom:1rem!important}.pb-lg-4{padding-bottom:1.5rem!important}.pb-lg-5{padding-bottom:3rem!important}.ps-lg-0{padding-left:0!important}.ps-lg-1{padding-left:.25rem!important}.ps-lg-2{padding-left:.5rem!important}.ps-lg-3{padding-left:1rem!important}.ps-lg-4{padding-left:1.5rem!important}.ps-lg-5{padding-left:3rem!important}.gap-lg-0{gap:0!important}.gap-lg-1{gap:.25rem!important}.gap-lg-2{gap:.5rem!important}.gap-lg-3{gap:1rem!important}.gap-lg-4{gap:1.5rem!important}.gap-lg-5{gap:3rem!important}.row-gap-lg-0{row-gap:0!important}.row-gap-lg-1{row-gap:.25rem!important}.row-gap-lg-2{row-gap:.5rem!important}.row-gap-lg-3{row-gap:1rem!important}.row-gap-lg-4{row-gap:1.5rem!important}.row-gap-lg-5{row-gap:3rem!important}.column-gap-lg-0{-moz-column-gap:0!important;column-gap:0!important}.column-gap-lg-1{-moz-column-gap:0.25rem!important;column-gap:.25rem!important}.column-gap-lg-2{-moz-column-gap:0.5rem!important;column-gap:.5rem!important}.column-gap-lg-3{-moz-column-gap:1rem!important;column-gap:1rem!important}.column-gap-lg-4{-moz-column-gap:1.5rem!important;column-gap:1.5rem!important}.column-gap-lg-5{-moz-column-gap:3rem!important;column-gap:3rem!important}.text-lg-start{text-align:left!important}.text-lg-end{text-align:right!important}.text-lg-center{text-align:center!important}}@media (min-width:1200px){.float-xl-start{float:left!important}.float-xl-end{float:right!important}.float-xl-none{float:none!important}.object-fit-xl-contain{-o-object-fit:contain!important;object-fit:contain!important}.object-fit-xl-cover{-o-object-fit:cover!important;object-fit:cover!important}.object-fit-xl-fill{-o-object-fit:fill!important;object-fit:fill!important}.object-fit-xl-scale{-o-object-fit:scale-down!important;object-fit:scale-down!important}.object-fit-xl-none{-o-object-fit:none!important;object-fit:none!important}.d-xl-inline{display:inline!important}.d-xl-inline-block{display:inline-block!important}.d-xl-block{display:block!important}.d-xl-grid{display:grid!important}.d-xl-inline-grid{display:inline-grid!important}.d-xl-table{display:table!important}.d-xl-table-row{display:table-row!important}.d-xl-table-cell{display:table-cell!important}.d-xl-flex{display:flex!important}.d-xl-inline-flex{display:inline-flex!important}.d-xl-none{display:none!important}.flex-xl-fill{flex:1 1 auto!important}.flex-xl-row{flex-direction:row!important}.flex-xl-column{flex-direction:column!important}.flex-xl-row-reverse{flex-direction:row-reverse!important}.flex-xl-column-reverse{flex-direction:column-reverse!important}.flex-xl-grow-0{flex-grow:0!important}.flex-xl-grow-1{flex-grow:1!important}.flex-xl-shrink-0{flex-shrink:0!important}.flex-xl-shrink-1{flex-shrink:1!important}.flex-xl-wrap{flex-wrap:wrap!important}.flex-xl-nowrap{flex-wrap:nowrap!important}.flex-xl-wrap-reverse{flex-wrap:wrap-reverse!important}.justify-content-xl-start{justify-content:flex-start!important}.justify-content-xl-end{justify-content:flex-end!important}.justify-content-xl-center{justify-content:center!important}.justify-content-xl-between{justify-content:space-between!important}.justify-content-xl-around{justify-content:space-around!important}.justify-content-xl-evenly{justify-content:space-evenly!important}.align-items-xl-start{align-items:flex-start!important}.align-items-xl-end{align-items:flex-end!important}.align-items-xl-center{align-items:center!important}.align-items-xl-baseline{align-items:baseline!important}.align-items-xl-stretch{align-items:stretch!important}.align-content-xl-start{align-content:flex-start!important}.align-content-xl-end{align-content:flex-end!important}.align-content-xl-center{align-content:center!important}.align-content-xl-between{align-content:space-between!important}.align-content-xl-around{align-content:space-around!important}.align-content-xl-stretch{align-content:stretch!important}.align-self-xl-auto{align-self:auto!important}.align-self-xl-start{align-self:flex-start!important}.align-self-xl-end{align-self:flex-end!important}.align-self-xl-center{align-self:center!important}.align-self-xl-baseline{align-self:baseline!important}.align-self-xl-stretch{align-self:stretch!important}.order-xl-first{order:-1!important}.order-xl-0{order:0!important}.order-xl-1{order:1!important}.order-xl-2{order:2!important}.order-xl-3{order:3!important}.order-xl-4{order:4!important}.order-xl-5{order:5!important}.order-xl-last{order:6!important}.m-xl-0{margin:0!important}.m-xl-1{margin:.25rem!important}.m-xl-2{margin:.5rem!important}.m-xl-3{margin:1rem!important}.m-xl-4{margin:1.5rem!important}.m-xl-5{margin:3rem!important}.m-xl-auto{margin:auto!important}.mx-xl-0{margin-right:0!important;margin-left:0!important}.mx-xl-1{margin-right:.25rem!important;margin-left:.25rem!important}.mx-xl-2{margin-right:.5rem!important;margin-left:.5rem!important}.mx-xl-3{margin-right:1rem!important;margin-left:1rem!important}.mx-xl-4{margin-right:1.5rem!important;margin-left:1.5rem!important}.mx-xl-5{margin-right:3rem!important;margin-left:3rem!important}.mx-xl-auto{margin-right:auto!important;margin-left:auto!important}.my-xl-0{margin-top:0!important;margin-bottom:0!important}.my-xl-1{margin-top:.25rem!important;margin-bottom:.25rem!important}.my-xl-2{margin-top:.5rem!important;margin-bottom:.5rem!important}.my-xl-3{margin-top:1rem!important;margin-bottom:1rem!important}.my-xl-4{margin-top:1.5rem!important;margin-bottom:1.5rem!important}.my-xl-5{margin-top:3rem!important;margin-bottom:3rem!important}.my-xl-auto{margin-top:auto!important;margin-bottom:auto!important}.mt-xl-0{margin-top:0!important}.mt-xl-1{margin-top:.25rem!important}.mt-xl-2{margin-top:.5rem!important}.mt-xl-3{margin-top:1rem!important}.mt-xl-4{margin-top:1.5rem!important}.mt-xl-5{margin-top:3rem!important}.mt-xl-auto{margin-top:auto!important}.me-xl-0{margin-right:0!important}.me-xl-1{margin-right:.25rem!important}.me-xl-2{margin-right:.5rem!important}.me-xl-3{margin-right:1rem!important}.me-xl-4{margin-right:1.5rem!important}.me-xl-5{margin-right:3rem!important}.me-xl-auto{margin-right:auto!important}.mb-xl-0{margin-bottom:0!important}.mb-xl-1{margin-bottom:.25rem!important}.mb-xl-2{margin-bottom:.5rem!important}.mb-xl-3{margin-bottom:1rem!important}.mb-xl-4{margin-bottom:1.5rem!important}.mb-xl-5{margin-bottom:3rem!important}.mb-xl-auto{margin-bottom:auto!important}.ms-xl-0{margin-left:0!important}.ms-xl-1{margin-left:.25rem!important}.ms-xl-2{margin-left:.5rem!important}.ms-xl-3{margin-left:1rem!important}.ms-xl-4{margin-left:1.5rem!important}.ms-xl-5{margin-left:3rem!important}.ms-xl-auto{margin-left:auto!important}.p-xl-0{padding:0!important}.p-xl-1{padding:.25rem!important}.p-xl-2{padding:.5rem!important}.p-xl-3{padding:1rem!important}.p-xl-4{padding:1.5rem!important}.p-xl-5{padding:3rem!important}.px-xl-0{padding-right:0!important;padding-left:0!important}.px-xl-1{padding-right:.25rem!important;padding-left:.25rem!important}.px-xl-2{padding-right:.5rem!important;padding-left:.5rem!important}.px-xl-3{padding-right:1rem!important;padding-left:1rem!important}.px-xl-4{padding-right:1.5rem!important;padding-left:1.5rem!important}.px-xl-5{padding-right:3rem!important;padding-left:3rem!important}.py-xl-0{padding-top:0!important;padding-bottom:0!important}.py-xl-1{padding-top:.25rem!important;padding-bottom:.25rem!important}.py-xl-2{padding-top:.5rem!important;padding-bottom:.5rem!important}.py-xl-3{padding-top:1rem!important;padding-bottom:1rem!important}.py-xl-4{padding-top:1.5rem!important;padding-bottom:1.5rem!important}.py-xl-5{padding-top:3rem!important;padding-bottom:3rem!important}.pt-xl-0{padding-top:0!important}.pt-xl-1{padding-top:.25rem!important}.pt-xl-2{padding-top:.5rem!important}.pt-xl-3{padding-top:1rem!important}.pt-xl-4{padding-top:1.5rem!important}.pt-xl-5{padding-top:3rem!important}.pe-xl-0{padding-right:0!important}.pe-xl-1{padding-right:.25rem!important}.pe-xl-2{padding-right:.5rem!important}.pe-xl-3{padding-right:1rem!important}.pe-xl-4{padding-right:1.5rem!important}.pe-xl-5{padding-right:3rem!important}.pb-xl-0{padding-bottom:0!important}.pb-xl-1{padding-bottom:.25rem!important}.pb-xl-2{padding-bottom:.5rem!important}.pb-xl-3{padding-bottom:1rem!important}.pb-xl-4{padding-bottom:1.5rem!important}.pb-xl-5{padding-bottom:3rem!important}.ps-xl-0{padding-left:0!important}.ps-xl-1{padding-left:.25rem!important}.ps-xl-2{padding-left:.5rem!important}.ps-xl-3{padding-left:1rem!important}.ps-xl-4{padding-left:1.5rem!important}.ps-xl-5{padding-left:3rem!important}.gap-xl-0{gap:0!important}.gap-xl-1{gap:.25rem!important}.gap-xl-2{gap:.5rem!important}.gap-xl-3{gap:1rem!important}.gap-xl-4{gap:1.5rem!important}.gap-xl-5{gap:3rem!important}.row-gap-xl-0{row-gap:0!important}.row-gap-xl-1{row-gap:.25rem!important}.row-gap-xl-2{row-gap:.5rem!important}.row-gap-xl-3{row-gap:1rem!important}.row-gap-xl-4{row-gap:1.5rem!important}.row-gap-xl-5{row-gap:3rem!important}.column-gap-xl-0{-moz-column-gap:0!important;column-gap:0!important}.column-gap-xl-1{-moz-column-gap:0.25rem!important;column-gap:.25rem!important}.column-gap-xl-2{-moz-column-gap:0.5rem!important;column-gap:.5rem!important}.column-gap-xl-3{-moz-column-gap:1rem!important;column-gap:1rem!important}.column-gap-xl-4{-moz-column-gap:1.5rem!important;column-gap:1.5rem!important}.column-gap-xl-5{-moz-column-gap:3rem!important;column-gap:3rem!important}.text-xl-start{text-align:left!important}.text-xl-end{text-align:right!important}.text-xl-center{text-align:center!important}}@media (min-width:1400px){.float-xxl-start{float:left!important}.float-xxl-end{float:right!important}.float-xxl-none{float:none!important}.object-fit-xxl-contain{-o-object-fit:contain!important;object-fit:contain!important}.object-fit-xxl-cover{-o-object-fit:cover!important;object-fit:cover!important}.object-fit-xxl-fill{-o-object-fit:fill!important;object-fit:fill!important}.object-fit-xxl-scale{-o-object-fit:scale-down!important;object-fit:scale-down!important}.object-fit-xxl-none{-o-object-fit:none!important;object-fit:none!important}.d-xxl-inline{display:inline!important}.d-xxl-inline-block{display:inline-block!important}.d-xxl-block{display:block!important}.d-xxl-grid{display:grid!important}.d-xxl-inline-grid{display:inline-grid!important}.d-xxl-table{display:table!important}.d-xxl-table-row{display:table-row!important}.d-xxl-table-cell{display:table-cell!important}.d-xxl-flex{display:flex!important}.d-xxl-inline-flex{display:inline-flex!important}.d-xxl-none{display:none!important}.flex-xxl-fill{flex:1 1 auto!important}.flex-xxl-row{flex-direction:row!important}.flex-xxl-column{flex-direction:column!important}.flex-xxl-row-reverse{flex-direction:row-reverse!important}.flex-xxl-column-reverse{flex-direction:column-reverse!important}.flex-xxl-grow-0{flex-grow:0!important}.flex-xxl-grow-1{flex-grow:1!important}.flex-xxl-shrink-0{flex-shrink:0!important}.flex-xxl-shrink-1{flex-shrink:1!important}.flex-xxl-wrap{flex-wrap:wrap!important}.flex-xxl-nowrap{flex-wrap:nowrap!important}.flex-xxl-wrap-reverse{flex-wrap:wrap-reverse!important}.justify-content-xxl-start{justify-content:flex-start!important}.justify-content-xxl-end{justify-content:flex-end!important}.justify-content-xxl-center{justify-content:center!important}.justify-content-xxl-between{justify-content:space-between!important}.justify-content-xxl-around{justify-content:space-around!important}.justify-content-xxl-evenly{justify-content:space-evenly!important}.align-items-xxl-start{align-items:flex-start!important}.align-items-xxl-end{align-items:flex-end!important}.align-items-xxl-center{align-items:center!important}.align-items-xxl-baseline{align-items:baseline!important}.align-items-xxl-stretch{align-items:stretch!important}.align-content-xxl-start{align-content:flex-start!important}.align-content-xxl-end{align-content:flex-end!important}.align-content-xxl-center{align-content:center!important}.align-content-xxl-between{align-content:space-between!important}.align-content-xxl-around{align-content:space-around!important}.align-content-xxl-stretch{align-content:stretch!important}.align-self-xxl-auto{align-self:auto!important}.align-self-xxl-start{align-self:flex-start!important}.align-self-xxl-end{align-self:flex-end!important}.align-self-xxl-center{align-self:center!important}.align-self-xxl-baseline{align-self:baseline!important}.align-self-xxl-stretch{align-self:stretch!important}.order-xxl-first{order:-1!important}.order-xxl-0{order:0!important}.order-xxl-1{order:1!important}.order-xxl-2{order:2!important}.order-xxl-3{order:3!important}.order-xxl-4{order:4!important}.order-xxl-5{order:5!important}.order-xxl-last{order:6!important}.m-xxl-0{margin:0!important}.m-xxl-1{margin:.25rem!important}.m-xxl-2{margin:.5rem!important}.m-xxl-3{margin:1rem!important}.m-xxl-4{margin:1.5rem!important}.m-xxl-5{margin:3rem!important}.m-xxl-auto{margin:auto!important}.mx-xxl-0{margin-right:0!important;margin-left:0!important}.mx-xxl-1{margin-right:.25rem!important;margin-left:.25rem!important}.mx-xxl-2{margin-right:.5rem!important;margin-left:.5rem!important}.mx-xxl-3{margin-right:1rem!important;margin-left:1rem!important}.mx-xxl-4{margin-right:1.5rem!important;margin-left:1.5rem!important}.mx-xxl-5{margin-right:3rem!important;margin-left:3rem!important}.mx-xxl-auto{margin-right:auto!important;margin-left:auto!important}.my-xxl-0{margin-top:0!important;margin-bottom:0!important}.my-xxl-1{margin-top:.25rem!important;margin-bottom:.25rem!important}.my-xxl-2{margin-top:.5rem!important;margin-bottom:.5rem!important}.my-xxl-3{margin-top:1rem!important;margin-bottom:1rem!important}.my-xxl-4{margin-top:1.5rem!important;margin-bottom:1.5rem!important}.my-xxl-5{margin-top:3rem!important;margin-bottom:3rem!important}.my-xxl-auto{margin-top:auto!important;margin-bottom:auto!important}.mt-xxl-0{margin-top:0!important}.mt-xxl-1{margin-top:.25rem!important}.mt-xxl-2{margin-top:.5rem!important}.mt-xxl-3{margin-top:1rem!important}.mt-xxl-4{margin-top:1.5rem!important}.mt-xxl-5{margin-top:3rem!important}.mt-xxl-auto{margin-top:auto!important}.me-xxl-0{margin-right:0!important}.me-xxl-1{margin-right:.25rem!important}.me-xxl-2{margin-right:.5rem!important}.me-xxl-3{margin-right:1rem!important}.me-xxl-4{margin-right:1.5rem!important}.me-xxl-5{margin-right:3rem!important}.me-xxl-auto{margin-right:auto!important}.mb-xxl-0{margin-bottom:0!important}.mb-xxl-1{margin-bottom:.25rem!important}.mb-xxl-2{margin-bottom:.5rem!important}.mb-xxl-3{margin-bottom:1rem!important}.mb-xxl-4{margin-bottom:1.5rem!important}.mb-xxl-5{margin-bottom:3rem!important}.mb-xxl-auto{margin-bottom:auto!important}.ms-xxl-0{margin-left:0!important}.ms-xxl-1{margin-left:.25rem!important}.ms-xxl-2{margin-left:.5rem!important}.ms-xxl-3{margin-left:1rem!important}.ms-xxl-4{margin-left:1.5rem!important}.ms-xxl-5{margin-left:3rem!important}.ms-xxl-auto{margin-left:auto!important}.p-xxl-0{padding:0!important}.p-xxl-1{padding:.25rem!important}.p-xxl-2{padding:.5rem!important}.p-xxl-3{padding:1rem!important}.p-xxl-4{padding:1.5rem!important}.p-xxl-5{padding:3rem!important}.px-xxl-0{padding-right:0!important;padding-left:0!important}.px-xxl-1{padding-right:.25rem!important;padding-left:.25rem!important}.px-xxl-2{padding-right:.5rem!important;padding-left:.5rem!important}.px-xxl-3{padding-right:1rem!important;padding-left:1rem!important}.px-xxl-4{padding-right:1.5rem!important;padding-left:1.5rem!important}.px-xxl-5{padding-right:3rem!important;padding-left:3rem!important}.py-xxl-0{padding-top:0!important;padding-bottom:0!important}.py-xxl-1{padding-top:.25rem!important;padding-bottom:.25rem!important}.py-xxl-2{padding-top:.5rem!important;padding-bottom:.5rem!important}.py-xxl-3{padding-top:1rem!important;padding-bottom:1rem!important}.py-xxl-4{padding-top:1.5rem!important;padding-bottom:1.5rem!important}.py-xxl-5{padding-top:3rem!important;padding-bottom:3rem!important}.pt-xxl-0{padding-top:0!important}.pt-xxl-1{padding-top:.25rem!important}.pt-xxl-2{padding-top:.5rem!important}.pt-xxl-3{padding-top:1rem!important}.pt-xxl-4{padding-top:1.5rem!important}.pt-xxl-5{padding-top:3rem!important}.pe-xxl-0{padding-right:0!important}.pe-xxl-1{padding-right:.25rem!important}.pe-xxl-2{padding-right:.5rem!important}.pe-xxl-3{padding-right:1rem!important}.pe-xxl-4{padding-right:1.5rem!important}.pe-xxl-5{padding-right:3rem!important}.pb-xxl-0{padding-bottom:0!important}.pb-xxl-1{padding-bottom:.25rem!important}.pb-xxl-2{padding-bottom:.5rem!important}.pb-xxl-3{padding-bottom:1rem!important}.pb-xxl-4{padding-bottom:1.5rem!important}.pb-xxl-5{padding-bottom:3rem!important}.ps-xxl-0{padding-left:0!important}.ps-xxl-1{padding-left:.25rem!important}.ps-xxl-2{padding-left:.5rem!important}.ps-xxl-3{padding-left:1rem!important}.ps-xxl-4{padding-left:1.5rem!important}.ps-xxl-5{padding-left:3rem!important}.gap-xxl-0{gap:0!important}.gap-xxl-1{gap:.25rem!important}.gap-xxl-2{gap:.5rem!important}.gap-xxl-3{gap:1rem!important}.gap-xxl-4{gap:1.5rem!important}.gap-xxl-5{gap:3rem!important}.row-gap-xxl-0{row-gap:0!important}.row-gap-xxl-1{row-gap:.25rem!important}.row-gap-xxl-2{row-gap:.5rem!important}.row-gap-xxl-3{row-gap:1rem!important}.row-gap-xxl-4{row-gap:1.5rem!important}.row-gap-xxl-5{row-gap:3rem!important}.column-gap-xxl-0{-moz-column-gap:0!important;column-gap:0!important}.column-gap-xxl-1{-moz-column-gap:0.25rem!important;column-gap:.25rem!important}.column-gap-xxl-2{-moz-column-gap:0.5rem!important;column-gap:.5rem!important}.column-gap-xxl-3{-moz-column-gap:1rem!important;column-gap:1rem!important}.column-gap-xxl-4{-moz-column-gap:1.5rem!important;column-gap:1.5rem!important}.column-gap-xxl-5{-moz-column-gap:3rem!important;column-gap:3rem!important}.text-xxl-start{text-align:left!important}.text-xxl-end{text-align:right!important}.text-xxl-center{text-align:center!important}}@media (min-width:1200px){.fs-1{font-size:2.5rem!important}.fs-2{font-size:2rem!important}.fs-3{font-size:1.75rem!important}.fs-4{font-size:1.5rem!important}}@media print{.d-print-inline{display:inline!important}.d-print-inline-block{display:inline-block!important}.d-print-block{display:block!important}.d-print-grid{display:grid!important}.d-print-inline-grid{display:inline-grid!important}.d-print-table{display:table!important}.d-print-table-row{display:table-row!important}.d-print-table-cell{display:table-cell!important}.d-print-flex{display:flex!important}.d-print-inline-flex{display:inline-flex!important}.d-print-none{display:none!important}}`,""]);const K=O},709:(t,e,r)=>{"use strict";r.r(e),r.d(e,{default:()=>s});var o=r(601),n=r.n(o),i=r(314),a=r.n(i)()(n());a.push([t.id,"\n#app[data-v-47c9ecaa] {\n}\n",""]);const s=a},523:(t,e,r)=>{"use strict";r.r(e),r.d(e,{default:()=>s});var o=r(601),n=r.n(o),i=r(314),a=r.n(i)()(n());a.push([t.id,"\n/* Optional: Styling for buttons if necessary */\n",""]);const s=a},591:(t,e,r)=>{"use strict";r.r(e),r.d(e,{default:()=>s});var o=r(601),n=r.n(o),i=r(314),a=r.n(i)()(n());a.push([t.id,"\n/* Optional: You can style the component here */\n",""]);const s=a},684:(t,e,r)=>{"use strict";r.r(e),r.d(e,{default:()=>s});var o=r(601),n=r.n(o),i=r(314),a=r.n(i)()(n());a.push([t.id,"body.mounted footer {\n    display: block !important;\n}\n\n.accordion-button:focus {\n    box-shadow: none;\n    border-color: rgba(0,0,0,.125);\n}",""]);const s=a},314:t=>{"use strict";t.exports=function(t){var e=[];return e.toString=function(){return this.map((function(e){var r="",o=void 0!==e[5];return e[4]&&(r+="@supports (".concat(e[4],") {")),e[2]&&(r+="@media ".concat(e[2]," {")),o&&(r+="@layer".concat(e[5].length>0?" ".concat(e[5]):""," {")),r+=t(e),o&&(r+="}"),e[2]&&(r+="}"),e[4]&&(r+="}"),r})).join("")},e.i=function(t,r,o,n,i){"string"==typeof t&&(t=[[null,t,void 0]]);var a={};if(o)for(var s=0;s<this.length;s++){var l=this[s][0];null!=l&&(a[l]=!0)}for(var d=0;d<t.length;d++){var c=[].concat(t[d]);o&&a[c[0]]||(void 0!==i&&(void 0===c[5]||(c[1]="@layer".concat(c[5].length>0?" ".concat(c[5]):""," {").concat(c[1],"}")),c[5]=i),r&&(c[2]?(c[1]="@media ".concat(c[2]," {").concat(c[1],"}"),c[2]=r):c[2]=r),n&&(c[4]?(c[1]="@supports (".concat(c[4],") {").concat(c[1],"}"),c[4]=n):c[4]="".concat(n)),e.push(c))}},e}},417:t=>{"use strict";t.exports=function(t,e){return e||(e={}),t?(t=String(t.__esModule?t.default:t),/^['"].*['"]$/.test(t)&&(t=t.slice(1,-1)),e.hash&&(t+=e.hash),/["'() \t\n]|(%20)/.test(t)||e.needQuotes?'"'.concat(t.replace(/"/g,'\\"').replace(/\n/g,"\\n"),'"'):t):t}},601:t=>{"use strict";t.exports=function(t){return t[1]}},262:(t,e)=>{"use strict";e.A=(t,e)=>{const r=t.__vccOpts||t;for(const[t,o]of e)r[t]=o;return r}},902:(t,e,r)=>{var o=r(261);o.__esModule&&(o=o.default),"string"==typeof o&&(o=[[t.id,o,""]]),o.locals&&(t.exports=o.locals),(0,r(534).A)("46d99e2a",o,!1,{})},230:(t,e,r)=>{var o=r(709);o.__esModule&&(o=o.default),"string"==typeof o&&(o=[[t.id,o,""]]),o.locals&&(t.exports=o.locals),(0,r(534).A)("4df78cb5",o,!1,{})},648:(t,e,r)=>{var o=r(523);o.__esModule&&(o=o.default),"string"==typeof o&&(o=[[t.id,o,""]]),o.locals&&(t.exports=o.locals),(0,r(534).A)("7d0dfdca",o,!1,{})},254:(t,e,r)=>{var o=r(591);o.__esModule&&(o=o.default),"string"==typeof o&&(o=[[t.id,o,""]]),o.locals&&(t.exports=o.locals),(0,r(534).A)("13755fde",o,!1,{})},277:(t,e,r)=>{var o=r(684);o.__esModule&&(o=o.default),"string"==typeof o&&(o=[[t.id,o,""]]),o.locals&&(t.exports=o.locals),(0,r(534).A)("3a812de8",o,!1,{})},534:(t,e,r)=>{"use strict";function o(t,e){for(var r=[],o={},n=0;n<e.length;n++){var i=e[n],a=i[0],s={id:t+":"+n,css:i[1],media:i[2],sourceMap:i[3]};o[a]?o[a].parts.push(s):r.push(o[a]={id:a,parts:[s]})}return r}r.d(e,{A:()=>g});var n="undefined"!=typeof document;if("undefined"!=typeof DEBUG&&DEBUG&&!n)throw new Error("vue-style-loader cannot be used in a non-browser environment. Use { target: 'node' } in your Webpack config to indicate a server-rendering environment.");var i={},a=n&&(document.head||document.getElementsByTagName("head")[0]),s=null,l=0,d=!1,c=function(){},p=null,b="data-vue-ssr-id",m="undefined"!=typeof navigator&&/msie [6-9]\b/.test(navigator.userAgent.toLowerCase());function g(t,e,r,n){d=r,p=n||{};var a=o(t,e);return f(a),function(e){for(var r=[],n=0;n<a.length;n++){var s=a[n];(l=i[s.id]).refs--,r.push(l)}for(e?f(a=o(t,e)):a=[],n=0;n<r.length;n++){var l;if(0===(l=r[n]).refs){for(var d=0;d<l.parts.length;d++)l.parts[d]();delete i[l.id]}}}}function f(t){for(var e=0;e<t.length;e++){var r=t[e],o=i[r.id];if(o){o.refs++;for(var n=0;n<o.parts.length;n++)o.parts[n](r.parts[n]);for(;n<r.parts.length;n++)o.parts.push(h(r.parts[n]));o.parts.length>r.parts.length&&(o.parts.length=r.parts.length)}else{var a=[];for(n=0;n<r.parts.length;n++)a.push(h(r.parts[n]));i[r.id]={id:r.id,refs:1,parts:a}}}}function u(){var t=document.createElement("style");return t.type="text/css",a.appendChild(t),t}function h(t){var e,r,o=document.querySelector("style["+b+'~="'+t.id+'"]');if(o){if(d)return c;o.parentNode.removeChild(o)}if(m){var n=l++;o=s||(s=u()),e=w.bind(null,o,n,!1),r=w.bind(null,o,n,!0)}else o=u(),e=y.bind(null,o),r=function(){o.parentNode.removeChild(o)};return e(t),function(o){if(o){if(o.css===t.css&&o.media===t.media&&o.sourceMap===t.sourceMap)return;e(t=o)}else r()}}var v,x=(v=[],function(t,e){return v[t]=e,v.filter(Boolean).join("\n")});function w(t,e,r,o){var n=r?"":o.css;if(t.styleSheet)t.styleSheet.cssText=x(e,n);else{var i=document.createTextNode(n),a=t.childNodes;a[e]&&t.removeChild(a[e]),a.length?t.insertBefore(i,a[e]):t.appendChild(i)}}function y(t,e){var r=e.css,o=e.media,n=e.sourceMap;if(o&&t.setAttribute("media",o),p.ssrId&&t.setAttribute(b,e.id),n&&(r+="\n/*# sourceURL="+n.sources[0]+" */",r+="\n/*# sourceMappingURL=data:application/json;base64,"+btoa(unescape(encodeURIComponent(JSON.stringify(n))))+" */"),t.styleSheet)t.styleSheet.cssText=r;else{for(;t.firstChild;)t.removeChild(t.firstChild);t.appendChild(document.createTextNode(r))}}},385:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%27-4 -4 8 8%27%3e%3ccircle r=%272%27 fill=%27%23fff%27/%3e%3c/svg%3e"},782:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%27-4 -4 8 8%27%3e%3ccircle r=%273%27 fill=%27%2386b7fe%27/%3e%3c/svg%3e"},718:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%27-4 -4 8 8%27%3e%3ccircle r=%273%27 fill=%27%23fff%27/%3e%3c/svg%3e"},154:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%27-4 -4 8 8%27%3e%3ccircle r=%273%27 fill=%27rgba%280, 0, 0, 0.25%29%27/%3e%3c/svg%3e"},734:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%27-4 -4 8 8%27%3e%3ccircle r=%273%27 fill=%27rgba%28255, 255, 255, 0.25%29%27/%3e%3c/svg%3e"},372:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 12 12%27 width=%2712%27 height=%2712%27 fill=%27none%27 stroke=%27%23dc3545%27%3e%3ccircle cx=%276%27 cy=%276%27 r=%274.5%27/%3e%3cpath stroke-linejoin=%27round%27 d=%27M5.8 3.6h.4L6 6.5z%27/%3e%3ccircle cx=%276%27 cy=%278.2%27 r=%27.6%27 fill=%27%23dc3545%27 stroke=%27none%27/%3e%3c/svg%3e"},249:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 16 16%27 fill=%27%23000%27%3e%3cpath d=%27M.293.293a1 1 0 0 1 1.414 0L8 6.586 14.293.293a1 1 0 1 1 1.414 1.414L9.414 8l6.293 6.293a1 1 0 0 1-1.414 1.414L8 9.414l-6.293 6.293a1 1 0 0 1-1.414-1.414L6.586 8 .293 1.707a1 1 0 0 1 0-1.414z%27/%3e%3c/svg%3e"},690:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 16 16%27 fill=%27%236ea8fe%27%3e%3cpath fill-rule=%27evenodd%27 d=%27M1.646 4.646a.5.5 0 0 1 .708 0L8 10.293l5.646-5.647a.5.5 0 0 1 .708.708l-6 6a.5.5 0 0 1-.708 0l-6-6a.5.5 0 0 1 0-.708z%27/%3e%3c/svg%3e"},932:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 16 16%27 fill=%27%23fff%27%3e%3cpath d=%27M11.354 1.646a.5.5 0 0 1 0 .708L5.707 8l5.647 5.646a.5.5 0 0 1-.708.708l-6-6a.5.5 0 0 1 0-.708l6-6a.5.5 0 0 1 .708 0z%27/%3e%3c/svg%3e"},144:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 16 16%27 fill=%27%23fff%27%3e%3cpath d=%27M4.646 1.646a.5.5 0 0 1 .708 0l6 6a.5.5 0 0 1 0 .708l-6 6a.5.5 0 0 1-.708-.708L10.293 8 4.646 2.354a.5.5 0 0 1 0-.708z%27/%3e%3c/svg%3e"},210:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 16 16%27 fill=%27none%27 stroke=%27%23052c65%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3e%3cpath d=%27M2 5L8 11L14 5%27/%3e%3c/svg%3e"},326:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 16 16%27 fill=%27none%27 stroke=%27%23212529%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3e%3cpath d=%27M2 5L8 11L14 5%27/%3e%3c/svg%3e"},531:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 16 16%27%3e%3cpath fill=%27none%27 stroke=%27%23343a40%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27 stroke-width=%272%27 d=%27m2 5 6 6 6-6%27/%3e%3c/svg%3e"},115:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 16 16%27%3e%3cpath fill=%27none%27 stroke=%27%23dee2e6%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27 stroke-width=%272%27 d=%27m2 5 6 6 6-6%27/%3e%3c/svg%3e"},274:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 20 20%27%3e%3cpath fill=%27none%27 stroke=%27%23fff%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27 stroke-width=%273%27 d=%27M6 10h8%27/%3e%3c/svg%3e"},419:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 20 20%27%3e%3cpath fill=%27none%27 stroke=%27%23fff%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27 stroke-width=%273%27 d=%27m6 10 3 3 6-6%27/%3e%3c/svg%3e"},366:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 30 30%27%3e%3cpath stroke=%27rgba%28255, 255, 255, 0.55%29%27 stroke-linecap=%27round%27 stroke-miterlimit=%2710%27 stroke-width=%272%27 d=%27M4 7h22M4 15h22M4 23h22%27/%3e%3c/svg%3e"},247:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 30 30%27%3e%3cpath stroke=%27rgba%2833, 37, 41, 0.75%29%27 stroke-linecap=%27round%27 stroke-miterlimit=%2710%27 stroke-width=%272%27 d=%27M4 7h22M4 15h22M4 23h22%27/%3e%3c/svg%3e"},487:t=>{"use strict";t.exports="data:image/svg+xml,%3csvg xmlns=%27http://www.w3.org/2000/svg%27 viewBox=%270 0 8 8%27%3e%3cpath fill=%27%23198754%27 d=%27M2.3 6.73.6 4.53c-.4-1.04.46-1.4 1.1-.8l1.1 1.4 3.4-3.8c.6-.63 1.6-.27 1.2.7l-4 4.6c-.43.5-.8.4-1.1.1z%27/%3e%3c/svg%3e"}},e={};function r(o){var n=e[o];if(void 0!==n)return n.exports;var i=e[o]={id:o,exports:{}};return t[o](i,i.exports,r),i.exports}r.m=t,r.n=t=>{var e=t&&t.__esModule?()=>t.default:()=>t;return r.d(e,{a:e}),e},r.d=(t,e)=>{for(var o in e)r.o(e,o)&&!r.o(t,o)&&Object.defineProperty(t,o,{enumerable:!0,get:e[o]})},r.g=function(){if("object"==typeof globalThis)return globalThis;try{return this||new Function("return this")()}catch(t){if("object"==typeof window)return window}}(),r.o=(t,e)=>Object.prototype.hasOwnProperty.call(t,e),r.r=t=>{"undefined"!=typeof Symbol&&Symbol.toStringTag&&Object.defineProperty(t,Symbol.toStringTag,{value:"Module"}),Object.defineProperty(t,"__esModule",{value:!0})},r.b=document.baseURI||self.location.href,(()=>{"use strict";var t={};r.r(t),r.d(t,{hasBrowserEnv:()=>_a,hasStandardBrowserEnv:()=>Ea,hasStandardBrowserWebWorkerEnv:()=>Aa,navigator:()=>ka,origin:()=>Sa});var e={};function o(t){const e=Object.create(null);for(const r of t.split(","))e[r]=1;return t=>t in e}r.r(e),r.d(e,{afterMain:()=>Cd,afterRead:()=>Sd,afterWrite:()=>Ld,applyStyles:()=>Bd,arrow:()=>ic,auto:()=>gd,basePlacements:()=>fd,beforeMain:()=>Td,beforeRead:()=>Ed,beforeWrite:()=>jd,bottom:()=>pd,clippingParents:()=>vd,computeStyles:()=>dc,createPopper:()=>Ic,createPopperBase:()=>Nc,createPopperLite:()=>Bc,detectOverflow:()=>Ec,end:()=>hd,eventListeners:()=>pc,flip:()=>Ac,hide:()=>Oc,left:()=>md,main:()=>Od,modifierPhases:()=>Rd,offset:()=>Cc,placements:()=>kd,popper:()=>wd,popperGenerator:()=>Mc,popperOffsets:()=>jc,preventOverflow:()=>zc,read:()=>Ad,reference:()=>yd,right:()=>bd,start:()=>ud,top:()=>cd,variationPlacements:()=>_d,viewport:()=>xd,write:()=>zd});const n={},i=[],a=()=>{},s=()=>!1,l=t=>111===t.charCodeAt(0)&&110===t.charCodeAt(1)&&(t.charCodeAt(2)>122||t.charCodeAt(2)<97),d=t=>t.startsWith("onUpdate:"),c=Object.assign,p=(t,e)=>{const r=t.indexOf(e);r>-1&&t.splice(r,1)},b=Object.prototype.hasOwnProperty,m=(t,e)=>b.call(t,e),g=Array.isArray,f=t=>"[object Map]"===E(t),u=t=>"[object Set]"===E(t),h=t=>"[object Date]"===E(t),v=t=>"function"==typeof t,x=t=>"string"==typeof t,w=t=>"symbol"==typeof t,y=t=>null!==t&&"object"==typeof t,_=t=>(y(t)||v(t))&&v(t.then)&&v(t.catch),k=Object.prototype.toString,E=t=>k.call(t),A=t=>"[object Object]"===E(t),S=t=>x(t)&&"NaN"!==t&&"-"!==t[0]&&""+parseInt(t,10)===t,T=o(",key,ref,ref_for,ref_key,onVnodeBeforeMount,onVnodeMounted,onVnodeBeforeUpdate,onVnodeUpdated,onVnodeBeforeUnmount,onVnodeUnmounted"),O=t=>{const e=Object.create(null);return r=>e[r]||(e[r]=t(r))},C=/-(\w)/g,j=O((t=>t.replace(C,((t,e)=>e?e.toUpperCase():"")))),z=/\B([A-Z])/g,L=O((t=>t.replace(z,"-$1").toLowerCase())),R=O((t=>t.charAt(0).toUpperCase()+t.slice(1))),P=O((t=>t?`on${R(t)}`:"")),D=(t,e)=>!Object.is(t,e),M=(t,...e)=>{for(let r=0;r<t.length;r++)t[r](...e)},N=(t,e,r,o=!1)=>{Object.defineProperty(t,e,{configurable:!0,enumerable:!1,writable:o,value:r})},I=t=>{const e=parseFloat(t);return isNaN(e)?t:e};let B;const F=()=>B||(B="undefined"!=typeof globalThis?globalThis:"undefined"!=typeof self?self:"undefined"!=typeof window?window:void 0!==r.g?r.g:{});function $(t){if(g(t)){const e={};for(let r=0;r<t.length;r++){const o=t[r],n=x(o)?H(o):$(o);if(n)for(const t in n)e[t]=n[t]}return e}if(x(t)||y(t))return t}const U=/;(?![^(]*\))/g,V=/:([^]+)/,W=/\/\*[^]*?\*\//g;function H(t){const e={};return t.replace(W,"").split(U).forEach((t=>{if(t){const r=t.split(V);r.length>1&&(e[r[0].trim()]=r[1].trim())}})),e}function q(t){let e="";if(x(t))e=t;else if(g(t))for(let r=0;r<t.length;r++){const o=q(t[r]);o&&(e+=o+" ")}else if(y(t))for(const r in t)t[r]&&(e+=r+" ");return e.trim()}const G=o("itemscope,allowfullscreen,formnovalidate,ismap,nomodule,novalidate,readonly");function K(t){return!!t||""===t}function X(t,e){if(t===e)return!0;let r=h(t),o=h(e);if(r||o)return!(!r||!o)&&t.getTime()===e.getTime();if(r=w(t),o=w(e),r||o)return t===e;if(r=g(t),o=g(e),r||o)return!(!r||!o)&&function(t,e){if(t.length!==e.length)return!1;let r=!0;for(let o=0;r&&o<t.length;o++)r=X(t[o],e[o]);return r}(t,e);if(r=y(t),o=y(e),r||o){if(!r||!o)return!1;if(Object.keys(t).length!==Object.keys(e).length)return!1;for(const r in t){const o=t.hasOwnProperty(r),n=e.hasOwnProperty(r);if(o&&!n||!o&&n||!X(t[r],e[r]))return!1}}return String(t)===String(e)}function Y(t,e){return t.findIndex((t=>X(t,e)))}const J=t=>!(!t||!0!==t.__v_isRef),Q=t=>x(t)?t:null==t?"":g(t)||y(t)&&(t.toString===k||!v(t.toString))?J(t)?Q(t.value):JSON.stringify(t,Z,2):String(t),Z=(t,e)=>J(e)?Z(t,e.value):f(e)?{[`Map(${e.size})`]:[...e.entries()].reduce(((t,[e,r],o)=>(t[tt(e,o)+" =>"]=r,t)),{})}:u(e)?{[`Set(${e.size})`]:[...e.values()].map((t=>tt(t)))}:w(e)?tt(e):!y(e)||g(e)||A(e)?e:String(e),tt=(t,e="")=>{var r;return w(t)?`Symbol(${null!=(r=t.description)?r:e})`:t};let et,rt;class ot{constructor(t=!1){this.detached=t,this._active=!0,this.effects=[],this.cleanups=[],this._isPaused=!1,this.parent=et,!t&&et&&(this.index=(et.scopes||(et.scopes=[])).push(this)-1)}get active(){return this._active}pause(){if(this._active){let t,e;if(this._isPaused=!0,this.scopes)for(t=0,e=this.scopes.length;t<e;t++)this.scopes[t].pause();for(t=0,e=this.effects.length;t<e;t++)this.effects[t].pause()}}resume(){if(this._active&&this._isPaused){let t,e;if(this._isPaused=!1,this.scopes)for(t=0,e=this.scopes.length;t<e;t++)this.scopes[t].resume();for(t=0,e=this.effects.length;t<e;t++)this.effects[t].resume()}}run(t){if(this._active){const e=et;try{return et=this,t()}finally{et=e}}}on(){et=this}off(){et=this.parent}stop(t){if(this._active){let e,r;for(e=0,r=this.effects.length;e<r;e++)this.effects[e].stop();for(e=0,r=this.cleanups.length;e<r;e++)this.cleanups[e]();if(this.scopes)for(e=0,r=this.scopes.length;e<r;e++)this.scopes[e].stop(!0);if(!this.detached&&this.parent&&!t){const t=this.parent.scopes.pop();t&&t!==this&&(this.parent.scopes[this.index]=t,t.index=this.index)}this.parent=void 0,this._active=!1}}}const nt=new WeakSet;class it{constructor(t){this.fn=t,this.deps=void 0,this.depsTail=void 0,this.flags=5,this.next=void 0,this.cleanup=void 0,this.scheduler=void 0,et&&et.active&&et.effects.push(this)}pause(){this.flags|=64}resume(){64&this.flags&&(this.flags&=-65,nt.has(this)&&(nt.delete(this),this.trigger()))}notify(){2&this.flags&&!(32&this.flags)||8&this.flags||dt(this)}run(){if(!(1&this.flags))return this.fn();this.flags|=2,_t(this),bt(this);const t=rt,e=vt;rt=this,vt=!0;try{return this.fn()}finally{mt(this),rt=t,vt=e,this.flags&=-3}}stop(){if(1&this.flags){for(let t=this.deps;t;t=t.nextDep)ut(t);this.deps=this.depsTail=void 0,_t(this),this.onStop&&this.onStop(),this.flags&=-2}}trigger(){64&this.flags?nt.add(this):this.scheduler?this.scheduler():this.runIfDirty()}runIfDirty(){gt(this)&&this.run()}get dirty(){return gt(this)}}let at,st,lt=0;function dt(t,e=!1){if(t.flags|=8,e)return t.next=st,void(st=t);t.next=at,at=t}function ct(){lt++}function pt(){if(--lt>0)return;if(st){let t=st;for(st=void 0;t;){const e=t.next;t.next=void 0,t.flags&=-9,t=e}}let t;for(;at;){let e=at;for(at=void 0;e;){const r=e.next;if(e.next=void 0,e.flags&=-9,1&e.flags)try{e.trigger()}catch(e){t||(t=e)}e=r}}if(t)throw t}function bt(t){for(let e=t.deps;e;e=e.nextDep)e.version=-1,e.prevActiveLink=e.dep.activeLink,e.dep.activeLink=e}function mt(t){let e,r=t.depsTail,o=r;for(;o;){const t=o.prevDep;-1===o.version?(o===r&&(r=t),ut(o),ht(o)):e=o,o.dep.activeLink=o.prevActiveLink,o.prevActiveLink=void 0,o=t}t.deps=e,t.depsTail=r}function gt(t){for(let e=t.deps;e;e=e.nextDep)if(e.dep.version!==e.version||e.dep.computed&&(ft(e.dep.computed)||e.dep.version!==e.version))return!0;return!!t._dirty}function ft(t){if(4&t.flags&&!(16&t.flags))return;if(t.flags&=-17,t.globalVersion===kt)return;t.globalVersion=kt;const e=t.dep;if(t.flags|=2,e.version>0&&!t.isSSR&&t.deps&&!gt(t))return void(t.flags&=-3);const r=rt,o=vt;rt=t,vt=!0;try{bt(t);const r=t.fn(t._value);(0===e.version||D(r,t._value))&&(t._value=r,e.version++)}catch(t){throw e.version++,t}finally{rt=r,vt=o,mt(t),t.flags&=-3}}function ut(t,e=!1){const{dep:r,prevSub:o,nextSub:n}=t;if(o&&(o.nextSub=n,t.prevSub=void 0),n&&(n.prevSub=o,t.nextSub=void 0),r.subs===t&&(r.subs=o,!o&&r.computed)){r.computed.flags&=-5;for(let t=r.computed.deps;t;t=t.nextDep)ut(t,!0)}e||--r.sc||!r.map||r.map.delete(r.key)}function ht(t){const{prevDep:e,nextDep:r}=t;e&&(e.nextDep=r,t.prevDep=void 0),r&&(r.prevDep=e,t.nextDep=void 0)}let vt=!0;const xt=[];function wt(){xt.push(vt),vt=!1}function yt(){const t=xt.pop();vt=void 0===t||t}function _t(t){const{cleanup:e}=t;if(t.cleanup=void 0,e){const t=rt;rt=void 0;try{e()}finally{rt=t}}}let kt=0;class Et{constructor(t,e){this.sub=t,this.dep=e,this.version=e.version,this.nextDep=this.prevDep=this.nextSub=this.prevSub=this.prevActiveLink=void 0}}class At{constructor(t){this.computed=t,this.version=0,this.activeLink=void 0,this.subs=void 0,this.map=void 0,this.key=void 0,this.sc=0}track(t){if(!rt||!vt||rt===this.computed)return;let e=this.activeLink;if(void 0===e||e.sub!==rt)e=this.activeLink=new Et(rt,this),rt.deps?(e.prevDep=rt.depsTail,rt.depsTail.nextDep=e,rt.depsTail=e):rt.deps=rt.depsTail=e,St(e);else if(-1===e.version&&(e.version=this.version,e.nextDep)){const t=e.nextDep;t.prevDep=e.prevDep,e.prevDep&&(e.prevDep.nextDep=t),e.prevDep=rt.depsTail,e.nextDep=void 0,rt.depsTail.nextDep=e,rt.depsTail=e,rt.deps===e&&(rt.deps=t)}return e}trigger(t){this.version++,kt++,this.notify(t)}notify(t){ct();try{for(let t=this.subs;t;t=t.prevSub)t.sub.notify()&&t.sub.dep.notify()}finally{pt()}}}function St(t){if(t.dep.sc++,4&t.sub.flags){const e=t.dep.computed;if(e&&!t.dep.subs){e.flags|=20;for(let t=e.deps;t;t=t.nextDep)St(t)}const r=t.dep.subs;r!==t&&(t.prevSub=r,r&&(r.nextSub=t)),t.dep.subs=t}}const Tt=new WeakMap,Ot=Symbol(""),Ct=Symbol(""),jt=Symbol("");function zt(t,e,r){if(vt&&rt){let e=Tt.get(t);e||Tt.set(t,e=new Map);let o=e.get(r);o||(e.set(r,o=new At),o.map=e,o.key=r),o.track()}}function Lt(t,e,r,o,n,i){const a=Tt.get(t);if(!a)return void kt++;const s=t=>{t&&t.trigger()};if(ct(),"clear"===e)a.forEach(s);else{const n=g(t),i=n&&S(r);if(n&&"length"===r){const t=Number(o);a.forEach(((e,r)=>{("length"===r||r===jt||!w(r)&&r>=t)&&s(e)}))}else switch((void 0!==r||a.has(void 0))&&s(a.get(r)),i&&s(a.get(jt)),e){case"add":n?i&&s(a.get("length")):(s(a.get(Ot)),f(t)&&s(a.get(Ct)));break;case"delete":n||(s(a.get(Ot)),f(t)&&s(a.get(Ct)));break;case"set":f(t)&&s(a.get(Ot))}}pt()}function Rt(t){const e=fe(t);return e===t?e:(zt(e,0,jt),me(t)?e:e.map(ue))}function Pt(t){return zt(t=fe(t),0,jt),t}const Dt={__proto__:null,[Symbol.iterator](){return Mt(this,Symbol.iterator,ue)},concat(...t){return Rt(this).concat(...t.map((t=>g(t)?Rt(t):t)))},entries(){return Mt(this,"entries",(t=>(t[1]=ue(t[1]),t)))},every(t,e){return It(this,"every",t,e,void 0,arguments)},filter(t,e){return It(this,"filter",t,e,(t=>t.map(ue)),arguments)},find(t,e){return It(this,"find",t,e,ue,arguments)},findIndex(t,e){return It(this,"findIndex",t,e,void 0,arguments)},findLast(t,e){return It(this,"findLast",t,e,ue,arguments)},findLastIndex(t,e){return It(this,"findLastIndex",t,e,void 0,arguments)},forEach(t,e){return It(this,"forEach",t,e,void 0,arguments)},includes(...t){return Ft(this,"includes",t)},indexOf(...t){return Ft(this,"indexOf",t)},join(t){return Rt(this).join(t)},lastIndexOf(...t){return Ft(this,"lastIndexOf",t)},map(t,e){return It(this,"map",t,e,void 0,arguments)},pop(){return $t(this,"pop")},push(...t){return $t(this,"push",t)},reduce(t,...e){return Bt(this,"reduce",t,e)},reduceRight(t,...e){return Bt(this,"reduceRight",t,e)},shift(){return $t(this,"shift")},some(t,e){return It(this,"some",t,e,void 0,arguments)},splice(...t){return $t(this,"splice",t)},toReversed(){return Rt(this).toReversed()},toSorted(t){return Rt(this).toSorted(t)},toSpliced(...t){return Rt(this).toSpliced(...t)},unshift(...t){return $t(this,"unshift",t)},values(){return Mt(this,"values",ue)}};function Mt(t,e,r){const o=Pt(t),n=o[e]();return o===t||me(t)||(n._next=n.next,n.next=()=>{const t=n._next();return t.value&&(t.value=r(t.value)),t}),n}const Nt=Array.prototype;function It(t,e,r,o,n,i){const a=Pt(t),s=a!==t&&!me(t),l=a[e];if(l!==Nt[e]){const e=l.apply(t,i);return s?ue(e):e}let d=r;a!==t&&(s?d=function(e,o){return r.call(this,ue(e),o,t)}:r.length>2&&(d=function(e,o){return r.call(this,e,o,t)}));const c=l.call(a,d,o);return s&&n?n(c):c}function Bt(t,e,r,o){const n=Pt(t);let i=r;return n!==t&&(me(t)?r.length>3&&(i=function(e,o,n){return r.call(this,e,o,n,t)}):i=function(e,o,n){return r.call(this,e,ue(o),n,t)}),n[e](i,...o)}function Ft(t,e,r){const o=fe(t);zt(o,0,jt);const n=o[e](...r);return-1!==n&&!1!==n||!ge(r[0])?n:(r[0]=fe(r[0]),o[e](...r))}function $t(t,e,r=[]){wt(),ct();const o=fe(t)[e].apply(t,r);return pt(),yt(),o}const Ut=o("__proto__,__v_isRef,__isVue"),Vt=new Set(Object.getOwnPropertyNames(Symbol).filter((t=>"arguments"!==t&&"caller"!==t)).map((t=>Symbol[t])).filter(w));function Wt(t){w(t)||(t=String(t));const e=fe(this);return zt(e,0,t),e.hasOwnProperty(t)}class Ht{constructor(t=!1,e=!1){this._isReadonly=t,this._isShallow=e}get(t,e,r){const o=this._isReadonly,n=this._isShallow;if("__v_isReactive"===e)return!o;if("__v_isReadonly"===e)return o;if("__v_isShallow"===e)return n;if("__v_raw"===e)return r===(o?n?se:ae:n?ie:ne).get(t)||Object.getPrototypeOf(t)===Object.getPrototypeOf(r)?t:void 0;const i=g(t);if(!o){let t;if(i&&(t=Dt[e]))return t;if("hasOwnProperty"===e)return Wt}const a=Reflect.get(t,e,ve(t)?t:r);return(w(e)?Vt.has(e):Ut(e))?a:(o||zt(t,0,e),n?a:ve(a)?i&&S(e)?a:a.value:y(a)?o?de(a):le(a):a)}}class qt extends Ht{constructor(t=!1){super(!1,t)}set(t,e,r,o){let n=t[e];if(!this._isShallow){const e=be(n);if(me(r)||be(r)||(n=fe(n),r=fe(r)),!g(t)&&ve(n)&&!ve(r))return!e&&(n.value=r,!0)}const i=g(t)&&S(e)?Number(e)<t.length:m(t,e),a=Reflect.set(t,e,r,ve(t)?t:o);return t===fe(o)&&(i?D(r,n)&&Lt(t,"set",e,r):Lt(t,"add",e,r)),a}deleteProperty(t,e){const r=m(t,e),o=(t[e],Reflect.deleteProperty(t,e));return o&&r&&Lt(t,"delete",e,void 0),o}has(t,e){const r=Reflect.has(t,e);return w(e)&&Vt.has(e)||zt(t,0,e),r}ownKeys(t){return zt(t,0,g(t)?"length":Ot),Reflect.ownKeys(t)}}class Gt extends Ht{constructor(t=!1){super(!0,t)}set(t,e){return!0}deleteProperty(t,e){return!0}}const Kt=new qt,Xt=new Gt,Yt=new qt(!0),Jt=t=>t,Qt=t=>Reflect.getPrototypeOf(t);function Zt(t){return function(...e){return"delete"!==t&&("clear"===t?void 0:this)}}function te(t,e){const r=function(t,e){const r={get(r){const o=this.__v_raw,n=fe(o),i=fe(r);t||(D(r,i)&&zt(n,0,r),zt(n,0,i));const{has:a}=Qt(n),s=e?Jt:t?he:ue;return a.call(n,r)?s(o.get(r)):a.call(n,i)?s(o.get(i)):void(o!==n&&o.get(r))},get size(){const e=this.__v_raw;return!t&&zt(fe(e),0,Ot),Reflect.get(e,"size",e)},has(e){const r=this.__v_raw,o=fe(r),n=fe(e);return t||(D(e,n)&&zt(o,0,e),zt(o,0,n)),e===n?r.has(e):r.has(e)||r.has(n)},forEach(r,o){const n=this,i=n.__v_raw,a=fe(i),s=e?Jt:t?he:ue;return!t&&zt(a,0,Ot),i.forEach(((t,e)=>r.call(o,s(t),s(e),n)))}};return c(r,t?{add:Zt("add"),set:Zt("set"),delete:Zt("delete"),clear:Zt("clear")}:{add(t){e||me(t)||be(t)||(t=fe(t));const r=fe(this);return Qt(r).has.call(r,t)||(r.add(t),Lt(r,"add",t,t)),this},set(t,r){e||me(r)||be(r)||(r=fe(r));const o=fe(this),{has:n,get:i}=Qt(o);let a=n.call(o,t);a||(t=fe(t),a=n.call(o,t));const s=i.call(o,t);return o.set(t,r),a?D(r,s)&&Lt(o,"set",t,r):Lt(o,"add",t,r),this},delete(t){const e=fe(this),{has:r,get:o}=Qt(e);let n=r.call(e,t);n||(t=fe(t),n=r.call(e,t)),o&&o.call(e,t);const i=e.delete(t);return n&&Lt(e,"delete",t,void 0),i},clear(){const t=fe(this),e=0!==t.size,r=t.clear();return e&&Lt(t,"clear",void 0,void 0),r}}),["keys","values","entries",Symbol.iterator].forEach((o=>{r[o]=function(t,e,r){return function(...o){const n=this.__v_raw,i=fe(n),a=f(i),s="entries"===t||t===Symbol.iterator&&a,l="keys"===t&&a,d=n[t](...o),c=r?Jt:e?he:ue;return!e&&zt(i,0,l?Ct:Ot),{next(){const{value:t,done:e}=d.next();return e?{value:t,done:e}:{value:s?[c(t[0]),c(t[1])]:c(t),done:e}},[Symbol.iterator](){return this}}}}(o,t,e)})),r}(t,e);return(e,o,n)=>"__v_isReactive"===o?!t:"__v_isReadonly"===o?t:"__v_raw"===o?e:Reflect.get(m(r,o)&&o in e?r:e,o,n)}const ee={get:te(!1,!1)},re={get:te(!1,!0)},oe={get:te(!0,!1)},ne=new WeakMap,ie=new WeakMap,ae=new WeakMap,se=new WeakMap;function le(t){return be(t)?t:ce(t,!1,Kt,ee,ne)}function de(t){return ce(t,!0,Xt,oe,ae)}function ce(t,e,r,o,n){if(!y(t))return t;if(t.__v_raw&&(!e||!t.__v_isReactive))return t;const i=n.get(t);if(i)return i;const a=(s=t).__v_skip||!Object.isExtensible(s)?0:function(t){switch(t){case"Object":case"Array":return 1;case"Map":case"Set":case"WeakMap":case"WeakSet":return 2;default:return 0}}((t=>E(t).slice(8,-1))(s));var s;if(0===a)return t;const l=new Proxy(t,2===a?o:r);return n.set(t,l),l}function pe(t){return be(t)?pe(t.__v_raw):!(!t||!t.__v_isReactive)}function be(t){return!(!t||!t.__v_isReadonly)}function me(t){return!(!t||!t.__v_isShallow)}function ge(t){return!!t&&!!t.__v_raw}function fe(t){const e=t&&t.__v_raw;return e?fe(e):t}const ue=t=>y(t)?le(t):t,he=t=>y(t)?de(t):t;function ve(t){return!!t&&!0===t.__v_isRef}const xe={get:(t,e,r)=>{return"__v_raw"===e?t:ve(o=Reflect.get(t,e,r))?o.value:o;var o},set:(t,e,r,o)=>{const n=t[e];return ve(n)&&!ve(r)?(n.value=r,!0):Reflect.set(t,e,r,o)}};function we(t){return pe(t)?t:new Proxy(t,xe)}class ye{constructor(t,e,r){this.fn=t,this.setter=e,this._value=void 0,this.dep=new At(this),this.__v_isRef=!0,this.deps=void 0,this.depsTail=void 0,this.flags=16,this.globalVersion=kt-1,this.next=void 0,this.effect=this,this.__v_isReadonly=!e,this.isSSR=r}notify(){if(this.flags|=16,!(8&this.flags||rt===this))return dt(this,!0),!0}get value(){const t=this.dep.track();return ft(this),t&&(t.version=this.dep.version),this._value}set value(t){this.setter&&this.setter(t)}}const _e={},ke=new WeakMap;let Ee;function Ae(t,e=1/0,r){if(e<=0||!y(t)||t.__v_skip)return t;if((r=r||new Set).has(t))return t;if(r.add(t),e--,ve(t))Ae(t.value,e,r);else if(g(t))for(let o=0;o<t.length;o++)Ae(t[o],e,r);else if(u(t)||f(t))t.forEach((t=>{Ae(t,e,r)}));else if(A(t)){for(const o in t)Ae(t[o],e,r);for(const o of Object.getOwnPropertySymbols(t))Object.prototype.propertyIsEnumerable.call(t,o)&&Ae(t[o],e,r)}return t}function Se(t,e,r,o){try{return o?t(...o):t()}catch(t){Oe(t,e,r)}}function Te(t,e,r,o){if(v(t)){const n=Se(t,e,r,o);return n&&_(n)&&n.catch((t=>{Oe(t,e,r)})),n}if(g(t)){const n=[];for(let i=0;i<t.length;i++)n.push(Te(t[i],e,r,o));return n}}function Oe(t,e,r,o=!0){e&&e.vnode;const{errorHandler:i,throwUnhandledErrorInProduction:a}=e&&e.appContext.config||n;if(e){let o=e.parent;const n=e.proxy,a=`https://vuejs.org/error-reference/#runtime-${r}`;for(;o;){const e=o.ec;if(e)for(let r=0;r<e.length;r++)if(!1===e[r](t,n,a))return;o=o.parent}if(i)return wt(),Se(i,null,10,[t,n,a]),void yt()}!function(t,e,r,o=!0,n=!1){if(n)throw t;console.error(t)}(t,0,0,o,a)}const Ce=[];let je=-1;const ze=[];let Le=null,Re=0;const Pe=Promise.resolve();let De=null;function Me(t){const e=De||Pe;return t?e.then(this?t.bind(this):t):e}function Ne(t){if(!(1&t.flags)){const e=$e(t),r=Ce[Ce.length-1];!r||!(2&t.flags)&&e>=$e(r)?Ce.push(t):Ce.splice(function(t){let e=je+1,r=Ce.length;for(;e<r;){const o=e+r>>>1,n=Ce[o],i=$e(n);i<t||i===t&&2&n.flags?e=o+1:r=o}return e}(e),0,t),t.flags|=1,Ie()}}function Ie(){De||(De=Pe.then(Ue))}function Be(t,e,r=je+1){for(;r<Ce.length;r++){const e=Ce[r];if(e&&2&e.flags){if(t&&e.id!==t.uid)continue;Ce.splice(r,1),r--,4&e.flags&&(e.flags&=-2),e(),4&e.flags||(e.flags&=-2)}}}function Fe(t){if(ze.length){const t=[...new Set(ze)].sort(((t,e)=>$e(t)-$e(e)));if(ze.length=0,Le)return void Le.push(...t);for(Le=t,Re=0;Re<Le.length;Re++){const t=Le[Re];4&t.flags&&(t.flags&=-2),8&t.flags||t(),t.flags&=-2}Le=null,Re=0}}const $e=t=>null==t.id?2&t.flags?-1:1/0:t.id;function Ue(t){try{for(je=0;je<Ce.length;je++){const t=Ce[je];!t||8&t.flags||(4&t.flags&&(t.flags&=-2),Se(t,t.i,t.i?15:14),4&t.flags||(t.flags&=-2))}}finally{for(;je<Ce.length;je++){const t=Ce[je];t&&(t.flags&=-2)}je=-1,Ce.length=0,Fe(),De=null,(Ce.length||ze.length)&&Ue(t)}}let Ve,We=[],He=!1;function qe(t,...e){Ve?Ve.emit(t,...e):He||We.push({event:t,args:e})}function Ge(t,e){var r,o;Ve=t,Ve?(Ve.enabled=!0,We.forEach((({event:t,args:e})=>Ve.emit(t,...e))),We=[]):"undefined"!=typeof window&&window.HTMLElement&&!(null==(o=null==(r=window.navigator)?void 0:r.userAgent)?void 0:o.includes("jsdom"))?((e.__VUE_DEVTOOLS_HOOK_REPLAY__=e.__VUE_DEVTOOLS_HOOK_REPLAY__||[]).push((t=>{Ge(t,e)})),setTimeout((()=>{Ve||(e.__VUE_DEVTOOLS_HOOK_REPLAY__=null,He=!0,We=[])}),3e3)):(He=!0,We=[])}const Ke=Je("component:added"),Xe=Je("component:updated"),Ye=Je("component:removed");function Je(t){return e=>{qe(t,e.appContext.app,e.uid,e.parent?e.parent.uid:void 0,e)}}let Qe=null,Ze=null;function tr(t){const e=Qe;return Qe=t,Ze=t&&t.type.__scopeId||null,e}function er(t,e){if(null===Qe)return t;const r=xn(Qe),o=t.dirs||(t.dirs=[]);for(let t=0;t<e.length;t++){let[i,a,s,l=n]=e[t];i&&(v(i)&&(i={mounted:i,updated:i}),i.deep&&Ae(a),o.push({dir:i,instance:r,value:a,oldValue:void 0,arg:s,modifiers:l}))}return t}function rr(t,e,r,o){const n=t.dirs,i=e&&e.dirs;for(let a=0;a<n.length;a++){const s=n[a];i&&(s.oldValue=i[a].value);let l=s.dir[o];l&&(wt(),Te(l,r,8,[t.el,s,t,e]),yt())}}const or=Symbol("_vte");Symbol("_leaveCb"),Symbol("_enterCb");function nr(t,e){6&t.shapeFlag&&t.component?(t.transition=e,nr(t.component.subTree,e)):128&t.shapeFlag?(t.ssContent.transition=e.clone(t.ssContent),t.ssFallback.transition=e.clone(t.ssFallback)):t.transition=e}function ir(t){t.ids=[t.ids[0]+t.ids[2]+++"-",0,0]}function ar(t,e,r,o,i=!1){if(g(t))return void t.forEach(((t,n)=>ar(t,e&&(g(e)?e[n]:e),r,o,i)));if(sr(o)&&!i)return;const a=4&o.shapeFlag?xn(o.component):o.el,s=i?null:a,{i:l,r:d}=t,c=e&&e.r,b=l.refs===n?l.refs={}:l.refs,f=l.setupState,u=fe(f),h=f===n?()=>!1:t=>m(u,t);if(null!=c&&c!==d&&(x(c)?(b[c]=null,h(c)&&(f[c]=null)):ve(c)&&(c.value=null)),v(d))Se(d,l,12,[s,b]);else{const e=x(d),o=ve(d);if(e||o){const n=()=>{if(t.f){const r=e?h(d)?f[d]:b[d]:d.value;i?g(r)&&p(r,a):g(r)?r.includes(a)||r.push(a):e?(b[d]=[a],h(d)&&(f[d]=b[d])):(d.value=[a],t.k&&(b[t.k]=d.value))}else e?(b[d]=s,h(d)&&(f[d]=s)):o&&(d.value=s,t.k&&(b[t.k]=s))};s?(n.id=-1,bo(n,r)):n()}}}Boolean,Boolean,F().requestIdleCallback,F().cancelIdleCallback;const sr=t=>!!t.type.__asyncLoader,lr=t=>t.type.__isKeepAlive;function dr(t,e){pr(t,"a",e)}function cr(t,e){pr(t,"da",e)}function pr(t,e,r=sn){const o=t.__wdc||(t.__wdc=()=>{let e=r;for(;e;){if(e.isDeactivated)return;e=e.parent}return t()});if(mr(e,o,r),r){let t=r.parent;for(;t&&t.parent;)lr(t.parent.vnode)&&br(o,e,r,t),t=t.parent}}function br(t,e,r,o){const n=mr(e,t,o,!0);wr((()=>{p(o[e],n)}),r)}function mr(t,e,r=sn,o=!1){if(r){const n=r[t]||(r[t]=[]),i=e.__weh||(e.__weh=(...o)=>{wt();const n=cn(r),i=Te(e,r,t,o);return n(),yt(),i});return o?n.unshift(i):n.push(i),i}}RegExp,RegExp;const gr=t=>(e,r=sn)=>{fn&&"sp"!==t||mr(t,((...t)=>e(...t)),r)},fr=gr("bm"),ur=gr("m"),hr=gr("bu"),vr=gr("u"),xr=gr("bum"),wr=gr("um"),yr=gr("sp"),_r=gr("rtg"),kr=gr("rtc");function Er(t,e=sn){mr("ec",t,e)}const Ar="components";function Sr(t,e){return function(t,e,r=!0,o=!1){const n=Qe||sn;if(n){const r=n.type;if(t===Ar){const t=function(t,e=!0){return v(t)?t.displayName||t.name:t.name||e&&t.__name}(r,!1);if(t&&(t===e||t===j(e)||t===R(j(e))))return r}const i=Or(n[t]||r[t],e)||Or(n.appContext[t],e);return!i&&o?r:i}}(Ar,t,!0,e)||t}const Tr=Symbol.for("v-ndc");function Or(t,e){return t&&(t[e]||t[j(e)]||t[R(j(e))])}function Cr(t,e,r,o){let n;const i=r&&r[o],a=g(t);if(a||x(t)){let r=!1;a&&pe(t)&&(r=!me(t),t=Pt(t)),n=new Array(t.length);for(let o=0,a=t.length;o<a;o++)n[o]=e(r?ue(t[o]):t[o],o,void 0,i&&i[o])}else if("number"==typeof t){n=new Array(t);for(let r=0;r<t;r++)n[r]=e(r+1,r,void 0,i&&i[r])}else if(y(t))if(t[Symbol.iterator])n=Array.from(t,((t,r)=>e(t,r,void 0,i&&i[r])));else{const r=Object.keys(t);n=new Array(r.length);for(let o=0,a=r.length;o<a;o++){const a=r[o];n[o]=e(t[a],a,o,i&&i[o])}}else n=[];return r&&(r[o]=n),n}const jr=t=>t?bn(t)?xn(t):jr(t.parent):null,zr=c(Object.create(null),{$:t=>t,$el:t=>t.vnode.el,$data:t=>t.data,$props:t=>t.props,$attrs:t=>t.attrs,$slots:t=>t.slots,$refs:t=>t.refs,$parent:t=>jr(t.parent),$root:t=>jr(t.root),$host:t=>t.ce,$emit:t=>t.emit,$options:t=>__VUE_OPTIONS_API__?Ir(t):t.type,$forceUpdate:t=>t.f||(t.f=()=>{Ne(t.update)}),$nextTick:t=>t.n||(t.n=Me.bind(t.proxy)),$watch:t=>__VUE_OPTIONS_API__?ko.bind(t):a}),Lr=(t,e)=>t!==n&&!t.__isScriptSetup&&m(t,e),Rr={get({_:t},e){if("__v_skip"===e)return!0;const{ctx:r,setupState:o,data:i,props:a,accessCache:s,type:l,appContext:d}=t;let c;if("$"!==e[0]){const l=s[e];if(void 0!==l)switch(l){case 1:return o[e];case 2:return i[e];case 4:return r[e];case 3:return a[e]}else{if(Lr(o,e))return s[e]=1,o[e];if(i!==n&&m(i,e))return s[e]=2,i[e];if((c=t.propsOptions[0])&&m(c,e))return s[e]=3,a[e];if(r!==n&&m(r,e))return s[e]=4,r[e];__VUE_OPTIONS_API__&&!Dr||(s[e]=0)}}const p=zr[e];let b,g;return p?("$attrs"===e&&zt(t.attrs,0,""),p(t)):(b=l.__cssModules)&&(b=b[e])?b:r!==n&&m(r,e)?(s[e]=4,r[e]):(g=d.config.globalProperties,m(g,e)?g[e]:void 0)},set({_:t},e,r){const{data:o,setupState:i,ctx:a}=t;return Lr(i,e)?(i[e]=r,!0):o!==n&&m(o,e)?(o[e]=r,!0):!(m(t.props,e)||"$"===e[0]&&e.slice(1)in t||(a[e]=r,0))},has({_:{data:t,setupState:e,accessCache:r,ctx:o,appContext:i,propsOptions:a}},s){let l;return!!r[s]||t!==n&&m(t,s)||Lr(e,s)||(l=a[0])&&m(l,s)||m(o,s)||m(zr,s)||m(i.config.globalProperties,s)},defineProperty(t,e,r){return null!=r.get?t._.accessCache[e]=0:m(r,"value")&&this.set(t,e,r.value,null),Reflect.defineProperty(t,e,r)}};function Pr(t){return g(t)?t.reduce(((t,e)=>(t[e]=null,t)),{}):t}let Dr=!0;function Mr(t,e,r){Te(g(t)?t.map((t=>t.bind(e.proxy))):t.bind(e.proxy),e,r)}function Nr(t,e,r,o){let n=o.includes(".")?Eo(r,o):()=>r[o];if(x(t)){const r=e[t];v(r)&&yo(n,r)}else if(v(t))yo(n,t.bind(r));else if(y(t))if(g(t))t.forEach((t=>Nr(t,e,r,o)));else{const o=v(t.handler)?t.handler.bind(r):e[t.handler];v(o)&&yo(n,o,t)}}function Ir(t){const e=t.type,{mixins:r,extends:o}=e,{mixins:n,optionsCache:i,config:{optionMergeStrategies:a}}=t.appContext,s=i.get(e);let l;return s?l=s:n.length||r||o?(l={},n.length&&n.forEach((t=>Br(l,t,a,!0))),Br(l,e,a)):l=e,y(e)&&i.set(e,l),l}function Br(t,e,r,o=!1){const{mixins:n,extends:i}=e;i&&Br(t,i,r,!0),n&&n.forEach((e=>Br(t,e,r,!0)));for(const n in e)if(o&&"expose"===n);else{const o=Fr[n]||r&&r[n];t[n]=o?o(t[n],e[n]):e[n]}return t}const Fr={data:$r,props:Hr,emits:Hr,methods:Wr,computed:Wr,beforeCreate:Vr,created:Vr,beforeMount:Vr,mounted:Vr,beforeUpdate:Vr,updated:Vr,beforeDestroy:Vr,beforeUnmount:Vr,destroyed:Vr,unmounted:Vr,activated:Vr,deactivated:Vr,errorCaptured:Vr,serverPrefetch:Vr,components:Wr,directives:Wr,watch:function(t,e){if(!t)return e;if(!e)return t;const r=c(Object.create(null),t);for(const o in e)r[o]=Vr(t[o],e[o]);return r},provide:$r,inject:function(t,e){return Wr(Ur(t),Ur(e))}};function $r(t,e){return e?t?function(){return c(v(t)?t.call(this,this):t,v(e)?e.call(this,this):e)}:e:t}function Ur(t){if(g(t)){const e={};for(let r=0;r<t.length;r++)e[t[r]]=t[r];return e}return t}function Vr(t,e){return t?[...new Set([].concat(t,e))]:e}function Wr(t,e){return t?c(Object.create(null),t,e):e}function Hr(t,e){return t?g(t)&&g(e)?[...new Set([...t,...e])]:c(Object.create(null),Pr(t),Pr(null!=e?e:{})):e}function qr(){return{app:null,config:{isNativeTag:s,performance:!1,globalProperties:{},optionMergeStrategies:{},errorHandler:void 0,warnHandler:void 0,compilerOptions:{}},mixins:[],components:{},directives:{},provides:Object.create(null),optionsCache:new WeakMap,propsCache:new WeakMap,emitsCache:new WeakMap}}let Gr=0;function Kr(t,e){return function(r,o=null){v(r)||(r=c({},r)),null==o||y(o)||(o=null);const n=qr(),i=new WeakSet,a=[];let s=!1;const l=n.app={_uid:Gr++,_component:r,_props:o,_container:null,_context:n,_instance:null,version:yn,get config(){return n.config},set config(t){},use:(t,...e)=>(i.has(t)||(t&&v(t.install)?(i.add(t),t.install(l,...e)):v(t)&&(i.add(t),t(l,...e))),l),mixin:t=>(__VUE_OPTIONS_API__&&(n.mixins.includes(t)||n.mixins.push(t)),l),component:(t,e)=>e?(n.components[t]=e,l):n.components[t],directive:(t,e)=>e?(n.directives[t]=e,l):n.directives[t],mount(i,a,d){if(!s){const c=l._ceVNode||Yo(r,o);return c.appContext=n,!0===d?d="svg":!1===d&&(d=void 0),a&&e?e(c,i):t(c,i,d),s=!0,l._container=i,i.__vue_app__=l,__VUE_PROD_DEVTOOLS__&&(l._instance=c.component,function(t,e){qe("app:init",t,e,{Fragment:Po,Text:Do,Comment:Mo,Static:No})}(l,yn)),xn(c.component)}},onUnmount(t){a.push(t)},unmount(){s&&(Te(a,l._instance,16),t(null,l._container),__VUE_PROD_DEVTOOLS__&&(l._instance=null,function(t){qe("app:unmount",t)}(l)),delete l._container.__vue_app__)},provide:(t,e)=>(n.provides[t]=e,l),runWithContext(t){const e=Xr;Xr=l;try{return t()}finally{Xr=e}}};return l}}let Xr=null;function Yr(t,e,r=!1){const o=sn||Qe;if(o||Xr){const n=Xr?Xr._context.provides:o?null==o.parent?o.vnode.appContext&&o.vnode.appContext.provides:o.parent.provides:void 0;if(n&&t in n)return n[t];if(arguments.length>1)return r&&v(e)?e.call(o&&o.proxy):e}}const Jr={},Qr=()=>Object.create(Jr),Zr=t=>Object.getPrototypeOf(t)===Jr;function to(t,e,r,o){const[i,a]=t.propsOptions;let s,l=!1;if(e)for(let n in e){if(T(n))continue;const d=e[n];let c;i&&m(i,c=j(n))?a&&a.includes(c)?(s||(s={}))[c]=d:r[c]=d:Oo(t.emitsOptions,n)||n in o&&d===o[n]||(o[n]=d,l=!0)}if(a){const e=fe(r),o=s||n;for(let n=0;n<a.length;n++){const s=a[n];r[s]=eo(i,e,s,o[s],t,!m(o,s))}}return l}function eo(t,e,r,o,n,i){const a=t[r];if(null!=a){const t=m(a,"default");if(t&&void 0===o){const t=a.default;if(a.type!==Function&&!a.skipFactory&&v(t)){const{propsDefaults:i}=n;if(r in i)o=i[r];else{const a=cn(n);o=i[r]=t.call(null,e),a()}}else o=t;n.ce&&n.ce._setProp(r,o)}a[0]&&(i&&!t?o=!1:!a[1]||""!==o&&o!==L(r)||(o=!0))}return o}const ro=new WeakMap;function oo(t,e,r=!1){const o=__VUE_OPTIONS_API__&&r?ro:e.propsCache,a=o.get(t);if(a)return a;const s=t.props,l={},d=[];let p=!1;if(__VUE_OPTIONS_API__&&!v(t)){const o=t=>{p=!0;const[r,o]=oo(t,e,!0);c(l,r),o&&d.push(...o)};!r&&e.mixins.length&&e.mixins.forEach(o),t.extends&&o(t.extends),t.mixins&&t.mixins.forEach(o)}if(!s&&!p)return y(t)&&o.set(t,i),i;if(g(s))for(let t=0;t<s.length;t++){const e=j(s[t]);no(e)&&(l[e]=n)}else if(s)for(const t in s){const e=j(t);if(no(e)){const r=s[t],o=l[e]=g(r)||v(r)?{type:r}:c({},r),n=o.type;let i=!1,a=!0;if(g(n))for(let t=0;t<n.length;++t){const e=n[t],r=v(e)&&e.name;if("Boolean"===r){i=!0;break}"String"===r&&(a=!1)}else i=v(n)&&"Boolean"===n.name;o[0]=i,o[1]=a,(i||m(o,"default"))&&d.push(e)}}const b=[l,d];return y(t)&&o.set(t,b),b}function no(t){return"$"!==t[0]&&!T(t)}const io=t=>"_"===t[0]||"$stable"===t,ao=t=>g(t)?t.map(tn):[tn(t)],so=(t,e,r)=>{if(e._n)return e;const o=function(t,e=Qe){if(!e)return t;if(t._n)return t;const r=(...o)=>{r._d&&Uo(-1);const n=tr(e);let i;try{i=t(...o)}finally{tr(n),r._d&&Uo(1)}return __VUE_PROD_DEVTOOLS__&&Xe(e),i};return r._n=!0,r._c=!0,r._d=!0,r}(((...t)=>ao(e(...t))),r);return o._c=!1,o},lo=(t,e,r)=>{const o=t._ctx;for(const r in t){if(io(r))continue;const n=t[r];if(v(n))e[r]=so(0,n,o);else if(null!=n){const t=ao(n);e[r]=()=>t}}},co=(t,e)=>{const r=ao(e);t.slots.default=()=>r},po=(t,e,r)=>{for(const o in e)(r||"_"!==o)&&(t[o]=e[o])},bo=function(t,e){e&&e.pendingBranch?g(t)?e.effects.push(...t):e.effects.push(t):(r=t,g(r)?ze.push(...r):Le&&-1===r.id?Le.splice(Re+1,0,r):1&r.flags||(ze.push(r),r.flags|=1),Ie());var r};function mo(t,e){"boolean"!=typeof __VUE_OPTIONS_API__&&(F().__VUE_OPTIONS_API__=!0),"boolean"!=typeof __VUE_PROD_DEVTOOLS__&&(F().__VUE_PROD_DEVTOOLS__=!1),"boolean"!=typeof __VUE_PROD_HYDRATION_MISMATCH_DETAILS__&&(F().__VUE_PROD_HYDRATION_MISMATCH_DETAILS__=!1);const r=F();r.__VUE__=!0,__VUE_PROD_DEVTOOLS__&&Ge(r.__VUE_DEVTOOLS_GLOBAL_HOOK__,r);const{insert:o,remove:s,patchProp:l,createElement:d,createText:c,createComment:p,setText:b,setElementText:g,parentNode:f,nextSibling:u,setScopeId:h=a,insertStaticContent:v}=t,x=(t,e,r,o=null,n=null,i=null,a=void 0,s=null,l=!!e.dynamicChildren)=>{if(t===e)return;t&&!qo(t,e)&&(o=Q(t),G(t,n,i,!0),t=null),-2===e.patchFlag&&(l=!1,e.dynamicChildren=null);const{type:d,ref:c,shapeFlag:p}=e;switch(d){case Do:w(t,e,r,o);break;case Mo:y(t,e,r,o);break;case No:null==t&&k(e,r,o,a);break;case Po:P(t,e,r,o,n,i,a,s,l);break;default:1&p?E(t,e,r,o,n,i,a,s,l):6&p?D(t,e,r,o,n,i,a,s,l):(64&p||128&p)&&d.process(t,e,r,o,n,i,a,s,l,et)}null!=c&&n&&ar(c,t&&t.ref,i,e||t,!e)},w=(t,e,r,n)=>{if(null==t)o(e.el=c(e.children),r,n);else{const r=e.el=t.el;e.children!==t.children&&b(r,e.children)}},y=(t,e,r,n)=>{null==t?o(e.el=p(e.children||""),r,n):e.el=t.el},k=(t,e,r,o)=>{[t.el,t.anchor]=v(t.children,e,r,o,t.el,t.anchor)},E=(t,e,r,o,n,i,a,s,l)=>{"svg"===e.type?a="svg":"math"===e.type&&(a="mathml"),null==t?A(e,r,o,n,i,a,s,l):C(t,e,n,i,a,s,l)},A=(t,e,r,n,i,a,s,c)=>{let p,b;const{props:m,shapeFlag:f,transition:u,dirs:h}=t;if(p=t.el=d(t.type,a,m&&m.is,m),8&f?g(p,t.children):16&f&&O(t.children,p,null,n,i,go(t,a),s,c),h&&rr(t,null,n,"created"),S(p,t,t.scopeId,s,n),m){for(const t in m)"value"===t||T(t)||l(p,t,null,m[t],a,n);"value"in m&&l(p,"value",null,m.value,a),(b=m.onVnodeBeforeMount)&&on(b,n,t)}__VUE_PROD_DEVTOOLS__&&(N(p,"__vnode",t,!0),N(p,"__vueParentComponent",n,!0)),h&&rr(t,null,n,"beforeMount");const v=function(t,e){return(!t||t&&!t.pendingBranch)&&e&&!e.persisted}(i,u);v&&u.beforeEnter(p),o(p,e,r),((b=m&&m.onVnodeMounted)||v||h)&&bo((()=>{b&&on(b,n,t),v&&u.enter(p),h&&rr(t,null,n,"mounted")}),i)},S=(t,e,r,o,n)=>{if(r&&h(t,r),o)for(let e=0;e<o.length;e++)h(t,o[e]);if(n){let r=n.subTree;if(e===r||Ro(r.type)&&(r.ssContent===e||r.ssFallback===e)){const e=n.vnode;S(t,e,e.scopeId,e.slotScopeIds,n.parent)}}},O=(t,e,r,o,n,i,a,s,l=0)=>{for(let d=l;d<t.length;d++){const l=t[d]=s?en(t[d]):tn(t[d]);x(null,l,e,r,o,n,i,a,s)}},C=(t,e,r,o,i,a,s)=>{const d=e.el=t.el;__VUE_PROD_DEVTOOLS__&&(d.__vnode=e);let{patchFlag:c,dynamicChildren:p,dirs:b}=e;c|=16&t.patchFlag;const m=t.props||n,f=e.props||n;let u;if(r&&fo(r,!1),(u=f.onVnodeBeforeUpdate)&&on(u,r,e,t),b&&rr(e,t,r,"beforeUpdate"),r&&fo(r,!0),(m.innerHTML&&null==f.innerHTML||m.textContent&&null==f.textContent)&&g(d,""),p?z(t.dynamicChildren,p,d,r,o,go(e,i),a):s||V(t,e,d,null,r,o,go(e,i),a,!1),c>0){if(16&c)R(d,m,f,r,i);else if(2&c&&m.class!==f.class&&l(d,"class",null,f.class,i),4&c&&l(d,"style",m.style,f.style,i),8&c){const t=e.dynamicProps;for(let e=0;e<t.length;e++){const o=t[e],n=m[o],a=f[o];a===n&&"value"!==o||l(d,o,n,a,i,r)}}1&c&&t.children!==e.children&&g(d,e.children)}else s||null!=p||R(d,m,f,r,i);((u=f.onVnodeUpdated)||b)&&bo((()=>{u&&on(u,r,e,t),b&&rr(e,t,r,"updated")}),o)},z=(t,e,r,o,n,i,a)=>{for(let s=0;s<e.length;s++){const l=t[s],d=e[s],c=l.el&&(l.type===Po||!qo(l,d)||70&l.shapeFlag)?f(l.el):r;x(l,d,c,null,o,n,i,a,!0)}},R=(t,e,r,o,i)=>{if(e!==r){if(e!==n)for(const n in e)T(n)||n in r||l(t,n,e[n],null,i,o);for(const n in r){if(T(n))continue;const a=r[n],s=e[n];a!==s&&"value"!==n&&l(t,n,s,a,i,o)}"value"in r&&l(t,"value",e.value,r.value,i)}},P=(t,e,r,n,i,a,s,l,d)=>{const p=e.el=t?t.el:c(""),b=e.anchor=t?t.anchor:c("");let{patchFlag:m,dynamicChildren:g,slotScopeIds:f}=e;f&&(l=l?l.concat(f):f),null==t?(o(p,r,n),o(b,r,n),O(e.children||[],r,b,i,a,s,l,d)):m>0&&64&m&&g&&t.dynamicChildren?(z(t.dynamicChildren,g,r,i,a,s,l),(null!=e.key||i&&e===i.subTree)&&uo(t,e,!0)):V(t,e,r,b,i,a,s,l,d)},D=(t,e,r,o,n,i,a,s,l)=>{e.slotScopeIds=s,null==t?512&e.shapeFlag?n.ctx.activate(e,r,o,a,l):I(e,r,o,n,i,a,l):B(t,e,l)},I=(t,e,r,o,i,a,s)=>{const l=t.component=function(t,e,r){const o=t.type,i=(e?e.appContext:t.appContext)||nn,a={uid:an++,vnode:t,type:o,parent:e,appContext:i,root:null,next:null,subTree:null,effect:null,update:null,job:null,scope:new ot(!0),render:null,proxy:null,exposed:null,exposeProxy:null,withProxy:null,provides:e?e.provides:Object.create(i.provides),ids:e?e.ids:["",0,0],accessCache:null,renderCache:[],components:null,directives:null,propsOptions:oo(o,i),emitsOptions:To(o,i),emit:null,emitted:null,propsDefaults:n,inheritAttrs:o.inheritAttrs,ctx:n,data:n,props:n,attrs:n,slots:n,refs:n,setupState:n,setupContext:null,suspense:r,suspenseId:r?r.pendingId:0,asyncDep:null,asyncResolved:!1,isMounted:!1,isUnmounted:!1,isDeactivated:!1,bc:null,c:null,bm:null,m:null,bu:null,u:null,um:null,bum:null,da:null,a:null,rtg:null,rtc:null,ec:null,sp:null};return a.ctx={_:a},a.root=e?e.root:a,a.emit=So.bind(null,a),t.ce&&t.ce(a),a}(t,o,i);if(lr(t)&&(l.ctx.renderer=et),function(t,e=!1,r=!1){e&&dn(e);const{props:o,children:n}=t.vnode,i=bn(t);(function(t,e,r,o=!1){const n={},i=Qr();t.propsDefaults=Object.create(null),to(t,e,n,i);for(const e in t.propsOptions[0])e in n||(n[e]=void 0);r?t.props=o?n:ce(n,!1,Yt,re,ie):t.type.props?t.props=n:t.props=i,t.attrs=i})(t,o,i,e),((t,e,r)=>{const o=t.slots=Qr();if(32&t.vnode.shapeFlag){const t=e._;t?(po(o,e,r),r&&N(o,"_",t,!0)):lo(e,o)}else e&&co(t,e)})(t,n,r);const a=i?function(t,e){const r=t.type;t.accessCache=Object.create(null),t.proxy=new Proxy(t.ctx,Rr);const{setup:o}=r;if(o){wt();const r=t.setupContext=o.length>1?function(t){const e=e=>{t.exposed=e||{}};return{attrs:new Proxy(t.attrs,vn),slots:t.slots,emit:t.emit,expose:e}}(t):null,n=cn(t),i=Se(o,t,0,[t.props,r]),a=_(i);if(yt(),n(),!a&&!t.sp||sr(t)||ir(t),a){if(i.then(pn,pn),e)return i.then((r=>{un(t,r,e)})).catch((e=>{Oe(e,t,0)}));t.asyncDep=i}else un(t,i,e)}else hn(t,e)}(t,e):void 0;e&&dn(!1)}(l,!1,s),l.asyncDep){if(i&&i.registerDep(l,$,s),!t.el){const t=l.subTree=Yo(Mo);y(null,t,e,r)}}else $(l,t,e,r,i,a,s)},B=(t,e,r)=>{const o=e.component=t.component;if(function(t,e,r){const{props:o,children:n,component:i}=t,{props:a,children:s,patchFlag:l}=e,d=i.emitsOptions;if(e.dirs||e.transition)return!0;if(!(r&&l>=0))return!(!n&&!s||s&&s.$stable)||o!==a&&(o?!a||Lo(o,a,d):!!a);if(1024&l)return!0;if(16&l)return o?Lo(o,a,d):!!a;if(8&l){const t=e.dynamicProps;for(let e=0;e<t.length;e++){const r=t[e];if(a[r]!==o[r]&&!Oo(d,r))return!0}}return!1}(t,e,r)){if(o.asyncDep&&!o.asyncResolved)return void U(o,e,r);o.next=e,o.update()}else e.el=t.el,o.vnode=e},$=(t,e,r,o,n,i,a)=>{const s=()=>{if(t.isMounted){let{next:e,bu:r,u:o,parent:l,vnode:d}=t;{const r=ho(t);if(r)return e&&(e.el=d.el,U(t,e,a)),void r.asyncDep.then((()=>{t.isUnmounted||s()}))}let c,p=e;fo(t,!1),e?(e.el=d.el,U(t,e,a)):e=d,r&&M(r),(c=e.props&&e.props.onVnodeBeforeUpdate)&&on(c,l,e,d),fo(t,!0);const b=Co(t),m=t.subTree;t.subTree=b,x(m,b,f(m.el),Q(m),t,n,i),e.el=b.el,null===p&&function({vnode:t,parent:e},r){for(;e;){const o=e.subTree;if(o.suspense&&o.suspense.activeBranch===t&&(o.el=t.el),o!==t)break;(t=e.vnode).el=r,e=e.parent}}(t,b.el),o&&bo(o,n),(c=e.props&&e.props.onVnodeUpdated)&&bo((()=>on(c,l,e,d)),n),__VUE_PROD_DEVTOOLS__&&Xe(t)}else{let a;const{el:s,props:l}=e,{bm:d,m:c,parent:p,root:b,type:m}=t,g=sr(e);if(fo(t,!1),d&&M(d),!g&&(a=l&&l.onVnodeBeforeMount)&&on(a,p,e),fo(t,!0),s&&nt){const e=()=>{t.subTree=Co(t),nt(s,t.subTree,t,n,null)};g&&m.__asyncHydrate?m.__asyncHydrate(s,t,e):e()}else{b.ce&&b.ce._injectChildStyle(m);const a=t.subTree=Co(t);x(null,a,r,o,t,n,i),e.el=a.el}if(c&&bo(c,n),!g&&(a=l&&l.onVnodeMounted)){const t=e;bo((()=>on(a,p,t)),n)}(256&e.shapeFlag||p&&sr(p.vnode)&&256&p.vnode.shapeFlag)&&t.a&&bo(t.a,n),t.isMounted=!0,__VUE_PROD_DEVTOOLS__&&Ke(t),e=r=o=null}};t.scope.on();const l=t.effect=new it(s);t.scope.off();const d=t.update=l.run.bind(l),c=t.job=l.runIfDirty.bind(l);c.i=t,c.id=t.uid,l.scheduler=()=>Ne(c),fo(t,!0),d()},U=(t,e,r)=>{e.component=t;const o=t.vnode.props;t.vnode=e,t.next=null,function(t,e,r,o){const{props:n,attrs:i,vnode:{patchFlag:a}}=t,s=fe(n),[l]=t.propsOptions;let d=!1;if(!(o||a>0)||16&a){let o;to(t,e,n,i)&&(d=!0);for(const i in s)e&&(m(e,i)||(o=L(i))!==i&&m(e,o))||(l?!r||void 0===r[i]&&void 0===r[o]||(n[i]=eo(l,s,i,void 0,t,!0)):delete n[i]);if(i!==s)for(const t in i)e&&m(e,t)||(delete i[t],d=!0)}else if(8&a){const r=t.vnode.dynamicProps;for(let o=0;o<r.length;o++){let a=r[o];if(Oo(t.emitsOptions,a))continue;const c=e[a];if(l)if(m(i,a))c!==i[a]&&(i[a]=c,d=!0);else{const e=j(a);n[e]=eo(l,s,e,c,t,!1)}else c!==i[a]&&(i[a]=c,d=!0)}}d&&Lt(t.attrs,"set","")}(t,e.props,o,r),((t,e,r)=>{const{vnode:o,slots:i}=t;let a=!0,s=n;if(32&o.shapeFlag){const t=e._;t?r&&1===t?a=!1:po(i,e,r):(a=!e.$stable,lo(e,i)),s=e}else e&&(co(t,e),s={default:1});if(a)for(const t in i)io(t)||null!=s[t]||delete i[t]})(t,e.children,r),wt(),Be(t),yt()},V=(t,e,r,o,n,i,a,s,l=!1)=>{const d=t&&t.children,c=t?t.shapeFlag:0,p=e.children,{patchFlag:b,shapeFlag:m}=e;if(b>0){if(128&b)return void H(d,p,r,o,n,i,a,s,l);if(256&b)return void W(d,p,r,o,n,i,a,s,l)}8&m?(16&c&&J(d,n,i),p!==d&&g(r,p)):16&c?16&m?H(d,p,r,o,n,i,a,s,l):J(d,n,i,!0):(8&c&&g(r,""),16&m&&O(p,r,o,n,i,a,s,l))},W=(t,e,r,o,n,a,s,l,d)=>{e=e||i;const c=(t=t||i).length,p=e.length,b=Math.min(c,p);let m;for(m=0;m<b;m++){const o=e[m]=d?en(e[m]):tn(e[m]);x(t[m],o,r,null,n,a,s,l,d)}c>p?J(t,n,a,!0,!1,b):O(e,r,o,n,a,s,l,d,b)},H=(t,e,r,o,n,a,s,l,d)=>{let c=0;const p=e.length;let b=t.length-1,m=p-1;for(;c<=b&&c<=m;){const o=t[c],i=e[c]=d?en(e[c]):tn(e[c]);if(!qo(o,i))break;x(o,i,r,null,n,a,s,l,d),c++}for(;c<=b&&c<=m;){const o=t[b],i=e[m]=d?en(e[m]):tn(e[m]);if(!qo(o,i))break;x(o,i,r,null,n,a,s,l,d),b--,m--}if(c>b){if(c<=m){const t=m+1,i=t<p?e[t].el:o;for(;c<=m;)x(null,e[c]=d?en(e[c]):tn(e[c]),r,i,n,a,s,l,d),c++}}else if(c>m)for(;c<=b;)G(t[c],n,a,!0),c++;else{const g=c,f=c,u=new Map;for(c=f;c<=m;c++){const t=e[c]=d?en(e[c]):tn(e[c]);null!=t.key&&u.set(t.key,c)}let h,v=0;const w=m-f+1;let y=!1,_=0;const k=new Array(w);for(c=0;c<w;c++)k[c]=0;for(c=g;c<=b;c++){const o=t[c];if(v>=w){G(o,n,a,!0);continue}let i;if(null!=o.key)i=u.get(o.key);else for(h=f;h<=m;h++)if(0===k[h-f]&&qo(o,e[h])){i=h;break}void 0===i?G(o,n,a,!0):(k[i-f]=c+1,i>=_?_=i:y=!0,x(o,e[i],r,null,n,a,s,l,d),v++)}const E=y?function(t){const e=t.slice(),r=[0];let o,n,i,a,s;const l=t.length;for(o=0;o<l;o++){const l=t[o];if(0!==l){if(n=r[r.length-1],t[n]<l){e[o]=n,r.push(o);continue}for(i=0,a=r.length-1;i<a;)s=i+a>>1,t[r[s]]<l?i=s+1:a=s;l<t[r[i]]&&(i>0&&(e[o]=r[i-1]),r[i]=o)}}for(i=r.length,a=r[i-1];i-- >0;)r[i]=a,a=e[a];return r}(k):i;for(h=E.length-1,c=w-1;c>=0;c--){const t=f+c,i=e[t],b=t+1<p?e[t+1].el:o;0===k[c]?x(null,i,r,b,n,a,s,l,d):y&&(h<0||c!==E[h]?q(i,r,b,2):h--)}}},q=(t,e,r,n,i=null)=>{const{el:a,type:s,transition:l,children:d,shapeFlag:c}=t;if(6&c)q(t.component.subTree,e,r,n);else if(128&c)t.suspense.move(e,r,n);else if(64&c)s.move(t,e,r,et);else if(s!==Po)if(s!==No)if(2!==n&&1&c&&l)if(0===n)l.beforeEnter(a),o(a,e,r),bo((()=>l.enter(a)),i);else{const{leave:t,delayLeave:n,afterLeave:i}=l,s=()=>o(a,e,r),d=()=>{t(a,(()=>{s(),i&&i()}))};n?n(a,s,d):d()}else o(a,e,r);else(({el:t,anchor:e},r,n)=>{let i;for(;t&&t!==e;)i=u(t),o(t,r,n),t=i;o(e,r,n)})(t,e,r);else{o(a,e,r);for(let t=0;t<d.length;t++)q(d[t],e,r,n);o(t.anchor,e,r)}},G=(t,e,r,o=!1,n=!1)=>{const{type:i,props:a,ref:s,children:l,dynamicChildren:d,shapeFlag:c,patchFlag:p,dirs:b,cacheIndex:m}=t;if(-2===p&&(n=!1),null!=s&&ar(s,null,r,t,!0),null!=m&&(e.renderCache[m]=void 0),256&c)return void e.ctx.deactivate(t);const g=1&c&&b,f=!sr(t);let u;if(f&&(u=a&&a.onVnodeBeforeUnmount)&&on(u,e,t),6&c)Y(t.component,r,o);else{if(128&c)return void t.suspense.unmount(r,o);g&&rr(t,null,e,"beforeUnmount"),64&c?t.type.remove(t,e,r,et,o):d&&!d.hasOnce&&(i!==Po||p>0&&64&p)?J(d,e,r,!1,!0):(i===Po&&384&p||!n&&16&c)&&J(l,e,r),o&&K(t)}(f&&(u=a&&a.onVnodeUnmounted)||g)&&bo((()=>{u&&on(u,e,t),g&&rr(t,null,e,"unmounted")}),r)},K=t=>{const{type:e,el:r,anchor:o,transition:n}=t;if(e===Po)return void X(r,o);if(e===No)return void(({el:t,anchor:e})=>{let r;for(;t&&t!==e;)r=u(t),s(t),t=r;s(e)})(t);const i=()=>{s(r),n&&!n.persisted&&n.afterLeave&&n.afterLeave()};if(1&t.shapeFlag&&n&&!n.persisted){const{leave:e,delayLeave:o}=n,a=()=>e(r,i);o?o(t.el,i,a):a()}else i()},X=(t,e)=>{let r;for(;t!==e;)r=u(t),s(t),t=r;s(e)},Y=(t,e,r)=>{const{bum:o,scope:n,job:i,subTree:a,um:s,m:l,a:d}=t;var c;vo(l),vo(d),o&&M(o),n.stop(),i&&(i.flags|=8,G(a,t,e,r)),s&&bo(s,e),bo((()=>{t.isUnmounted=!0}),e),e&&e.pendingBranch&&!e.isUnmounted&&t.asyncDep&&!t.asyncResolved&&t.suspenseId===e.pendingId&&(e.deps--,0===e.deps&&e.resolve()),__VUE_PROD_DEVTOOLS__&&(c=t,Ve&&"function"==typeof Ve.cleanupBuffer&&!Ve.cleanupBuffer(c)&&Ye(c))},J=(t,e,r,o=!1,n=!1,i=0)=>{for(let a=i;a<t.length;a++)G(t[a],e,r,o,n)},Q=t=>{if(6&t.shapeFlag)return Q(t.component.subTree);if(128&t.shapeFlag)return t.suspense.next();const e=u(t.anchor||t.el),r=e&&e[or];return r?u(r):e};let Z=!1;const tt=(t,e,r)=>{null==t?e._vnode&&G(e._vnode,null,null,!0):x(e._vnode||null,t,e,null,null,null,r),e._vnode=t,Z||(Z=!0,Be(),Fe(),Z=!1)},et={p:x,um:G,m:q,r:K,mt:I,mc:O,pc:V,pbc:z,n:Q,o:t};let rt,nt;return e&&([rt,nt]=e(et)),{render:tt,hydrate:rt,createApp:Kr(tt,rt)}}function go({type:t,props:e},r){return"svg"===r&&"foreignObject"===t||"mathml"===r&&"annotation-xml"===t&&e&&e.encoding&&e.encoding.includes("html")?void 0:r}function fo({effect:t,job:e},r){r?(t.flags|=32,e.flags|=4):(t.flags&=-33,e.flags&=-5)}function uo(t,e,r=!1){const o=t.children,n=e.children;if(g(o)&&g(n))for(let t=0;t<o.length;t++){const e=o[t];let i=n[t];1&i.shapeFlag&&!i.dynamicChildren&&((i.patchFlag<=0||32===i.patchFlag)&&(i=n[t]=en(n[t]),i.el=e.el),r||-2===i.patchFlag||uo(e,i)),i.type===Do&&(i.el=e.el)}}function ho(t){const e=t.subTree.component;if(e)return e.asyncDep&&!e.asyncResolved?e:ho(e)}function vo(t){if(t)for(let e=0;e<t.length;e++)t[e].flags|=8}const xo=Symbol.for("v-scx"),wo=()=>Yr(xo);function yo(t,e,r){return _o(t,e,r)}function _o(t,e,r=n){const{immediate:o,deep:i,flush:s,once:l}=r,d=c({},r),b=e&&o||!e&&"post"!==s;let m;if(fn)if("sync"===s){const t=wo();m=t.__watcherHandles||(t.__watcherHandles=[])}else if(!b){const t=()=>{};return t.stop=a,t.resume=a,t.pause=a,t}const f=sn;d.call=(t,e,r)=>Te(t,f,e,r);let u=!1;"post"===s?d.scheduler=t=>{bo(t,f&&f.suspense)}:"sync"!==s&&(u=!0,d.scheduler=(t,e)=>{e?t():Ne(t)}),d.augmentJob=t=>{e&&(t.flags|=4),u&&(t.flags|=2,f&&(t.id=f.uid,t.i=f))};const h=function(t,e,r=n){const{immediate:o,deep:i,once:s,scheduler:l,augmentJob:d,call:c}=r,b=t=>i?t:me(t)||!1===i||0===i?Ae(t,1):Ae(t);let m,f,u,h,x=!1,w=!1;if(ve(t)?(f=()=>t.value,x=me(t)):pe(t)?(f=()=>b(t),x=!0):g(t)?(w=!0,x=t.some((t=>pe(t)||me(t))),f=()=>t.map((t=>ve(t)?t.value:pe(t)?b(t):v(t)?c?c(t,2):t():void 0))):f=v(t)?e?c?()=>c(t,2):t:()=>{if(u){wt();try{u()}finally{yt()}}const e=Ee;Ee=m;try{return c?c(t,3,[h]):t(h)}finally{Ee=e}}:a,e&&i){const t=f,e=!0===i?1/0:i;f=()=>Ae(t(),e)}const y=et,_=()=>{m.stop(),y&&p(y.effects,m)};if(s&&e){const t=e;e=(...e)=>{t(...e),_()}}let k=w?new Array(t.length).fill(_e):_e;const E=t=>{if(1&m.flags&&(m.dirty||t))if(e){const t=m.run();if(i||x||(w?t.some(((t,e)=>D(t,k[e]))):D(t,k))){u&&u();const r=Ee;Ee=m;try{const r=[t,k===_e?void 0:w&&k[0]===_e?[]:k,h];c?c(e,3,r):e(...r),k=t}finally{Ee=r}}}else m.run()};return d&&d(E),m=new it(f),m.scheduler=l?()=>l(E,!1):E,h=t=>function(t,e=!1,r=Ee){if(r){let e=ke.get(r);e||ke.set(r,e=[]),e.push(t)}}(t,!1,m),u=m.onStop=()=>{const t=ke.get(m);if(t){if(c)c(t,4);else for(const e of t)e();ke.delete(m)}},e?o?E(!0):k=m.run():l?l(E.bind(null,!0),!0):m.run(),_.pause=m.pause.bind(m),_.resume=m.resume.bind(m),_.stop=_,_}(t,e,d);return fn&&(m?m.push(h):b&&h()),h}function ko(t,e,r){const o=this.proxy,n=x(t)?t.includes(".")?Eo(o,t):()=>o[t]:t.bind(o,o);let i;v(e)?i=e:(i=e.handler,r=e);const a=cn(this),s=_o(n,i.bind(o),r);return a(),s}function Eo(t,e){const r=e.split(".");return()=>{let e=t;for(let t=0;t<r.length&&e;t++)e=e[r[t]];return e}}const Ao=(t,e)=>"modelValue"===e||"model-value"===e?t.modelModifiers:t[`${e}Modifiers`]||t[`${j(e)}Modifiers`]||t[`${L(e)}Modifiers`];function So(t,e,...r){if(t.isUnmounted)return;const o=t.vnode.props||n;let i=r;const a=e.startsWith("update:"),s=a&&Ao(o,e.slice(7));let l;s&&(s.trim&&(i=r.map((t=>x(t)?t.trim():t))),s.number&&(i=r.map(I))),__VUE_PROD_DEVTOOLS__&&function(t,e,r){qe("component:emit",t.appContext.app,t,e,r)}(t,e,i);let d=o[l=P(e)]||o[l=P(j(e))];!d&&a&&(d=o[l=P(L(e))]),d&&Te(d,t,6,i);const c=o[l+"Once"];if(c){if(t.emitted){if(t.emitted[l])return}else t.emitted={};t.emitted[l]=!0,Te(c,t,6,i)}}function To(t,e,r=!1){const o=e.emitsCache,n=o.get(t);if(void 0!==n)return n;const i=t.emits;let a={},s=!1;if(__VUE_OPTIONS_API__&&!v(t)){const o=t=>{const r=To(t,e,!0);r&&(s=!0,c(a,r))};!r&&e.mixins.length&&e.mixins.forEach(o),t.extends&&o(t.extends),t.mixins&&t.mixins.forEach(o)}return i||s?(g(i)?i.forEach((t=>a[t]=null)):c(a,i),y(t)&&o.set(t,a),a):(y(t)&&o.set(t,null),null)}function Oo(t,e){return!(!t||!l(e))&&(e=e.slice(2).replace(/Once$/,""),m(t,e[0].toLowerCase()+e.slice(1))||m(t,L(e))||m(t,e))}function Co(t){const{type:e,vnode:r,proxy:o,withProxy:n,propsOptions:[i],slots:a,attrs:s,emit:l,render:c,renderCache:p,props:b,data:m,setupState:g,ctx:f,inheritAttrs:u}=t,h=tr(t);let v,x;try{if(4&r.shapeFlag){const t=n||o,e=t;v=tn(c.call(e,t,p,b,g,m,f)),x=s}else{const t=e;v=tn(t.length>1?t(b,{attrs:s,slots:a,emit:l}):t(b,null)),x=e.props?s:jo(s)}}catch(e){Io.length=0,Oe(e,t,1),v=Yo(Mo)}let w=v;if(x&&!1!==u){const t=Object.keys(x),{shapeFlag:e}=w;t.length&&7&e&&(i&&t.some(d)&&(x=zo(x,i)),w=Jo(w,x,!1,!0))}return r.dirs&&(w=Jo(w,null,!1,!0),w.dirs=w.dirs?w.dirs.concat(r.dirs):r.dirs),r.transition&&nr(w,r.transition),v=w,tr(h),v}const jo=t=>{let e;for(const r in t)("class"===r||"style"===r||l(r))&&((e||(e={}))[r]=t[r]);return e},zo=(t,e)=>{const r={};for(const o in t)d(o)&&o.slice(9)in e||(r[o]=t[o]);return r};function Lo(t,e,r){const o=Object.keys(e);if(o.length!==Object.keys(t).length)return!0;for(let n=0;n<o.length;n++){const i=o[n];if(e[i]!==t[i]&&!Oo(r,i))return!0}return!1}const Ro=t=>t.__isSuspense;const Po=Symbol.for("v-fgt"),Do=Symbol.for("v-txt"),Mo=Symbol.for("v-cmt"),No=Symbol.for("v-stc"),Io=[];let Bo=null;function Fo(t=!1){Io.push(Bo=t?null:[])}let $o=1;function Uo(t){$o+=t,t<0&&Bo&&(Bo.hasOnce=!0)}function Vo(t){return t.dynamicChildren=$o>0?Bo||i:null,Io.pop(),Bo=Io[Io.length-1]||null,$o>0&&Bo&&Bo.push(t),t}function Wo(t,e,r,o,n,i){return Vo(Xo(t,e,r,o,n,i,!0))}function Ho(t){return!!t&&!0===t.__v_isVNode}function qo(t,e){return t.type===e.type&&t.key===e.key}const Go=({key:t})=>null!=t?t:null,Ko=({ref:t,ref_key:e,ref_for:r})=>("number"==typeof t&&(t=""+t),null!=t?x(t)||ve(t)||v(t)?{i:Qe,r:t,k:e,f:!!r}:t:null);function Xo(t,e=null,r=null,o=0,n=null,i=(t===Po?0:1),a=!1,s=!1){const l={__v_isVNode:!0,__v_skip:!0,type:t,props:e,key:e&&Go(e),ref:e&&Ko(e),scopeId:Ze,slotScopeIds:null,children:r,component:null,suspense:null,ssContent:null,ssFallback:null,dirs:null,transition:null,el:null,anchor:null,target:null,targetStart:null,targetAnchor:null,staticCount:0,shapeFlag:i,patchFlag:o,dynamicProps:n,dynamicChildren:null,appContext:null,ctx:Qe};return s?(rn(l,r),128&i&&t.normalize(l)):r&&(l.shapeFlag|=x(r)?8:16),$o>0&&!a&&Bo&&(l.patchFlag>0||6&i)&&32!==l.patchFlag&&Bo.push(l),l}const Yo=function(t,e=null,r=null,o=0,n=null,i=!1){if(t&&t!==Tr||(t=Mo),Ho(t)){const o=Jo(t,e,!0);return r&&rn(o,r),$o>0&&!i&&Bo&&(6&o.shapeFlag?Bo[Bo.indexOf(t)]=o:Bo.push(o)),o.patchFlag=-2,o}if(a=t,v(a)&&"__vccOpts"in a&&(t=t.__vccOpts),e){e=function(t){return t?ge(t)||Zr(t)?c({},t):t:null}(e);let{class:t,style:r}=e;t&&!x(t)&&(e.class=q(t)),y(r)&&(ge(r)&&!g(r)&&(r=c({},r)),e.style=$(r))}var a;return Xo(t,e,r,o,n,x(t)?1:Ro(t)?128:(t=>t.__isTeleport)(t)?64:y(t)?4:v(t)?2:0,i,!0)};function Jo(t,e,r=!1,o=!1){const{props:n,ref:i,patchFlag:a,children:s,transition:d}=t,c=e?function(...t){const e={};for(let r=0;r<t.length;r++){const o=t[r];for(const t in o)if("class"===t)e.class!==o.class&&(e.class=q([e.class,o.class]));else if("style"===t)e.style=$([e.style,o.style]);else if(l(t)){const r=e[t],n=o[t];!n||r===n||g(r)&&r.includes(n)||(e[t]=r?[].concat(r,n):n)}else""!==t&&(e[t]=o[t])}return e}(n||{},e):n,p={__v_isVNode:!0,__v_skip:!0,type:t.type,props:c,key:c&&Go(c),ref:e&&e.ref?r&&i?g(i)?i.concat(Ko(e)):[i,Ko(e)]:Ko(e):i,scopeId:t.scopeId,slotScopeIds:t.slotScopeIds,children:s,target:t.target,targetStart:t.targetStart,targetAnchor:t.targetAnchor,staticCount:t.staticCount,shapeFlag:t.shapeFlag,patchFlag:e&&t.type!==Po?-1===a?16:16|a:a,dynamicProps:t.dynamicProps,dynamicChildren:t.dynamicChildren,appContext:t.appContext,dirs:t.dirs,transition:d,component:t.component,suspense:t.suspense,ssContent:t.ssContent&&Jo(t.ssContent),ssFallback:t.ssFallback&&Jo(t.ssFallback),el:t.el,anchor:t.anchor,ctx:t.ctx,ce:t.ce};return d&&o&&nr(p,d.clone(p)),p}function Qo(t=" ",e=0){return Yo(Do,null,t,e)}function Zo(t="",e=!1){return e?(Fo(),Vo(Yo(Mo,null,t,r,o,!0))):Yo(Mo,null,t);var r,o}function tn(t){return null==t||"boolean"==typeof t?Yo(Mo):g(t)?Yo(Po,null,t.slice()):Ho(t)?en(t):Yo(Do,null,String(t))}function en(t){return null===t.el&&-1!==t.patchFlag||t.memo?t:Jo(t)}function rn(t,e){let r=0;const{shapeFlag:o}=t;if(null==e)e=null;else if(g(e))r=16;else if("object"==typeof e){if(65&o){const r=e.default;return void(r&&(r._c&&(r._d=!1),rn(t,r()),r._c&&(r._d=!0)))}{r=32;const o=e._;o||Zr(e)?3===o&&Qe&&(1===Qe.slots._?e._=1:(e._=2,t.patchFlag|=1024)):e._ctx=Qe}}else v(e)?(e={default:e,_ctx:Qe},r=32):(e=String(e),64&o?(r=16,e=[Qo(e)]):r=8);t.children=e,t.shapeFlag|=r}function on(t,e,r,o=null){Te(t,e,7,[r,o])}const nn=qr();let an=0;let sn=null;let ln,dn;{const t=F(),e=(e,r)=>{let o;return(o=t[e])||(o=t[e]=[]),o.push(r),t=>{o.length>1?o.forEach((e=>e(t))):o[0](t)}};ln=e("__VUE_INSTANCE_SETTERS__",(t=>sn=t)),dn=e("__VUE_SSR_SETTERS__",(t=>fn=t))}const cn=t=>{const e=sn;return ln(t),t.scope.on(),()=>{t.scope.off(),ln(e)}},pn=()=>{sn&&sn.scope.off(),ln(null)};function bn(t){return 4&t.vnode.shapeFlag}let mn,gn,fn=!1;function un(t,e,r){v(e)?t.type.__ssrInlineRender?t.ssrRender=e:t.render=e:y(e)&&(__VUE_PROD_DEVTOOLS__&&(t.devtoolsRawSetupState=e),t.setupState=we(e)),hn(t,r)}function hn(t,e,r){const o=t.type;if(!t.render){if(!e&&mn&&!o.render){const e=o.template||Ir(t).template;if(e){const{isCustomElement:r,compilerOptions:n}=t.appContext.config,{delimiters:i,compilerOptions:a}=o,s=c(c({isCustomElement:r,delimiters:i},n),a);o.render=mn(e,s)}}t.render=o.render||a,gn&&gn(t)}if(__VUE_OPTIONS_API__){const e=cn(t);wt();try{!function(t){const e=Ir(t),r=t.proxy,o=t.ctx;Dr=!1,e.beforeCreate&&Mr(e.beforeCreate,t,"bc");const{data:n,computed:i,methods:s,watch:l,provide:d,inject:c,created:p,beforeMount:b,mounted:m,beforeUpdate:f,updated:u,activated:h,deactivated:x,beforeDestroy:w,beforeUnmount:_,destroyed:k,unmounted:E,render:A,renderTracked:S,renderTriggered:T,errorCaptured:O,serverPrefetch:C,expose:j,inheritAttrs:z,components:L,directives:R,filters:P}=e;if(c&&function(t,e){g(t)&&(t=Ur(t));for(const r in t){const o=t[r];let n;n=y(o)?"default"in o?Yr(o.from||r,o.default,!0):Yr(o.from||r):Yr(o),ve(n)?Object.defineProperty(e,r,{enumerable:!0,configurable:!0,get:()=>n.value,set:t=>n.value=t}):e[r]=n}}(c,o),s)for(const t in s){const e=s[t];v(e)&&(o[t]=e.bind(r))}if(n){const e=n.call(r,r);y(e)&&(t.data=le(e))}if(Dr=!0,i)for(const t in i){const e=i[t],n=v(e)?e.bind(r,r):v(e.get)?e.get.bind(r,r):a,s=!v(e)&&v(e.set)?e.set.bind(r):a,l=wn({get:n,set:s});Object.defineProperty(o,t,{enumerable:!0,configurable:!0,get:()=>l.value,set:t=>l.value=t})}if(l)for(const t in l)Nr(l[t],o,r,t);if(d){const t=v(d)?d.call(r):d;Reflect.ownKeys(t).forEach((e=>{!function(t,e){if(sn){let r=sn.provides;const o=sn.parent&&sn.parent.provides;o===r&&(r=sn.provides=Object.create(o)),r[t]=e}}(e,t[e])}))}function D(t,e){g(e)?e.forEach((e=>t(e.bind(r)))):e&&t(e.bind(r))}if(p&&Mr(p,t,"c"),D(fr,b),D(ur,m),D(hr,f),D(vr,u),D(dr,h),D(cr,x),D(Er,O),D(kr,S),D(_r,T),D(xr,_),D(wr,E),D(yr,C),g(j))if(j.length){const e=t.exposed||(t.exposed={});j.forEach((t=>{Object.defineProperty(e,t,{get:()=>r[t],set:e=>r[t]=e})}))}else t.exposed||(t.exposed={});A&&t.render===a&&(t.render=A),null!=z&&(t.inheritAttrs=z),L&&(t.components=L),R&&(t.directives=R),C&&ir(t)}(t)}finally{yt(),e()}}}const vn={get:(t,e)=>(zt(t,0,""),t[e])};function xn(t){return t.exposed?t.exposeProxy||(t.exposeProxy=new Proxy(we((e=t.exposed,!m(e,"__v_skip")&&Object.isExtensible(e)&&N(e,"__v_skip",!0),e)),{get:(e,r)=>r in e?e[r]:r in zr?zr[r](t):void 0,has:(t,e)=>e in t||e in zr})):t.proxy;var e}const wn=(t,e)=>{const r=function(t,e,r=!1){let o,n;return v(t)?o=t:(o=t.get,n=t.set),new ye(o,n,r)}(t,0,fn);return r},yn="3.5.12";let _n;const kn="undefined"!=typeof window&&window.trustedTypes;if(kn)try{_n=kn.createPolicy("vue",{createHTML:t=>t})}catch(t){}const En=_n?t=>_n.createHTML(t):t=>t,An="undefined"!=typeof document?document:null,Sn=An&&An.createElement("template"),Tn={insert:(t,e,r)=>{e.insertBefore(t,r||null)},remove:t=>{const e=t.parentNode;e&&e.removeChild(t)},createElement:(t,e,r,o)=>{const n="svg"===e?An.createElementNS("http://www.w3.org/2000/svg",t):"mathml"===e?An.createElementNS("http://www.w3.org/1998/Math/MathML",t):r?An.createElement(t,{is:r}):An.createElement(t);return"select"===t&&o&&null!=o.multiple&&n.setAttribute("multiple",o.multiple),n},createText:t=>An.createTextNode(t),createComment:t=>An.createComment(t),setText:(t,e)=>{t.nodeValue=e},setElementText:(t,e)=>{t.textContent=e},parentNode:t=>t.parentNode,nextSibling:t=>t.nextSibling,querySelector:t=>An.querySelector(t),setScopeId(t,e){t.setAttribute(e,"")},insertStaticContent(t,e,r,o,n,i){const a=r?r.previousSibling:e.lastChild;if(n&&(n===i||n.nextSibling))for(;e.insertBefore(n.cloneNode(!0),r),n!==i&&(n=n.nextSibling););else{Sn.innerHTML=En("svg"===o?`<svg>${t}</svg>`:"mathml"===o?`<math>${t}</math>`:t);const n=Sn.content;if("svg"===o||"mathml"===o){const t=n.firstChild;for(;t.firstChild;)n.appendChild(t.firstChild);n.removeChild(t)}e.insertBefore(n,r)}return[a?a.nextSibling:e.firstChild,r?r.previousSibling:e.lastChild]}},On=Symbol("_vtc");Boolean;const Cn=Symbol("_vod"),jn=Symbol("_vsh"),zn=Symbol(""),Ln=/(^|;)\s*display\s*:/,Rn=/\s*!important$/;function Pn(t,e,r){if(g(r))r.forEach((r=>Pn(t,e,r)));else if(null==r&&(r=""),e.startsWith("--"))t.setProperty(e,r);else{const o=function(t,e){const r=Mn[e];if(r)return r;let o=j(e);if("filter"!==o&&o in t)return Mn[e]=o;o=R(o);for(let r=0;r<Dn.length;r++){const n=Dn[r]+o;if(n in t)return Mn[e]=n}return e}(t,e);Rn.test(r)?t.setProperty(L(o),r.replace(Rn,""),"important"):t[o]=r}}const Dn=["Webkit","Moz","ms"],Mn={},Nn="http://www.w3.org/1999/xlink";function In(t,e,r,o,n,i=G(e)){o&&e.startsWith("xlink:")?null==r?t.removeAttributeNS(Nn,e.slice(6,e.length)):t.setAttributeNS(Nn,e,r):null==r||i&&!K(r)?t.removeAttribute(e):t.setAttribute(e,i?"":w(r)?String(r):r)}function Bn(t,e,r,o,n){if("innerHTML"===e||"textContent"===e)return void(null!=r&&(t[e]="innerHTML"===e?En(r):r));const i=t.tagName;if("value"===e&&"PROGRESS"!==i&&!i.includes("-")){const o="OPTION"===i?t.getAttribute("value")||"":t.value,n=null==r?"checkbox"===t.type?"on":"":String(r);return o===n&&"_value"in t||(t.value=n),null==r&&t.removeAttribute(e),void(t._value=r)}let a=!1;if(""===r||null==r){const o=typeof t[e];"boolean"===o?r=K(r):null==r&&"string"===o?(r="",a=!0):"number"===o&&(r=0,a=!0)}try{t[e]=r}catch(t){}a&&t.removeAttribute(n||e)}function Fn(t,e,r,o){t.addEventListener(e,r,o)}const $n=Symbol("_vei");const Un=/(?:Once|Passive|Capture)$/;let Vn=0;const Wn=Promise.resolve(),Hn=()=>Vn||(Wn.then((()=>Vn=0)),Vn=Date.now()),qn=t=>111===t.charCodeAt(0)&&110===t.charCodeAt(1)&&t.charCodeAt(2)>96&&t.charCodeAt(2)<123;"undefined"!=typeof HTMLElement&&HTMLElement,Symbol("_moveCb"),Symbol("_enterCb");const Gn=t=>{const e=t.props["onUpdate:modelValue"]||!1;return g(e)?t=>M(e,t):e};function Kn(t){t.target.composing=!0}function Xn(t){const e=t.target;e.composing&&(e.composing=!1,e.dispatchEvent(new Event("input")))}const Yn=Symbol("_assign"),Jn={created(t,{modifiers:{lazy:e,trim:r,number:o}},n){t[Yn]=Gn(n);const i=o||n.props&&"number"===n.props.type;Fn(t,e?"change":"input",(e=>{if(e.target.composing)return;let o=t.value;r&&(o=o.trim()),i&&(o=I(o)),t[Yn](o)})),r&&Fn(t,"change",(()=>{t.value=t.value.trim()})),e||(Fn(t,"compositionstart",Kn),Fn(t,"compositionend",Xn),Fn(t,"change",Xn))},mounted(t,{value:e}){t.value=null==e?"":e},beforeUpdate(t,{value:e,oldValue:r,modifiers:{lazy:o,trim:n,number:i}},a){if(t[Yn]=Gn(a),t.composing)return;const s=null==e?"":e;if((!i&&"number"!==t.type||/^0\d/.test(t.value)?t.value:I(t.value))!==s){if(document.activeElement===t&&"range"!==t.type){if(o&&e===r)return;if(n&&t.value.trim()===s)return}t.value=s}}},Qn={deep:!0,created(t,e,r){t[Yn]=Gn(r),Fn(t,"change",(()=>{const e=t._modelValue,r=function(t){return"_value"in t?t._value:t.value}(t),o=t.checked,n=t[Yn];if(g(e)){const t=Y(e,r),i=-1!==t;if(o&&!i)n(e.concat(r));else if(!o&&i){const r=[...e];r.splice(t,1),n(r)}}else if(u(e)){const t=new Set(e);o?t.add(r):t.delete(r),n(t)}else n(ti(t,o))}))},mounted:Zn,beforeUpdate(t,e,r){t[Yn]=Gn(r),Zn(t,e,r)}};function Zn(t,{value:e,oldValue:r},o){let n;if(t._modelValue=e,g(e))n=Y(e,o.props.value)>-1;else if(u(e))n=e.has(o.props.value);else{if(e===r)return;n=X(e,ti(t,!0))}t.checked!==n&&(t.checked=n)}function ti(t,e){const r=e?"_trueValue":"_falseValue";return r in t?t[r]:e}const ei=["ctrl","shift","alt","meta"],ri={stop:t=>t.stopPropagation(),prevent:t=>t.preventDefault(),self:t=>t.target!==t.currentTarget,ctrl:t=>!t.ctrlKey,shift:t=>!t.shiftKey,alt:t=>!t.altKey,meta:t=>!t.metaKey,left:t=>"button"in t&&0!==t.button,middle:t=>"button"in t&&1!==t.button,right:t=>"button"in t&&2!==t.button,exact:(t,e)=>ei.some((r=>t[`${r}Key`]&&!e.includes(r)))},oi=(t,e)=>{const r=t._withMods||(t._withMods={}),o=e.join(".");return r[o]||(r[o]=(r,...o)=>{for(let t=0;t<e.length;t++){const o=ri[e[t]];if(o&&o(r,e))return}return t(r,...o)})},ni=c({patchProp:(t,e,r,o,n,i)=>{const a="svg"===n;"class"===e?function(t,e,r){const o=t[On];o&&(e=(e?[e,...o]:[...o]).join(" ")),null==e?t.removeAttribute("class"):r?t.setAttribute("class",e):t.className=e}(t,o,a):"style"===e?function(t,e,r){const o=t.style,n=x(r);let i=!1;if(r&&!n){if(e)if(x(e))for(const t of e.split(";")){const e=t.slice(0,t.indexOf(":")).trim();null==r[e]&&Pn(o,e,"")}else for(const t in e)null==r[t]&&Pn(o,t,"");for(const t in r)"display"===t&&(i=!0),Pn(o,t,r[t])}else if(n){if(e!==r){const t=o[zn];t&&(r+=";"+t),o.cssText=r,i=Ln.test(r)}}else e&&t.removeAttribute("style");Cn in t&&(t[Cn]=i?o.display:"",t[jn]&&(o.display="none"))}(t,r,o):l(e)?d(e)||function(t,e,r,o,n=null){const i=t[$n]||(t[$n]={}),a=i[e];if(o&&a)a.value=o;else{const[r,s]=function(t){let e;if(Un.test(t)){let r;for(e={};r=t.match(Un);)t=t.slice(0,t.length-r[0].length),e[r[0].toLowerCase()]=!0}return[":"===t[2]?t.slice(3):L(t.slice(2)),e]}(e);if(o){const a=i[e]=function(t,e){const r=t=>{if(t._vts){if(t._vts<=r.attached)return}else t._vts=Date.now();Te(function(t,e){if(g(e)){const r=t.stopImmediatePropagation;return t.stopImmediatePropagation=()=>{r.call(t),t._stopped=!0},e.map((t=>e=>!e._stopped&&t&&t(e)))}return e}(t,r.value),e,5,[t])};return r.value=t,r.attached=Hn(),r}(o,n);Fn(t,r,a,s)}else a&&(function(t,e,r,o){t.removeEventListener(e,r,o)}(t,r,a,s),i[e]=void 0)}}(t,e,0,o,i):("."===e[0]?(e=e.slice(1),1):"^"===e[0]?(e=e.slice(1),0):function(t,e,r,o){if(o)return"innerHTML"===e||"textContent"===e||!!(e in t&&qn(e)&&v(r));if("spellcheck"===e||"draggable"===e||"translate"===e)return!1;if("form"===e)return!1;if("list"===e&&"INPUT"===t.tagName)return!1;if("type"===e&&"TEXTAREA"===t.tagName)return!1;if("width"===e||"height"===e){const e=t.tagName;if("IMG"===e||"VIDEO"===e||"CANVAS"===e||"SOURCE"===e)return!1}return(!qn(e)||!x(r))&&e in t}(t,e,o,a))?(Bn(t,e,o),t.tagName.includes("-")||"value"!==e&&"checked"!==e&&"selected"!==e||In(t,e,o,a,0,"value"!==e)):!t._isVueCE||!/[A-Z]/.test(e)&&x(o)?("true-value"===e?t._trueValue=o:"false-value"===e&&(t._falseValue=o),In(t,e,o,a)):Bn(t,j(e),o,0,e)}},Tn);let ii;const ai={id:"app"},si={class:"container"},li={class:"row justify-content-center mb-5"},di={class:"col-12 col-sm-10 col-md-8 col-lg-6 text-center"},ci={key:0},pi={key:0,class:"alert alert-warning text-muted",style:{"font-size":"0.7em"},role:"alert"},bi={key:1};function mi(t,e){return function(){return t.apply(e,arguments)}}const{toString:gi}=Object.prototype,{getPrototypeOf:fi}=Object,ui=(hi=Object.create(null),t=>{const e=gi.call(t);return hi[e]||(hi[e]=e.slice(8,-1).toLowerCase())});var hi;const vi=t=>(t=t.toLowerCase(),e=>ui(e)===t),xi=t=>e=>typeof e===t,{isArray:wi}=Array,yi=xi("undefined"),_i=vi("ArrayBuffer"),ki=xi("string"),Ei=xi("function"),Ai=xi("number"),Si=t=>null!==t&&"object"==typeof t,Ti=t=>{if("object"!==ui(t))return!1;const e=fi(t);return!(null!==e&&e!==Object.prototype&&null!==Object.getPrototypeOf(e)||Symbol.toStringTag in t||Symbol.iterator in t)},Oi=vi("Date"),Ci=vi("File"),ji=vi("Blob"),zi=vi("FileList"),Li=vi("URLSearchParams"),[Ri,Pi,Di,Mi]=["ReadableStream","Request","Response","Headers"].map(vi);function Ni(t,e,{allOwnKeys:r=!1}={}){if(null==t)return;let o,n;if("object"!=typeof t&&(t=[t]),wi(t))for(o=0,n=t.length;o<n;o++)e.call(null,t[o],o,t);else{const n=r?Object.getOwnPropertyNames(t):Object.keys(t),i=n.length;let a;for(o=0;o<i;o++)a=n[o],e.call(null,t[a],a,t)}}function Ii(t,e){e=e.toLowerCase();const r=Object.keys(t);let o,n=r.length;for(;n-- >0;)if(o=r[n],e===o.toLowerCase())return o;return null}const Bi="undefined"!=typeof globalThis?globalThis:"undefined"!=typeof self?self:"undefined"!=typeof window?window:global,Fi=t=>!yi(t)&&t!==Bi,$i=(Ui="undefined"!=typeof Uint8Array&&fi(Uint8Array),t=>Ui&&t instanceof Ui);var Ui;const Vi=vi("HTMLFormElement"),Wi=(({hasOwnProperty:t})=>(e,r)=>t.call(e,r))(Object.prototype),Hi=vi("RegExp"),qi=(t,e)=>{const r=Object.getOwnPropertyDescriptors(t),o={};Ni(r,((r,n)=>{let i;!1!==(i=e(r,n,t))&&(o[n]=i||r)})),Object.defineProperties(t,o)},Gi="abcdefghijklmnopqrstuvwxyz",Ki="0123456789",Xi={DIGIT:Ki,ALPHA:Gi,ALPHA_DIGIT:Gi+Gi.toUpperCase()+Ki},Yi=vi("AsyncFunction"),Ji=(Qi="function"==typeof setImmediate,Zi=Ei(Bi.postMessage),Qi?setImmediate:Zi?(ta=`axios@${Math.random()}`,ea=[],Bi.addEventListener("message",(({source:t,data:e})=>{t===Bi&&e===ta&&ea.length&&ea.shift()()}),!1),t=>{ea.push(t),Bi.postMessage(ta,"*")}):t=>setTimeout(t));var Qi,Zi,ta,ea;const ra="undefined"!=typeof queueMicrotask?queueMicrotask.bind(Bi):"undefined"!=typeof process&&process.nextTick||Ji,oa={isArray:wi,isArrayBuffer:_i,isBuffer:function(t){return null!==t&&!yi(t)&&null!==t.constructor&&!yi(t.constructor)&&Ei(t.constructor.isBuffer)&&t.constructor.isBuffer(t)},isFormData:t=>{let e;return t&&("function"==typeof FormData&&t instanceof FormData||Ei(t.append)&&("formdata"===(e=ui(t))||"object"===e&&Ei(t.toString)&&"[object FormData]"===t.toString()))},isArrayBufferView:function(t){let e;return e="undefined"!=typeof ArrayBuffer&&ArrayBuffer.isView?ArrayBuffer.isView(t):t&&t.buffer&&_i(t.buffer),e},isString:ki,isNumber:Ai,isBoolean:t=>!0===t||!1===t,isObject:Si,isPlainObject:Ti,isReadableStream:Ri,isRequest:Pi,isResponse:Di,isHeaders:Mi,isUndefined:yi,isDate:Oi,isFile:Ci,isBlob:ji,isRegExp:Hi,isFunction:Ei,isStream:t=>Si(t)&&Ei(t.pipe),isURLSearchParams:Li,isTypedArray:$i,isFileList:zi,forEach:Ni,merge:function t(){const{caseless:e}=Fi(this)&&this||{},r={},o=(o,n)=>{const i=e&&Ii(r,n)||n;Ti(r[i])&&Ti(o)?r[i]=t(r[i],o):Ti(o)?r[i]=t({},o):wi(o)?r[i]=o.slice():r[i]=o};for(let t=0,e=arguments.length;t<e;t++)arguments[t]&&Ni(arguments[t],o);return r},extend:(t,e,r,{allOwnKeys:o}={})=>(Ni(e,((e,o)=>{r&&Ei(e)?t[o]=mi(e,r):t[o]=e}),{allOwnKeys:o}),t),trim:t=>t.trim?t.trim():t.replace(/^[\s\uFEFF\xA0]+|[\s\uFEFF\xA0]+$/g,""),stripBOM:t=>(65279===t.charCodeAt(0)&&(t=t.slice(1)),t),inherits:(t,e,r,o)=>{t.prototype=Object.create(e.prototype,o),t.prototype.constructor=t,Object.defineProperty(t,"super",{value:e.prototype}),r&&Object.assign(t.prototype,r)},toFlatObject:(t,e,r,o)=>{let n,i,a;const s={};if(e=e||{},null==t)return e;do{for(n=Object.getOwnPropertyNames(t),i=n.length;i-- >0;)a=n[i],o&&!o(a,t,e)||s[a]||(e[a]=t[a],s[a]=!0);t=!1!==r&&fi(t)}while(t&&(!r||r(t,e))&&t!==Object.prototype);return e},kindOf:ui,kindOfTest:vi,endsWith:(t,e,r)=>{t=String(t),(void 0===r||r>t.length)&&(r=t.length),r-=e.length;const o=t.indexOf(e,r);return-1!==o&&o===r},toArray:t=>{if(!t)return null;if(wi(t))return t;let e=t.length;if(!Ai(e))return null;const r=new Array(e);for(;e-- >0;)r[e]=t[e];return r},forEachEntry:(t,e)=>{const r=(t&&t[Symbol.iterator]).call(t);let o;for(;(o=r.next())&&!o.done;){const r=o.value;e.call(t,r[0],r[1])}},matchAll:(t,e)=>{let r;const o=[];for(;null!==(r=t.exec(e));)o.push(r);return o},isHTMLForm:Vi,hasOwnProperty:Wi,hasOwnProp:Wi,reduceDescriptors:qi,freezeMethods:t=>{qi(t,((e,r)=>{if(Ei(t)&&-1!==["arguments","caller","callee"].indexOf(r))return!1;const o=t[r];Ei(o)&&(e.enumerable=!1,"writable"in e?e.writable=!1:e.set||(e.set=()=>{throw Error("Can not rewrite read-only method '"+r+"'")}))}))},toObjectSet:(t,e)=>{const r={},o=t=>{t.forEach((t=>{r[t]=!0}))};return wi(t)?o(t):o(String(t).split(e)),r},toCamelCase:t=>t.toLowerCase().replace(/[-_\s]([a-z\d])(\w*)/g,(function(t,e,r){return e.toUpperCase()+r})),noop:()=>{},toFiniteNumber:(t,e)=>null!=t&&Number.isFinite(t=+t)?t:e,findKey:Ii,global:Bi,isContextDefined:Fi,ALPHABET:Xi,generateString:(t=16,e=Xi.ALPHA_DIGIT)=>{let r="";const{length:o}=e;for(;t--;)r+=e[Math.random()*o|0];return r},isSpecCompliantForm:function(t){return!!(t&&Ei(t.append)&&"FormData"===t[Symbol.toStringTag]&&t[Symbol.iterator])},toJSONObject:t=>{const e=new Array(10),r=(t,o)=>{if(Si(t)){if(e.indexOf(t)>=0)return;if(!("toJSON"in t)){e[o]=t;const n=wi(t)?[]:{};return Ni(t,((t,e)=>{const i=r(t,o+1);!yi(i)&&(n[e]=i)})),e[o]=void 0,n}}return t};return r(t,0)},isAsyncFn:Yi,isThenable:t=>t&&(Si(t)||Ei(t))&&Ei(t.then)&&Ei(t.catch),setImmediate:Ji,asap:ra};function na(t,e,r,o,n){Error.call(this),Error.captureStackTrace?Error.captureStackTrace(this,this.constructor):this.stack=(new Error).stack,this.message=t,this.name="AxiosError",e&&(this.code=e),r&&(this.config=r),o&&(this.request=o),n&&(this.response=n,this.status=n.status?n.status:null)}oa.inherits(na,Error,{toJSON:function(){return{message:this.message,name:this.name,description:this.description,number:this.number,fileName:this.fileName,lineNumber:this.lineNumber,columnNumber:this.columnNumber,stack:this.stack,config:oa.toJSONObject(this.config),code:this.code,status:this.status}}});const ia=na.prototype,aa={};["ERR_BAD_OPTION_VALUE","ERR_BAD_OPTION","ECONNABORTED","ETIMEDOUT","ERR_NETWORK","ERR_FR_TOO_MANY_REDIRECTS","ERR_DEPRECATED","ERR_BAD_RESPONSE","ERR_BAD_REQUEST","ERR_CANCELED","ERR_NOT_SUPPORT","ERR_INVALID_URL"].forEach((t=>{aa[t]={value:t}})),Object.defineProperties(na,aa),Object.defineProperty(ia,"isAxiosError",{value:!0}),na.from=(t,e,r,o,n,i)=>{const a=Object.create(ia);return oa.toFlatObject(t,a,(function(t){return t!==Error.prototype}),(t=>"isAxiosError"!==t)),na.call(a,t.message,e,r,o,n),a.cause=t,a.name=t.name,i&&Object.assign(a,i),a};const sa=na;function la(t){return oa.isPlainObject(t)||oa.isArray(t)}function da(t){return oa.endsWith(t,"[]")?t.slice(0,-2):t}function ca(t,e,r){return t?t.concat(e).map((function(t,e){return t=da(t),!r&&e?"["+t+"]":t})).join(r?".":""):e}const pa=oa.toFlatObject(oa,{},null,(function(t){return/^is[A-Z]/.test(t)})),ba=function(t,e,r){if(!oa.isObject(t))throw new TypeError("target must be an object");e=e||new FormData;const o=(r=oa.toFlatObject(r,{metaTokens:!0,dots:!1,indexes:!1},!1,(function(t,e){return!oa.isUndefined(e[t])}))).metaTokens,n=r.visitor||d,i=r.dots,a=r.indexes,s=(r.Blob||"undefined"!=typeof Blob&&Blob)&&oa.isSpecCompliantForm(e);if(!oa.isFunction(n))throw new TypeError("visitor must be a function");function l(t){if(null===t)return"";if(oa.isDate(t))return t.toISOString();if(!s&&oa.isBlob(t))throw new sa("Blob is not supported. Use a Buffer instead.");return oa.isArrayBuffer(t)||oa.isTypedArray(t)?s&&"function"==typeof Blob?new Blob([t]):Buffer.from(t):t}function d(t,r,n){let s=t;if(t&&!n&&"object"==typeof t)if(oa.endsWith(r,"{}"))r=o?r:r.slice(0,-2),t=JSON.stringify(t);else if(oa.isArray(t)&&function(t){return oa.isArray(t)&&!t.some(la)}(t)||(oa.isFileList(t)||oa.endsWith(r,"[]"))&&(s=oa.toArray(t)))return r=da(r),s.forEach((function(t,o){!oa.isUndefined(t)&&null!==t&&e.append(!0===a?ca([r],o,i):null===a?r:r+"[]",l(t))})),!1;return!!la(t)||(e.append(ca(n,r,i),l(t)),!1)}const c=[],p=Object.assign(pa,{defaultVisitor:d,convertValue:l,isVisitable:la});if(!oa.isObject(t))throw new TypeError("data must be an object");return function t(r,o){if(!oa.isUndefined(r)){if(-1!==c.indexOf(r))throw Error("Circular reference detected in "+o.join("."));c.push(r),oa.forEach(r,(function(r,i){!0===(!(oa.isUndefined(r)||null===r)&&n.call(e,r,oa.isString(i)?i.trim():i,o,p))&&t(r,o?o.concat(i):[i])})),c.pop()}}(t),e};function ma(t){const e={"!":"%21","'":"%27","(":"%28",")":"%29","~":"%7E","%20":"+","%00":"\0"};return encodeURIComponent(t).replace(/[!'()~]|%20|%00/g,(function(t){return e[t]}))}function ga(t,e){this._pairs=[],t&&ba(t,this,e)}const fa=ga.prototype;fa.append=function(t,e){this._pairs.push([t,e])},fa.toString=function(t){const e=t?function(e){return t.call(this,e,ma)}:ma;return this._pairs.map((function(t){return e(t[0])+"="+e(t[1])}),"").join("&")};const ua=ga;function ha(t){return encodeURIComponent(t).replace(/%3A/gi,":").replace(/%24/g,"$").replace(/%2C/gi,",").replace(/%20/g,"+").replace(/%5B/gi,"[").replace(/%5D/gi,"]")}function va(t,e,r){if(!e)return t;const o=r&&r.encode||ha,n=r&&r.serialize;let i;if(i=n?n(e,r):oa.isURLSearchParams(e)?e.toString():new ua(e,r).toString(o),i){const e=t.indexOf("#");-1!==e&&(t=t.slice(0,e)),t+=(-1===t.indexOf("?")?"?":"&")+i}return t}const xa=class{constructor(){this.handlers=[]}use(t,e,r){return this.handlers.push({fulfilled:t,rejected:e,synchronous:!!r&&r.synchronous,runWhen:r?r.runWhen:null}),this.handlers.length-1}eject(t){this.handlers[t]&&(this.handlers[t]=null)}clear(){this.handlers&&(this.handlers=[])}forEach(t){oa.forEach(this.handlers,(function(e){null!==e&&t(e)}))}},wa={silentJSONParsing:!0,forcedJSONParsing:!0,clarifyTimeoutError:!1},ya={isBrowser:!0,classes:{URLSearchParams:"undefined"!=typeof URLSearchParams?URLSearchParams:ua,FormData:"undefined"!=typeof FormData?FormData:null,Blob:"undefined"!=typeof Blob?Blob:null},protocols:["http","https","file","blob","url","data"]},_a="undefined"!=typeof window&&"undefined"!=typeof document,ka="object"==typeof navigator&&navigator||void 0,Ea=_a&&(!ka||["ReactNative","NativeScript","NS"].indexOf(ka.product)<0),Aa="undefined"!=typeof WorkerGlobalScope&&self instanceof WorkerGlobalScope&&"function"==typeof self.importScripts,Sa=_a&&window.location.href||"http://localhost",Ta={...t,...ya},Oa=function(t){function e(t,r,o,n){let i=t[n++];if("__proto__"===i)return!0;const a=Number.isFinite(+i),s=n>=t.length;return i=!i&&oa.isArray(o)?o.length:i,s?(oa.hasOwnProp(o,i)?o[i]=[o[i],r]:o[i]=r,!a):(o[i]&&oa.isObject(o[i])||(o[i]=[]),e(t,r,o[i],n)&&oa.isArray(o[i])&&(o[i]=function(t){const e={},r=Object.keys(t);let o;const n=r.length;let i;for(o=0;o<n;o++)i=r[o],e[i]=t[i];return e}(o[i])),!a)}if(oa.isFormData(t)&&oa.isFunction(t.entries)){const r={};return oa.forEachEntry(t,((t,o)=>{e(function(t){return oa.matchAll(/\w+|\[(\w*)]/g,t).map((t=>"[]"===t[0]?"":t[1]||t[0]))}(t),o,r,0)})),r}return null},Ca={transitional:wa,adapter:["xhr","http","fetch"],transformRequest:[function(t,e){const r=e.getContentType()||"",o=r.indexOf("application/json")>-1,n=oa.isObject(t);if(n&&oa.isHTMLForm(t)&&(t=new FormData(t)),oa.isFormData(t))return o?JSON.stringify(Oa(t)):t;if(oa.isArrayBuffer(t)||oa.isBuffer(t)||oa.isStream(t)||oa.isFile(t)||oa.isBlob(t)||oa.isReadableStream(t))return t;if(oa.isArrayBufferView(t))return t.buffer;if(oa.isURLSearchParams(t))return e.setContentType("application/x-www-form-urlencoded;charset=utf-8",!1),t.toString();let i;if(n){if(r.indexOf("application/x-www-form-urlencoded")>-1)return function(t,e){return ba(t,new Ta.classes.URLSearchParams,Object.assign({visitor:function(t,e,r,o){return Ta.isNode&&oa.isBuffer(t)?(this.append(e,t.toString("base64")),!1):o.defaultVisitor.apply(this,arguments)}},e))}(t,this.formSerializer).toString();if((i=oa.isFileList(t))||r.indexOf("multipart/form-data")>-1){const e=this.env&&this.env.FormData;return ba(i?{"files[]":t}:t,e&&new e,this.formSerializer)}}return n||o?(e.setContentType("application/json",!1),function(t){if(oa.isString(t))try{return(0,JSON.parse)(t),oa.trim(t)}catch(t){if("SyntaxError"!==t.name)throw t}return(0,JSON.stringify)(t)}(t)):t}],transformResponse:[function(t){const e=this.transitional||Ca.transitional,r=e&&e.forcedJSONParsing,o="json"===this.responseType;if(oa.isResponse(t)||oa.isReadableStream(t))return t;if(t&&oa.isString(t)&&(r&&!this.responseType||o)){const r=!(e&&e.silentJSONParsing)&&o;try{return JSON.parse(t)}catch(t){if(r){if("SyntaxError"===t.name)throw sa.from(t,sa.ERR_BAD_RESPONSE,this,null,this.response);throw t}}}return t}],timeout:0,xsrfCookieName:"XSRF-TOKEN",xsrfHeaderName:"X-XSRF-TOKEN",maxContentLength:-1,maxBodyLength:-1,env:{FormData:Ta.classes.FormData,Blob:Ta.classes.Blob},validateStatus:function(t){return t>=200&&t<300},headers:{common:{Accept:"application/json, text/plain, */*","Content-Type":void 0}}};oa.forEach(["delete","get","head","post","put","patch"],(t=>{Ca.headers[t]={}}));const ja=Ca,za=oa.toObjectSet(["age","authorization","content-length","content-type","etag","expires","from","host","if-modified-since","if-unmodified-since","last-modified","location","max-forwards","proxy-authorization","referer","retry-after","user-agent"]),La=Symbol("internals");function Ra(t){return t&&String(t).trim().toLowerCase()}function Pa(t){return!1===t||null==t?t:oa.isArray(t)?t.map(Pa):String(t)}function Da(t,e,r,o,n){return oa.isFunction(o)?o.call(this,e,r):(n&&(e=r),oa.isString(e)?oa.isString(o)?-1!==e.indexOf(o):oa.isRegExp(o)?o.test(e):void 0:void 0)}class Ma{constructor(t){t&&this.set(t)}set(t,e,r){const o=this;function n(t,e,r){const n=Ra(e);if(!n)throw new Error("header name must be a non-empty string");const i=oa.findKey(o,n);(!i||void 0===o[i]||!0===r||void 0===r&&!1!==o[i])&&(o[i||e]=Pa(t))}const i=(t,e)=>oa.forEach(t,((t,r)=>n(t,r,e)));if(oa.isPlainObject(t)||t instanceof this.constructor)i(t,e);else if(oa.isString(t)&&(t=t.trim())&&!/^[-_a-zA-Z0-9^`|~,!#$%&'*+.]+$/.test(t.trim()))i((t=>{const e={};let r,o,n;return t&&t.split("\n").forEach((function(t){n=t.indexOf(":"),r=t.substring(0,n).trim().toLowerCase(),o=t.substring(n+1).trim(),!r||e[r]&&za[r]||("set-cookie"===r?e[r]?e[r].push(o):e[r]=[o]:e[r]=e[r]?e[r]+", "+o:o)})),e})(t),e);else if(oa.isHeaders(t))for(const[e,o]of t.entries())n(o,e,r);else null!=t&&n(e,t,r);return this}get(t,e){if(t=Ra(t)){const r=oa.findKey(this,t);if(r){const t=this[r];if(!e)return t;if(!0===e)return function(t){const e=Object.create(null),r=/([^\s,;=]+)\s*(?:=\s*([^,;]+))?/g;let o;for(;o=r.exec(t);)e[o[1]]=o[2];return e}(t);if(oa.isFunction(e))return e.call(this,t,r);if(oa.isRegExp(e))return e.exec(t);throw new TypeError("parser must be boolean|regexp|function")}}}has(t,e){if(t=Ra(t)){const r=oa.findKey(this,t);return!(!r||void 0===this[r]||e&&!Da(0,this[r],r,e))}return!1}delete(t,e){const r=this;let o=!1;function n(t){if(t=Ra(t)){const n=oa.findKey(r,t);!n||e&&!Da(0,r[n],n,e)||(delete r[n],o=!0)}}return oa.isArray(t)?t.forEach(n):n(t),o}clear(t){const e=Object.keys(this);let r=e.length,o=!1;for(;r--;){const n=e[r];t&&!Da(0,this[n],n,t,!0)||(delete this[n],o=!0)}return o}normalize(t){const e=this,r={};return oa.forEach(this,((o,n)=>{const i=oa.findKey(r,n);if(i)return e[i]=Pa(o),void delete e[n];const a=t?function(t){return t.trim().toLowerCase().replace(/([a-z\d])(\w*)/g,((t,e,r)=>e.toUpperCase()+r))}(n):String(n).trim();a!==n&&delete e[n],e[a]=Pa(o),r[a]=!0})),this}concat(...t){return this.constructor.concat(this,...t)}toJSON(t){const e=Object.create(null);return oa.forEach(this,((r,o)=>{null!=r&&!1!==r&&(e[o]=t&&oa.isArray(r)?r.join(", "):r)})),e}[Symbol.iterator](){return Object.entries(this.toJSON())[Symbol.iterator]()}toString(){return Object.entries(this.toJSON()).map((([t,e])=>t+": "+e)).join("\n")}get[Symbol.toStringTag](){return"AxiosHeaders"}static from(t){return t instanceof this?t:new this(t)}static concat(t,...e){const r=new this(t);return e.forEach((t=>r.set(t))),r}static accessor(t){const e=(this[La]=this[La]={accessors:{}}).accessors,r=this.prototype;function o(t){const o=Ra(t);e[o]||(function(t,e){const r=oa.toCamelCase(" "+e);["get","set","has"].forEach((o=>{Object.defineProperty(t,o+r,{value:function(t,r,n){return this[o].call(this,e,t,r,n)},configurable:!0})}))}(r,t),e[o]=!0)}return oa.isArray(t)?t.forEach(o):o(t),this}}Ma.accessor(["Content-Type","Content-Length","Accept","Accept-Encoding","User-Agent","Authorization"]),oa.reduceDescriptors(Ma.prototype,(({value:t},e)=>{let r=e[0].toUpperCase()+e.slice(1);return{get:()=>t,set(t){this[r]=t}}})),oa.freezeMethods(Ma);const Na=Ma;function Ia(t,e){const r=this||ja,o=e||r,n=Na.from(o.headers);let i=o.data;return oa.forEach(t,(function(t){i=t.call(r,i,n.normalize(),e?e.status:void 0)})),n.normalize(),i}function Ba(t){return!(!t||!t.__CANCEL__)}function Fa(t,e,r){sa.call(this,null==t?"canceled":t,sa.ERR_CANCELED,e,r),this.name="CanceledError"}oa.inherits(Fa,sa,{__CANCEL__:!0});const $a=Fa;function Ua(t,e,r){const o=r.config.validateStatus;r.status&&o&&!o(r.status)?e(new sa("Request failed with status code "+r.status,[sa.ERR_BAD_REQUEST,sa.ERR_BAD_RESPONSE][Math.floor(r.status/100)-4],r.config,r.request,r)):t(r)}const Va=(t,e,r=3)=>{let o=0;const n=function(t,e){t=t||10;const r=new Array(t),o=new Array(t);let n,i=0,a=0;return e=void 0!==e?e:1e3,function(s){const l=Date.now(),d=o[a];n||(n=l),r[i]=s,o[i]=l;let c=a,p=0;for(;c!==i;)p+=r[c++],c%=t;if(i=(i+1)%t,i===a&&(a=(a+1)%t),l-n<e)return;const b=d&&l-d;return b?Math.round(1e3*p/b):void 0}}(50,250);return function(t,e){let r,o,n=0,i=1e3/e;const a=(e,i=Date.now())=>{n=i,r=null,o&&(clearTimeout(o),o=null),t.apply(null,e)};return[(...t)=>{const e=Date.now(),s=e-n;s>=i?a(t,e):(r=t,o||(o=setTimeout((()=>{o=null,a(r)}),i-s)))},()=>r&&a(r)]}((r=>{const i=r.loaded,a=r.lengthComputable?r.total:void 0,s=i-o,l=n(s);o=i,t({loaded:i,total:a,progress:a?i/a:void 0,bytes:s,rate:l||void 0,estimated:l&&a&&i<=a?(a-i)/l:void 0,event:r,lengthComputable:null!=a,[e?"download":"upload"]:!0})}),r)},Wa=(t,e)=>{const r=null!=t;return[o=>e[0]({lengthComputable:r,total:t,loaded:o}),e[1]]},Ha=t=>(...e)=>oa.asap((()=>t(...e))),qa=Ta.hasStandardBrowserEnv?function(){const t=Ta.navigator&&/(msie|trident)/i.test(Ta.navigator.userAgent),e=document.createElement("a");let r;function o(r){let o=r;return t&&(e.setAttribute("href",o),o=e.href),e.setAttribute("href",o),{href:e.href,protocol:e.protocol?e.protocol.replace(/:$/,""):"",host:e.host,search:e.search?e.search.replace(/^\?/,""):"",hash:e.hash?e.hash.replace(/^#/,""):"",hostname:e.hostname,port:e.port,pathname:"/"===e.pathname.charAt(0)?e.pathname:"/"+e.pathname}}return r=o(window.location.href),function(t){const e=oa.isString(t)?o(t):t;return e.protocol===r.protocol&&e.host===r.host}}():function(){return!0},Ga=Ta.hasStandardBrowserEnv?{write(t,e,r,o,n,i){const a=[t+"="+encodeURIComponent(e)];oa.isNumber(r)&&a.push("expires="+new Date(r).toGMTString()),oa.isString(o)&&a.push("path="+o),oa.isString(n)&&a.push("domain="+n),!0===i&&a.push("secure"),document.cookie=a.join("; ")},read(t){const e=document.cookie.match(new RegExp("(^|;\\s*)("+t+")=([^;]*)"));return e?decodeURIComponent(e[3]):null},remove(t){this.write(t,"",Date.now()-864e5)}}:{write(){},read:()=>null,remove(){}};function Ka(t,e){return t&&!/^([a-z][a-z\d+\-.]*:)?\/\//i.test(e)?function(t,e){return e?t.replace(/\/?\/$/,"")+"/"+e.replace(/^\/+/,""):t}(t,e):e}const Xa=t=>t instanceof Na?{...t}:t;function Ya(t,e){e=e||{};const r={};function o(t,e,r){return oa.isPlainObject(t)&&oa.isPlainObject(e)?oa.merge.call({caseless:r},t,e):oa.isPlainObject(e)?oa.merge({},e):oa.isArray(e)?e.slice():e}function n(t,e,r){return oa.isUndefined(e)?oa.isUndefined(t)?void 0:o(void 0,t,r):o(t,e,r)}function i(t,e){if(!oa.isUndefined(e))return o(void 0,e)}function a(t,e){return oa.isUndefined(e)?oa.isUndefined(t)?void 0:o(void 0,t):o(void 0,e)}function s(r,n,i){return i in e?o(r,n):i in t?o(void 0,r):void 0}const l={url:i,method:i,data:i,baseURL:a,transformRequest:a,transformResponse:a,paramsSerializer:a,timeout:a,timeoutMessage:a,withCredentials:a,withXSRFToken:a,adapter:a,responseType:a,xsrfCookieName:a,xsrfHeaderName:a,onUploadProgress:a,onDownloadProgress:a,decompress:a,maxContentLength:a,maxBodyLength:a,beforeRedirect:a,transport:a,httpAgent:a,httpsAgent:a,cancelToken:a,socketPath:a,responseEncoding:a,validateStatus:s,headers:(t,e)=>n(Xa(t),Xa(e),!0)};return oa.forEach(Object.keys(Object.assign({},t,e)),(function(o){const i=l[o]||n,a=i(t[o],e[o],o);oa.isUndefined(a)&&i!==s||(r[o]=a)})),r}const Ja=t=>{const e=Ya({},t);let r,{data:o,withXSRFToken:n,xsrfHeaderName:i,xsrfCookieName:a,headers:s,auth:l}=e;if(e.headers=s=Na.from(s),e.url=va(Ka(e.baseURL,e.url),t.params,t.paramsSerializer),l&&s.set("Authorization","Basic "+btoa((l.username||"")+":"+(l.password?unescape(encodeURIComponent(l.password)):""))),oa.isFormData(o))if(Ta.hasStandardBrowserEnv||Ta.hasStandardBrowserWebWorkerEnv)s.setContentType(void 0);else if(!1!==(r=s.getContentType())){const[t,...e]=r?r.split(";").map((t=>t.trim())).filter(Boolean):[];s.setContentType([t||"multipart/form-data",...e].join("; "))}if(Ta.hasStandardBrowserEnv&&(n&&oa.isFunction(n)&&(n=n(e)),n||!1!==n&&qa(e.url))){const t=i&&a&&Ga.read(a);t&&s.set(i,t)}return e},Qa="undefined"!=typeof XMLHttpRequest&&function(t){return new Promise((function(e,r){const o=Ja(t);let n=o.data;const i=Na.from(o.headers).normalize();let a,s,l,d,c,{responseType:p,onUploadProgress:b,onDownloadProgress:m}=o;function g(){d&&d(),c&&c(),o.cancelToken&&o.cancelToken.unsubscribe(a),o.signal&&o.signal.removeEventListener("abort",a)}let f=new XMLHttpRequest;function u(){if(!f)return;const o=Na.from("getAllResponseHeaders"in f&&f.getAllResponseHeaders());Ua((function(t){e(t),g()}),(function(t){r(t),g()}),{data:p&&"text"!==p&&"json"!==p?f.response:f.responseText,status:f.status,statusText:f.statusText,headers:o,config:t,request:f}),f=null}f.open(o.method.toUpperCase(),o.url,!0),f.timeout=o.timeout,"onloadend"in f?f.onloadend=u:f.onreadystatechange=function(){f&&4===f.readyState&&(0!==f.status||f.responseURL&&0===f.responseURL.indexOf("file:"))&&setTimeout(u)},f.onabort=function(){f&&(r(new sa("Request aborted",sa.ECONNABORTED,t,f)),f=null)},f.onerror=function(){r(new sa("Network Error",sa.ERR_NETWORK,t,f)),f=null},f.ontimeout=function(){let e=o.timeout?"timeout of "+o.timeout+"ms exceeded":"timeout exceeded";const n=o.transitional||wa;o.timeoutErrorMessage&&(e=o.timeoutErrorMessage),r(new sa(e,n.clarifyTimeoutError?sa.ETIMEDOUT:sa.ECONNABORTED,t,f)),f=null},void 0===n&&i.setContentType(null),"setRequestHeader"in f&&oa.forEach(i.toJSON(),(function(t,e){f.setRequestHeader(e,t)})),oa.isUndefined(o.withCredentials)||(f.withCredentials=!!o.withCredentials),p&&"json"!==p&&(f.responseType=o.responseType),m&&([l,c]=Va(m,!0),f.addEventListener("progress",l)),b&&f.upload&&([s,d]=Va(b),f.upload.addEventListener("progress",s),f.upload.addEventListener("loadend",d)),(o.cancelToken||o.signal)&&(a=e=>{f&&(r(!e||e.type?new $a(null,t,f):e),f.abort(),f=null)},o.cancelToken&&o.cancelToken.subscribe(a),o.signal&&(o.signal.aborted?a():o.signal.addEventListener("abort",a)));const h=function(t){const e=/^([-+\w]{1,25})(:?\/\/|:)/.exec(t);return e&&e[1]||""}(o.url);h&&-1===Ta.protocols.indexOf(h)?r(new sa("Unsupported protocol "+h+":",sa.ERR_BAD_REQUEST,t)):f.send(n||null)}))},Za=(t,e)=>{const{length:r}=t=t?t.filter(Boolean):[];if(e||r){let r,o=new AbortController;const n=function(t){if(!r){r=!0,a();const e=t instanceof Error?t:this.reason;o.abort(e instanceof sa?e:new $a(e instanceof Error?e.message:e))}};let i=e&&setTimeout((()=>{i=null,n(new sa(`timeout ${e} of ms exceeded`,sa.ETIMEDOUT))}),e);const a=()=>{t&&(i&&clearTimeout(i),i=null,t.forEach((t=>{t.unsubscribe?t.unsubscribe(n):t.removeEventListener("abort",n)})),t=null)};t.forEach((t=>t.addEventListener("abort",n)));const{signal:s}=o;return s.unsubscribe=()=>oa.asap(a),s}},ts=function*(t,e){let r=t.byteLength;if(!e||r<e)return void(yield t);let o,n=0;for(;n<r;)o=n+e,yield t.slice(n,o),n=o},es=(t,e,r,o)=>{const n=async function*(t,e){for await(const r of async function*(t){if(t[Symbol.asyncIterator])return void(yield*t);const e=t.getReader();try{for(;;){const{done:t,value:r}=await e.read();if(t)break;yield r}}finally{await e.cancel()}}(t))yield*ts(r,e)}(t,e);let i,a=0,s=t=>{i||(i=!0,o&&o(t))};return new ReadableStream({async pull(t){try{const{done:e,value:o}=await n.next();if(e)return s(),void t.close();let i=o.byteLength;if(r){let t=a+=i;r(t)}t.enqueue(new Uint8Array(o))}catch(t){throw s(t),t}},cancel:t=>(s(t),n.return())},{highWaterMark:2})},rs="function"==typeof fetch&&"function"==typeof Request&&"function"==typeof Response,os=rs&&"function"==typeof ReadableStream,ns=rs&&("function"==typeof TextEncoder?(is=new TextEncoder,t=>is.encode(t)):async t=>new Uint8Array(await new Response(t).arrayBuffer()));var is;const as=(t,...e)=>{try{return!!t(...e)}catch(t){return!1}},ss=os&&as((()=>{let t=!1;const e=new Request(Ta.origin,{body:new ReadableStream,method:"POST",get duplex(){return t=!0,"half"}}).headers.has("Content-Type");return t&&!e})),ls=os&&as((()=>oa.isReadableStream(new Response("").body))),ds={stream:ls&&(t=>t.body)};var cs;rs&&(cs=new Response,["text","arrayBuffer","blob","formData","stream"].forEach((t=>{!ds[t]&&(ds[t]=oa.isFunction(cs[t])?e=>e[t]():(e,r)=>{throw new sa(`Response type '${t}' is not supported`,sa.ERR_NOT_SUPPORT,r)})})));const ps=rs&&(async t=>{let{url:e,method:r,data:o,signal:n,cancelToken:i,timeout:a,onDownloadProgress:s,onUploadProgress:l,responseType:d,headers:c,withCredentials:p="same-origin",fetchOptions:b}=Ja(t);d=d?(d+"").toLowerCase():"text";let m,g=Za([n,i&&i.toAbortSignal()],a);const f=g&&g.unsubscribe&&(()=>{g.unsubscribe()});let u;try{if(l&&ss&&"get"!==r&&"head"!==r&&0!==(u=await(async(t,e)=>{const r=oa.toFiniteNumber(t.getContentLength());return null==r?(async t=>{if(null==t)return 0;if(oa.isBlob(t))return t.size;if(oa.isSpecCompliantForm(t)){const e=new Request(Ta.origin,{method:"POST",body:t});return(await e.arrayBuffer()).byteLength}return oa.isArrayBufferView(t)||oa.isArrayBuffer(t)?t.byteLength:(oa.isURLSearchParams(t)&&(t+=""),oa.isString(t)?(await ns(t)).byteLength:void 0)})(e):r})(c,o))){let t,r=new Request(e,{method:"POST",body:o,duplex:"half"});if(oa.isFormData(o)&&(t=r.headers.get("content-type"))&&c.setContentType(t),r.body){const[t,e]=Wa(u,Va(Ha(l)));o=es(r.body,65536,t,e)}}oa.isString(p)||(p=p?"include":"omit");const n="credentials"in Request.prototype;m=new Request(e,{...b,signal:g,method:r.toUpperCase(),headers:c.normalize().toJSON(),body:o,duplex:"half",credentials:n?p:void 0});let i=await fetch(m);const a=ls&&("stream"===d||"response"===d);if(ls&&(s||a&&f)){const t={};["status","statusText","headers"].forEach((e=>{t[e]=i[e]}));const e=oa.toFiniteNumber(i.headers.get("content-length")),[r,o]=s&&Wa(e,Va(Ha(s),!0))||[];i=new Response(es(i.body,65536,r,(()=>{o&&o(),f&&f()})),t)}d=d||"text";let h=await ds[oa.findKey(ds,d)||"text"](i,t);return!a&&f&&f(),await new Promise(((e,r)=>{Ua(e,r,{data:h,headers:Na.from(i.headers),status:i.status,statusText:i.statusText,config:t,request:m})}))}catch(e){if(f&&f(),e&&"TypeError"===e.name&&/fetch/i.test(e.message))throw Object.assign(new sa("Network Error",sa.ERR_NETWORK,t,m),{cause:e.cause||e});throw sa.from(e,e&&e.code,t,m)}}),bs={http:null,xhr:Qa,fetch:ps};oa.forEach(bs,((t,e)=>{if(t){try{Object.defineProperty(t,"name",{value:e})}catch(t){}Object.defineProperty(t,"adapterName",{value:e})}}));const ms=t=>`- ${t}`,gs=t=>oa.isFunction(t)||null===t||!1===t,fs=t=>{t=oa.isArray(t)?t:[t];const{length:e}=t;let r,o;const n={};for(let i=0;i<e;i++){let e;if(r=t[i],o=r,!gs(r)&&(o=bs[(e=String(r)).toLowerCase()],void 0===o))throw new sa(`Unknown adapter '${e}'`);if(o)break;n[e||"#"+i]=o}if(!o){const t=Object.entries(n).map((([t,e])=>`adapter ${t} `+(!1===e?"is not supported by the environment":"is not available in the build")));let r=e?t.length>1?"since :\n"+t.map(ms).join("\n"):" "+ms(t[0]):"as no adapter specified";throw new sa("There is no suitable adapter to dispatch the request "+r,"ERR_NOT_SUPPORT")}return o};function us(t){if(t.cancelToken&&t.cancelToken.throwIfRequested(),t.signal&&t.signal.aborted)throw new $a(null,t)}function hs(t){return us(t),t.headers=Na.from(t.headers),t.data=Ia.call(t,t.transformRequest),-1!==["post","put","patch"].indexOf(t.method)&&t.headers.setContentType("application/x-www-form-urlencoded",!1),fs(t.adapter||ja.adapter)(t).then((function(e){return us(t),e.data=Ia.call(t,t.transformResponse,e),e.headers=Na.from(e.headers),e}),(function(e){return Ba(e)||(us(t),e&&e.response&&(e.response.data=Ia.call(t,t.transformResponse,e.response),e.response.headers=Na.from(e.response.headers))),Promise.reject(e)}))}const vs={};["object","boolean","number","function","string","symbol"].forEach(((t,e)=>{vs[t]=function(r){return typeof r===t||"a"+(e<1?"n ":" ")+t}}));const xs={};vs.transitional=function(t,e,r){function o(t,e){return"[Axios v1.7.7] Transitional option '"+t+"'"+e+(r?". "+r:"")}return(r,n,i)=>{if(!1===t)throw new sa(o(n," has been removed"+(e?" in "+e:"")),sa.ERR_DEPRECATED);return e&&!xs[n]&&(xs[n]=!0,console.warn(o(n," has been deprecated since v"+e+" and will be removed in the near future"))),!t||t(r,n,i)}};const ws={assertOptions:function(t,e,r){if("object"!=typeof t)throw new sa("options must be an object",sa.ERR_BAD_OPTION_VALUE);const o=Object.keys(t);let n=o.length;for(;n-- >0;){const i=o[n],a=e[i];if(a){const e=t[i],r=void 0===e||a(e,i,t);if(!0!==r)throw new sa("option "+i+" must be "+r,sa.ERR_BAD_OPTION_VALUE)}else if(!0!==r)throw new sa("Unknown option "+i,sa.ERR_BAD_OPTION)}},validators:vs},ys=ws.validators;class _s{constructor(t){this.defaults=t,this.interceptors={request:new xa,response:new xa}}async request(t,e){try{return await this._request(t,e)}catch(t){if(t instanceof Error){let e;Error.captureStackTrace?Error.captureStackTrace(e={}):e=new Error;const r=e.stack?e.stack.replace(/^.+\n/,""):"";try{t.stack?r&&!String(t.stack).endsWith(r.replace(/^.+\n.+\n/,""))&&(t.stack+="\n"+r):t.stack=r}catch(t){}}throw t}}_request(t,e){"string"==typeof t?(e=e||{}).url=t:e=t||{},e=Ya(this.defaults,e);const{transitional:r,paramsSerializer:o,headers:n}=e;void 0!==r&&ws.assertOptions(r,{silentJSONParsing:ys.transitional(ys.boolean),forcedJSONParsing:ys.transitional(ys.boolean),clarifyTimeoutError:ys.transitional(ys.boolean)},!1),null!=o&&(oa.isFunction(o)?e.paramsSerializer={serialize:o}:ws.assertOptions(o,{encode:ys.function,serialize:ys.function},!0)),e.method=(e.method||this.defaults.method||"get").toLowerCase();let i=n&&oa.merge(n.common,n[e.method]);n&&oa.forEach(["delete","get","head","post","put","patch","common"],(t=>{delete n[t]})),e.headers=Na.concat(i,n);const a=[];let s=!0;this.interceptors.request.forEach((function(t){"function"==typeof t.runWhen&&!1===t.runWhen(e)||(s=s&&t.synchronous,a.unshift(t.fulfilled,t.rejected))}));const l=[];let d;this.interceptors.response.forEach((function(t){l.push(t.fulfilled,t.rejected)}));let c,p=0;if(!s){const t=[hs.bind(this),void 0];for(t.unshift.apply(t,a),t.push.apply(t,l),c=t.length,d=Promise.resolve(e);p<c;)d=d.then(t[p++],t[p++]);return d}c=a.length;let b=e;for(p=0;p<c;){const t=a[p++],e=a[p++];try{b=t(b)}catch(t){e.call(this,t);break}}try{d=hs.call(this,b)}catch(t){return Promise.reject(t)}for(p=0,c=l.length;p<c;)d=d.then(l[p++],l[p++]);return d}getUri(t){return va(Ka((t=Ya(this.defaults,t)).baseURL,t.url),t.params,t.paramsSerializer)}}oa.forEach(["delete","get","head","options"],(function(t){_s.prototype[t]=function(e,r){return this.request(Ya(r||{},{method:t,url:e,data:(r||{}).data}))}})),oa.forEach(["post","put","patch"],(function(t){function e(e){return function(r,o,n){return this.request(Ya(n||{},{method:t,headers:e?{"Content-Type":"multipart/form-data"}:{},url:r,data:o}))}}_s.prototype[t]=e(),_s.prototype[t+"Form"]=e(!0)}));const ks=_s;class Es{constructor(t){if("function"!=typeof t)throw new TypeError("executor must be a function.");let e;this.promise=new Promise((function(t){e=t}));const r=this;this.promise.then((t=>{if(!r._listeners)return;let e=r._listeners.length;for(;e-- >0;)r._listeners[e](t);r._listeners=null})),this.promise.then=t=>{let e;const o=new Promise((t=>{r.subscribe(t),e=t})).then(t);return o.cancel=function(){r.unsubscribe(e)},o},t((function(t,o,n){r.reason||(r.reason=new $a(t,o,n),e(r.reason))}))}throwIfRequested(){if(this.reason)throw this.reason}subscribe(t){this.reason?t(this.reason):this._listeners?this._listeners.push(t):this._listeners=[t]}unsubscribe(t){if(!this._listeners)return;const e=this._listeners.indexOf(t);-1!==e&&this._listeners.splice(e,1)}toAbortSignal(){const t=new AbortController,e=e=>{t.abort(e)};return this.subscribe(e),t.signal.unsubscribe=()=>this.unsubscribe(e),t.signal}static source(){let t;return{token:new Es((function(e){t=e})),cancel:t}}}const As=Es,Ss={Continue:100,SwitchingProtocols:101,Processing:102,EarlyHints:103,Ok:200,Created:201,Accepted:202,NonAuthoritativeInformation:203,NoContent:204,ResetContent:205,PartialContent:206,MultiStatus:207,AlreadyReported:208,ImUsed:226,MultipleChoices:300,MovedPermanently:301,Found:302,SeeOther:303,NotModified:304,UseProxy:305,Unused:306,TemporaryRedirect:307,PermanentRedirect:308,BadRequest:400,Unauthorized:401,PaymentRequired:402,Forbidden:403,NotFound:404,MethodNotAllowed:405,NotAcceptable:406,ProxyAuthenticationRequired:407,RequestTimeout:408,Conflict:409,Gone:410,LengthRequired:411,PreconditionFailed:412,PayloadTooLarge:413,UriTooLong:414,UnsupportedMediaType:415,RangeNotSatisfiable:416,ExpectationFailed:417,ImATeapot:418,MisdirectedRequest:421,UnprocessableEntity:422,Locked:423,FailedDependency:424,TooEarly:425,UpgradeRequired:426,PreconditionRequired:428,TooManyRequests:429,RequestHeaderFieldsTooLarge:431,UnavailableForLegalReasons:451,InternalServerError:500,NotImplemented:501,BadGateway:502,ServiceUnavailable:503,GatewayTimeout:504,HttpVersionNotSupported:505,VariantAlsoNegotiates:506,InsufficientStorage:507,LoopDetected:508,NotExtended:510,NetworkAuthenticationRequired:511};Object.entries(Ss).forEach((([t,e])=>{Ss[e]=t}));const Ts=Ss,Os=function t(e){const r=new ks(e),o=mi(ks.prototype.request,r);return oa.extend(o,ks.prototype,r,{allOwnKeys:!0}),oa.extend(o,r,null,{allOwnKeys:!0}),o.create=function(r){return t(Ya(e,r))},o}(ja);Os.Axios=ks,Os.CanceledError=$a,Os.CancelToken=As,Os.isCancel=Ba,Os.VERSION="1.7.7",Os.toFormData=ba,Os.AxiosError=sa,Os.Cancel=Os.CanceledError,Os.all=function(t){return Promise.all(t)},Os.spread=function(t){return function(e){return t.apply(null,e)}},Os.isAxiosError=function(t){return oa.isObject(t)&&!0===t.isAxiosError},Os.mergeConfig=Ya,Os.AxiosHeaders=Na,Os.formToJSON=t=>Oa(oa.isHTMLForm(t)?new FormData(t):t),Os.getAdapter=fs,Os.HttpStatusCode=Ts,Os.default=Os;const Cs=Os,js={class:"d-grid gap-2 d-md-block mb-4"},zs={class:"position-fixed top-0 end-0 p-3",style:{"z-index":"11"}},Ls={class:"toast-body"},Rs={props:{show:{type:Boolean,required:!0},message:{type:String,required:!0},bgClass:{type:String,default:"text-bg-primary"}},methods:{closeToast(){this.$emit("close")}}};var Ps=r(262);const Ds=(0,Ps.A)(Rs,[["render",function(t,e,r,o,n,i){return Fo(),Wo("div",zs,[r.show?(Fo(),Wo("div",{key:0,class:q(["toast fade show",r.bgClass]),role:"alert","aria-live":"assertive","aria-atomic":"true"},[Xo("div",Ls,Q(r.message),1)],2)):Zo("v-if",!0)])}]]),Ms={components:{Notification:Ds},props:{status:{type:Object,required:!0},eventsConnected:{type:Boolean,default:!1},finishedCommand:{type:Object,default:null}},data:()=>({showToast:!1,toastMessage:"",bgClass:"",pendingCommands:{}}),watch:{finishedCommand(t){const e=t&&this.pendingCommands[t.id];e&&(delete this.pendingCommands[t.id],this.commandFinished(t.status,e))}},methods:{async sendAction(t){try{const e=await Cs.post(t);if(200!==e.status&&202!==e.status)throw new Error("Non-OK response");this.toastMessage=`Action sent to ${t} successfully!`,this.bgClass="text-bg-success",e.data&&e.data.id&&this.eventsConnected?this.awaitCommandEvent(e.data.id,t):e.data&&e.data.id?this.waitForCommand(e.data.id,t):setTimeout((()=>{this.$emit("button-pressed")}),500)}catch(e){this.toastMessage=`Error sending action to ${t}.`,this.bgClass="text-bg-danger"}finally{this.showToast=!0,setTimeout((()=>{this.showToast=!1}),8e3)}},awaitCommandEvent(t,e){this.pendingCommands[t]=e,setTimeout((()=>{this.pendingCommands[t]&&(delete this.pendingCommands[t],this.waitForCommand(t,e))}),15e3)},async waitForCommand(t,e,r=0){try{const o=(await Cs.get(`/commands/${t}`)).data.status;if("queued"===o||"running"===o)return void(r<30&&setTimeout((()=>this.waitForCommand(t,e,r+1)),500));return void this.commandFinished(o,e)}catch(t){console.error("Error fetching command status:",t)}this.$emit("button-pressed")},commandFinished(t,e){"failed"===t&&(this.toastMessage=`Action ${e} failed on the mower.`,this.bgClass="text-bg-danger",this.showToast=!0),this.$emit("button-pressed")}}};r(648);const Ns=(0,Ps.A)(Ms,[["render",function(t,e,r,o,n,i){const a=Sr("Notification");return Fo(),Wo("div",null,[Xo("div",js,[Xo("button",{class:"btn btn-primary mx-1",onClick:e[0]||(e[0]=t=>i.sendAction("/start"))},"Start"),Xo("button",{class:"btn btn-secondary mx-1",onClick:e[1]||(e[1]=t=>i.sendAction("/home"))},"Home"),Xo("button",{class:"btn btn-danger mx-1",onClick:e[2]||(e[2]=t=>i.sendAction("/stop"))},"Stop"),r.status.isIdle?Zo("v-if",!0):(Fo(),Wo(Po,{key:0},[r.status.isLocked?(Fo(),Wo("button",{key:0,class:"btn btn-info mx-1",onClick:e[3]||(e[3]=t=>i.sendAction("/unlock"))},"Unlock")):(Fo(),Wo("button",{key:1,class:"btn btn-warning mx-1",onClick:e[4]||(e[4]=t=>i.sendAction("/lock"))},"Lock"))],64))]),Zo(" Toast Notification "),Yo(a,{show:n.showToast,message:n.toastMessage,bgClass:n.bgClass,onClose:e[5]||(e[5]=t=>n.showToast=!1)},null,8,["show","message","bgClass"])])}],["__scopeId","data-v-aece0ea4"]]),Is={class:"status mb-4"},Bs={key:0,class:"badge rounded-pill text-bg-primary mx-1"},Fs={key:1,class:"badge rounded-pill text-bg-dark mx-1"},$s={key:2,class:"badge rounded-pill text-bg-danger mx-1"},Us={key:3,class:"badge rounded-pill text-bg-warning mx-1"},Vs={key:1,class:"badge rounded-pill text-bg-info mx-1"},Ws={props:{status:{type:Object,required:!0}}};r(254);const Hs=(0,Ps.A)(Ws,[["render",function(t,e,r,o,n,i){return Fo(),Wo("div",Is,[r.status.isIdle?(Fo(),Wo("span",Vs,"Idle")):(Fo(),Wo(Po,{key:0},[r.status.isCharging?(Fo(),Wo("span",Bs,"In docking station")):(Fo(),Wo("span",Fs,"Outside docking station")),r.status.isEmergency?(Fo(),Wo("span",$s,"Emergency")):Zo("v-if",!0),r.status.isLocked?(Fo(),Wo("span",Us,"Locked")):Zo("v-if",!0)],64))])}],["__scopeId","data-v-3175ef1e"]]),qs={class:"accordion mb-3"},Gs={class:"accordion-item"},Ks={id:"accordion-content-mowing-plan",class:"accordion-collapse collapse"},Xs={class:"accordion-body"},Ys={class:"form-check form-switch mb-3",style:{display:"inline-block"}},Js={key:0,class:"custom-mowing-plan"},Qs={class:"custom-mowing-plan-days mb-3"},Zs=["id","onUpdate:modelValue"],tl=["for"],el={class:"custom-mowing-plan-time"},rl={class:"row justify-content-center"},ol={class:"col-6 col-xl-4"},nl={class:"form-floating mb-3"},il={class:"col-6 col-xl-4"},al={class:"form-floating mb-3"},sl={class:"mb-3",style:{"font-size":"0.7em"}},ll={key:0,class:"text-danger"},dl={key:1,class:"text-muted"},cl={key:1,class:"text-end"},pl={props:{currentDate:String,currentTime:String,currentMowingPlanStatusActive:Boolean},components:{Notification:Ds},data:()=>({isMowingPlanActive:!1,selectedDays:[!1,!1,!1,!1,!1,!1,!1],days:["Mon","Tue","Wed","Thu","Fri","Sat","Sun"],windows:[[],[],[],[],[],[],[]],maxWindowsPerDay:4,showToast:!1,toastMessage:"",bgClass:""}),methods:{toggleMowingPlan(){this.isMowingPlanActive},addWindow(t){this.windows[t].push({start:"",end:""})},removeWindow(t,e){this.windows[t].splice(e,1)},copyWindowsToAllDays(t){const e=this.windows[t];this.windows=this.windows.map((()=>e.map((t=>({...t})))))},async saveMowingPlan(){const t={customMowingPlanActive:this.isMowingPlanActive,days:this.selectedDays,windows:this.windows.map((t=>t.filter((t=>t.start&&t.end))))};try{await Cs.post("/mowing-plan",t,{headers:{"Content-Type":"application/json"}}),this.toastMessage="Mowing plan saved successfully!",this.bgClass="text-bg-success",this.showToast=!0,this.$emit("plan-saved"),setTimeout((()=>{this.showToast=!1}),8e3)}catch(t){this.toastMessage="Error saving mowing plan!",this.bgClass="text-bg-error",this.showToast=!0,setTimeout((()=>{this.showToast=!1}),8e3)}},async fetchMowingPlan(){try{const t=await Cs.get("/mowing-plan");if(!t.data)return void console.log("No mowing plan found");const{customMowingPlanActive:e,days:r,windows:o,startTime:n,endTime:i}=t.data;this.isMowingPlanActive=e,this.selectedDays=r,o?this.windows=o.map((t=>t.map((t=>({...t}))))):n&&i&&(this.windows=this.days.map((()=>[{start:n,end:i}]))),console.log("Fetched Mowing Plan:",t.data)}catch(t){this.toastMessage="Error fetching mowing plan",this.bgClass="text-bg-error",this.showToast=!0,setTimeout((()=>{this.showToast=!1}),8e3)}},showNotification(t,e){this.notification={message:t,type:e},setTimeout((()=>{this.notification=null}),3e3)}},mounted(){this.fetchMowingPlan()}},bl=(0,Ps.A)(pl,[["render",function(t,e,r,o,n,i){const a=Sr("Notification");return Yo("div",qs,[Yo("div",Gs,[Yo("h2",{class:"accordion-header"},[Yo("button",{class:"accordion-button collapsed",type:"button","data-bs-toggle":"collapse","aria-expanded":"false","aria-controls":"accordion-content-mowing-plan","data-bs-target":"#accordion-content-mowing-plan"}," Mowing Plan ")]),Yo("div",Ks,[Yo("div",Xs,[Yo("form",{onSubmit:e[0]||(e[0]=oi(((...t)=>i.saveMowingPlan&&i.saveMowingPlan(...t)),["prevent"])),autocomplete:"off"},[Yo("p",{class:"text-muted",style:{"font-size":"0.7em"}},[Qo(" For manual starts only, activate the following field, without selecting days below."),Yo("br"),Qo(" If deactivated, the mower will mow according to it's original schedule. ")]),Yo("div",Ys,[er(Yo("input",{class:"form-check-input",type:"checkbox",role:"switch",id:"custom-mowing-plan-active","onUpdate:modelValue":e[1]||(e[1]=t=>n.isMowingPlanActive=t),onChange:e[2]||(e[2]=(...t)=>i.toggleMowingPlan&&i.toggleMowingPlan(...t)),value:"1"}),[[Qn,n.isMowingPlanActive]]),Yo("label",{class:"form-check-label",for:"custom-mowing-plan-active"}," Activate custom mowing plan ")]),n.isMowingPlanActive?Yo("div",Js,[Yo("div",Qs,n.days.map(((t,e)=>Yo(Po,{key:e},[er(Yo("input",{type:"checkbox",class:"btn-check",id:"btn-check-day-"+t.toLowerCase(),"onUpdate:modelValue":t=>n.selectedDays[e]=t,autocomplete:"off",value:1}),[[Qn,n.selectedDays[e]]]),Yo("label",{class:"btn btn-sm mx-1",for:"btn-check-day-"+t.toLowerCase()},Q(t))])))),Yo("div",el,[...n.days.map(((t,e)=>Yo(Po,{key:"windows-"+e},[n.selectedDays[e]?Yo("div",{class:"row justify-content-center align-items-center mb-2"},[Yo("div",{class:"col-12 col-xl-2 text-start text-xl-end"},[Yo("b",null,Q(t))]),Yo("div",{class:"col-12 col-xl-10"},[...n.windows[e].map(((r,o)=>Yo("div",{key:o,class:"row g-2 mb-1 align-items-center"},[Yo("div",{class:"col-5"},[er(Yo("input",{type:"time",class:"form-control form-control-sm","aria-label":t+" start","onUpdate:modelValue":t=>r.start=t}),[[Jn,r.start]])]),Yo("div",{class:"col-5"},[er(Yo("input",{type:"time",class:"form-control form-control-sm","aria-label":t+" end","onUpdate:modelValue":t=>r.end=t}),[[Jn,r.end]])]),Yo("div",{class:"col-2"},[Yo("button",{type:"button",class:"btn btn-outline-secondary btn-sm",onClick:t=>i.removeWindow(e,o)},"×")])]))),Yo("div",{class:"text-start"},[Yo("button",{type:"button",class:"btn btn-link btn-sm p-0 me-3",disabled:n.windows[e].length>=n.maxWindowsPerDay,onClick:t=>i.addWindow(e)},"Add time slot"),Yo("button",{type:"button",class:"btn btn-link btn-sm p-0",onClick:t=>i.copyWindowsToAllDays(e)},"Use for all days")])])]):Zo("v-if",!0)]))),Yo("div",sl,[Zo(" show little warning, if {{ currentDate }} {{ currentTime }} are unset, otherwise show date/time "),r.currentDate&&r.currentTime?Yo("span",dl,"Date: "+Q(r.currentDate)+", Time: "+Q(r.currentTime)):Yo("span",ll,"Date and time are not set on the mower currently. Mowing Plan will not be active.")])]),Yo("div",{class:"text-end"},[Yo("button",{type:"submit",class:"btn btn-outline-primary btn-sm"},"Save Mowing Plan")])]):Zo("v-if",!0),!n.isMowingPlanActive&&r.currentMowingPlanStatusActive?Yo("div",cl,[Yo("button",{type:"button",class:"btn btn-outline-warning btn-sm",onClick:e[3]||(e[3]=(...t)=>i.saveMowingPlan&&i.saveMowingPlan(...t))}," Deactivate Mowing Plan on Mower ")]):Zo("v-if",!0)]),Yo(a,{show:n.showToast,message:n.toastMessage,bgClass:n.bgClass,onClose:e[4]||(e[4]=t=>n.showToast=!1)})])])])])}]]),ml={class:"accordion mb-3"},gl={class:"accordion-item"},fl={class:"accordion-header"},ul={id:"accordion-content-wifi-setup",class:"accordion-collapse collapse"},hl={class:"accordion-body"},vl={class:"text-muted",style:{"font-size":"0.7em"}},xl={key:0},wl={class:"text-danger",style:{"font-size":"0.7em"}},yl=["href"],_l={class:"row"},kl={class:"col-xl-6"},El={class:"form-floating mb-3"},Al={id:"wifiOptions"},Sl=["value"],Tl={class:"col-xl-6"},Ol={class:"form-floating mb-3"},Cl={class:"d-flex justify-content-between align-items-center"},jl=["disabled"],zl={key:0,class:"spinner-border spinner-border-sm","aria-hidden":"true"},Ll={components:{Notification:Ds},props:{currentSSID:String,currentIP:String,hostname:String,isAccessPoint:Boolean},data:()=>({ssid:"",password:"",wifiOptions:[],showToast:!1,toastMessage:"",bgClass:"",isLoading:!1,refreshWifisTimer:null}),methods:{async setWifi(){try{await Cs.post("/wifi",{ssid:this.ssid,password:this.password}),this.toastMessage="Wifi settings saved successfully!",this.bgClass="text-bg-success",this.showToast=!0,setTimeout((()=>{this.showToast=!1}),8e3)}catch(t){this.toastMessage="Error saving Wifi settings. Please try again.",this.bgClass="bg-danger",this.showToast=!0,setTimeout((()=>{this.showToast=!1}),8e3)}},wifiLabel:t=>t.ssid+" ("+t.rssi+" dBm"+("open"!==t.auth?" 🔒":"")+")",async fetchWifis(){const t=await Cs.get("/wifis");this.wifiOptions=t.data},async searchWifis(){this.isLoading=!0;try{await this.fetchWifis()}catch(t){this.toastMessage="Error fetching Wifi networks.",this.bgClass="bg-danger",this.showToast=!0,setTimeout((()=>{this.showToast=!1}),8e3)}finally{this.isLoading=!1}},startAutoRefresh(){this.searchWifis(),this.refreshWifisTimer=setInterval((()=>this.fetchWifis().catch((()=>{}))),5e3)},stopAutoRefresh(){clearInterval(this.refreshWifisTimer)}},mounted(){const t=document.getElementById("accordion-content-wifi-setup");t&&(t.addEventListener("shown.bs.collapse",this.startAutoRefresh),t.addEventListener("hidden.bs.collapse",this.stopAutoRefresh))},beforeDestroy(){const t=document.getElementById("accordion-content-wifi-setup");t&&(t.removeEventListener("shown.bs.collapse",this.startAutoRefresh),t.removeEventListener("hidden.bs.collapse",this.stopAutoRefresh)),clearInterval(this.refreshWifisTimer)}},Rl=(0,Ps.A)(Ll,[["render",function(t,e,r,o,n,i){const a=Sr("Notification");return Fo(),Wo("div",ml,[Xo("div",gl,[Xo("h2",fl,[Xo("button",{class:"accordion-button collapsed",type:"button","data-bs-toggle":"collapse","aria-expanded":"false","aria-controls":"accordion-content-wifi-setup","data-bs-target":"#accordion-content-wifi-setup"}," Wifi-Setup ")]),Xo("div",ul,[Xo("div",hl,[Xo("p",vl,[e[6]||(e[6]=Qo("If no Wifi entered, or connection can't be established, an Access Point will be created.")),e[7]||(e[7]=Xo("br",null,null,-1)),e[8]||(e[8]=Qo(" Current wifi: ")),Xo("i",null,Q(r.currentSSID),1),e[9]||(e[9]=Qo(" with IP ")),Xo("i",null,Q(r.currentIP),1),e[10]||(e[10]=Qo(" and hostname ")),Xo("i",null,Q(r.hostname),1),e[11]||(e[11]=Xo("br",null,null,-1)),Zo(" if isAccessPoint: show info that it is access point mode "),r.isAccessPoint?(Fo(),Wo("span",xl,"(📡 Access Point Mode)")):Zo("v-if",!0)]),Xo("p",wl,[e[12]||(e[12]=Qo("After saving a Wifi-Connection, the mower interface will reboot and try to connect to the new Wifi. In the new Wifi it might be available ")),Xo("a",{target:"_blank",href:"http://"+r.hostname+".local"},"here",8,yl),e[13]||(e[13]=Qo(". If not, you might need to find out the ip address manually!"))]),Xo("form",{onSubmit:e[4]||(e[4]=oi(((...t)=>i.setWifi&&i.setWifi(...t)),["prevent"]))},[Xo("div",_l,[Xo("div",kl,[Xo("div",El,[er(Xo("input",{autocomplete:"off",class:"form-control",list:"wifiOptions",id:"ssid","onUpdate:modelValue":e[1]||(e[1]=t=>n.ssid=t),placeholder:"Wifi SSID"},null,512),[[Jn,n.ssid]]),e[14]||(e[14]=Xo("label",{for:"ssid"},"Connect to Wifi SSID..",-1)),Xo("datalist",Al,[(Fo(!0),Wo(Po,null,Cr(n.wifiOptions,(t=>(Fo(),Wo("option",{key:t.ssid,value:t.ssid},Q(i.wifiLabel(t)),9,Sl)))),128))])])]),Xo("div",Tl,[Xo("div",Ol,[er(Xo("input",{autocomplete:"off",type:"password",class:"form-control",id:"password","onUpdate:modelValue":e[2]||(e[2]=t=>n.password=t),placeholder:"Wifi password"},null,512),[[Jn,n.password]]),e[15]||(e[15]=Xo("label",{for:"password"},"Wifi password",-1))])])]),Zo(" Search Button & Spinner "),Xo("div",Cl,[Xo("div",null,[Xo("button",{type:"button",class:"btn btn-outline-secondary btn-sm",onClick:e[3]||(e[3]=(...t)=>i.searchWifis&&i.searchWifis(...t)),disabled:n.isLoading},[n.isLoading?(Fo(),Wo("span",zl)):Zo("v-if",!0),e[16]||(e[16]=Qo(" Search for Wireless LANs "))],8,jl)]),e[17]||(e[17]=Xo("button",{type:"submit",class:"btn btn-outline-primary btn-sm"},"Save Wifi",-1))])],32),Yo(a,{show:n.showToast,message:n.toastMessage,bgClass:n.bgClass,onClose:e[5]||(e[5]=t=>n.showToast=!1)},null,8,["show","message","bgClass"])])])])])}]]),Pl={class:"accordion mb-3"},Dl={class:"accordion-item"},Ml={id:"accordion-content-time-setup",class:"accordion-collapse collapse"},Nl={class:"accordion-body"},Il={class:"row justify-content-center"},Bl={class:"col-6 col-xl-4"},Fl={class:"form-floating mb-3"},$l={class:"col-6 col-xl-4"},Ul={class:"form-floating mb-3"},Vl={components:{Notification:Ds},data:()=>({date:"",time:"",timer:null,showToast:!1,toastMessage:"",bgClass:"text-bg-primary"}),mounted(){this.setCurrentDateTime(),this.startTimer()},beforeDestroy(){clearInterval(this.timer)},methods:{setCurrentDateTime(){const t=new Date;this.date=t.toISOString().split("T")[0],this.time=t.toTimeString().split(":").slice(0,2).join(":")},startTimer(){this.timer=setInterval((()=>{this.setCurrentDateTime()}),6e4)},saveTime(){Cs.post("/date-time",{date:this.date,time:this.time}).then((t=>{this.toastMessage="Time saved successfully!",this.showToast=!0,this.bgClass="text-bg-success",setTimeout((()=>{this.showToast=!1}),8e3),this.$emit("time-saved")})).catch((t=>{this.toastMessage="Error saving time. Please try again.",this.showToast=!0,this.bgClass="text-bg-danger",setTimeout((()=>{this.showToast=!1}),8e3),console.error("Error saving time:",t)}))}}},Wl=(0,Ps.A)(Vl,[["render",function(t,e,r,o,n,i){const a=Sr("Notification");return Fo(),Wo("div",Pl,[Xo("div",Dl,[e[8]||(e[8]=Xo("h2",{class:"accordion-header"},[Xo("button",{class:"accordion-button collapsed",type:"button","data-bs-toggle":"collapse","aria-expanded":"false","aria-controls":"accordion-content-time-setup","data-bs-target":"#accordion-content-time-setup"}," Time & Date-Setup ")],-1)),Xo("div",Ml,[Xo("div",Nl,[e[7]||(e[7]=Xo("p",{class:"text-muted",style:{"font-size":"0.7em"}}," With internet connection, UTC is set automatically. Here you can adjust to your timezone or set Date & Time in Access Point Mode. After Mower complete shutdown, time will be reset. ",-1)),Xo("form",{onSubmit:e[2]||(e[2]=oi(((...t)=>i.saveTime&&i.saveTime(...t)),["prevent"]))},[Xo("div",Il,[Xo("div",Bl,[Xo("div",Fl,[er(Xo("input",{type:"date","onUpdate:modelValue":e[0]||(e[0]=t=>n.date=t),class:"form-control"},null,512),[[Jn,n.date]]),e[4]||(e[4]=Xo("label",{for:"date",class:"form-label"},"Set current date",-1))])]),Xo("div",$l,[Xo("div",Ul,[er(Xo("input",{type:"time","onUpdate:modelValue":e[1]||(e[1]=t=>n.time=t),class:"form-control"},null,512),[[Jn,n.time]]),e[5]||(e[5]=Xo("label",{for:"time",class:"form-label"},"Set current time",-1))])])]),e[6]||(e[6]=Xo("div",{class:"text-end"},[Xo("button",{type:"submit",class:"btn btn-sm btn-outline-primary"},"Save date and time")],-1))],32),Zo(" Toast Notification "),Yo(a,{show:n.showToast,message:n.toastMessage,bgClass:n.bgClass,onClose:e[3]||(e[3]=t=>n.showToast=!1)},null,8,["show","message","bgClass"])])])])])}]]),Hl={class:"accordion mb-3"},ql={class:"accordion-item"},Gl={id:"accordion-content-logs",class:"accordion-collapse collapse"},Kl={class:"accordion-body"},Xl={data:()=>({logMessages:"",logCursor:null,loadingLogs:!1,autoRefresh:!0,refreshLogsTimer:null}),methods:{refreshLogMessages(){this.loadingLogs||(this.loadingLogs=!0,Cs.get("/log-messages",{params:{since:this.logCursor},responseType:"text"}).then((t=>{t.headers["x-log-reset"]&&(this.logMessages=""),this.logMessages+=t.data,this.logMessages.length>1e5&&(this.logMessages=this.logMessages.slice(this.logMessages.indexOf("\n",this.logMessages.length-1e5)+1)),this.logCursor=Number(t.headers["x-log-cursor"])||0,this.loadingLogs=!1,t.headers["x-log-more"]?this.refreshLogMessages():this.$nextTick((()=>{const t=this.$el.querySelector("textarea");t.scrollTop=t.scrollHeight}))})).catch((t=>{this.loadingLogs=!1,console.error("Error fetching log messages:",t)})))},startAutoRefresh(){console.log("Starting refresh..."),this.autoRefresh&&(this.refreshLogMessages(),this.refreshLogsTimer=setInterval(this.refreshLogMessages,5e3))},stopAutoRefresh(){console.log("Stopping refresh..."),clearInterval(this.refreshLogsTimer)}},mounted(){const t=document.getElementById("accordion-content-logs");t&&(t.addEventListener("shown.bs.collapse",this.startAutoRefresh),t.addEventListener("hidden.bs.collapse",this.stopAutoRefresh)),t&&t.classList.contains("show")&&this.startAutoRefresh()},beforeDestroy(){const t=document.getElementById("accordion-content-logs");t&&(t.removeEventListener("shown.bs.collapse",this.startAutoRefresh),t.removeEventListener("hidden.bs.collapse",this.stopAutoRefresh)),this.stopAutoRefresh()}},Yl=(0,Ps.A)(Xl,[["render",function(t,e,r,o,n,i){return Fo(),Wo("div",Hl,[Xo("div",ql,[e[2]||(e[2]=Xo("h2",{class:"accordion-header"},[Xo("button",{class:"accordion-button collapsed",type:"button","data-bs-toggle":"collapse","aria-expanded":"false","aria-controls":"accordion-content-logs","data-bs-target":"#accordion-content-logs"}," Logs & Debugging ")],-1)),Xo("div",Gl,[Xo("div",Kl,[Xo("form",{onSubmit:e[1]||(e[1]=oi((()=>{}),["prevent"]))},[er(Xo("textarea",{"onUpdate:modelValue":e[0]||(e[0]=t=>n.logMessages=t),class:"w-100",rows:"14",readonly:"",style:{"white-space":"pre",overflow:"auto","font-size":"0.75em","font-family":"Courier New, monospace"},wrap:"off"},null,512),[[Jn,n.logMessages]])],32)])])])])}]]),Jl={class:"accordion mb-3"},Ql={class:"accordion-item"},Zl={id:"accordion-content-update",class:"accordion-collapse collapse"},td={class:"accordion-body"},ed={class:"mb-3 text-start"},rd={class:"mb-3 text-start"},od={class:"text-end"},nd=["disabled"],id={key:0,class:"spinner-border spinner-border-sm","aria-hidden":"true"},ad={key:1,class:"alert alert-info mt-3",role:"alert"},cu=(t,e)=>{const r=t.name.match(/\.(gz|hs)$/);return r?e+r[0]:e},sd={props:["updateProgress"],data:()=>({firmwareFile:null,filesystemFile:null,firmwareSha256:"",filesystemSha256:"",uploadStatus:"",uploadedPercent:0,isLoading:!1}),computed:{progressText(){const t=this.updateProgress;if(!t||"writing"!==t.status)return this.uploadedPercent?`Uploaded ${this.uploadedPercent} %`:"";const e=t.total?Math.round(100*t.received/t.total):0;return`Writing ${t.target}: ${e} % received, ${Math.round(t.written/1024)} KB written`}},methods:{onFirmwareFileChange(t){this.firmwareFile=t.target.files[0]},onFilesystemFileChange(t){this.filesystemFile=t.target.files[0]},async uploadFiles(){if(!this.firmwareFile&&!this.filesystemFile)return void(this.uploadStatus="Please choose at least one file.");const t=new FormData;this.firmwareFile&&t.append("firmware",this.firmwareFile,cu(this.firmwareFile,"firmware.bin")),this.filesystemFile&&t.append("filesystem",this.filesystemFile,cu(this.filesystemFile,"filesystem.bin"));const e={};this.firmwareFile&&this.firmwareSha256&&(e.firmwareSha256=this.firmwareSha256.toLowerCase()),this.filesystemFile&&this.filesystemSha256&&(e.filesystemSha256=this.filesystemSha256.toLowerCase()),this.isLoading=!0,this.uploadedPercent=0;try{const t2=await Cs.post("/update",t,{params:e,headers:{"Content-Type":"multipart/form-data"},onUploadProgress:t=>{t.total&&(this.uploadedPercent=Math.round(100*t.loaded/t.total))}});this.uploadStatus=200===t2.status?"Upload successful! Rebooting...":"Upload failed."}catch(t){const e=this.updateProgress;this.uploadStatus=e&&"failed"===e.status&&e.error?`Error on ${e.target} update: ${e.error}`:"Error on update.",console.error("Upload-error:",t)}finally{this.isLoading=!1,this.firmwareFile=null,this.filesystemFile=null,this.firmwareSha256="",this.filesystemSha256="",document.getElementById("firmwareUpload").value="",document.getElementById("filesystemUpload").value=""}}},mounted(){},beforeDestroy(){}},ld={name:"App",components:{MowerActions:Ns,MowerStatus:Hs,MowingPlan:bl,WifiSetup:Rl,SetDateAndTime:Wl,LogMessages:Yl,UpdateSystem:(0,Ps.A)(sd,[["render",function(t,e,r,o,n,i){return Fo(),Wo("div",Jl,[Xo("div",Ql,[e[9]||(e[9]=Xo("h2",{class:"accordion-header"},[Xo("button",{class:"accordion-button collapsed",type:"button","data-bs-toggle":"collapse","aria-expanded":"false","aria-controls":"accordion-content-update","data-bs-target":"#accordion-content-update"}," Update System ")],-1)),Xo("div",Zl,[Xo("div",td,[Xo("form",{onSubmit:e[4]||(e[4]=oi(((...t)=>i.uploadFiles&&i.uploadFiles(...t)),["prevent"]))},[e[8]||(e[8]=Xo("p",{class:"text-muted",style:{"font-size":"0.7em"}}," You can either upload a firmware.bin update, a filesystem.bin update, or both. The system will automatically restart after the update. Compressed files (.bin.gz, .bin.hs from tools/compress_update.py) upload faster. With the SHA-256 printed by the tool the update is only used if it arrived intact. ",-1)),Xo("div",ed,[e[5]||(e[5]=Xo("label",{for:"firmwareUpload",class:"form-label"},[Xo("b",null,"Firmware Update")],-1)),Xo("input",{type:"file",class:"form-control",id:"firmwareUpload",onChange:e[0]||(e[0]=(...t)=>i.onFirmwareFileChange&&i.onFirmwareFileChange(...t))},null,32),er(Xo("input",{type:"text",class:"form-control form-control-sm mt-1",placeholder:"SHA-256 (optional)","onUpdate:modelValue":e[1]||(e[1]=t=>n.firmwareSha256=t)},null,512),[[Jn,n.firmwareSha256,void 0,{trim:!0}]])]),Xo("div",rd,[e[6]||(e[6]=Xo("label",{for:"filesystemUpload",class:"form-label"},[Xo("b",null,"Filesystem Update")],-1)),Xo("input",{type:"file",class:"form-control",id:"filesystemUpload",onChange:e[2]||(e[2]=(...t)=>i.onFilesystemFileChange&&i.onFilesystemFileChange(...t))},null,32),er(Xo("input",{type:"text",class:"form-control form-control-sm mt-1",placeholder:"SHA-256 (optional)","onUpdate:modelValue":e[3]||(e[3]=t=>n.filesystemSha256=t)},null,512),[[Jn,n.filesystemSha256,void 0,{trim:!0}]])]),Xo("div",od,[Xo("button",{type:"submit",class:"btn btn-outline-primary btn-sm",disabled:n.isLoading},[n.isLoading?(Fo(),Wo("span",id)):Zo("v-if",!0),e[7]||(e[7]=Qo(" Upload and update "))],8,nd)])],32),n.isLoading&&i.progressText?(Fo(),Wo("div",{key:0,class:"text-muted mt-3",style:{"font-size":"0.8em"}},Q(i.progressText),1)):Zo("v-if",!0),n.uploadStatus?(Fo(),Wo("div",ad,Q(n.uploadStatus),1)):Zo("v-if",!0)])])])])}]])},data:()=>({status:{date:"",time:"",isCharging:!1,isLocked:!1,isEmergency:!1,isIdle:!1,isAccessPoint:!1,ssid:"",ip:"",hostname:"",mowingPlanActive:!1},statusLoaded:!1,version:"",eventSource:null,eventsConnected:!1,lastEventAt:0,finishedCommand:null,updateProgress:null,pollTimer:null}),methods:{enableBody(){document.body.classList.add("mounted")},scrollTo(t){document.querySelector(t).scrollIntoView({behavior:"smooth"})},async fetchStatus(){try{const t=await Cs.get("/status");this.status=t.data,this.statusLoaded=!0,console.log("Status fetched:",this.status)}catch(t){console.error("Error fetching status:",t)}},connectEvents(){if(!window.EventSource)return void this.startPolling();this.eventSource=new EventSource("/events"),this.eventSource.addEventListener("state",(t=>{this.status={...this.status,...JSON.parse(t.data)},this.eventReceived()})),this.eventSource.addEventListener("command",(t=>{this.finishedCommand=JSON.parse(t.data),this.eventReceived()})),this.eventSource.addEventListener("update",(t=>{this.updateProgress=JSON.parse(t.data),this.eventReceived()})),this.eventSource.addEventListener("heartbeat",this.eventReceived),this.eventSource.onerror=()=>{this.eventsConnected=!1,this.startPolling()}},eventReceived(){this.lastEventAt=Date.now(),this.eventsConnected||(this.eventsConnected=!0,this.stopPolling(),this.fetchStatus())},checkEvents(){this.eventsConnected&&Date.now()-this.lastEventAt>45e3&&(this.eventsConnected=!1,this.startPolling())},startPolling(){this.pollTimer||(this.pollTimer=setInterval(this.fetchStatus,15e3))},stopPolling(){clearInterval(this.pollTimer),this.pollTimer=null},async fetchVersion(){console.log("Loading version...");try{const t=await Cs.get("/version.json");this.version=t.data.version,document.getElementById("version").textContent="v"+this.version}catch(t){console.error("Error fetching version:",t)}}},mounted(){this.enableBody(),this.fetchStatus(),this.fetchVersion(),this.startPolling(),this.connectEvents(),setInterval(this.checkEvents,15e3)}};r(230);const dd=(0,Ps.A)(ld,[["render",function(t,e,r,o,n,i){const a=Sr("MowerActions"),s=Sr("MowerStatus"),l=Sr("MowingPlan"),d=Sr("WifiSetup"),c=Sr("SetDateAndTime"),p=Sr("LogMessages"),b=Sr("UpdateSystem");return Fo(),Wo("div",ai,[Xo("div",si,[Xo("div",li,[Xo("div",di,[e[6]||(e[6]=Xo("h1",{class:"my-4"},"Robot Mower 🤖🚜",-1)),n.statusLoaded?(Fo(),Wo("div",ci,[Yo(a,{onButtonPressed:i.fetchStatus,status:n.status,eventsConnected:n.eventsConnected,finishedCommand:n.finishedCommand},null,8,["onButtonPressed","status","eventsConnected","finishedCommand"]),Yo(s,{status:n.status},null,8,["status"]),n.status.date&&n.status.time?Zo("v-if",!0):(Fo(),Wo("div",pi,[e[1]||(e[1]=Qo(" Date and time are not set on the mower currently. Set it ")),Xo("a",{href:"#accordion-content-time-setup","data-bs-toggle":"collapse",onClick:e[0]||(e[0]=t=>i.scrollTo("#accordion-content-time-setup"))},"here"),e[2]||(e[2]=Qo(".")),e[3]||(e[3]=Xo("br",null,null,-1)),e[4]||(e[4]=Qo(" In Access Point mode, it will get reset on mower shutdown. In Wifi mode with internet connection, it will be set automatically. "))])),Yo(l,{onPlanSaved:i.fetchStatus,currentDate:n.status.date,currentTime:n.status.time,currentMowingPlanStatusActive:n.status.mowingPlanActive},null,8,["onPlanSaved","currentDate","currentTime","currentMowingPlanStatusActive"]),Yo(d,{currentSSID:n.status.ssid,currentIP:n.status.ip,isAccessPoint:n.status.isAccessPoint,hostname:n.status.hostname},null,8,["currentSSID","currentIP","isAccessPoint","hostname"]),Yo(c,{onTimeSaved:i.fetchStatus},null,8,["onTimeSaved"]),Yo(p),Yo(b,{updateProgress:n.updateProgress},null,8,["updateProgress"])])):(Fo(),Wo("div",bi,e[5]||(e[5]=[Xo("p",null,"Loading status, please wait...",-1),Xo("div",{class:"spinner-border",role:"status"},[Xo("span",{class:"visually-hidden"},"Loading...")],-1)])))])])])])}],["__scopeId","data-v-47c9ecaa"]]);r(902);var cd="top",pd="bottom",bd="right",md="left",gd="auto",fd=[cd,pd,bd,md],ud="start",hd="end",vd="clippingParents",xd="viewport",wd="popper",yd="reference",_d=fd.reduce((function(t,e){return t.concat([e+"-"+ud,e+"-"+hd])}),[]),kd=[].concat(fd,[gd]).reduce((function(t,e){return t.concat([e,e+"-"+ud,e+"-"+hd])}),[]),Ed="beforeRead",Ad="read",Sd="afterRead",Td="beforeMain",Od="main",Cd="afterMain",jd="beforeWrite",zd="write",Ld="afterWrite",Rd=[Ed,Ad,Sd,Td,Od,Cd,jd,zd,Ld];function Pd(t){return t?(t.nodeName||"").toLowerCase():null}function Dd(t){if(null==t)return window;if("[object Window]"!==t.toString()){var e=t.ownerDocument;return e&&e.defaultView||window}return t}function Md(t){return t instanceof Dd(t).Element||t instanceof Element}function Nd(t){return t instanceof Dd(t).HTMLElement||t instanceof HTMLElement}function Id(t){return"undefined"!=typeof ShadowRoot&&(t instanceof Dd(t).ShadowRoot||t instanceof ShadowRoot)}const Bd={name:"applyStyles",enabled:!0,phase:"write",fn:function(t){var e=t.state;Object.keys(e.elements).forEach((function(t){var r=e.styles[t]||{},o=e.attributes[t]||{},n=e.elements[t];Nd(n)&&Pd(n)&&(Object.assign(n.style,r),Object.keys(o).forEach((function(t){var e=o[t];!1===e?n.removeAttribute(t):n.setAttribute(t,!0===e?"":e)})))}))},effect:function(t){var e=t.state,r={popper:{position:e.options.strategy,left:"0",top:"0",margin:"0"},arrow:{position:"absolute"},reference:{}};return Object.assign(e.elements.popper.style,r.popper),e.styles=r,e.elements.arrow&&Object.assign(e.elements.arrow.style,r.arrow),function(){Object.keys(e.elements).forEach((function(t){var o=e.elements[t],n=e.attributes[t]||{},i=Object.keys(e.styles.hasOwnProperty(t)?e.styles[t]:r[t]).reduce((function(t,e){return t[e]="",t}),{});Nd(o)&&Pd(o)&&(Object.assign(o.style,i),Object.keys(n).forEach((function(t){o.removeAttribute(t)})))}))}},requires:["computeStyles"]};function Fd(t){return t.split("-")[0]}var $d=Math.max,Ud=Math.min,Vd=Math.round;function Wd(){var t=navigator.userAgentData;return null!=t&&t.brands&&Array.isArray(t.brands)?t.brands.map((function(t){return t.brand+"/"+t.version})).join(" "):navigator.userAgent}function Hd(){return!/^((?!chrome|android).)*safari/i.test(Wd())}function qd(t,e,r){void 0===e&&(e=!1),void 0===r&&(r=!1);var o=t.getBoundingClientRect(),n=1,i=1;e&&Nd(t)&&(n=t.offsetWidth>0&&Vd(o.width)/t.offsetWidth||1,i=t.offsetHeight>0&&Vd(o.height)/t.offsetHeight||1);var a=(Md(t)?Dd(t):window).visualViewport,s=!Hd()&&r,l=(o.left+(s&&a?a.offsetLeft:0))/n,d=(o.top+(s&&a?a.offsetTop:0))/i,c=o.width/n,p=o.height/i;return{width:c,height:p,top:d,right:l+c,bottom:d+p,left:l,x:l,y:d}}function Gd(t){var e=qd(t),r=t.offsetWidth,o=t.offsetHeight;return Math.abs(e.width-r)<=1&&(r=e.width),Math.abs(e.height-o)<=1&&(o=e.height),{x:t.offsetLeft,y:t.offsetTop,width:r,height:o}}function Kd(t,e){var r=e.getRootNode&&e.getRootNode();if(t.contains(e))return!0;if(r&&Id(r)){var o=e;do{if(o&&t.isSameNode(o))return!0;o=o.parentNode||o.host}while(o)}return!1}function Xd(t){return Dd(t).getComputedStyle(t)}function Yd(t){return["table","td","th"].indexOf(Pd(t))>=0}function Jd(t){return((Md(t)?t.ownerDocument:t.document)||window.document).documentElement}function Qd(t){return"html"===Pd(t)?t:t.assignedSlot||t.parentNode||(Id(t)?t.host:null)||Jd(t)}function Zd(t){return Nd(t)&&"fixed"!==Xd(t).position?t.offsetParent:null}function tc(t){for(var e=Dd(t),r=Zd(t);r&&Yd(r)&&"static"===Xd(r).position;)r=Zd(r);return r&&("html"===Pd(r)||"body"===Pd(r)&&"static"===Xd(r).position)?e:r||function(t){var e=/firefox/i.test(Wd());if(/Trident/i.test(Wd())&&Nd(t)&&"fixed"===Xd(t).position)return null;var r=Qd(t);for(Id(r)&&(r=r.host);Nd(r)&&["html","body"].indexOf(Pd(r))<0;){var o=Xd(r);if("none"!==o.transform||"none"!==o.perspective||"paint"===o.contain||-1!==["transform","perspective"].indexOf(o.willChange)||e&&"filter"===o.willChange||e&&o.filter&&"none"!==o.filter)return r;r=r.parentNode}return null}(t)||e}function ec(t){return["top","bottom"].indexOf(t)>=0?"x":"y"}function rc(t,e,r){return $d(t,Ud(e,r))}function oc(t){return Object.assign({},{top:0,right:0,bottom:0,left:0},t)}function nc(t,e){return e.reduce((function(e,r){return e[r]=t,e}),{})}const ic={name:"arrow",enabled:!0,phase:"main",fn:function(t){var e,r=t.state,o=t.name,n=t.options,i=r.elements.arrow,a=r.modifiersData.popperOffsets,s=Fd(r.placement),l=ec(s),d=[md,bd].indexOf(s)>=0?"height":"width";if(i&&a){var c=function(t,e){return oc("number"!=typeof(t="function"==typeof t?t(Object.assign({},e.rects,{placement:e.placement})):t)?t:nc(t,fd))}(n.padding,r),p=Gd(i),b="y"===l?cd:md,m="y"===l?pd:bd,g=r.rects.reference[d]+r.rects.reference[l]-a[l]-r.rects.popper[d],f=a[l]-r.rects.reference[l],u=tc(i),h=u?"y"===l?u.clientHeight||0:u.clientWidth||0:0,v=g/2-f/2,x=c[b],w=h-p[d]-c[m],y=h/2-p[d]/2+v,_=rc(x,y,w),k=l;r.modifiersData[o]=((e={})[k]=_,e.centerOffset=_-y,e)}},effect:function(t){var e=t.state,r=t.options.element,o=void 0===r?"[data-popper-arrow]":r;null!=o&&("string"!=typeof o||(o=e.elements.popper.querySelector(o)))&&Kd(e.elements.popper,o)&&(e.elements.arrow=o)},requires:["popperOffsets"],requiresIfExists:["preventOverflow"]};function ac(t){return t.split("-")[1]}var sc={top:"auto",right:"auto",bottom:"auto",left:"auto"};function lc(t){var e,r=t.popper,o=t.popperRect,n=t.placement,i=t.variation,a=t.offsets,s=t.position,l=t.gpuAcceleration,d=t.adaptive,c=t.roundOffsets,p=t.isFixed,b=a.x,m=void 0===b?0:b,g=a.y,f=void 0===g?0:g,u="function"==typeof c?c({x:m,y:f}):{x:m,y:f};m=u.x,f=u.y;var h=a.hasOwnProperty("x"),v=a.hasOwnProperty("y"),x=md,w=cd,y=window;if(d){var _=tc(r),k="clientHeight",E="clientWidth";_===Dd(r)&&"static"!==Xd(_=Jd(r)).position&&"absolute"===s&&(k="scrollHeight",E="scrollWidth"),(n===cd||(n===md||n===bd)&&i===hd)&&(w=pd,f-=(p&&_===y&&y.visualViewport?y.visualViewport.height:_[k])-o.height,f*=l?1:-1),n!==md&&(n!==cd&&n!==pd||i!==hd)||(x=bd,m-=(p&&_===y&&y.visualViewport?y.visualViewport.width:_[E])-o.width,m*=l?1:-1)}var A,S=Object.assign({position:s},d&&sc),T=!0===c?function(t,e){var r=t.x,o=t.y,n=e.devicePixelRatio||1;return{x:Vd(r*n)/n||0,y:Vd(o*n)/n||0}}({x:m,y:f},Dd(r)):{x:m,y:f};return m=T.x,f=T.y,l?Object.assign({},S,((A={})[w]=v?"0":"",A[x]=h?"0":"",A.transform=(y.devicePixelRatio||1)<=1?"translate("+m+"px, "+f+"px)":"translate3d("+m+"px, "+f+"px, 0)",A)):Object.assign({},S,((e={})[w]=v?f+"px":"",e[x]=h?m+"px":"",e.transform="",e))}const dc={name:"computeStyles",enabled:!0,phase:"beforeWrite",fn:function(t){var e=t.state,r=t.options,o=r.gpuAcceleration,n=void 0===o||o,i=r.adaptive,a=void 0===i||i,s=r.roundOffsets,l=void 0===s||s,d={placement:Fd(e.placement),variation:ac(e.placement),popper:e.elements.popper,popperRect:e.rects.popper,gpuAcceleration:n,isFixed:"fixed"===e.options.strategy};null!=e.modifiersData.popperOffsets&&(e.styles.popper=Object.assign({},e.styles.popper,lc(Object.assign({},d,{offsets:e.modifiersData.popperOffsets,position:e.options.strategy,adaptive:a,roundOffsets:l})))),null!=e.modifiersData.arrow&&(e.styles.arrow=Object.assign({},e.styles.arrow,lc(Object.assign({},d,{offsets:e.modifiersData.arrow,position:"absolute",adaptive:!1,roundOffsets:l})))),e.attributes.popper=Object.assign({},e.attributes.popper,{"data-popper-placement":e.placement})},data:{}};var cc={passive:!0};const pc={name:"eventListeners",enabled:!0,phase:"write",fn:function(){},effect:function(t){var e=t.state,r=t.instance,o=t.options,n=o.scroll,i=void 0===n||n,a=o.resize,s=void 0===a||a,l=Dd(e.elements.popper),d=[].concat(e.scrollParents.reference,e.scrollParents.popper);return i&&d.forEach((function(t){t.addEventListener("scroll",r.update,cc)})),s&&l.addEventListener("resize",r.update,cc),function(){i&&d.forEach((function(t){t.removeEventListener("scroll",r.update,cc)})),s&&l.removeEventListener("resize",r.update,cc)}},data:{}};var bc={left:"right",right:"left",bottom:"top",top:"bottom"};function mc(t){return t.replace(/left|right|bottom|top/g,(function(t){return bc[t]}))}var gc={start:"end",end:"start"};function fc(t){return t.replace(/start|end/g,(function(t){return gc[t]}))}function uc(t){var e=Dd(t);return{scrollLeft:e.pageXOffset,scrollTop:e.pageYOffset}}function hc(t){return qd(Jd(t)).left+uc(t).scrollLeft}function vc(t){var e=Xd(t),r=e.overflow,o=e.overflowX,n=e.overflowY;return/auto|scroll|overlay|hidden/.test(r+n+o)}function xc(t){return["html","body","#document"].indexOf(Pd(t))>=0?t.ownerDocument.body:Nd(t)&&vc(t)?t:xc(Qd(t))}function wc(t,e){var r;void 0===e&&(e=[]);var o=xc(t),n=o===(null==(r=t.ownerDocument)?void 0:r.body),i=Dd(o),a=n?[i].concat(i.visualViewport||[],vc(o)?o:[]):o,s=e.concat(a);return n?s:s.concat(wc(Qd(a)))}function yc(t){return Object.assign({},t,{left:t.x,top:t.y,right:t.x+t.width,bottom:t.y+t.height})}function _c(t,e,r){return e===xd?yc(function(t,e){var r=Dd(t),o=Jd(t),n=r.visualViewport,i=o.clientWidth,a=o.clientHeight,s=0,l=0;if(n){i=n.width,a=n.height;var d=Hd();(d||!d&&"fixed"===e)&&(s=n.offsetLeft,l=n.offsetTop)}return{width:i,height:a,x:s+hc(t),y:l}}(t,r)):Md(e)?function(t,e){var r=qd(t,!1,"fixed"===e);return r.top=r.top+t.clientTop,r.left=r.left+t.clientLeft,r.bottom=r.top+t.clientHeight,r.right=r.left+t.clientWidth,r.width=t.clientWidth,r.height=t.clientHeight,r.x=r.left,r.y=r.top,r}(e,r):yc(function(t){var e,r=Jd(t),o=uc(t),n=null==(e=t.ownerDocument)?void 0:e.body,i=$d(r.scrollWidth,r.clientWidth,n?n.scrollWidth:0,n?n.clientWidth:0),a=$d(r.scrollHeight,r.clientHeight,n?n.scrollHeight:0,n?n.clientHeight:0),s=-o.scrollLeft+hc(t),l=-o.scrollTop;return"rtl"===Xd(n||r).direction&&(s+=$d(r.clientWidth,n?n.clientWidth:0)-i),{width:i,height:a,x:s,y:l}}(Jd(t)))}function kc(t){var e,r=t.reference,o=t.element,n=t.placement,i=n?Fd(n):null,a=n?ac(n):null,s=r.x+r.width/2-o.width/2,l=r.y+r.height/2-o.height/2;switch(i){case cd:e={x:s,y:r.y-o.height};break;case pd:e={x:s,y:r.y+r.height};break;case bd:e={x:r.x+r.width,y:l};break;case md:e={x:r.x-o.width,y:l};break;default:e={x:r.x,y:r.y}}var d=i?ec(i):null;if(null!=d){var c="y"===d?"height":"width";switch(a){case ud:e[d]=e[d]-(r[c]/2-o[c]/2);break;case hd:e[d]=e[d]+(r[c]/2-o[c]/2)}}return e}function Ec(t,e){void 0===e&&(e={});var r=e,o=r.placement,n=void 0===o?t.placement:o,i=r.strategy,a=void 0===i?t.strategy:i,s=r.boundary,l=void 0===s?vd:s,d=r.rootBoundary,c=void 0===d?xd:d,p=r.elementContext,b=void 0===p?wd:p,m=r.altBoundary,g=void 0!==m&&m,f=r.padding,u=void 0===f?0:f,h=oc("number"!=typeof u?u:nc(u,fd)),v=b===wd?yd:wd,x=t.rects.popper,w=t.elements[g?v:b],y=function(t,e,r,o){var n="clippingParents"===e?function(t){var e=wc(Qd(t)),r=["absolute","fixed"].indexOf(Xd(t).position)>=0&&Nd(t)?tc(t):t;return Md(r)?e.filter((function(t){return Md(t)&&Kd(t,r)&&"body"!==Pd(t)})):[]}(t):[].concat(e),i=[].concat(n,[r]),a=i[0],s=i.reduce((function(e,r){var n=_c(t,r,o);return e.top=$d(n.top,e.top),e.right=Ud(n.right,e.right),e.bottom=Ud(n.bottom,e.bottom),e.left=$d(n.left,e.left),e}),_c(t,a,o));return s.width=s.right-s.left,s.height=s.bottom-s.top,s.x=s.left,s.y=s.top,s}(Md(w)?w:w.contextElement||Jd(t.elements.popper),l,c,a),_=qd(t.elements.reference),k=kc({reference:_,element:x,strategy:"absolute",placement:n}),E=yc(Object.assign({},x,k)),A=b===wd?E:_,S={top:y.top-A.top+h.top,bottom:A.bottom-y.bottom+h.bottom,left:y.left-A.left+h.left,right:A.right-y.right+h.right},T=t.modifiersData.offset;if(b===wd&&T){var O=T[n];Object.keys(S).forEach((function(t){var e=[bd,pd].indexOf(t)>=0?1:-1,r=[cd,pd].indexOf(t)>=0?"y":"x";S[t]+=O[r]*e}))}return S}const Ac={name:"flip",enabled:!0,phase:"main",fn:function(t){var e=t.state,r=t.options,o=t.name;if(!e.modifiersData[o]._skip){for(var n=r.mainAxis,i=void 0===n||n,a=r.altAxis,s=void 0===a||a,l=r.fallbackPlacements,d=r.padding,c=r.boundary,p=r.rootBoundary,b=r.altBoundary,m=r.flipVariations,g=void 0===m||m,f=r.allowedAutoPlacements,u=e.options.placement,h=Fd(u),v=l||(h!==u&&g?function(t){if(Fd(t)===gd)return[];var e=mc(t);return[fc(t),e,fc(e)]}(u):[mc(u)]),x=[u].concat(v).reduce((function(t,r){return t.concat(Fd(r)===gd?function(t,e){void 0===e&&(e={});var r=e,o=r.placement,n=r.boundary,i=r.rootBoundary,a=r.padding,s=r.flipVariations,l=r.allowedAutoPlacements,d=void 0===l?kd:l,c=ac(o),p=c?s?_d:_d.filter((function(t){return ac(t)===c})):fd,b=p.filter((function(t){return d.indexOf(t)>=0}));0===b.length&&(b=p);var m=b.reduce((function(e,r){return e[r]=Ec(t,{placement:r,boundary:n,rootBoundary:i,padding:a})[Fd(r)],e}),{});return Object.keys(m).sort((function(t,e){return m[t]-m[e]}))}(e,{placement:r,boundary:c,rootBoundary:p,padding:d,flipVariations:g,allowedAutoPlacements:f}):r)}),[]),w=e.rects.reference,y=e.rects.popper,_=new Map,k=!0,E=x[0],A=0;A<x.length;A++){var S=x[A],T=Fd(S),O=ac(S)===ud,C=[cd,pd].indexOf(T)>=0,j=C?"width":"height",z=Ec(e,{placement:S,boundary:c,rootBoundary:p,altBoundary:b,padding:d}),L=C?O?bd:md:O?pd:cd;w[j]>y[j]&&(L=mc(L));var R=mc(L),P=[];if(i&&P.push(z[T]<=0),s&&P.push(z[L]<=0,z[R]<=0),P.every((function(t){return t}))){E=S,k=!1;break}_.set(S,P)}if(k)for(var D=function(t){var e=x.find((function(e){var r=_.get(e);if(r)return r.slice(0,t).every((function(t){return t}))}));if(e)return E=e,"break"},M=g?3:1;M>0&&"break"!==D(M);M--);e.placement!==E&&(e.modifiersData[o]._skip=!0,e.placement=E,e.reset=!0)}},requiresIfExists:["offset"],data:{_skip:!1}};function Sc(t,e,r){return void 0===r&&(r={x:0,y:0}),{top:t.top-e.height-r.y,right:t.right-e.width+r.x,bottom:t.bottom-e.height+r.y,left:t.left-e.width-r.x}}function Tc(t){return[cd,bd,pd,md].some((function(e){return t[e]>=0}))}const Oc={name:"hide",enabled:!0,phase:"main",requiresIfExists:["preventOverflow"],fn:function(t){var e=t.state,r=t.name,o=e.rects.reference,n=e.rects.popper,i=e.modifiersData.preventOverflow,a=Ec(e,{elementContext:"reference"}),s=Ec(e,{altBoundary:!0}),l=Sc(a,o),d=Sc(s,n,i),c=Tc(l),p=Tc(d);e.modifiersData[r]={referenceClippingOffsets:l,popperEscapeOffsets:d,isReferenceHidden:c,hasPopperEscaped:p},e.attributes.popper=Object.assign({},e.attributes.popper,{"data-popper-reference-hidden":c,"data-popper-escaped":p})}},Cc={name:"offset",enabled:!0,phase:"main",requires:["popperOffsets"],fn:function(t){var e=t.state,r=t.options,o=t.name,n=r.offset,i=void 0===n?[0,0]:n,a=kd.reduce((function(t,r){return t[r]=function(t,e,r){var o=Fd(t),n=[md,cd].indexOf(o)>=0?-1:1,i="function"==typeof r?r(Object.assign({},e,{placement:t})):r,a=i[0],s=i[1];return a=a||0,s=(s||0)*n,[md,bd].indexOf(o)>=0?{x:s,y:a}:{x:a,y:s}}(r,e.rects,i),t}),{}),s=a[e.placement],l=s.x,d=s.y;null!=e.modifiersData.popperOffsets&&(e.modifiersData.popperOffsets.x+=l,e.modifiersData.popperOffsets.y+=d),e.modifiersData[o]=a}},jc={name:"popperOffsets",enabled:!0,phase:"read",fn:function(t){var e=t.state,r=t.name;e.modifiersData[r]=kc({reference:e.rects.reference,element:e.rects.popper,strategy:"absolute",placement:e.placement})},data:{}},zc={name:"preventOverflow",enabled:!0,phase:"main",fn:function(t){var e=t.state,r=t.options,o=t.name,n=r.mainAxis,i=void 0===n||n,a=r.altAxis,s=void 0!==a&&a,l=r.boundary,d=r.rootBoundary,c=r.altBoundary,p=r.padding,b=r.tether,m=void 0===b||b,g=r.tetherOffset,f=void 0===g?0:g,u=Ec(e,{boundary:l,rootBoundary:d,padding:p,altBoundary:c}),h=Fd(e.placement),v=ac(e.placement),x=!v,w=ec(h),y="x"===w?"y":"x",_=e.modifiersData.popperOffsets,k=e.rects.reference,E=e.rects.popper,A="function"==typeof f?f(Object.assign({},e.rects,{placement:e.placement})):f,S="number"==typeof A?{mainAxis:A,altAxis:A}:Object.assign({mainAxis:0,altAxis:0},A),T=e.modifiersData.offset?e.modifiersData.offset[e.placement]:null,O={x:0,y:0};if(_){if(i){var C,j="y"===w?cd:md,z="y"===w?pd:bd,L="y"===w?"height":"width",R=_[w],P=R+u[j],D=R-u[z],M=m?-E[L]/2:0,N=v===ud?k[L]:E[L],I=v===ud?-E[L]:-k[L],B=e.elements.arrow,F=m&&B?Gd(B):{width:0,height:0},$=e.modifiersData["arrow#persistent"]?e.modifiersData["arrow#persistent"].padding:{top:0,right:0,bottom:0,left:0},U=$[j],V=$[z],W=rc(0,k[L],F[L]),H=x?k[L]/2-M-W-U-S.mainAxis:N-W-U-S.mainAxis,q=x?-k[L]/2+M+W+V+S.mainAxis:I+W+V+S.mainAxis,G=e.elements.arrow&&tc(e.elements.arrow),K=G?"y"===w?G.clientTop||0:G.clientLeft||0:0,X=null!=(C=null==T?void 0:T[w])?C:0,Y=R+q-X,J=rc(m?Ud(P,R+H-X-K):P,R,m?$d(D,Y):D);_[w]=J,O[w]=J-R}if(s){var Q,Z="x"===w?cd:md,tt="x"===w?pd:bd,et=_[y],rt="y"===y?"height":"width",ot=et+u[Z],nt=et-u[tt],it=-1!==[cd,md].indexOf(h),at=null!=(Q=null==T?void 0:T[y])?Q:0,st=it?ot:et-k[rt]-E[rt]-at+S.altAxis,lt=it?et+k[rt]+E[rt]-at-S.altAxis:nt,dt=m&&it?function(t,e,r){var o=rc(t,e,r);return o>r?r:o}(st,et,lt):rc(m?st:ot,et,m?lt:nt);_[y]=dt,O[y]=dt-et}e.modifiersData[o]=O}},requiresIfExists:["offset"]};function Lc(t,e,r){void 0===r&&(r=!1);var o,n,i=Nd(e),a=Nd(e)&&function(t){var e=t.getBoundingClientRect(),r=Vd(e.width)/t.offsetWidth||1,o=Vd(e.height)/t.offsetHeight||1;return 1!==r||1!==o}(e),s=Jd(e),l=qd(t,a,r),d={scrollLeft:0,scrollTop:0},c={x:0,y:0};return(i||!i&&!r)&&(("body"!==Pd(e)||vc(s))&&(d=(o=e)!==Dd(o)&&Nd(o)?{scrollLeft:(n=o).scrollLeft,scrollTop:n.scrollTop}:uc(o)),Nd(e)?((c=qd(e,!0)).x+=e.clientLeft,c.y+=e.clientTop):s&&(c.x=hc(s))),{x:l.left+d.scrollLeft-c.x,y:l.top+d.scrollTop-c.y,width:l.width,height:l.height}}function Rc(t){var e=new Map,r=new Set,o=[];function n(t){r.add(t.name),[].concat(t.requires||[],t.requiresIfExists||[]).forEach((function(t){if(!r.has(t)){var o=e.get(t);o&&n(o)}})),o.push(t)}return t.forEach((function(t){e.set(t.name,t)})),t.forEach((function(t){r.has(t.name)||n(t)})),o}var Pc={placement:"bottom",modifiers:[],strategy:"absolute"};function Dc(){for(var t=arguments.length,e=new Array(t),r=0;r<t;r++)e[r]=arguments[r];return!e.some((function(t){return!(t&&"function"==typeof t.getBoundingClientRect)}))}function Mc(t){void 0===t&&(t={});var e=t,r=e.defaultModifiers,o=void 0===r?[]:r,n=e.defaultOptions,i=void 0===n?Pc:n;return function(t,e,r){void 0===r&&(r=i);var n,a,s={placement:"bottom",orderedModifiers:[],options:Object.assign({},Pc,i),modifiersData:{},elements:{reference:t,popper:e},attributes:{},styles:{}},l=[],d=!1,c={state:s,setOptions:function(r){var n="function"==typeof r?r(s.options):r;p(),s.options=Object.assign({},i,s.options,n),s.scrollParents={reference:Md(t)?wc(t):t.contextElement?wc(t.contextElement):[],popper:wc(e)};var a,d,b=function(t){var e=Rc(t);return Rd.reduce((function(t,r){return t.concat(e.filter((function(t){return t.phase===r})))}),[])}((a=[].concat(o,s.options.modifiers),d=a.reduce((function(t,e){var r=t[e.name];return t[e.name]=r?Object.assign({},r,e,{options:Object.assign({},r.options,e.options),data:Object.assign({},r.data,e.data)}):e,t}),{}),Object.keys(d).map((function(t){return d[t]}))));return s.orderedModifiers=b.filter((function(t){return t.enabled})),s.orderedModifiers.forEach((function(t){var e=t.name,r=t.options,o=void 0===r?{}:r,n=t.effect;if("function"==typeof n){var i=n({state:s,name:e,instance:c,options:o});l.push(i||function(){})}})),c.update()},forceUpdate:function(){if(!d){var t=s.elements,e=t.reference,r=t.popper;if(Dc(e,r)){s.rects={reference:Lc(e,tc(r),"fixed"===s.options.strategy),popper:Gd(r)},s.reset=!1,s.placement=s.options.placement,s.orderedModifiers.forEach((function(t){return s.modifiersData[t.name]=Object.assign({},t.data)}));for(var o=0;o<s.orderedModifiers.length;o++)if(!0!==s.reset){var n=s.orderedModifiers[o],i=n.fn,a=n.options,l=void 0===a?{}:a,p=n.name;"function"==typeof i&&(s=i({state:s,options:l,name:p,instance:c})||s)}else s.reset=!1,o=-1}}},update:(n=function(){return new Promise((function(t){c.forceUpdate(),t(s)}))},function(){return a||(a=new Promise((function(t){Promise.resolve().then((function(){a=void 0,t(n())}))}))),a}),destroy:function(){p(),d=!0}};if(!Dc(t,e))return c;function p(){l.forEach((function(t){return t()})),l=[]}return c.setOptions(r).then((function(t){!d&&r.onFirstUpdate&&r.onFirstUpdate(t)})),c}}var Nc=Mc(),Ic=Mc({defaultModifiers:[pc,jc,dc,Bd,Cc,Ac,zc,ic,Oc]}),Bc=Mc({defaultModifiers:[pc,jc,dc,Bd]});const Fc=new Map,$c={set(t,e,r){Fc.has(t)||Fc.set(t,new Map);const o=Fc.get(t);o.has(e)||0===o.size?o.set(e,r):console.error(`Bootstrap doesn't allow more than one instance per element. Bound instance: ${Array.from(o.keys())[0]}.`)},get:(t,e)=>Fc.has(t)&&Fc.get(t).get(e)||null,remove(t,e){if(!Fc.has(t))return;const r=Fc.get(t);r.delete(e),0===r.size&&Fc.delete(t)}},Uc="transitionend",Vc=t=>(t&&window.CSS&&window.CSS.escape&&(t=t.replace(/#([^\s"#']+)/g,((t,e)=>`#${CSS.escape(e)}`))),t),Wc=t=>{t.dispatchEvent(new Event(Uc))},Hc=t=>!(!t||"object"!=typeof t)&&(void 0!==t.jquery&&(t=t[0]),void 0!==t.nodeType),qc=t=>Hc(t)?t.jquery?t[0]:t:"string"==typeof t&&t.length>0?document.querySelector(Vc(t)):null,Gc=t=>{if(!Hc(t)||0===t.getClientRects().length)return!1;const e="visible"===getComputedStyle(t).getPropertyValue("visibility"),r=t.closest("details:not([open])");if(!r)return e;if(r!==t){const e=t.closest("summary");if(e&&e.parentNode!==r)return!1;if(null===e)return!1}return e},Kc=t=>!t||t.nodeType!==Node.ELEMENT_NODE||!!t.classList.contains("disabled")||(void 0!==t.disabled?t.disabled:t.hasAttribute("disabled")&&"false"!==t.getAttribute("disabled")),Xc=t=>{if(!document.documentElement.attachShadow)return null;if("function"==typeof t.getRootNode){const e=t.getRootNode();return e instanceof ShadowRoot?e:null}return t instanceof ShadowRoot?t:t.parentNode?Xc(t.parentNode):null},Yc=()=>{},Jc=t=>{t.offsetHeight},Qc=()=>window.jQuery&&!document.body.hasAttribute("data-bs-no-jquery")?window.jQuery:null,Zc=[],tp=()=>"rtl"===document.documentElement.dir,ep=t=>{var e;e=()=>{const e=Qc();if(e){const r=t.NAME,o=e.fn[r];e.fn[r]=t.jQueryInterface,e.fn[r].Constructor=t,e.fn[r].noConflict=()=>(e.fn[r]=o,t.jQueryInterface)}},"loading"===document.readyState?(Zc.length||document.addEventListener("DOMContentLoaded",(()=>{for(const t of Zc)t()})),Zc.push(e)):e()},rp=(t,e=[],r=t)=>"function"==typeof t?t(...e):r,op=(t,e,r=!0)=>{if(!r)return void rp(t);const o=(t=>{if(!t)return 0;let{transitionDuration:e,transitionDelay:r}=window.getComputedStyle(t);const o=Number.parseFloat(e),n=Number.parseFloat(r);return o||n?(e=e.split(",")[0],r=r.split(",")[0],1e3*(Number.parseFloat(e)+Number.parseFloat(r))):0})(e)+5;let n=!1;const i=({target:r})=>{r===e&&(n=!0,e.removeEventListener(Uc,i),rp(t))};e.addEventListener(Uc,i),setTimeout((()=>{n||Wc(e)}),o)},np=(t,e,r,o)=>{const n=t.length;let i=t.indexOf(e);return-1===i?!r&&o?t[n-1]:t[0]:(i+=r?1:-1,o&&(i=(i+n)%n),t[Math.max(0,Math.min(i,n-1))])},ip=/[^.]*(?=\..*)\.|.*/,ap=/\..*/,sp=/::\d+$/,lp={};let dp=1;const cp={mouseenter:"mouseover",mouseleave:"mouseout"},pp=new Set(["click","dblclick","mouseup","mousedown","contextmenu","mousewheel","DOMMouseScroll","mouseover","mouseout","mousemove","selectstart","selectend","keydown","keypress","keyup","orientationchange","touchstart","touchmove","touchend","touchcancel","pointerdown","pointermove","pointerup","pointerleave","pointercancel","gesturestart","gesturechange","gestureend","focus","blur","change","reset","select","submit","focusin","focusout","load","unload","beforeunload","resize","move","DOMContentLoaded","readystatechange","error","abort","scroll"]);function bp(t,e){return e&&`${e}::${dp++}`||t.uidEvent||dp++}function mp(t){const e=bp(t);return t.uidEvent=e,lp[e]=lp[e]||{},lp[e]}function gp(t,e,r=null){return Object.values(t).find((t=>t.callable===e&&t.delegationSelector===r))}function fp(t,e,r){const o="string"==typeof e,n=o?r:e||r;let i=xp(t);return pp.has(i)||(i=t),[o,n,i]}function up(t,e,r,o,n){if("string"!=typeof e||!t)return;let[i,a,s]=fp(e,r,o);if(e in cp){const t=t=>function(e){if(!e.relatedTarget||e.relatedTarget!==e.delegateTarget&&!e.delegateTarget.contains(e.relatedTarget))return t.call(this,e)};a=t(a)}const l=mp(t),d=l[s]||(l[s]={}),c=gp(d,a,i?r:null);if(c)return void(c.oneOff=c.oneOff&&n);const p=bp(a,e.replace(ip,"")),b=i?function(t,e,r){return function o(n){const i=t.querySelectorAll(e);for(let{target:a}=n;a&&a!==this;a=a.parentNode)for(const s of i)if(s===a)return yp(n,{delegateTarget:a}),o.oneOff&&wp.off(t,n.type,e,r),r.apply(a,[n])}}(t,r,a):function(t,e){return function r(o){return yp(o,{delegateTarget:t}),r.oneOff&&wp.off(t,o.type,e),e.apply(t,[o])}}(t,a);b.delegationSelector=i?r:null,b.callable=a,b.oneOff=n,b.uidEvent=p,d[p]=b,t.addEventListener(s,b,i)}function hp(t,e,r,o,n){const i=gp(e[r],o,n);i&&(t.removeEventListener(r,i,Boolean(n)),delete e[r][i.uidEvent])}function vp(t,e,r,o){const n=e[r]||{};for(const[i,a]of Object.entries(n))i.includes(o)&&hp(t,e,r,a.callable,a.delegationSelector)}function xp(t){return t=t.replace(ap,""),cp[t]||t}const wp={on(t,e,r,o){up(t,e,r,o,!1)},one(t,e,r,o){up(t,e,r,o,!0)},off(t,e,r,o){if("string"!=typeof e||!t)return;const[n,i,a]=fp(e,r,o),s=a!==e,l=mp(t),d=l[a]||{},c=e.startsWith(".");if(void 0===i){if(c)for(const r of Object.keys(l))vp(t,l,r,e.slice(1));for(const[r,o]of Object.entries(d)){const n=r.replace(sp,"");s&&!e.includes(n)||hp(t,l,a,o.callable,o.delegationSelector)}}else{if(!Object.keys(d).length)return;hp(t,l,a,i,n?r:null)}},trigger(t,e,r){if("string"!=typeof e||!t)return null;const o=Qc();let n=null,i=!0,a=!0,s=!1;e!==xp(e)&&o&&(n=o.Event(e,r),o(t).trigger(n),i=!n.isPropagationStopped(),a=!n.isImmediatePropagationStopped(),s=n.isDefaultPrevented());const l=yp(new Event(e,{bubbles:i,cancelable:!0}),r);return s&&l.preventDefault(),a&&t.dispatchEvent(l),l.defaultPrevented&&n&&n.preventDefault(),l}};function yp(t,e={}){for(const[r,o]of Object.entries(e))try{t[r]=o}catch(e){Object.defineProperty(t,r,{configurable:!0,get:()=>o})}return t}function _p(t){if("true"===t)return!0;if("false"===t)return!1;if(t===Number(t).toString())return Number(t);if(""===t||"null"===t)return null;if("string"!=typeof t)return t;try{return JSON.parse(decodeURIComponent(t))}catch(e){return t}}function kp(t){return t.replace(/[A-Z]/g,(t=>`-${t.toLowerCase()}`))}const Ep={setDataAttribute(t,e,r){t.setAttribute(`data-bs-${kp(e)}`,r)},removeDataAttribute(t,e){t.removeAttribute(`data-bs-${kp(e)}`)},getDataAttributes(t){if(!t)return{};const e={},r=Object.keys(t.dataset).filter((t=>t.startsWith("bs")&&!t.startsWith("bsConfig")));for(const o of r){let r=o.replace(/^bs/,"");r=r.charAt(0).toLowerCase()+r.slice(1,r.length),e[r]=_p(t.dataset[o])}return e},getDataAttribute:(t,e)=>_p(t.getAttribute(`data-bs-${kp(e)}`))};class Ap{static get Default(){return{}}static get DefaultType(){return{}}static get NAME(){throw new Error('You have to implement the static method "NAME", for each component!')}_getConfig(t){return t=this._mergeConfigObj(t),t=this._configAfterMerge(t),this._typeCheckConfig(t),t}_configAfterMerge(t){return t}_mergeConfigObj(t,e){const r=Hc(e)?Ep.getDataAttribute(e,"config"):{};return{...this.constructor.Default,..."object"==typeof r?r:{},...Hc(e)?Ep.getDataAttributes(e):{},..."object"==typeof t?t:{}}}_typeCheckConfig(t,e=this.constructor.DefaultType){for(const[o,n]of Object.entries(e)){const e=t[o],i=Hc(e)?"element":null==(r=e)?`${r}`:Object.prototype.toString.call(r).match(/\s([a-z]+)/i)[1].toLowerCase();if(!new RegExp(n).test(i))throw new TypeError(`${this.constructor.NAME.toUpperCase()}: Option "${o}" provided type "${i}" but expected type "${n}".`)}var r}}class Sp extends Ap{constructor(t,e){super(),(t=qc(t))&&(this._element=t,this._config=this._getConfig(e),$c.set(this._element,this.constructor.DATA_KEY,this))}dispose(){$c.remove(this._element,this.constructor.DATA_KEY),wp.off(this._element,this.constructor.EVENT_KEY);for(const t of Object.getOwnPropertyNames(this))this[t]=null}_queueCallback(t,e,r=!0){op(t,e,r)}_getConfig(t){return t=this._mergeConfigObj(t,this._element),t=this._configAfterMerge(t),this._typeCheckConfig(t),t}static getInstance(t){return $c.get(qc(t),this.DATA_KEY)}static getOrCreateInstance(t,e={}){return this.getInstance(t)||new this(t,"object"==typeof e?e:null)}static get VERSION(){return"5.3.3"}static get DATA_KEY(){return`bs.${this.NAME}`}static get EVENT_KEY(){return`.${this.DATA_KEY}`}static eventName(t){return`${t}${this.EVENT_KEY}`}}const Tp=t=>{let e=t.getAttribute("data-bs-target");if(!e||"#"===e){let r=t.getAttribute("href");if(!r||!r.includes("#")&&!r.startsWith("."))return null;r.includes("#")&&!r.startsWith("#")&&(r=`#${r.split("#")[1]}`),e=r&&"#"!==r?r.trim():null}return e?e.split(",").map((t=>Vc(t))).join(","):null},Op={find:(t,e=document.documentElement)=>[].concat(...Element.prototype.querySelectorAll.call(e,t)),findOne:(t,e=document.documentElement)=>Element.prototype.querySelector.call(e,t),children:(t,e)=>[].concat(...t.children).filter((t=>t.matches(e))),parents(t,e){const r=[];let o=t.parentNode.closest(e);for(;o;)r.push(o),o=o.parentNode.closest(e);return r},prev(t,e){let r=t.previousElementSibling;for(;r;){if(r.matches(e))return[r];r=r.previousElementSibling}return[]},next(t,e){let r=t.nextElementSibling;for(;r;){if(r.matches(e))return[r];r=r.nextElementSibling}return[]},focusableChildren(t){const e=["a","button","input","textarea","select","details","[tabindex]",'[contenteditable="true"]'].map((t=>`${t}:not([tabindex^="-"])`)).join(",");return this.find(e,t).filter((t=>!Kc(t)&&Gc(t)))},getSelectorFromElement(t){const e=Tp(t);return e&&Op.findOne(e)?e:null},getElementFromSelector(t){const e=Tp(t);return e?Op.findOne(e):null},getMultipleElementsFromSelector(t){const e=Tp(t);return e?Op.find(e):[]}},Cp=(t,e="hide")=>{const r=`click.dismiss${t.EVENT_KEY}`,o=t.NAME;wp.on(document,r,`[data-bs-dismiss="${o}"]`,(function(r){if(["A","AREA"].includes(this.tagName)&&r.preventDefault(),Kc(this))return;const n=Op.getElementFromSelector(this)||this.closest(`.${o}`);t.getOrCreateInstance(n)[e]()}))},jp=".bs.alert",zp=`close${jp}`,Lp=`closed${jp}`;class Rp extends Sp{static get NAME(){return"alert"}close(){if(wp.trigger(this._element,zp).defaultPrevented)return;this._element.classList.remove("show");const t=this._element.classList.contains("fade");this._queueCallback((()=>this._destroyElement()),this._element,t)}_destroyElement(){this._element.remove(),wp.trigger(this._element,Lp),this.dispose()}static jQueryInterface(t){return this.each((function(){const e=Rp.getOrCreateInstance(this);if("string"==typeof t){if(void 0===e[t]||t.startsWith("_")||"constructor"===t)throw new TypeError(`No method named "${t}"`);e[t](this)}}))}}Cp(Rp,"close"),ep(Rp);const Pp='[data-bs-toggle="button"]';class Dp extends Sp{static get NAME(){return"button"}toggle(){this._element.setAttribute("aria-pressed",this._element.classList.toggle("active"))}static jQueryInterface(t){return this.each((function(){const e=Dp.getOrCreateInstance(this);"toggle"===t&&e[t]()}))}}wp.on(document,"click.bs.button.data-api",Pp,(t=>{t.preventDefault();const e=t.target.closest(Pp);Dp.getOrCreateInstance(e).toggle()})),ep(Dp);const Mp=".bs.swipe",Np=`touchstart${Mp}`,Ip=`touchmove${Mp}`,Bp=`touchend${Mp}`,Fp=`pointerdown${Mp}`,$p=`pointerup${Mp}`,Up={endCallback:null,leftCallback:null,rightCallback:null},Vp={endCallback:"(function|null)",leftCallback:"(function|null)",rightCallback:"(function|null)"};class Wp extends Ap{constructor(t,e){super(),this._element=t,t&&Wp.isSupported()&&(this._config=this._getConfig(e),this._deltaX=0,this._supportPointerEvents=Boolean(window.PointerEvent),this._initEvents())}static get Default(){return Up}static get DefaultType(){return Vp}static get NAME(){return"swipe"}dispose(){wp.off(this._element,Mp)}_start(t){this._supportPointerEvents?this._eventIsPointerPenTouch(t)&&(this._deltaX=t.clientX):this._deltaX=t.touches[0].clientX}_end(t){this._eventIsPointerPenTouch(t)&&(this._deltaX=t.clientX-this._deltaX),this._handleSwipe(),rp(this._config.endCallback)}_move(t){this._deltaX=t.touches&&t.touches.length>1?0:t.touches[0].clientX-this._deltaX}_handleSwipe(){const t=Math.abs(this._deltaX);if(t<=40)return;const e=t/this._deltaX;this._deltaX=0,e&&rp(e>0?this._config.rightCallback:this._config.leftCallback)}_initEvents(){this._supportPointerEvents?(wp.on(this._element,Fp,(t=>this._start(t))),wp.on(this._element,$p,(t=>this._end(t))),this._element.classList.add("pointer-event")):(wp.on(this._element,Np,(t=>this._start(t))),wp.on(this._element,Ip,(t=>this._move(t))),wp.on(this._element,Bp,(t=>this._end(t))))}_eventIsPointerPenTouch(t){return this._supportPointerEvents&&("pen"===t.pointerType||"touch"===t.pointerType)}static isSupported(){return"ontouchstart"in document.documentElement||navigator.maxTouchPoints>0}}const Hp=".bs.carousel",qp=".data-api",Gp="ArrowLeft",Kp="ArrowRight",Xp="next",Yp="prev",Jp="left",Qp="right",Zp=`slide${Hp}`,tb=`slid${Hp}`,eb=`keydown${Hp}`,rb=`mouseenter${Hp}`,ob=`mouseleave${Hp}`,nb=`dragstart${Hp}`,ib=`load${Hp}${qp}`,ab=`click${Hp}${qp}`,sb="carousel",lb="active",db=".active",cb=".carousel-item",pb=db+cb,bb={[Gp]:Qp,[Kp]:Jp},mb={interval:5e3,keyboard:!0,pause:"hover",ride:!1,touch:!0,wrap:!0},gb={interval:"(number|boolean)",keyboard:"boolean",pause:"(string|boolean)",ride:"(boolean|string)",touch:"boolean",wrap:"boolean"};class fb extends Sp{constructor(t,e){super(t,e),this._interval=null,this._activeElement=null,this._isSliding=!1,this.touchTimeout=null,this._swipeHelper=null,this._indicatorsElement=Op.findOne(".carousel-indicators",this._element),this._addEventListeners(),this._config.ride===sb&&this.cycle()}static get Default(){return mb}static get DefaultType(){return gb}static get NAME(){return"carousel"}next(){this._slide(Xp)}nextWhenVisible(){!document.hidden&&Gc(this._element)&&this.next()}prev(){this._slide(Yp)}pause(){this._isSliding&&Wc(this._element),this._clearInterval()}cycle(){this._clearInterval(),this._updateInterval(),this._interval=setInterval((()=>this.nextWhenVisible()),this._config.interval)}_maybeEnableCycle(){this._config.ride&&(this._isSliding?wp.one(this._element,tb,(()=>this.cycle())):this.cycle())}to(t){const e=this._getItems();if(t>e.length-1||t<0)return;if(this._isSliding)return void wp.one(this._element,tb,(()=>this.to(t)));const r=this._getItemIndex(this._getActive());if(r===t)return;const o=t>r?Xp:Yp;this._slide(o,e[t])}dispose(){this._swipeHelper&&this._swipeHelper.dispose(),super.dispose()}_configAfterMerge(t){return t.defaultInterval=t.interval,t}_addEventListeners(){this._config.keyboard&&wp.on(this._element,eb,(t=>this._keydown(t))),"hover"===this._config.pause&&(wp.on(this._element,rb,(()=>this.pause())),wp.on(this._element,ob,(()=>this._maybeEnableCycle()))),this._config.touch&&Wp.isSupported()&&this._addTouchEventListeners()}_addTouchEventListeners(){for(const t of Op.find(".carousel-item img",this._element))wp.on(t,nb,(t=>t.preventDefault()));const t={leftCallback:()=>this._slide(this._directionToOrder(Jp)),rightCallback:()=>this._slide(this._directionToOrder(Qp)),endCallback:()=>{"hover"===this._config.pause&&(this.pause(),this.touchTimeout&&clearTimeout(this.touchTimeout),this.touchTimeout=setTimeout((()=>this._maybeEnableCycle()),500+this._config.interval))}};this._swipeHelper=new Wp(this._element,t)}_keydown(t){if(/input|textarea/i.test(t.target.tagName))return;const e=bb[t.key];e&&(t.preventDefault(),this._slide(this._directionToOrder(e)))}_getItemIndex(t){return this._getItems().indexOf(t)}_setActiveIndicatorElement(t){if(!this._indicatorsElement)return;const e=Op.findOne(db,this._indicatorsElement);e.classList.remove(lb),e.removeAttribute("aria-current");const r=Op.findOne(`[data-bs-slide-to="${t}"]`,this._indicatorsElement);r&&(r.classList.add(lb),r.setAttribute("aria-current","true"))}_updateInterval(){const t=this._activeElement||this._getActive();if(!t)return;const e=Number.parseInt(t.getAttribute("data-bs-interval"),10);this._config.interval=e||this._config.defaultInterval}_slide(t,e=null){if(this._isSliding)return;const r=this._getActive(),o=t===Xp,n=e||np(this._getItems(),r,o,this._config.wrap);if(n===r)return;const i=this._getItemIndex(n),a=e=>wp.trigger(this._element,e,{relatedTarget:n,direction:this._orderToDirection(t),from:this._getItemIndex(r),to:i});if(a(Zp).defaultPrevented)return;if(!r||!n)return;const s=Boolean(this._interval);this.pause(),this._isSliding=!0,this._setActiveIndicatorElement(i),this._activeElement=n;const l=o?"carousel-item-start":"carousel-item-end",d=o?"carousel-item-next":"carousel-item-prev";n.classList.add(d),Jc(n),r.classList.add(l),n.classList.add(l),this._queueCallback((()=>{n.classList.remove(l,d),n.classList.add(lb),r.classList.remove(lb,d,l),this._isSliding=!1,a(tb)}),r,this._isAnimated()),s&&this.cycle()}_isAnimated(){return this._element.classList.contains("slide")}_getActive(){return Op.findOne(pb,this._element)}_getItems(){return Op.find(cb,this._element)}_clearInterval(){this._interval&&(clearInterval(this._interval),this._interval=null)}_directionToOrder(t){return tp()?t===Jp?Yp:Xp:t===Jp?Xp:Yp}_orderToDirection(t){return tp()?t===Yp?Jp:Qp:t===Yp?Qp:Jp}static jQueryInterface(t){return this.each((function(){const e=fb.getOrCreateInstance(this,t);if("number"!=typeof t){if("string"==typeof t){if(void 0===e[t]||t.startsWith("_")||"constructor"===t)throw new TypeError(`No method named "${t}"`);e[t]()}}else e.to(t)}))}}wp.on(document,ab,"[data-bs-slide], [data-bs-slide-to]",(function(t){const e=Op.getElementFromSelector(this);if(!e||!e.classList.contains(sb))return;t.preventDefault();const r=fb.getOrCreateInstance(e),o=this.getAttribute("data-bs-slide-to");return o?(r.to(o),void r._maybeEnableCycle()):"next"===Ep.getDataAttribute(this,"slide")?(r.next(),void r._maybeEnableCycle()):(r.prev(),void r._maybeEnableCycle())})),wp.on(window,ib,(()=>{const t=Op.find('[data-bs-ride="carousel"]');for(const e of t)fb.getOrCreateInstance(e)})),ep(fb);const ub=".bs.collapse",hb=`show${ub}`,vb=`shown${ub}`,xb=`hide${ub}`,wb=`hidden${ub}`,yb=`click${ub}.data-api`,_b="show",kb="collapse",Eb="collapsing",Ab=`:scope .${kb} .${kb}`,Sb='[data-bs-toggle="collapse"]',Tb={parent:null,toggle:!0},Ob={parent:"(null|element)",toggle:"boolean"};class Cb extends Sp{constructor(t,e){super(t,e),this._isTransitioning=!1,this._triggerArray=[];const r=Op.find(Sb);for(const t of r){const e=Op.getSelectorFromElement(t),r=Op.find(e).filter((t=>t===this._element));null!==e&&r.length&&this._triggerArray.push(t)}this._initializeChildren(),this._config.parent||this._addAriaAndCollapsedClass(this._triggerArray,this._isShown()),this._config.toggle&&this.toggle()}static get Default(){return Tb}static get DefaultType(){return Ob}static get NAME(){return"collapse"}toggle(){this._isShown()?this.hide():this.show()}show(){if(this._isTransitioning||this._isShown())return;let t=[];if(this._config.parent&&(t=this._getFirstLevelChildren(".collapse.show, .collapse.collapsing").filter((t=>t!==this._element)).map((t=>Cb.getOrCreateInstance(t,{toggle:!1})))),t.length&&t[0]._isTransitioning)return;if(wp.trigger(this._element,hb).defaultPrevented)return;for(const e of t)e.hide();const e=this._getDimension();this._element.classList.remove(kb),this._element.classList.add(Eb),this._element.style[e]=0,this._addAriaAndCollapsedClass(this._triggerArray,!0),this._isTransitioning=!0;const r=`scroll${e[0].toUpperCase()+e.slice(1)}`;this._queueCallback((()=>{this._isTransitioning=!1,this._element.classList.remove(Eb),this._element.classList.add(kb,_b),this._element.style[e]="",wp.trigger(this._element,vb)}),this._element,!0),this._element.style[e]=`${this._element[r]}px`}hide(){if(this._isTransitioning||!this._isShown())return;if(wp.trigger(this._element,xb).defaultPrevented)return;const t=this._getDimension();this._element.style[t]=`${this._element.getBoundingClientRect()[t]}px`,Jc(this._element),this._element.classList.add(Eb),this._element.classList.remove(kb,_b);for(const t of this._triggerArray){const e=Op.getElementFromSelector(t);e&&!this._isShown(e)&&this._addAriaAndCollapsedClass([t],!1)}this._isTransitioning=!0,this._element.style[t]="",this._queueCallback((()=>{this._isTransitioning=!1,this._element.classList.remove(Eb),this._element.classList.add(kb),wp.trigger(this._element,wb)}),this._element,!0)}_isShown(t=this._element){return t.classList.contains(_b)}_configAfterMerge(t){return t.toggle=Boolean(t.toggle),t.parent=qc(t.parent),t}_getDimension(){return this._element.classList.contains("collapse-horizontal")?"width":"height"}_initializeChildren(){if(!this._config.parent)return;const t=this._getFirstLevelChildren(Sb);for(const e of t){const t=Op.getElementFromSelector(e);t&&this._addAriaAndCollapsedClass([e],this._isShown(t))}}_getFirstLevelChildren(t){const e=Op.find(Ab,this._config.parent);return Op.find(t,this._config.parent).filter((t=>!e.includes(t)))}_addAriaAndCollapsedClass(t,e){if(t.length)for(const r of t)r.classList.toggle("collapsed",!e),r.setAttribute("aria-expanded",e)}static jQueryInterface(t){const e={};return"string"==typeof t&&/show|hide/.test(t)&&(e.toggle=!1),this.each((function(){const r=Cb.getOrCreateInstance(this,e);if("string"==typeof t){if(void 0===r[t])throw new TypeError(`No method named "${t}"`);r[t]()}}))}}wp.on(document,yb,Sb,(function(t){("A"===t.target.tagName||t.delegateTarget&&"A"===t.delegateTarget.tagName)&&t.preventDefault();for(const t of Op.getMultipleElementsFromSelector(this))Cb.getOrCreateInstance(t,{toggle:!1}).toggle()})),ep(Cb);const jb="dropdown",zb=".bs.dropdown",Lb=".data-api",Rb="ArrowUp",Pb="ArrowDown",Db=`hide${zb}`,Mb=`hidden${zb}`,Nb=`show${zb}`,Ib=`shown${zb}`,Bb=`click${zb}${Lb}`,Fb=`keydown${zb}${Lb}`,$b=`keyup${zb}${Lb}`,Ub="show",Vb='[data-bs-toggle="dropdown"]:not(.disabled):not(:disabled)',Wb=`${Vb}.${Ub}`,Hb=".dropdown-menu",qb=tp()?"top-end":"top-start",Gb=tp()?"top-start":"top-end",Kb=tp()?"bottom-end":"bottom-start",Xb=tp()?"bottom-start":"bottom-end",Yb=tp()?"left-start":"right-start",Jb=tp()?"right-start":"left-start",Qb={autoClose:!0,boundary:"clippingParents",display:"dynamic",offset:[0,2],popperConfig:null,reference:"toggle"},Zb={autoClose:"(boolean|string)",boundary:"(string|element)",display:"string",offset:"(array|string|function)",popperConfig:"(null|object|function)",reference:"(string|element|object)"};class tm extends Sp{constructor(t,e){super(t,e),this._popper=null,this._parent=this._element.parentNode,this._menu=Op.next(this._element,Hb)[0]||Op.prev(this._element,Hb)[0]||Op.findOne(Hb,this._parent),this._inNavbar=this._detectNavbar()}static get Default(){return Qb}static get DefaultType(){return Zb}static get NAME(){return jb}toggle(){return this._isShown()?this.hide():this.show()}show(){if(Kc(this._element)||this._isShown())return;const t={relatedTarget:this._element};if(!wp.trigger(this._element,Nb,t).defaultPrevented){if(this._createPopper(),"ontouchstart"in document.documentElement&&!this._parent.closest(".navbar-nav"))for(const t of[].concat(...document.body.children))wp.on(t,"mouseover",Yc);this._element.focus(),this._element.setAttribute("aria-expanded",!0),this._menu.classList.add(Ub),this._element.classList.add(Ub),wp.trigger(this._element,Ib,t)}}hide(){if(Kc(this._element)||!this._isShown())return;const t={relatedTarget:this._element};this._completeHide(t)}dispose(){this._popper&&this._popper.destroy(),super.dispose()}update(){this._inNavbar=this._detectNavbar(),this._popper&&this._popper.update()}_completeHide(t){if(!wp.trigger(this._element,Db,t).defaultPrevented){if("ontouchstart"in document.documentElement)for(const t of[].concat(...document.body.children))wp.off(t,"mouseover",Yc);this._popper&&this._popper.destroy(),this._menu.classList.remove(Ub),this._element.classList.remove(Ub),this._element.setAttribute("aria-expanded","false"),Ep.removeDataAttribute(this._menu,"popper"),wp.trigger(this._element,Mb,t)}}_getConfig(t){if("object"==typeof(t=super._getConfig(t)).reference&&!Hc(t.reference)&&"function"!=typeof t.reference.getBoundingClientRect)throw new TypeError(`${jb.toUpperCase()}: Option "reference" provided type "object" without a required "getBoundingClientRect" method.`);return t}_createPopper(){let t=this._element;"parent"===this._config.reference?t=this._parent:Hc(this._config.reference)?t=qc(this._config.reference):"object"==typeof this._config.reference&&(t=this._config.reference);const e=this._getPopperConfig();this._popper=Ic(t,this._menu,e)}_isShown(){return this._menu.classList.contains(Ub)}_getPlacement(){const t=this._parent;if(t.classList.contains("dropend"))return Yb;if(t.classList.contains("dropstart"))return Jb;if(t.classList.contains("dropup-center"))return"top";if(t.classList.contains("dropdown-center"))return"bottom";const e="end"===getComputedStyle(this._menu).getPropertyValue("--bs-position").trim();return t.classList.contains("dropup")?e?Gb:qb:e?Xb:Kb}_detectNavbar(){return null!==this._element.closest(".navbar")}_getOffset(){const{offset:t}=this._config;return"string"==typeof t?t.split(",").map((t=>Number.parseInt(t,10))):"function"==typeof t?e=>t(e,this._element):t}_getPopperConfig(){const t={placement:this._getPlacement(),modifiers:[{name:"preventOverflow",options:{boundary:this._config.boundary}},{name:"offset",options:{offset:this._getOffset()}}]};return(this._inNavbar||"static"===this._config.display)&&(Ep.setDataAttribute(this._menu,"popper","static"),t.modifiers=[{name:"applyStyles",enabled:!1}]),{...t,...rp(this._config.popperConfig,[t])}}_selectMenuItem({key:t,target:e}){const r=Op.find(".dropdown-menu .dropdown-item:not(.disabled):not(:disabled)",this._menu).filter((t=>Gc(t)));r.length&&np(r,e,t===Pb,!r.includes(e)).focus()}static jQueryInterface(t){return this.each((function(){const e=tm.getOrCreateInstance(this,t);if("string"==typeof t){if(void 0===e[t])throw new TypeError(`No method named "${t}"`);e[t]()}}))}static clearMenus(t){if(2===t.button||"keyup"===t.type&&"Tab"!==t.key)return;const e=Op.find(Wb);for(const r of e){const e=tm.getInstance(r);if(!e||!1===e._config.autoClose)continue;const o=t.composedPath(),n=o.includes(e._menu);if(o.includes(e._element)||"inside"===e._config.autoClose&&!n||"outside"===e._config.autoClose&&n)continue;if(e._menu.contains(t.target)&&("keyup"===t.type&&"Tab"===t.key||/input|select|option|textarea|form/i.test(t.target.tagName)))continue;const i={relatedTarget:e._element};"click"===t.type&&(i.clickEvent=t),e._completeHide(i)}}static dataApiKeydownHandler(t){const e=/input|textarea/i.test(t.target.tagName),r="Escape"===t.key,o=[Rb,Pb].includes(t.key);if(!o&&!r)return;if(e&&!r)return;t.preventDefault();const n=this.matches(Vb)?this:Op.prev(this,Vb)[0]||Op.next(this,Vb)[0]||Op.findOne(Vb,t.delegateTarget.parentNode),i=tm.getOrCreateInstance(n);if(o)return t.stopPropagation(),i.show(),void i._selectMenuItem(t);i._isShown()&&(t.stopPropagation(),i.hide(),n.focus())}}wp.on(document,Fb,Vb,tm.dataApiKeydownHandler),wp.on(document,Fb,Hb,tm.dataApiKeydownHandler),wp.on(document,Bb,tm.clearMenus),wp.on(document,$b,tm.clearMenus),wp.on(document,Bb,Vb,(function(t){t.preventDefault(),tm.getOrCreateInstance(this).toggle()})),ep(tm);const em="backdrop",rm="show",om=`mousedown.bs.${em}`,nm={className:"modal-backdrop",clickCallback:null,isAnimated:!1,isVisible:!0,rootElement:"body"},im={className:"string",clickCallback:"(function|null)",isAnimated:"boolean",isVisible:"boolean",rootElement:"(element|string)"};class am extends Ap{constructor(t){super(),this._config=this._getConfig(t),this._isAppended=!1,this._element=null}static get Default(){return nm}static get DefaultType(){return im}static get NAME(){return em}show(t){if(!this._config.isVisible)return void rp(t);this._append();const e=this._getElement();this._config.isAnimated&&Jc(e),e.classList.add(rm),this._emulateAnimation((()=>{rp(t)}))}hide(t){this._config.isVisible?(this._getElement().classList.remove(rm),this._emulateAnimation((()=>{this.dispose(),rp(t)}))):rp(t)}dispose(){this._isAppended&&(wp.off(this._element,om),this._element.remove(),this._isAppended=!1)}_getElement(){if(!this._element){const t=document.createElement("div");t.className=this._config.className,this._config.isAnimated&&t.classList.add("fade"),this._element=t}return this._element}_configAfterMerge(t){return t.rootElement=qc(t.rootElement),t}_append(){if(this._isAppended)return;const t=this._getElement();this._config.rootElement.append(t),wp.on(t,om,(()=>{rp(this._config.clickCallback)})),this._isAppended=!0}_emulateAnimation(t){op(t,this._getElement(),this._config.isAnimated)}}const sm=".bs.focustrap",lm=`focusin${sm}`,dm=`keydown.tab${sm}`,cm="backward",pm={autofocus:!0,trapElement:null},bm={autofocus:"boolean",trapElement:"element"};class mm extends Ap{constructor(t){super(),this._config=this._getConfig(t),this._isActive=!1,this._lastTabNavDirection=null}static get Default(){return pm}static get DefaultType(){return bm}static get NAME(){return"focustrap"}activate(){this._isActive||(this._config.autofocus&&this._config.trapElement.focus(),wp.off(document,sm),wp.on(document,lm,(t=>this._handleFocusin(t))),wp.on(document,dm,(t=>this._handleKeydown(t))),this._isActive=!0)}deactivate(){this._isActive&&(this._isActive=!1,wp.off(document,sm))}_handleFocusin(t){const{trapElement:e}=this._config;if(t.target===document||t.target===e||e.contains(t.target))return;const r=Op.focusableChildren(e);0===r.length?e.focus():this._lastTabNavDirection===cm?r[r.length-1].focus():r[0].focus()}_handleKeydown(t){"Tab"===t.key&&(this._lastTabNavDirection=t.shiftKey?cm:"forward")}}const gm=".fixed-top, .fixed-bottom, .is-fixed, .sticky-top",fm=".sticky-top",um="padding-right",hm="margin-right";class vm{constructor(){this._element=document.body}getWidth(){const t=document.documentElement.clientWidth;return Math.abs(window.innerWidth-t)}hide(){const t=this.getWidth();this._disableOverFlow(),this._setElementAttributes(this._element,um,(e=>e+t)),this._setElementAttributes(gm,um,(e=>e+t)),this._setElementAttributes(fm,hm,(e=>e-t))}reset(){this._resetElementAttributes(this._element,"overflow"),this._resetElementAttributes(this._element,um),this._resetElementAttributes(gm,um),this._resetElementAttributes(fm,hm)}isOverflowing(){return this.getWidth()>0}_disableOverFlow(){this._saveInitialAttribute(this._element,"overflow"),this._element.style.overflow="hidden"}_setElementAttributes(t,e,r){const o=this.getWidth();this._applyManipulationCallback(t,(t=>{if(t!==this._element&&window.innerWidth>t.clientWidth+o)return;this._saveInitialAttribute(t,e);const n=window.getComputedStyle(t).getPropertyValue(e);t.style.setProperty(e,`${r(Number.parseFloat(n))}px`)}))}_saveInitialAttribute(t,e){const r=t.style.getPropertyValue(e);r&&Ep.setDataAttribute(t,e,r)}_resetElementAttributes(t,e){this._applyManipulationCallback(t,(t=>{const r=Ep.getDataAttribute(t,e);null!==r?(Ep.removeDataAttribute(t,e),t.style.setProperty(e,r)):t.style.removeProperty(e)}))}_applyManipulationCallback(t,e){if(Hc(t))e(t);else for(const r of Op.find(t,this._element))e(r)}}const xm=".bs.modal",wm=`hide${xm}`,ym=`hidePrevented${xm}`,_m=`hidden${xm}`,km=`show${xm}`,Em=`shown${xm}`,Am=`resize${xm}`,Sm=`click.dismiss${xm}`,Tm=`mousedown.dismiss${xm}`,Om=`keydown.dismiss${xm}`,Cm=`click${xm}.data-api`,jm="modal-open",zm="show",Lm="modal-static",Rm={backdrop:!0,focus:!0,keyboard:!0},Pm={backdrop:"(boolean|string)",focus:"boolean",keyboard:"boolean"};class Dm extends Sp{constructor(t,e){super(t,e),this._dialog=Op.findOne(".modal-dialog",this._element),this._backdrop=this._initializeBackDrop(),this._focustrap=this._initializeFocusTrap(),this._isShown=!1,this._isTransitioning=!1,this._scrollBar=new vm,this._addEventListeners()}static get Default(){return Rm}static get DefaultType(){return Pm}static get NAME(){return"modal"}toggle(t){return this._isShown?this.hide():this.show(t)}show(t){this._isShown||this._isTransitioning||wp.trigger(this._element,km,{relatedTarget:t}).defaultPrevented||(this._isShown=!0,this._isTransitioning=!0,this._scrollBar.hide(),document.body.classList.add(jm),this._adjustDialog(),this._backdrop.show((()=>this._showElement(t))))}hide(){this._isShown&&!this._isTransitioning&&(wp.trigger(this._element,wm).defaultPrevented||(this._isShown=!1,this._isTransitioning=!0,this._focustrap.deactivate(),this._element.classList.remove(zm),this._queueCallback((()=>this._hideModal()),this._element,this._isAnimated())))}dispose(){wp.off(window,xm),wp.off(this._dialog,xm),this._backdrop.dispose(),this._focustrap.deactivate(),super.dispose()}handleUpdate(){this._adjustDialog()}_initializeBackDrop(){return new am({isVisible:Boolean(this._config.backdrop),isAnimated:this._isAnimated()})}_initializeFocusTrap(){return new mm({trapElement:this._element})}_showElement(t){document.body.contains(this._element)||document.body.append(this._element),this._element.style.display="block",this._element.removeAttribute("aria-hidden"),this._element.setAttribute("aria-modal",!0),this._element.setAttribute("role","dialog"),this._element.scrollTop=0;const e=Op.findOne(".modal-body",this._dialog);e&&(e.scrollTop=0),Jc(this._element),this._element.classList.add(zm),this._queueCallback((()=>{this._config.focus&&this._focustrap.activate(),this._isTransitioning=!1,wp.trigger(this._element,Em,{relatedTarget:t})}),this._dialog,this._isAnimated())}_addEventListeners(){wp.on(this._element,Om,(t=>{"Escape"===t.key&&(this._config.keyboard?this.hide():this._triggerBackdropTransition())})),wp.on(window,Am,(()=>{this._isShown&&!this._isTransitioning&&this._adjustDialog()})),wp.on(this._element,Tm,(t=>{wp.one(this._element,Sm,(e=>{this._element===t.target&&this._element===e.target&&("static"!==this._config.backdrop?this._config.backdrop&&this.hide():this._triggerBackdropTransition())}))}))}_hideModal(){this._element.style.display="none",this._element.setAttribute("aria-hidden",!0),this._element.removeAttribute("aria-modal"),this._element.removeAttribute("role"),this._isTransitioning=!1,this._backdrop.hide((()=>{document.body.classList.remove(jm),this._resetAdjustments(),this._scrollBar.reset(),wp.trigger(this._element,_m)}))}_isAnimated(){return this._element.classList.contains("fade")}_triggerBackdropTransition(){if(wp.trigger(this._element,ym).defaultPrevented)return;const t=this._element.scrollHeight>document.documentElement.clientHeight,e=this._element.style.overflowY;"hidden"===e||this._element.classList.contains(Lm)||(t||(this._element.style.overflowY="hidden"),this._element.classList.add(Lm),this._queueCallback((()=>{this._element.classList.remove(Lm),this._queueCallback((()=>{this._element.style.overflowY=e}),this._dialog)}),this._dialog),this._element.focus())}_adjustDialog(){const t=this._element.scrollHeight>document.documentElement.clientHeight,e=this._scrollBar.getWidth(),r=e>0;if(r&&!t){const t=tp()?"paddingLeft":"paddingRight";this._element.style[t]=`${e}px`}if(!r&&t){const t=tp()?"paddingRight":"paddingLeft";this._element.style[t]=`${e}px`}}_resetAdjustments(){this._element.style.paddingLeft="",this._element.style.paddingRight=""}static jQueryInterface(t,e){return this.each((function(){const r=Dm.getOrCreateInstance(this,t);if("string"==typeof t){if(void 0===r[t])throw new TypeError(`No method named "${t}"`);r[t](e)}}))}}wp.on(document,Cm,'[data-bs-toggle="modal"]',(function(t){const e=Op.getElementFromSelector(this);["A","AREA"].includes(this.tagName)&&t.preventDefault(),wp.one(e,km,(t=>{t.defaultPrevented||wp.one(e,_m,(()=>{Gc(this)&&this.focus()}))}));const r=Op.findOne(".modal.show");r&&Dm.getInstance(r).hide(),Dm.getOrCreateInstance(e).toggle(this)})),Cp(Dm),ep(Dm);const Mm=".bs.offcanvas",Nm=".data-api",Im=`load${Mm}${Nm}`,Bm="show",Fm="showing",$m="hiding",Um=".offcanvas.show",Vm=`show${Mm}`,Wm=`shown${Mm}`,Hm=`hide${Mm}`,qm=`hidePrevented${Mm}`,Gm=`hidden${Mm}`,Km=`resize${Mm}`,Xm=`click${Mm}${Nm}`,Ym=`keydown.dismiss${Mm}`,Jm={backdrop:!0,keyboard:!0,scroll:!1},Qm={backdrop:"(boolean|string)",keyboard:"boolean",scroll:"boolean"};class Zm extends Sp{constructor(t,e){super(t,e),this._isShown=!1,this._backdrop=this._initializeBackDrop(),this._focustrap=this._initializeFocusTrap(),this._addEventListeners()}static get Default(){return Jm}static get DefaultType(){return Qm}static get NAME(){return"offcanvas"}toggle(t){return this._isShown?this.hide():this.show(t)}show(t){this._isShown||wp.trigger(this._element,Vm,{relatedTarget:t}).defaultPrevented||(this._isShown=!0,this._backdrop.show(),this._config.scroll||(new vm).hide(),this._element.setAttribute("aria-modal",!0),this._element.setAttribute("role","dialog"),this._element.classList.add(Fm),this._queueCallback((()=>{this._config.scroll&&!this._config.backdrop||this._focustrap.activate(),this._element.classList.add(Bm),this._element.classList.remove(Fm),wp.trigger(this._element,Wm,{relatedTarget:t})}),this._element,!0))}hide(){this._isShown&&(wp.trigger(this._element,Hm).defaultPrevented||(this._focustrap.deactivate(),this._element.blur(),this._isShown=!1,this._element.classList.add($m),this._backdrop.hide(),this._queueCallback((()=>{this._element.classList.remove(Bm,$m),this._element.removeAttribute("aria-modal"),this._element.removeAttribute("role"),this._config.scroll||(new vm).reset(),wp.trigger(this._element,Gm)}),this._element,!0)))}dispose(){this._backdrop.dispose(),this._focustrap.deactivate(),super.dispose()}_initializeBackDrop(){const t=Boolean(this._config.backdrop);return new am({className:"offcanvas-backdrop",isVisible:t,isAnimated:!0,rootElement:this._element.parentNode,clickCallback:t?()=>{"static"!==this._config.backdrop?this.hide():wp.trigger(this._element,qm)}:null})}_initializeFocusTrap(){return new mm({trapElement:this._element})}_addEventListeners(){wp.on(this._element,Ym,(t=>{"Escape"===t.key&&(this._config.keyboard?this.hide():wp.trigger(this._element,qm))}))}static jQueryInterface(t){return this.each((function(){const e=Zm.getOrCreateInstance(this,t);if("string"==typeof t){if(void 0===e[t]||t.startsWith("_")||"constructor"===t)throw new TypeError(`No method named "${t}"`);e[t](this)}}))}}wp.on(document,Xm,'[data-bs-toggle="offcanvas"]',(function(t){const e=Op.getElementFromSelector(this);if(["A","AREA"].includes(this.tagName)&&t.preventDefault(),Kc(this))return;wp.one(e,Gm,(()=>{Gc(this)&&this.focus()}));const r=Op.findOne(Um);r&&r!==e&&Zm.getInstance(r).hide(),Zm.getOrCreateInstance(e).toggle(this)})),wp.on(window,Im,(()=>{for(const t of Op.find(Um))Zm.getOrCreateInstance(t).show()})),wp.on(window,Km,(()=>{for(const t of Op.find("[aria-modal][class*=show][class*=offcanvas-]"))"fixed"!==getComputedStyle(t).position&&Zm.getOrCreateInstance(t).hide()})),Cp(Zm),ep(Zm);const tg={"*":["class","dir","id","lang","role",/^aria-[\w-]*$/i],a:["target","href","title","rel"],area:[],b:[],br:[],col:[],code:[],dd:[],div:[],dl:[],dt:[],em:[],hr:[],h1:[],h2:[],h3:[],h4:[],h5:[],h6:[],i:[],img:["src","srcset","alt","title","width","height"],li:[],ol:[],p:[],pre:[],s:[],small:[],span:[],sub:[],sup:[],strong:[],u:[],ul:[]},eg=new Set(["background","cite","href","itemtype","longdesc","poster","src","xlink:href"]),rg=/^(?!javascript:)(?:[a-z0-9+.-]+:|[^&:/?#]*(?:[/?#]|$))/i,og=(t,e)=>{const r=t.nodeName.toLowerCase();return e.includes(r)?!eg.has(r)||Boolean(rg.test(t.nodeValue)):e.filter((t=>t instanceof RegExp)).some((t=>t.test(r)))},ng={allowList:tg,content:{},extraClass:"",html:!1,sanitize:!0,sanitizeFn:null,template:"<div></div>"},ig={allowList:"object",content:"object",extraClass:"(string|function)",html:"boolean",sanitize:"boolean",sanitizeFn:"(null|function)",template:"string"},ag={entry:"(string|element|function|null)",selector:"(string|element)"};class sg extends Ap{constructor(t){super(),this._config=this._getConfig(t)}static get Default(){return ng}static get DefaultType(){return ig}static get NAME(){return"TemplateFactory"}getContent(){return Object.values(this._config.content).map((t=>this._resolvePossibleFunction(t))).filter(Boolean)}hasContent(){return this.getContent().length>0}changeContent(t){return this._checkContent(t),this._config.content={...this._config.content,...t},this}toHtml(){const t=document.createElement("div");t.innerHTML=this._maybeSanitize(this._config.template);for(const[e,r]of Object.entries(this._config.content))this._setContent(t,r,e);const e=t.children[0],r=this._resolvePossibleFunction(this._config.extraClass);return r&&e.classList.add(...r.split(" ")),e}_typeCheckConfig(t){super._typeCheckConfig(t),this._checkContent(t.content)}_checkContent(t){for(const[e,r]of Object.entries(t))super._typeCheckConfig({selector:e,entry:r},ag)}_setContent(t,e,r){const o=Op.findOne(r,t);o&&((e=this._resolvePossibleFunction(e))?Hc(e)?this._putElementInTemplate(qc(e),o):this._config.html?o.innerHTML=this._maybeSanitize(e):o.textContent=e:o.remove())}_maybeSanitize(t){return this._config.sanitize?function(t,e,r){if(!t.length)return t;if(r&&"function"==typeof r)return r(t);const o=(new window.DOMParser).parseFromString(t,"text/html"),n=[].concat(...o.body.querySelectorAll("*"));for(const t of n){const r=t.nodeName.toLowerCase();if(!Object.keys(e).includes(r)){t.remove();continue}const o=[].concat(...t.attributes),n=[].concat(e["*"]||[],e[r]||[]);for(const e of o)og(e,n)||t.removeAttribute(e.nodeName)}return o.body.innerHTML}(t,this._config.allowList,this._config.sanitizeFn):t}_resolvePossibleFunction(t){return rp(t,[this])}_putElementInTemplate(t,e){if(this._config.html)return e.innerHTML="",void e.append(t);e.textContent=t.textContent}}const lg=new Set(["sanitize","allowList","sanitizeFn"]),dg="fade",cg="show",pg=".tooltip-inner",bg=".modal",mg="hide.bs.modal",gg="hover",fg="focus",ug={AUTO:"auto",TOP:"top",RIGHT:tp()?"left":"right",BOTTOM:"bottom",LEFT:tp()?"right":"left"},hg={allowList:tg,animation:!0,boundary:"clippingParents",container:!1,customClass:"",delay:0,fallbackPlacements:["top","right","bottom","left"],html:!1,offset:[0,6],placement:"top",popperConfig:null,sanitize:!0,sanitizeFn:null,selector:!1,template:'<div class="tooltip" role="tooltip"><div class="tooltip-arrow"></div><div class="tooltip-inner"></div></div>',title:"",trigger:"hover focus"},vg={allowList:"object",animation:"boolean",boundary:"(string|element)",container:"(string|element|boolean)",customClass:"(string|function)",delay:"(number|object)",fallbackPlacements:"array",html:"boolean",offset:"(array|string|function)",placement:"(string|function)",popperConfig:"(null|object|function)",sanitize:"boolean",sanitizeFn:"(null|function)",selector:"(string|boolean)",template:"string",title:"(string|element|function)",trigger:"string"};class xg extends Sp{constructor(t,e){super(t,e),this._isEnabled=!0,this._timeout=0,this._isHovered=null,this._activeTrigger={},this._popper=null,this._templateFactory=null,this._newContent=null,this.tip=null,this._setListeners(),this._config.selector||this._fixTitle()}static get Default(){return hg}static get DefaultType(){return vg}static get NAME(){return"tooltip"}enable(){this._isEnabled=!0}disable(){this._isEnabled=!1}toggleEnabled(){this._isEnabled=!this._isEnabled}toggle(){this._isEnabled&&(this._activeTrigger.click=!this._activeTrigger.click,this._isShown()?this._leave():this._enter())}dispose(){clearTimeout(this._timeout),wp.off(this._element.closest(bg),mg,this._hideModalHandler),this._element.getAttribute("data-bs-original-title")&&this._element.setAttribute("title",this._element.getAttribute("data-bs-original-title")),this._disposePopper(),super.dispose()}show(){if("none"===this._element.style.display)throw new Error("Please use show on visible elements");if(!this._isWithContent()||!this._isEnabled)return;const t=wp.trigger(this._element,this.constructor.eventName("show")),e=(Xc(this._element)||this._element.ownerDocument.documentElement).contains(this._element);if(t.defaultPrevented||!e)return;this._disposePopper();const r=this._getTipElement();this._element.setAttribute("aria-describedby",r.getAttribute("id"));const{container:o}=this._config;if(this._element.ownerDocument.documentElement.contains(this.tip)||(o.append(r),wp.trigger(this._element,this.constructor.eventName("inserted"))),this._popper=this._createPopper(r),r.classList.add(cg),"ontouchstart"in document.documentElement)for(const t of[].concat(...document.body.children))wp.on(t,"mouseover",Yc);this._queueCallback((()=>{wp.trigger(this._element,this.constructor.eventName("shown")),!1===this._isHovered&&this._leave(),this._isHovered=!1}),this.tip,this._isAnimated())}hide(){if(this._isShown()&&!wp.trigger(this._element,this.constructor.eventName("hide")).defaultPrevented){if(this._getTipElement().classList.remove(cg),"ontouchstart"in document.documentElement)for(const t of[].concat(...document.body.children))wp.off(t,"mouseover",Yc);this._activeTrigger.click=!1,this._activeTrigger[fg]=!1,this._activeTrigger[gg]=!1,this._isHovered=null,this._queueCallback((()=>{this._isWithActiveTrigger()||(this._isHovered||this._disposePopper(),this._element.removeAttribute("aria-describedby"),wp.trigger(this._element,this.constructor.eventName("hidden")))}),this.tip,this._isAnimated())}}update(){this._popper&&this._popper.update()}_isWithContent(){return Boolean(this._getTitle())}_getTipElement(){return this.tip||(this.tip=this._createTipElement(this._newContent||this._getContentForTemplate())),this.tip}_createTipElement(t){const e=this._getTemplateFactory(t).toHtml();if(!e)return null;e.classList.remove(dg,cg),e.classList.add(`bs-${this.constructor.NAME}-auto`);const r=(t=>{do{t+=Math.floor(1e6*Math.random())}while(document.getElementById(t));return t})(this.constructor.NAME).toString();return e.setAttribute("id",r),this._isAnimated()&&e.classList.add(dg),e}setContent(t){this._newContent=t,this._isShown()&&(this._disposePopper(),this.show())}_getTemplateFactory(t){return this._templateFactory?this._templateFactory.changeContent(t):this._templateFactory=new sg({...this._config,content:t,extraClass:this._resolvePossibleFunction(this._config.customClass)}),this._templateFactory}_getContentForTemplate(){return{[pg]:this._getTitle()}}_getTitle(){return this._resolvePossibleFunction(this._config.title)||this._element.getAttribute("data-bs-original-title")}_initializeOnDelegatedTarget(t){return this.constructor.getOrCreateInstance(t.delegateTarget,this._getDelegateConfig())}_isAnimated(){return this._config.animation||this.tip&&this.tip.classList.contains(dg)}_isShown(){return this.tip&&this.tip.classList.contains(cg)}_createPopper(t){const e=rp(this._config.placement,[this,t,this._element]),r=ug[e.toUpperCase()];return Ic(this._element,t,this._getPopperConfig(r))}_getOffset(){const{offset:t}=this._config;return"string"==typeof t?t.split(",").map((t=>Number.parseInt(t,10))):"function"==typeof t?e=>t(e,this._element):t}_resolvePossibleFunction(t){return rp(t,[this._element])}_getPopperConfig(t){const e={placement:t,modifiers:[{name:"flip",options:{fallbackPlacements:this._config.fallbackPlacements}},{name:"offset",options:{offset:this._getOffset()}},{name:"preventOverflow",options:{boundary:this._config.boundary}},{name:"arrow",options:{element:`.${this.constructor.NAME}-arrow`}},{name:"preSetPlacement",enabled:!0,phase:"beforeMain",fn:t=>{this._getTipElement().setAttribute("data-popper-placement",t.state.placement)}}]};return{...e,...rp(this._config.popperConfig,[e])}}_setListeners(){const t=this._config.trigger.split(" ");for(const e of t)if("click"===e)wp.on(this._element,this.constructor.eventName("click"),this._config.selector,(t=>{this._initializeOnDelegatedTarget(t).toggle()}));else if("manual"!==e){const t=e===gg?this.constructor.eventName("mouseenter"):this.constructor.eventName("focusin"),r=e===gg?this.constructor.eventName("mouseleave"):this.constructor.eventName("focusout");wp.on(this._element,t,this._config.selector,(t=>{const e=this._initializeOnDelegatedTarget(t);e._activeTrigger["focusin"===t.type?fg:gg]=!0,e._enter()})),wp.on(this._element,r,this._config.selector,(t=>{const e=this._initializeOnDelegatedTarget(t);e._activeTrigger["focusout"===t.type?fg:gg]=e._element.contains(t.relatedTarget),e._leave()}))}this._hideModalHandler=()=>{this._element&&this.hide()},wp.on(this._element.closest(bg),mg,this._hideModalHandler)}_fixTitle(){const t=this._element.getAttribute("title");t&&(this._element.getAttribute("aria-label")||this._element.textContent.trim()||this._element.setAttribute("aria-label",t),this._element.setAttribute("data-bs-original-title",t),this._element.removeAttribute("title"))}_enter(){this._isShown()||this._isHovered?this._isHovered=!0:(this._isHovered=!0,this._setTimeout((()=>{this._isHovered&&this.show()}),this._config.delay.show))}_leave(){this._isWithActiveTrigger()||(this._isHovered=!1,this._setTimeout((()=>{this._isHovered||this.hide()}),this._config.delay.hide))}_setTimeout(t,e){clearTimeout(this._timeout),this._timeout=setTimeout(t,e)}_isWithActiveTrigger(){return Object.values(this._activeTrigger).includes(!0)}_getConfig(t){const e=Ep.getDataAttributes(this._element);for(const t of Object.keys(e))lg.has(t)&&delete e[t];return t={...e,..."object"==typeof t&&t?t:{}},t=this._mergeConfigObj(t),t=this._configAfterMerge(t),this._typeCheckConfig(t),t}_configAfterMerge(t){return t.container=!1===t.container?document.body:qc(t.container),"number"==typeof t.delay&&(t.delay={show:t.delay,hide:t.delay}),"number"==typeof t.title&&(t.title=t.title.toString()),"number"==typeof t.content&&(t.content=t.content.toString()),t}_getDelegateConfig(){const t={};for(const[e,r]of Object.entries(this._config))this.constructor.Default[e]!==r&&(t[e]=r);return t.selector=!1,t.trigger="manual",t}_disposePopper(){this._popper&&(this._popper.destroy(),this._popper=null),this.tip&&(this.tip.remove(),this.tip=null)}static jQueryInterface(t){return this.each((function(){const e=xg.getOrCreateInstance(this,t);if("string"==typeof t){if(void 0===e[t])throw new TypeError(`No method named "${t}"`);e[t]()}}))}}ep(xg);const wg=".popover-header",yg=".popover-body",_g={...xg.Default,content:"",offset:[0,8],placement:"right",template:'<div class="popover" role="tooltip"><div class="popover-arrow"></div><h3 class="popover-header"></h3><div class="popover-body"></div></div>',trigger:"click"},kg={...xg.DefaultType,content:"(null|string|element|function)"};class Eg extends xg{static get Default(){return _g}static get DefaultType(){return kg}static get NAME(){return"popover"}_isWithContent(){return this._getTitle()||this._getContent()}_getContentForTemplate(){return{[wg]:this._getTitle(),[yg]:this._getContent()}}_getContent(){return this._resolvePossibleFunction(this._config.content)}static jQueryInterface(t){return this.each((function(){const e=Eg.getOrCreateInstance(this,t);if("string"==typeof t){if(void 0===e[t])throw new TypeError(`No method named "${t}"`);e[t]()}}))}}ep(Eg);const Ag=".bs.scrollspy",Sg=`activate${Ag}`,Tg=`click${Ag}`,Og=`load${Ag}.data-api`,Cg="active",jg="[href]",zg=".nav-link",Lg=`${zg}, .nav-item > ${zg}, .list-group-item`,Rg={offset:null,rootMargin:"0px 0px -25%",smoothScroll:!1,target:null,threshold:[.1,.5,1]},Pg={offset:"(number|null)",rootMargin:"string",smoothScroll:"boolean",target:"element",threshold:"array"};class Dg extends Sp{constructor(t,e){super(t,e),this._targetLinks=new Map,this._observableSections=new Map,this._rootElement="visible"===getComputedStyle(this._element).overflowY?null:this._element,this._activeTarget=null,this._observer=null,this._previousScrollData={visibleEntryTop:0,parentScrollTop:0},this.refresh()}static get Default(){return Rg}static get DefaultType(){return Pg}static get NAME(){return"scrollspy"}refresh(){this._initializeTargetsAndObservables(),this._maybeEnableSmoothScroll(),this._observer?this._observer.disconnect():this._observer=this._getNewObserver();for(const t of this._observableSections.values())this._observer.observe(t)}dispose(){this._observer.disconnect(),super.dispose()}_configAfterMerge(t){return t.target=qc(t.target)||document.body,t.rootMargin=t.offset?`${t.offset}px 0px -30%`:t.rootMargin,"string"==typeof t.threshold&&(t.threshold=t.threshold.split(",").map((t=>Number.parseFloat(t)))),t}_maybeEnableSmoothScroll(){this._config.smoothScroll&&(wp.off(this._config.target,Tg),wp.on(this._config.target,Tg,jg,(t=>{const e=this._observableSections.get(t.target.hash);if(e){t.preventDefault();const r=this._rootElement||window,o=e.offsetTop-this._element.offsetTop;if(r.scrollTo)return void r.scrollTo({top:o,behavior:"smooth"});r.scrollTop=o}})))}_getNewObserver(){const t={root:this._rootElement,threshold:this._config.threshold,rootMargin:this._config.rootMargin};return new IntersectionObserver((t=>this._observerCallback(t)),t)}_observerCallback(t){const e=t=>this._targetLinks.get(`#${t.target.id}`),r=t=>{this._previousScrollData.visibleEntryTop=t.target.offsetTop,this._process(e(t))},o=(this._rootElement||document.documentElement).scrollTop,n=o>=this._previousScrollData.parentScrollTop;this._previousScrollData.parentScrollTop=o;for(const i of t){if(!i.isIntersecting){this._activeTarget=null,this._clearActiveClass(e(i));continue}const t=i.target.offsetTop>=this._previousScrollData.visibleEntryTop;if(n&&t){if(r(i),!o)return}else n||t||r(i)}}_initializeTargetsAndObservables(){this._targetLinks=new Map,this._observableSections=new Map;const t=Op.find(jg,this._config.target);for(const e of t){if(!e.hash||Kc(e))continue;const t=Op.findOne(decodeURI(e.hash),this._element);Gc(t)&&(this._targetLinks.set(decodeURI(e.hash),e),this._observableSections.set(e.hash,t))}}_process(t){this._activeTarget!==t&&(this._clearActiveClass(this._config.target),this._activeTarget=t,t.classList.add(Cg),this._activateParents(t),wp.trigger(this._element,Sg,{relatedTarget:t}))}_activateParents(t){if(t.classList.contains("dropdown-item"))Op.findOne(".dropdown-toggle",t.closest(".dropdown")).classList.add(Cg);else for(const e of Op.parents(t,".nav, .list-group"))for(const t of Op.prev(e,Lg))t.classList.add(Cg)}_clearActiveClass(t){t.classList.remove(Cg);const e=Op.find(`${jg}.${Cg}`,t);for(const t of e)t.classList.remove(Cg)}static jQueryInterface(t){return this.each((function(){const e=Dg.getOrCreateInstance(this,t);if("string"==typeof t){if(void 0===e[t]||t.startsWith("_")||"constructor"===t)throw new TypeError(`No method named "${t}"`);e[t]()}}))}}wp.on(window,Og,(()=>{for(const t of Op.find('[data-bs-spy="scroll"]'))Dg.getOrCreateInstance(t)})),ep(Dg);const Mg=".bs.tab",Ng=`hide${Mg}`,Ig=`hidden${Mg}`,Bg=`show${Mg}`,Fg=`shown${Mg}`,$g=`click${Mg}`,Ug=`keydown${Mg}`,Vg=`load${Mg}`,Wg="ArrowLeft",Hg="ArrowRight",qg="ArrowUp",Gg="ArrowDown",Kg="Home",Xg="End",Yg="active",Jg="fade",Qg="show",Zg=".dropdown-toggle",tf=`:not(${Zg})`,ef='[data-bs-toggle="tab"], [data-bs-toggle="pill"], [data-bs-toggle="list"]',rf=`.nav-link${tf}, .list-group-item${tf}, [role="tab"]${tf}, ${ef}`,of=`.${Yg}[data-bs-toggle="tab"], .${Yg}[data-bs-toggle="pill"], .${Yg}[data-bs-toggle="list"]`;class nf extends Sp{constructor(t){super(t),this._parent=this._element.closest('.list-group, .nav, [role="tablist"]'),this._parent&&(this._setInitialAttributes(this._parent,this._getChildren()),wp.on(this._element,Ug,(t=>this._keydown(t))))}static get NAME(){return"tab"}show(){const t=this._element;if(this._elemIsActive(t))return;const e=this._getActiveElem(),r=e?wp.trigger(e,Ng,{relatedTarget:t}):null;wp.trigger(t,Bg,{relatedTarget:e}).defaultPrevented||r&&r.defaultPrevented||(this._deactivate(e,t),this._activate(t,e))}_activate(t,e){t&&(t.classList.add(Yg),this._activate(Op.getElementFromSelector(t)),this._queueCallback((()=>{"tab"===t.getAttribute("role")?(t.removeAttribute("tabindex"),t.setAttribute("aria-selected",!0),this._toggleDropDown(t,!0),wp.trigger(t,Fg,{relatedTarget:e})):t.classList.add(Qg)}),t,t.classList.contains(Jg)))}_deactivate(t,e){t&&(t.classList.remove(Yg),t.blur(),this._deactivate(Op.getElementFromSelector(t)),this._queueCallback((()=>{"tab"===t.getAttribute("role")?(t.setAttribute("aria-selected",!1),t.setAttribute("tabindex","-1"),this._toggleDropDown(t,!1),wp.trigger(t,Ig,{relatedTarget:e})):t.classList.remove(Qg)}),t,t.classList.contains(Jg)))}_keydown(t){if(![Wg,Hg,qg,Gg,Kg,Xg].includes(t.key))return;t.stopPropagation(),t.preventDefault();const e=this._getChildren().filter((t=>!Kc(t)));let r;if([Kg,Xg].includes(t.key))r=e[t.key===Kg?0:e.length-1];else{const o=[Hg,Gg].includes(t.key);r=np(e,t.target,o,!0)}r&&(r.focus({preventScroll:!0}),nf.getOrCreateInstance(r).show())}_getChildren(){return Op.find(rf,this._parent)}_getActiveElem(){return this._getChildren().find((t=>this._elemIsActive(t)))||null}_setInitialAttributes(t,e){this._setAttributeIfNotExists(t,"role","tablist");for(const t of e)this._setInitialAttributesOnChild(t)}_setInitialAttributesOnChild(t){t=this._getInnerElement(t);const e=this._elemIsActive(t),r=this._getOuterElement(t);t.setAttribute("aria-selected",e),r!==t&&this._setAttributeIfNotExists(r,"role","presentation"),e||t.setAttribute("tabindex","-1"),this._setAttributeIfNotExists(t,"role","tab"),this._setInitialAttributesOnTargetPanel(t)}_setInitialAttributesOnTargetPanel(t){const e=Op.getElementFromSelector(t);e&&(this._setAttributeIfNotExists(e,"role","tabpanel"),t.id&&this._setAttributeIfNotExists(e,"aria-labelledby",`${t.id}`))}_toggleDropDown(t,e){const r=this._getOuterElement(t);if(!r.classList.contains("dropdown"))return;const o=(t,o)=>{const n=Op.findOne(t,r);n&&n.classList.toggle(o,e)};o(Zg,Yg),o(".dropdown-menu",Qg),r.setAttribute("aria-expanded",e)}_setAttributeIfNotExists(t,e,r){t.hasAttribute(e)||t.setAttribute(e,r)}_elemIsActive(t){return t.classList.contains(Yg)}_getInnerElement(t){return t.matches(rf)?t:Op.findOne(rf,t)}_getOuterElement(t){return t.closest(".nav-item, .list-group-item")||t}static jQueryInterface(t){return this.each((function(){const e=nf.getOrCreateInstance(this);if("string"==typeof t){if(void 0===e[t]||t.startsWith("_")||"constructor"===t)throw new TypeError(`No method named "${t}"`);e[t]()}}))}}wp.on(document,$g,ef,(function(t){["A","AREA"].includes(this.tagName)&&t.preventDefault(),Kc(this)||nf.getOrCreateInstance(this).show()})),wp.on(window,Vg,(()=>{for(const t of Op.find(of))nf.getOrCreateInstance(t)})),ep(nf);const af=".bs.toast",sf=`mouseover${af}`,lf=`mouseout${af}`,df=`focusin${af}`,cf=`focusout${af}`,pf=`hide${af}`,bf=`hidden${af}`,mf=`show${af}`,gf=`shown${af}`,ff="hide",uf="show",hf="showing",vf={animation:"boolean",autohide:"boolean",delay:"number"},xf={animation:!0,autohide:!0,delay:5e3};class wf extends Sp{constructor(t,e){super(t,e),this._timeout=null,this._hasMouseInteraction=!1,this._hasKeyboardInteraction=!1,this._setListeners()}static get Default(){return xf}static get DefaultType(){return vf}static get NAME(){return"toast"}show(){wp.trigger(this._element,mf).defaultPrevented||(this._clearTimeout(),this._config.animation&&this._element.classList.add("fade"),this._element.classList.remove(ff),Jc(this._element),this._element.classList.add(uf,hf),this._queueCallback((()=>{this._element.classList.remove(hf),wp.trigger(this._element,gf),this._maybeScheduleHide()}),this._element,this._config.animation))}hide(){this.isShown()&&(wp.trigger(this._element,pf).defaultPrevented||(this._element.classList.add(hf),this._queueCallback((()=>{this._element.classList.add(ff),this._element.classList.remove(hf,uf),wp.trigger(this._element,bf)}),this._element,this._config.animation)))}dispose(){this._clearTimeout(),this.isShown()&&this._element.classList.remove(uf),super.dispose()}isShown(){return this._element.classList.contains(uf)}_maybeScheduleHide(){this._config.autohide&&(this._hasMouseInteraction||this._hasKeyboardInteraction||(this._timeout=setTimeout((()=>{this.hide()}),this._config.delay)))}_onInteraction(t,e){switch(t.type){case"mouseover":case"mouseout":this._hasMouseInteraction=e;break;case"focusin":case"focusout":this._hasKeyboardInteraction=e}if(e)return void this._clearTimeout();const r=t.relatedTarget;this._element===r||this._element.contains(r)||this._maybeScheduleHide()}_setListeners(){wp.on(this._element,sf,(t=>this._onInteraction(t,!0))),wp.on(this._element,lf,(t=>this._onInteraction(t,!1))),wp.on(this._element,df,(t=>this._onInteraction(t,!0))),wp.on(this._element,cf,(t=>this._onInteraction(t,!1)))}_clearTimeout(){clearTimeout(this._timeout),this._timeout=null}static jQueryInterface(t){return this.each((function(){const e=wf.getOrCreateInstance(this,t);if("string"==typeof t){if(void 0===e[t])throw new TypeError(`No method named "${t}"`);e[t](this)}}))}}Cp(wf),ep(wf),r(277),((...t)=>{const e=(ii||(ii=mo(ni))).createApp(...t),{mount:r}=e;return e.mount=t=>{const o=function(t){if(x(t))return document.querySelector(t);return t}(t);if(!o)return;const n=e._component;v(n)||n.render||n.template||(n.template=o.innerHTML),1===o.nodeType&&(o.textContent="");const i=r(o,!1,function(t){return t instanceof SVGElement?"svg":"function"==typeof MathMLElement&&t instanceof MathMLElement?"mathml":void 0}(o));return o instanceof Element&&(o.removeAttribute("v-cloak"),o.setAttribute("data-v-app","")),i},e})(dd).mount("#app")})()})();
\ No newline at end of file
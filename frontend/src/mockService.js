@@ -26,11 +26,17 @@ mock.onGet('/status').reply(function(config) {
     });
 });
 
-mock.onPost('/start').reply(200);
-mock.onPost('/stop').reply(200);
-mock.onPost('/home').reply(200);
-mock.onPost('/lock').reply(200);
-mock.onPost('/unlock').reply(200);
+let lastCommandId = 0;
+const queueCommand = () => [202, { id: ++lastCommandId, status: 'queued' }];
+mock.onPost('/start').reply(queueCommand);
+mock.onPost('/stop').reply(queueCommand);
+mock.onPost('/home').reply(queueCommand);
+mock.onPost('/lock').reply(queueCommand);
+mock.onPost('/unlock').reply(queueCommand);
+mock.onGet(/\/commands\/\d+/).reply(function(config) {
+    const id = parseInt(config.url.split('/').pop());
+    return [200, { id: id, command: 'start', status: 'done' }];
+});
 
 
 mock.onGet('/mowing-plan').reply(function(config) {
@@ -47,8 +53,15 @@ mock.onGet('/mowing-plan').reply(function(config) {
                     false,
                     false
                 ],
-                "startTime": "08:00",
-                "endTime": "10:00"
+                "windows": [
+                    [{"start": "08:00", "end": "10:00"}, {"start": "18:00", "end": "20:00"}],
+                    [{"start": "08:00", "end": "10:00"}],
+                    [{"start": "08:00", "end": "10:00"}],
+                    [{"start": "08:00", "end": "10:00"}],
+                    [{"start": "08:00", "end": "10:00"}],
+                    [{"start": "10:00", "end": "12:00"}],
+                    []
+                ]
             }]);
         }, 1500);
     });
@@ -59,19 +72,18 @@ mock.onGet('/wifis').reply(function(config) {
     return new Promise(function(resolve, reject) {
         setTimeout(function() {
             resolve([200, [
-                'FRITZ!Box 7590 XYZ',
-                'FRITZ!Box 7590 ABC',
-                'FRITZ!Box 7590 DEF',
-                'Speedport W724V XYZ',
-                'Speedport W724V XYZ'
+                {ssid: 'FRITZ!Box 7590 XYZ', rssi: -48, channel: 6, auth: 'wpa2'},
+                {ssid: 'FRITZ!Box 7590 ABC', rssi: -61, channel: 1, auth: 'wpa2/wpa3'},
+                {ssid: 'Speedport W724V XYZ', rssi: -70, channel: 11, auth: 'wpa/wpa2'},
+                {ssid: 'FRITZ!Box 7590 DEF', rssi: -77, channel: 6, auth: 'wpa2'},
+                {ssid: 'Guest', rssi: -85, channel: 11, auth: 'open'}
             ]]);
         }, 1500);
     });
 });
 mock.onPost('/wifi').reply(200);
 mock.onPost('/date-and-time').reply(200);
-mock.onGet('/log-messages').reply(
-    200,
+const mockLogMessages =
     '[Time not available] Scanning wifis..\n' +
     '[Time not available] Try to connect with Wifi:\n' +
     '[Time not available] FRITZ!Box 7590 XYZ\n' +
@@ -83,8 +95,11 @@ mock.onGet('/log-messages').reply(
     '[Wed, 24/10/23 11:08:53] Mowing Plan:\n' +
     '[Wed, 24/10/23 11:08:53] Failed to read file /mowing_plan.json, using default settings\n' +
     '[Wed, 24/10/23 11:08:53] Checking automatic start or sending home required\n' +
-    '[Wed, 24/10/23 11:08:53] No custom mowing plan active'
-);
+    '[Wed, 24/10/23 11:08:53] No custom mowing plan active\n';
+mock.onGet('/log-messages').reply(config => {
+    const since = Math.min(Number(config.params && config.params.since) || 0, mockLogMessages.length);
+    return [200, mockLogMessages.slice(since), { 'x-log-cursor': String(mockLogMessages.length) }];
+});
 
 mock.onPost('/update').reply(function(config) {
     return new Promise(function(resolve, reject) {